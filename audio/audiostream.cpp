@@ -65,26 +65,34 @@ static const StreamFileFormat STREAM_FILEFORMATS[] = {
 };
 
 SeekableAudioStream *SeekableAudioStream::openStreamFile(const Common::String &basename) {
+	StreamFactory factory;
+	Common::SeekableReadStream *fileHandle = findStreamFile(basename, factory);
 	SeekableAudioStream *stream = NULL;
+
+	// Create the stream object
+	if (fileHandle)
+		stream = factory(fileHandle, DisposeAfterUse::YES);
+
+	if (stream == NULL)
+		debug(1, "SeekableAudioStream::openStreamFile: Could not open compressed AudioFile %s", basename.c_str());
+
+	return stream;
+}
+
+Common::SeekableReadStream *SeekableAudioStream::findStreamFile(const Common::String &basename, StreamFactory &factory) {
 	Common::File *fileHandle = new Common::File();
 
 	for (int i = 0; i < ARRAYSIZE(STREAM_FILEFORMATS); ++i) {
 		Common::String filename = basename + STREAM_FILEFORMATS[i].fileExtension;
 		fileHandle->open(filename);
 		if (fileHandle->isOpen()) {
-			// Create the stream object
-			stream = STREAM_FILEFORMATS[i].openStreamFile(fileHandle, DisposeAfterUse::YES);
-			fileHandle = 0;
-			break;
+			factory = STREAM_FILEFORMATS[i].openStreamFile;
+			return fileHandle;
 		}
 	}
 
 	delete fileHandle;
-
-	if (stream == NULL)
-		debug(1, "SeekableAudioStream::openStreamFile: Could not open compressed AudioFile %s", basename.c_str());
-
-	return stream;
+	return NULL;
 }
 
 #pragma mark -
@@ -170,6 +170,20 @@ public:
 	 */
 	static SeekableAudioStream *openStreamFile(const Common::String &basename);
 
+	/** Function creating a SeekableAudioStream from a file of a given format. */
+	typedef SeekableAudioStream *(*StreamFactory)(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse);
+
+	/**
+	 * Opens the file openStreamFile would load, without decoding it yet.
+	 * This allows creating the decoder, which for some formats has to
+	 * parse the whole file, separately from the file lookup.
+	 *
+	 * @param basename a filename without an extension
+	 * @param factory  set to the function creating the stream from the file
+	 * @return the opened file, or NULL if no file in a known format exists
+	 */
+	static Common::SeekableReadStream *findStreamFile(const Common::String &basename, StreamFactory &factory);
+
 	/**
 	 * Seeks to a given offset in the stream.
 	 *
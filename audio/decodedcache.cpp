@@ -0,0 +1,267 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/decodedcache.h"
+#include "audio/audiostream.h"
+#include "audio/timestamp.h"
+
+#include "common/atomic.h"
+#include "common/textconsole.h"
+#include "common/util.h"
+
+namespace Audio {
+
+/**
+ * Reference counted PCM data of a decoded sound. The counter is atomic, so
+ * streams may release their reference from any thread.
+ */
+class DecodedAudioBuffer : Common::NonCopyable {
+public:
+	DecodedAudioBuffer(int16 *data, uint32 samples, int rate, bool stereo)
+		: _data(data), _samples(samples), _rate(rate), _stereo(stereo), _refCount(1) {}
+
+	void incRef() {
+		Common::atomicFetchAdd(&_refCount, 1);
+	}
+
+	void decRef() {
+		if (Common::atomicFetchAdd(&_refCount, (uint32)-1) == 1)
+			delete this;
+	}
+
+	const int16 *getData() const { return _data; }
+	uint32 getSamples() const { return _samples; }
+	uint32 getSize() const { return _samples * sizeof(int16); }
+	int getRate() const { return _rate; }
+	bool isStereo() const { return _stereo; }
+
+private:
+	~DecodedAudioBuffer() {
+		free(_data);
+	}
+
+	int16 *const _data;
+	const uint32 _samples;
+	const int _rate;
+	const bool _stereo;
+	volatile uint32 _refCount;
+};
+
+/**
+ * A stream playing a DecodedAudioBuffer.
+ */
+class DecodedAudioStream : public SeekableAudioStream {
+public:
+	DecodedAudioStream(DecodedAudioBuffer *buffer) : _buffer(buffer), _pos(0) {
+		_buffer->incRef();
+	}
+
+	~DecodedAudioStream() {
+		_buffer->decRef();
+	}
+
+	int readBuffer(int16 *buffer, const int numSamples) {
+		const uint32 samples = MIN<uint32>(numSamples, _buffer->getSamples() - _pos);
+		memcpy(buffer, _buffer->getData() + _pos, samples * sizeof(int16));
+		_pos += samples;
+		return samples;
+	}
+
+	bool isStereo() const { return _buffer->isStereo(); }
+	int getRate() const { return _buffer->getRate(); }
+	bool endOfData() const { return _pos >= _buffer->getSamples(); }
+
+	bool seek(const Timestamp &where) {
+		const uint32 pos = convertTimeToStreamPos(where, getRate(), isStereo()).totalNumberOfFrames();
+		if (pos > _buffer->getSamples()) {
+			_pos = _buffer->getSamples();
+			return false;
+		}
+
+		_pos = pos;
+		return true;
+	}
+
+	Timestamp getLength() const {
+		return Timestamp(0, _buffer->getSamples() / (isStereo() ? 2 : 1), getRate());
+	}
+
+private:
+	DecodedAudioBuffer *_buffer;
+	uint32 _pos;
+};
+
+DecodedAudioCache::DecodedAudioCache(uint32 maxSize, bool threadSafe)
+	: _mutex(nullptr), _maxSize(maxSize), _size(0), _accessCounter(0) {
+
+	if (threadSafe) {
+		assert(g_system);
+		_mutex = g_system->createMutex();
+	}
+}
+
+DecodedAudioCache::~DecodedAudioCache() {
+	clear();
+
+	if (_mutex)
+		g_system->deleteMutex(_mutex);
+}
+
+void DecodedAudioCache::lock() {
+	if (_mutex)
+		g_system->lockMutex(_mutex);
+}
+
+void DecodedAudioCache::unlock() {
+	if (_mutex)
+		g_system->unlockMutex(_mutex);
+}
+
+SeekableAudioStream *DecodedAudioCache::find(const Common::String &key) {
+	lock();
+
+	SeekableAudioStream *result = nullptr;
+	EntryMap::iterator it = _entries.find(key);
+	if (it != _entries.end()) {
+		it->_value.lastAccess = _accessCounter++;
+		result = new DecodedAudioStream(it->_value.buffer);
+	}
+
+	unlock();
+	return result;
+}
+
+SeekableAudioStream *DecodedAudioCache::insert(const Common::String &key, SeekableAudioStream *source) {
+	if (!source)
+		return nullptr;
+
+	// Decode without holding the lock, this is the expensive part. Give
+	// up as soon as the sound turns out to be too large for the cache.
+	int16 *data = nullptr;
+	uint32 capacity = 0;
+	uint32 samples = 0;
+
+	while (!source->endOfData()) {
+		if (samples == capacity) {
+			capacity = MAX<uint32>(capacity * 2, 8192);
+			if (capacity * sizeof(int16) > _maxSize)
+				capacity = _maxSize / sizeof(int16);
+
+			if (samples == capacity) {
+				free(data);
+				source->rewind();
+				return source;
+			}
+
+			data = (int16 *)realloc(data, capacity * sizeof(int16));
+			if (!data)
+				error("DecodedAudioCache::insert: Cannot allocate %u bytes", (uint)(capacity * sizeof(int16)));
+		}
+
+		const int count = source->readBuffer(data + samples, capacity - samples);
+		if (count <= 0)
+			break;
+		samples += count;
+	}
+
+	if (samples == 0) {
+		// Keep the empty sound cached anyway, so it is not decoded again
+		free(data);
+		data = nullptr;
+	} else if (samples < capacity) {
+		data = (int16 *)realloc(data, samples * sizeof(int16));
+	}
+
+	DecodedAudioBuffer *buffer = new DecodedAudioBuffer(data, samples, source->getRate(), source->isStereo());
+	delete source;
+
+	lock();
+
+	EntryMap::iterator it = _entries.find(key);
+	if (it != _entries.end())
+		removeEntry(it);
+
+	shrink(_maxSize > buffer->getSize() ? _maxSize - buffer->getSize() : 0);
+
+	Entry &entry = _entries[key];
+	entry.buffer = buffer;
+	entry.lastAccess = _accessCounter++;
+	_size += buffer->getSize();
+
+	SeekableAudioStream *result = new DecodedAudioStream(buffer);
+
+	unlock();
+	return result;
+}
+
+void DecodedAudioCache::remove(const Common::String &key) {
+	lock();
+
+	EntryMap::iterator it = _entries.find(key);
+	if (it != _entries.end())
+		removeEntry(it);
+
+	unlock();
+}
+
+void DecodedAudioCache::clear() {
+	lock();
+
+	for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it)
+		it->_value.buffer->decRef();
+	_entries.clear();
+	_size = 0;
+
+	unlock();
+}
+
+void DecodedAudioCache::setMaxSize(uint32 maxSize) {
+	lock();
+
+	_maxSize = maxSize;
+	shrink(maxSize);
+
+	unlock();
+}
+
+void DecodedAudioCache::removeEntry(EntryMap::iterator it) {
+	_size -= it->_value.buffer->getSize();
+	it->_value.buffer->decRef();
+	_entries.erase(it);
+}
+
+void DecodedAudioCache::shrink(uint32 maxSize) {
+	// Drop the least recently used sounds. Caches hold few enough sounds
+	// that a linear search for the oldest one is cheaper than maintaining
+	// a separate list.
+	while (_size > maxSize) {
+		EntryMap::iterator oldest = _entries.begin();
+		for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+			if (it->_value.lastAccess < oldest->_value.lastAccess)
+				oldest = it;
+		}
+
+		removeEntry(oldest);
+	}
+}
+
+} // End of namespace Audio
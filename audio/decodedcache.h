@@ -0,0 +1,132 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIO_DECODEDCACHE_H
+#define AUDIO_DECODEDCACHE_H
+
+#include "common/scummsys.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/noncopyable.h"
+#include "common/str.h"
+#include "common/system.h"
+
+namespace Audio {
+
+class SeekableAudioStream;
+class DecodedAudioBuffer;
+
+/**
+ * A cache of completely decoded sounds, for sound effects which are
+ * played over and over again from compressed data.
+ *
+ * Sounds are stored as 16-bit PCM under a key chosen by the caller, e.g.
+ * the resource name. The streams handed out by the cache all share the
+ * same immutable buffer, so any number of them can play at once. When the
+ * total size of the cached sounds exceeds the limit, the least recently
+ * used ones are dropped. Buffers still being played stay alive until the
+ * last stream using them is destroyed.
+ *
+ * Typical usage:
+ * @code
+ * Audio::SeekableAudioStream *stream = cache.find(name);
+ * if (!stream)
+ *     stream = cache.insert(name, Audio::makeVorbisStream(file, DisposeAfterUse::YES));
+ * @endcode
+ *
+ * The streams returned by the cache may be destroyed from any thread,
+ * e.g. by the mixer. The cache itself can optionally be guarded by an
+ * OSystem mutex, if it is used from more than one thread.
+ */
+class DecodedAudioCache : Common::NonCopyable {
+public:
+	/**
+	 * Create a new cache.
+	 *
+	 * @param maxSize		maximum total size of the decoded sounds in bytes
+	 * @param threadSafe	whether to guard all operations with a mutex
+	 */
+	explicit DecodedAudioCache(uint32 maxSize = 4 * 1024 * 1024, bool threadSafe = false);
+	~DecodedAudioCache();
+
+	/**
+	 * Look up a sound.
+	 *
+	 * @return a new stream playing the sound from its beginning, or nullptr
+	 *         if the sound is not in the cache
+	 */
+	SeekableAudioStream *find(const Common::String &key);
+
+	/**
+	 * Decode a sound completely and store it in the cache.
+	 *
+	 * Sounds which are larger than the whole cache are not stored; in
+	 * that case the source stream is rewound and returned as is.
+	 *
+	 * @param key		key to store the sound under, replacing any sound
+	 *					stored under the same key
+	 * @param source	stream to decode; the cache takes ownership of it
+	 * @return a new stream playing the sound from its beginning, or nullptr
+	 *         if source is nullptr
+	 */
+	SeekableAudioStream *insert(const Common::String &key, SeekableAudioStream *source);
+
+	/** Drop a single sound from the cache. */
+	void remove(const Common::String &key);
+
+	/** Drop all sounds from the cache. */
+	void clear();
+
+	/** Change the size limit, dropping sounds as necessary. */
+	void setMaxSize(uint32 maxSize);
+
+	uint32 getMaxSize() const { return _maxSize; }
+
+	/** Return the total size of the cached sounds in bytes. */
+	uint32 getSize() const { return _size; }
+
+	/** Return the number of cached sounds. */
+	uint getCount() const { return _entries.size(); }
+
+private:
+	struct Entry {
+		DecodedAudioBuffer *buffer;
+		uint32 lastAccess;
+	};
+
+	typedef Common::HashMap<Common::String, Entry> EntryMap;
+
+	OSystem::MutexRef _mutex;
+	EntryMap _entries;
+	uint32 _maxSize;
+	uint32 _size;
+	uint32 _accessCounter;
+
+	void lock();
+	void unlock();
+	void removeEntry(EntryMap::iterator it);
+	void shrink(uint32 maxSize);
+};
+
+} // End of namespace Audio
+
+#endif
@@ -40,6 +40,339 @@ namespace Audio {
 // In addition, also MS IMA ADPCM is supported. See
 //   <http://wiki.multimedia.cx/index.php?title=Microsoft_IMA_ADPCM>.
 
+// The difference each code adds to the sample, indexed by
+// (stepIndex << 3) | (code & 7).
+static const uint16 okiDiffTable[49 * 8] = {
+	    2,     6,    10,    14,    18,    22,    26,    30,
+	    2,     6,    10,    14,    19,    23,    27,    31,
+	    2,     7,    11,    16,    21,    26,    30,    35,
+	    2,     7,    13,    18,    23,    28,    34,    39,
+	    2,     8,    14,    20,    25,    31,    37,    43,
+	    3,     9,    15,    21,    28,    34,    40,    46,
+	    3,    10,    17,    24,    31,    38,    45,    52,
+	    3,    11,    19,    27,    34,    42,    50,    58,
+	    4,    12,    21,    29,    38,    46,    55,    63,
+	    4,    13,    23,    32,    41,    50,    60,    69,
+	    5,    15,    25,    35,    46,    56,    66,    76,
+	    5,    16,    28,    39,    50,    61,    73,    84,
+	    6,    18,    31,    43,    56,    68,    81,    93,
+	    6,    20,    34,    48,    61,    75,    89,   103,
+	    7,    22,    37,    52,    67,    82,    97,   112,
+	    8,    24,    41,    57,    74,    90,   107,   123,
+	    9,    27,    45,    63,    82,   100,   118,   136,
+	   10,    30,    50,    70,    90,   110,   130,   150,
+	   11,    33,    55,    77,    99,   121,   143,   165,
+	   12,    36,    60,    84,   109,   133,   157,   181,
+	   13,    40,    66,    93,   120,   147,   173,   200,
+	   14,    44,    73,   103,   132,   162,   191,   221,
+	   16,    48,    81,   113,   146,   178,   211,   243,
+	   17,    53,    89,   125,   160,   196,   232,   268,
+	   19,    58,    98,   137,   176,   215,   255,   294,
+	   21,    64,   108,   151,   194,   237,   281,   324,
+	   23,    71,   118,   166,   213,   261,   308,   356,
+	   26,    78,   130,   182,   235,   287,   339,   391,
+	   28,    86,   143,   201,   258,   316,   373,   431,
+	   31,    94,   158,   221,   284,   347,   411,   474,
+	   34,   104,   174,   244,   313,   383,   453,   523,
+	   38,   115,   191,   268,   345,   422,   498,   575,
+	   42,   126,   210,   294,   379,   463,   547,   631,
+	   46,   139,   231,   324,   417,   510,   602,   695,
+	   51,   153,   255,   357,   459,   561,   663,   765,
+	   56,   168,   280,   392,   505,   617,   729,   841,
+	   61,   185,   308,   432,   555,   679,   802,   926,
+	   68,   204,   340,   476,   612,   748,   884,  1020,
+	   74,   224,   373,   523,   672,   822,   971,  1121,
+	   82,   246,   411,   575,   740,   904,  1069,  1233,
+	   90,   271,   452,   633,   814,   995,  1176,  1357,
+	   99,   298,   497,   696,   895,  1094,  1293,  1492,
+	  109,   328,   547,   766,   985,  1204,  1423,  1642,
+	  120,   361,   601,   842,  1083,  1324,  1564,  1805,
+	  132,   397,   662,   927,  1192,  1457,  1722,  1987,
+	  145,   437,   728,  1020,  1311,  1603,  1894,  2186,
+	  160,   480,   801,  1121,  1442,  1762,  2083,  2403,
+	  176,   529,   881,  1234,  1587,  1940,  2292,  2645,
+	  194,   582,   970,  1358,  1746,  2134,  2522,  2910
+};
+
+static const uint16 imaDiffTable[89 * 8] = {
+	    0,     2,     4,     6,     7,     9,    11,    13,
+	    1,     3,     5,     7,     9,    11,    13,    15,
+	    1,     3,     5,     7,    10,    12,    14,    16,
+	    1,     3,     6,     8,    11,    13,    16,    18,
+	    1,     4,     6,     9,    12,    15,    17,    20,
+	    1,     4,     7,    10,    13,    16,    19,    22,
+	    1,     4,     8,    11,    14,    17,    21,    24,
+	    1,     5,     8,    12,    15,    19,    22,    26,
+	    2,     6,    10,    14,    18,    22,    26,    30,
+	    2,     6,    10,    14,    19,    23,    27,    31,
+	    2,     7,    11,    16,    21,    26,    30,    35,
+	    2,     7,    13,    18,    23,    28,    34,    39,
+	    2,     8,    14,    20,    25,    31,    37,    43,
+	    3,     9,    15,    21,    28,    34,    40,    46,
+	    3,    10,    17,    24,    31,    38,    45,    52,
+	    3,    11,    19,    27,    34,    42,    50,    58,
+	    4,    12,    21,    29,    38,    46,    55,    63,
+	    4,    13,    23,    32,    41,    50,    60,    69,
+	    5,    15,    25,    35,    46,    56,    66,    76,
+	    5,    16,    28,    39,    50,    61,    73,    84,
+	    6,    18,    31,    43,    56,    68,    81,    93,
+	    6,    20,    34,    48,    61,    75,    89,   103,
+	    7,    22,    37,    52,    67,    82,    97,   112,
+	    8,    24,    41,    57,    74,    90,   107,   123,
+	    9,    27,    45,    63,    82,   100,   118,   136,
+	   10,    30,    50,    70,    90,   110,   130,   150,
+	   11,    33,    55,    77,    99,   121,   143,   165,
+	   12,    36,    60,    84,   109,   133,   157,   181,
+	   13,    40,    66,    93,   120,   147,   173,   200,
+	   14,    44,    73,   103,   132,   162,   191,   221,
+	   16,    48,    81,   113,   146,   178,   211,   243,
+	   17,    53,    89,   125,   160,   196,   232,   268,
+	   19,    58,    98,   137,   176,   215,   255,   294,
+	   21,    64,   108,   151,   194,   237,   281,   324,
+	   23,    71,   118,   166,   213,   261,   308,   356,
+	   26,    78,   130,   182,   235,   287,   339,   391,
+	   28,    86,   143,   201,   258,   316,   373,   431,
+	   31,    94,   158,   221,   284,   347,   411,   474,
+	   34,   104,   174,   244,   313,   383,   453,   523,
+	   38,   115,   191,   268,   345,   422,   498,   575,
+	   42,   126,   210,   294,   379,   463,   547,   631,
+	   46,   139,   231,   324,   417,   510,   602,   695,
+	   51,   153,   255,   357,   459,   561,   663,   765,
+	   56,   168,   280,   392,   505,   617,   729,   841,
+	   61,   185,   308,   432,   555,   679,   802,   926,
+	   68,   204,   340,   476,   612,   748,   884,  1020,
+	   74,   224,   373,   523,   672,   822,   971,  1121,
+	   82,   246,   411,   575,   740,   904,  1069,  1233,
+	   90,   271,   452,   633,   814,   995,  1176,  1357,
+	   99,   298,   497,   696,   895,  1094,  1293,  1492,
+	  109,   328,   547,   766,   985,  1204,  1423,  1642,
+	  120,   361,   601,   842,  1083,  1324,  1564,  1805,
+	  132,   397,   662,   927,  1192,  1457,  1722,  1987,
+	  145,   437,   728,  1020,  1311,  1603,  1894,  2186,
+	  160,   480,   801,  1121,  1442,  1762,  2083,  2403,
+	  176,   529,   881,  1234,  1587,  1940,  2292,  2645,
+	  194,   582,   970,  1358,  1746,  2134,  2522,  2910,
+	  213,   640,  1066,  1493,  1920,  2347,  2773,  3200,
+	  234,   704,  1173,  1643,  2112,  2582,  3051,  3521,
+	  258,   774,  1291,  1807,  2324,  2840,  3357,  3873,
+	  284,   852,  1420,  1988,  2556,  3124,  3692,  4260,
+	  312,   937,  1561,  2186,  2811,  3436,  4060,  4685,
+	  343,  1030,  1718,  2405,  3092,  3779,  4467,  5154,
+	  378,  1134,  1890,  2646,  3402,  4158,  4914,  5670,
+	  415,  1247,  2079,  2911,  3742,  4574,  5406,  6238,
+	  457,  1372,  2287,  3202,  4117,  5032,  5947,  6862,
+	  503,  1509,  2516,  3522,  4529,  5535,  6542,  7548,
+	  553,  1660,  2767,  3874,  4981,  6088,  7195,  8302,
+	  608,  1826,  3044,  4262,  5479,  6697,  7915,  9133,
+	  669,  2009,  3348,  4688,  6027,  7367,  8706, 10046,
+	  736,  2210,  3683,  5157,  6630,  8104,  9577, 11051,
+	  810,  2431,  4052,  5673,  7294,  8915, 10536, 12157,
+	  891,  2674,  4457,  6240,  8023,  9806, 11589, 13372,
+	  980,  2941,  4903,  6864,  8825, 10786, 12748, 14709,
+	 1078,  3236,  5393,  7551,  9708, 11866, 14023, 16181,
+	 1186,  3559,  5933,  8306, 10679, 13052, 15426, 17799,
+	 1305,  3915,  6526,  9136, 11747, 14357, 16968, 19578,
+	 1435,  4307,  7179, 10051, 12922, 15794, 18666, 21538,
+	 1579,  4738,  7896, 11055, 14214, 17373, 20531, 23690,
+	 1737,  5212,  8686, 12161, 15636, 19111, 22585, 26060,
+	 1911,  5733,  9555, 13377, 17200, 21022, 24844, 28666,
+	 2102,  6306, 10511, 14715, 18920, 23124, 27329, 31533,
+	 2312,  6937, 11562, 16187, 20812, 25437, 30062, 34687,
+	 2543,  7631, 12718, 17806, 22893, 27981, 33068, 38156,
+	 2798,  8394, 13990, 19586, 25183, 30779, 36375, 41971,
+	 3077,  9233, 15389, 21545, 27700, 33856, 40012, 46168,
+	 3385, 10157, 16928, 23700, 30471, 37243, 44014, 50786,
+	 3724, 11172, 18621, 26069, 33518, 40966, 48415, 55863,
+	 4095, 12287, 20479, 28671, 36862, 45054, 53246, 61438
+};
+
+// Westwood's games use this one. The values differ from imaDiffTable in the
+// lowest bits, since the shifts truncate each part of the sum separately.
+static const uint16 imaShiftAddDiffTable[89 * 8] = {
+	    0,     1,     3,     4,     7,     8,    10,    11,
+	    1,     3,     5,     7,     9,    11,    13,    15,
+	    1,     3,     5,     7,    10,    12,    14,    16,
+	    1,     3,     6,     8,    11,    13,    16,    18,
+	    1,     3,     6,     8,    12,    14,    17,    19,
+	    1,     4,     7,    10,    13,    16,    19,    22,
+	    1,     4,     7,    10,    14,    17,    20,    23,
+	    1,     4,     8,    11,    15,    18,    22,    25,
+	    2,     6,    10,    14,    18,    22,    26,    30,
+	    2,     6,    10,    14,    19,    23,    27,    31,
+	    2,     6,    11,    15,    21,    25,    30,    34,
+	    2,     7,    12,    17,    23,    28,    33,    38,
+	    2,     7,    13,    18,    25,    30,    36,    41,
+	    3,     9,    15,    21,    28,    34,    40,    46,
+	    3,    10,    17,    24,    31,    38,    45,    52,
+	    3,    10,    18,    25,    34,    41,    49,    56,
+	    4,    12,    21,    29,    38,    46,    55,    63,
+	    4,    13,    22,    31,    41,    50,    59,    68,
+	    5,    15,    25,    35,    46,    56,    66,    76,
+	    5,    16,    27,    38,    50,    61,    72,    83,
+	    6,    18,    31,    43,    56,    68,    81,    93,
+	    6,    19,    33,    46,    61,    74,    88,   101,
+	    7,    22,    37,    52,    67,    82,    97,   112,
+	    8,    24,    41,    57,    74,    90,   107,   123,
+	    9,    27,    45,    63,    82,   100,   118,   136,
+	   10,    30,    50,    70,    90,   110,   130,   150,
+	   11,    33,    55,    77,    99,   121,   143,   165,
+	   12,    36,    60,    84,   109,   133,   157,   181,
+	   13,    39,    66,    92,   120,   146,   173,   199,
+	   14,    43,    73,   102,   132,   161,   191,   220,
+	   16,    48,    81,   113,   146,   178,   211,   243,
+	   17,    52,    88,   123,   160,   195,   231,   266,
+	   19,    58,    97,   136,   176,   215,   254,   293,
+	   21,    64,   107,   150,   194,   237,   280,   323,
+	   23,    70,   118,   165,   213,   260,   308,   355,
+	   26,    78,   130,   182,   235,   287,   339,   391,
+	   28,    85,   143,   200,   258,   315,   373,   430,
+	   31,    94,   157,   220,   284,   347,   410,   473,
+	   34,   103,   173,   242,   313,   382,   452,   521,
+	   38,   114,   191,   267,   345,   421,   498,   574,
+	   42,   126,   210,   294,   379,   463,   547,   631,
+	   46,   138,   231,   323,   417,   509,   602,   694,
+	   51,   153,   255,   357,   459,   561,   663,   765,
+	   56,   168,   280,   392,   505,   617,   729,   841,
+	   61,   184,   308,   431,   555,   678,   802,   925,
+	   68,   204,   340,   476,   612,   748,   884,  1020,
+	   74,   223,   373,   522,   672,   821,   971,  1120,
+	   82,   246,   411,   575,   740,   904,  1069,  1233,
+	   90,   271,   452,   633,   814,   995,  1176,  1357,
+	   99,   298,   497,   696,   895,  1094,  1293,  1492,
+	  109,   328,   547,   766,   985,  1204,  1423,  1642,
+	  120,   360,   601,   841,  1083,  1323,  1564,  1804,
+	  132,   397,   662,   927,  1192,  1457,  1722,  1987,
+	  145,   436,   728,  1019,  1311,  1602,  1894,  2185,
+	  160,   480,   801,  1121,  1442,  1762,  2083,  2403,
+	  176,   528,   881,  1233,  1587,  1939,  2292,  2644,
+	  194,   582,   970,  1358,  1746,  2134,  2522,  2910,
+	  213,   639,  1066,  1492,  1920,  2346,  2773,  3199,
+	  234,   703,  1173,  1642,  2112,  2581,  3051,  3520,
+	  258,   774,  1291,  1807,  2324,  2840,  3357,  3873,
+	  284,   852,  1420,  1988,  2556,  3124,  3692,  4260,
+	  312,   936,  1561,  2185,  2811,  3435,  4060,  4684,
+	  343,  1030,  1717,  2404,  3092,  3779,  4466,  5153,
+	  378,  1134,  1890,  2646,  3402,  4158,  4914,  5670,
+	  415,  1246,  2078,  2909,  3742,  4573,  5405,  6236,
+	  457,  1372,  2287,  3202,  4117,  5032,  5947,  6862,
+	  503,  1509,  2516,  3522,  4529,  5535,  6542,  7548,
+	  553,  1660,  2767,  3874,  4981,  6088,  7195,  8302,
+	  608,  1825,  3043,  4260,  5479,  6696,  7914,  9131,
+	  669,  2008,  3348,  4687,  6027,  7366,  8706, 10045,
+	  736,  2209,  3683,  5156,  6630,  8103,  9577, 11050,
+	  810,  2431,  4052,  5673,  7294,  8915, 10536, 12157,
+	  891,  2674,  4457,  6240,  8023,  9806, 11589, 13372,
+	  980,  2941,  4902,  6863,  8825, 10786, 12747, 14708,
+	 1078,  3235,  5393,  7550,  9708, 11865, 14023, 16180,
+	 1186,  3559,  5932,  8305, 10679, 13052, 15425, 17798,
+	 1305,  3915,  6526,  9136, 11747, 14357, 16968, 19578,
+	 1435,  4306,  7178, 10049, 12922, 15793, 18665, 21536,
+	 1579,  4737,  7896, 11054, 14214, 17372, 20531, 23689,
+	 1737,  5211,  8686, 12160, 15636, 19110, 22585, 26059,
+	 1911,  5733,  9555, 13377, 17200, 21022, 24844, 28666,
+	 2102,  6306, 10511, 14715, 18920, 23124, 27329, 31533,
+	 2312,  6937, 11562, 16187, 20812, 25437, 30062, 34687,
+	 2543,  7630, 12718, 17805, 22893, 27980, 33068, 38155,
+	 2798,  8394, 13990, 19586, 25183, 30779, 36375, 41971,
+	 3077,  9232, 15388, 21543, 27700, 33855, 40011, 46166,
+	 3385, 10156, 16928, 23699, 30471, 37242, 44014, 50785,
+	 3724, 11172, 18621, 26069, 33518, 40966, 48415, 55863,
+	 4095, 12286, 20478, 28669, 36862, 45053, 53245, 61436
+};
+
+// This table is used to adjust the step for use on the next sample.
+// We could half the table, but since the lookup index used is always
+// a 4-bit nibble, it's more efficient to just keep it as it is.
+const int16 ADPCMStream::_stepAdjustTable[16] = {
+	-1, -1, -1, -1, 2, 4, 6, 8,
+	-1, -1, -1, -1, 2, 4, 6, 8
+};
+
+const int16 Ima_ADPCMStream::_imaTable[89] = {
+		7,    8,    9,   10,   11,   12,   13,   14,
+	   16,   17,   19,   21,   23,   25,   28,   31,
+	   34,   37,   41,   45,   50,   55,   60,   66,
+	   73,   80,   88,   97,  107,  118,  130,  143,
+	  157,  173,  190,  209,  230,  253,  279,  307,
+	  337,  371,  408,  449,  494,  544,  598,  658,
+	  724,  796,  876,  963, 1060, 1166, 1282, 1411,
+	 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+	 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484,
+	 7132, 7845, 8630, 9493,10442,11487,12635,13899,
+	15289,16818,18500,20350,22385,24623,27086,29794,
+	32767
+};
+
+namespace {
+
+// Decode one OKI or IMA code, the step index must be valid on entry.
+template<int kMinSample, int kMaxSample, int kMaxStepIndex>
+inline int32 decodeCode(int32 &last, int32 &stepIndex, byte code, const uint16 *diffTable) {
+	const int32 diff = diffTable[(stepIndex << 3) | (code & 0x07)];
+	last = CLIP<int32>((code & 0x08) ? last - diff : last + diff, kMinSample, kMaxSample);
+	stepIndex = CLIP<int32>(stepIndex + ADPCMStream::_stepAdjustTable[code], 0, kMaxStepIndex);
+	return last;
+}
+
+inline int32 decodeIMACode(int32 &last, int32 &stepIndex, byte code, const uint16 *diffTable) {
+	return decodeCode<-32768, 32767, 88>(last, stepIndex, code, diffTable);
+}
+
+// Decode bytes holding a code of the first channel in the high nibble and
+// one of the second channel in the low nibble, as used by OKI and DVI. Both
+// channels may be the same.
+template<int kMinSample, int kMaxSample, int kMaxStepIndex>
+void decodeBytes(IMAChannelStatus &high, IMAChannelStatus &low, const byte *in, uint32 size, int16 *out, const uint16 *diffTable, int scale) {
+	int32 highLast = high.last, highStepIndex = high.stepIndex;
+	int32 lowLast = low.last, lowStepIndex = low.stepIndex;
+	const bool mono = (&high == &low);
+
+	for (const byte *end = in + size; in != end; ++in) {
+		*out++ = decodeCode<kMinSample, kMaxSample, kMaxStepIndex>(highLast, highStepIndex, *in >> 4, diffTable) * scale;
+
+		if (mono) {
+			*out++ = decodeCode<kMinSample, kMaxSample, kMaxStepIndex>(highLast, highStepIndex, *in & 0x0f, diffTable) * scale;
+		} else {
+			*out++ = decodeCode<kMinSample, kMaxSample, kMaxStepIndex>(lowLast, lowStepIndex, *in & 0x0f, diffTable) * scale;
+		}
+	}
+
+	if (mono) {
+		high.last = highLast;
+		high.stepIndex = highStepIndex;
+	} else {
+		high.last = highLast;
+		high.stepIndex = highStepIndex;
+		low.last = lowLast;
+		low.stepIndex = lowStepIndex;
+	}
+}
+
+} // End of anonymous namespace
+
+void decodeIMABuffer(IMAChannelStatus &status, const byte *in, uint32 size, int16 *out, uint stride, bool highNibbleFirst, IMAVariant variant) {
+	const uint16 *diffTable = (variant == kIMAShiftAdd) ? imaShiftAddDiffTable : imaDiffTable;
+	const int firstShift = highNibbleFirst ? 4 : 0;
+	const int secondShift = highNibbleFirst ? 0 : 4;
+
+	int32 last = status.last;
+	int32 stepIndex = status.stepIndex;
+
+	for (const byte *end = in + size; in != end; ++in) {
+		*out = decodeIMACode(last, stepIndex, (*in >> firstShift) & 0x0f, diffTable);
+		out += stride;
+		*out = decodeIMACode(last, stepIndex, (*in >> secondShift) & 0x0f, diffTable);
+		out += stride;
+	}
+
+	status.last = last;
+	status.stepIndex = stepIndex;
+}
+
+
+#pragma mark -
+
+
 ADPCMStream::ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
 	: _stream(stream, disposeAfterUse),
 		_startpos(stream->pos()),
@@ -54,6 +387,8 @@ ADPCMStream::ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Fl
 void ADPCMStream::reset() {
 	memset(&_status, 0, sizeof(_status));
 	_blockPos[0] = _blockPos[1] = _blockAlign; // To make sure first header is read
+	_blockSamples.resize(0);
+	_blockSamplePos = 0;
 }
 
 bool ADPCMStream::rewind() {
@@ -63,56 +398,62 @@ bool ADPCMStream::rewind() {
 	return true;
 }
 
+uint32 ADPCMStream::readBlock(uint32 size) {
+	const int32 left = _endpos - _stream->pos();
+	size = MIN<uint32>(size, MAX<int32>(left, 0));
+
+	_blockData.resize(size);
+	if (size)
+		size = _stream->read(_blockData.begin(), size);
+	_blockData.resize(size);
+
+	return size;
+}
+
+int ADPCMStream::readBlockSamples(int16 *buffer, int numSamples) {
+	const int samples = MIN<uint32>(numSamples, _blockSamples.size() - _blockSamplePos);
+	if (samples <= 0)
+		return 0;
+
+	memcpy(buffer, &_blockSamples[_blockSamplePos], samples * sizeof(int16));
+	_blockSamplePos += samples;
+
+	return samples;
+}
+
 
 #pragma mark -
 
 
 int Oki_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
-	int samples;
-	byte data;
-
-	for (samples = 0; samples < numSamples && !endOfData(); samples++) {
-		if (_decodedSampleCount == 0) {
-			data = _stream->readByte();
-			_decodedSamples[0] = decodeOKI((data >> 4) & 0x0f);
-			_decodedSamples[1] = decodeOKI((data >> 0) & 0x0f);
-			_decodedSampleCount = 2;
+	// Return the sample left over from the last byte decoded
+	int samples = readBlockSamples(buffer, numSamples);
+
+	while (samples < numSamples && !endOfData()) {
+		const uint32 size = readBlock((numSamples - samples + 1) / 2);
+		if (!size)
+			break;
+
+		// Decode all complete byte pairs directly into the buffer
+		const uint32 direct = MIN<uint32>(size, (numSamples - samples) / 2);
+		decodeBytes<-2048, 2047, 48>(_status.ima_ch[0], _status.ima_ch[0], _blockData.begin(), direct, buffer + samples, okiDiffTable, 16);
+		samples += direct * 2;
+
+		if (direct < size) {
+			_blockSamples.resize(2);
+			_blockSamplePos = 0;
+			decodeBytes<-2048, 2047, 48>(_status.ima_ch[0], _status.ima_ch[0], _blockData.begin() + direct, 1, _blockSamples.begin(), okiDiffTable, 16);
+			samples += readBlockSamples(buffer + samples, numSamples - samples);
 		}
-
-		// (1 - (count - 1)) ensures that _decodedSamples acts as a FIFO of depth 2
-		buffer[samples] = _decodedSamples[1 - (_decodedSampleCount - 1)];
-		_decodedSampleCount--;
 	}
 
 	return samples;
 }
 
-static const int16 okiStepSize[49] = {
-	   16,   17,   19,   21,   23,   25,   28,   31,
-	   34,   37,   41,   45,   50,   55,   60,   66,
-	   73,   80,   88,   97,  107,  118,  130,  143,
-	  157,  173,  190,  209,  230,  253,  279,  307,
-	  337,  371,  408,  449,  494,  544,  598,  658,
-	  724,  796,  876,  963, 1060, 1166, 1282, 1411,
-	 1552
-};
-
 // Decode Linear to ADPCM
 int16 Oki_ADPCMStream::decodeOKI(byte code) {
-	int16 diff, E, samp;
-
-	E = (2 * (code & 0x7) + 1) * okiStepSize[_status.ima_ch[0].stepIndex] / 8;
-	diff = (code & 0x08) ? -E : E;
-	samp = _status.ima_ch[0].last + diff;
-	// Clip the values to +/- 2^11 (supposed to be 12 bits)
-	samp = CLIP<int16>(samp, -2048, 2047);
-
-	_status.ima_ch[0].last = samp;
-	_status.ima_ch[0].stepIndex += _stepAdjustTable[code];
-	_status.ima_ch[0].stepIndex = CLIP<int32>(_status.ima_ch[0].stepIndex, 0, ARRAYSIZE(okiStepSize) - 1);
-
 	// * 16 effectively converts 12-bit input to 16-bit output
-	return samp * 16;
+	return decodeCode<-2048, 2047, 48>(_status.ima_ch[0].last, _status.ima_ch[0].stepIndex, code, okiDiffTable) * 16;
 }
 
 
@@ -120,20 +461,28 @@ int16 Oki_ADPCMStream::decodeOKI(byte code) {
 
 
 int DVI_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
-	int samples;
-	byte data;
-
-	for (samples = 0; samples < numSamples && !endOfData(); samples++) {
-		if (_decodedSampleCount == 0) {
-			data = _stream->readByte();
-			_decodedSamples[0] = decodeIMA((data >> 4) & 0x0f, 0);
-			_decodedSamples[1] = decodeIMA((data >> 0) & 0x0f, _channels == 2 ? 1 : 0);
-			_decodedSampleCount = 2;
+	IMAChannelStatus &high = _status.ima_ch[0];
+	IMAChannelStatus &low = _status.ima_ch[_channels == 2 ? 1 : 0];
+
+	// Return the sample left over from the last byte decoded
+	int samples = readBlockSamples(buffer, numSamples);
+
+	while (samples < numSamples && !endOfData()) {
+		const uint32 size = readBlock((numSamples - samples + 1) / 2);
+		if (!size)
+			break;
+
+		// Decode all complete byte pairs directly into the buffer
+		const uint32 direct = MIN<uint32>(size, (numSamples - samples) / 2);
+		decodeBytes<-32768, 32767, 88>(high, low, _blockData.begin(), direct, buffer + samples, imaDiffTable, 1);
+		samples += direct * 2;
+
+		if (direct < size) {
+			_blockSamples.resize(2);
+			_blockSamplePos = 0;
+			decodeBytes<-32768, 32767, 88>(high, low, _blockData.begin() + direct, 1, _blockSamples.begin(), imaDiffTable, 1);
+			samples += readBlockSamples(buffer + samples, numSamples - samples);
 		}
-
-		// (1 - (count - 1)) ensures that _decodedSamples acts as a FIFO of depth 2
-		buffer[samples] = _decodedSamples[1 - (_decodedSampleCount - 1)];
-		_decodedSampleCount--;
 	}
 
 	return samples;
@@ -146,63 +495,48 @@ int Apple_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
 	// Need to write at least one samples per channel
 	assert((numSamples % _channels) == 0);
 
-	// Current sample positions
-	int samples[2] = { 0, 0};
+	int samples = readBlockSamples(buffer, numSamples);
 
-	// Number of samples per channel
-	int chanSamples = numSamples / _channels;
+	while (samples < numSamples && !_stream->eos() && _stream->pos() < _endpos) {
+		// The channels are interleaved block-wise, read one block of each
+		const uint32 size = readBlock(_blockAlign * _channels);
 
-	for (int i = 0; i < _channels; i++) {
-		_stream->seek(_streamPos[i]);
+		// Only decode as many bytes as the shortest block has
+		uint32 dataSize = _blockAlign - 2;
+		for (int i = 0; i < _channels; i++) {
+			const uint32 blockStart = i * _blockAlign;
+			const uint32 blockSize = (size > blockStart) ? MIN<uint32>(_blockAlign, size - blockStart) : 0;
+			dataSize = MIN<uint32>(dataSize, (blockSize > 2) ? blockSize - 2 : 0);
+		}
 
-		while ((samples[i] < chanSamples) &&
-		       // Last byte read and a new one needed
-		       !((_stream->eos() || (_stream->pos() >= _endpos)) && (_chunkPos[i] == 0))) {
+		if (!dataSize)
+			break;
 
-			if (_blockPos[i] == _blockAlign) {
-				// 2 byte header per block
-				uint16 temp = _stream->readUint16BE();
+		_blockSamples.resize(dataSize * 2 * _channels);
+		_blockSamplePos = 0;
 
-				// First 9 bits are the upper bits of the predictor
-				_status.ima_ch[i].last      = (int16) (temp & 0xFF80);
-				// Lower 7 bits are the step index
-				_status.ima_ch[i].stepIndex =          temp & 0x007F;
+		for (int i = 0; i < _channels; i++) {
+			const byte *block = _blockData.begin() + i * _blockAlign;
 
-				// Clip the step index
-				_status.ima_ch[i].stepIndex = CLIP<int32>(_status.ima_ch[i].stepIndex, 0, 88);
+			// 2 byte header per block
+			uint16 temp = READ_BE_UINT16(block);
 
-				_blockPos[i] = 2;
-			}
+			// First 9 bits are the upper bits of the predictor
+			_status.ima_ch[i].last      = (int16) (temp & 0xFF80);
+			// Lower 7 bits are the step index
+			_status.ima_ch[i].stepIndex =          temp & 0x007F;
 
-			if (_chunkPos[i] == 0) {
-				// Decode data
-				byte data = _stream->readByte();
-				_buffer[i][0] = decodeIMA(data &  0x0F, i);
-				_buffer[i][1] = decodeIMA(data >>    4, i);
-			}
+			// Clip the step index
+			_status.ima_ch[i].stepIndex = CLIP<int32>(_status.ima_ch[i].stepIndex, 0, 88);
 
 			// The original is interleaved block-wise, we want it sample-wise
-			buffer[_channels * samples[i] + i] = _buffer[i][_chunkPos[i]];
-
-			if (++_chunkPos[i] > 1) {
-				// We're about to decode the next byte, so advance the block position
-				_chunkPos[i] = 0;
-				_blockPos[i]++;
-			}
-
-			samples[i]++;
-
-			if (_channels == 2)
-				if (_blockPos[i] == _blockAlign)
-					// We're at the end of the block.
-					// Since the channels are interleaved, skip the next block
-					_stream->skip(MIN<uint32>(_blockAlign, _endpos - _stream->pos()));
-
-			_streamPos[i] = _stream->pos();
+			decodeIMABuffer(_status.ima_ch[i], block + 2, dataSize, _blockSamples.begin() + i, _channels);
 		}
+
+		samples += readBlockSamples(buffer + samples, numSamples - samples);
 	}
 
-	return samples[0] + samples[1];
+	return samples;
 }
 
 
@@ -213,39 +547,30 @@ int MSIma_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
 	// Need to write at least one sample per channel
 	assert((numSamples % _channels) == 0);
 
-	int samples = 0;
+	int samples = readBlockSamples(buffer, numSamples);
 
 	while (samples < numSamples && !_stream->eos() && _stream->pos() < _endpos) {
-		if (_blockPos[0] == _blockAlign) {
-			for (int i = 0; i < _channels; i++) {
-				// read block header
-				_status.ima_ch[i].last = _stream->readSint16LE();
-				_status.ima_ch[i].stepIndex = _stream->readSint16LE();
-			}
-
-			_blockPos[0] = _channels * 4;
-		}
-
-		// Decode a set of samples
 		for (int i = 0; i < _channels; i++) {
-			// The stream encodes four bytes per channel at a time
-			for (int j = 0; j < 4; j++) {
-				byte data = _stream->readByte();
-				_blockPos[0]++;
-				_buffer[i][j * 2] = decodeIMA(data & 0x0f, i);
-				_buffer[i][j * 2 + 1] = decodeIMA((data >> 4) & 0x0f, i);
-				_samplesLeft[i] += 2;
-			}
+			// read block header
+			_status.ima_ch[i].last = _stream->readSint16LE();
+			_status.ima_ch[i].stepIndex = CLIP<int32>(_stream->readSint16LE(), 0, 88);
 		}
 
-		while (samples < numSamples && _samplesLeft[0] != 0) {
-			for (int i = 0; i < _channels; i++) {
-				buffer[samples + i] = _buffer[i][8 - _samplesLeft[i]];
-				_samplesLeft[i]--;
-			}
+		// The stream encodes four bytes per channel at a time. Pad a
+		// truncated last set with zeros.
+		const uint32 setSize = _channels * 4;
+		const uint32 sets = (readBlock(_blockAlign - setSize) + setSize - 1) / setSize;
+		_blockData.resize(sets * setSize);
+
+		_blockSamples.resize(sets * setSize * 2);
+		_blockSamplePos = 0;
 
-			samples += _channels;
+		for (uint32 set = 0; set < sets; set++) {
+			for (int i = 0; i < _channels; i++)
+				decodeIMABuffer(_status.ima_ch[i], &_blockData[set * setSize + i * 4], 4, &_blockSamples[set * setSize * 2 + i], _channels);
 		}
+
+		samples += readBlockSamples(buffer + samples, numSamples - samples);
 	}
 
 	return samples;
@@ -287,45 +612,54 @@ int16 MS_ADPCMStream::decodeMS(ADPCMChannelStatus *c, byte code) {
 }
 
 int MS_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
-	int samples;
-	byte data;
+	int samples = readBlockSamples(buffer, numSamples);
 	int i;
 
-	for (samples = 0; samples < numSamples && !endOfData(); samples++) {
-		if (_decodedSampleCount == 0) {
-			if (_blockPos[0] == _blockAlign) {
-				// read block header
-				for (i = 0; i < _channels; i++) {
-					_status.ch[i].predictor = CLIP(_stream->readByte(), (byte)0, (byte)6);
-					_status.ch[i].coeff1 = MSADPCMAdaptCoeff1[_status.ch[i].predictor];
-					_status.ch[i].coeff2 = MSADPCMAdaptCoeff2[_status.ch[i].predictor];
-				}
-
-				for (i = 0; i < _channels; i++)
-					_status.ch[i].delta = _stream->readSint16LE();
-
-				for (i = 0; i < _channels; i++)
-					_status.ch[i].sample1 = _stream->readSint16LE();
-
-				for (i = 0; i < _channels; i++)
-					_decodedSamples[_decodedSampleCount++] = _status.ch[i].sample2 = _stream->readSint16LE();
-
-				for (i = 0; i < _channels; i++)
-					_decodedSamples[_decodedSampleCount++] = _status.ch[i].sample1;
-
-				_blockPos[0] = _channels * 7;
-			} else {
-				data = _stream->readByte();
-				_blockPos[0]++;
-				_decodedSamples[_decodedSampleCount++] = decodeMS(&_status.ch[0], (data >> 4) & 0x0f);
-				_decodedSamples[_decodedSampleCount++] = decodeMS(&_status.ch[_channels - 1], data & 0x0f);
-			}
-			_decodedSampleIndex = 0;
+	while (samples < numSamples && !_stream->eos() && _stream->pos() < _endpos) {
+		const uint32 headerSize = _channels * 7;
+		const uint32 size = readBlock(_blockAlign);
+		if (size < headerSize)
+			break;
+
+		const byte *data = _blockData.begin();
+
+		// read block header
+		for (i = 0; i < _channels; i++) {
+			_status.ch[i].predictor = CLIP(data[i], (byte)0, (byte)6);
+			_status.ch[i].coeff1 = MSADPCMAdaptCoeff1[_status.ch[i].predictor];
+			_status.ch[i].coeff2 = MSADPCMAdaptCoeff2[_status.ch[i].predictor];
+		}
+		data += _channels;
+
+		for (i = 0; i < _channels; i++)
+			_status.ch[i].delta = READ_LE_INT16(data + i * 2);
+		data += _channels * 2;
+
+		for (i = 0; i < _channels; i++)
+			_status.ch[i].sample1 = READ_LE_INT16(data + i * 2);
+		data += _channels * 2;
+
+		for (i = 0; i < _channels; i++)
+			_status.ch[i].sample2 = READ_LE_INT16(data + i * 2);
+		data += _channels * 2;
+
+		_blockSamples.resize(_channels * 2 + (size - headerSize) * 2);
+		_blockSamplePos = 0;
+
+		int16 *out = _blockSamples.begin();
+
+		for (i = 0; i < _channels; i++)
+			*out++ = _status.ch[i].sample2;
+
+		for (i = 0; i < _channels; i++)
+			*out++ = _status.ch[i].sample1;
+
+		for (const byte *end = _blockData.begin() + size; data != end; ++data) {
+			*out++ = decodeMS(&_status.ch[0], (*data >> 4) & 0x0f);
+			*out++ = decodeMS(&_status.ch[_channels - 1], *data & 0x0f);
 		}
 
-		// _decodedSamples acts as a FIFO of depth 2 or 4;
-		buffer[samples] = _decodedSamples[_decodedSampleIndex++];
-		_decodedSampleCount--;
+		samples += readBlockSamples(buffer + samples, numSamples - samples);
 	}
 
 	return samples;
@@ -418,42 +752,8 @@ int DK3_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
 
 #undef DK3_READ_NIBBLE
 
-#pragma mark -
-
-
-// This table is used to adjust the step for use on the next sample.
-// We could half the table, but since the lookup index used is always
-// a 4-bit nibble, it's more efficient to just keep it as it is.
-const int16 ADPCMStream::_stepAdjustTable[16] = {
-	-1, -1, -1, -1, 2, 4, 6, 8,
-	-1, -1, -1, -1, 2, 4, 6, 8
-};
-
-const int16 Ima_ADPCMStream::_imaTable[89] = {
-		7,    8,    9,   10,   11,   12,   13,   14,
-	   16,   17,   19,   21,   23,   25,   28,   31,
-	   34,   37,   41,   45,   50,   55,   60,   66,
-	   73,   80,   88,   97,  107,  118,  130,  143,
-	  157,  173,  190,  209,  230,  253,  279,  307,
-	  337,  371,  408,  449,  494,  544,  598,  658,
-	  724,  796,  876,  963, 1060, 1166, 1282, 1411,
-	 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
-	 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484,
-	 7132, 7845, 8630, 9493,10442,11487,12635,13899,
-	15289,16818,18500,20350,22385,24623,27086,29794,
-	32767
-};
-
 int16 Ima_ADPCMStream::decodeIMA(byte code, int channel) {
-	int32 E = (2 * (code & 0x7) + 1) * _imaTable[_status.ima_ch[channel].stepIndex] / 8;
-	int32 diff = (code & 0x08) ? -E : E;
-	int32 samp = CLIP<int32>(_status.ima_ch[channel].last + diff, -32768, 32767);
-
-	_status.ima_ch[channel].last = samp;
-	_status.ima_ch[channel].stepIndex += _stepAdjustTable[code];
-	_status.ima_ch[channel].stepIndex = CLIP<int32>(_status.ima_ch[channel].stepIndex, 0, ARRAYSIZE(_imaTable) - 1);
-
-	return samp;
+	return decodeIMACode(_status.ima_ch[channel].last, _status.ima_ch[channel].stepIndex, code, imaDiffTable);
 }
 
 SeekableAudioStream *makeADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, ADPCMType type, int rate, int channels, uint32 blockAlign) {
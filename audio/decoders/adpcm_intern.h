@@ -32,6 +32,7 @@
 #define AUDIO_ADPCM_INTERN_H
 
 #include "audio/audiostream.h"
+#include "common/array.h"
 #include "common/endian.h"
 #include "common/ptr.h"
 #include "common/stream.h"
@@ -39,6 +40,49 @@
 
 namespace Audio {
 
+/**
+ * Decoding state of one channel of OKI or IMA ADPCM.
+ */
+struct IMAChannelStatus {
+	int32 last;
+	int32 stepIndex;
+};
+
+/**
+ * The ways IMA ADPCM decoders compute the difference a code adds to the
+ * sample. They only differ in the lowest bits of the result.
+ */
+enum IMAVariant {
+	/** (2 * code + 1) * step / 8, used by most formats. */
+	kIMAStandard,
+	/**
+	 * The shifts and adds of the IMA reference decoder, used for example
+	 * by Westwood.
+	 */
+	kIMAShiftAdd
+};
+
+/**
+ * Decode a buffer of IMA ADPCM codes of one channel.
+ *
+ * Every byte holds two codes. The differences of all codes at every step
+ * size are precomputed, so each sample takes a table lookup, an add and a
+ * clip. Whole buffers are decoded per call, which keeps the channel state
+ * in registers instead of updating it per sample.
+ *
+ * @param status			state of the channel, updated by the call
+ * @param in				the codes to decode
+ * @param size				size of @p in in bytes; 2 * size samples are decoded
+ * @param out				buffer to store the samples in
+ * @param stride			distance between two samples in @p out, e.g. the
+ *							number of channels of an interleaved buffer
+ * @param highNibbleFirst	whether the high nibble of each byte holds the
+ *							first code
+ * @param variant			how the differences are computed
+ */
+void decodeIMABuffer(IMAChannelStatus &status, const byte *in, uint32 size, int16 *out, uint stride = 1,
+		bool highNibbleFirst = false, IMAVariant variant = kIMAStandard);
+
 class ADPCMStream : public SeekableAudioStream {
 protected:
 	Common::DisposablePtr<Common::SeekableReadStream> _stream;
@@ -51,18 +95,39 @@ protected:
 
 	struct ADPCMStatus {
 		// OKI/IMA
-		struct {
-			int32 last;
-			int32 stepIndex;
-		} ima_ch[2];
+		IMAChannelStatus ima_ch[2];
 	} _status;
 
+	/**
+	 * Encoded data read by readBlock() and samples decoded from it which
+	 * readBuffer() has not returned yet. Streams decoding whole blocks at a
+	 * time use these instead of reading the stream byte by byte.
+	 */
+	Common::Array<byte> _blockData;
+	Common::Array<int16> _blockSamples;
+	uint32 _blockSamplePos;
+
 	virtual void reset();
 
+	/**
+	 * Read up to @p size bytes into _blockData, stopping at the end of the
+	 * ADPCM data.
+	 *
+	 * @return the number of bytes read
+	 */
+	uint32 readBlock(uint32 size);
+
+	/**
+	 * Copy samples left in _blockSamples to @p buffer.
+	 *
+	 * @return the number of samples copied
+	 */
+	int readBlockSamples(int16 *buffer, int numSamples);
+
 public:
 	ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign);
 
-	virtual bool endOfData() const { return (_stream->eos() || _stream->pos() >= _endpos); }
+	virtual bool endOfData() const { return (_stream->eos() || _stream->pos() >= _endpos) && _blockSamplePos >= _blockSamples.size(); }
 	virtual bool isStereo() const { return _channels == 2; }
 	virtual int getRate() const { return _rate; }
 
@@ -83,18 +148,12 @@ public:
 class Oki_ADPCMStream : public ADPCMStream {
 public:
 	Oki_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
-		: ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) { _decodedSampleCount = 0; }
-
-	virtual bool endOfData() const { return (_stream->eos() || _stream->pos() >= _endpos) && (_decodedSampleCount == 0); }
+		: ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {}
 
 	virtual int readBuffer(int16 *buffer, const int numSamples);
 
 protected:
 	int16 decodeOKI(byte);
-
-private:
-	uint8 _decodedSampleCount;
-	int16 _decodedSamples[2];
 };
 
 class Ima_ADPCMStream : public ADPCMStream {
@@ -114,43 +173,22 @@ public:
 class DVI_ADPCMStream : public Ima_ADPCMStream {
 public:
 	DVI_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
-		: Ima_ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) { _decodedSampleCount = 0; }
-
-	virtual bool endOfData() const { return (_stream->eos() || _stream->pos() >= _endpos) && (_decodedSampleCount == 0); }
+		: Ima_ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {}
 
 	virtual int readBuffer(int16 *buffer, const int numSamples);
-
-private:
-	uint8 _decodedSampleCount;
-	int16 _decodedSamples[2];
 };
 
+// Apple QuickTime IMA ADPCM
 class Apple_ADPCMStream : public Ima_ADPCMStream {
-protected:
-	// Apple QuickTime IMA ADPCM
-	int32 _streamPos[2];
-	int16 _buffer[2][2];
-	uint8 _chunkPos[2];
-
-	void reset() {
-		Ima_ADPCMStream::reset();
-		_chunkPos[0] = 0;
-		_chunkPos[1] = 0;
-		_streamPos[0] = 0;
-		_streamPos[1] = _blockAlign;
-	}
-
 public:
 	Apple_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
 		: Ima_ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {
-		_chunkPos[0] = 0;
-		_chunkPos[1] = 0;
-		_streamPos[0] = 0;
-		_streamPos[1] = _blockAlign;
+
+		if (blockAlign < 2)
+			error("Apple_ADPCMStream(): invalid blockAlign");
 	}
 
 	virtual int readBuffer(int16 *buffer, const int numSamples);
-
 };
 
 class MSIma_ADPCMStream : public Ima_ADPCMStream {
@@ -163,22 +201,9 @@ public:
 
 		if (blockAlign % (_channels * 4))
 			error("MSIma_ADPCMStream(): invalid blockAlign");
-
-		_samplesLeft[0] = 0;
-		_samplesLeft[1] = 0;
 	}
 
 	virtual int readBuffer(int16 *buffer, const int numSamples);
-
-	void reset() {
-		Ima_ADPCMStream::reset();
-		_samplesLeft[0] = 0;
-		_samplesLeft[1] = 0;
-	}
-
-private:
-	int16 _buffer[2][8];
-	int _samplesLeft[2];
 };
 
 class MS_ADPCMStream : public ADPCMStream {
@@ -208,21 +233,12 @@ public:
 		if (blockAlign == 0)
 			error("MS_ADPCMStream(): blockAlign isn't specified for MS ADPCM");
 		memset(&_status, 0, sizeof(_status));
-		_decodedSampleCount = 0;
-		_decodedSampleIndex = 0;
 	}
 
-	virtual bool endOfData() const { return (_stream->eos() || _stream->pos() >= _endpos) && (_decodedSampleCount == 0); }
-
 	virtual int readBuffer(int16 *buffer, const int numSamples);
 
 protected:
 	int16 decodeMS(ADPCMChannelStatus *c, byte);
-
-private:
-	uint8 _decodedSampleCount;
-	uint8 _decodedSampleIndex;
-	int16 _decodedSamples[4];
 };
 
 // Duck DK3 IMA ADPCM Decoder
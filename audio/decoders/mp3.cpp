@@ -24,6 +24,7 @@
 
 #ifdef USE_MAD
 
+#include "common/array.h"
 #include "common/debug.h"
 #include "common/mutex.h"
 #include "common/ptr.h"
@@ -107,6 +108,23 @@ protected:
 
 	Timestamp _length;
 
+	enum {
+		// Store the position of every 16th frame, about every 0.4 seconds
+		SEEK_POINT_INTERVAL = 16
+	};
+
+	struct SeekPoint {
+		uint32 offset;		///< Position of the frame in the stream.
+		mad_timer_t time;	///< Playback time at the start of the frame.
+	};
+
+	/**
+	 * Frame positions collected while computing the length of the stream,
+	 * so seeking only has to skip a few frame headers and not scan the
+	 * stream from its start.
+	 */
+	Common::Array<SeekPoint> _seekPoints;
+
 private:
 	static Common::SeekableReadStream *skipID3(Common::SeekableReadStream *stream, DisposeAfterUse::Flag dispose);
 };
@@ -337,10 +355,23 @@ MP3Stream::MP3Stream(Common::SeekableReadStream *inStream, DisposeAfterUse::Flag
 	_channels = MAD_NCHANNELS(&_frame.header);
 	_rate = _frame.header.samplerate;
 
-	// Calculate the length of the stream
-	while (_state != MP3_STATE_EOS)
+	// Calculate the length of the stream, and build the seek index
+	SeekPoint point;
+	point.offset = 0;
+	point.time = mad_timer_zero;
+	_seekPoints.push_back(point);
+
+	for (uint frame = 1; _state != MP3_STATE_EOS; ++frame) {
+		point.time = _curTime;
 		readHeader(*_inStream);
 
+		if (_state != MP3_STATE_EOS && (frame % SEEK_POINT_INTERVAL) == 0) {
+			// The stream has been read up to the end of the MAD buffer
+			point.offset = _inStream->pos() - (_stream.bufend - _stream.this_frame);
+			_seekPoints.push_back(point);
+		}
+	}
+
 	// To rule out any invalid sample rate to be encountered here, say in case the
 	// MP3 stream is invalid, we just check the MAD error code here.
 	// We need to assure this, since else we might trigger an assertion in Timestamp
@@ -377,9 +408,22 @@ bool MP3Stream::seek(const Timestamp &where) {
 	mad_timer_t destination;
 	mad_timer_set(&destination, time / 1000, time % 1000, 1000);
 
-	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _curTime) < 0) {
-		_inStream->seek(0);
+	// Find the last seek point before the destination
+	uint first = 0, last = _seekPoints.size();
+	while (last - first > 1) {
+		const uint mid = (first + last) / 2;
+		if (mad_timer_compare(_seekPoints[mid].time, destination) <= 0)
+			first = mid;
+		else
+			last = mid;
+	}
+	const SeekPoint &point = _seekPoints[first];
+
+	// Restart at the seek point, unless the current position is closer
+	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _curTime) < 0 || mad_timer_compare(point.time, _curTime) > 0) {
+		_inStream->seek(point.offset);
 		initStream(*_inStream);
+		_curTime = point.time;
 	}
 
 	while (mad_timer_compare(destination, _curTime) > 0 && _state != MP3_STATE_EOS)
@@ -45,15 +45,23 @@ namespace Audio {
 
 /**
  * This is a stream, which allows for playing raw PCM data from a stream.
+ *
+ * If the stream is backed by memory, e.g. a MemoryReadStream or a memory
+ * mapped file, the samples are converted straight from that memory into the
+ * caller's buffer, without copying them into a temporary buffer first.
  */
 template<bool is16Bit, bool isUnsigned, bool isLE>
 class RawStream : public SeekableAudioStream {
 public:
 	RawStream(int rate, bool stereo, DisposeAfterUse::Flag disposeStream, Common::SeekableReadStream *stream)
-		: _rate(rate), _isStereo(stereo), _playtime(0, rate), _stream(stream, disposeStream), _endOfData(false), _buffer(0) {
-		// Setup our buffer for readBuffer
-		_buffer = new byte[kSampleBufferLength * (is16Bit ? 2 : 1)];
-		assert(_buffer);
+		: _rate(rate), _isStereo(stereo), _playtime(0, rate), _stream(stream, disposeStream), _endOfData(false), _view(0), _buffer(0) {
+		_view = _stream->getContiguousView(0, _stream->size());
+
+		// Setup our buffer for readBuffer, unless we can read from the view
+		if (!_view) {
+			_buffer = new byte[kSampleBufferLength * (is16Bit ? 2 : 1)];
+			assert(_buffer);
+		}
 
 		// Calculate the total playtime of the stream
 		_playtime = Timestamp(0, _stream->size() / (_isStereo ? 2 : 1) / (is16Bit ? 2 : 1), rate);
@@ -79,7 +87,8 @@ private:
 	Common::DisposablePtr<Common::SeekableReadStream> _stream; ///< Stream to read data from
 	bool _endOfData;                                           ///< Whether the stream end has been reached
 
-	byte *_buffer;                                             ///< Buffer used in readBuffer
+	const byte *_view;                                         ///< Memory backing _stream, if any
+	byte *_buffer;                                             ///< Buffer used in readBuffer, if there is no view
 	enum {
 		/**
 		 * How many samples we can buffer at once.
@@ -97,10 +106,22 @@ private:
 	 * @return actual count of samples read.
 	 */
 	int fillBuffer(int maxSamples);
+
+	/**
+	 * Convert samples straight from _view into the caller's buffer.
+	 *
+	 * @param buffer     Buffer to store the samples in.
+	 * @param numSamples Maximum samples to read.
+	 * @return actual count of samples read.
+	 */
+	int readView(int16 *buffer, const int numSamples);
 };
 
 template<bool is16Bit, bool isUnsigned, bool isLE>
 int RawStream<is16Bit, isUnsigned, isLE>::readBuffer(int16 *buffer, const int numSamples) {
+	if (_view)
+		return readView(buffer, numSamples);
+
 	int samplesLeft = numSamples;
 
 	while (samplesLeft > 0) {
@@ -159,6 +180,31 @@ int RawStream<is16Bit, isUnsigned, isLE>::fillBuffer(int maxSamples) {
 	return bufferedSamples;
 }
 
+template<bool is16Bit, bool isUnsigned, bool isLE>
+int RawStream<is16Bit, isUnsigned, isLE>::readView(int16 *buffer, const int numSamples) {
+	if (endOfData())
+		return 0;
+
+	const int32 pos = _stream->pos();
+	const int samples = MIN<int32>(numSamples, (_stream->size() - pos) / (is16Bit ? 2 : 1));
+
+	const byte *src = _view + pos;
+	for (int i = 0; i < samples; ++i) {
+		*buffer++ = READ_ENDIAN_SAMPLE(is16Bit, isUnsigned, src, isLE);
+		src += (is16Bit ? 2 : 1);
+	}
+
+	// Keep the stream position in sync, seek() relies on it
+	_stream->seek(pos + samples * (is16Bit ? 2 : 1), SEEK_SET);
+
+	// We stop stream playback, when we reached the end of the data stream.
+	// A trailing byte too short for a sample counts as the end, too.
+	if (_stream->size() - _stream->pos() < (is16Bit ? 2 : 1) || _stream->err() || _stream->eos())
+		_endOfData = true;
+
+	return samples;
+}
+
 template<bool is16Bit, bool isUnsigned, bool isLE>
 bool RawStream<is16Bit, isUnsigned, isLE>::seek(const Timestamp &where) {
 	_endOfData = true;
@@ -79,6 +79,12 @@ SeekableAudioStream *makeRawStream(const byte *buffer, uint32 size,
 /**
  * Creates an audio stream, which plays from the given stream.
  *
+ * If the stream is backed by memory (see
+ * Common::SeekableReadStream::getContiguousView), the samples are converted
+ * straight from that memory. Sound resources inside a file opened with
+ * Common::FSNode::createMappedReadStream, or sub streams of it, can thus be
+ * played without loading them into a buffer first.
+ *
  * @param stream Stream object to play from.
  * @param rate   Rate of the sound data.
  * @param flags  Audio flags combination.
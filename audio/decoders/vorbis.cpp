@@ -29,6 +29,8 @@
 
 #ifdef USE_VORBIS
 
+#include "common/array.h"
+#include "common/endian.h"
 #include "common/ptr.h"
 #include "common/stream.h"
 #include "common/textconsole.h"
@@ -103,6 +105,19 @@ protected:
 	const int16 *_bufferEnd;
 	const int16 *_pos;
 
+	struct SeekPoint {
+		uint32 offset;			///< Position of the Ogg page in the stream.
+		ogg_int64_t granule;	///< Position of the last sample completed on the page.
+	};
+
+	/**
+	 * The Ogg pages of the stream, built on the first seek. With it seeking
+	 * jumps straight to the page before the destination and only decodes
+	 * from there, instead of bisecting the stream.
+	 */
+	Common::Array<SeekPoint> _seekPoints;
+	bool _seekPointsScanned;
+
 public:
 	// startTime / duration are in milliseconds
 	VorbisStream(Common::SeekableReadStream *inStream, DisposeAfterUse::Flag dispose);
@@ -118,12 +133,16 @@ public:
 	Timestamp getLength() const { return _length; }
 protected:
 	bool refill();
+	long decode(char *buffer, int length);
+	void scanSeekPoints();
+	bool seekWithSeekPoints(ogg_int64_t sample);
 };
 
 VorbisStream::VorbisStream(Common::SeekableReadStream *inStream, DisposeAfterUse::Flag dispose) :
 	_inStream(inStream, dispose),
 	_length(0, 1000),
-	_bufferEnd(ARRAYEND(_buffer)) {
+	_bufferEnd(ARRAYEND(_buffer)),
+	_seekPointsScanned(false) {
 
 	int res = ov_open_callbacks(inStream, &_ovFile, NULL, 0, g_stream_wrap);
 	if (res < 0) {
@@ -170,7 +189,17 @@ int VorbisStream::readBuffer(int16 *buffer, const int numSamples) {
 bool VorbisStream::seek(const Timestamp &where) {
 	// Vorbisfile uses the sample pair number, thus we always use "false" for the isStereo parameter
 	// of the convertTimeToStreamPos helper.
-	int res = ov_pcm_seek(&_ovFile, convertTimeToStreamPos(where, getRate(), false).totalNumberOfFrames());
+	const ogg_int64_t sample = convertTimeToStreamPos(where, getRate(), false).totalNumberOfFrames();
+
+	if (!_seekPointsScanned) {
+		scanSeekPoints();
+		_seekPointsScanned = true;
+	}
+
+	if (seekWithSeekPoints(sample))
+		return refill();
+
+	int res = ov_pcm_seek(&_ovFile, sample);
 	if (res) {
 		warning("Error seeking in Vorbis stream (%d)", res);
 		_pos = _bufferEnd;
@@ -180,35 +209,121 @@ bool VorbisStream::seek(const Timestamp &where) {
 	return refill();
 }
 
-bool VorbisStream::refill() {
-	// Read the samples
-	uint len_left = sizeof(_buffer);
-	char *read_pos = (char *)_buffer;
+void VorbisStream::scanSeekPoints() {
+	// Walk over the page headers, saving the stream position for vorbisfile
+	const int32 pos = _inStream->pos();
+	_inStream->seek(0);
 
-	while (len_left > 0) {
-		long result;
+	uint32 serial = 0;
+	byte header[27 + 255];
+
+	while (_inStream->read(header, 27) == 27) {
+		const uint32 offset = _inStream->pos() - 27;
+		const byte segmentCount = header[26];
 
+		if (READ_BE_UINT32(header) != MKTAG('O', 'g', 'g', 'S') || header[4] != 0
+		    || _inStream->read(header + 27, segmentCount) != segmentCount) {
+			warning("VorbisStream: Invalid Ogg page, seeking without an index");
+			_seekPoints.clear();
+			break;
+		}
+
+		// Chained streams restart their sample positions, these are left
+		// to vorbisfile
+		if (_seekPoints.empty())
+			serial = READ_LE_UINT32(header + 14);
+		else if (READ_LE_UINT32(header + 14) != serial) {
+			_seekPoints.clear();
+			break;
+		}
+
+		uint32 size = 0;
+		for (uint i = 0; i < segmentCount; ++i)
+			size += header[27 + i];
+
+		// Pages without a completed packet have no position
+		const ogg_int64_t granule = (ogg_int64_t)READ_LE_UINT64(header + 6);
+		if (granule != -1) {
+			SeekPoint point;
+			point.offset = offset;
+			point.granule = granule;
+			_seekPoints.push_back(point);
+		}
+
+		if (!_inStream->skip(size))
+			break;
+	}
+
+	_inStream->clearErr();
+	_inStream->seek(pos);
+}
+
+bool VorbisStream::seekWithSeekPoints(ogg_int64_t sample) {
+	if (_seekPoints.empty())
+		return false;
+
+	// Find the last page which ends before the destination, decoding
+	// from there starts before the destination as well
+	uint first = 0, last = _seekPoints.size();
+	while (last - first > 1) {
+		const uint mid = (first + last) / 2;
+		if (_seekPoints[mid].granule <= sample)
+			first = mid;
+		else
+			last = mid;
+	}
+
+	if (ov_raw_seek(&_ovFile, _seekPoints[first].offset))
+		return false;
+
+	// Drop the samples up to the destination
+	const int frameSize = ov_info(&_ovFile, -1)->channels * sizeof(int16);
+	ogg_int64_t current = ov_pcm_tell(&_ovFile);
+
+	while (current >= 0 && current < sample) {
+		const long length = (long)MIN<ogg_int64_t>(sizeof(_buffer) / frameSize, sample - current) * frameSize;
+		const long result = decode((char *)_buffer, length);
+		if (result <= 0)
+			break;
+
+		current = ov_pcm_tell(&_ovFile);
+	}
+
+	return current == sample;
+}
+
+long VorbisStream::decode(char *buffer, int length) {
 #ifdef USE_TREMOR
-		// Tremor ov_read() always returns data as signed 16 bit interleaved PCM
-		// in host byte order. As such, it does not take arguments to request
-		// specific signedness, byte order or bit depth as in Vorbisfile.
-		result = ov_read(&_ovFile, read_pos, len_left,
-						NULL);
+	// Tremor ov_read() always returns data as signed 16 bit interleaved PCM
+	// in host byte order. As such, it does not take arguments to request
+	// specific signedness, byte order or bit depth as in Vorbisfile.
+	return ov_read(&_ovFile, buffer, length,
+					NULL);
 #else
 #ifdef SCUMM_BIG_ENDIAN
-		result = ov_read(&_ovFile, read_pos, len_left,
-						1,
-						2,	// 16 bit
-						1,	// signed
-						NULL);
+	return ov_read(&_ovFile, buffer, length,
+					1,
+					2,	// 16 bit
+					1,	// signed
+					NULL);
 #else
-		result = ov_read(&_ovFile, read_pos, len_left,
-						0,
-						2,	// 16 bit
-						1,	// signed
-						NULL);
+	return ov_read(&_ovFile, buffer, length,
+					0,
+					2,	// 16 bit
+					1,	// signed
+					NULL);
 #endif
 #endif
+}
+
+bool VorbisStream::refill() {
+	// Read the samples
+	uint len_left = sizeof(_buffer);
+	char *read_pos = (char *)_buffer;
+
+	while (len_left > 0) {
+		long result = decode(read_pos, len_left);
+
 		if (result == OV_HOLE) {
 			// Possibly recoverable, just warn about it
 			warning("Corrupted data in Vorbis file");
@@ -119,6 +119,26 @@ public:
 	 */
 	virtual void sysEx(const byte *msg, uint16 length) { }
 
+	/**
+	 * Output a packed midi command which is due a bit later than now.
+	 *
+	 * This lets players calling the driver at timer resolution place
+	 * events between timer ticks. Software synths which are driven by
+	 * their own timer callback (see MidiDriver_Emulated) play the event
+	 * at the exact sample it is due; all other drivers send it right away.
+	 *
+	 * @param delay	time until the event is due in microseconds, at most
+	 *				one timer tick
+	 * @param b		packed midi command, as for send()
+	 */
+	virtual void sendTimestamped(uint32 delay, uint32 b) { send(b); }
+
+	/**
+	 * Transmit a sysEx which is due a bit later than now, like
+	 * sendTimestamped() does for short messages.
+	 */
+	virtual void sysExTimestamped(uint32 delay, const byte *msg, uint16 length) { sysEx(msg, length); }
+
 	// TODO: Document this.
 	virtual void metaEvent(byte type, byte *data, uint16 length) { }
 };
@@ -45,7 +45,8 @@ _sendSustainOffOnNotesOff(false),
 _numTracks(0),
 _activeTrack(255),
 _abortParse(false),
-_jumpingToTick(false) {
+_jumpingToTick(false),
+_eventDelay(0) {
 	memset(_activeNotes, 0, sizeof(_activeNotes));
 	memset(_tracks, 0, sizeof(_tracks));
 	_nextEvent.start = NULL;
@@ -72,7 +73,10 @@ void MidiParser::property(int prop, int value) {
 }
 
 void MidiParser::sendToDriver(uint32 b) {
-	_driver->send(b);
+	if (_eventDelay)
+		_driver->sendTimestamped(_eventDelay, b);
+	else
+		_driver->send(b);
 }
 
 void MidiParser::setTempo(uint32 tempo) {
@@ -170,6 +174,7 @@ void MidiParser::onTimer() {
 		return;
 
 	_abortParse = false;
+	_eventDelay = 0;
 	endTime = _position._playTime + _timerRate;
 
 	// Scan our hanging notes for any
@@ -202,6 +207,7 @@ void MidiParser::onTimer() {
 		if (info.event < 0x80) {
 			warning("Bad command or running status %02X", info.event);
 			_position._playPos = 0;
+			_eventDelay = 0;
 			return;
 		}
 
@@ -214,6 +220,9 @@ void MidiParser::onTimer() {
 				activeNote(info.channel(), info.basic.param1, true);
 		}
 
+		// Let the driver place the event between timer ticks
+		_eventDelay = (eventTime > _position._playTime) ? eventTime - _position._playTime : 0;
+
 		// Player::metaEvent() in SCUMM will delete the parser object,
 		// so return immediately if that might have happened.
 		bool ret = processEvent(info);
@@ -226,6 +235,8 @@ void MidiParser::onTimer() {
 		}
 	}
 
+	_eventDelay = 0;
+
 	if (!_abortParse) {
 		_position._playTime = endTime;
 		_position._playTick = (_position._playTime - _position._lastEventTime) / _psecPerTick + _position._lastEventTick;
@@ -238,9 +249,9 @@ bool MidiParser::processEvent(const EventInfo &info, bool fireEvents) {
 		// Check for trailing 0xF7 -- if present, remove it.
 		if (fireEvents) {
 			if (info.ext.data[info.length-1] == 0xF7)
-				_driver->sysEx(info.ext.data, (uint16)info.length-1);
+				_driver->sysExTimestamped(_eventDelay, info.ext.data, (uint16)info.length-1);
 			else
-				_driver->sysEx(info.ext.data, (uint16)info.length);
+				_driver->sysExTimestamped(_eventDelay, info.ext.data, (uint16)info.length);
 		}
 	} else if (info.event == 0xFF) {
 		// META event
@@ -345,6 +356,9 @@ bool MidiParser::setTrack(int track) {
 void MidiParser::stopPlaying() {
 	allNotesOff();
 	resetTracking();
+
+	// Anything sent after stopping is not part of the track anymore
+	_eventDelay = 0;
 }
 
 void MidiParser::hangAllActiveNotes() {
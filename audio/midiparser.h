@@ -288,6 +288,7 @@ protected:
 	                        ///< simulated events in certain formats.
 	bool   _abortParse;    ///< If a jump or other operation interrupts parsing, flag to abort.
 	bool   _jumpingToTick; ///< True if currently inside jumpToTick
+	uint32 _eventDelay;    ///< Time from the current timer tick to the event being sent, in microseconds.
 
 protected:
 	static uint32 readVLQ(byte * &data);
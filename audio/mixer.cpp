@@ -22,6 +22,9 @@
 
 #include "gui/EventRecorder.h"
 
+#include "common/config-manager.h"
+#include "common/profiler.h"
+#include "common/stream.h"
 #include "common/util.h"
 #include "common/system.h"
 #include "common/textconsole.h"
@@ -31,6 +34,24 @@
 #include "audio/audiostream.h"
 #include "audio/timestamp.h"
 
+// The final mix is clipped down to 16 bits with saturating packs where SSE2
+// or NEON are available.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MIXER_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MIXER_USE_NEON
+#include <arm_neon.h>
+#endif
+
+// The profiling counters per stream class need the class names.
+#if defined(__GXX_RTTI) || defined(_CPPRTTI)
+#define MIXER_HAVE_RTTI
+#include <typeinfo>
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+#endif
 
 namespace Audio {
 
@@ -44,19 +65,30 @@ namespace Audio {
  */
 class Channel {
 public:
-	Channel(Mixer *mixer, Mixer::SoundType type, AudioStream *stream, DisposeAfterUse::Flag autofreeStream, bool reverseStereo, int id, bool permanent);
+	Channel(Mixer *mixer, Mixer::SoundType type, AudioStream *stream, DisposeAfterUse::Flag autofreeStream, bool reverseStereo, int id, bool permanent, RateConverterQuality quality);
 	~Channel();
 
 	/**
 	 * Mixes the channel's samples into the given buffer.
 	 *
-	 * @param data buffer where to mix the data
-	 * @param len  number of sample *pairs*. So a value of
-	 *             10 means that the buffer contains twice 10 sample, each
-	 *             16 bits, for a total of 40 bytes.
+	 * The samples are added up without clipping, the caller is responsible
+	 * for clipping the final mix.
+	 *
+	 * @param data       buffer where to mix the data
+	 * @param len        number of sample *pairs*. So a value of
+	 *                   10 means that the buffer contains twice 10 sample, each
+	 *                   32 bits, for a total of 80 bytes.
+	 * @param readMicros if not null, the time spent reading from the
+	 *                   stream is added to it
 	 * @return number of sample pairs processed (which can still be silence!)
 	 */
-	int mix(int16 *data, uint len);
+	int mix(st_accum_t *data, uint len, uint64 *readMicros = 0);
+
+	/**
+	 * Returns the class name of the channel's stream, as used for the
+	 * profiling counters.
+	 */
+	const Common::String &getStreamName();
 
 	/**
 	 * Queries whether the channel is still playing or not.
@@ -167,6 +199,31 @@ private:
 
 	RateConverter *_converter;
 	Common::DisposablePtr<AudioStream> _stream;
+	Common::String _streamName;
+};
+
+/**
+ * Stream wrapper which measures the time spent in readBuffer().
+ */
+class TimedAudioStream : public AudioStream {
+public:
+	TimedAudioStream(AudioStream &stream, uint64 &micros) : _stream(stream), _micros(micros) {}
+
+	virtual int readBuffer(int16 *buffer, const int numSamples) {
+		const uint64 start = g_system->getMicros();
+		const int samples = _stream.readBuffer(buffer, numSamples);
+		_micros += g_system->getMicros() - start;
+		return samples;
+	}
+
+	virtual bool isStereo() const { return _stream.isStereo(); }
+	virtual int getRate() const { return _stream.getRate(); }
+	virtual bool endOfData() const { return _stream.endOfData(); }
+	virtual bool endOfStream() const { return _stream.endOfStream(); }
+
+private:
+	AudioStream &_stream;
+	uint64 &_micros;
 };
 
 #pragma mark -
@@ -174,8 +231,34 @@ private:
 #pragma mark -
 
 // TODO: parameter "system" is unused
+/**
+ * The "resampling_quality" config key. Channels are created from any
+ * thread, so they only use the cached value.
+ */
+class RateConverterQualitySetting : public Common::ConfigSettingBase {
+public:
+	RateConverterQualitySetting() : ConfigSettingBase("resampling_quality", Common::String()) {
+		update();
+	}
+
+	RateConverterQuality getCached() const { return (RateConverterQuality)load(); }
+
+protected:
+	virtual uint32 read() const {
+		const Common::String &quality = ConfMan.get(_key);
+		if (quality == "hq")
+			return kRateConverterHQ;
+		else if (quality == "linear")
+			return kRateConverterLinear;
+		else
+			return kRateConverterFast;
+	}
+};
+
 MixerImpl::MixerImpl(OSystem *system, uint sampleRate)
-	: _mutex(), _sampleRate(sampleRate), _mixerReady(false), _handleSeed(0), _soundTypeSettings() {
+	: _mutex(), _sampleRate(sampleRate), _mixerReady(false), _handleSeed(0), _soundTypeSettings(),
+	  _mixBuffer(0), _mixBufferSize(0), _statsEnabled(false),
+	  _rateConverterQuality(new RateConverterQualitySetting()) {
 
 	assert(sampleRate > 0);
 
@@ -186,6 +269,9 @@ MixerImpl::MixerImpl(OSystem *system, uint sampleRate)
 MixerImpl::~MixerImpl() {
 	for (int i = 0; i != NUM_CHANNELS; i++)
 		delete _channels[i];
+
+	free(_mixBuffer);
+	delete _rateConverterQuality;
 }
 
 void MixerImpl::setReady(bool ready) {
@@ -260,7 +346,7 @@ void MixerImpl::playStream(
 #endif
 
 	// Create the channel
-	Channel *chan = new Channel(this, type, stream, autofreeStream, reverseStereo, id, permanent);
+	Channel *chan = new Channel(this, type, stream, autofreeStream, reverseStereo, id, permanent, _rateConverterQuality->getCached());
 	chan->setVolume(volume);
 	chan->setBalance(balance);
 	insertChannel(handle, chan);
@@ -270,6 +356,7 @@ int MixerImpl::mixCallback(byte *samples, uint len) {
 	assert(samples);
 
 	Common::StackLock lock(_mutex);
+	PROFILE_TRACK_ZONE("mixer", Common::Profiler::kTrackAudio);
 
 	int16 *buf = (int16 *)samples;
 	// we store stereo, 16-bit samples
@@ -279,8 +366,21 @@ int MixerImpl::mixCallback(byte *samples, uint len) {
 	// Since the mixer callback has been called, the mixer must be ready...
 	_mixerReady = true;
 
-	//  zero the buf
-	memset(buf, 0, 2 * len * sizeof(int16));
+	const bool profile = _statsEnabled;
+	const uint64 callbackStart = profile ? g_system->getMicros() : 0;
+
+	// Reallocate the accumulator, if necessary
+	if (len > _mixBufferSize) {
+		free(_mixBuffer);
+		_mixBuffer = (st_accum_t *)malloc(2 * len * sizeof(st_accum_t));
+		_mixBufferSize = len;
+
+		if (!_mixBuffer)
+			error("[MixerImpl::mixCallback] Cannot allocate memory for mix buffer");
+	}
+
+	//  zero the accumulator
+	memset(_mixBuffer, 0, 2 * len * sizeof(st_accum_t));
 
 	// mix all channels
 	int res = 0, tmp;
@@ -290,16 +390,133 @@ int MixerImpl::mixCallback(byte *samples, uint len) {
 				delete _channels[i];
 				_channels[i] = 0;
 			} else if (!_channels[i]->isPaused()) {
-				tmp = _channels[i]->mix(buf, len);
+				if (profile) {
+					uint64 readMicros = 0;
+					const uint64 start = g_system->getMicros();
+					tmp = _channels[i]->mix(_mixBuffer, len, &readMicros);
+					updateStats(_channels[i], tmp, len, g_system->getMicros() - start, readMicros);
+				} else {
+					tmp = _channels[i]->mix(_mixBuffer, len);
+				}
 
 				if (tmp > res)
 					res = tmp;
 			}
 		}
 
+	clipMix(buf, _mixBuffer, 2 * len);
+
+	if (profile) {
+		const uint64 micros = g_system->getMicros() - callbackStart;
+		const uint64 audioMicros = (uint64)len * 1000000 / _sampleRate;
+
+		_stats.callbacks++;
+		_stats.callbackMicros += micros;
+		_stats.maxCallbackMicros = MAX(_stats.maxCallbackMicros, micros);
+		_stats.audioMicros += audioMicros;
+		if (micros > audioMicros)
+			_stats.overruns++;
+	}
+
 	return res;
 }
 
+void MixerImpl::updateStats(Channel *chan, int samples, uint len, uint64 micros, uint64 readMicros) {
+	// The stream ran dry although it did not end, e.g. a queuing stream
+	// which was not fed in time.
+	const bool underrun = (uint)samples < len && !chan->isFinished();
+
+	MixerStats::Entry *entries[2];
+	entries[0] = &_stats.soundTypes[chan->getType()];
+	entries[1] = &_streamStats[chan->getStreamName()];
+
+	for (int i = 0; i < ARRAYSIZE(entries); ++i) {
+		entries[i]->mixes++;
+		entries[i]->samples += samples;
+		entries[i]->totalMicros += micros;
+		entries[i]->readMicros += readMicros;
+		if (underrun)
+			entries[i]->underruns++;
+	}
+}
+
+void MixerImpl::setStatsEnabled(bool enabled) {
+	Common::StackLock lock(_mutex);
+
+	if (enabled) {
+		static const char *const soundTypeNames[] = { "plain", "music", "sfx", "speech" };
+
+		_stats = MixerStats();
+		for (int i = 0; i < ARRAYSIZE(soundTypeNames); ++i)
+			_stats.soundTypes[i].name = soundTypeNames[i];
+		_streamStats.clear();
+	}
+
+	_statsEnabled = enabled;
+}
+
+void MixerImpl::getStats(MixerStats &stats) {
+	Common::StackLock lock(_mutex);
+
+	stats = _stats;
+	stats.streams.clear();
+	for (Common::HashMap<Common::String, MixerStats::Entry>::const_iterator i = _streamStats.begin(); i != _streamStats.end(); ++i) {
+		stats.streams.push_back(i->_value);
+		stats.streams.back().name = i->_key;
+	}
+}
+
+static void writeCSVLine(Common::WriteStream &stream, const char *kind, const MixerStats::Entry &entry) {
+	// Class names of templates contain commas, so always quote them
+	stream.writeString(Common::String::format("%s,\"%s\",%u,%u,%llu,%llu,%llu\n", kind, entry.name.c_str(), entry.mixes, entry.underruns,
+	                                          (unsigned long long)entry.samples, (unsigned long long)entry.totalMicros, (unsigned long long)entry.readMicros));
+}
+
+void MixerStats::writeCSV(Common::WriteStream &stream) const {
+	stream.writeString("kind,name,mixes,underruns,samples,total_us,read_us\n");
+	for (int i = 0; i < ARRAYSIZE(soundTypes); ++i)
+		writeCSVLine(stream, "soundtype", soundTypes[i]);
+	for (uint i = 0; i < streams.size(); ++i)
+		writeCSVLine(stream, "stream", streams[i]);
+
+	stream.writeString("\nkind,callbacks,overruns,callback_us,max_callback_us,audio_us\n");
+	stream.writeString(Common::String::format("callbacks,%u,%u,%llu,%llu,%llu\n", callbacks, overruns, (unsigned long long)callbackMicros,
+	                                          (unsigned long long)maxCallbackMicros, (unsigned long long)audioMicros));
+}
+
+void MixerImpl::clipMix(int16 *dst, const st_accum_t *src, uint count) {
+	uint i = 0;
+
+#if defined(MIXER_USE_SSE2)
+	for (; i + 8 <= count; i += 8) {
+		const __m128i lo = _mm_loadu_si128((const __m128i *)(src + i));
+		const __m128i hi = _mm_loadu_si128((const __m128i *)(src + i + 4));
+		__m128i out = _mm_packs_epi32(lo, hi);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		out = _mm_xor_si128(out, _mm_set1_epi16((short)0x8000));
+#endif
+		_mm_storeu_si128((__m128i *)(dst + i), out);
+	}
+#elif defined(MIXER_USE_NEON)
+	for (; i + 8 <= count; i += 8) {
+		int16x8_t out = vcombine_s16(vqmovn_s32(vld1q_s32(src + i)), vqmovn_s32(vld1q_s32(src + i + 4)));
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		out = veorq_s16(out, vdupq_n_s16((int16)0x8000));
+#endif
+		vst1q_s16(dst + i, out);
+	}
+#endif
+
+	for (; i < count; ++i) {
+		const st_accum_t val = CLIP<st_accum_t>(src[i], ST_SAMPLE_MIN, ST_SAMPLE_MAX);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		dst[i] = (int16)val ^ 0x8000;
+#else
+		dst[i] = (int16)val;
+#endif
+	}
+}
+
 void MixerImpl::stopAll() {
 	Common::StackLock lock(_mutex);
 	for (int i = 0; i != NUM_CHANNELS; i++) {
@@ -497,7 +714,8 @@ int MixerImpl::getVolumeForSoundType(SoundType type) const {
 #pragma mark -
 
 Channel::Channel(Mixer *mixer, Mixer::SoundType type, AudioStream *stream,
-                 DisposeAfterUse::Flag autofreeStream, bool reverseStereo, int id, bool permanent)
+                 DisposeAfterUse::Flag autofreeStream, bool reverseStereo, int id, bool permanent,
+                 RateConverterQuality quality)
     : _type(type), _mixer(mixer), _id(id), _permanent(permanent), _volume(Mixer::kMaxChannelVolume),
       _balance(0), _pauseLevel(0), _samplesConsumed(0), _samplesDecoded(0), _mixerTimeStamp(0),
       _pauseStartTime(0), _pauseTime(0), _converter(0), _volL(0), _volR(0),
@@ -506,7 +724,7 @@ Channel::Channel(Mixer *mixer, Mixer::SoundType type, AudioStream *stream,
 	assert(stream);
 
 	// Get a rate converter instance
-	_converter = makeRateConverter(_stream->getRate(), mixer->getOutputRate(), _stream->isStereo(), reverseStereo);
+	_converter = makeRateConverter(_stream->getRate(), mixer->getOutputRate(), _stream->isStereo(), reverseStereo, quality);
 }
 
 Channel::~Channel() {
@@ -604,7 +822,31 @@ Timestamp Channel::getElapsedTime() {
 	return ts;
 }
 
-int Channel::mix(int16 *data, uint len) {
+const Common::String &Channel::getStreamName() {
+	if (_streamName.empty()) {
+#ifdef MIXER_HAVE_RTTI
+		const char *name = typeid(*_stream).name();
+#if defined(__GNUC__)
+		int status;
+		char *demangled = abi::__cxa_demangle(name, 0, 0, &status);
+		if (demangled) {
+			_streamName = demangled;
+			free(demangled);
+		} else {
+			_streamName = name;
+		}
+#else
+		_streamName = name;
+#endif
+#else
+		_streamName = "AudioStream";
+#endif
+	}
+
+	return _streamName;
+}
+
+int Channel::mix(st_accum_t *data, uint len, uint64 *readMicros) {
 	assert(_stream);
 
 	int res = 0;
@@ -615,7 +857,12 @@ int Channel::mix(int16 *data, uint len) {
 		_samplesConsumed = _samplesDecoded;
 		_mixerTimeStamp = g_system->getMillis(true);
 		_pauseTime = 0;
-		res = _converter->flow(*_stream, data, len, _volL, _volR);
+		if (readMicros) {
+			TimedAudioStream stream(*_stream, *readMicros);
+			res = _converter->flowAccumulate(stream, data, len, _volL, _volR);
+		} else {
+			res = _converter->flowAccumulate(*_stream, data, len, _volL, _volR);
+		}
 		_samplesDecoded += res;
 	}
 
@@ -24,7 +24,13 @@
 #define AUDIO_MIXER_H
 
 #include "common/types.h"
+#include "common/array.h"
 #include "common/noncopyable.h"
+#include "common/str.h"
+
+namespace Common {
+class WriteStream;
+}
 
 namespace Audio {
 
@@ -32,6 +38,41 @@ class AudioStream;
 class Channel;
 class Timestamp;
 
+/**
+ * Profiling counters gathered by the mixer.
+ * @see Mixer::setStatsEnabled
+ */
+struct MixerStats {
+	/** Counters for the channels of one sound type or of one stream class. */
+	struct Entry {
+		Entry() : mixes(0), underruns(0), samples(0), totalMicros(0), readMicros(0) {}
+
+		Common::String name;
+		uint32 mixes;		///< Number of times a channel was mixed.
+		uint32 underruns;	///< Mixes which ran out of data before the stream ended.
+		uint64 samples;		///< Number of sample pairs produced.
+		uint64 totalMicros;	///< Time spent mixing, including reading and resampling.
+		uint64 readMicros;	///< Part of totalMicros spent in AudioStream::readBuffer().
+	};
+
+	MixerStats() : callbacks(0), overruns(0), callbackMicros(0), maxCallbackMicros(0), audioMicros(0) {}
+
+	uint32 callbacks;			///< Number of mixer callbacks.
+	uint32 overruns;			///< Callbacks which took longer than the audio they produced lasts.
+	uint64 callbackMicros;		///< Time spent in the mixer callbacks.
+	uint64 maxCallbackMicros;	///< Longest time a single callback took.
+	uint64 audioMicros;			///< Duration of the audio produced.
+
+	Entry soundTypes[4];			///< Counters per Mixer::SoundType.
+	Common::Array<Entry> streams;	///< Counters per AudioStream class.
+
+	/**
+	 * Write all counters in CSV format, one line per sound type and per
+	 * stream class, plus a line with the totals of the callbacks.
+	 */
+	void writeCSV(Common::WriteStream &stream) const;
+};
+
 /**
  * A SoundHandle instances corresponds to a specific sound
  * being played via the mixer. It can be used to control that
@@ -277,6 +318,24 @@ public:
 	 * @return the output sample rate in Hz
 	 */
 	virtual uint getOutputRate() const = 0;
+
+	/**
+	 * Enable or disable gathering the profiling counters. Timing the
+	 * mixer has a small cost, so this is disabled by default. Enabling
+	 * the counters also resets them.
+	 */
+	virtual void setStatsEnabled(bool enabled) = 0;
+
+	/**
+	 * Query whether the profiling counters are gathered.
+	 */
+	virtual bool isStatsEnabled() const = 0;
+
+	/**
+	 * Get a copy of the profiling counters gathered since they were
+	 * enabled.
+	 */
+	virtual void getStats(MixerStats &stats) = 0;
 };
 
 
@@ -24,11 +24,15 @@
 #define AUDIO_MIXER_INTERN_H
 
 #include "common/scummsys.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/mutex.h"
 #include "audio/mixer.h"
 
 namespace Audio {
 
+class RateConverterQualitySetting;
+
 /**
  * The (default) implementation of the ScummVM audio mixing subsystem.
  *
@@ -70,6 +74,21 @@ private:
 	SoundTypeSettings _soundTypeSettings[4];
 	Channel *_channels[NUM_CHANNELS];
 
+	/** 32-bit accumulator into which all channels are mixed before clipping. */
+	int32 *_mixBuffer;
+	uint _mixBufferSize;	///< Size of _mixBuffer in sample pairs.
+
+	static void clipMix(int16 *dst, const int32 *src, uint count);
+
+	bool _statsEnabled;
+	MixerStats _stats;
+	/** Profiling counters per stream class, indexed by class name. */
+	Common::HashMap<Common::String, MixerStats::Entry> _streamStats;
+
+	void updateStats(Channel *chan, int samples, uint len, uint64 micros, uint64 readMicros);
+
+	/** Quality of the rate converters of new channels. */
+	RateConverterQualitySetting *_rateConverterQuality;
 
 public:
 
@@ -118,6 +137,10 @@ public:
 
 	virtual uint getOutputRate() const;
 
+	virtual void setStatsEnabled(bool enabled);
+	virtual bool isStatsEnabled() const { return _statsEnabled; }
+	virtual void getStats(MixerStats &stats);
+
 protected:
 	void insertChannel(SoundHandle *handle, Channel *chan);
 
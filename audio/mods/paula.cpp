@@ -76,23 +76,40 @@ int Paula::readBuffer(int16 *buffer, const int numSamples) {
 
 template<bool stereo>
 inline int mixBuffer(int16 *&buf, const int8 *data, Paula::Offset &offset, frac_t rate, int neededSamples, uint bufSize, byte volume, byte panning) {
-	int samples;
-	for (samples = 0; samples < neededSamples && offset.int_off < bufSize; ++samples) {
-		const int32 tmp = ((int32) data[offset.int_off]) * volume;
+	if (offset.int_off >= bufSize)
+		return 0;
+
+	// Compute up front how many samples can be mixed before the end of the
+	// sample data is reached, so the loop below needs no bounds checks
+	int samples = neededSamples;
+	if (rate > 0) {
+		const uint64 left = ((uint64)(bufSize - offset.int_off) << FRAC_BITS) - offset.rem_off;
+		samples = (int)MIN<uint64>(neededSamples, (left + rate - 1) / rate);
+	}
+
+	const int32 volLeft = volume * (255 - panning);
+	const int32 volRight = volume * panning;
+
+	uint intOff = offset.int_off;
+	frac_t remOff = offset.rem_off;
+
+	for (int i = 0; i < samples; ++i) {
+		const int32 tmp = data[intOff];
 		if (stereo) {
-			*buf++ += (tmp * (255 - panning)) >> 7;
-			*buf++ += (tmp * (panning)) >> 7;
+			*buf++ += (tmp * volLeft) >> 7;
+			*buf++ += (tmp * volRight) >> 7;
 		} else
-			*buf++ += tmp;
+			*buf++ += tmp * volume;
 
 		// Step to next source sample
-		offset.rem_off += rate;
-		if (offset.rem_off >= (frac_t)FRAC_ONE) {
-			offset.int_off += fracToInt(offset.rem_off);
-			offset.rem_off &= FRAC_LO_MASK;
-		}
+		remOff += rate;
+		intOff += remOff >> FRAC_BITS;
+		remOff &= FRAC_LO_MASK;
 	}
 
+	offset.int_off = intOff;
+	offset.rem_off = remOff;
+
 	return samples;
 }
 
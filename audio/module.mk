@@ -3,6 +3,7 @@ MODULE := audio
 MODULE_OBJS := \
 	adlib.o \
 	audiostream.o \
+	decodedcache.o \
 	fmopl.o \
 	mididrv.o \
 	midiparser_qt.o \
@@ -35,6 +35,15 @@
 #include "common/textconsole.h"
 #include "common/util.h"
 
+// The sinc interpolation dot products use SSE2 or NEON where available.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RATE_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RATE_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace Audio {
 
 
@@ -57,6 +66,19 @@ enum {
 	FRAC_HALF_LOW = (1L << (FRAC_BITS_LOW-1))
 };
 
+/**
+ * Add a sample to an output buffer. 16-bit buffers are clipped on every
+ * addition, while 32-bit accumulator buffers are clipped by the mixer once
+ * all channels have been added up.
+ */
+static inline void mixSample(st_sample_t &a, int b) {
+	clampedAdd(a, b);
+}
+
+static inline void mixSample(st_accum_t &a, int b) {
+	a += b;
+}
+
 /**
  * Audio rate converter based on simple resampling. Used when no
  * interpolation is required.
@@ -79,10 +101,19 @@ protected:
 
 public:
 	SimpleRateConverter(st_rate_t inrate, st_rate_t outrate);
-	int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r);
+	int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+		return flowImpl(input, obuf, osamp, vol_l, vol_r);
+	}
+	int flowAccumulate(AudioStream &input, st_accum_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+		return flowImpl(input, obuf, osamp, vol_l, vol_r);
+	}
 	int drain(st_sample_t *obuf, st_size_t osamp, st_volume_t vol) {
 		return ST_SUCCESS;
 	}
+
+private:
+	template<typename Sample>
+	int flowImpl(AudioStream &input, Sample *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r);
 };
 
 
@@ -112,8 +143,9 @@ SimpleRateConverter<stereo, reverseStereo>::SimpleRateConverter(st_rate_t inrate
  * Return number of sample pairs processed.
  */
 template<bool stereo, bool reverseStereo>
-int SimpleRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
-	st_sample_t *ostart, *oend;
+template<typename Sample>
+int SimpleRateConverter<stereo, reverseStereo>::flowImpl(AudioStream &input, Sample *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+	Sample *ostart, *oend;
 
 	ostart = obuf;
 	oend = obuf + osamp * 2;
@@ -144,10 +176,10 @@ int SimpleRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_samp
 		opos += opos_inc;
 
 		// output left channel
-		clampedAdd(obuf[reverseStereo    ], (out0 * (int)vol_l) / Audio::Mixer::kMaxMixerVolume);
+		mixSample(obuf[reverseStereo    ], (out0 * (int)vol_l) / Audio::Mixer::kMaxMixerVolume);
 
 		// output right channel
-		clampedAdd(obuf[reverseStereo ^ 1], (out1 * (int)vol_r) / Audio::Mixer::kMaxMixerVolume);
+		mixSample(obuf[reverseStereo ^ 1], (out1 * (int)vol_r) / Audio::Mixer::kMaxMixerVolume);
 
 		obuf += 2;
 	}
@@ -185,10 +217,19 @@ protected:
 
 public:
 	LinearRateConverter(st_rate_t inrate, st_rate_t outrate);
-	int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r);
+	int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+		return flowImpl(input, obuf, osamp, vol_l, vol_r);
+	}
+	int flowAccumulate(AudioStream &input, st_accum_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+		return flowImpl(input, obuf, osamp, vol_l, vol_r);
+	}
 	int drain(st_sample_t *obuf, st_size_t osamp, st_volume_t vol) {
 		return ST_SUCCESS;
 	}
+
+private:
+	template<typename Sample>
+	int flowImpl(AudioStream &input, Sample *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r);
 };
 
 
@@ -221,8 +262,9 @@ LinearRateConverter<stereo, reverseStereo>::LinearRateConverter(st_rate_t inrate
  * Return number of sample pairs processed.
  */
 template<bool stereo, bool reverseStereo>
-int LinearRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
-	st_sample_t *ostart, *oend;
+template<typename Sample>
+int LinearRateConverter<stereo, reverseStereo>::flowImpl(AudioStream &input, Sample *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+	Sample *ostart, *oend;
 
 	ostart = obuf;
 	oend = obuf + osamp * 2;
@@ -259,10 +301,215 @@ int LinearRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_samp
 						  out0);
 
 			// output left channel
-			clampedAdd(obuf[reverseStereo    ], (out0 * (int)vol_l) / Audio::Mixer::kMaxMixerVolume);
+			mixSample(obuf[reverseStereo    ], (out0 * (int)vol_l) / Audio::Mixer::kMaxMixerVolume);
+
+			// output right channel
+			mixSample(obuf[reverseStereo ^ 1], (out1 * (int)vol_r) / Audio::Mixer::kMaxMixerVolume);
+
+			obuf += 2;
+
+			// Increment output position
+			opos += opos_inc;
+		}
+	}
+	return (obuf - ostart) / 2;
+}
+
+
+#pragma mark -
+
+
+/**
+ * Audio rate converter based on band-limited interpolation.
+ *
+ * Every output sample is computed from the surrounding kSincTaps input
+ * samples, weighted with a Blackman windowed sinc function. The filter is
+ * precomputed for kSincPhases fractional positions between two input
+ * samples (hence "polyphase"), so the inner loop is a plain dot product of
+ * 16-bit values, which SSE2 and NEON can compute in a few instructions.
+ *
+ * The cut off frequency is the lower of the two Nyquist frequencies, so
+ * the filter also acts as anti-aliasing filter when downsampling.
+ *
+ * Limited to sampling frequency <= 131071 Hz.
+ */
+
+enum {
+	kSincTaps = 16,
+	kSincPhaseBits = 8,
+	kSincPhases = (1 << kSincPhaseBits),
+	kSincCoeffBits = 14
+};
+
+#if defined(RATE_USE_SSE2)
+static inline int sincDotProduct(const st_sample_t *samples, const int16 *coeffs) {
+	__m128i sum = _mm_add_epi32(
+		_mm_madd_epi16(_mm_loadu_si128((const __m128i *)samples), _mm_loadu_si128((const __m128i *)coeffs)),
+		_mm_madd_epi16(_mm_loadu_si128((const __m128i *)(samples + 8)), _mm_loadu_si128((const __m128i *)(coeffs + 8))));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(sum);
+}
+#elif defined(RATE_USE_NEON)
+static inline int sincDotProduct(const st_sample_t *samples, const int16 *coeffs) {
+	int32x4_t sum = vmull_s16(vld1_s16(samples), vld1_s16(coeffs));
+	sum = vmlal_s16(sum, vld1_s16(samples + 4), vld1_s16(coeffs + 4));
+	sum = vmlal_s16(sum, vld1_s16(samples + 8), vld1_s16(coeffs + 8));
+	sum = vmlal_s16(sum, vld1_s16(samples + 12), vld1_s16(coeffs + 12));
+	const int32x2_t half = vadd_s32(vget_low_s32(sum), vget_high_s32(sum));
+	return vget_lane_s32(vpadd_s32(half, half), 0);
+}
+#else
+static inline int sincDotProduct(const st_sample_t *samples, const int16 *coeffs) {
+	int sum = 0;
+	for (int i = 0; i < kSincTaps; ++i)
+		sum += samples[i] * coeffs[i];
+	return sum;
+}
+#endif
+
+template<bool stereo, bool reverseStereo>
+class SincRateConverter : public RateConverter {
+protected:
+	st_sample_t inBuf[INTERMEDIATE_BUFFER_SIZE];
+	const st_sample_t *inPtr;
+	int inLen;
+
+	/** fractional position of the output stream in input stream unit */
+	frac_t opos;
+
+	/** fractional position increment in the output stream */
+	frac_t opos_inc;
+
+	/**
+	 * The last kSincTaps input samples of each channel. Every sample is
+	 * stored twice, kSincTaps entries apart, so that the kSincTaps entries
+	 * starting at histPos always hold them in order, oldest first.
+	 */
+	st_sample_t hist[2][2 * kSincTaps];
+	int histPos;
+
+	/** The filter coefficients, kSincTaps for each phase. */
+	int16 *coeffs;
+
+public:
+	SincRateConverter(st_rate_t inrate, st_rate_t outrate);
+	~SincRateConverter() {
+		delete[] coeffs;
+	}
+
+	int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+		return flowImpl(input, obuf, osamp, vol_l, vol_r);
+	}
+	int flowAccumulate(AudioStream &input, st_accum_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+		return flowImpl(input, obuf, osamp, vol_l, vol_r);
+	}
+	int drain(st_sample_t *obuf, st_size_t osamp, st_volume_t vol) {
+		return ST_SUCCESS;
+	}
+
+private:
+	template<typename Sample>
+	int flowImpl(AudioStream &input, Sample *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r);
+
+	st_sample_t interpolate(int channel, const int16 *phase) const {
+		const int val = (sincDotProduct(&hist[channel][histPos], phase) + (1 << (kSincCoeffBits - 1))) >> kSincCoeffBits;
+		return (st_sample_t)CLIP<int>(val, ST_SAMPLE_MIN, ST_SAMPLE_MAX);
+	}
+};
+
+
+/*
+ * Prepare processing.
+ */
+template<bool stereo, bool reverseStereo>
+SincRateConverter<stereo, reverseStereo>::SincRateConverter(st_rate_t inrate, st_rate_t outrate) {
+	if (inrate >= 131072 || outrate >= 131072) {
+		error("rate effect can only handle rates < 131072");
+	}
+
+	opos = FRAC_ONE_LOW;
+	opos_inc = (inrate << FRAC_BITS_LOW) / outrate;
+
+	memset(hist, 0, sizeof(hist));
+	histPos = 0;
+
+	inLen = 0;
+
+	// Cut off slightly below the Nyquist frequency, so that the transition
+	// band of the short filter does not reach into the aliasing range.
+	const double cutoff = 0.9 * MIN<double>(1.0, (double)outrate / inrate);
+	const double halfWidth = kSincTaps / 2;
+
+	coeffs = new int16[kSincPhases * kSincTaps];
+
+	for (int phase = 0; phase < kSincPhases; ++phase) {
+		const double frac = (double)phase / kSincPhases;
+		double weights[kSincTaps];
+		double total = 0;
+
+		// Tap i weights the input sample (i - kSincTaps / 2 + 1) positions
+		// away from the one preceding the output position.
+		for (int i = 0; i < kSincTaps; ++i) {
+			const double x = i - halfWidth + 1 - frac;
+			const double sinc = (x == 0) ? 1.0 : sin(M_PI * cutoff * x) / (M_PI * cutoff * x);
+			const double window = 0.42 + 0.5 * cos(M_PI * x / halfWidth) + 0.08 * cos(2 * M_PI * x / halfWidth);
+			weights[i] = sinc * window;
+			total += weights[i];
+		}
+
+		// Normalize every phase to unity gain, so a constant signal stays
+		// constant no matter where the output position falls.
+		for (int i = 0; i < kSincTaps; ++i)
+			coeffs[phase * kSincTaps + i] = (int16)floor(weights[i] / total * (1 << kSincCoeffBits) + 0.5);
+	}
+}
+
+/*
+ * Processed signed long samples from ibuf to obuf.
+ * Return number of sample pairs processed.
+ */
+template<bool stereo, bool reverseStereo>
+template<typename Sample>
+int SincRateConverter<stereo, reverseStereo>::flowImpl(AudioStream &input, Sample *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+	Sample *ostart, *oend;
+
+	ostart = obuf;
+	oend = obuf + osamp * 2;
+
+	while (obuf < oend) {
+
+		// read enough input samples so that opos < 0
+		while ((frac_t)FRAC_ONE_LOW <= opos) {
+			// Check if we have to refill the buffer
+			if (inLen == 0) {
+				inPtr = inBuf;
+				inLen = input.readBuffer(inBuf, ARRAYSIZE(inBuf));
+				if (inLen <= 0)
+					return (obuf - ostart) / 2;
+			}
+			inLen -= (stereo ? 2 : 1);
+			hist[0][histPos] = hist[0][histPos + kSincTaps] = *inPtr++;
+			if (stereo)
+				hist[1][histPos] = hist[1][histPos + kSincTaps] = *inPtr++;
+			histPos = (histPos + 1) % kSincTaps;
+			opos -= FRAC_ONE_LOW;
+		}
+
+		// Loop as long as the outpos trails behind, and as long as there is
+		// still space in the output buffer.
+		while (opos < (frac_t)FRAC_ONE_LOW && obuf < oend) {
+			const int16 *phase = &coeffs[(opos >> (FRAC_BITS_LOW - kSincPhaseBits)) * kSincTaps];
+
+			st_sample_t out0, out1;
+			out0 = interpolate(0, phase);
+			out1 = (stereo ? interpolate(1, phase) : out0);
+
+			// output left channel
+			mixSample(obuf[reverseStereo    ], (out0 * (int)vol_l) / Audio::Mixer::kMaxMixerVolume);
 
 			// output right channel
-			clampedAdd(obuf[reverseStereo ^ 1], (out1 * (int)vol_r) / Audio::Mixer::kMaxMixerVolume);
+			mixSample(obuf[reverseStereo ^ 1], (out1 * (int)vol_r) / Audio::Mixer::kMaxMixerVolume);
 
 			obuf += 2;
 
@@ -291,12 +538,26 @@ public:
 	}
 
 	virtual int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+		return flowImpl(input, obuf, osamp, vol_l, vol_r);
+	}
+
+	virtual int flowAccumulate(AudioStream &input, st_accum_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+		return flowImpl(input, obuf, osamp, vol_l, vol_r);
+	}
+
+	virtual int drain(st_sample_t *obuf, st_size_t osamp, st_volume_t vol) {
+		return ST_SUCCESS;
+	}
+
+private:
+	template<typename Sample>
+	int flowImpl(AudioStream &input, Sample *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
 		assert(input.isStereo() == stereo);
 
 		st_sample_t *ptr;
 		st_size_t len;
 
-		st_sample_t *ostart = obuf;
+		Sample *ostart = obuf;
 
 		if (stereo)
 			osamp *= 2;
@@ -322,28 +583,26 @@ public:
 			out1 = (stereo ? *ptr++ : out0);
 
 			// output left channel
-			clampedAdd(obuf[reverseStereo    ], (out0 * (int)vol_l) / Audio::Mixer::kMaxMixerVolume);
+			mixSample(obuf[reverseStereo    ], (out0 * (int)vol_l) / Audio::Mixer::kMaxMixerVolume);
 
 			// output right channel
-			clampedAdd(obuf[reverseStereo ^ 1], (out1 * (int)vol_r) / Audio::Mixer::kMaxMixerVolume);
+			mixSample(obuf[reverseStereo ^ 1], (out1 * (int)vol_r) / Audio::Mixer::kMaxMixerVolume);
 
 			obuf += 2;
 		}
 		return (obuf - ostart) / 2;
 	}
-
-	virtual int drain(st_sample_t *obuf, st_size_t osamp, st_volume_t vol) {
-		return ST_SUCCESS;
-	}
 };
 
 
 #pragma mark -
 
 template<bool stereo, bool reverseStereo>
-RateConverter *makeRateConverter(st_rate_t inrate, st_rate_t outrate) {
+RateConverter *makeRateConverter(st_rate_t inrate, st_rate_t outrate, RateConverterQuality quality) {
 	if (inrate != outrate) {
-		if ((inrate % outrate) == 0 && (inrate < 65536)) {
+		if (quality == kRateConverterHQ) {
+			return new SincRateConverter<stereo, reverseStereo>(inrate, outrate);
+		} else if (quality == kRateConverterFast && (inrate % outrate) == 0 && (inrate < 65536)) {
 			return new SimpleRateConverter<stereo, reverseStereo>(inrate, outrate);
 		} else {
 			return new LinearRateConverter<stereo, reverseStereo>(inrate, outrate);
@@ -356,14 +615,14 @@ RateConverter *makeRateConverter(st_rate_t inrate, st_rate_t outrate) {
 /**
  * Create and return a RateConverter object for the specified input and output rates.
  */
-RateConverter *makeRateConverter(st_rate_t inrate, st_rate_t outrate, bool stereo, bool reverseStereo) {
+RateConverter *makeRateConverter(st_rate_t inrate, st_rate_t outrate, bool stereo, bool reverseStereo, RateConverterQuality quality) {
 	if (stereo) {
 		if (reverseStereo)
-			return makeRateConverter<true, true>(inrate, outrate);
+			return makeRateConverter<true, true>(inrate, outrate, quality);
 		else
-			return makeRateConverter<true, false>(inrate, outrate);
+			return makeRateConverter<true, false>(inrate, outrate, quality);
 	} else
-		return makeRateConverter<false, false>(inrate, outrate);
+		return makeRateConverter<false, false>(inrate, outrate, quality);
 }
 
 } // End of namespace Audio
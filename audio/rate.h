@@ -24,6 +24,7 @@
 #define AUDIO_RATE_H
 
 #include "common/scummsys.h"
+#include "common/util.h"
 
 namespace Audio {
 
@@ -33,6 +34,7 @@ typedef int16 st_sample_t;
 typedef uint16 st_volume_t;
 typedef uint32 st_size_t;
 typedef uint32 st_rate_t;
+typedef int32 st_accum_t;
 
 /* Minimum and maximum values a sample can hold. */
 enum {
@@ -75,10 +77,62 @@ public:
 	 */
 	virtual int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) = 0;
 
+	/**
+	 * Like flow(), but adds the samples to a 32-bit accumulator buffer
+	 * without clipping them. The caller is responsible for clipping the
+	 * final mix down to 16 bits.
+	 *
+	 * The default implementation goes through flow() and a temporary
+	 * 16-bit buffer, so converters only need to override this when they
+	 * can accumulate directly.
+	 *
+	 * @return Number of sample pairs written into the buffer.
+	 */
+	virtual int flowAccumulate(AudioStream &input, st_accum_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+		st_sample_t tmp[2 * 256];
+		const st_size_t chunk = ARRAYSIZE(tmp) / 2;
+		int total = 0;
+
+		while (osamp > 0) {
+			const st_size_t len = MIN(osamp, chunk);
+			memset(tmp, 0, sizeof(tmp));
+			const int res = flow(input, tmp, len, vol_l, vol_r);
+			for (int i = 0; i < 2 * res; ++i)
+				obuf[i] += tmp[i];
+
+			total += res;
+			if (res < (int)len)
+				break;
+			obuf += 2 * res;
+			osamp -= res;
+		}
+
+		return total;
+	}
+
 	virtual int drain(st_sample_t *obuf, st_size_t osamp, st_volume_t vol) = 0;
 };
 
-RateConverter *makeRateConverter(st_rate_t inrate, st_rate_t outrate, bool stereo, bool reverseStereo = false);
+/**
+ * Quality levels of the rate converters created by makeRateConverter().
+ */
+enum RateConverterQuality {
+	/**
+	 * Drop or repeat samples when the rates have an integral ratio,
+	 * interpolate linearly otherwise.
+	 */
+	kRateConverterFast,
+	/** Always interpolate linearly. */
+	kRateConverterLinear,
+	/**
+	 * Band-limited interpolation with a polyphase windowed sinc filter.
+	 * This removes most of the aliasing of the other modes, at the cost of
+	 * a few multiplications per output sample.
+	 */
+	kRateConverterHQ
+};
+
+RateConverter *makeRateConverter(st_rate_t inrate, st_rate_t outrate, bool stereo, bool reverseStereo = false, RateConverterQuality quality = kRateConverterFast);
 
 } // End of namespace Audio
 
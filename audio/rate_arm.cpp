@@ -446,10 +446,13 @@ public:
 
 /**
  * Create and return a RateConverter object for the specified input and output rates.
+ *
+ * There is no assembly version of the sinc interpolation, so
+ * kRateConverterHQ falls back to linear interpolation here.
  */
-RateConverter *makeRateConverter(st_rate_t inrate, st_rate_t outrate, bool stereo, bool reverseStereo) {
+RateConverter *makeRateConverter(st_rate_t inrate, st_rate_t outrate, bool stereo, bool reverseStereo, RateConverterQuality quality) {
 	if (inrate != outrate) {
-		if ((inrate % outrate) == 0 && (inrate < 65536)) {
+		if (quality == kRateConverterFast && (inrate % outrate) == 0 && (inrate < 65536)) {
 			if (stereo) {
 				if (reverseStereo)
 					return new SimpleRateConverter<true, true>(inrate, outrate);
@@ -27,6 +27,8 @@
 #include "audio/mididrv.h"
 #include "audio/mixer.h"
 
+#include "common/array.h"
+
 class MidiDriver_Emulated : public Audio::AudioStream, public MidiDriver {
 protected:
 	bool _isOpen;
@@ -44,9 +46,61 @@ private:
 	int _nextTick;
 	int _samplesPerTick;
 
+	struct DelayedEvent {
+		uint32 frame;		///< Frame offset from the start of the tick.
+		uint32 b;
+		uint32 sysExOffset;	///< Offset of the SysEx data in _delayedSysExData.
+		uint16 sysExLength;	///< Length of the SysEx data, or 0 for a short message.
+	};
+
+	// Events sent with a delay from the timer callback, in order
+	Common::Array<DelayedEvent> _delayedEvents;
+	Common::Array<byte> _delayedSysExData;
+	uint _delayedEventPos;
+	uint32 _tickFrame;
+
+	void queueDelayedEvent(uint32 delay, uint32 b, const byte *msg, uint16 length) {
+		DelayedEvent event;
+		event.frame = (uint32)(((uint64)delay * getRate()) / 1000000);
+		event.b = b;
+		event.sysExOffset = _delayedSysExData.size();
+		event.sysExLength = length;
+
+		if (length) {
+			_delayedSysExData.resize(event.sysExOffset + length);
+			memcpy(&_delayedSysExData[event.sysExOffset], msg, length);
+		}
+
+		_delayedEvents.push_back(event);
+	}
+
+	void sendDelayedEvents(uint32 frame) {
+		while (_delayedEventPos < _delayedEvents.size() && _delayedEvents[_delayedEventPos].frame <= frame) {
+			const DelayedEvent &event = _delayedEvents[_delayedEventPos++];
+			if (event.sysExLength)
+				sysEx(&_delayedSysExData[event.sysExOffset], event.sysExLength);
+			else
+				send(event.b);
+		}
+
+		// Keep the storage around, new events arrive with every tick
+		if (_delayedEventPos == _delayedEvents.size()) {
+			_delayedEvents.resize(0);
+			_delayedSysExData.resize(0);
+			_delayedEventPos = 0;
+		}
+	}
+
 protected:
 	int _baseFreq;
 
+	/**
+	 * True while the driver runs the timer callback or sends the events
+	 * the callback delayed. Events sent meanwhile are in sync with the
+	 * generated samples.
+	 */
+	bool _inTimerCallback;
+
 	virtual void generateSamples(int16 *buf, int len) = 0;
 	virtual void onTimer() {}
 
@@ -58,7 +112,10 @@ public:
 		_timerParam(0),
 		_nextTick(0),
 		_samplesPerTick(0),
-		_baseFreq(250) {
+		_delayedEventPos(0),
+		_tickFrame(0),
+		_baseFreq(250),
+		_inTimerCallback(false) {
 	}
 
 	// MidiDriver API
@@ -87,6 +144,24 @@ public:
 		return 1000000 / _baseFreq;
 	}
 
+	/**
+	 * Events sent with a delay from the timer callback are played at the
+	 * exact sample they are due. Otherwise they are sent right away.
+	 */
+	virtual void sendTimestamped(uint32 delay, uint32 b) {
+		if (_inTimerCallback)
+			queueDelayedEvent(delay, b, nullptr, 0);
+		else
+			send(b);
+	}
+
+	virtual void sysExTimestamped(uint32 delay, const byte *msg, uint16 length) {
+		if (_inTimerCallback && length)
+			queueDelayedEvent(delay, 0, msg, length);
+		else
+			sysEx(msg, length);
+	}
+
 	// AudioStream API
 	virtual int readBuffer(int16 *data, const int numSamples) {
 		const int stereoFactor = isStereo() ? 2 : 1;
@@ -98,16 +173,35 @@ public:
 			if (step > (_nextTick >> FIXP_SHIFT))
 				step = (_nextTick >> FIXP_SHIFT);
 
+			// Stop at the next delayed event
+			if (_delayedEventPos < _delayedEvents.size()) {
+				_inTimerCallback = true;
+				sendDelayedEvents(_tickFrame);
+				_inTimerCallback = false;
+
+				if (_delayedEventPos < _delayedEvents.size() && step > (int)(_delayedEvents[_delayedEventPos].frame - _tickFrame))
+					step = _delayedEvents[_delayedEventPos].frame - _tickFrame;
+			}
+
 			generateSamples(data, step);
 
 			_nextTick -= step << FIXP_SHIFT;
+			_tickFrame += step;
 			if (!(_nextTick >> FIXP_SHIFT)) {
+				_inTimerCallback = true;
+
+				// Events delayed past the end of the tick by rounding
+				sendDelayedEvents(0xFFFFFFFF);
+
 				if (_timerProc)
 					(*_timerProc)(_timerParam);
 
 				onTimer();
 
+				_inTimerCallback = false;
+
 				_nextTick += _samplesPerTick;
+				_tickFrame = 0;
 			}
 
 			data += step * stereoFactor;
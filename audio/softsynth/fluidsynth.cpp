@@ -24,25 +24,136 @@
 
 #ifdef USE_FLUIDSYNTH
 
+#include "common/array.h"
 #include "common/config-manager.h"
 #include "common/error.h"
+#include "common/fs.h"
+#include "common/stream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 #include "audio/musicplugin.h"
 #include "audio/mpu401.h"
 #include "audio/softsynth/emumidi.h"
+#include "audio/softsynth/fluidsynth.h"
 #if defined(IPHONE_IOS7) && defined(IPHONE_SANDBOXED)
 #include "backends/platform/ios7/ios7_common.h"
 #endif
 
 #include <fluidsynth.h>
 
+/**
+ * The soundfonts loaded by all FluidSynth drivers.
+ *
+ * Each soundfont is loaded once into a synth owned by the manager, and
+ * added to the synth of every driver using it. This way it stays valid
+ * until the last of these drivers is closed, whichever is closed first.
+ * Drivers are opened and closed from the main thread only, so the manager
+ * needs no locking.
+ */
+class FluidSynthSoundFontManager {
+public:
+	static fluid_sfont_t *acquire(const Common::String &path);
+	static void release(fluid_sfont_t *sfont);
+	static void getUsage(uint &count, uint32 &size);
+
+private:
+	struct SoundFont {
+		Common::String path;
+		fluid_settings_t *settings;
+		fluid_synth_t *synth;
+		fluid_sfont_t *sfont;
+		uint refCount;
+		uint32 size;
+	};
+
+	// Allocated on first use to avoid a global constructor.
+	static Common::Array<SoundFont> *_soundFonts;
+};
+
+Common::Array<FluidSynthSoundFontManager::SoundFont> *FluidSynthSoundFontManager::_soundFonts = nullptr;
+
+fluid_sfont_t *FluidSynthSoundFontManager::acquire(const Common::String &path) {
+	if (!_soundFonts)
+		_soundFonts = new Common::Array<SoundFont>();
+
+	for (uint i = 0; i < _soundFonts->size(); ++i) {
+		SoundFont &soundFont = (*_soundFonts)[i];
+		if (soundFont.path == path) {
+			soundFont.refCount++;
+			return soundFont.sfont;
+		}
+	}
+
+	SoundFont soundFont;
+	soundFont.path = path;
+	soundFont.settings = new_fluid_settings();
+#if FLUIDSYNTH_VERSION_MAJOR >= 2
+	// Only keep the samples of presets in use
+	fluid_settings_setint(soundFont.settings, "synth.dynamic-sample-loading", 1);
+#endif
+	soundFont.synth = new_fluid_synth(soundFont.settings);
+	const int id = fluid_synth_sfload(soundFont.synth, path.c_str(), 0);
+	if (id == -1) {
+		delete_fluid_synth(soundFont.synth);
+		delete_fluid_settings(soundFont.settings);
+		return nullptr;
+	}
+
+	soundFont.sfont = fluid_synth_get_sfont_by_id(soundFont.synth, id);
+	soundFont.refCount = 1;
+
+	Common::SeekableReadStream *file = Common::FSNode(path).createReadStream();
+	soundFont.size = file ? file->size() : 0;
+	delete file;
+
+	_soundFonts->push_back(soundFont);
+	return soundFont.sfont;
+}
+
+void FluidSynthSoundFontManager::release(fluid_sfont_t *sfont) {
+	assert(_soundFonts);
+
+	for (uint i = 0; i < _soundFonts->size(); ++i) {
+		SoundFont &soundFont = (*_soundFonts)[i];
+		if (soundFont.sfont != sfont)
+			continue;
+
+		if (--soundFont.refCount == 0) {
+			fluid_synth_remove_sfont(soundFont.synth, soundFont.sfont);
+			delete_fluid_sfont(soundFont.sfont);
+			delete_fluid_synth(soundFont.synth);
+			delete_fluid_settings(soundFont.settings);
+			_soundFonts->remove_at(i);
+		}
+		return;
+	}
+
+	warning("FluidSynthSoundFontManager::release: Unknown soundfont");
+}
+
+void FluidSynthSoundFontManager::getUsage(uint &count, uint32 &size) {
+	count = 0;
+	size = 0;
+
+	if (!_soundFonts)
+		return;
+
+	for (uint i = 0; i < _soundFonts->size(); ++i) {
+		count++;
+		size += (*_soundFonts)[i].size;
+	}
+}
+
+void FluidSynth_getSoundFontUsage(uint &count, uint32 &size) {
+	FluidSynthSoundFontManager::getUsage(count, size);
+}
+
 class MidiDriver_FluidSynth : public MidiDriver_Emulated {
 private:
 	MidiChannel_MPU401 _midiChannels[16];
 	fluid_settings_t *_settings;
 	fluid_synth_t *_synth;
-	int _soundFont;
+	fluid_sfont_t *_soundFont;
 	int _outputRate;
 
 protected:
@@ -189,14 +300,17 @@ int MidiDriver_FluidSynth::open() {
 	// reflect that.
 	Common::String soundfont_fullpath = iOS7_getDocumentsDir();
 	soundfont_fullpath += soundfont;
-	_soundFont = fluid_synth_sfload(_synth, soundfont_fullpath.c_str(), 1);
+	_soundFont = FluidSynthSoundFontManager::acquire(soundfont_fullpath);
 #else
-	_soundFont = fluid_synth_sfload(_synth, soundfont, 1);
+	_soundFont = FluidSynthSoundFontManager::acquire(soundfont);
 #endif
 
-	if (_soundFont == -1)
+	if (!_soundFont)
 		error("Failed loading custom sound font '%s'", soundfont);
 
+	fluid_synth_add_sfont(_synth, _soundFont);
+	fluid_synth_program_reset(_synth);
+
 	MidiDriver_Emulated::open();
 
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
@@ -210,8 +324,10 @@ void MidiDriver_FluidSynth::close() {
 
 	_mixer->stopHandle(_mixerSoundHandle);
 
-	if (_soundFont != -1)
-		fluid_synth_sfunload(_synth, _soundFont, 1);
+	// The soundfont is shared, it must not be deleted with the synth
+	fluid_synth_remove_sfont(_synth, _soundFont);
+	FluidSynthSoundFontManager::release(_soundFont);
+	_soundFont = nullptr;
 
 	delete_fluid_synth(_synth);
 	delete_fluid_settings(_settings);
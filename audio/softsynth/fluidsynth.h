@@ -0,0 +1,44 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIO_SOFTSYNTH_FLUIDSYNTH_H
+#define AUDIO_SOFTSYNTH_FLUIDSYNTH_H
+
+#include "common/scummsys.h"
+
+#ifdef USE_FLUIDSYNTH
+
+/**
+ * Return how many soundfonts the FluidSynth drivers currently have loaded
+ * and their total file size in bytes.
+ *
+ * Drivers using the same soundfont share a single copy of it, which is
+ * unloaded when the last of them is closed. The size is the memory the
+ * soundfonts take when all their samples are loaded; FluidSynth versions
+ * supporting dynamic sample loading only keep the samples of presets in
+ * use, so they may take less.
+ */
+void FluidSynth_getSoundFontUsage(uint &count, uint32 &size);
+
+#endif
+
+#endif
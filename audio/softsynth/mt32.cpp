@@ -37,6 +37,10 @@
 #include "common/system.h"
 #include "common/util.h"
 #include "common/archive.h"
+#include "common/array.h"
+#include "common/atomic.h"
+#include "common/queue.h"
+#include "common/ringbuffer.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #include "common/osd_message_queue.h"
@@ -113,6 +117,59 @@ private:
 
 	int _outputRate;
 
+	/**
+	 * When rendering on a worker thread, the synth runs ahead of the mixer
+	 * by up to kRenderChunks chunks of kRenderChunkFrames stereo frames.
+	 */
+	enum {
+		kRenderChunkFrames = 256,
+		kRenderChunks = 16,
+		kRenderLookahead = (kRenderChunks + 1) * kRenderChunkFrames
+	};
+
+	struct RenderChunk {
+		int16 samples[2 * kRenderChunkFrames];
+	};
+
+	/**
+	 * A MIDI event sent from outside the worker thread, to be played once
+	 * the synth has rendered up to its timestamp.
+	 */
+	struct QueuedEvent {
+		enum Type {
+			kTypeMessage,
+			kTypeSysEx,
+			kTypeWriteSysEx
+		};
+
+		Type type;
+		uint32 timestamp;
+		uint32 msg;		///< The message, or the channel for kTypeWriteSysEx.
+		Common::Array<byte> data;
+	};
+
+	OSystem::ThreadRef _renderThread;
+	OSystem::SemaphoreRef _renderSemaphore;
+	Common::SPSCRingBuffer<RenderChunk> *_renderBuffer;
+	Common::Queue<QueuedEvent> _eventQueue;
+	volatile uint32 _renderQuit;
+	volatile uint32 _playedFrames;
+	uint32 _renderedFrames;
+
+	// Only accessed by the mixer thread
+	RenderChunk _playChunk;
+	uint _playChunkPos;
+
+	bool startRenderThread();
+	void stopRenderThread();
+	static void renderThreadProc(void *param);
+	void renderChunk(int16 *data);
+	void queueEvent(QueuedEvent &event);
+	// Events sent by the player from the timer callback are already in
+	// sync with the rendered samples, so they are played right away even
+	// when rendering on the worker thread.
+	bool shouldQueueEvents() const { return _renderThread && !_inTimerCallback; }
+
 protected:
 	void generateSamples(int16 *buf, int len);
 
@@ -131,6 +188,7 @@ public:
 	MidiChannel *getPercussionChannel();
 
 	// AudioStream API
+	int readBuffer(int16 *data, const int numSamples);
 	bool isStereo() const { return true; }
 	int getRate() const { return _outputRate; }
 };
@@ -150,6 +208,13 @@ MidiDriver_MT32::MidiDriver_MT32(Audio::Mixer *mixer) : MidiDriver_Emulated(mixe
 	_outputRate = 0;
 	_controlData = nullptr;
 	_pcmData = nullptr;
+	_renderThread = 0;
+	_renderSemaphore = 0;
+	_renderBuffer = nullptr;
+	_renderQuit = 0;
+	_playedFrames = 0;
+	_renderedFrames = 0;
+	_playChunkPos = kRenderChunkFrames;
 }
 
 MidiDriver_MT32::~MidiDriver_MT32() {
@@ -221,6 +286,9 @@ int MidiDriver_MT32::open() {
 
 	MidiDriver_Emulated::open();
 
+	if (ConfMan.getBool("mt32_render_thread") && !startRenderThread())
+		warning("MT32emu: Cannot create the render thread, rendering in the mixer callback");
+
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 
 	return 0;
@@ -228,6 +296,13 @@ int MidiDriver_MT32::open() {
 
 void MidiDriver_MT32::send(uint32 b) {
 	Common::StackLock lock(_mutex);
+	if (shouldQueueEvents()) {
+		QueuedEvent event;
+		event.type = QueuedEvent::kTypeMessage;
+		event.msg = b;
+		queueEvent(event);
+		return;
+	}
 	_service.playMsg(b);
 }
 
@@ -239,12 +314,27 @@ void MidiDriver_MT32::setPitchBendRange(byte channel, uint range) {
 	}
 	byte benderRangeSysex[4] = { 0, 0, 4, (uint8)range };
 	Common::StackLock lock(_mutex);
+	if (shouldQueueEvents()) {
+		QueuedEvent event;
+		event.type = QueuedEvent::kTypeWriteSysEx;
+		event.msg = channel;
+		event.data = Common::Array<byte>(benderRangeSysex, 4);
+		queueEvent(event);
+		return;
+	}
 	_service.writeSysex(channel, benderRangeSysex, 4);
 }
 
 void MidiDriver_MT32::sysEx(const byte *msg, uint16 length) {
 	if (msg[0] == 0xf0) {
 		Common::StackLock lock(_mutex);
+		if (shouldQueueEvents()) {
+			QueuedEvent event;
+			event.type = QueuedEvent::kTypeSysEx;
+			event.data = Common::Array<byte>(msg, length);
+			queueEvent(event);
+			return;
+		}
 		_service.playSysex(msg, length);
 	} else {
 		enum {
@@ -254,6 +344,14 @@ void MidiDriver_MT32::sysEx(const byte *msg, uint16 length) {
 
 		if (msg[3] == SYSEX_CMD_DT1 || msg[3] == SYSEX_CMD_DAT) {
 			Common::StackLock lock(_mutex);
+			if (shouldQueueEvents()) {
+				QueuedEvent event;
+				event.type = QueuedEvent::kTypeWriteSysEx;
+				event.msg = msg[1];
+				event.data = Common::Array<byte>(msg + 4, length - 5);
+				queueEvent(event);
+				return;
+			}
 			_service.writeSysex(msg[1], msg + 4, length - 5);
 		} else {
 			warning("Unused sysEx command %d", msg[3]);
@@ -271,6 +369,8 @@ void MidiDriver_MT32::close() {
 	// Detach the mixer callback handler
 	_mixer->stopHandle(_mixerSoundHandle);
 
+	stopRenderThread();
+
 	Common::StackLock lock(_mutex);
 	_service.closeSynth();
 	_service.freeContext();
@@ -285,6 +385,139 @@ void MidiDriver_MT32::generateSamples(int16 *data, int len) {
 	_service.renderBit16s(data, len);
 }
 
+int MidiDriver_MT32::readBuffer(int16 *data, const int numSamples) {
+	if (!_renderThread)
+		return MidiDriver_Emulated::readBuffer(data, numSamples);
+
+	int frames = numSamples / 2;
+	while (frames > 0) {
+		if (_playChunkPos == kRenderChunkFrames) {
+			if (!_renderBuffer->pop(_playChunk)) {
+				// The worker thread could not keep up, play silence instead
+				// of blocking the mixer.
+				debug(5, "MT32emu: Render buffer underrun, %d frames", frames);
+				memset(data, 0, frames * 2 * sizeof(int16));
+				Common::atomicFetchAdd(&_playedFrames, (uint32)frames);
+				break;
+			}
+			_playChunkPos = 0;
+			g_system->postSemaphore(_renderSemaphore);
+		}
+
+		const uint count = MIN<uint>(frames, kRenderChunkFrames - _playChunkPos);
+		memcpy(data, _playChunk.samples + 2 * _playChunkPos, count * 2 * sizeof(int16));
+		_playChunkPos += count;
+		data += 2 * count;
+		frames -= count;
+		Common::atomicFetchAdd(&_playedFrames, (uint32)count);
+	}
+
+	return numSamples;
+}
+
+bool MidiDriver_MT32::startRenderThread() {
+	_renderSemaphore = g_system->createSemaphore(0);
+	if (!_renderSemaphore)
+		return false;
+
+	_renderBuffer = new Common::SPSCRingBuffer<RenderChunk>(kRenderChunks);
+	_renderQuit = 0;
+	_playedFrames = 0;
+	_renderedFrames = 0;
+	_playChunkPos = kRenderChunkFrames;
+
+	_renderThread = g_system->createThread(renderThreadProc, this);
+	if (!_renderThread) {
+		g_system->deleteSemaphore(_renderSemaphore);
+		_renderSemaphore = 0;
+		delete _renderBuffer;
+		_renderBuffer = nullptr;
+		return false;
+	}
+
+	return true;
+}
+
+void MidiDriver_MT32::stopRenderThread() {
+	if (!_renderThread)
+		return;
+
+	Common::atomicStoreRelease(&_renderQuit, 1);
+	g_system->postSemaphore(_renderSemaphore);
+	g_system->joinThread(_renderThread);
+	_renderThread = 0;
+
+	g_system->deleteSemaphore(_renderSemaphore);
+	_renderSemaphore = 0;
+	delete _renderBuffer;
+	_renderBuffer = nullptr;
+
+	Common::StackLock lock(_mutex);
+	_eventQueue.clear();
+}
+
+void MidiDriver_MT32::renderThreadProc(void *param) {
+	MidiDriver_MT32 *driver = (MidiDriver_MT32 *)param;
+	RenderChunk chunk;
+
+	while (!Common::atomicLoadAcquire(&driver->_renderQuit)) {
+		// Sleep until the mixer has made room in the buffer
+		if (driver->_renderBuffer->size() == driver->_renderBuffer->capacity()) {
+			g_system->waitSemaphore(driver->_renderSemaphore);
+			continue;
+		}
+
+		driver->renderChunk(chunk.samples);
+		driver->_renderBuffer->push(chunk);
+	}
+}
+
+void MidiDriver_MT32::renderChunk(int16 *data) {
+	// Render up to the timestamp of each queued event, then play it. The
+	// timer callbacks are run by MidiDriver_Emulated::readBuffer() as usual.
+	uint32 pos = 0;
+	while (pos < kRenderChunkFrames) {
+		uint32 end = kRenderChunkFrames;
+
+		_mutex.lock();
+		while (!_eventQueue.empty()) {
+			const QueuedEvent &event = _eventQueue.front();
+			const int32 delta = (int32)(event.timestamp - (_renderedFrames + pos));
+			if (delta > 0) {
+				end = MIN<uint32>(end, pos + delta);
+				break;
+			}
+
+			switch (event.type) {
+			case QueuedEvent::kTypeMessage:
+				_service.playMsg(event.msg);
+				break;
+			case QueuedEvent::kTypeSysEx:
+				_service.playSysex(event.data.data(), event.data.size());
+				break;
+			case QueuedEvent::kTypeWriteSysEx:
+				_service.writeSysex(event.msg, event.data.data(), event.data.size());
+				break;
+			}
+			_eventQueue.pop();
+		}
+		_mutex.unlock();
+
+		MidiDriver_Emulated::readBuffer(data + 2 * pos, 2 * (end - pos));
+		pos = end;
+	}
+
+	_renderedFrames += kRenderChunkFrames;
+}
+
+void MidiDriver_MT32::queueEvent(QueuedEvent &event) {
+	// Delay the event by the lookahead of the render buffer. The mixer plays
+	// the samples rendered now that much later, so this keeps the latency
+	// constant instead of depending on how far ahead the worker thread is.
+	event.timestamp = Common::atomicLoadAcquire(&_playedFrames) + kRenderLookahead;
+	_eventQueue.push(event);
+}
+
 uint32 MidiDriver_MT32::property(int prop, uint32 param) {
 	switch (prop) {
 	case PROP_CHANNEL_MASK:
@@ -22,6 +22,12 @@
 #include "BReverbModel.h"
 #include "Synth.h"
 
+#if MT32EMU_USE_SSE2
+#include <emmintrin.h>
+#elif MT32EMU_USE_NEON
+#include <arm_neon.h>
+#endif
+
 // Analysing of state of reverb RAM address lines gives exact sizes of the buffers of filters used. This also indicates that
 // the reverb model implemented in the real devices consists of three series allpass filters preceded by a non-feedback comb (or a delay with a LPF)
 // and followed by three parallel comb filters
@@ -40,6 +46,9 @@ static const Bit32u MODE_3_FEEDBACK_DELAY = 1;
 // Avoid denormals degrading performance, using biased input
 static const FloatSample BIAS = 1e-20f;
 
+// The input is processed in blocks of this many samples
+static const Bit32u BLOCK_SIZE = 128;
+
 struct BReverbSettings {
 	const Bit32u numberOfAllpasses;
 	const Bit32u * const allpassSizes;
@@ -273,6 +282,104 @@ static inline FloatSample mixCombs(FloatSample out1, FloatSample out2, FloatSamp
 	return 1.5f * (out1 + out2) + out3;
 }
 
+/* NOTE:
+ *   The block processing kernels below apply the very same operations as the per-sample functions above.
+ *   The SIMD versions are only used for the float renderer. Multiplying by 1/256 instead of dividing by 256
+ *   yields exactly the same result, as 256 is a power of two.
+ */
+template <class Sample>
+static void produceDryBlock(const Sample *inLeft, const Sample *inRight, Sample *dry, Bit32u count, bool tapDelayMode, Bit8u dryAmp) {
+	for (Bit32u i = 0; i < count; i++) {
+		Sample sample;
+		if (tapDelayMode) {
+			sample = halveSample(inLeft[i]) + halveSample(inRight[i]);
+		} else {
+			sample = quarterSample(inLeft[i]) + quarterSample(inRight[i]);
+		}
+		// Looks like dryAmp doesn't change in MT-32 but it does in CM-32L / LAPC-I
+		dry[i] = weirdMul(addDCBias(sample), dryAmp, 0xFF);
+	}
+}
+
+template <class Sample>
+static void produceWetBlock(const Sample *out1, const Sample *out2, const Sample *out3, Sample *wet, Bit32u count, Bit8u wetLevel) {
+	for (Bit32u i = 0; i < count; i++) {
+		wet[i] = weirdMul(mixCombs(out1[i], out2[i], out3[i]), wetLevel, 0xFF);
+	}
+}
+
+template <class Sample>
+static void produceTapDelayWetBlock(const Sample *out, Sample *wet, Bit32u count, Bit8u wetLevel) {
+	for (Bit32u i = 0; i < count; i++) {
+		wet[i] = weirdMul(out[i], wetLevel, 0xFF);
+	}
+}
+
+#if MT32EMU_USE_SSE2 || MT32EMU_USE_NEON
+
+#if MT32EMU_USE_SSE2
+typedef __m128 FloatVector;
+static inline FloatVector loadVector(const FloatSample *p) { return _mm_loadu_ps(p); }
+static inline void storeVector(FloatSample *p, FloatVector v) { _mm_storeu_ps(p, v); }
+static inline FloatVector splatVector(FloatSample x) { return _mm_set1_ps(x); }
+static inline FloatVector addVector(FloatVector a, FloatVector b) { return _mm_add_ps(a, b); }
+static inline FloatVector mulVector(FloatVector a, FloatVector b) { return _mm_mul_ps(a, b); }
+#else
+typedef float32x4_t FloatVector;
+static inline FloatVector loadVector(const FloatSample *p) { return vld1q_f32(p); }
+static inline void storeVector(FloatSample *p, FloatVector v) { vst1q_f32(p, v); }
+static inline FloatVector splatVector(FloatSample x) { return vdupq_n_f32(x); }
+static inline FloatVector addVector(FloatVector a, FloatVector b) { return vaddq_f32(a, b); }
+static inline FloatVector mulVector(FloatVector a, FloatVector b) { return vmulq_f32(a, b); }
+#endif
+
+template <>
+void produceDryBlock<FloatSample>(const FloatSample *inLeft, const FloatSample *inRight, FloatSample *dry, Bit32u count, bool tapDelayMode, Bit8u dryAmp) {
+	const FloatVector inputFactor = splatVector(tapDelayMode ? 0.5f : 0.25f);
+	const FloatVector bias = splatVector(BIAS);
+	const FloatVector amp = splatVector(FloatSample(dryAmp));
+	const FloatVector scale = splatVector(1.0f / 256.0f);
+	Bit32u i = 0;
+	for (; i + 4 <= count; i += 4) {
+		FloatVector sample = addVector(mulVector(inputFactor, loadVector(inLeft + i)), mulVector(inputFactor, loadVector(inRight + i)));
+		storeVector(dry + i, mulVector(mulVector(addVector(sample, bias), amp), scale));
+	}
+	for (; i < count; i++) {
+		FloatSample sample = tapDelayMode ? halveSample(inLeft[i]) + halveSample(inRight[i]) : quarterSample(inLeft[i]) + quarterSample(inRight[i]);
+		dry[i] = weirdMul(addDCBias(sample), dryAmp, 0xFF);
+	}
+}
+
+template <>
+void produceWetBlock<FloatSample>(const FloatSample *out1, const FloatSample *out2, const FloatSample *out3, FloatSample *wet, Bit32u count, Bit8u wetLevel) {
+	const FloatVector combFactor = splatVector(1.5f);
+	const FloatVector level = splatVector(FloatSample(wetLevel));
+	const FloatVector scale = splatVector(1.0f / 256.0f);
+	Bit32u i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const FloatVector sample = addVector(mulVector(combFactor, addVector(loadVector(out1 + i), loadVector(out2 + i))), loadVector(out3 + i));
+		storeVector(wet + i, mulVector(mulVector(sample, level), scale));
+	}
+	for (; i < count; i++) {
+		wet[i] = weirdMul(mixCombs(out1[i], out2[i], out3[i]), wetLevel, 0xFF);
+	}
+}
+
+template <>
+void produceTapDelayWetBlock<FloatSample>(const FloatSample *out, FloatSample *wet, Bit32u count, Bit8u wetLevel) {
+	const FloatVector level = splatVector(FloatSample(wetLevel));
+	const FloatVector scale = splatVector(1.0f / 256.0f);
+	Bit32u i = 0;
+	for (; i + 4 <= count; i += 4) {
+		storeVector(wet + i, mulVector(mulVector(loadVector(out + i), level), scale));
+	}
+	for (; i < count; i++) {
+		wet[i] = weirdMul(out[i], wetLevel, 0xFF);
+	}
+}
+
+#endif // #if MT32EMU_USE_SSE2 || MT32EMU_USE_NEON
+
 template <class Sample>
 class RingBuffer {
 	static inline Sample sampleValueThreshold();
@@ -366,7 +473,12 @@ public:
 	}
 
 	Sample getOutputAt(const Bit32u outIndex) const {
-		return this->buffer[(this->size + this->index - outIndex) % this->size];
+		// Output positions never exceed the size of the buffer, so a single subtraction wraps the position around
+		Bit32u position = this->size + this->index - outIndex;
+		if (position >= this->size) {
+			position -= this->size;
+		}
+		return this->buffer[position];
 	}
 
 	void setFeedbackFactor(const Bit8u useFeedbackFactor) {
@@ -565,61 +677,73 @@ public:
 			return;
 		}
 
-		while ((numSamples--) > 0) {
-			Sample dry;
+		// The input scaling and the output mixing are done for a whole block at once. The filters in-between
+		// still process one sample at a time, so that the independent recursions of the combs can overlap.
+		Sample dry[BLOCK_SIZE];
+		Sample outL[3][BLOCK_SIZE];
+		Sample outR[3][BLOCK_SIZE];
 
-			if (tapDelayMode) {
-				dry = halveSample(*(inLeft++)) + halveSample(*(inRight++));
-			} else {
-				dry = quarterSample(*(inLeft++)) + quarterSample(*(inRight++));
-			}
+		while (numSamples > 0) {
+			const Bit32u count = numSamples < BLOCK_SIZE ? numSamples : BLOCK_SIZE;
 
-			// Looks like dryAmp doesn't change in MT-32 but it does in CM-32L / LAPC-I
-			dry = weirdMul(addDCBias(dry), dryAmp, 0xFF);
+			produceDryBlock(inLeft, inRight, dry, count, tapDelayMode, dryAmp);
+			inLeft += count;
+			inRight += count;
 
 			if (tapDelayMode) {
 				TapDelayCombFilter<Sample> *comb = static_cast<TapDelayCombFilter<Sample> *>(*combs);
-				comb->process(dry);
+				for (Bit32u i = 0; i < count; i++) {
+					comb->process(dry[i]);
+					outL[0][i] = comb->getLeftOutput();
+					outR[0][i] = comb->getRightOutput();
+				}
 				if (outLeft != NULL) {
-					*(outLeft++) = weirdMul(comb->getLeftOutput(), wetLevel, 0xFF);
+					produceTapDelayWetBlock(outL[0], outLeft, count, wetLevel);
+					outLeft += count;
 				}
 				if (outRight != NULL) {
-					*(outRight++) = weirdMul(comb->getRightOutput(), wetLevel, 0xFF);
+					produceTapDelayWetBlock(outR[0], outRight, count, wetLevel);
+					outRight += count;
 				}
 			} else {
 				DelayWithLowPassFilter<Sample> * const entranceDelay = static_cast<DelayWithLowPassFilter<Sample> *>(combs[0]);
-				// If the output position is equal to the comb size, get it now in order not to loose it
-				Sample link = entranceDelay->getOutputAt(currentSettings.combSizes[0] - 1);
+				for (Bit32u i = 0; i < count; i++) {
+					// If the output position is equal to the comb size, get it now in order not to loose it
+					Sample link = entranceDelay->getOutputAt(currentSettings.combSizes[0] - 1);
 
-				// Entrance LPF. Note, comb.process() differs a bit here.
-				entranceDelay->process(dry);
+					// Entrance LPF. Note, comb.process() differs a bit here.
+					entranceDelay->process(dry[i]);
 
-				link = allpasses[0]->process(addAllpassNoise(link));
-				link = allpasses[1]->process(link);
-				link = allpasses[2]->process(link);
+					link = allpasses[0]->process(addAllpassNoise(link));
+					link = allpasses[1]->process(link);
+					link = allpasses[2]->process(link);
 
-				// If the output position is equal to the comb size, get it now in order not to loose it
-				Sample outL1 = combs[1]->getOutputAt(currentSettings.outLPositions[0] - 1);
+					// If the output position is equal to the comb size, get it now in order not to loose it
+					outL[0][i] = combs[1]->getOutputAt(currentSettings.outLPositions[0] - 1);
 
-				combs[1]->process(link);
-				combs[2]->process(link);
-				combs[3]->process(link);
+					combs[1]->process(link);
+					combs[2]->process(link);
+					combs[3]->process(link);
+
+					outL[1][i] = combs[2]->getOutputAt(currentSettings.outLPositions[1]);
+					outL[2][i] = combs[3]->getOutputAt(currentSettings.outLPositions[2]);
+					outR[0][i] = combs[1]->getOutputAt(currentSettings.outRPositions[0]);
+					outR[1][i] = combs[2]->getOutputAt(currentSettings.outRPositions[1]);
+					outR[2][i] = combs[3]->getOutputAt(currentSettings.outRPositions[2]);
+				}
 
 				if (outLeft != NULL) {
-					Sample outL2 = combs[2]->getOutputAt(currentSettings.outLPositions[1]);
-					Sample outL3 = combs[3]->getOutputAt(currentSettings.outLPositions[2]);
-					Sample outSample = mixCombs(outL1, outL2, outL3);
-					*(outLeft++) = weirdMul(outSample, wetLevel, 0xFF);
+					produceWetBlock(outL[0], outL[1], outL[2], outLeft, count, wetLevel);
+					outLeft += count;
 				}
 				if (outRight != NULL) {
-					Sample outR1 = combs[1]->getOutputAt(currentSettings.outRPositions[0]);
-					Sample outR2 = combs[2]->getOutputAt(currentSettings.outRPositions[1]);
-					Sample outR3 = combs[3]->getOutputAt(currentSettings.outRPositions[2]);
-					Sample outSample = mixCombs(outR1, outR2, outR3);
-					*(outRight++) = weirdMul(outSample, wetLevel, 0xFF);
+					produceWetBlock(outR[0], outR[1], outR[2], outRight, count, wetLevel);
+					outRight += count;
 				}
 			} // if (tapDelayMode)
-		} // while ((numSamples--) > 0)
+
+			numSamples -= count;
+		} // while (numSamples > 0)
 	} // produceOutput
 
 	bool process(const IntSample *inLeft, const IntSample *inRight, IntSample *outLeft, IntSample *outRight, Bit32u numSamples);
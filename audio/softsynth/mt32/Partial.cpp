@@ -29,8 +29,17 @@
 #include "TVF.h"
 #include "TVP.h"
 
+#if MT32EMU_USE_SSE2
+#include <emmintrin.h>
+#elif MT32EMU_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace MT32Emu {
 
+// Partials are rendered in blocks of this many samples, which are then panned and mixed into the output buffers in one go
+static const Bit32u BLOCK_SIZE = 64;
+
 static const Bit8u PAN_NUMERATOR_MASTER[] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7};
 static const Bit8u PAN_NUMERATOR_SLAVE[]  = {0, 1, 2, 3, 4, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7};
 
@@ -334,9 +343,7 @@ bool Partial::generateNextSample(LA32PairImpl *la32PairImpl) {
 	return true;
 }
 
-void Partial::produceAndMixSample(IntSample *&leftBuf, IntSample *&rightBuf, LA32IntPartialPair *la32IntPair) {
-	IntSampleEx sample = la32IntPair->nextOutSample();
-
+void Partial::mixBlock(const IntSample *block, IntSample *leftBuf, IntSample *rightBuf, Bit32u count) {
 	// FIXME: LA32 may produce distorted sound in case if the absolute value of maximal amplitude of the input exceeds 8191
 	// when the panning value is non-zero. Most probably the distortion occurs in the same way it does with ring modulation,
 	// and it seems to be caused by limited precision of the common multiplication circuit.
@@ -344,18 +351,40 @@ void Partial::produceAndMixSample(IntSample *&leftBuf, IntSample *&rightBuf, LA3
 	// by subtraction of the left channel output from the input.
 	// Though, it is unknown whether this overflow is exploited somewhere.
 
-	IntSampleEx leftOut = ((sample * leftPanValue) >> 13) + IntSampleEx(*leftBuf);
-	IntSampleEx rightOut = ((sample * rightPanValue) >> 13) + IntSampleEx(*rightBuf);
-	*(leftBuf++) = Synth::clipSampleEx(leftOut);
-	*(rightBuf++) = Synth::clipSampleEx(rightOut);
+	for (Bit32u i = 0; i < count; i++) {
+		IntSampleEx sample = block[i];
+		IntSampleEx leftOut = ((sample * leftPanValue) >> 13) + IntSampleEx(leftBuf[i]);
+		IntSampleEx rightOut = ((sample * rightPanValue) >> 13) + IntSampleEx(rightBuf[i]);
+		leftBuf[i] = Synth::clipSampleEx(leftOut);
+		rightBuf[i] = Synth::clipSampleEx(rightOut);
+	}
 }
 
-void Partial::produceAndMixSample(FloatSample *&leftBuf, FloatSample *&rightBuf, LA32FloatPartialPair *la32FloatPair) {
-	FloatSample sample = la32FloatPair->nextOutSample();
-	FloatSample leftOut = (sample * leftPanValue) / 14.0f;
-	FloatSample rightOut = (sample * rightPanValue) / 14.0f;
-	*(leftBuf++) += leftOut;
-	*(rightBuf++) += rightOut;
+void Partial::mixBlock(const FloatSample *block, FloatSample *leftBuf, FloatSample *rightBuf, Bit32u count) {
+	Bit32u i = 0;
+#if MT32EMU_USE_SSE2
+	const __m128 leftPan = _mm_set1_ps(FloatSample(leftPanValue));
+	const __m128 rightPan = _mm_set1_ps(FloatSample(rightPanValue));
+	const __m128 divisor = _mm_set1_ps(14.0f);
+	for (; i + 4 <= count; i += 4) {
+		const __m128 sample = _mm_loadu_ps(block + i);
+		_mm_storeu_ps(leftBuf + i, _mm_add_ps(_mm_loadu_ps(leftBuf + i), _mm_div_ps(_mm_mul_ps(sample, leftPan), divisor)));
+		_mm_storeu_ps(rightBuf + i, _mm_add_ps(_mm_loadu_ps(rightBuf + i), _mm_div_ps(_mm_mul_ps(sample, rightPan), divisor)));
+	}
+#elif MT32EMU_USE_NEON
+	// NEON has no vector division, so the pan factors are scaled in advance
+	const float32x4_t leftPan = vdupq_n_f32(FloatSample(leftPanValue) / 14.0f);
+	const float32x4_t rightPan = vdupq_n_f32(FloatSample(rightPanValue) / 14.0f);
+	for (; i + 4 <= count; i += 4) {
+		const float32x4_t sample = vld1q_f32(block + i);
+		vst1q_f32(leftBuf + i, vaddq_f32(vld1q_f32(leftBuf + i), vmulq_f32(sample, leftPan)));
+		vst1q_f32(rightBuf + i, vaddq_f32(vld1q_f32(rightBuf + i), vmulq_f32(sample, rightPan)));
+	}
+#endif
+	for (; i < count; i++) {
+		leftBuf[i] += (block[i] * leftPanValue) / 14.0f;
+		rightBuf[i] += (block[i] * rightPanValue) / 14.0f;
+	}
 }
 
 template <class Sample, class LA32PairImpl>
@@ -363,9 +392,20 @@ bool Partial::doProduceOutput(Sample *leftBuf, Sample *rightBuf, Bit32u length,
 	if (!canProduceOutput()) return false;
 	alreadyOutputed = true;
 
-	for (sampleNum = 0; sampleNum < length; sampleNum++) {
-		if (!generateNextSample(la32PairImpl)) break;
-		produceAndMixSample(leftBuf, rightBuf, la32PairImpl);
+	Sample block[BLOCK_SIZE];
+	sampleNum = 0;
+	while (sampleNum < length) {
+		const Bit32u blockEnd = (length - sampleNum < BLOCK_SIZE) ? length : sampleNum + BLOCK_SIZE;
+		Bit32u count = 0;
+		while (sampleNum < blockEnd) {
+			if (!generateNextSample(la32PairImpl)) break;
+			block[count++] = la32PairImpl->nextOutSample();
+			sampleNum++;
+		}
+		mixBlock(block, leftBuf, rightBuf, count);
+		if (sampleNum < blockEnd) break;
+		leftBuf += count;
+		rightBuf += count;
 	}
 	sampleNum = 0;
 	return true;
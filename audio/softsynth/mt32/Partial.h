@@ -87,8 +87,8 @@ private:
 	bool canProduceOutput();
 	template <class LA32PairImpl>
 	bool generateNextSample(LA32PairImpl *la32PairImpl);
-	void produceAndMixSample(IntSample *&leftBuf, IntSample *&rightBuf, LA32IntPartialPair *la32IntPair);
-	void produceAndMixSample(FloatSample *&leftBuf, FloatSample *&rightBuf, LA32FloatPartialPair *la32FloatPair);
+	void mixBlock(const IntSample *block, IntSample *leftBuf, IntSample *rightBuf, Bit32u count);
+	void mixBlock(const FloatSample *block, FloatSample *leftBuf, FloatSample *rightBuf, Bit32u count);
 
 public:
 	bool alreadyOutputed;
@@ -93,6 +93,21 @@
 #define MT32EMU_BOSS_REVERB_PRECISE_MODE 0
 #endif
 
+// 0: Only use portable code in the block processing loops.
+// 1: Use SSE2 or NEON intrinsics in the block processing loops of the float renderer where the target supports them.
+//    The integer renderer always uses the portable code, so that its output stays bit-exact.
+#ifndef MT32EMU_USE_SIMD
+#define MT32EMU_USE_SIMD 1
+#endif
+
+#if MT32EMU_USE_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MT32EMU_USE_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MT32EMU_USE_NEON 1
+#endif
+#endif
+
 namespace MT32Emu {
 
 typedef Bit16s IntSample;
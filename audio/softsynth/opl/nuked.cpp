@@ -379,6 +379,14 @@ static void OPL3_EnvelopeCalc(opl3_slot *slot)
     Bit8u reset = 0;
     slot->eg_out = slot->eg_rout + (slot->reg_tl << 2)
                  + (slot->eg_ksl >> kslshift[slot->reg_ksl]) + *slot->trem;
+    // A released slot stays off until it is keyed on again. This is by far
+    // the most common state, so skip the rate calculation, which would
+    // leave the envelope unchanged anyway.
+    if (!slot->key && slot->eg_gen == envelope_gen_num_release && slot->eg_rout == 0x1ff)
+    {
+        slot->pg_reset = 0;
+        return;
+    }
     if (slot->key && slot->eg_gen == envelope_gen_num_release)
     {
         reset = 1;
@@ -531,7 +539,6 @@ static void OPL3_PhaseGenerate(opl3_slot *slot)
     Bit16u f_num;
     Bit32u basefreq;
     Bit8u rm_xor, n_bit;
-    Bit32u noise;
     Bit16u phase;
 
     chip = slot->chip;
@@ -568,7 +575,11 @@ static void OPL3_PhaseGenerate(opl3_slot *slot)
     }
     slot->pg_phase += (basefreq * mt[slot->reg_mult]) >> 1;
     // Rhythm mode
-    noise = chip->noise;
+    // The noise generator is clocked once for every slot. chip->noise holds
+    // its state at the start of the sample, and OPL3_Generate() clocks it for
+    // all the slots at once, so the noise bit seen by this slot has only moved
+    // down by slot_num positions.
+    n_bit = (chip->noise >> slot->slot_num) & 0x01;
     slot->pg_phase_out = phase;
     if (slot->slot_num == 13) // hh
     {
@@ -591,7 +602,7 @@ static void OPL3_PhaseGenerate(opl3_slot *slot)
         {
         case 13: // hh
             slot->pg_phase_out = rm_xor << 9;
-            if (rm_xor ^ (noise & 1))
+            if (rm_xor ^ n_bit)
             {
                 slot->pg_phase_out |= 0xd0;
             }
@@ -602,7 +613,7 @@ static void OPL3_PhaseGenerate(opl3_slot *slot)
             break;
         case 16: // sd
             slot->pg_phase_out = (chip->rm_hh_bit8 << 9)
-                               | ((chip->rm_hh_bit8 ^ (noise & 1)) << 8);
+                               | ((chip->rm_hh_bit8 ^ n_bit) << 8);
             break;
         case 17: // tc
             slot->pg_phase_out = (rm_xor << 9) | 0x80;
@@ -611,8 +622,22 @@ static void OPL3_PhaseGenerate(opl3_slot *slot)
             break;
         }
     }
-    n_bit = ((noise >> 14) ^ noise) & 0x01;
-    chip->noise = (noise >> 1) | (n_bit << 22);
+}
+
+static void OPL3_NoiseGenerate(opl3_chip *chip)
+{
+    Bit32u noise = chip->noise;
+    Bit32u n_bits;
+    Bit8u ii;
+
+    // Clock the 23-bit LFSR once per slot. With the feedback tap at bit 14,
+    // the next 9 feedback bits only depend on the current state.
+    for (ii = 0; ii < 36 / 9; ii++)
+    {
+        n_bits = ((noise >> 14) ^ noise) & 0x1ff;
+        noise = (noise >> 9) | (n_bits << 14);
+    }
+    chip->noise = noise;
 }
 
 //
@@ -1115,6 +1140,8 @@ void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
         OPL3_SlotGenerate(&chip->slot[ii]);
     }
 
+    OPL3_NoiseGenerate(chip);
+
     if ((chip->timer & 0x3f) == 0x3f)
     {
         chip->tremolopos = (chip->tremolopos + 1) % 210;
@@ -1478,7 +1505,7 @@ byte OPL::read(int port) {
 }
 
 void OPL::generateSamples(int16*buffer, int length) {
-	OPL3_GenerateStream(&chip, (Bit16s*)buffer, (Bit16u)length / 2);
+	OPL3_GenerateStream(&chip, (Bit16s*)buffer, (Bit32u)length / 2);
 }
 
 }
@@ -25,6 +25,81 @@
 #include "common/config-manager.h"
 #include "common/system.h"
 
+namespace {
+
+/**
+ * A track stream whose first samples have been decoded in advance. It plays
+ * those, and then goes on with the source stream, which was left right
+ * behind them.
+ */
+class PrefetchedAudioStream : public Audio::SeekableAudioStream {
+public:
+	PrefetchedAudioStream(Audio::SeekableAudioStream *source, int16 *head, uint32 headSamples)
+		: _source(source), _head(head), _headSamples(headSamples), _pos(0), _sourceAtHeadEnd(true),
+		  _headEnd(0, headSamples / (source->isStereo() ? 2 : 1), source->getRate()) {
+	}
+
+	~PrefetchedAudioStream() {
+		delete[] _head;
+		delete _source;
+	}
+
+	int readBuffer(int16 *buffer, const int numSamples) {
+		int samples = 0;
+
+		if (_pos < _headSamples) {
+			samples = MIN<uint32>(numSamples, _headSamples - _pos);
+			memcpy(buffer, _head + _pos, samples * sizeof(int16));
+			_pos += samples;
+		}
+
+		if (samples < numSamples) {
+			const int read = _source->readBuffer(buffer + samples, numSamples - samples);
+			if (read > 0) {
+				samples += read;
+				_sourceAtHeadEnd = false;
+			}
+		}
+
+		return samples;
+	}
+
+	bool isStereo() const { return _source->isStereo(); }
+	int getRate() const { return _source->getRate(); }
+	bool endOfData() const { return _pos >= _headSamples && _source->endOfData(); }
+
+	Audio::Timestamp getLength() const { return _source->getLength(); }
+
+	bool seek(const Audio::Timestamp &where) {
+		if (where >= _headEnd) {
+			_pos = _headSamples;
+			_sourceAtHeadEnd = false;
+			return _source->seek(where);
+		}
+
+		_pos = where.convertToFramerate(getRate()).totalNumberOfFrames() * (isStereo() ? 2 : 1);
+
+		// Only seek the source if it has been read or seeked past the head
+		if (!_sourceAtHeadEnd) {
+			if (!_source->seek(_headEnd))
+				return false;
+			_sourceAtHeadEnd = true;
+		}
+
+		return true;
+	}
+
+private:
+	Audio::SeekableAudioStream *_source;
+	int16 *_head;
+	const uint32 _headSamples;
+	uint32 _pos;				///< Position in the head, _headSamples once past it.
+	bool _sourceAtHeadEnd;		///< Whether _source is positioned right after the head.
+	const Audio::Timestamp _headEnd;
+};
+
+} // End of anonymous namespace
+
 DefaultAudioCDManager::DefaultAudioCDManager() {
 	_cd.playing = false;
 	_cd.track = 0;
@@ -36,6 +111,11 @@ DefaultAudioCDManager::DefaultAudioCDManager() {
 	_mixer = g_system->getMixer();
 	_emulating = false;
 	assert(_mixer);
+
+	_prefetched.track = -1;
+	_prefetched.file = 0;
+	_prefetched.factory = 0;
+	_prefetched.stream = 0;
 }
 
 DefaultAudioCDManager::~DefaultAudioCDManager() {
@@ -52,6 +132,7 @@ bool DefaultAudioCDManager::open() {
 void DefaultAudioCDManager::close() {
 	// Only need to stop for emulation
 	stop();
+	freePrefetchedTrack();
 }
 
 bool DefaultAudioCDManager::play(int track, int numLoops, int startFrame, int duration, bool onlyEmulate,
@@ -67,13 +148,9 @@ bool DefaultAudioCDManager::play(int track, int numLoops, int startFrame, int du
 		// Try to load the track from a compressed data file, and if found, use
 		// that. If not found, attempt to start regular Audio CD playback of
 		// the requested track.
-		char trackName[2][16];
-		sprintf(trackName[0], "track%d", track);
-		sprintf(trackName[1], "track%02d", track);
-		Audio::SeekableAudioStream *stream = 0;
-
-		for (int i = 0; !stream && i < 2; ++i)
-			stream = Audio::SeekableAudioStream::openStreamFile(trackName[i]);
+		Audio::SeekableAudioStream *stream = takePrefetchedTrack(track);
+		if (!stream)
+			stream = openTrack(track);
 
 		if (stream != 0) {
 			Audio::Timestamp start = Audio::Timestamp(0, startFrame, 75);
@@ -87,6 +164,8 @@ bool DefaultAudioCDManager::play(int track, int numLoops, int startFrame, int du
 			_emulating = true;
 			_mixer->playStream(soundType, &_handle,
 			                        Audio::makeLoopingAudioStream(stream, start, end, (numLoops < 1) ? numLoops + 1 : numLoops), -1, _cd.volume, _cd.balance);
+
+			prefetchTrack(track + 1);
 			return true;
 		}
 	}
@@ -164,3 +243,84 @@ bool DefaultAudioCDManager::openRealCD() {
 	return openCD(drive);
 }
 
+Common::SeekableReadStream *DefaultAudioCDManager::findTrack(int track, Audio::SeekableAudioStream::StreamFactory &factory) {
+	char trackName[2][16];
+	sprintf(trackName[0], "track%d", track);
+	sprintf(trackName[1], "track%02d", track);
+	Common::SeekableReadStream *file = 0;
+
+	for (int i = 0; !file && i < 2; ++i)
+		file = Audio::SeekableAudioStream::findStreamFile(trackName[i], factory);
+
+	return file;
+}
+
+Audio::SeekableAudioStream *DefaultAudioCDManager::openTrack(int track) {
+	Audio::SeekableAudioStream::StreamFactory factory;
+	Common::SeekableReadStream *file = findTrack(track, factory);
+	return file ? factory(file, DisposeAfterUse::YES) : 0;
+}
+
+Audio::SeekableAudioStream *DefaultAudioCDManager::takePrefetchedTrack(int track) {
+	if (_prefetched.track != track)
+		return 0;
+
+	// The job has usually finished long ago
+	JobMan.wait(_prefetched.counter);
+
+	Audio::SeekableAudioStream *stream = _prefetched.stream;
+	_prefetched.stream = 0;
+	_prefetched.track = -1;
+	return stream;
+}
+
+void DefaultAudioCDManager::prefetchTrack(int track) {
+	// Decoding in advance only pays off if it does not block the caller
+	if (JobMan.getWorkerCount() == 0 || track == _prefetched.track)
+		return;
+
+	freePrefetchedTrack();
+
+	// Only the file lookup happens here, since the archives of the search
+	// manager must not be used from other threads. Creating the decoder,
+	// which parses the file, and decoding run in the background.
+	_prefetched.file = findTrack(track, _prefetched.factory);
+	if (!_prefetched.file)
+		return;
+
+	_prefetched.track = track;
+	JobMan.submit(prefetchProc, &_prefetched, _prefetched.counter);
+}
+
+void DefaultAudioCDManager::freePrefetchedTrack() {
+	if (_prefetched.track == -1)
+		return;
+
+	JobMan.wait(_prefetched.counter);
+
+	delete _prefetched.stream;
+	_prefetched.stream = 0;
+	_prefetched.track = -1;
+}
+
+void DefaultAudioCDManager::prefetchProc(void *param) {
+	PrefetchedTrack *prefetched = (PrefetchedTrack *)param;
+	Audio::SeekableAudioStream *source = prefetched->factory(prefetched->file, DisposeAfterUse::YES);
+	prefetched->file = 0;
+	if (!source)
+		return;
+
+	const int channels = source->isStereo() ? 2 : 1;
+	const int maxSamples = kPrefetchSeconds * source->getRate() * channels;
+	int16 *head = new int16[maxSamples];
+
+	int samples = 0;
+	while (samples < maxSamples && !source->endOfData()) {
+		const int read = source->readBuffer(head + samples, maxSamples - samples);
+		if (read <= 0)
+			break;
+		samples += read;
+	}
+
+	prefetched->stream = new PrefetchedAudioStream(source, head, samples);
+}
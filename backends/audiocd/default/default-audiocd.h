@@ -24,14 +24,22 @@
 #define BACKENDS_AUDIOCD_DEFAULT_H
 
 #include "backends/audiocd/audiocd.h"
+#include "audio/audiostream.h"
 #include "audio/mixer.h"
+#include "common/jobs.h"
 
 namespace Common {
+class SeekableReadStream;
 class String;
 } // End of namespace Common
 
 /**
  * The default audio cd manager. Implements emulation of audio cd playback.
+ *
+ * When a track starts, the file of the following one is looked up, and a
+ * background job creates its decoder and decodes its first seconds. Playing
+ * that track next then starts from the decoded samples instead of a cold
+ * decoder.
  */
 class DefaultAudioCDManager : public AudioCDManager {
 public:
@@ -74,6 +82,42 @@ protected:
 
 	Status _cd;
 	Audio::Mixer *_mixer;
+
+private:
+	enum {
+		/** How many seconds of the prefetched track are decoded in advance. */
+		kPrefetchSeconds = 2
+	};
+
+	/** A track looked up in advance, which a background job opens and partly decodes. */
+	struct PrefetchedTrack {
+		int track;									///< Track number, -1 if none is prefetched.
+		Common::SeekableReadStream *file;			///< Owned by the job until it creates the stream.
+		Audio::SeekableAudioStream::StreamFactory factory;
+		Audio::SeekableAudioStream *stream;			///< Only valid after waiting for counter.
+		Common::JobSystem::Counter counter;
+	};
+
+	PrefetchedTrack _prefetched;
+
+	/** Find the emulation file of a track. */
+	static Common::SeekableReadStream *findTrack(int track, Audio::SeekableAudioStream::StreamFactory &factory);
+
+	/** Open the emulation file of a track. */
+	static Audio::SeekableAudioStream *openTrack(int track);
+
+	/**
+	 * Return the prefetched stream of a track, and free the prefetch slot.
+	 * @return the stream, or 0 if the track has not been prefetched
+	 */
+	Audio::SeekableAudioStream *takePrefetchedTrack(int track);
+
+	/** Look up a track, and start opening and decoding it in the background. */
+	void prefetchTrack(int track);
+
+	void freePrefetchedTrack();
+
+	static void prefetchProc(void *param);
 };
 
 #endif
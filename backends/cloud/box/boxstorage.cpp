@@ -298,11 +298,15 @@ bool BoxStorage::uploadStreamSupported() {
 	return false;
 }
 
-Networking::Request *BoxStorage::streamFileById(Common::String id, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback) {
+Networking::Request *BoxStorage::streamFileById(Common::String id, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback, uint32 offset) {
 	if (callback) {
 		Common::String url = Common::String::format(BOX_API_FILES_CONTENT, id.c_str());
 		Common::String header = "Authorization: Bearer " + _token;
 		curl_slist *headersList = curl_slist_append(nullptr, header.c_str());
+		if (offset) {
+			Common::String range = Common::String::format("Range: bytes=%u-", offset);
+			headersList = curl_slist_append(headersList, range.c_str());
+		}
 		Networking::NetworkReadStream *stream = new Networking::NetworkReadStream(url.c_str(), headersList, "");
 		(*callback)(Networking::NetworkReadStreamResponse(nullptr, stream));
 	}
@@ -311,6 +315,10 @@ Networking::Request *BoxStorage::streamFileById(Common::String id, Networking::N
 	return nullptr;
 }
 
+bool BoxStorage::rangedDownloadSupported() {
+	return true;
+}
+
 Networking::Request *BoxStorage::info(StorageInfoCallback callback, Networking::ErrorCallback errorCallback) {
 	Networking::JsonCallback innerCallback = new Common::CallbackBridge<BoxStorage, StorageInfoResponse, Networking::JsonResponse>(this, &BoxStorage::infoInnerCallback, callback);
 	Networking::CurlJsonRequest *request = new BoxTokenRefresher(this, innerCallback, errorCallback, BOX_API_USERS_ME);
@@ -84,7 +84,10 @@ public:
 	virtual bool uploadStreamSupported();
 
 	/** Returns pointer to Networking::NetworkReadStream. */
-	virtual Networking::Request *streamFileById(Common::String path, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback);
+	virtual Networking::Request *streamFileById(Common::String path, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback, uint32 offset = 0);
+
+	/** Returns whether Storage supports streamFileById() with an offset. */
+	virtual bool rangedDownloadSupported();
 
 	/** Returns the StorageInfo struct. */
 	virtual Networking::Request *info(StorageInfoCallback callback, Networking::ErrorCallback errorCallback);
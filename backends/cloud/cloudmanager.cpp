@@ -91,7 +91,7 @@ void CloudManager::init() {
 	for (uint32 i = 0; i < kStorageTotal; ++i) {
 		Common::String name = getStorageConfigName(i);
 		StorageConfig config;
-		config.name = _(name);
+		config.name = name;
 		config.username = "";
 		config.lastSyncDate = "";
 		config.usedBytes = 0;
@@ -186,7 +186,7 @@ uint32 CloudManager::getStorageIndex() const {
 Common::StringArray CloudManager::listStorages() const {
 	Common::StringArray result;
 	for (uint32 i = 0; i < _storages.size(); ++i) {
-		result.push_back(_storages[i].name);
+		result.push_back(_(_storages[i].name));
 	}
 	return result;
 }
@@ -446,6 +446,13 @@ uint64 CloudManager::getDownloadSpeed() const {
 	return 0;
 }
 
+uint32 CloudManager::getDownloadTransfersNumber() const {
+	Storage *storage = getCurrentStorage();
+	if (storage)
+		return storage->getDownloadTransfersNumber();
+	return 0;
+}
+
 Common::String CloudManager::getDownloadRemoteDirectory() const {
 	Storage *storage = getCurrentStorage();
 	if (storage)
@@ -279,6 +279,9 @@ public:
 	/** Returns download speed of current download progress. */
 	uint64 getDownloadSpeed() const;
 
+	/** Returns the number of files being downloaded at the same time in current download progress. */
+	uint32 getDownloadTransfersNumber() const;
+
 	/** Returns remote directory path. */
 	Common::String getDownloadRemoteDirectory() const;
 
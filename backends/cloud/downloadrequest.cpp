@@ -26,8 +26,8 @@
 
 namespace Cloud {
 
-DownloadRequest::DownloadRequest(Storage *storage, Storage::BoolCallback callback, Networking::ErrorCallback ecb, Common::String remoteFileId, Common::DumpFile *dumpFile):
-	Request(nullptr, ecb), _boolCallback(callback), _localFile(dumpFile), _remoteFileId(remoteFileId), _storage(storage),
+DownloadRequest::DownloadRequest(Storage *storage, Storage::BoolCallback callback, Networking::ErrorCallback ecb, Common::String remoteFileId, Common::DumpFile *dumpFile, uint32 offset):
+	Request(nullptr, ecb), _boolCallback(callback), _localFile(dumpFile), _remoteFileId(remoteFileId), _offset(offset), _storage(storage),
 	_remoteFileStream(nullptr), _workingRequest(nullptr), _ignoreCallback(false), _buffer(new byte[DOWNLOAD_REQUEST_BUFFER_SIZE]) {
 	start();
 }
@@ -52,7 +52,8 @@ void DownloadRequest::start() {
 	_workingRequest = _storage->streamFileById(
 		_remoteFileId,
 		new Common::Callback<DownloadRequest, Networking::NetworkReadStreamResponse>(this, &DownloadRequest::streamCallback),
-		new Common::Callback<DownloadRequest, Networking::ErrorResponse>(this, &DownloadRequest::streamErrorCallback)
+		new Common::Callback<DownloadRequest, Networking::ErrorResponse>(this, &DownloadRequest::streamErrorCallback),
+		_offset
 	);
 }
 
@@ -89,6 +90,15 @@ void DownloadRequest::handle() {
 	}
 
 	uint32 readBytes = _remoteFileStream->read(_buffer, DOWNLOAD_REQUEST_BUFFER_SIZE);
+	long expectedResponseCode = (_offset ? 206 : 200);
+
+	//a server which ignored the range sends the whole file, which must not be appended
+	if (_offset && (readBytes != 0 || _remoteFileStream->eos()) && _remoteFileStream->httpResponseCode() != expectedResponseCode) {
+		warning("DownloadRequest: can't resume download, HTTP response code is %ld", _remoteFileStream->httpResponseCode());
+		_localFile->close();
+		finishDownload(false);
+		return;
+	}
 
 	if (readBytes != 0)
 		if (_localFile->write(_buffer, readBytes) != readBytes) {
@@ -98,14 +108,14 @@ void DownloadRequest::handle() {
 		}
 
 	if (_remoteFileStream->eos()) {
-		if (_remoteFileStream->httpResponseCode() != 200) {
-			warning("DownloadRequest: HTTP response code is not 200 OK (it's %ld)", _remoteFileStream->httpResponseCode());
+		if (_remoteFileStream->httpResponseCode() != expectedResponseCode) {
+			warning("DownloadRequest: HTTP response code is not %ld (it's %ld)", expectedResponseCode, _remoteFileStream->httpResponseCode());
 			//TODO: do something about it actually
 			// the problem is file's already downloaded, stream is over
 			// so we can't return error message anymore
 		}
 
-		finishDownload(_remoteFileStream->httpResponseCode() == 200);
+		finishDownload(_remoteFileStream->httpResponseCode() == expectedResponseCode);
 
 		_localFile->close(); //yes, I know it's closed automatically in ~DumpFile()
 	}
@@ -36,6 +36,7 @@ class DownloadRequest: public Networking::Request {
 	Storage::BoolCallback _boolCallback;
 	Common::DumpFile *_localFile;
 	Common::String _remoteFileId;
+	uint32 _offset;
 	Storage *_storage;
 	Networking::NetworkReadStream *_remoteFileStream;
 	Request *_workingRequest;
@@ -49,13 +50,17 @@ class DownloadRequest: public Networking::Request {
 	virtual void finishError(Networking::ErrorResponse error);
 
 public:
-	DownloadRequest(Storage *storage, Storage::BoolCallback callback, Networking::ErrorCallback ecb, Common::String remoteFileId, Common::DumpFile *dumpFile);
+	/**
+	 * If <offset> is given, the remote file is streamed from that byte on,
+	 * to be appended to <dumpFile>.
+	 */
+	DownloadRequest(Storage *storage, Storage::BoolCallback callback, Networking::ErrorCallback ecb, Common::String remoteFileId, Common::DumpFile *dumpFile, uint32 offset = 0);
 	virtual ~DownloadRequest();
 
 	virtual void handle();
 	virtual void restart();
 
-	/** Returns a number in range [0, 1], where 1 is "complete". */
+	/** Returns a number in range [0, 1], where 1 is "complete". Only counts the streamed part. */
 	double getProgress() const;
 };
 
@@ -35,9 +35,9 @@ namespace Dropbox {
 #define DROPBOX_API_LIST_FOLDER "https://api.dropboxapi.com/2/files/list_folder"
 #define DROPBOX_API_LIST_FOLDER_CONTINUE "https://api.dropboxapi.com/2/files/list_folder/continue"
 
-DropboxListDirectoryRequest::DropboxListDirectoryRequest(Common::String token, Common::String path, Storage::ListDirectoryCallback cb, Networking::ErrorCallback ecb, bool recursive):
-	Networking::Request(nullptr, ecb), _requestedPath(path), _requestedRecursive(recursive), _listDirectoryCallback(cb),
-	_token(token), _workingRequest(nullptr), _ignoreCallback(false) {
+DropboxListDirectoryRequest::DropboxListDirectoryRequest(Storage *storage, Common::String token, Common::String path, Storage::ListDirectoryCallback cb, Networking::ErrorCallback ecb, bool recursive):
+	Networking::Request(nullptr, ecb), _requestedPath(path), _requestedRecursive(recursive), _storage(storage), _listDirectoryCallback(cb),
+	_token(token), _listingChanges(false), _workingRequest(nullptr), _ignoreCallback(false) {
 	start();
 }
 
@@ -53,8 +53,29 @@ void DropboxListDirectoryRequest::start() {
 	if (_workingRequest)
 		_workingRequest->finish();
 	_files.clear();
+	_fileIndices.clear();
+	_listingChanges = false;
 	_ignoreCallback = false;
 
+	//only ask for the changes if the directory was listed before
+	Storage::CachedListing listing;
+	if (_storage && _storage->getCachedListing(_requestedPath, _requestedRecursive, listing)) {
+		_files = listing.files;
+		for (uint32 i = 0; i < _files.size(); ++i)
+			_fileIndices[_files[i].path()] = i;
+		_listingChanges = true;
+		requestNextPage(listing.cursor);
+		return;
+	}
+
+	startFullListing();
+}
+
+void DropboxListDirectoryRequest::startFullListing() {
+	_files.clear();
+	_fileIndices.clear();
+	_listingChanges = false;
+
 	Networking::JsonCallback callback = new Common::Callback<DropboxListDirectoryRequest, Networking::JsonResponse>(this, &DropboxListDirectoryRequest::responseCallback);
 	Networking::ErrorCallback failureCallback = new Common::Callback<DropboxListDirectoryRequest, Networking::ErrorResponse>(this, &DropboxListDirectoryRequest::errorCallback);
 	Networking::CurlJsonRequest *request = new Networking::CurlJsonRequest(callback, failureCallback, DROPBOX_API_LIST_FOLDER);
@@ -73,6 +94,22 @@ void DropboxListDirectoryRequest::start() {
 	_workingRequest = ConnMan.addRequest(request);
 }
 
+void DropboxListDirectoryRequest::requestNextPage(Common::String cursor) {
+	Networking::JsonCallback callback = new Common::Callback<DropboxListDirectoryRequest, Networking::JsonResponse>(this, &DropboxListDirectoryRequest::responseCallback);
+	Networking::ErrorCallback failureCallback = new Common::Callback<DropboxListDirectoryRequest, Networking::ErrorResponse>(this, &DropboxListDirectoryRequest::errorCallback);
+	Networking::CurlJsonRequest *request = new Networking::CurlJsonRequest(callback, failureCallback, DROPBOX_API_LIST_FOLDER_CONTINUE);
+	request->addHeader("Authorization: Bearer " + _token);
+	request->addHeader("Content-Type: application/json");
+
+	Common::JSONObject jsonRequestParameters;
+	jsonRequestParameters.setVal("cursor", new Common::JSONValue(cursor));
+
+	Common::JSONValue value(jsonRequestParameters);
+	request->addPostField(Common::JSON::stringify(&value));
+
+	_workingRequest = ConnMan.addRequest(request);
+}
+
 void DropboxListDirectoryRequest::responseCallback(Networking::JsonResponse response) {
 	_workingRequest = nullptr;
 
@@ -107,7 +144,18 @@ void DropboxListDirectoryRequest::responseCallback(Networking::JsonResponse resp
 
 	if (responseObject.contains("error") || responseObject.contains("error_summary")) {
 		if (responseObject.contains("error_summary") && responseObject.getVal("error_summary")->isString()) {
-			warning("Dropbox returned error: %s", responseObject.getVal("error_summary")->asString().c_str());
+			Common::String summary = responseObject.getVal("error_summary")->asString();
+
+			//the cursor has expired, so the directory has to be listed again
+			if (_listingChanges && summary.hasPrefix("reset")) {
+				debug(9, "DropboxListDirectoryRequest: cursor of '%s' expired", _requestedPath.c_str());
+				_storage->uncacheListing(_requestedPath, _requestedRecursive);
+				startFullListing();
+				delete json;
+				return;
+			}
+
+			warning("Dropbox returned error: %s", summary.c_str());
 		}
 		error.failed = true;
 		error.response = json->stringify();
@@ -141,7 +189,15 @@ void DropboxListDirectoryRequest::responseCallback(Networking::JsonResponse resp
 				continue;
 
 			Common::String path = item.getVal("path_lower")->asString();
-			bool isDirectory = (item.getVal(".tag")->asString() == "folder");
+			Common::String tag = item.getVal(".tag")->asString();
+			if (tag == "deleted") {
+				//only reported when listing changes
+				if (_listingChanges)
+					applyChange(StorageFile(path, 0, 0, false), true);
+				continue;
+			}
+
+			bool isDirectory = (tag == "folder");
 			uint32 size = 0, timestamp = 0;
 			if (!isDirectory) {
 				if (!Networking::CurlJsonRequest::jsonContainsString(item, "server_modified", "DropboxListDirectoryRequest"))
@@ -152,7 +208,10 @@ void DropboxListDirectoryRequest::responseCallback(Networking::JsonResponse resp
 				size = item.getVal("size")->asIntegerNumber();
 				timestamp = ISO8601::convertToTimestamp(item.getVal("server_modified")->asString());
 			}
-			_files.push_back(StorageFile(path, size, timestamp, isDirectory));
+			if (_listingChanges)
+				applyChange(StorageFile(path, size, timestamp, isDirectory), false);
+			else
+				_files.push_back(StorageFile(path, size, timestamp, isDirectory));
 		}
 	}
 
@@ -178,20 +237,18 @@ void DropboxListDirectoryRequest::responseCallback(Networking::JsonResponse resp
 			return;
 		}
 
-		Networking::JsonCallback callback = new Common::Callback<DropboxListDirectoryRequest, Networking::JsonResponse>(this, &DropboxListDirectoryRequest::responseCallback);
-		Networking::ErrorCallback failureCallback = new Common::Callback<DropboxListDirectoryRequest, Networking::ErrorResponse>(this, &DropboxListDirectoryRequest::errorCallback);
-		Networking::CurlJsonRequest *request = new Networking::CurlJsonRequest(callback, failureCallback, DROPBOX_API_LIST_FOLDER_CONTINUE);
-		request->addHeader("Authorization: Bearer " + _token);
-		request->addHeader("Content-Type: application/json");
-
-		Common::JSONObject jsonRequestParameters;
-		jsonRequestParameters.setVal("cursor", new Common::JSONValue(responseObject.getVal("cursor")->asString()));
-
-		Common::JSONValue value(jsonRequestParameters);
-		request->addPostField(Common::JSON::stringify(&value));
-
-		_workingRequest = ConnMan.addRequest(request);
+		requestNextPage(responseObject.getVal("cursor")->asString());
 	} else {
+		//the last cursor is the one to ask for the changes with next time
+		if (_storage && responseObject.contains("cursor") && responseObject.getVal("cursor")->isString()) {
+			Storage::CachedListing listing;
+			listing.path = _requestedPath;
+			listing.recursive = _requestedRecursive;
+			listing.cursor = responseObject.getVal("cursor")->asString();
+			listing.files = _files;
+			_storage->cacheListing(listing);
+		}
+
 		finishListing(_files);
 	}
 
@@ -207,12 +264,45 @@ void DropboxListDirectoryRequest::errorCallback(Networking::ErrorResponse error)
 	finishError(error);
 }
 
+void DropboxListDirectoryRequest::applyChange(const StorageFile &file, bool deleted) {
+	if (deleted) {
+		//a deleted folder takes everything inside with it
+		Common::String prefix = file.path() + "/";
+		for (uint32 i = 0; i < _files.size();) {
+			if (_files[i].path() == file.path() || _files[i].path().hasPrefix(prefix))
+				_files.remove_at(i);
+			else
+				++i;
+		}
+
+		_fileIndices.clear();
+		for (uint32 i = 0; i < _files.size(); ++i)
+			_fileIndices[_files[i].path()] = i;
+		return;
+	}
+
+	Common::HashMap<Common::String, uint32>::const_iterator i = _fileIndices.find(file.path());
+	if (i != _fileIndices.end()) {
+		_files[i->_value] = file;
+	} else {
+		_fileIndices[file.path()] = _files.size();
+		_files.push_back(file);
+	}
+}
+
 void DropboxListDirectoryRequest::handle() {}
 
 void DropboxListDirectoryRequest::restart() { start(); }
 
 Common::String DropboxListDirectoryRequest::date() const { return _date; }
 
+void DropboxListDirectoryRequest::finishError(Networking::ErrorResponse error) {
+	//the listing the changes were to be applied to might be wrong
+	if (_listingChanges)
+		_storage->uncacheListing(_requestedPath, _requestedRecursive);
+	Request::finishError(error);
+}
+
 void DropboxListDirectoryRequest::finishListing(Common::Array<StorageFile> &files) {
 	Request::finishSuccess();
 	if (_listDirectoryCallback)
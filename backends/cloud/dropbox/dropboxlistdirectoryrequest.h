@@ -26,28 +26,41 @@
 #include "backends/cloud/storage.h"
 #include "backends/networking/curl/request.h"
 #include "common/callback.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "backends/networking/curl/curljsonrequest.h"
 
 namespace Cloud {
 namespace Dropbox {
 
+/**
+ * Lists a directory. If the storage has a cached listing of it, only the
+ * changes since are fetched, using the cursor of that listing.
+ */
 class DropboxListDirectoryRequest: public Networking::Request {
 	Common::String _requestedPath;
 	bool _requestedRecursive;
 
+	Storage *_storage;
 	Storage::ListDirectoryCallback _listDirectoryCallback;
 	Common::String _token;
 	Common::Array<StorageFile> _files;
+	Common::HashMap<Common::String, uint32> _fileIndices; //by path, only used when applying changes
+	bool _listingChanges;
 	Request *_workingRequest;
 	bool _ignoreCallback;
 	Common::String _date;
 
 	void start();
+	void startFullListing();
+	void requestNextPage(Common::String cursor);
 	void responseCallback(Networking::JsonResponse response);
 	void errorCallback(Networking::ErrorResponse error);
+	void applyChange(const StorageFile &file, bool deleted);
 	void finishListing(Common::Array<StorageFile> &files);
+	virtual void finishError(Networking::ErrorResponse error);
 public:
-	DropboxListDirectoryRequest(Common::String token, Common::String path, Storage::ListDirectoryCallback cb, Networking::ErrorCallback ecb, bool recursive = false);
+	DropboxListDirectoryRequest(Storage *storage, Common::String token, Common::String path, Storage::ListDirectoryCallback cb, Networking::ErrorCallback ecb, bool recursive = false);
 	virtual ~DropboxListDirectoryRequest();
 
 	virtual void handle();
@@ -132,6 +132,7 @@ void DropboxStorage::codeFlowFailed(Networking::ErrorResponse error) {
 void DropboxStorage::saveConfig(Common::String keyPrefix) {
 	ConfMan.set(keyPrefix + "access_token", _token, ConfMan.kCloudDomain);
 	ConfMan.set(keyPrefix + "user_id", _uid, ConfMan.kCloudDomain);
+	saveListingCache(keyPrefix);
 }
 
 Common::String DropboxStorage::name() const {
@@ -139,14 +140,14 @@ Common::String DropboxStorage::name() const {
 }
 
 Networking::Request *DropboxStorage::listDirectory(Common::String path, ListDirectoryCallback outerCallback, Networking::ErrorCallback errorCallback, bool recursive) {
-	return addRequest(new DropboxListDirectoryRequest(_token, path, outerCallback, errorCallback, recursive));
+	return addRequest(new DropboxListDirectoryRequest(this, _token, path, outerCallback, errorCallback, recursive));
 }
 
 Networking::Request *DropboxStorage::upload(Common::String path, Common::SeekableReadStream *contents, UploadCallback callback, Networking::ErrorCallback errorCallback) {
 	return addRequest(new DropboxUploadRequest(_token, path, contents, callback, errorCallback));
 }
 
-Networking::Request *DropboxStorage::streamFileById(Common::String path, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback) {
+Networking::Request *DropboxStorage::streamFileById(Common::String path, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback, uint32 offset) {
 	Common::JSONObject jsonRequestParameters;
 	jsonRequestParameters.setVal("path", new Common::JSONValue(path));
 	Common::JSONValue value(jsonRequestParameters);
@@ -155,6 +156,8 @@ Networking::Request *DropboxStorage::streamFileById(Common::String path, Network
 	request->addHeader("Authorization: Bearer " + _token);
 	request->addHeader("Dropbox-API-Arg: " + Common::JSON::stringify(&value));
 	request->addHeader("Content-Type: "); //required to be empty (as we do POST, it's usually app/form-url-encoded)
+	if (offset)
+		request->addHeader(Common::String::format("Range: bytes=%u-", offset));
 
 	Networking::NetworkReadStreamResponse response = request->execute();
 	if (callback)
@@ -162,6 +165,10 @@ Networking::Request *DropboxStorage::streamFileById(Common::String path, Network
 	return response.request; // no leak here, response.request == request
 }
 
+bool DropboxStorage::rangedDownloadSupported() {
+	return true;
+}
+
 Networking::Request *DropboxStorage::createDirectory(Common::String path, BoolCallback callback, Networking::ErrorCallback errorCallback) {
 	if (!errorCallback)
 		errorCallback = getErrorPrintingCallback();
@@ -192,7 +199,9 @@ DropboxStorage *DropboxStorage::loadFromConfig(Common::String keyPrefix) {
 	Common::String accessToken = ConfMan.get(keyPrefix + "access_token", ConfMan.kCloudDomain);
 	Common::String userId = ConfMan.get(keyPrefix + "user_id", ConfMan.kCloudDomain);
 
-	return new DropboxStorage(accessToken, userId);
+	DropboxStorage *storage = new DropboxStorage(accessToken, userId);
+	storage->loadListingCache(keyPrefix);
+	return storage;
 }
 
 } // End of namespace Dropbox
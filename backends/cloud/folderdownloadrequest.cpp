@@ -23,7 +23,10 @@
 #include "backends/cloud/folderdownloadrequest.h"
 #include "backends/cloud/downloadrequest.h"
 #include "backends/cloud/id/iddownloadrequest.h"
+#include "common/config-manager.h"
 #include "common/debug.h"
+#include "common/fs.h"
+#include "common/stream.h"
 #include "gui/downloaddialog.h"
 #include <backends/networking/curl/connectionmanager.h>
 
@@ -32,7 +35,7 @@ namespace Cloud {
 FolderDownloadRequest::FolderDownloadRequest(Storage *storage, Storage::FileArrayCallback callback, Networking::ErrorCallback ecb, Common::String remoteDirectoryPath, Common::String localDirectoryPath, bool recursive):
 	Request(nullptr, ecb), CommandSender(nullptr), _storage(storage), _fileArrayCallback(callback),
 	_remoteDirectoryPath(remoteDirectoryPath), _localDirectoryPath(localDirectoryPath), _recursive(recursive),
-	_workingRequest(nullptr), _ignoreCallback(false), _totalFiles(0) {
+	_maxTransfers(FOLDER_DOWNLOAD_MAX_TRANSFERS), _workingRequest(nullptr), _ignoreCallback(false), _totalFiles(0) {
 	start();
 }
 
@@ -41,6 +44,7 @@ FolderDownloadRequest::~FolderDownloadRequest() {
 	_ignoreCallback = true;
 	if (_workingRequest)
 		_workingRequest->finish();
+	finishTransfers();
 	delete _fileArrayCallback;
 }
 
@@ -49,12 +53,17 @@ void FolderDownloadRequest::start() {
 	_ignoreCallback = true;
 	if (_workingRequest)
 		_workingRequest->finish();
-	_currentFile = StorageFile();
+	finishTransfers();
 	_pendingFiles.clear();
 	_failedFiles.clear();
+	_restartedFiles.clear();
 	_ignoreCallback = false;
 	_totalFiles = 0;
-	_downloadedBytes = _totalBytes = _wasDownloadedBytes = _currentDownloadSpeed = 0;
+	_downloadedBytes = _resumedBytes = _totalBytes = _wasDownloadedBytes = _currentDownloadSpeed = 0;
+
+	_maxTransfers = FOLDER_DOWNLOAD_MAX_TRANSFERS;
+	if (ConfMan.hasKey("download_transfers", ConfMan.kCloudDomain))
+		_maxTransfers = CLIP(ConfMan.getInt("download_transfers", ConfMan.kCloudDomain), 1, 16);
 
 	//list directory first
 	_workingRequest = _storage->listDirectory(
@@ -82,7 +91,7 @@ void FolderDownloadRequest::directoryListedCallback(Storage::ListDirectoryRespon
 		}
 
 	_totalFiles = _pendingFiles.size();
-	downloadNextFile();
+	startTransfers();
 }
 
 void FolderDownloadRequest::directoryListedErrorCallback(Networking::ErrorResponse error) {
@@ -93,36 +102,96 @@ void FolderDownloadRequest::directoryListedErrorCallback(Networking::ErrorRespon
 }
 
 void FolderDownloadRequest::fileDownloadedCallback(Storage::BoolResponse response) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
-	if (!response.value) _failedFiles.push_back(_currentFile);
-	_downloadedBytes += _currentFile.size();
-	downloadNextFile();
+
+	Transfer transfer = takeTransfer(response.request);
+	if (!transfer.request)
+		return;
+
+	if (!response.value && transfer.offset) {
+		//the partial file was not resumed, so download it anew
+		debug(9, "FolderDownloadRequest: can't resume %s, restarting it", transfer.file.path().c_str());
+		_restartedFiles[transfer.file.path()] = true;
+		_resumedBytes -= transfer.offset;
+		_pendingFiles.push_back(transfer.file);
+	} else {
+		if (!response.value)
+			_failedFiles.push_back(transfer.file);
+		_downloadedBytes += transfer.file.size();
+	}
+
+	startTransfers();
 }
 
 void FolderDownloadRequest::fileDownloadedErrorCallback(Networking::ErrorResponse error) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 	fileDownloadedCallback(Storage::BoolResponse(error.request, false));
 }
 
+void FolderDownloadRequest::startTransfers() {
+	while (!_pendingFiles.empty() && _transfers.size() < _maxTransfers)
+		downloadNextFile();
+
+	sendCommand(GUI::kDownloadProgressCmd, (int)(getProgress() * 100));
+
+	if (_transfers.empty()) {
+		sendCommand(GUI::kDownloadEndedCmd, 0);
+		finishDownload(_failedFiles);
+	}
+}
+
 void FolderDownloadRequest::downloadNextFile() {
-	do {
-		if (_pendingFiles.empty()) {
-			sendCommand(GUI::kDownloadEndedCmd, 0);
-			finishDownload(_failedFiles);
-			return;
+	Transfer transfer;
+	transfer.file = _pendingFiles.back();
+	transfer.offset = 0;
+	_pendingFiles.pop_back();
+
+	Common::String localPath = getLocalPath(transfer.file);
+
+	//continue an interrupted download
+	if (_storage->rangedDownloadSupported() && !_restartedFiles.contains(transfer.file.path())) {
+		Common::FSNode node(localPath);
+		if (node.exists() && !node.isDirectory()) {
+			Common::SeekableReadStream *stream = node.createReadStream();
+			if (stream) {
+				if (stream->size() > 0 && (uint32)stream->size() < transfer.file.size())
+					transfer.offset = stream->size();
+				delete stream;
+			}
 		}
+	}
 
-		_currentFile = _pendingFiles.back();
-		_pendingFiles.pop_back();
-	} while (_currentFile.isDirectory()); // directories are actually removed earlier, in the directoryListedCallback()
+	debug(9, "FolderDownloadRequest: %s -> %s (from %u)", transfer.file.path().c_str(), localPath.c_str(), transfer.offset);
 
-	sendCommand(GUI::kDownloadProgressCmd, (int)(getProgress() * 100));
+	//the Storage calls the error callback right away if it can't open the local file
+	_ignoreCallback = true;
+	transfer.request = _storage->downloadById(
+		transfer.file.id(), localPath,
+		new Common::Callback<FolderDownloadRequest, Storage::BoolResponse>(this, &FolderDownloadRequest::fileDownloadedCallback),
+		new Common::Callback<FolderDownloadRequest, Networking::ErrorResponse>(this, &FolderDownloadRequest::fileDownloadedErrorCallback),
+		transfer.offset
+	);
+	_ignoreCallback = false;
+
+	if (!transfer.request) {
+		if (transfer.offset) {
+			_restartedFiles[transfer.file.path()] = true;
+			_pendingFiles.push_back(transfer.file);
+		} else {
+			_failedFiles.push_back(transfer.file);
+			_downloadedBytes += transfer.file.size();
+		}
+		return;
+	}
 
-	Common::String remotePath = _currentFile.path();
+	_resumedBytes += transfer.offset;
+	_transfers.push_back(transfer);
+}
+
+Common::String FolderDownloadRequest::getLocalPath(const StorageFile &file) const {
+	Common::String remotePath = file.path();
 	Common::String localPath = remotePath;
 	if (_remoteDirectoryPath == "" || remotePath.hasPrefix(_remoteDirectoryPath)) {
 		localPath.erase(0, _remoteDirectoryPath.size());
@@ -139,19 +208,45 @@ void FolderDownloadRequest::downloadNextFile() {
 		else
 			localPath = _localDirectoryPath + "/" + localPath;
 	}
-	debug(9, "FolderDownloadRequest: %s -> %s", remotePath.c_str(), localPath.c_str());
-	_workingRequest = _storage->downloadById(
-		_currentFile.id(), localPath,
-		new Common::Callback<FolderDownloadRequest, Storage::BoolResponse>(this, &FolderDownloadRequest::fileDownloadedCallback),
-		new Common::Callback<FolderDownloadRequest, Networking::ErrorResponse>(this, &FolderDownloadRequest::fileDownloadedErrorCallback)
-	);
+	return localPath;
+}
+
+FolderDownloadRequest::Transfer FolderDownloadRequest::takeTransfer(Request *request) {
+	//errors might be reported with the Request which failed inside the download,
+	//but the download which failed is the only one which is finished and not taken yet
+	for (uint32 pass = 0; pass < 2; ++pass) {
+		for (uint32 i = 0; i < _transfers.size(); ++i) {
+			if (pass == 0 ? _transfers[i].request == request : _transfers[i].request->state() == Networking::FINISHED) {
+				Transfer transfer = _transfers[i];
+				_transfers.remove_at(i);
+				return transfer;
+			}
+		}
+	}
+
+	Transfer transfer;
+	transfer.request = nullptr;
+	transfer.offset = 0;
+	return transfer;
+}
+
+void FolderDownloadRequest::finishTransfers() {
+	//the callbacks must be ignored by the caller
+	for (uint32 i = 0; i < _transfers.size(); ++i) {
+		if (_transfers[i].request->state() != Networking::FINISHED)
+			_transfers[i].request->finish();
+	}
+	_transfers.clear();
 }
 
 void FolderDownloadRequest::handle() {
 	uint32 microsecondsPassed = Networking::ConnectionManager::getCloudRequestsPeriodInMicroseconds();
-	uint64 currentDownloadedBytes = getDownloadedBytes();
+	uint64 currentDownloadedBytes = getDownloadedBytes() - _resumedBytes;
 	uint64 downloadedThisPeriod = currentDownloadedBytes - _wasDownloadedBytes;
-	_currentDownloadSpeed = downloadedThisPeriod * (1000000L / microsecondsPassed);
+	if (currentDownloadedBytes < _wasDownloadedBytes)
+		downloadedThisPeriod = 0; //a resumption failed and its bytes were taken back
+	uint64 speed = downloadedThisPeriod * (1000000L / microsecondsPassed);
+	_currentDownloadSpeed = (_currentDownloadSpeed * 3 + speed) / 4;
 	_wasDownloadedBytes = currentDownloadedBytes;
 }
 
@@ -173,17 +268,22 @@ uint64 FolderDownloadRequest::getDownloadedBytes() const {
 	if (_totalFiles == 0)
 		return 0;
 
-	double currentFileProgress = 0;
-	DownloadRequest *downloadRequest = dynamic_cast<DownloadRequest *>(_workingRequest);
-	if (downloadRequest != nullptr) {
-		currentFileProgress = downloadRequest->getProgress();
-	} else {
-		Id::IdDownloadRequest *idDownloadRequest = dynamic_cast<Id::IdDownloadRequest *>(_workingRequest);
-		if (idDownloadRequest != nullptr)
-			currentFileProgress = idDownloadRequest->getProgress();
-	}
+	uint64 result = _downloadedBytes;
+	for (uint32 i = 0; i < _transfers.size(); ++i) {
+		const Transfer &transfer = _transfers[i];
+		double currentFileProgress = 0;
+		DownloadRequest *downloadRequest = dynamic_cast<DownloadRequest *>(transfer.request);
+		if (downloadRequest != nullptr) {
+			currentFileProgress = downloadRequest->getProgress();
+		} else {
+			Id::IdDownloadRequest *idDownloadRequest = dynamic_cast<Id::IdDownloadRequest *>(transfer.request);
+			if (idDownloadRequest != nullptr)
+				currentFileProgress = idDownloadRequest->getProgress();
+		}
 
-	return _downloadedBytes + (uint64)(currentFileProgress * _currentFile.size());
+		result += transfer.offset + (uint64)(currentFileProgress * (transfer.file.size() - transfer.offset));
+	}
+	return result;
 }
 
 uint64 FolderDownloadRequest::getTotalBytesToDownload() const {
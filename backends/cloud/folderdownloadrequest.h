@@ -25,28 +25,57 @@
 
 #include "backends/networking/curl/request.h"
 #include "backends/cloud/storage.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "gui/object.h"
 
 namespace Cloud {
 
+/**
+ * The number of files which are downloaded at the same time, unless the
+ * "download_transfers" key of the cloud domain says otherwise.
+ */
+#define FOLDER_DOWNLOAD_MAX_TRANSFERS 4
+
+/**
+ * Downloads all the files of a remote directory, several at a time.
+ *
+ * Files which are already partially on disk, from an interrupted download,
+ * are resumed where they stopped if the storage supports ranged downloads.
+ */
 class FolderDownloadRequest: public Networking::Request, public GUI::CommandSender {
 	Storage *_storage;
 	Storage::FileArrayCallback _fileArrayCallback;
 	Common::String _remoteDirectoryPath, _localDirectoryPath;
 	bool _recursive;
 	Common::Array<StorageFile> _pendingFiles, _failedFiles;
-	StorageFile _currentFile;
+
+	struct Transfer {
+		Request *request;
+		StorageFile file;
+		uint32 offset; //bytes which were on disk already
+	};
+
+	/** Files being downloaded right now. */
+	Common::Array<Transfer> _transfers;
+	uint32 _maxTransfers;
+	/** Remote paths of files whose resumption failed, these are downloaded anew. */
+	Common::HashMap<Common::String, bool> _restartedFiles;
 	Request *_workingRequest;
 	bool _ignoreCallback;
 	uint32 _totalFiles;
-	uint64 _downloadedBytes, _totalBytes, _wasDownloadedBytes, _currentDownloadSpeed;
+	uint64 _downloadedBytes, _resumedBytes, _totalBytes, _wasDownloadedBytes, _currentDownloadSpeed;
 
 	void start();
 	void directoryListedCallback(Storage::ListDirectoryResponse response);
 	void directoryListedErrorCallback(Networking::ErrorResponse error);
 	void fileDownloadedCallback(Storage::BoolResponse response);
 	void fileDownloadedErrorCallback(Networking::ErrorResponse error);
+	void startTransfers();
 	void downloadNextFile();
+	Common::String getLocalPath(const StorageFile &file) const;
+	Transfer takeTransfer(Request *request);
+	void finishTransfers();
 	void finishDownload(Common::Array<StorageFile> &files);
 public:
 	FolderDownloadRequest(Storage *storage, Storage::FileArrayCallback callback, Networking::ErrorCallback ecb, Common::String remoteDirectoryPath, Common::String localDirectoryPath, bool recursive);
@@ -64,9 +93,12 @@ public:
 	/** Returns a total number of bytes to download. */
 	uint64 getTotalBytesToDownload() const;
 
-	/** Returns average download speed for the last second. */
+	/** Returns the download speed of all the files together, averaged over the last few periods. */
 	uint64 getDownloadSpeed() const;
 
+	/** Returns the number of files being downloaded right now. */
+	uint32 getTransfersNumber() const { return _transfers.size(); }
+
 	/** Returns remote directory path. */
 	Common::String getRemotePath() const { return _remoteDirectoryPath; }
 
@@ -269,11 +269,15 @@ Networking::Request *GoogleDriveStorage::upload(Common::String path, Common::See
 	return addRequest(new GoogleDriveUploadRequest(this, path, contents, callback, errorCallback));
 }
 
-Networking::Request *GoogleDriveStorage::streamFileById(Common::String id, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback) {
+Networking::Request *GoogleDriveStorage::streamFileById(Common::String id, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback, uint32 offset) {
 	if (callback) {
 		Common::String url = Common::String::format(GOOGLEDRIVE_API_FILES_ALT_MEDIA, ConnMan.urlEncode(id).c_str());
 		Common::String header = "Authorization: Bearer " + _token;
 		curl_slist *headersList = curl_slist_append(nullptr, header.c_str());
+		if (offset) {
+			Common::String range = Common::String::format("Range: bytes=%u-", offset);
+			headersList = curl_slist_append(headersList, range.c_str());
+		}
 		Networking::NetworkReadStream *stream = new Networking::NetworkReadStream(url.c_str(), headersList, "");
 		(*callback)(Networking::NetworkReadStreamResponse(nullptr, stream));
 	}
@@ -282,6 +286,10 @@ Networking::Request *GoogleDriveStorage::streamFileById(Common::String id, Netwo
 	return nullptr;
 }
 
+bool GoogleDriveStorage::rangedDownloadSupported() {
+	return true;
+}
+
 void GoogleDriveStorage::printInfo(StorageInfoResponse response) {
 	debug(9, "\nGoogleDriveStorage: user info:");
 	debug(9, "\tname: %s", response.value.name().c_str());
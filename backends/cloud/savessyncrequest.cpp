@@ -22,6 +22,7 @@
 
 #include "backends/cloud/savessyncrequest.h"
 #include "backends/cloud/cloudmanager.h"
+#include "backends/cloud/downloadrequest.h"
 #include "backends/networking/curl/curljsonrequest.h"
 #include "backends/saves/default/default-saves.h"
 #include "common/config-manager.h"
@@ -36,7 +37,7 @@ namespace Cloud {
 
 SavesSyncRequest::SavesSyncRequest(Storage *storage, Storage::BoolCallback callback, Networking::ErrorCallback ecb):
 	Request(nullptr, ecb), CommandSender(nullptr), _storage(storage), _boolCallback(callback),
-	_workingRequest(nullptr), _ignoreCallback(false) {
+	_workingRequest(nullptr), _ignoreCallback(false), _uploading(false) {
 	start();
 }
 
@@ -44,6 +45,7 @@ SavesSyncRequest::~SavesSyncRequest() {
 	_ignoreCallback = true;
 	if (_workingRequest)
 		_workingRequest->finish();
+	finishTransfers();
 	delete _boolCallback;
 }
 
@@ -52,12 +54,13 @@ void SavesSyncRequest::start() {
 	_ignoreCallback = true;
 	if (_workingRequest)
 		_workingRequest->finish();
-	_currentDownloadingFile = StorageFile();
-	_currentUploadingFile = "";
+	finishTransfers();
 	_filesToDownload.clear();
 	_filesToUpload.clear();
 	_localFilesTimestamps.clear();
+	_uploading = false;
 	_totalFilesToHandle = 0;
+	_totalFilesToDownload = 0;
 	_ignoreCallback = false;
 
 	//load timestamps
@@ -135,9 +138,10 @@ void SavesSyncRequest::directoryListedCallback(Storage::ListDirectoryResponse re
 		debug(9, "%s", _filesToUpload[i].c_str());
 	}
 	_totalFilesToHandle = _filesToDownload.size() + _filesToUpload.size();
+	_totalFilesToDownload = _filesToDownload.size();
 
 	//start downloading files
-	downloadNextFile();
+	startTransfers();
 }
 
 void SavesSyncRequest::directoryListedErrorCallback(Networking::ErrorResponse error) {
@@ -226,54 +230,79 @@ void SavesSyncRequest::directoryCreatedErrorCallback(Networking::ErrorResponse e
 	finishError(error);
 }
 
-void SavesSyncRequest::downloadNextFile() {
-	if (_filesToDownload.empty()) {
-		_currentDownloadingFile = StorageFile("", 0, 0, false); //so getFilesToDownload() would return an empty array
+void SavesSyncRequest::startTransfers() {
+	//all the files are downloaded before uploading any,
+	//so the saves are unlocked as soon as possible
+	if (!_uploading) {
+		while (!_filesToDownload.empty() && _transfers.size() < SAVES_SYNC_MAX_TRANSFERS) {
+			if (!downloadNextFile())
+				return;
+		}
+		if (!_transfers.empty())
+			return;
+
+		_uploading = true; //so getFilesToDownload() would return an empty array
 		sendCommand(GUI::kSavesSyncEndedCmd, 0);
-		uploadNextFile();
-		return;
 	}
 
-	_currentDownloadingFile = _filesToDownload.back();
+	while (!_filesToUpload.empty() && _transfers.size() < SAVES_SYNC_MAX_TRANSFERS) {
+		if (!uploadNextFile())
+			return;
+	}
+	if (_transfers.empty())
+		finishSync(true);
+}
+
+bool SavesSyncRequest::downloadNextFile() {
+	Transfer transfer;
+	transfer.file = _filesToDownload.back();
 	_filesToDownload.pop_back();
 
 	sendCommand(GUI::kSavesSyncProgressCmd, (int)(getDownloadingProgress() * 100));
 
-	debug(9, "SavesSyncRequest: downloading %s (%d %%)", _currentDownloadingFile.name().c_str(), (int)(getProgress() * 100));
-	_workingRequest = _storage->downloadById(
-		_currentDownloadingFile.id(),
-		DefaultSaveFileManager::concatWithSavesPath(_currentDownloadingFile.name()),
+	debug(9, "SavesSyncRequest: downloading %s (%d %%)", transfer.file.name().c_str(), (int)(getProgress() * 100));
+	transfer.request = _storage->downloadById(
+		transfer.file.id(),
+		DefaultSaveFileManager::concatWithSavesPath(transfer.file.name()),
 		new Common::Callback<SavesSyncRequest, Storage::BoolResponse>(this, &SavesSyncRequest::fileDownloadedCallback),
 		new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileDownloadedErrorCallback)
 	);
-	if (!_workingRequest)
-		finishError(Networking::ErrorResponse(this));
+	if (!transfer.request) {
+		//the error callback might have stopped syncing already
+		if (_state != Networking::FINISHED)
+			finishError(Networking::ErrorResponse(this));
+		return false;
+	}
+
+	_transfers.push_back(transfer);
+	return true;
 }
 
 void SavesSyncRequest::fileDownloadedCallback(Storage::BoolResponse response) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
+	StorageFile file = takeTransfer(response.request);
+
 	//stop syncing if download failed
 	if (!response.value) {
 		//delete the incomplete file
-		g_system->getSavefileManager()->removeSavefile(_currentDownloadingFile.name());
+		if (file.name() != "")
+			g_system->getSavefileManager()->removeSavefile(file.name());
 		finishError(Networking::ErrorResponse(this, false, true, "", -1));
 		return;
 	}
 
 	//update local timestamp for downloaded file
 	_localFilesTimestamps = DefaultSaveFileManager::loadTimestamps();
-	_localFilesTimestamps[_currentDownloadingFile.name()] = _currentDownloadingFile.timestamp();
+	_localFilesTimestamps[file.name()] = file.timestamp();
 	DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
 
 	//continue downloading files
-	downloadNextFile();
+	startTransfers();
 }
 
 void SavesSyncRequest::fileDownloadedErrorCallback(Networking::ErrorResponse error) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
@@ -281,50 +310,54 @@ void SavesSyncRequest::fileDownloadedErrorCallback(Networking::ErrorResponse err
 	finishError(error);
 }
 
-void SavesSyncRequest::uploadNextFile() {
-	if (_filesToUpload.empty()) {
-		finishSync(true);
-		return;
-	}
-
-	_currentUploadingFile = _filesToUpload.back();
+bool SavesSyncRequest::uploadNextFile() {
+	Transfer transfer;
+	transfer.file = StorageFile(_filesToUpload.back(), 0, 0, false);
 	_filesToUpload.pop_back();
 
-	debug(9, "SavesSyncRequest: uploading %s (%d %%)", _currentUploadingFile.c_str(), (int)(getProgress() * 100));
+	Common::String name = transfer.file.name();
+	debug(9, "SavesSyncRequest: uploading %s (%d %%)", name.c_str(), (int)(getProgress() * 100));
 	if (_storage->uploadStreamSupported()) {
-		_workingRequest = _storage->upload(
-			_storage->savesDirectoryPath() + _currentUploadingFile,
-			g_system->getSavefileManager()->openRawFile(_currentUploadingFile),
+		transfer.request = _storage->upload(
+			_storage->savesDirectoryPath() + name,
+			g_system->getSavefileManager()->openRawFile(name),
 			new Common::Callback<SavesSyncRequest, Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback),
 			new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback)
 		);
 	} else {
-		_workingRequest = _storage->upload(
-			_storage->savesDirectoryPath() + _currentUploadingFile,
-			DefaultSaveFileManager::concatWithSavesPath(_currentUploadingFile),
+		transfer.request = _storage->upload(
+			_storage->savesDirectoryPath() + name,
+			DefaultSaveFileManager::concatWithSavesPath(name),
 			new Common::Callback<SavesSyncRequest, Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback),
 			new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback)
 		);
 	}
-	if (!_workingRequest) finishError(Networking::ErrorResponse(this));
+	if (!transfer.request) {
+		if (_state != Networking::FINISHED)
+			finishError(Networking::ErrorResponse(this));
+		return false;
+	}
+
+	_transfers.push_back(transfer);
+	return true;
 }
 
 void SavesSyncRequest::fileUploadedCallback(Storage::UploadResponse response) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
+	StorageFile file = takeTransfer(response.request);
+
 	//update local timestamp for the uploaded file
 	_localFilesTimestamps = DefaultSaveFileManager::loadTimestamps();
-	_localFilesTimestamps[_currentUploadingFile] = response.value.timestamp();
+	_localFilesTimestamps[file.name()] = response.value.timestamp();
 	DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
 
 	//continue uploading files
-	uploadNextFile();
+	startTransfers();
 }
 
 void SavesSyncRequest::fileUploadedErrorCallback(Networking::ErrorResponse error) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
@@ -332,6 +365,28 @@ void SavesSyncRequest::fileUploadedErrorCallback(Networking::ErrorResponse error
 	finishError(error);
 }
 
+StorageFile SavesSyncRequest::takeTransfer(Request *request) {
+	//transfers finish in any order, so they are told apart by their Requests
+	for (uint32 i = 0; i < _transfers.size(); ++i) {
+		if (_transfers[i].request == request) {
+			StorageFile file = _transfers[i].file;
+			_transfers.remove_at(i);
+			return file;
+		}
+	}
+	return StorageFile();
+}
+
+void SavesSyncRequest::finishTransfers() {
+	//the callbacks must be ignored by the caller
+	for (uint32 i = 0; i < _transfers.size(); ++i) {
+		//the Request which failed might not have been taken yet
+		if (_transfers[i].request->state() != Networking::FINISHED)
+			_transfers[i].request->finish();
+	}
+	_transfers.clear();
+}
+
 void SavesSyncRequest::handle() {}
 
 void SavesSyncRequest::restart() { start(); }
@@ -343,12 +398,17 @@ double SavesSyncRequest::getDownloadingProgress() const {
 		return 0; //directory not listed yet
 	}
 
-	if (_totalFilesToHandle == _filesToUpload.size())
+	if (_uploading || _totalFilesToDownload == 0)
 		return 1; //nothing to download => download complete
 
-	uint32 totalFilesToDownload = _totalFilesToHandle - _filesToUpload.size();
-	uint32 filesLeftToDownload = _filesToDownload.size() + (_currentDownloadingFile.name() != "" ? 1 : 0);
-	return (double)(totalFilesToDownload - filesLeftToDownload) / (double)(totalFilesToDownload);
+	//files being downloaded count in part
+	double filesDownloaded = _totalFilesToDownload - _filesToDownload.size() - _transfers.size();
+	for (uint32 i = 0; i < _transfers.size(); ++i) {
+		DownloadRequest *downloadRequest = dynamic_cast<DownloadRequest *>(_transfers[i].request);
+		if (downloadRequest != nullptr)
+			filesDownloaded += downloadRequest->getProgress();
+	}
+	return filesDownloaded / (double)(_totalFilesToDownload);
 }
 
 double SavesSyncRequest::getProgress() const {
@@ -358,35 +418,41 @@ double SavesSyncRequest::getProgress() const {
 		return 0; //directory not listed yet
 	}
 
-	return (double)(_totalFilesToHandle - _filesToDownload.size() - _filesToUpload.size()) / (double)(_totalFilesToHandle);
+	return (double)(_totalFilesToHandle - _filesToDownload.size() - _filesToUpload.size() - _transfers.size()) / (double)(_totalFilesToHandle);
 }
 
 Common::Array<Common::String> SavesSyncRequest::getFilesToDownload() {
 	Common::Array<Common::String> result;
 	for (uint32 i = 0; i < _filesToDownload.size(); ++i)
 		result.push_back(_filesToDownload[i].name());
-	if (_currentDownloadingFile.name() != "")
-		result.push_back(_currentDownloadingFile.name());
+	if (!_uploading) {
+		for (uint32 i = 0; i < _transfers.size(); ++i)
+			result.push_back(_transfers[i].file.name());
+	}
 	return result;
 }
 
 void SavesSyncRequest::finishError(Networking::ErrorResponse error) {
 	debug(9, "SavesSync::finishError");
-	//if we were downloading a file - remember the name
-	//and make the Request close() it, so we can delete it
-	Common::String name = _currentDownloadingFile.name();
+	//if we were downloading files - remember the names
+	//and make the Requests close() them, so we can delete them
+	Common::Array<Common::String> names;
+	if (!_uploading) {
+		for (uint32 i = 0; i < _transfers.size(); ++i)
+			names.push_back(_transfers[i].file.name());
+	}
+	_ignoreCallback = true;
 	if (_workingRequest) {
-		_ignoreCallback = true;
 		_workingRequest->finish();
 		_workingRequest = nullptr;
-		_ignoreCallback = false;
 	}
+	finishTransfers();
+	_ignoreCallback = false;
 	//unlock all the files by making getFilesToDownload() return empty array
-	_currentDownloadingFile = StorageFile();
 	_filesToDownload.clear();
-	//delete the incomplete file
-	if (name != "")
-		g_system->getSavefileManager()->removeSavefile(name);
+	//delete the incomplete files
+	for (uint32 i = 0; i < names.size(); ++i)
+		g_system->getSavefileManager()->removeSavefile(names[i]);
 	Request::finishError(error);
 }
 
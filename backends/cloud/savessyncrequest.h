@@ -31,17 +31,28 @@
 
 namespace Cloud {
 
+/** The number of files which are downloaded or uploaded at the same time. */
+#define SAVES_SYNC_MAX_TRANSFERS 4
+
 class SavesSyncRequest: public Networking::Request, public GUI::CommandSender {
 	Storage *_storage;
 	Storage::BoolCallback _boolCallback;
 	Common::HashMap<Common::String, uint32> _localFilesTimestamps;
 	Common::Array<StorageFile> _filesToDownload;
 	Common::Array<Common::String> _filesToUpload;
-	StorageFile _currentDownloadingFile;
-	Common::String _currentUploadingFile;
+
+	struct Transfer {
+		Request *request;
+		StorageFile file; //for uploads, only the name is known
+	};
+
+	/** Files being downloaded or uploaded right now, up to SAVES_SYNC_MAX_TRANSFERS. */
+	Common::Array<Transfer> _transfers;
 	Request *_workingRequest;
 	bool _ignoreCallback;
+	bool _uploading;
 	uint32 _totalFilesToHandle;
+	uint32 _totalFilesToDownload;
 	Common::String _date;
 
 	void start();
@@ -53,8 +64,11 @@ class SavesSyncRequest: public Networking::Request, public GUI::CommandSender {
 	void fileDownloadedErrorCallback(Networking::ErrorResponse error);
 	void fileUploadedCallback(Storage::UploadResponse response);
 	void fileUploadedErrorCallback(Networking::ErrorResponse error);
-	void downloadNextFile();
-	void uploadNextFile();
+	void startTransfers();
+	bool downloadNextFile();
+	bool uploadNextFile();
+	StorageFile takeTransfer(Request *request);
+	void finishTransfers();
 	virtual void finishError(Networking::ErrorResponse error);
 	void finishSync(bool success);
 
@@ -25,8 +25,11 @@
 #include "backends/cloud/folderdownloadrequest.h"
 #include "backends/cloud/savessyncrequest.h"
 #include "backends/networking/curl/connectionmanager.h"
+#include "backends/networking/curl/curljsonrequest.h"
+#include "common/config-manager.h"
 #include "common/debug.h"
 #include "common/file.h"
+#include "common/json.h"
 #include <common/translation.h>
 #include "common/osd_message_queue.h"
 
@@ -38,6 +41,17 @@ Storage::Storage():
 
 Storage::~Storage() {}
 
+namespace {
+
+Common::String getListingKey(Common::String path, bool recursive) {
+	path.toLowercase();
+	if (path.lastChar() == '/')
+		path.deleteLastChar();
+	return (recursive ? "r:" : "d:") + path;
+}
+
+} // End of anonymous namespace
+
 Networking::ErrorCallback Storage::getErrorPrintingCallback() {
 	return new Common::Callback<Storage, Networking::ErrorResponse>(this, &Storage::printErrorResponse);
 }
@@ -94,6 +108,10 @@ bool Storage::uploadStreamSupported() {
 	return true;
 }
 
+bool Storage::rangedDownloadSupported() {
+	return false;
+}
+
 Networking::Request *Storage::streamFile(Common::String path, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback) {
 	//most Storages use paths instead of ids, so this should work
 	return streamFileById(path, callback, errorCallback);
@@ -104,11 +122,16 @@ Networking::Request *Storage::download(Common::String remotePath, Common::String
 	return downloadById(remotePath, localPath, callback, errorCallback);
 }
 
-Networking::Request *Storage::downloadById(Common::String remoteId, Common::String localPath, BoolCallback callback, Networking::ErrorCallback errorCallback) {
+Networking::Request *Storage::downloadById(Common::String remoteId, Common::String localPath, BoolCallback callback, Networking::ErrorCallback errorCallback, uint32 offset) {
 	if (!errorCallback) errorCallback = getErrorPrintingCallback();
 
 	Common::DumpFile *f = new Common::DumpFile();
-	if (!f->open(localPath, true)) {
+	bool opened;
+	if (offset)
+		opened = rangedDownloadSupported() && f->open(Common::FSNode(localPath), true);
+	else
+		opened = f->open(localPath, true);
+	if (!opened) {
 		warning("Storage: unable to open file to download into");
 		if (errorCallback) (*errorCallback)(Networking::ErrorResponse(nullptr, false, true, "", -1));
 		delete errorCallback;
@@ -117,7 +140,7 @@ Networking::Request *Storage::downloadById(Common::String remoteId, Common::Stri
 		return nullptr;
 	}
 
-	return addRequest(new DownloadRequest(this, callback, errorCallback, remoteId, f));
+	return addRequest(new DownloadRequest(this, callback, errorCallback, remoteId, f, offset));
 }
 
 Networking::Request *Storage::downloadFolder(Common::String remotePath, Common::String localPath, FileArrayCallback callback, Networking::ErrorCallback errorCallback, bool recursive) {
@@ -151,6 +174,118 @@ bool Storage::isWorking() {
 	return working;
 }
 
+///// Listing cache /////
+
+bool Storage::getCachedListing(Common::String path, bool recursive, CachedListing &listing) {
+	Common::StackLock lock(_listingCacheMutex);
+	ListingCache::const_iterator i = _listingCache.find(getListingKey(path, recursive));
+	if (i == _listingCache.end())
+		return false;
+	listing = i->_value;
+	return true;
+}
+
+void Storage::cacheListing(const CachedListing &listing) {
+	Common::StackLock lock(_listingCacheMutex);
+	_listingCache[getListingKey(listing.path, listing.recursive)] = listing;
+}
+
+void Storage::uncacheListing(Common::String path, bool recursive) {
+	Common::StackLock lock(_listingCacheMutex);
+	_listingCache.erase(getListingKey(path, recursive));
+}
+
+void Storage::loadListingCache(Common::String keyPrefix) {
+	if (!ConfMan.hasKey(keyPrefix + "listings", ConfMan.kCloudDomain))
+		return;
+
+	Common::JSONValue *json = Common::JSON::parse(ConfMan.get(keyPrefix + "listings", ConfMan.kCloudDomain).c_str());
+	if (!json)
+		return;
+
+	Common::StackLock lock(_listingCacheMutex);
+	if (json->isArray()) {
+		Common::JSONArray listings = json->asArray();
+		for (uint32 i = 0; i < listings.size(); ++i) {
+			if (!Networking::CurlJsonRequest::jsonIsObject(listings[i], "Storage::loadListingCache"))
+				continue;
+
+			Common::JSONObject item = listings[i]->asObject();
+			if (!Networking::CurlJsonRequest::jsonContainsString(item, "path", "Storage::loadListingCache") ||
+				!Networking::CurlJsonRequest::jsonContainsString(item, "cursor", "Storage::loadListingCache") ||
+				!Networking::CurlJsonRequest::jsonContainsArray(item, "files", "Storage::loadListingCache") ||
+				!item.contains("recursive") || !item.getVal("recursive")->isBool())
+				continue;
+
+			CachedListing listing;
+			listing.path = item.getVal("path")->asString();
+			listing.recursive = item.getVal("recursive")->asBool();
+			listing.cursor = item.getVal("cursor")->asString();
+
+			Common::JSONArray files = item.getVal("files")->asArray();
+			for (uint32 j = 0; j < files.size(); ++j) {
+				if (!Networking::CurlJsonRequest::jsonIsObject(files[j], "Storage::loadListingCache"))
+					continue;
+
+				Common::JSONObject file = files[j]->asObject();
+				if (!Networking::CurlJsonRequest::jsonContainsString(file, "id", "Storage::loadListingCache") ||
+					!Networking::CurlJsonRequest::jsonContainsString(file, "path", "Storage::loadListingCache") ||
+					!Networking::CurlJsonRequest::jsonContainsString(file, "name", "Storage::loadListingCache") ||
+					!Networking::CurlJsonRequest::jsonContainsIntegerNumber(file, "size", "Storage::loadListingCache") ||
+					!Networking::CurlJsonRequest::jsonContainsIntegerNumber(file, "timestamp", "Storage::loadListingCache") ||
+					!file.contains("directory") || !file.getVal("directory")->isBool())
+					continue;
+
+				listing.files.push_back(StorageFile(
+					file.getVal("id")->asString(), file.getVal("path")->asString(), file.getVal("name")->asString(),
+					file.getVal("size")->asIntegerNumber(), file.getVal("timestamp")->asIntegerNumber(),
+					file.getVal("directory")->asBool()
+				));
+			}
+
+			_listingCache[getListingKey(listing.path, listing.recursive)] = listing;
+		}
+	}
+
+	delete json;
+}
+
+void Storage::saveListingCache(Common::String keyPrefix) {
+	Common::StackLock lock(_listingCacheMutex);
+	if (_listingCache.empty()) {
+		ConfMan.removeKey(keyPrefix + "listings", ConfMan.kCloudDomain);
+		return;
+	}
+
+	Common::JSONArray listings;
+	for (ListingCache::const_iterator i = _listingCache.begin(); i != _listingCache.end(); ++i) {
+		const CachedListing &listing = i->_value;
+
+		Common::JSONArray files;
+		for (uint32 j = 0; j < listing.files.size(); ++j) {
+			const StorageFile &file = listing.files[j];
+			Common::JSONObject item;
+			item.setVal("id", new Common::JSONValue(file.id()));
+			item.setVal("path", new Common::JSONValue(file.path()));
+			item.setVal("name", new Common::JSONValue(file.name()));
+			item.setVal("size", new Common::JSONValue((long long int)file.size()));
+			item.setVal("timestamp", new Common::JSONValue((long long int)file.timestamp()));
+			item.setVal("directory", new Common::JSONValue(file.isDirectory()));
+			files.push_back(new Common::JSONValue(item));
+		}
+
+		Common::JSONObject item;
+		item.setVal("path", new Common::JSONValue(listing.path));
+		item.setVal("recursive", new Common::JSONValue(listing.recursive));
+		item.setVal("cursor", new Common::JSONValue(listing.cursor));
+		item.setVal("files", new Common::JSONValue(files));
+		listings.push_back(new Common::JSONValue(item));
+	}
+
+	Common::JSONValue value(listings);
+	ConfMan.set(keyPrefix + "listings", Common::JSON::stringify(&value), ConfMan.kCloudDomain);
+}
+
 ///// SavesSyncRequest-related /////
 
 bool Storage::isSyncing() {
@@ -300,6 +435,15 @@ uint64 Storage::getDownloadSpeed() {
 	return result;
 }
 
+uint32 Storage::getDownloadTransfersNumber() {
+	uint32 result = 0;
+	_runningRequestsMutex.lock();
+	if (_downloadFolderRequest)
+		result = _downloadFolderRequest->getTransfersNumber();
+	_runningRequestsMutex.unlock();
+	return result;
+}
+
 Common::String Storage::getDownloadRemoteDirectory() {
 	Common::String result = "";
 	_runningRequestsMutex.lock();
@@ -29,6 +29,8 @@
 #include "backends/networking/curl/curlrequest.h"
 #include "common/array.h"
 #include "common/callback.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/mutex.h"
 #include "common/stream.h"
 #include "common/str.h"
@@ -58,6 +60,19 @@ public:
 	typedef Common::BaseCallback<UploadResponse> *UploadCallback;
 	typedef Common::BaseCallback<ListDirectoryResponse> *ListDirectoryCallback;
 
+	/**
+	 * A directory listing kept between requests, together with the
+	 * storage's cursor for asking which files changed since.
+	 */
+	struct CachedListing {
+		Common::String path;
+		bool recursive;
+		Common::String cursor;
+		Common::Array<StorageFile> files;
+
+		CachedListing(): recursive(false) {}
+	};
+
 protected:
 	/** Keeps track of running requests. */
 	uint32 _runningRequestsCount;
@@ -70,6 +85,20 @@ protected:
 	/** FolderDownloadRequest-related */
 	FolderDownloadRequest *_downloadFolderRequest;
 
+	/** Listings by lowercase path, see getCachedListing(). */
+	typedef Common::HashMap<Common::String, CachedListing> ListingCache;
+	ListingCache _listingCache;
+	Common::Mutex _listingCacheMutex;
+
+	/**
+	 * Restore the listings saved by saveListingCache(). Storages which use
+	 * the listing cache call this when loading their configuration.
+	 */
+	void loadListingCache(Common::String keyPrefix);
+
+	/** Save the cached listings using ConfMan, as a part of saveConfig(). */
+	void saveListingCache(Common::String keyPrefix);
+
 	/** Returns default error callback (printErrorResponse). */
 	virtual Networking::ErrorCallback getErrorPrintingCallback();
 
@@ -133,13 +162,24 @@ public:
 	/** Returns whether Storage supports upload(ReadStream). */
 	virtual bool uploadStreamSupported();
 
-	/** Returns pointer to Networking::NetworkReadStream. */
+	/**
+	 * Returns pointer to Networking::NetworkReadStream.
+	 * If <offset> is given, the stream starts at that byte of the file,
+	 * which only works if rangedDownloadSupported().
+	 */
 	virtual Networking::Request *streamFile(Common::String path, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback);
-	virtual Networking::Request *streamFileById(Common::String id, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback) = 0;
+	virtual Networking::Request *streamFileById(Common::String id, Networking::NetworkReadStreamCallback callback, Networking::ErrorCallback errorCallback, uint32 offset = 0) = 0;
 
-	/** Calls the callback when finished. */
+	/** Returns whether Storage supports streamFileById() with an offset. */
+	virtual bool rangedDownloadSupported();
+
+	/**
+	 * Calls the callback when finished.
+	 * If <offset> is given, the local file is expected to hold that many
+	 * bytes of the remote one already, and only the rest is appended.
+	 */
 	virtual Networking::Request *download(Common::String remotePath, Common::String localPath, BoolCallback callback, Networking::ErrorCallback errorCallback);
-	virtual Networking::Request *downloadById(Common::String remoteId, Common::String localPath, BoolCallback callback, Networking::ErrorCallback errorCallback);
+	virtual Networking::Request *downloadById(Common::String remoteId, Common::String localPath, BoolCallback callback, Networking::ErrorCallback errorCallback, uint32 offset = 0);
 
 	/** Returns Common::Array<StorageFile> with list of files, which were not downloaded. */
 	virtual Networking::Request *downloadFolder(Common::String remotePath, Common::String localPath, FileArrayCallback callback, Networking::ErrorCallback errorCallback, bool recursive = false);
@@ -165,6 +205,23 @@ public:
 	/** Returns whether there are any requests running. */
 	virtual bool isWorking();
 
+	///// Listing cache /////
+
+	/**
+	 * Find the last listing of a directory, so that a ListDirectoryRequest
+	 * can ask the storage for the changes since instead of listing all the
+	 * files again. Only storages with a change feed fill the cache.
+	 *
+	 * @return false if the directory was not listed yet.
+	 */
+	bool getCachedListing(Common::String path, bool recursive, CachedListing &listing);
+
+	/** Remember a complete listing, replacing the previous one of its directory. */
+	void cacheListing(const CachedListing &listing);
+
+	/** Forget the listing of a directory, e.g. because its cursor expired. */
+	void uncacheListing(Common::String path, bool recursive);
+
 	///// SavesSyncRequest-related /////
 
 	/** Returns whether there is a SavesSyncRequest running. */
@@ -219,6 +276,9 @@ public:
 	/** Returns download speed of current download progress. */
 	virtual uint64 getDownloadSpeed();
 
+	/** Returns the number of files being downloaded at the same time in current download progress. */
+	virtual uint32 getDownloadTransfersNumber();
+
 	/** Returns remote directory path. */
 	virtual Common::String getDownloadRemoteDirectory();
 
@@ -73,6 +73,8 @@ DefaultEventManager::~DefaultEventManager() {
 }
 
 void DefaultEventManager::init() {
+	_dispatcher.setCoalesceMouseMotion(ConfMan.getBool("coalesce_mouse_motion"));
+
 #ifdef ENABLE_VKEYBD
 	_vk = new Common::VirtualKeyboard();
 
@@ -534,6 +534,11 @@ bool SdlEventSource::pollEvent(Common::Event &event) {
 		return true;
 	}
 
+	// Present a frame held back by frame pacing once it is due.
+	if (_graphicsManager) {
+		_graphicsManager->presentPendingFrame();
+	}
+
 	SDL_Event ev;
 	while (SDL_PollEvent(&ev)) {
 		preprocessEvents(&ev);
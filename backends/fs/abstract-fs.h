@@ -183,6 +183,15 @@ public:
 	 */
 	virtual Common::SeekableReadStream *createReadStream() = 0;
 
+	/**
+	 * Creates a SeekableReadStream instance reading directly from a memory
+	 * mapping of the file referred by this node. Backends without support
+	 * for memory mapped files simply return a regular read stream.
+	 *
+	 * @return pointer to the stream object, 0 in case of a failure
+	 */
+	virtual Common::SeekableReadStream *createMappedReadStream() { return createReadStream(); }
+
 	/**
 	 * Creates a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
@@ -192,6 +201,15 @@ public:
 	 */
 	virtual Common::WriteStream *createWriteStream() = 0;
 
+	/**
+	 * Creates a WriteStream instance which appends to the file referred by
+	 * this node, creating it if needed. Backends which cannot append to
+	 * files return 0.
+	 *
+	 * @return pointer to the stream object, 0 in case of a failure
+	 */
+	virtual Common::WriteStream *createAppendStream() { return 0; }
+
 	/**
 	* Creates a file referred by this node.
 	*
@@ -0,0 +1,67 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BACKENDS_FS_MAPPEDSTREAM_H
+#define BACKENDS_FS_MAPPEDSTREAM_H
+
+#include "common/scummsys.h"
+#include "common/memstream.h"
+#include "common/str.h"
+
+/**
+ * A read stream over a file mapped into memory.
+ *
+ * Reading from the stream is a plain memcpy from the mapping, and since it
+ * is a MemoryReadStream, sub streams can be served without any copies.
+ * The implementation of makeFromPath() is platform specific, see e.g.
+ * backends/fs/posix/posix-mapped-stream.cpp.
+ */
+class MappedReadStream : public Common::MemoryReadStream {
+public:
+	enum {
+		/**
+		 * Files smaller than this are not worth mapping; the buffered
+		 * stdio path is as fast for them and wastes less address space.
+		 */
+		kMinMappedSize = 64 * 1024
+	};
+
+	/**
+	 * Map the file at the given path into memory.
+	 *
+	 * @return the new stream, or 0 if the file could not be mapped or is
+	 *         smaller than kMinMappedSize. Callers are supposed to fall
+	 *         back to a StdioStream in that case.
+	 */
+	static MappedReadStream *makeFromPath(const Common::String &path);
+
+	virtual ~MappedReadStream();
+
+private:
+	MappedReadStream(const byte *mapping, uint32 size, void *handle);
+
+	const byte *_mapping;
+	uint32 _mappingSize;
+	void *_handle;		///< Platform specific handle of the mapping, if any.
+};
+
+#endif
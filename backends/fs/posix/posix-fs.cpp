@@ -31,6 +31,7 @@
 #define FORBIDDEN_SYMBOL_EXCEPTION_exit		//Needed for IRIX's unistd.h
 
 #include "backends/fs/posix/posix-fs.h"
+#include "backends/fs/mapped-stream.h"
 #include "backends/fs/stdiostream.h"
 #include "common/algorithm.h"
 
@@ -277,10 +278,23 @@ Common::SeekableReadStream *POSIXFilesystemNode::createReadStream() {
 	return StdioStream::makeFromPath(getPath(), false);
 }
 
+#ifdef POSIX
+Common::SeekableReadStream *POSIXFilesystemNode::createMappedReadStream() {
+	Common::SeekableReadStream *stream = MappedReadStream::makeFromPath(getPath());
+	if (!stream)
+		stream = createReadStream();
+	return stream;
+}
+#endif
+
 Common::WriteStream *POSIXFilesystemNode::createWriteStream() {
 	return StdioStream::makeFromPath(getPath(), true);
 }
 
+Common::WriteStream *POSIXFilesystemNode::createAppendStream() {
+	return StdioStream::makeFromPathForAppending(getPath());
+}
+
 bool POSIXFilesystemNode::create(bool isDirectoryFlag) {
 	bool success;
 
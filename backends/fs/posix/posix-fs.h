@@ -72,7 +72,11 @@ public:
 	virtual AbstractFSNode *getParent() const;
 
 	virtual Common::SeekableReadStream *createReadStream();
+#ifdef POSIX
+	virtual Common::SeekableReadStream *createMappedReadStream();
+#endif
 	virtual Common::WriteStream *createWriteStream();
+	virtual Common::WriteStream *createAppendStream();
 	virtual bool create(bool isDirectoryFlag);
 
 private:
@@ -103,4 +103,18 @@ StdioStream *StdioStream::makeFromPath(const Common::String &path, bool writeMod
 	return 0;
 }
 
+StdioStream *StdioStream::makeFromPathForAppending(const Common::String &path) {
+	FILE *handle = fopen(path.c_str(), "ab");
+
+#if defined(__WII__)
+	// disable newlib's buffering, the device libraries handle caching
+	if (handle)
+		setvbuf(handle, NULL, _IONBF, 0);
+#endif
+
+	if (handle)
+		return new StdioStream(handle);
+	return 0;
+}
+
 #endif
@@ -40,6 +40,11 @@ public:
 	 */
 	static StdioStream *makeFromPath(const Common::String &path, bool writeMode);
 
+	/**
+	 * Like makeFromPath(), but opens the file for writing at its end.
+	 */
+	static StdioStream *makeFromPathForAppending(const Common::String &path);
+
 	StdioStream(void *handle);
 	virtual ~StdioStream();
 
@@ -26,6 +26,7 @@
 #define FORBIDDEN_SYMBOL_ALLOW_ALL
 
 #include "backends/fs/windows/windows-fs.h"
+#include "backends/fs/mapped-stream.h"
 #include "backends/fs/stdiostream.h"
 
 // F_OK, R_OK and W_OK are not defined under MSVC, so we define them here
@@ -240,10 +241,23 @@ Common::SeekableReadStream *WindowsFilesystemNode::createReadStream() {
 	return StdioStream::makeFromPath(getPath(), false);
 }
 
+#ifndef _WIN32_WCE
+Common::SeekableReadStream *WindowsFilesystemNode::createMappedReadStream() {
+	Common::SeekableReadStream *stream = MappedReadStream::makeFromPath(getPath());
+	if (!stream)
+		stream = createReadStream();
+	return stream;
+}
+#endif
+
 Common::WriteStream *WindowsFilesystemNode::createWriteStream() {
 	return StdioStream::makeFromPath(getPath(), true);
 }
 
+Common::WriteStream *WindowsFilesystemNode::createAppendStream() {
+	return StdioStream::makeFromPathForAppending(getPath());
+}
+
 bool WindowsFilesystemNode::create(bool isDirectoryFlag) {
 	bool success;
 
@@ -87,7 +87,11 @@ public:
 	virtual AbstractFSNode *getParent() const;
 
 	virtual Common::SeekableReadStream *createReadStream();
+#ifndef _WIN32_WCE
+	virtual Common::SeekableReadStream *createMappedReadStream();
+#endif
 	virtual Common::WriteStream *createWriteStream();
+	virtual Common::WriteStream *createAppendStream();
 	virtual bool create(bool isDirectoryFlag);
 
 private:
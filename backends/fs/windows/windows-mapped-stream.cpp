@@ -0,0 +1,68 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#if defined(WIN32) && !defined(_WIN32_WCE)
+
+// Disable symbol overrides so that we can use system headers.
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include "backends/fs/mapped-stream.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+MappedReadStream::MappedReadStream(const byte *mapping, uint32 size, void *handle)
+	: Common::MemoryReadStream(mapping, size), _mapping(mapping), _mappingSize(size), _handle(handle) {
+}
+
+MappedReadStream::~MappedReadStream() {
+	UnmapViewOfFile(_mapping);
+	CloseHandle((HANDLE)_handle);
+}
+
+MappedReadStream *MappedReadStream::makeFromPath(const Common::String &path) {
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart < kMinMappedSize || size.QuadPart > 0x7FFFFFFF) {
+		CloseHandle(file);
+		return nullptr;
+	}
+
+	// The mapping object keeps its own reference to the file.
+	HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!mapping)
+		return nullptr;
+
+	const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!view) {
+		CloseHandle(mapping);
+		return nullptr;
+	}
+
+	return new MappedReadStream((const byte *)view, (uint32)size.QuadPart, mapping);
+}
+
+#endif
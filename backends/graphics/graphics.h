@@ -72,6 +72,9 @@ public:
 	virtual void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) = 0;
 	virtual Graphics::Surface *lockScreen() = 0;
 	virtual void unlockScreen() = 0;
+	virtual Graphics::Surface *getScreenBuffer(ScreenBufferListener *listener) { return nullptr; }
+	virtual void releaseScreenBuffer(ScreenBufferListener *listener) {}
+	virtual void markScreenDirty(const Common::Rect &r) {}
 	virtual void fillScreen(uint32 col) = 0;
 	virtual void updateScreen() = 0;
 	virtual void setShakePos(int shakeOffset) = 0;
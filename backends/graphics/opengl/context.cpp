@@ -28,6 +28,7 @@
 
 #include "common/tokenizer.h"
 #include "common/debug.h"
+#include "common/util.h"
 
 namespace OpenGL {
 
@@ -38,6 +39,8 @@ void Context::reset() {
 	shadersSupported = false;
 	multitextureSupported = false;
 	framebufferObjectSupported = false;
+	pixelBufferObjectSupported = false;
+	bufferStorageSupported = false;
 
 #define GL_FUNC_DEF(ret, name, param) name = nullptr;
 #include "backends/graphics/opengl/opengl-func.h"
@@ -119,6 +122,8 @@ void OpenGLGraphicsManager::initializeGLContext() {
 	bool ARBShadingLanguage100 = false;
 	bool ARBVertexShader = false;
 	bool ARBFragmentShader = false;
+	bool ARBPixelBufferObject = false;
+	bool ARBBufferStorage = false;
 
 	Common::StringTokenizer tokenizer(extString, " ");
 	while (!tokenizer.empty()) {
@@ -138,6 +143,10 @@ void OpenGLGraphicsManager::initializeGLContext() {
 			g_context.multitextureSupported = true;
 		} else if (token == "GL_EXT_framebuffer_object") {
 			g_context.framebufferObjectSupported = true;
+		} else if (token == "GL_ARB_pixel_buffer_object") {
+			ARBPixelBufferObject = true;
+		} else if (token == "GL_ARB_buffer_storage") {
+			ARBBufferStorage = true;
 		}
 	}
 
@@ -157,6 +166,25 @@ void OpenGLGraphicsManager::initializeGLContext() {
 		g_context.shadersSupported = ARBShaderObjects & ARBShadingLanguage100 & ARBVertexShader & ARBFragmentShader;
 	}
 
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+	if (g_context.type == kContextGL) {
+		// The version string starts with "<major>.<minor>".
+		const char *versionString = (const char *)g_context.glGetString(GL_VERSION);
+		int version = 0;
+		if (versionString && Common::isDigit(versionString[0]) && versionString[1] == '.' && Common::isDigit(versionString[2])) {
+			version = (versionString[0] - '0') * 10 + (versionString[2] - '0');
+		}
+
+		g_context.pixelBufferObjectSupported = (ARBPixelBufferObject || version >= 21)
+		    && g_context.glGenBuffers && g_context.glDeleteBuffers && g_context.glBindBuffer
+		    && g_context.glBufferData && g_context.glMapBuffer && g_context.glUnmapBuffer;
+		g_context.bufferStorageSupported = g_context.pixelBufferObjectSupported
+		    && (ARBBufferStorage || version >= 44)
+		    && g_context.glBufferStorage && g_context.glMapBufferRange
+		    && g_context.glFenceSync && g_context.glClientWaitSync && g_context.glDeleteSync;
+	}
+#endif
+
 	// Log context type.
 	switch (g_context.type) {
 	case kContextGL:
@@ -177,6 +205,8 @@ void OpenGLGraphicsManager::initializeGLContext() {
 	debug(5, "OpenGL: Shader support: %d", g_context.shadersSupported);
 	debug(5, "OpenGL: Multitexture support: %d", g_context.multitextureSupported);
 	debug(5, "OpenGL: FBO support: %d", g_context.framebufferObjectSupported);
+	debug(5, "OpenGL: PBO support: %d", g_context.pixelBufferObjectSupported);
+	debug(5, "OpenGL: Buffer storage support: %d", g_context.bufferStorageSupported);
 }
 
 } // End of namespace OpenGL
@@ -110,6 +110,7 @@ GL_FUNC_2_DEF(void, glEnableVertexAttribArray, glEnableVertexAttribArrayARB, (GL
 GL_FUNC_2_DEF(void, glDisableVertexAttribArray, glDisableVertexAttribArrayARB, (GLuint index));
 GL_FUNC_2_DEF(void, glUniform1i, glUniform1iARB, (GLint location, GLint v0));
 GL_FUNC_2_DEF(void, glUniform1f, glUniform1fARB, (GLint location, GLfloat v0));
+GL_FUNC_2_DEF(void, glUniform2f, glUniform2fARB, (GLint location, GLfloat v0, GLfloat v1));
 GL_FUNC_2_DEF(void, glUniformMatrix4fv, glUniformMatrix4fvARB, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value));
 GL_FUNC_2_DEF(void, glVertexAttrib4f, glVertexAttrib4fARB, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w));
 GL_FUNC_2_DEF(void, glVertexAttribPointer, glVertexAttribPointerARB, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer));
@@ -142,6 +143,21 @@ GL_FUNC_2_DEF(GLenum, glCheckFramebufferStatus, glCheckFramebufferStatusEXT, (GL
 GL_FUNC_2_DEF(void, glActiveTexture, glActiveTextureARB, (GLenum texture));
 #endif
 
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+GL_EXT_FUNC_DEF(void, glGenBuffers, (GLsizei n, GLuint *buffers));
+GL_EXT_FUNC_DEF(void, glDeleteBuffers, (GLsizei n, const GLuint *buffers));
+GL_EXT_FUNC_DEF(void, glBindBuffer, (GLenum target, GLuint buffer));
+GL_EXT_FUNC_DEF(void, glBufferData, (GLenum target, GLsizeiptr size, const void *data, GLenum usage));
+GL_EXT_FUNC_DEF(void *, glMapBuffer, (GLenum target, GLenum access));
+GL_EXT_FUNC_DEF(GLboolean, glUnmapBuffer, (GLenum target));
+
+GL_EXT_FUNC_DEF(void, glBufferStorage, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags));
+GL_EXT_FUNC_DEF(void *, glMapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access));
+GL_EXT_FUNC_DEF(GLsync, glFenceSync, (GLenum condition, GLbitfield flags));
+GL_EXT_FUNC_DEF(GLenum, glClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout));
+GL_EXT_FUNC_DEF(void, glDeleteSync, (GLsync sync));
+#endif
+
 #ifdef DEFINED_GL_EXT_FUNC_DEF
 #undef DEFINED_GL_EXT_FUNC_DEF
 #undef GL_EXT_FUNC_DEF
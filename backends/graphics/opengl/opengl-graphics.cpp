@@ -26,7 +26,9 @@
 #include "backends/graphics/opengl/pipelines/pipeline.h"
 #include "backends/graphics/opengl/pipelines/fixed.h"
 #include "backends/graphics/opengl/pipelines/shader.h"
+#include "backends/graphics/opengl/pipelines/scaler.h"
 #include "backends/graphics/opengl/shader.h"
+#include "backends/graphics/opengl/pixelbuffer.h"
 
 #include "common/array.h"
 #include "common/textconsole.h"
@@ -53,8 +55,11 @@ namespace OpenGL {
 OpenGLGraphicsManager::OpenGLGraphicsManager()
     : _currentState(), _oldState(), _transactionMode(kTransactionNone), _screenChangeID(1 << (sizeof(int) * 8 - 2)),
       _pipeline(nullptr),
+#if !USE_FORCED_GLES
+      _scalerPipeline(nullptr), _scalerPipelineMode(GFX_OPENGL),
+#endif
       _defaultFormat(), _defaultFormatAlpha(),
-      _gameScreen(nullptr), _gameScreenShakeOffset(0), _overlay(nullptr),
+      _gameScreen(nullptr), _screenBufferListener(nullptr), _gameScreenShakeOffset(0), _overlay(nullptr),
       _cursor(nullptr),
       _cursorHotspotX(0), _cursorHotspotY(0),
       _cursorHotspotXScaled(0), _cursorHotspotYScaled(0), _cursorWidthScaled(0), _cursorHeightScaled(0),
@@ -69,6 +74,7 @@ OpenGLGraphicsManager::OpenGLGraphicsManager()
 }
 
 OpenGLGraphicsManager::~OpenGLGraphicsManager() {
+	notifyScreenBufferReleased();
 	delete _gameScreen;
 	delete _overlay;
 	delete _cursor;
@@ -77,6 +83,7 @@ OpenGLGraphicsManager::~OpenGLGraphicsManager() {
 	delete _osdIconSurface;
 #endif
 #if !USE_FORCED_GLES
+	delete _scalerPipeline;
 	ShaderManager::destroy();
 #endif
 }
@@ -115,6 +122,12 @@ void OpenGLGraphicsManager::setFeatureState(OSystem::Feature f, bool enable) {
 			_cursor->enableLinearFiltering(enable);
 		}
 
+#if !USE_FORCED_GLES
+		if (_scalerPipeline) {
+			_scalerPipeline->enableLinearFiltering(enable);
+		}
+#endif
+
 		break;
 
 	case OSystem::kFeatureCursorPalette:
@@ -147,6 +160,12 @@ namespace {
 
 const OSystem::GraphicsMode glGraphicsModes[] = {
 	{ "opengl",  _s("OpenGL"),                GFX_OPENGL  },
+#if !USE_FORCED_GLES
+	{ "opengl_scale2x", _s("OpenGL Scale2x"), GFX_OPENGL_SCALE2X },
+	{ "opengl_hqx",     _s("OpenGL HQx"),     GFX_OPENGL_HQX     },
+	{ "opengl_xbr",     _s("OpenGL xBR"),     GFX_OPENGL_XBR     },
+	{ "opengl_crt",     _s("OpenGL CRT"),     GFX_OPENGL_CRT     },
+#endif
 	{ nullptr, nullptr, 0 }
 };
 
@@ -165,6 +184,12 @@ bool OpenGLGraphicsManager::setGraphicsMode(int mode) {
 
 	switch (mode) {
 	case GFX_OPENGL:
+#if !USE_FORCED_GLES
+	case GFX_OPENGL_SCALE2X:
+	case GFX_OPENGL_HQX:
+	case GFX_OPENGL_XBR:
+	case GFX_OPENGL_CRT:
+#endif
 		_currentState.graphicsMode = mode;
 		return true;
 
@@ -285,6 +310,7 @@ OSystem::TransactionError OpenGLGraphicsManager::endGFXTransaction() {
 	} while (_transactionMode == kTransactionRollback);
 
 	if (setupNewGameScreen) {
+		notifyScreenBufferReleased();
 		delete _gameScreen;
 		_gameScreen = nullptr;
 
@@ -312,6 +338,10 @@ OSystem::TransactionError OpenGLGraphicsManager::endGFXTransaction() {
 #endif
 	}
 
+#if !USE_FORCED_GLES
+	updateScalerPipeline();
+#endif
+
 	// Update our display area and cursor scaling. This makes sure we pick up
 	// aspect ratio correction and game screen changes correctly.
 	recalculateDisplayAreas();
@@ -395,7 +425,8 @@ void OpenGLGraphicsManager::updateScreen() {
 	    && !(_overlayVisible && _overlay->isDirty())
 	    && !(_cursorVisible && _cursor && _cursor->isDirty())
 #ifdef USE_OSD
-	    && !_osdMessageSurface && !_osdIconSurface
+	    // The OSD only changes the screen while a message fades out
+	    && !(_osdMessageSurface && (int32)(g_system->getMillis(false) - _osdMessageFadeStartTime) > 0)
 #endif
 	    ) {
 		return;
@@ -421,6 +452,11 @@ void OpenGLGraphicsManager::updateScreen() {
 	const GLfloat shakeOffset = _gameScreenShakeOffset * (GLfloat)_gameDrawRect.height() / _gameScreen->getHeight();
 
 	// First step: Draw the (virtual) game screen.
+#if !USE_FORCED_GLES
+	if (_scalerPipeline) {
+		_scalerPipeline->drawTexture(_gameScreen->getGLTexture(), _gameDrawRect.left, _gameDrawRect.top + shakeOffset, _gameDrawRect.width(), _gameDrawRect.height());
+	} else
+#endif
 	g_context.getActivePipeline()->drawTexture(_gameScreen->getGLTexture(), _gameDrawRect.left, _gameDrawRect.top + shakeOffset, _gameDrawRect.width(), _gameDrawRect.height());
 
 	// Second step: Draw the overlay if visible.
@@ -501,6 +537,35 @@ void OpenGLGraphicsManager::unlockScreen() {
 	_gameScreen->flagDirty();
 }
 
+Graphics::Surface *OpenGLGraphicsManager::getScreenBuffer(ScreenBufferListener *listener) {
+	if (!_gameScreen)
+		return nullptr;
+
+	if (_screenBufferListener != listener)
+		notifyScreenBufferReleased();
+	_screenBufferListener = listener;
+
+	// The game screen is only recreated when its size or format changes
+	return _gameScreen->getSurface();
+}
+
+void OpenGLGraphicsManager::releaseScreenBuffer(ScreenBufferListener *listener) {
+	if (_screenBufferListener == listener)
+		_screenBufferListener = nullptr;
+}
+
+void OpenGLGraphicsManager::notifyScreenBufferReleased() {
+	if (_screenBufferListener) {
+		ScreenBufferListener *listener = _screenBufferListener;
+		_screenBufferListener = nullptr;
+		listener->screenBufferReleased();
+	}
+}
+
+void OpenGLGraphicsManager::markScreenDirty(const Common::Rect &r) {
+	_gameScreen->addDirtyArea(r);
+}
+
 void OpenGLGraphicsManager::setFocusRectangle(const Common::Rect& rect) {
 }
 
@@ -741,6 +806,9 @@ void OpenGLGraphicsManager::osdMessageUpdateSurface() {
 	_osdMessageAlpha = kOSDMessageInitialAlpha;
 	_osdMessageFadeStartTime = g_system->getMillis() + kOSDMessageFadeOutDelay;
 
+	// Make sure the message is shown on the next update
+	_forceRedraw = true;
+
 	// Clear the text update request
 	_osdMessageNextData.clear();
 	_osdMessageChangeRequest = false;
@@ -752,11 +820,11 @@ void OpenGLGraphicsManager::displayActivityIconOnOSD(const Graphics::Surface *ic
 	if (_osdIconSurface) {
 		delete _osdIconSurface;
 		_osdIconSurface = nullptr;
-
-		// Make sure the icon is cleared on the next update
-		_forceRedraw = true;
 	}
 
+	// Make sure the icon is updated on the next update
+	_forceRedraw = true;
+
 	if (icon) {
 		Graphics::Surface *converted = icon->convertTo(_defaultFormatAlpha);
 
@@ -855,6 +923,10 @@ void OpenGLGraphicsManager::notifyContextCreate(const Graphics::PixelFormat &def
 	// Initialize context for use.
 	initializeGLContext();
 
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+	PixelBufferMan.notifyCreate();
+#endif
+
 	// Initialize pipeline.
 	delete _pipeline;
 	_pipeline = nullptr;
@@ -892,6 +964,10 @@ void OpenGLGraphicsManager::notifyContextCreate(const Graphics::PixelFormat &def
 
 	g_context.getActivePipeline()->setFramebuffer(&_backBuffer);
 
+#if !USE_FORCED_GLES
+	updateScalerPipeline();
+#endif
+
 	// We use a "pack" alignment (when reading from textures) to 4 here,
 	// since the only place where we really use it is the BMP screenshot
 	// code and that requires the same alignment too.
@@ -955,11 +1031,19 @@ void OpenGLGraphicsManager::notifyContextDestroy() {
 #endif
 
 #if !USE_FORCED_GLES
+	delete _scalerPipeline;
+	_scalerPipeline = nullptr;
+	_scalerPipelineMode = GFX_OPENGL;
+
 	if (g_context.shadersSupported) {
 		ShaderMan.notifyDestroy();
 	}
 #endif
 
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+	PixelBufferMan.notifyDestroy();
+#endif
+
 	// Destroy rendering pipeline.
 	g_context.setPipeline(nullptr);
 	delete _pipeline;
@@ -969,6 +1053,66 @@ void OpenGLGraphicsManager::notifyContextDestroy() {
 	g_context.reset();
 }
 
+#if !USE_FORCED_GLES
+void OpenGLGraphicsManager::updateScalerPipeline() {
+	const int mode = _currentState.graphicsMode;
+	if (mode == _scalerPipelineMode) {
+		return;
+	}
+
+	delete _scalerPipeline;
+	_scalerPipeline = nullptr;
+	_scalerPipelineMode = mode;
+
+	if (mode == GFX_OPENGL) {
+		return;
+	}
+
+	ShaderManager::ShaderUsage usage;
+	switch (mode) {
+	case GFX_OPENGL_SCALE2X:
+		usage = ShaderManager::kScale2x;
+		break;
+
+	case GFX_OPENGL_HQX:
+		usage = ShaderManager::kHQx;
+		break;
+
+	case GFX_OPENGL_XBR:
+		usage = ShaderManager::kXBR;
+		break;
+
+	default:
+		usage = ShaderManager::kCRT;
+		break;
+	}
+
+	if (!g_context.shadersSupported || !g_context.framebufferObjectSupported || !ShaderMan.query(usage)->isValid()) {
+		warning("OpenGLGraphicsManager::updateScalerPipeline: Scaler shaders are not supported, drawing the game screen unscaled");
+		return;
+	}
+
+	_scalerPipeline = new ScalerPipeline();
+	switch (mode) {
+	case GFX_OPENGL_XBR:
+		// Two 2xBR passes give 4x, which smooths the diagonals further.
+		_scalerPipeline->addPass(ShaderMan.query(usage), 2);
+		_scalerPipeline->addPass(ShaderMan.query(usage), 2);
+		break;
+
+	case GFX_OPENGL_CRT:
+		// The CRT shader works at output resolution.
+		_scalerPipeline->addPass(ShaderMan.query(usage), 0);
+		break;
+
+	default:
+		_scalerPipeline->addPass(ShaderMan.query(usage), 2);
+		break;
+	}
+	_scalerPipeline->enableLinearFiltering(_currentState.filtering);
+}
+#endif
+
 Surface *OpenGLGraphicsManager::createSurface(const Graphics::PixelFormat &format, bool wantAlpha) {
 	GLenum glIntFormat, glFormat, glType;
 	if (format.bytesPerPixel == 1) {
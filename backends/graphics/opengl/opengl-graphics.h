@@ -47,10 +47,15 @@ class Surface;
 class Pipeline;
 #if !USE_FORCED_GLES
 class Shader;
+class ScalerPipeline;
 #endif
 
 enum {
-	GFX_OPENGL = 0
+	GFX_OPENGL = 0,
+	GFX_OPENGL_SCALE2X = 1,
+	GFX_OPENGL_HQX = 2,
+	GFX_OPENGL_XBR = 3,
+	GFX_OPENGL_CRT = 4
 };
 
 class OpenGLGraphicsManager : virtual public WindowedGraphicsManager {
@@ -95,6 +100,10 @@ public:
 	virtual Graphics::Surface *lockScreen() override;
 	virtual void unlockScreen() override;
 
+	virtual Graphics::Surface *getScreenBuffer(ScreenBufferListener *listener) override;
+	virtual void releaseScreenBuffer(ScreenBufferListener *listener) override;
+	virtual void markScreenDirty(const Common::Rect &r) override;
+
 	virtual void setFocusRectangle(const Common::Rect& rect) override;
 	virtual void clearFocusRectangle() override;
 
@@ -278,6 +287,24 @@ private:
 	 */
 	Pipeline *_pipeline;
 
+#if !USE_FORCED_GLES
+	/**
+	 * Shader passes the game screen is scaled with, or nullptr when it is
+	 * drawn directly.
+	 */
+	ScalerPipeline *_scalerPipeline;
+
+	/**
+	 * Graphics mode the scaler pipeline was set up for.
+	 */
+	int _scalerPipelineMode;
+
+	/**
+	 * Set up the scaler pipeline for the current graphics mode.
+	 */
+	void updateScalerPipeline();
+#endif
+
 protected:
 	/**
 	 * Query the address of an OpenGL function by name.
@@ -318,6 +345,16 @@ protected:
 	 */
 	Surface *_gameScreen;
 
+	/**
+	 * The client drawing straight into the pixels of the game screen.
+	 */
+	ScreenBufferListener *_screenBufferListener;
+
+	/**
+	 * Tell the client drawing into the game screen that it has to stop.
+	 */
+	void notifyScreenBufferReleased();
+
 	/**
 	 * The game palette if in CLUT8 mode.
 	 */
@@ -126,6 +126,12 @@ struct Context {
 	/** Whether FBO support is available or not. */
 	bool framebufferObjectSupported;
 
+	/** Whether pixel buffer objects can be used for texture uploads. */
+	bool pixelBufferObjectSupported;
+
+	/** Whether persistently mapped buffers (GL_ARB_buffer_storage) are available or not. */
+	bool bufferStorageSupported;
+
 #define GL_FUNC_DEF(ret, name, param) ret (GL_CALL_CONV *name)param
 #include "backends/graphics/opengl/opengl-func.h"
 #undef GL_FUNC_DEF
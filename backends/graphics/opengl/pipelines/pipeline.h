@@ -64,6 +64,11 @@ public:
 	 */
 	Framebuffer *setFramebuffer(Framebuffer *framebuffer);
 
+	/**
+	 * Query the framebuffer the pipeline renders to.
+	 */
+	Framebuffer *getFramebuffer() const { return _activeFramebuffer; }
+
 	/**
 	 * Set modulation color.
 	 *
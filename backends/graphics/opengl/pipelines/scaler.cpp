@@ -0,0 +1,98 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "backends/graphics/opengl/pipelines/scaler.h"
+#include "backends/graphics/opengl/shader.h"
+#include "backends/graphics/opengl/framebuffer.h"
+
+namespace OpenGL {
+
+#if !USE_FORCED_GLES
+ScalerPipeline::ScalerPipeline()
+    : _passes(), _linearFiltering(false) {
+}
+
+ScalerPipeline::~ScalerPipeline() {
+	for (uint i = 0; i < _passes.size(); ++i) {
+		delete _passes[i].pipeline;
+		delete _passes[i].target;
+	}
+}
+
+void ScalerPipeline::addPass(Shader *shader, uint factor) {
+	assert(_passes.empty() || _passes.back().factor != 0);
+
+	Pass pass;
+	pass.shader = shader;
+	pass.pipeline = new ShaderPipeline(shader);
+	pass.pipeline->setColor(1.0f, 1.0f, 1.0f, 1.0f);
+	pass.target = factor ? new TextureTarget() : nullptr;
+	pass.factor = factor;
+	_passes.push_back(pass);
+
+	enableLinearFiltering(_linearFiltering);
+}
+
+void ScalerPipeline::enableLinearFiltering(bool enable) {
+	_linearFiltering = enable;
+
+	if (!_passes.empty() && _passes.back().target) {
+		_passes.back().target->getTexture()->enableLinearFiltering(enable);
+	}
+}
+
+void ScalerPipeline::drawTexture(const GLTexture &texture, const GLfloat *coordinates) {
+	Pipeline *const output = g_context.getActivePipeline();
+	const GLTexture *input = &texture;
+	uint width = texture.getLogicalWidth();
+	uint height = texture.getLogicalHeight();
+
+	for (uint i = 0; i < _passes.size(); ++i) {
+		Pass &pass = _passes[i];
+		pass.shader->setUniform("textureSize", new ShaderUniformVector2(input->getWidth(), input->getHeight()));
+
+		if (!pass.target) {
+			// Draw the final pass straight to the output.
+			pass.pipeline->setFramebuffer(output->getFramebuffer());
+			g_context.setPipeline(pass.pipeline);
+			pass.pipeline->drawTexture(*input, coordinates);
+			g_context.setPipeline(output);
+			pass.pipeline->setFramebuffer(nullptr);
+			return;
+		}
+
+		width *= pass.factor;
+		height *= pass.factor;
+		pass.target->setSize(width, height);
+
+		pass.pipeline->setFramebuffer(pass.target);
+		g_context.setPipeline(pass.pipeline);
+		pass.pipeline->drawTexture(*input, 0, 0, width, height);
+		input = pass.target->getTexture();
+	}
+
+	g_context.setPipeline(output);
+	output->drawTexture(*input, coordinates);
+}
+#endif // !USE_FORCED_GLES
+
+} // End of namespace OpenGL
@@ -0,0 +1,97 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BACKENDS_GRAPHICS_OPENGL_PIPELINES_SCALER_H
+#define BACKENDS_GRAPHICS_OPENGL_PIPELINES_SCALER_H
+
+#include "backends/graphics/opengl/pipelines/shader.h"
+
+#include "common/array.h"
+
+namespace OpenGL {
+
+#if !USE_FORCED_GLES
+class TextureTarget;
+
+/**
+ * Scales textures on the GPU by running them through shader passes.
+ *
+ * Every pass renders into a texture target, which is larger than its input
+ * by the factor of the pass. The result of the last pass is then drawn with
+ * the active pipeline. A final pass with factor 0 renders straight into the
+ * framebuffer of the active pipeline instead.
+ */
+class ScalerPipeline {
+public:
+	ScalerPipeline();
+	~ScalerPipeline();
+
+	/**
+	 * Append a pass.
+	 *
+	 * @param shader Shader to use. Its "textureSize" uniform is set to the
+	 *               size of the input texture.
+	 * @param factor Scale factor of the pass, or 0 for a final pass drawing
+	 *               to the framebuffer of the active pipeline.
+	 */
+	void addPass(Shader *shader, uint factor);
+
+	/**
+	 * Enable or disable linear filtering when drawing the result of the
+	 * last pass.
+	 */
+	void enableLinearFiltering(bool enable);
+
+	/**
+	 * Scale a texture and draw it to the framebuffer of the active pipeline.
+	 *
+	 * @param texture     Texture to scale.
+	 * @param coordinates x1, y1, x2, y2 coordinates where to draw the texture.
+	 */
+	void drawTexture(const GLTexture &texture, const GLfloat *coordinates);
+
+	void drawTexture(const GLTexture &texture, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+		const GLfloat coordinates[4*2] = {
+			x,     y,
+			x + w, y,
+			x,     y + h,
+			x + w, y + h
+		};
+		drawTexture(texture, coordinates);
+	}
+
+private:
+	struct Pass {
+		Shader *shader;
+		Pipeline *pipeline;
+		TextureTarget *target;
+		uint factor;
+	};
+
+	Common::Array<Pass> _passes;
+	bool _linearFiltering;
+};
+#endif // !USE_FORCED_GLES
+
+} // End of namespace OpenGL
+
+#endif
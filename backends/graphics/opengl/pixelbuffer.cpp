@@ -0,0 +1,216 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "backends/graphics/opengl/pixelbuffer.h"
+
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+
+#include "common/textconsole.h"
+
+namespace Common {
+DECLARE_SINGLETON(OpenGL::PixelBufferManager);
+}
+
+namespace OpenGL {
+
+namespace {
+void copyArea(byte *dst, const Common::Rect &area, const Graphics::Surface &src) {
+	const uint rowSize = area.width() * src.format.bytesPerPixel;
+	const byte *srcRow = (const byte *)src.getBasePtr(area.left, area.top);
+
+	// Rows are stored without padding, as GL_UNPACK_ALIGNMENT is 1.
+	for (int y = area.height(); y > 0; --y) {
+		memcpy(dst, srcRow, rowSize);
+		dst += rowSize;
+		srcRow += src.pitch;
+	}
+}
+} // End of anonymous namespace
+
+PixelBufferManager::PixelBufferManager()
+    : _persistent(false), _buffers(), _nextBuffer(0),
+      _mapping(nullptr), _segmentSize(0), _segment(0), _offset(0), _fences() {
+}
+
+PixelBufferManager::~PixelBufferManager() {
+	// The buffers belong to the context, which is gone by now.
+}
+
+void PixelBufferManager::notifyDestroy() {
+	destroyBuffers();
+}
+
+void PixelBufferManager::notifyCreate() {
+	destroyBuffers();
+
+	if (g_context.bufferStorageSupported && createPersistentBuffer(kDefaultSegmentSize)) {
+		return;
+	}
+
+	if (g_context.pixelBufferObjectSupported) {
+		createOrphanedBuffers();
+	}
+}
+
+bool PixelBufferManager::createPersistentBuffer(uint segmentSize) {
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	void *mapping = nullptr;
+
+	GL_CALL(glGenBuffers(1, &_buffers[0]));
+	GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _buffers[0]));
+	GL_CALL(glBufferStorage(GL_PIXEL_UNPACK_BUFFER, segmentSize * kSegmentCount, nullptr, flags));
+	GL_ASSIGN(mapping, glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, segmentSize * kSegmentCount, flags));
+	GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+
+	if (!mapping) {
+		warning("OpenGL: Could not map pixel buffer persistently");
+		destroyBuffers();
+		return false;
+	}
+
+	_persistent = true;
+	_mapping = (byte *)mapping;
+	_segmentSize = segmentSize;
+	_segment = 0;
+	_offset = 0;
+	return true;
+}
+
+void PixelBufferManager::createOrphanedBuffers() {
+	GL_CALL(glGenBuffers(kSegmentCount, _buffers));
+	_persistent = false;
+	_nextBuffer = 0;
+}
+
+void PixelBufferManager::destroyBuffers() {
+	for (uint i = 0; i < kSegmentCount; ++i) {
+		if (_fences[i]) {
+			GL_CALL(glDeleteSync(_fences[i]));
+			_fences[i] = nullptr;
+		}
+	}
+
+	// Deleting a buffer also unmaps it.
+	if (_buffers[0]) {
+		GL_CALL(glDeleteBuffers(_persistent ? 1 : kSegmentCount, _buffers));
+	}
+
+	for (uint i = 0; i < kSegmentCount; ++i) {
+		_buffers[i] = 0;
+	}
+
+	_persistent = false;
+	_mapping = nullptr;
+	_segmentSize = 0;
+}
+
+void PixelBufferManager::nextSegment() {
+	// Uploads from the current segment have finished once this fence is
+	// signaled.
+	GL_ASSIGN(_fences[_segment], glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+	_segment = (_segment + 1) % kSegmentCount;
+	_offset = 0;
+	waitForSegment(_segment);
+}
+
+void PixelBufferManager::waitForSegment(uint segment) {
+	if (!_fences[segment]) {
+		return;
+	}
+
+	GLenum result;
+	do {
+		GL_ASSIGN(result, glClientWaitSync(_fences[segment], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000));
+	} while (result == GL_TIMEOUT_EXPIRED);
+
+	GL_CALL(glDeleteSync(_fences[segment]));
+	_fences[segment] = nullptr;
+}
+
+bool PixelBufferManager::upload(const Common::Rect &area, const Graphics::Surface &src, GLenum glFormat, GLenum glType) {
+	if (!_buffers[0] || area.isEmpty()) {
+		return false;
+	}
+
+	const uint size = area.width() * area.height() * src.format.bytesPerPixel;
+	GLintptr offset = 0;
+
+	if (_persistent) {
+		// Grow the segments in case the area does not fit. The old buffer
+		// is only released by the driver once pending uploads are done.
+		if (size > _segmentSize) {
+			destroyBuffers();
+			if (!createPersistentBuffer((size + 0xFFFFF) & ~0xFFFFF)) {
+				createOrphanedBuffers();
+				return upload(area, src, glFormat, glType);
+			}
+		}
+
+		if (_offset + size > _segmentSize) {
+			nextSegment();
+		}
+
+		offset = _segment * _segmentSize + _offset;
+		copyArea(_mapping + offset, area, src);
+
+		// Keep every upload aligned for any pixel type.
+		_offset += (size + 15) & ~15;
+
+		GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _buffers[0]));
+	} else {
+		GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _buffers[_nextBuffer]));
+		_nextBuffer = (_nextBuffer + 1) % kSegmentCount;
+
+		// Orphan the old storage, so that mapping does not have to wait for
+		// pending uploads from it.
+		GL_CALL(glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW));
+
+		void *mapping = nullptr;
+		GL_ASSIGN(mapping, glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY));
+		if (!mapping) {
+			GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+			return false;
+		}
+
+		copyArea((byte *)mapping, area, src);
+
+		// The contents are lost in case the buffer got corrupted meanwhile,
+		// e.g. by a mode switch.
+		GLboolean intact = GL_FALSE;
+		GL_ASSIGN(intact, glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+		if (!intact) {
+			GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+			return false;
+		}
+	}
+
+	// With a buffer bound, the pixel pointer is an offset into it.
+	GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+	                        glFormat, glType, (const GLvoid *)offset));
+	GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+	return true;
+}
+
+} // End of namespace OpenGL
+
+#endif // !USE_FORCED_GLES && !USE_FORCED_GLES2
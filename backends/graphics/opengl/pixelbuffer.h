@@ -0,0 +1,112 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BACKENDS_GRAPHICS_OPENGL_PIXELBUFFER_H
+#define BACKENDS_GRAPHICS_OPENGL_PIXELBUFFER_H
+
+#include "backends/graphics/opengl/opengl-sys.h"
+
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+
+#include "graphics/surface.h"
+
+#include "common/rect.h"
+#include "common/singleton.h"
+
+namespace OpenGL {
+
+/**
+ * Streams texture uploads through a ring of pixel buffer objects.
+ *
+ * Uploading with glTexSubImage2D straight from client memory makes the
+ * driver copy the data before the call returns, which stalls on many
+ * drivers. Copying the data into a buffer object first lets the transfer
+ * to the texture run asynchronously.
+ *
+ * Where GL 4.4 or GL_ARB_buffer_storage is available, a single buffer is
+ * persistently mapped and split into kSegmentCount segments, each of which
+ * is guarded by a fence before it is reused. Otherwise kSegmentCount
+ * buffers are used in turn and orphaned before every upload.
+ */
+class PixelBufferManager : public Common::Singleton<PixelBufferManager> {
+public:
+	/**
+	 * Notify pixel buffer manager about context destruction.
+	 */
+	void notifyDestroy();
+
+	/**
+	 * Notify pixel buffer manager about context creation.
+	 */
+	void notifyCreate();
+
+	/**
+	 * Upload an area of a surface to the texture bound to GL_TEXTURE_2D.
+	 *
+	 * @param area     The area to upload. It is placed at the same position
+	 *                 in the texture.
+	 * @param src      Surface containing the pixel data.
+	 * @param glFormat The input format of the texture.
+	 * @param glType   The input type of the texture.
+	 * @return Whether the area was uploaded. If not, the caller needs to
+	 *         upload it from client memory.
+	 */
+	bool upload(const Common::Rect &area, const Graphics::Surface &src, GLenum glFormat, GLenum glType);
+
+private:
+	friend class Common::Singleton<SingletonBaseType>;
+	PixelBufferManager();
+	~PixelBufferManager();
+
+	enum {
+		kSegmentCount = 3,
+		kDefaultSegmentSize = 4 * 1024 * 1024
+	};
+
+	bool createPersistentBuffer(uint segmentSize);
+	void createOrphanedBuffers();
+	void destroyBuffers();
+
+	/** Fence the current segment and wait until the next one is free. */
+	void nextSegment();
+	void waitForSegment(uint segment);
+
+	/** Whether a persistently mapped buffer is used. */
+	bool _persistent;
+	GLuint _buffers[kSegmentCount];
+	uint _nextBuffer;
+
+	byte *_mapping;
+	uint _segmentSize;
+	uint _segment;
+	uint _offset;
+	GLsync _fences[kSegmentCount];
+};
+
+} // End of namespace OpenGL
+
+/** Shortcut for accessing the pixel buffer manager. */
+#define PixelBufferMan (OpenGL::PixelBufferManager::instance())
+
+#endif // !USE_FORCED_GLES && !USE_FORCED_GLES2
+
+#endif
@@ -77,6 +77,140 @@ const char *const g_lookUpFragmentShader =
 	"\tgl_FragColor = blendColor * texture2D(palette, vec2(index.a * adjustFactor, 0.0));\n"
 	"}\n";
 
+// The scaler shaders sample the texels around the one at texCoord. They
+// need the size of the whole texture in texels in textureSize.
+#define SCALER_SHADER_HEADER \
+	"varying vec2 texCoord;\n" \
+	"varying vec4 blendColor;\n" \
+	"\n" \
+	"uniform sampler2D texture;\n" \
+	"uniform vec2 textureSize;\n" \
+	"\n"
+
+// For scaling by 2, the neighbourhood is mirrored so that the rules only
+// need to be written for one of the four output pixels of a texel. dir
+// points from the centre of the texel towards the output pixel.
+#define SCALER_SHADER_MIRROR \
+	"\tvec2 pos = texCoord * textureSize;\n" \
+	"\tvec2 centre = (floor(pos) + 0.5) / textureSize;\n" \
+	"\tvec2 dir = step(0.5, fract(pos)) * 2.0 - 1.0;\n" \
+	"\tvec2 dx = vec2(dir.x, 0.0) / textureSize;\n" \
+	"\tvec2 dy = vec2(0.0, dir.y) / textureSize;\n" \
+	"\n"
+
+const char *const g_scale2xFragmentShader =
+	SCALER_SHADER_HEADER
+	"void main(void) {\n"
+	SCALER_SHADER_MIRROR
+	"\tvec4 E = texture2D(texture, centre);\n"
+	"\tvec4 D = texture2D(texture, centre + dx);\n"
+	"\tvec4 B = texture2D(texture, centre + dy);\n"
+	"\tvec4 F = texture2D(texture, centre - dx);\n"
+	"\tvec4 H = texture2D(texture, centre - dy);\n"
+	"\n"
+	"\tgl_FragColor = blendColor * ((D == B && B != F && D != H) ? D : E);\n"
+	"}\n";
+
+const char *const g_hqxFragmentShader =
+	SCALER_SHADER_HEADER
+	"// Same color comparison as the CPU hq scalers\n"
+	"const vec3 threshold = vec3(48.0 / 255.0, 7.0 / 255.0, 6.0 / 255.0);\n"
+	"\n"
+	"vec3 toYUV(vec4 c) {\n"
+	"\treturn vec3((c.r + c.g + c.b) / 4.0, (c.r - c.b) / 4.0, (2.0 * c.g - c.r - c.b) / 8.0);\n"
+	"}\n"
+	"\n"
+	"bool differ(vec4 a, vec4 b) {\n"
+	"\treturn any(greaterThan(abs(toYUV(a) - toYUV(b)), threshold));\n"
+	"}\n"
+	"\n"
+	"void main(void) {\n"
+	SCALER_SHADER_MIRROR
+	"\tvec4 E = texture2D(texture, centre);\n"
+	"\tvec4 H = texture2D(texture, centre + dx);\n"
+	"\tvec4 V = texture2D(texture, centre + dy);\n"
+	"\n"
+	"\tbool edgeH = differ(E, H);\n"
+	"\tbool edgeV = differ(E, V);\n"
+	"\n"
+	"\tvec4 result;\n"
+	"\tif (edgeH && edgeV) {\n"
+	"\t\t// Only round off corners of diagonal edges\n"
+	"\t\tresult = differ(H, V) ? E : (E * 2.0 + H + V) / 4.0;\n"
+	"\t} else if (edgeH) {\n"
+	"\t\tresult = (E * 3.0 + V) / 4.0;\n"
+	"\t} else if (edgeV) {\n"
+	"\t\tresult = (E * 3.0 + H) / 4.0;\n"
+	"\t} else {\n"
+	"\t\tresult = (E * 2.0 + H + V) / 4.0;\n"
+	"\t}\n"
+	"\n"
+	"\tgl_FragColor = blendColor * result;\n"
+	"}\n";
+
+const char *const g_xbrFragmentShader =
+	SCALER_SHADER_HEADER
+	"float luma(vec4 c) {\n"
+	"\treturn dot(c.rgb, vec3(0.299, 0.587, 0.114));\n"
+	"}\n"
+	"\n"
+	"void main(void) {\n"
+	SCALER_SHADER_MIRROR
+	"\tvec4 E = texture2D(texture, centre);\n"
+	"\tvec4 F = texture2D(texture, centre + dx);\n"
+	"\tvec4 H = texture2D(texture, centre + dy);\n"
+	"\n"
+	"\tfloat e  = luma(E);\n"
+	"\tfloat f  = luma(F);\n"
+	"\tfloat h  = luma(H);\n"
+	"\tfloat i  = luma(texture2D(texture, centre + dx + dy));\n"
+	"\tfloat b  = luma(texture2D(texture, centre - dy));\n"
+	"\tfloat d  = luma(texture2D(texture, centre - dx));\n"
+	"\tfloat c  = luma(texture2D(texture, centre + dx - dy));\n"
+	"\tfloat g  = luma(texture2D(texture, centre - dx + dy));\n"
+	"\tfloat f4 = luma(texture2D(texture, centre + 2.0 * dx));\n"
+	"\tfloat h5 = luma(texture2D(texture, centre + 2.0 * dy));\n"
+	"\tfloat i4 = luma(texture2D(texture, centre + 2.0 * dx + dy));\n"
+	"\tfloat i5 = luma(texture2D(texture, centre + dx + 2.0 * dy));\n"
+	"\n"
+	"\t// There is an edge between F and H if the colors change less along\n"
+	"\t// it than across it\n"
+	"\tfloat along  = abs(e - c) + abs(e - g) + abs(i - f4) + abs(i - h5) + 4.0 * abs(h - f);\n"
+	"\tfloat across = abs(h - d) + abs(h - i5) + abs(f - i4) + abs(f - b) + 4.0 * abs(e - i);\n"
+	"\n"
+	"\tvec4 result = E;\n"
+	"\tif (along < across && E != F && E != H) {\n"
+	"\t\tresult = mix(E, abs(e - f) <= abs(e - h) ? F : H, 0.5);\n"
+	"\t}\n"
+	"\n"
+	"\tgl_FragColor = blendColor * result;\n"
+	"}\n";
+
+const char *const g_crtFragmentShader =
+	SCALER_SHADER_HEADER
+	"void main(void) {\n"
+	"\tvec2 pos = texCoord * textureSize;\n"
+	"\n"
+	"\t// Blend horizontally between the two closest texels\n"
+	"\tvec2 texel = floor(vec2(pos.x - 0.5, pos.y)) + 0.5;\n"
+	"\tvec4 left = texture2D(texture, texel / textureSize);\n"
+	"\tvec4 right = texture2D(texture, (texel + vec2(1.0, 0.0)) / textureSize);\n"
+	"\tvec3 color = mix(left.rgb, right.rgb, smoothstep(0.2, 0.8, pos.x - texel.x));\n"
+	"\n"
+	"\t// Darken the space between scan lines\n"
+	"\tfloat dist = fract(pos.y) - 0.5;\n"
+	"\tcolor *= exp(-8.0 * dist * dist);\n"
+	"\n"
+	"\t// Aperture grille\n"
+	"\tfloat column = mod(floor(gl_FragCoord.x), 3.0);\n"
+	"\tcolor *= vec3(column < 0.5 ? 1.0 : 0.85, (column > 0.5 && column < 1.5) ? 1.0 : 0.85, column > 1.5 ? 1.0 : 0.85);\n"
+	"\n"
+	"\tgl_FragColor = blendColor * vec4(min(color * 1.5, 1.0), 1.0);\n"
+	"}\n";
+
+#undef SCALER_SHADER_MIRROR
+#undef SCALER_SHADER_HEADER
+
 
 // Taken from: https://en.wikibooks.org/wiki/OpenGL_Programming/Modern_OpenGL_Tutorial_03#OpenGL_ES_2_portability
 const char *const g_precisionDefines =
@@ -104,6 +238,10 @@ void ShaderUniformFloat::set(GLint location) const {
 	GL_CALL(glUniform1f(location, _value));
 }
 
+void ShaderUniformVector2::set(GLint location) const {
+	GL_CALL(glUniform2f(location, _x, _y));
+}
+
 void ShaderUniformMatrix44::set(GLint location) const {
 	GL_CALL(glUniformMatrix4fv(location, 1, GL_FALSE, _matrix));
 }
@@ -310,6 +448,10 @@ void ShaderManager::notifyCreate() {
 		_builtIn[kDefault] = new Shader(g_defaultVertexShader, g_defaultFragmentShader);
 		_builtIn[kCLUT8LookUp] = new Shader(g_defaultVertexShader, g_lookUpFragmentShader);
 		_builtIn[kCLUT8LookUp]->setUniform1I("palette", 1);
+		_builtIn[kScale2x] = new Shader(g_defaultVertexShader, g_scale2xFragmentShader);
+		_builtIn[kHQx] = new Shader(g_defaultVertexShader, g_hqxFragmentShader);
+		_builtIn[kXBR] = new Shader(g_defaultVertexShader, g_xbrFragmentShader);
+		_builtIn[kCRT] = new Shader(g_defaultVertexShader, g_crtFragmentShader);
 
 		for (uint i = 0; i < kMaxUsages; ++i) {
 			_builtIn[i]->setUniform1I("texture", 0);
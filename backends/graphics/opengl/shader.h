@@ -74,6 +74,19 @@ private:
 	const GLfloat _value;
 };
 
+/**
+ * 2D vector value for a shader uniform.
+ */
+class ShaderUniformVector2 : public ShaderUniformValue {
+public:
+	ShaderUniformVector2(GLfloat x, GLfloat y) : _x(x), _y(y) {}
+
+	virtual void set(GLint location) const override;
+
+private:
+	const GLfloat _x, _y;
+};
+
 /**
  * 4x4 Matrix value for a shader uniform.
  */
@@ -110,6 +123,11 @@ public:
 	 */
 	bool recreate();
 
+	/**
+	 * Test whether the shader program has been created successfully.
+	 */
+	bool isValid() const { return _program != 0; }
+
 	/**
 	 * Make shader active.
 	 */
@@ -249,6 +267,18 @@ public:
 		/** CLUT8 look up shader. */
 		kCLUT8LookUp,
 
+		/** Scale2x scaler shader, scaling by 2. */
+		kScale2x,
+
+		/** HQx style scaler shader, scaling by 2. */
+		kHQx,
+
+		/** xBR scaler shader, scaling by 2. */
+		kXBR,
+
+		/** CRT emulation shader, drawing at the output size. */
+		kCRT,
+
 		/** Number of built-in shaders. Should not be used for query. */
 		kMaxUsages
 	};
@@ -25,6 +25,7 @@
 #include "backends/graphics/opengl/pipelines/pipeline.h"
 #include "backends/graphics/opengl/pipelines/clut8.h"
 #include "backends/graphics/opengl/framebuffer.h"
+#include "backends/graphics/opengl/pixelbuffer.h"
 
 #include "common/rect.h"
 #include "common/textconsole.h"
@@ -146,6 +147,14 @@ void GLTexture::updateArea(const Common::Rect &area, const Graphics::Surface &sr
 	// Set the texture on the active texture unit.
 	bind();
 
+#if !USE_FORCED_GLES && !USE_FORCED_GLES2
+	// Stream the area through a pixel buffer object when possible. This only
+	// copies the area itself and does not stall until the upload is done.
+	if (PixelBufferMan.upload(area, src, _glFormat, _glType)) {
+		return;
+	}
+#endif
+
 	// Update the actual texture.
 	// Although we have the area of the texture buffer we want to update we
 	// cannot take advantage of the left/right boundries here because it is
@@ -176,20 +185,24 @@ Surface::Surface()
     : _allDirty(false), _dirtyArea() {
 }
 
-void Surface::copyRectToTexture(uint x, uint y, uint w, uint h, const void *srcPtr, uint srcPitch) {
-	Graphics::Surface *dstSurf = getSurface();
-	assert(x + w <= dstSurf->w);
-	assert(y + h <= dstSurf->h);
-
+void Surface::addDirtyArea(const Common::Rect &r) {
 	// *sigh* Common::Rect::extend behaves unexpected whenever one of the two
 	// parameters is an empty rect. Thus, we check whether the current dirty
 	// area is valid. In case it is not we simply use the parameters as new
 	// dirty area. Otherwise, we simply call extend.
 	if (_dirtyArea.isEmpty()) {
-		_dirtyArea = Common::Rect(x, y, x + w, y + h);
+		_dirtyArea = r;
 	} else {
-		_dirtyArea.extend(Common::Rect(x, y, x + w, y + h));
+		_dirtyArea.extend(r);
 	}
+}
+
+void Surface::copyRectToTexture(uint x, uint y, uint w, uint h, const void *srcPtr, uint srcPitch) {
+	Graphics::Surface *dstSurf = getSurface();
+	assert(x + w <= dstSurf->w);
+	assert(y + h <= dstSurf->h);
+
+	addDirtyArea(Common::Rect(x, y, x + w, y + h));
 
 	const byte *src = (const byte *)srcPtr;
 	byte *dst = (byte *)dstSurf->getBasePtr(x, y);
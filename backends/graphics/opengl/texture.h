@@ -200,6 +200,12 @@ public:
 	 */
 	void fill(uint32 color);
 
+	/**
+	 * Mark an area of the surface as changed, so that the next call to
+	 * updateGLTexture() uploads it.
+	 */
+	void addDirtyArea(const Common::Rect &r);
+
 	void flagDirty() { _allDirty = true; }
 	virtual bool isDirty() const { return _allDirty || !_dirtyArea.isEmpty(); }
 
@@ -336,6 +336,10 @@ void OpenGLSdlGraphicsManager::updateScreen() {
 		--_ignoreResizeEvents;
 	}
 
+	if (!beginPresent()) {
+		return;
+	}
+
 	OpenGLGraphicsManager::updateScreen();
 }
 
@@ -401,6 +405,7 @@ void OpenGLSdlGraphicsManager::refreshScreen() {
 #else
 	SDL_GL_SwapBuffers();
 #endif
+	endPresent();
 }
 
 void *OpenGLSdlGraphicsManager::getProcAddress(const char *name) const {
@@ -506,6 +511,12 @@ bool OpenGLSdlGraphicsManager::setupMode(uint width, uint height) {
 		return false;
 	}
 
+	// Align swapping buffers to the vertical blank when frame pacing is
+	// enabled.
+	if (_framePacer.isEnabled()) {
+		SDL_GL_SetSwapInterval(1);
+	}
+
 	notifyContextCreate(rgba8888, rgba8888);
 	int actualWidth, actualHeight;
 	getWindowSizeFromSdl(&actualWidth, &actualHeight);
@@ -541,6 +552,14 @@ bool OpenGLSdlGraphicsManager::setupMode(uint width, uint height) {
 		notifyContextDestroy();
 	}
 
+#if SDL_VERSION_ATLEAST(1, 2, 10)
+	// Align swapping buffers to the vertical blank when frame pacing is
+	// enabled.
+	if (_framePacer.isEnabled()) {
+		SDL_GL_SetAttribute(SDL_GL_SWAP_CONTROL, 1);
+	}
+#endif
+
 	_hwScreen = SDL_SetVideoMode(width, height, 32, flags);
 
 	if (!_hwScreen) {
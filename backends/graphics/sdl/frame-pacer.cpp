@@ -0,0 +1,84 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "backends/graphics/sdl/frame-pacer.h"
+
+#include "common/util.h"
+
+FramePacer::FramePacer()
+    : _enabled(false), _pending(false), _presented(false), _interval(0), _lastPresent(0),
+      _frameTime(0), _jitter(0) {
+	setRefreshRate(0);
+}
+
+void FramePacer::setEnabled(bool enable) {
+	_enabled = enable;
+	_pending = false;
+}
+
+void FramePacer::setRefreshRate(int rate) {
+	if (rate <= 0) {
+		rate = 60;
+	}
+
+	_interval = 1000000 / rate;
+}
+
+bool FramePacer::requestPresent(uint64 now) {
+	if (!_enabled || !_presented) {
+		return true;
+	}
+
+	// Once the next refresh interval is about to start, there is nothing
+	// left to coalesce with.
+	_pending = !isIntervalEnding(now);
+	return !_pending;
+}
+
+bool FramePacer::isPresentDue(uint64 now) const {
+	return _pending && isIntervalEnding(now);
+}
+
+bool FramePacer::isIntervalEnding(uint64 now) const {
+	// Leave a quarter of the interval for drawing the frame, so that it is
+	// ready in time for the vertical blank.
+	return now - _lastPresent + _interval / 4 >= _interval;
+}
+
+void FramePacer::notifyPresented(uint64 now) {
+	if (_presented && now - _lastPresent <= kMaxFrameTime) {
+		const int32 frameTime = (int32)(now - _lastPresent);
+
+		if (_frameTime == 0) {
+			_frameTime = frameTime << kAverageShift;
+		} else {
+			_frameTime += frameTime - (int32)(_frameTime >> kAverageShift);
+		}
+
+		const int32 deviation = ABS(frameTime - (int32)(_frameTime >> kAverageShift));
+		_jitter += deviation - (int32)(_jitter >> kAverageShift);
+	}
+
+	_pending = false;
+	_presented = true;
+	_lastPresent = now;
+}
@@ -0,0 +1,108 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BACKENDS_GRAPHICS_SDL_FRAMEPACER_H
+#define BACKENDS_GRAPHICS_SDL_FRAMEPACER_H
+
+#include "common/scummsys.h"
+
+/**
+ * Schedules presenting frames to the display.
+ *
+ * Engines may call updateScreen several times per refresh interval of the
+ * display. When pacing is enabled, only the first of these requests is
+ * presented right away; the others are coalesced into a single pending
+ * frame, which is presented once the next refresh interval starts.
+ *
+ * Independently of that, the time between presented frames is measured, so
+ * that frame time and jitter can be shown to the user.
+ *
+ * All times are in microseconds.
+ */
+class FramePacer {
+public:
+	FramePacer();
+
+	/**
+	 * Enable or disable coalescing of present requests.
+	 */
+	void setEnabled(bool enable);
+	bool isEnabled() const { return _enabled; }
+
+	/**
+	 * Set the refresh rate of the display in Hz. Non positive rates select
+	 * the default of 60 Hz.
+	 */
+	void setRefreshRate(int rate);
+
+	/**
+	 * Request presenting a frame.
+	 *
+	 * @param now Current time.
+	 * @return true when the frame should be presented now, false when it
+	 *         has been made pending instead.
+	 */
+	bool requestPresent(uint64 now);
+
+	/**
+	 * Check whether a pending frame should be presented now.
+	 */
+	bool isPresentDue(uint64 now) const;
+
+	/**
+	 * Notify the pacer that a frame was presented.
+	 */
+	void notifyPresented(uint64 now);
+
+	/**
+	 * Average time between presented frames.
+	 */
+	uint32 getFrameTime() const { return _frameTime >> kAverageShift; }
+
+	/**
+	 * Average deviation of the time between presented frames from its
+	 * average.
+	 */
+	uint32 getJitter() const { return _jitter >> kAverageShift; }
+
+private:
+	enum {
+		/** Averages are kept with this many fraction bits. */
+		kAverageShift = 4,
+		/** Longer frame times are pauses of the engine and not measured. */
+		kMaxFrameTime = 250000
+	};
+
+	bool isIntervalEnding(uint64 now) const;
+
+	bool _enabled;
+	bool _pending;
+	bool _presented;
+
+	uint32 _interval;
+	uint64 _lastPresent;
+
+	uint32 _frameTime;
+	uint32 _jitter;
+};
+
+#endif
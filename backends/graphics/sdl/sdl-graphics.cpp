@@ -24,16 +24,20 @@
 #include "backends/platform/sdl/sdl-sys.h"
 #include "backends/events/sdl/sdl-events.h"
 #include "common/config-manager.h"
+#include "common/str.h"
 #include "common/textconsole.h"
 #include "graphics/scaler/aspect.h"
 
 SdlGraphicsManager::SdlGraphicsManager(SdlEventSource *source, SdlWindow *window)
-	: _eventSource(source), _window(window), _hwScreen(nullptr)
+	: _eventSource(source), _window(window), _hwScreen(nullptr), _showFrameTime(false), _lastFrameTimeMessage(0)
 #if SDL_VERSION_ATLEAST(2, 0, 0)
 	, _allowWindowSizeReset(false), _hintedWidth(0), _hintedHeight(0), _lastFlags(0)
 #endif
 {
 	SDL_GetMouseState(&_cursorX, &_cursorY);
+
+	_framePacer.setEnabled(ConfMan.getBool("frame_pacing"));
+	_showFrameTime = ConfMan.getBool("show_frame_time");
 }
 
 void SdlGraphicsManager::activateManager() {
@@ -226,6 +230,43 @@ void SdlGraphicsManager::setSystemMousePosition(const int x, const int y) {
 	}
 }
 
+void SdlGraphicsManager::presentPendingFrame() {
+	if (_framePacer.isPresentDue(getPresentTime())) {
+		updateScreen();
+	}
+}
+
+bool SdlGraphicsManager::beginPresent() {
+	const uint64 now = getPresentTime();
+
+	// Refresh the frame time message before it fades out.
+	if (_showFrameTime && now - _lastFrameTimeMessage >= 500000) {
+		_lastFrameTimeMessage = now;
+
+		const uint32 frameTime = _framePacer.getFrameTime();
+		const uint32 jitter = _framePacer.getJitter();
+		displayMessageOnOSD(Common::String::format("Frame time: %u.%02u ms, jitter: %u.%02u ms",
+		                                           frameTime / 1000, frameTime % 1000 / 10,
+		                                           jitter / 1000, jitter % 1000 / 10).c_str());
+	}
+
+	return _framePacer.requestPresent(now);
+}
+
+void SdlGraphicsManager::endPresent() {
+	_framePacer.notifyPresented(getPresentTime());
+}
+
+uint64 SdlGraphicsManager::getPresentTime() {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	const uint64 counter = SDL_GetPerformanceCounter();
+	const uint64 frequency = SDL_GetPerformanceFrequency();
+	return counter / frequency * 1000000 + counter % frequency * 1000000 / frequency;
+#else
+	return (uint64)SDL_GetTicks() * 1000;
+#endif
+}
+
 void SdlGraphicsManager::handleResizeImpl(const int width, const int height) {
 	_eventSource->resetKeyboardEmulation(width - 1, height - 1);
 	_forceRedraw = true;
@@ -260,6 +301,13 @@ bool SdlGraphicsManager::createOrUpdateWindow(int width, int height, const Uint3
 
 		_lastFlags = flags;
 		_allowWindowSizeReset = false;
+
+		// Pace frames to the refresh rate of the display showing the window.
+		SDL_DisplayMode displayMode;
+		const int displayIndex = SDL_GetWindowDisplayIndex(_window->getSDLWindow());
+		if (displayIndex >= 0 && SDL_GetCurrentDisplayMode(displayIndex, &displayMode) == 0) {
+			_framePacer.setRefreshRate(displayMode.refresh_rate);
+		}
 	}
 
 	return true;
@@ -24,6 +24,7 @@
 #define BACKENDS_GRAPHICS_SDL_SDLGRAPHICS_H
 
 #include "backends/graphics/windowed.h"
+#include "backends/graphics/sdl/frame-pacer.h"
 #include "backends/platform/sdl/sdl-window.h"
 
 #include "common/rect.h"
@@ -91,6 +92,14 @@ public:
 
 	virtual bool showMouse(const bool visible) override;
 
+	/**
+	 * Present a frame which was held back by frame pacing, in case its
+	 * refresh interval is about to end.
+	 *
+	 * This is called whenever events are polled.
+	 */
+	void presentPendingFrame();
+
 	/**
 	 * A (subset) of the graphic manager's state. This is used when switching
 	 * between different SDL graphic managers at runtime.
@@ -152,6 +161,28 @@ protected:
 
 	virtual void setSystemMousePosition(const int x, const int y) override;
 
+	/**
+	 * Called by updateScreen before it draws the screen.
+	 *
+	 * @return false when frame pacing holds the frame back, in which case
+	 *         the screen must not be updated.
+	 */
+	bool beginPresent();
+
+	/**
+	 * Called after a frame has been presented to the display.
+	 */
+	void endPresent();
+
+	/**
+	 * Returns the current time in microseconds, used for frame pacing.
+	 */
+	static uint64 getPresentTime();
+
+	FramePacer _framePacer;
+	bool _showFrameTime;
+	uint64 _lastFrameTimeMessage;
+
 	virtual void handleResizeImpl(const int width, const int height) override;
 
 #if SDL_VERSION_ATLEAST(2, 0, 0)
@@ -27,7 +27,9 @@
 #include "backends/events/sdl/sdl-events.h"
 #include "backends/platform/sdl/sdl.h"
 #include "common/config-manager.h"
+#include "common/jobs.h"
 #include "common/mutex.h"
+#include "common/region.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #include "common/util.h"
@@ -35,6 +37,7 @@
 #ifdef USE_RGB_COLOR
 #include "common/list.h"
 #endif
+#include "graphics/conversion.h"
 #include "graphics/font.h"
 #include "graphics/fontman.h"
 #include "graphics/scaler.h"
@@ -46,6 +49,98 @@
 #include "image/png.h"
 #endif
 
+namespace {
+
+/**
+ * Minimal number of pixels of a band drawn by a single job.
+ */
+const int kDirtyBandMinPixels = 8192;
+
+/**
+ * Replace the dirty rects by the disjoint rects of their union, so that
+ * overlapping or repeated rects are only drawn once. If that takes more than
+ * maxCount rects, they are replaced by the single rect bounding them.
+ *
+ * @return The new number of rects.
+ */
+int mergeRects(SDL_Rect *rects, int count, int maxCount) {
+	Common::Region region;
+	for (int i = 0; i < count; ++i) {
+		const SDL_Rect &r = rects[i];
+		region.unite(Common::Rect(r.x, r.y, r.x + r.w, r.y + r.h));
+	}
+
+	if ((int)region.size() > maxCount)
+		region = Common::Region(region.getBounds());
+
+	count = 0;
+	for (Common::Region::const_iterator i = region.begin(); i != region.end(); ++i, ++count) {
+		rects[count].x = i->left;
+		rects[count].y = i->top;
+		rects[count].w = i->width();
+		rects[count].h = i->height();
+	}
+
+	return count;
+}
+
+/**
+ * Disjoint bands of the dirty rects, along with everything needed to draw
+ * them from worker threads.
+ */
+struct DirtyBands {
+	Common::Array<SDL_Rect> bands;
+
+	const byte *screenPixels;
+	uint screenPitch;
+	const uint32 *paletteMap;
+
+	byte *srcPixels;
+	uint srcPitch;
+	byte *dstPixels;
+	uint dstPitch;
+
+	ScalerProc *scalerProc;
+	int scale;
+	int shakePos;
+	int height;
+	bool aspectRatioCorrection;
+};
+
+void convertDirtyBands(void *param, uint begin, uint end) {
+	const DirtyBands &bands = *(const DirtyBands *)param;
+
+	for (uint i = begin; i < end; ++i) {
+		const SDL_Rect &r = bands.bands[i];
+		// The source of the scalers is shifted by one pixel, see internUpdateScreen.
+		Graphics::crossBlitMap(bands.srcPixels + (r.y + 1) * bands.srcPitch + (r.x + 1) * 2,
+		                       bands.screenPixels + r.y * bands.screenPitch + r.x,
+		                       bands.srcPitch, bands.screenPitch, r.w, r.h, 2, bands.paletteMap);
+	}
+}
+
+void scaleDirtyBands(void *param, uint begin, uint end) {
+	const DirtyBands &bands = *(const DirtyBands *)param;
+
+	for (uint i = begin; i < end; ++i) {
+		const SDL_Rect &r = bands.bands[i];
+
+		int dstY = r.y + bands.shakePos;
+		if (dstY >= bands.height)
+			continue;
+
+		const int dstH = MIN<int>(r.h, bands.height - dstY);
+		dstY *= bands.scale;
+		if (bands.aspectRatioCorrection)
+			dstY = real2Aspect(dstY);
+
+		bands.scalerProc(bands.srcPixels + (r.x * 2 + 2) + (r.y + 1) * bands.srcPitch, bands.srcPitch,
+		                 bands.dstPixels + r.x * bands.scale * 2 + dstY * bands.dstPitch, bands.dstPitch, r.w, dstH);
+	}
+}
+
+} // End of anonymous namespace
+
 static const OSystem::GraphicsMode s_supportedShaders[] = {
 	{"NONE", "Normal (no shader)", 0},
 	{0, 0, 0}
@@ -130,7 +225,7 @@ SurfaceSdlGraphicsManager::SurfaceSdlGraphicsManager(SdlEventSource *sdlEventSou
 	SdlGraphicsManager(sdlEventSource, window),
 #ifdef USE_OSD
 	_osdMessageSurface(nullptr), _osdMessageAlpha(SDL_ALPHA_TRANSPARENT), _osdMessageFadeStartTime(0),
-	_osdIconSurface(nullptr),
+	_osdIconSurface(nullptr), _osdNeedsRedraw(false),
 #endif
 #if SDL_VERSION_ATLEAST(2, 0, 0)
 	_renderer(nullptr), _screenTexture(nullptr),
@@ -146,7 +241,7 @@ SurfaceSdlGraphicsManager::SurfaceSdlGraphicsManager(SdlEventSource *sdlEventSou
 	_mouseData(nullptr), _mouseSurface(nullptr),
 	_mouseOrigSurface(nullptr), _cursorDontScale(false), _cursorPaletteDisabled(true),
 	_currentShakePos(0), _newShakePos(0),
-	_paletteDirtyStart(0), _paletteDirtyEnd(0),
+	_paletteDirtyStart(0), _paletteDirtyEnd(0), _paletteMapDirty(true),
 	_screenIsLocked(false),
 	_graphicsMutex(0),
 	_displayDisabled(false),
@@ -965,6 +1060,8 @@ bool SurfaceSdlGraphicsManager::loadGFXMode() {
 	if (_tmpscreen == NULL)
 		error("allocating _tmpscreen failed");
 
+	_paletteMapDirty = true;
+
 	_overlayscreen = SDL_CreateRGBSurface(SDL_SWSURFACE, _videoMode.overlayWidth, _videoMode.overlayHeight,
 						16,
 						_hwScreen->format->Rmask,
@@ -1116,6 +1213,10 @@ bool SurfaceSdlGraphicsManager::hotswapGFXMode() {
 void SurfaceSdlGraphicsManager::updateScreen() {
 	assert(_transactionMode == kTransactionNone);
 
+	if (!beginPresent()) {
+		return;
+	}
+
 	Common::StackLock lock(_graphicsMutex);	// Lock the mutex until this function ends
 
 	internUpdateScreen();
@@ -1161,6 +1262,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 			_paletteDirtyEnd - _paletteDirtyStart);
 
 		_paletteDirtyEnd = 0;
+		_paletteMapDirty = true;
 
 		_forceRedraw = true;
 	}
@@ -1207,15 +1309,74 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		SDL_Rect *r;
 		SDL_Rect dst;
 		uint32 srcPitch, dstPitch;
+
+		// Merge overlapping dirty rects. This also leaves them disjoint, so
+		// that they can be drawn in parallel.
+		_numDirtyRects = mergeRects(_dirtyRectList, _numDirtyRects, NUM_DIRTY_RECT);
 		SDL_Rect *lastRect = _dirtyRectList + _numDirtyRects;
 
+		const bool aspectRatioCorrection = _videoMode.aspectRatioCorrection && !_overlayVisible;
+		bool parallel = !aspectRatioCorrection;
+#if defined(USE_NASM) && defined(USE_HQ_SCALERS)
+		// The assembly HQ scalers keep their temporaries in static memory.
+		if (scalerProc == HQ2x || scalerProc == HQ3x)
+			parallel = false;
+#endif
+
+		// Split the rects into bands. The aspect ratio correction stretches
+		// whole rects, so they are kept in one piece then.
+		DirtyBands bands;
+		int numPixels = 0;
 		for (r = _dirtyRectList; r != lastRect; ++r) {
-			dst = *r;
-			dst.x++;	// Shift rect by one since 2xSai needs to access the data around
-			dst.y++;	// any pixel to scale it, and we want to avoid mem access crashes.
+			numPixels += r->w * r->h;
 
-			if (SDL_BlitSurface(origSurf, r, srcSurf, &dst) != 0)
-				error("SDL_BlitSurface failed: %s", SDL_GetError());
+			int count = 1;
+			if (parallel && r->w > 0) {
+				count = MAX(1, r->h / MAX<int>(2, kDirtyBandMinPixels / r->w));
+			}
+
+			for (int i = 0; i < count; ++i) {
+				SDL_Rect band = *r;
+				band.y = r->y + r->h * i / count;
+				band.h = r->y + r->h * (i + 1) / count - band.y;
+				bands.bands.push_back(band);
+			}
+		}
+
+		// Only hand the bands to worker threads if there is enough to do.
+		const uint grainSize = (numPixels >= kDirtyBandMinPixels * 2) ? 1 : bands.bands.size();
+
+		if (origSurf->format->BytesPerPixel == 1) {
+			// Look up the palette ourselves, rather than letting SDL do it
+			// rect by rect.
+			if (_paletteMapDirty) {
+				for (int i = 0; i < 256; ++i) {
+					_paletteMap[i] = SDL_MapRGB(srcSurf->format, _currentPalette[i].r, _currentPalette[i].g, _currentPalette[i].b);
+				}
+				_paletteMapDirty = false;
+			}
+
+			SDL_LockSurface(origSurf);
+			SDL_LockSurface(srcSurf);
+
+			bands.screenPixels = (const byte *)origSurf->pixels;
+			bands.screenPitch = origSurf->pitch;
+			bands.paletteMap = _paletteMap;
+			bands.srcPixels = (byte *)srcSurf->pixels;
+			bands.srcPitch = srcSurf->pitch;
+			JobMan.parallelFor(0, bands.bands.size(), grainSize, convertDirtyBands, &bands);
+
+			SDL_UnlockSurface(srcSurf);
+			SDL_UnlockSurface(origSurf);
+		} else {
+			for (r = _dirtyRectList; r != lastRect; ++r) {
+				dst = *r;
+				dst.x++;	// Shift rect by one since 2xSai needs to access the data around
+				dst.y++;	// any pixel to scale it, and we want to avoid mem access crashes.
+
+				if (SDL_BlitSurface(origSurf, r, srcSurf, &dst) != 0)
+					error("SDL_BlitSurface failed: %s", SDL_GetError());
+			}
 		}
 
 		SDL_LockSurface(srcSurf);
@@ -1224,6 +1385,21 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		srcPitch = srcSurf->pitch;
 		dstPitch = _hwScreen->pitch;
 
+		assert(scalerProc != NULL);
+		bands.srcPixels = (byte *)srcSurf->pixels;
+		bands.srcPitch = srcPitch;
+		bands.dstPixels = (byte *)_hwScreen->pixels;
+		bands.dstPitch = dstPitch;
+		bands.scalerProc = scalerProc;
+		bands.scale = scale1;
+		bands.shakePos = _currentShakePos;
+		bands.height = height;
+		bands.aspectRatioCorrection = aspectRatioCorrection;
+
+		if (parallel) {
+			JobMan.parallelFor(0, bands.bands.size(), grainSize, scaleDirtyBands, &bands);
+		}
+
 		for (r = _dirtyRectList; r != lastRect; ++r) {
 			int dst_y = r->y + _currentShakePos;
 			int dst_h = 0;
@@ -1242,12 +1418,14 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 #endif
 				dst_y = dst_y * scale1;
 
-				if (_videoMode.aspectRatioCorrection && !_overlayVisible)
+				if (aspectRatioCorrection)
 					dst_y = real2Aspect(dst_y);
 
-				assert(scalerProc != NULL);
-				scalerProc((byte *)srcSurf->pixels + (r->x * 2 + 2) + (r->y + 1) * srcPitch, srcPitch,
-					(byte *)_hwScreen->pixels + rx1 * 2 + dst_y * dstPitch, dstPitch, r->w, dst_h);
+				// Without splitting, there is one band per rect.
+				if (!parallel) {
+					const uint index = r - _dirtyRectList;
+					scaleDirtyBands(&bands, index, index + 1);
+				}
 			}
 
 			r->x = rx1;
@@ -1256,7 +1434,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 			r->h = dst_h * scale1;
 
 #ifdef USE_SCALERS
-			if (_videoMode.aspectRatioCorrection && orig_dst_y < height && !_overlayVisible)
+			if (aspectRatioCorrection && orig_dst_y < height)
 				r->h = stretch200To240((uint8 *) _hwScreen->pixels, dstPitch, r->w, r->h, r->x, r->y, orig_dst_y * scale1);
 #endif
 		}
@@ -1351,6 +1529,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		// Finally, blit all our changes to the screen
 		if (!_displayDisabled) {
 			SDL_UpdateRects(_hwScreen, _numDirtyRects, _dirtyRectList);
+			endPresent();
 		}
 	}
 
@@ -1547,9 +1726,10 @@ void SurfaceSdlGraphicsManager::addDirtyRect(int x, int y, int w, int h, bool re
 	if (_forceRedraw)
 		return;
 
+	// Make room by merging overlapping rects, or by redrawing the area
+	// bounding them all if there are still too many.
 	if (_numDirtyRects == NUM_DIRTY_RECT) {
-		_forceRedraw = true;
-		return;
+		_numDirtyRects = mergeRects(_dirtyRectList, _numDirtyRects, NUM_DIRTY_RECT - 1);
 	}
 
 	int height, width;
@@ -2316,8 +2496,8 @@ void SurfaceSdlGraphicsManager::displayMessageOnOSD(const char *msg) {
 	// Enable alpha blending
 	SDL_SetAlpha(_osdMessageSurface, SDL_RLEACCEL | SDL_SRCALPHA, _osdMessageAlpha);
 
-	// Ensure a full redraw takes place next time the screen is updated
-	_forceRedraw = true;
+	// Ensure the message is drawn next time the screen is updated
+	_osdNeedsRedraw = true;
 }
 
 SDL_Rect SurfaceSdlGraphicsManager::getOSDMessageRect() const {
@@ -2334,12 +2514,9 @@ void SurfaceSdlGraphicsManager::displayActivityIconOnOSD(const Graphics::Surface
 
 	Common::StackLock lock(_graphicsMutex);	// Lock the mutex until this function ends
 
-	if (_osdIconSurface && !icon) {
-		// Force a redraw to clear the icon on the next update
-		_forceRedraw = true;
-	}
-
 	if (_osdIconSurface) {
+		// Redraw the area below the icon to clear it on the next update
+		addOSDDirtyRect(getOSDIconRect());
 		SDL_FreeSurface(_osdIconSurface);
 		_osdIconSurface = nullptr;
 	}
@@ -2370,6 +2547,8 @@ void SurfaceSdlGraphicsManager::displayActivityIconOnOSD(const Graphics::Surface
 
 		// Finished drawing, so unlock the OSD icon surface
 		SDL_UnlockSurface(_osdIconSurface);
+
+		_osdNeedsRedraw = true;
 	}
 }
 
@@ -2385,8 +2564,8 @@ SDL_Rect SurfaceSdlGraphicsManager::getOSDIconRect() const {
 void SurfaceSdlGraphicsManager::removeOSDMessage() {
 	// Remove the previous message
 	if (_osdMessageSurface) {
+		addOSDDirtyRect(getOSDMessageRect());
 		SDL_FreeSurface(_osdMessageSurface);
-		_forceRedraw = true;
 	}
 
 	_osdMessageSurface = NULL;
@@ -2408,6 +2587,7 @@ void SurfaceSdlGraphicsManager::updateOSD() {
 				_osdMessageAlpha = startAlpha + diff * (SDL_ALPHA_TRANSPARENT - startAlpha) / kOSDFadeOutDuration;
 			}
 			SDL_SetAlpha(_osdMessageSurface, SDL_RLEACCEL | SDL_SRCALPHA, _osdMessageAlpha);
+			_osdNeedsRedraw = true;
 		}
 
 		if (_osdMessageAlpha == SDL_ALPHA_TRANSPARENT) {
@@ -2415,10 +2595,38 @@ void SurfaceSdlGraphicsManager::updateOSD() {
 		}
 	}
 
-	if (_osdIconSurface || _osdMessageSurface) {
-		// Redraw the area below the icon and message for the transparent blit to give correct results.
-		_forceRedraw = true;
+	// The OSD is blended onto the scaled screen, so the area below it has
+	// to be redrawn whenever it is drawn again. This happens when the OSD
+	// changes, and when anything else on the screen is updated.
+	if (_osdNeedsRedraw || _numDirtyRects > 0 || _cursorNeedsRedraw) {
+		if (_osdMessageSurface)
+			addOSDDirtyRect(getOSDMessageRect());
+		if (_osdIconSurface)
+			addOSDDirtyRect(getOSDIconRect());
 	}
+	_osdNeedsRedraw = false;
+}
+
+void SurfaceSdlGraphicsManager::addOSDDirtyRect(const SDL_Rect &rect) {
+	// Convert the rect from the scaled screen back to the game screen or
+	// overlay, whichever is drawn below the OSD
+	const int scale = _overlayVisible ? 1 : _videoMode.scaleFactor;
+	int top = rect.y;
+	int bottom = rect.y + rect.h;
+
+#ifdef USE_SCALERS
+	if (_videoMode.aspectRatioCorrection && !_overlayVisible) {
+		top = aspect2Real(top);
+		bottom = aspect2Real(bottom) + 1;
+	}
+#endif
+
+	const int x = rect.x / scale;
+	const int y = top / scale - (_overlayVisible ? 0 : _currentShakePos);
+	const int w = (rect.x + rect.w + scale - 1) / scale - x;
+	const int h = (bottom + scale - 1) / scale - top / scale;
+
+	addDirtyRect(x, y, w, h);
 }
 
 void SurfaceSdlGraphicsManager::drawOSD() {
@@ -2709,7 +2917,8 @@ SDL_Surface *SurfaceSdlGraphicsManager::SDL_SetVideoMode(int width, int height,
 		return nullptr;
 	}
 
-	_renderer = SDL_CreateRenderer(_window->getSDLWindow(), -1, 0);
+	// Align presenting to the vertical blank when frame pacing is enabled.
+	_renderer = SDL_CreateRenderer(_window->getSDLWindow(), -1, _framePacer.isEnabled() ? SDL_RENDERER_PRESENTVSYNC : 0);
 	if (!_renderer) {
 		deinitializeRenderer();
 		return nullptr;
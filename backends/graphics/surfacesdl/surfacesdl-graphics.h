@@ -167,6 +167,10 @@ protected:
 	/** Screen rectangle where the OSD background activity icon is drawn */
 	SDL_Rect getOSDIconRect() const;
 
+	/** Whether the OSD has changed since it was last drawn */
+	bool _osdNeedsRedraw;
+	/** Mark the area of the screen below a part of the OSD as dirty */
+	void addOSDDirtyRect(const SDL_Rect &rect);
 	void updateOSD();
 	void drawOSD();
 #endif
@@ -340,6 +344,9 @@ protected:
 	// Palette data
 	SDL_Color *_currentPalette;
 	uint _paletteDirtyStart, _paletteDirtyEnd;
+	// Current palette in the format of _tmpscreen
+	uint32 _paletteMap[256];
+	bool _paletteMapDirty;
 
 	// Cursor palette data
 	SDL_Color *_cursorPalette;
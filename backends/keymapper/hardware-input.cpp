@@ -197,30 +197,24 @@ void HardwareInputSet::addHardwareInput(const HardwareInput *input) {
 	removeHardwareInput(input);
 
 	_inputs.push_back(input);
+	addToIndex(input);
 }
 
 const HardwareInput *HardwareInputSet::findHardwareInput(String id) const {
-	List<const HardwareInput *>::const_iterator it;
-
-	for (it = _inputs.begin(); it != _inputs.end(); ++it) {
-		if ((*it)->id == id)
-			return (*it);
-	}
-	return 0;
+	return _idIndex.getVal(id, 0);
 }
 
 const HardwareInput *HardwareInputSet::findHardwareInput(const HardwareInputCode code) const {
-	List<const HardwareInput *>::const_iterator it;
-
-	for (it = _inputs.begin(); it != _inputs.end(); ++it) {
-		const HardwareInput *entry = *it;
-		if (entry->type == kHardwareInputTypeGeneric && entry->inputCode == code)
-			return entry;
-	}
-	return 0;
+	return _codeIndex.getVal(code, 0);
 }
 
 const HardwareInput *HardwareInputSet::findHardwareInput(const KeyState& keystate) const {
+	const HardwareInput *input = _keyIndex.getVal(indexKey(keystate), 0);
+	if (input)
+		return input;
+
+	// KeyState::operator== also accepts keys with more flags than the ones
+	// searched for, which the index can't handle
 	List<const HardwareInput *>::const_iterator it;
 
 	for (it = _inputs.begin(); it != _inputs.end(); ++it) {
@@ -231,6 +225,35 @@ const HardwareInput *HardwareInputSet::findHardwareInput(const KeyState& keystat
 	return 0;
 }
 
+KeyState HardwareInputSet::indexKey(const KeyState &key) {
+	return KeyState(key.keycode, 0, key.flags & ~KBD_STICKY);
+}
+
+void HardwareInputSet::addToIndex(const HardwareInput *input) {
+	if (!_idIndex.contains(input->id))
+		_idIndex[input->id] = input;
+
+	if (input->type == kHardwareInputTypeGeneric) {
+		if (!_codeIndex.contains(input->inputCode))
+			_codeIndex[input->inputCode] = input;
+	} else if (input->type == kHardwareInputTypeKeyboard) {
+		const KeyState key = indexKey(input->key);
+		if (!_keyIndex.contains(key))
+			_keyIndex[key] = input;
+	}
+}
+
+void HardwareInputSet::rebuildIndex() {
+	_idIndex.clear();
+	_codeIndex.clear();
+	_keyIndex.clear();
+
+	List<const HardwareInput *>::const_iterator it;
+
+	for (it = _inputs.begin(); it != _inputs.end(); ++it)
+		addToIndex(*it);
+}
+
 void HardwareInputSet::addHardwareInputs(const HardwareInputTableEntry inputs[]) {
 	for (const HardwareInputTableEntry *entry = inputs; entry->hwId; ++entry)
 		addHardwareInput(new HardwareInput(entry->hwId, entry->code, entry->desc));
@@ -268,9 +291,10 @@ void HardwareInputSet::removeHardwareInput(const HardwareInput *input) {
 	if (!input)
 		return;
 
+	bool removed = false;
 	List<const HardwareInput *>::iterator it;
 
-	for (it = _inputs.begin(); it != _inputs.end(); ++it) {
+	for (it = _inputs.begin(); it != _inputs.end(); ) {
 		const HardwareInput *entry = (*it);
 		bool match = false;
 		if (entry->id == input->id)
@@ -284,9 +308,15 @@ void HardwareInputSet::removeHardwareInput(const HardwareInput *input) {
 		if (match) {
 			debug(7, "Removing hardware input [%s] (%s) because it matches [%s] (%s)", entry->id.c_str(), entry->description.c_str(), input->id.c_str(), input->description.c_str());
 			delete entry;
-			_inputs.erase(it);
+			it = _inputs.erase(it);
+			removed = true;
+		} else {
+			++it;
 		}
 	}
+
+	if (removed)
+		rebuildIndex();
 }
 
 } //namespace Common
@@ -27,6 +27,9 @@
 
 #ifdef ENABLE_KEYMAPPER
 
+#include "common/func.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/keyboard.h"
 #include "common/list.h"
 #include "common/str.h"
@@ -36,6 +39,17 @@ namespace Common {
 
 typedef uint32 HardwareInputCode;
 
+/**
+ * Hash function for KeyState
+ */
+template<> struct Hash<KeyState>
+	: public UnaryFunction<KeyState, uint> {
+
+	uint operator()(const KeyState &val) const {
+		return (uint)val.keycode | ((uint)val.flags << 24);
+	}
+};
+
 enum HardwareInputType {
 	/** Input that sends single events */
 	kHardwareInputTypeGeneric,
@@ -150,7 +164,19 @@ public:
 
 private:
 
+	/** Returns the key an input is indexed by, without the sticky flags */
+	static KeyState indexKey(const KeyState &key);
+
+	void addToIndex(const HardwareInput *input);
+	void rebuildIndex();
+
 	List<const HardwareInput *> _inputs;
+
+	// Indexes of the inputs, holding the first input in the list for each
+	// id, code and key
+	HashMap<String, const HardwareInput *> _idIndex;
+	HashMap<HardwareInputCode, const HardwareInput *> _codeIndex;
+	HashMap<KeyState, const HardwareInput *> _keyIndex;
 };
 
 } // End of namespace Common
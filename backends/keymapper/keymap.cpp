@@ -33,6 +33,8 @@
 
 namespace Common {
 
+uint32 Keymap::_mappingRevision = 0;
+
 Keymap::Keymap(const Keymap& km) : _actions(km._actions), _keymap(), _nonkeymap(), _configDomain(0) {
 	List<Action *>::iterator it;
 
@@ -49,6 +51,9 @@ Keymap::Keymap(const Keymap& km) : _actions(km._actions), _keymap(), _nonkeymap(
 }
 
 Keymap::~Keymap() {
+	// Lookup tables may still point to the Actions
+	++_mappingRevision;
+
 	List<Action *>::iterator it;
 
 	for (it = _actions.begin(); it != _actions.end(); ++it)
@@ -63,6 +68,8 @@ void Keymap::addAction(Action *action) {
 }
 
 void Keymap::registerMapping(Action *action, const HardwareInput *hwInput) {
+	++_mappingRevision;
+
 	if (hwInput->type == kHardwareInputTypeKeyboard) {
 		HashMap<KeyState, Action *>::iterator it = _keymap.find(hwInput->key);
 		// if input is already mapped to a different action then unmap it from there
@@ -84,6 +91,8 @@ void Keymap::unregisterMapping(Action *action) {
 	const HardwareInput *hwInput = action->getMappedInput();
 
 	if (hwInput) {
+		++_mappingRevision;
+
 		if (hwInput->type == kHardwareInputTypeKeyboard)
 			_keymap.erase(hwInput->key);
 		else if (hwInput->type == kHardwareInputTypeGeneric)
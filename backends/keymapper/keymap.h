@@ -28,7 +28,6 @@
 #ifdef ENABLE_KEYMAPPER
 
 #include "common/config-manager.h"
-#include "common/func.h"
 #include "common/hashmap.h"
 #include "common/keyboard.h"
 #include "common/list.h"
@@ -37,17 +36,6 @@
 
 namespace Common {
 
-/**
- * Hash function for KeyState
- */
-template<> struct Hash<KeyState>
-	: public UnaryFunction<KeyState, uint> {
-
-	uint operator()(const KeyState &val) const {
-		return (uint)val.keycode | ((uint)val.flags << 24);
-	}
-};
-
 class Keymap {
 public:
 	Keymap(const String& name) : _name(name) {}
@@ -81,6 +69,24 @@ public:
 	 */
 	Action *getMappedAction(const HardwareInputCode code) const;
 
+	/**
+	 * Get the Actions mapped to keys, by the key they are mapped to
+	 */
+	const HashMap<KeyState, Action *> &getKeyMappings() const { return _keymap; }
+
+	/**
+	 * Get the Actions mapped to generic inputs, by the input code they are
+	 * mapped to
+	 */
+	const HashMap<HardwareInputCode, Action *> &getNonKeyMappings() const { return _nonkeymap; }
+
+	/**
+	 * Returns a number which changes whenever an input is mapped to or
+	 * unmapped from an Action in any Keymap. This allows lookup tables built
+	 * out of the mappings to notice when they need to be rebuilt.
+	 */
+	static uint32 getMappingRevision() { return _mappingRevision; }
+
 	void setConfigDomain(ConfigManager::Domain *dom);
 
 	/**
@@ -138,6 +144,7 @@ private:
 	HashMap<HardwareInputCode, Action *> _nonkeymap;
 	ConfigManager::Domain *_configDomain;
 
+	static uint32 _mappingRevision;
 };
 
 
@@ -59,7 +59,8 @@ Keymap *Keymapper::Domain::getKeymap(const String& name) {
 }
 
 Keymapper::Keymapper(EventManager *evtMgr)
-	: _eventMan(evtMgr), _enabled(true), _remapping(false), _hardwareInputs(0), _actionToRemap(0) {
+	: _eventMan(evtMgr), _enabled(true), _remapping(false), _hardwareInputs(0), _actionToRemap(0),
+	  _lookupValid(false), _lookupRevision(0) {
 	ConfigManager::Domain *confDom = ConfMan.getDomain(ConfigManager::kKeymapperDomain);
 
 	_globalDomain.setConfigDomain(confDom);
@@ -130,6 +131,7 @@ void Keymapper::cleanupGameKeymaps() {
 	}
 
 	_activeMaps = newStack;
+	_lookupValid = false;
 }
 
 Keymap *Keymapper::getKeymap(const String& name, bool *globalReturn) {
@@ -167,6 +169,7 @@ void Keymapper::pushKeymap(Keymap *newMap, bool transparent, bool global) {
 	MapRecord mr = {newMap, transparent, global};
 
 	_activeMaps.push(mr);
+	_lookupValid = false;
 }
 
 void Keymapper::popKeymap(const char *name) {
@@ -180,6 +183,7 @@ void Keymapper::popKeymap(const char *name) {
 		} else {
 			_activeMaps.pop();
 		}
+		_lookupValid = false;
 	}
 
 }
@@ -188,6 +192,11 @@ List<Event> Keymapper::mapEvent(const Event &ev, EventSource *source) {
 	if (source && !source->allowMapping()) {
 		return DefaultEventMapper::mapEvent(ev, source);
 	}
+	if (!_remapping && ev.type != EVENT_KEYDOWN && ev.type != EVENT_KEYUP && ev.type != EVENT_CUSTOM_BACKEND_HARDWARE) {
+		// Nothing to map, e.g. for the frequent mouse moves
+		return DefaultEventMapper::mapEvent(ev, source);
+	}
+
 	List<Event> mappedEvents;
 
 	if (_remapping)
@@ -227,15 +236,8 @@ List<Event> Keymapper::mapKey(const KeyState& key, bool keyDown) {
 	Action *action = 0;
 
 	if (keyDown) {
-		// Search for key in active keymap stack
-		for (int i = _activeMaps.size() - 1; i >= 0; --i) {
-			MapRecord mr = _activeMaps[i];
-			debug(5, "Keymapper::mapKey keymap: %s", mr.keymap->getName().c_str());
-			action = mr.keymap->getMappedAction(key);
-
-			if (action || !mr.transparent)
-				break;
-		}
+		updateLookup();
+		action = _keyLookup.getVal(key, 0);
 
 		if (action)
 			_keysDown[key] = action;
@@ -259,22 +261,46 @@ List<Event> Keymapper::mapNonKey(const HardwareInputCode code) {
 	if (!_enabled || _activeMaps.empty())
 		return List<Event>();
 
-	Action *action = 0;
+	updateLookup();
+	Action *action = _nonKeyLookup.getVal(code, 0);
+
+	if (!action)
+		return List<Event>();
+
+	return executeAction(action);
+}
 
-	// Search for nonkey in active keymap stack
+void Keymapper::updateLookup() {
+	if (_lookupValid && _lookupRevision == Keymap::getMappingRevision())
+		return;
+
+	_keyLookup.clear();
+	_nonKeyLookup.clear();
+
+	// Inputs are resolved by the topmost keymap mapping them, searching down
+	// the stack only through transparent keymaps
 	for (int i = _activeMaps.size() - 1; i >= 0; --i) {
-		MapRecord mr = _activeMaps[i];
-		debug(5, "Keymapper::mapKey keymap: %s", mr.keymap->getName().c_str());
-		action = mr.keymap->getMappedAction(code);
+		const MapRecord &mr = _activeMaps[i];
+		debug(5, "Keymapper::updateLookup keymap: %s", mr.keymap->getName().c_str());
 
-		if (action || !mr.transparent)
+		const HashMap<KeyState, Action *> &keys = mr.keymap->getKeyMappings();
+		for (HashMap<KeyState, Action *>::const_iterator it = keys.begin(); it != keys.end(); ++it) {
+			if (!_keyLookup.contains(it->_key))
+				_keyLookup[it->_key] = it->_value;
+		}
+
+		const HashMap<HardwareInputCode, Action *> &nonKeys = mr.keymap->getNonKeyMappings();
+		for (HashMap<HardwareInputCode, Action *>::const_iterator it = nonKeys.begin(); it != nonKeys.end(); ++it) {
+			if (!_nonKeyLookup.contains(it->_key))
+				_nonKeyLookup[it->_key] = it->_value;
+		}
+
+		if (!mr.transparent)
 			break;
 	}
 
-	if (!action)
-		return List<Event>();
-
-	return executeAction(action);
+	_lookupValid = true;
+	_lookupRevision = Keymap::getMappingRevision();
 }
 
 Action *Keymapper::getAction(const KeyState& key) {
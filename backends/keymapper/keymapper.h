@@ -217,6 +217,12 @@ private:
 
 	void pushKeymap(Keymap *newMap, bool transparent, bool global);
 
+	/**
+	 * Rebuild the lookup tables of the active keymap stack, if the stack or
+	 * any mapping has changed since they were built.
+	 */
+	void updateLookup();
+
 	Action *getAction(const KeyState& key);
 	List<Event> executeAction(const Action *act, IncomingEventType incomingType = kIncomingNonKey);
 	EventType convertDownToUp(EventType eventType);
@@ -231,6 +237,13 @@ private:
 	Stack<MapRecord> _activeMaps;
 	HashMap<KeyState, Action *> _keysDown;
 
+	// The Actions the inputs resolve to with the active keymap stack, so
+	// events don't need to search each of the keymaps
+	HashMap<KeyState, Action *> _keyLookup;
+	HashMap<HardwareInputCode, Action *> _nonKeyLookup;
+	bool _lookupValid;
+	uint32 _lookupRevision;
+
 };
 
 } // End of namespace Common
@@ -26,14 +26,17 @@
 
 #include "backends/graphics/graphics.h"
 #include "backends/mutex/mutex.h"
+#include "backends/threads/threads.h"
 #include "gui/EventRecorder.h"
 
 #include "audio/mixer.h"
+#include "common/profiler.h"
 #include "graphics/pixelformat.h"
 
 ModularBackend::ModularBackend()
 	:
 	_mutexManager(0),
+	_threadManager(0),
 	_graphicsManager(0),
 	_mixer(0) {
 
@@ -44,6 +47,8 @@ ModularBackend::~ModularBackend() {
 	_graphicsManager = 0;
 	delete _mixer;
 	_mixer = 0;
+	delete _threadManager;
+	_threadManager = 0;
 	delete _mutexManager;
 	_mutexManager = 0;
 }
@@ -142,6 +147,7 @@ PaletteManager *ModularBackend::getPaletteManager() {
 }
 
 void ModularBackend::copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) {
+	PROFILE_COUNT("dirty pixels", w * h);
 	_graphicsManager->copyRectToScreen(buf, pitch, x, y, w, h);
 }
 
@@ -153,11 +159,28 @@ void ModularBackend::unlockScreen() {
 	_graphicsManager->unlockScreen();
 }
 
+Graphics::Surface *ModularBackend::getScreenBuffer(ScreenBufferListener *listener) {
+	return _graphicsManager->getScreenBuffer(listener);
+}
+
+void ModularBackend::releaseScreenBuffer(ScreenBufferListener *listener) {
+	_graphicsManager->releaseScreenBuffer(listener);
+}
+
+void ModularBackend::markScreenDirty(const Common::Rect &r) {
+	_graphicsManager->markScreenDirty(r);
+}
+
 void ModularBackend::fillScreen(uint32 col) {
 	_graphicsManager->fillScreen(col);
 }
 
 void ModularBackend::updateScreen() {
+	if (Common::Profiler::isActive())
+		ProfilerMan.endFrame(getMicros());
+
+	PROFILE_ZONE("updateScreen");
+
 #ifdef ENABLE_EVENTRECORDER
 	g_eventRec.preDrawOverlayGui();
 #endif
@@ -249,6 +272,44 @@ void ModularBackend::deleteMutex(MutexRef mutex) {
 	_mutexManager->deleteMutex(mutex);
 }
 
+OSystem::ThreadRef ModularBackend::createThread(ThreadProc proc, void *param) {
+	if (!_threadManager)
+		return 0;
+	return _threadManager->createThread(proc, param);
+}
+
+void ModularBackend::joinThread(ThreadRef thread) {
+	assert(_threadManager);
+	_threadManager->joinThread(thread);
+}
+
+uint ModularBackend::getCPUCount() {
+	if (!_threadManager)
+		return 1;
+	return _threadManager->getCPUCount();
+}
+
+OSystem::SemaphoreRef ModularBackend::createSemaphore(uint initialValue) {
+	if (!_threadManager)
+		return 0;
+	return _threadManager->createSemaphore(initialValue);
+}
+
+void ModularBackend::waitSemaphore(SemaphoreRef sem) {
+	assert(_threadManager);
+	_threadManager->waitSemaphore(sem);
+}
+
+void ModularBackend::postSemaphore(SemaphoreRef sem) {
+	assert(_threadManager);
+	_threadManager->postSemaphore(sem);
+}
+
+void ModularBackend::deleteSemaphore(SemaphoreRef sem) {
+	assert(_threadManager);
+	_threadManager->deleteSemaphore(sem);
+}
+
 Audio::Mixer *ModularBackend::getMixer() {
 	assert(_mixer);
 	return (Audio::Mixer *)_mixer;
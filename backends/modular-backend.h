@@ -27,6 +27,7 @@
 
 class GraphicsManager;
 class MutexManager;
+class ThreadManager;
 
 /**
  * Base class for modular backends.
@@ -87,6 +88,9 @@ public:
 	virtual void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) override;
 	virtual Graphics::Surface *lockScreen() override;
 	virtual void unlockScreen() override;
+	virtual Graphics::Surface *getScreenBuffer(ScreenBufferListener *listener) override;
+	virtual void releaseScreenBuffer(ScreenBufferListener *listener) override;
+	virtual void markScreenDirty(const Common::Rect &r) override;
 	virtual void fillScreen(uint32 col) override;
 	virtual void updateScreen() override;
 	virtual void setShakePos(int shakeOffset) override;
@@ -119,6 +123,19 @@ public:
 
 	//@}
 
+	/** @name Thread handling */
+	//@{
+
+	virtual ThreadRef createThread(ThreadProc proc, void *param) override;
+	virtual void joinThread(ThreadRef thread) override;
+	virtual uint getCPUCount() override;
+	virtual SemaphoreRef createSemaphore(uint initialValue) override;
+	virtual void waitSemaphore(SemaphoreRef sem) override;
+	virtual void postSemaphore(SemaphoreRef sem) override;
+	virtual void deleteSemaphore(SemaphoreRef sem) override;
+
+	//@}
+
 	/** @name Sound */
 	//@{
 
@@ -140,6 +157,7 @@ protected:
 	//@{
 
 	MutexManager *_mutexManager;
+	ThreadManager *_threadManager;	///< Optional, threads are unsupported if not set
 	GraphicsManager *_graphicsManager;
 	Audio::Mixer *_mixer;
 
@@ -24,6 +24,7 @@
 
 #include "backends/networking/curl/connectionmanager.h"
 #include "backends/networking/curl/networkreadstream.h"
+#include "common/atomic.h"
 #include "common/debug.h"
 #include "common/system.h"
 #include "common/timer.h"
@@ -37,9 +38,32 @@ DECLARE_SINGLETON(Networking::ConnectionManager);
 
 namespace Networking {
 
-ConnectionManager::ConnectionManager(): _multi(0), _timerStarted(false), _frame(0) {
+static void curlShareLockCallback(CURL *handle, curl_lock_data data, curl_lock_access access, void *p) {
+	((Common::Mutex *)p)[data].lock();
+}
+
+static void curlShareUnlockCallback(CURL *handle, curl_lock_data data, void *p) {
+	((Common::Mutex *)p)[data].unlock();
+}
+
+ConnectionManager::ConnectionManager(): _multi(0), _share(0), _shareMutexes(0), _timerStarted(false), _frame(0) {
 	curl_global_init(CURL_GLOBAL_ALL);
 	_multi = curl_multi_init();
+
+	//all transfers are performed on the timer thread, but the shared data
+	//is locked anyway, so that it stays safe if that ever changes
+	//(libcurl locks different kinds of data at once, so each has its own mutex)
+	_shareMutexes = new Common::Mutex[CURL_LOCK_DATA_LAST];
+	_share = curl_share_init();
+	curl_share_setopt(_share, CURLSHOPT_LOCKFUNC, curlShareLockCallback);
+	curl_share_setopt(_share, CURLSHOPT_UNLOCKFUNC, curlShareUnlockCallback);
+	curl_share_setopt(_share, CURLSHOPT_USERDATA, _shareMutexes);
+	curl_share_setopt(_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+	curl_share_setopt(_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900
+	// CURL_LOCK_DATA_CONNECT introduced in libcurl 7.57.0
+	curl_share_setopt(_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
 }
 
 ConnectionManager::~ConnectionManager() {
@@ -58,17 +82,55 @@ ConnectionManager::~ConnectionManager() {
 	}
 	_requests.clear();
 
-	//cleanup
+	//requests which were never started don't have handles yet
+	_addedRequestsMutex.lock();
+	for (Common::Array<RequestWithCallback>::iterator i = _addedRequests.begin(); i != _addedRequests.end(); ++i) {
+		Request *request = i->request;
+		RequestCallback callback = i->onDeleteCallback;
+		if (request)
+			request->finish();
+		delete request;
+		if (callback)
+			(*callback)(request);
+	}
+	_addedRequests.clear();
+
+	//wake up the threads still waiting for transfers
+	for (Common::Array<Transfer *>::iterator i = _transfers.begin(); i != _transfers.end(); ++i) {
+		unregisterEasyHandle((*i)->easy);
+		finishTransfer(*i, CURLE_ABORTED_BY_CALLBACK);
+	}
+	_transfers.clear();
+	for (Common::Array<Transfer *>::iterator i = _addedTransfers.begin(); i != _addedTransfers.end(); ++i)
+		finishTransfer(*i, CURLE_ABORTED_BY_CALLBACK);
+	_addedTransfers.clear();
+	_addedRequestsMutex.unlock();
+
+	//cleanup, no easy handles are left at this point
 	curl_multi_cleanup(_multi);
+	curl_share_cleanup(_share);
 	curl_global_cleanup();
+	delete[] _shareMutexes;
 	_multi = nullptr;
+	_share = nullptr;
+	_shareMutexes = nullptr;
 	_handleMutex.unlock();
 }
 
 void ConnectionManager::registerEasyHandle(CURL *easy) const {
+	curl_easy_setopt(easy, CURLOPT_SHARE, _share);
+#if LIBCURL_VERSION_NUM >= 0x071900
+	// CURLOPT_TCP_KEEPALIVE introduced in libcurl 7.25.0
+	curl_easy_setopt(easy, CURLOPT_TCP_KEEPALIVE, 1L);
+#endif
 	curl_multi_add_handle(_multi, easy);
 }
 
+void ConnectionManager::unregisterEasyHandle(CURL *easy) const {
+	curl_multi_remove_handle(_multi, easy);
+	curl_easy_setopt(easy, CURLOPT_SHARE, nullptr);
+}
+
 Request *ConnectionManager::addRequest(Request *request, RequestCallback callback) {
 	_addedRequestsMutex.lock();
 	_addedRequests.push_back(RequestWithCallback(request, callback));
@@ -78,6 +140,36 @@ Request *ConnectionManager::addRequest(Request *request, RequestCallback callbac
 	return request;
 }
 
+int ConnectionManager::performTransfer(CURL *easy) {
+	Transfer transfer;
+	transfer.easy = easy;
+	transfer.result = CURLE_OK;
+	transfer.doneSemaphore = g_system->createSemaphore(0);
+	transfer.done = 0;
+
+	_addedRequestsMutex.lock();
+	_addedTransfers.push_back(&transfer);
+	if (!_timerStarted)
+		startTimer();
+	if (!_timerStarted) {
+		_addedTransfers.pop_back();
+		_addedRequestsMutex.unlock();
+		g_system->deleteSemaphore(transfer.doneSemaphore);
+		return CURLE_FAILED_INIT;
+	}
+	_addedRequestsMutex.unlock();
+
+	if (transfer.doneSemaphore) {
+		g_system->waitSemaphore(transfer.doneSemaphore);
+		g_system->deleteSemaphore(transfer.doneSemaphore);
+	} else {
+		while (!Common::atomicLoadAcquire(&transfer.done))
+			g_system->delayMillis(10);
+	}
+
+	return transfer.result;
+}
+
 Common::String ConnectionManager::urlEncode(Common::String s) const {
 	if (!_multi)
 		return "";
@@ -120,13 +212,6 @@ void ConnectionManager::stopTimer() {
 	_timerStarted = false;
 }
 
-bool ConnectionManager::hasAddedRequests() {
-	_addedRequestsMutex.lock();
-	bool hasNewRequests = !_addedRequests.empty();
-	_addedRequestsMutex.unlock();
-	return hasNewRequests;
-}
-
 void ConnectionManager::handle() {
 	//lock mutex here (in case another handle() would be called before this one ends)
 	_handleMutex.lock();
@@ -136,8 +221,11 @@ void ConnectionManager::handle() {
 	if (_frame % CURL_PERIOD == 0)
 		processTransfers();
 
-	if (_requests.empty() && !hasAddedRequests())
+	//checked under the lock, so that nothing is added right before the timer stops
+	_addedRequestsMutex.lock();
+	if (_requests.empty() && _addedRequests.empty() && _transfers.empty() && _addedTransfers.empty())
 		stopTimer();
+	_addedRequestsMutex.unlock();
 	_handleMutex.unlock();
 }
 
@@ -176,6 +264,15 @@ void ConnectionManager::interateRequests() {
 void ConnectionManager::processTransfers() {
 	if (!_multi) return;
 
+	//start the transfers added by other threads
+	_addedRequestsMutex.lock();
+	for (Common::Array<Transfer *>::iterator i = _addedTransfers.begin(); i != _addedTransfers.end(); ++i) {
+		registerEasyHandle((*i)->easy);
+		_transfers.push_back(*i);
+	}
+	_addedTransfers.clear();
+	_addedRequestsMutex.unlock();
+
 	//check libcurl's transfers and notify requests of messages from queue (transfer completion or failure)
 	int transfersRunning;
 	curl_multi_perform(_multi, &transfersRunning);
@@ -185,6 +282,17 @@ void ConnectionManager::processTransfers() {
 	while ((curlMsg = curl_multi_info_read(_multi, &messagesInQueue))) {
 		CURL *easyHandle = curlMsg->easy_handle;
 
+		Common::Array<Transfer *>::iterator transfer = _transfers.begin();
+		while (transfer != _transfers.end() && (*transfer)->easy != easyHandle)
+			++transfer;
+		if (transfer != _transfers.end()) {
+			//the waiting thread owns the handle again once it's woken up
+			unregisterEasyHandle(easyHandle);
+			finishTransfer(*transfer, curlMsg->msg == CURLMSG_DONE ? curlMsg->data.result : CURLE_RECV_ERROR);
+			_transfers.erase(transfer);
+			continue;
+		}
+
 		NetworkReadStream *stream;
 		curl_easy_getinfo(easyHandle, CURLINFO_PRIVATE, &stream);
 		if (stream)
@@ -200,4 +308,14 @@ void ConnectionManager::processTransfers() {
 	}
 }
 
+void ConnectionManager::finishTransfer(Transfer *transfer, int result) {
+	transfer->result = result;
+
+	//the waiting thread may free the transfer right away, so it's not used afterwards
+	if (transfer->doneSemaphore)
+		g_system->postSemaphore(transfer->doneSemaphore);
+	else
+		Common::atomicStoreRelease(&transfer->done, 1);
+}
+
 } // End of namespace Cloud
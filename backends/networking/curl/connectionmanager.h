@@ -28,9 +28,11 @@
 #include "common/singleton.h"
 #include "common/hashmap.h"
 #include "common/mutex.h"
+#include "common/system.h"
 
 typedef void CURL;
 typedef void CURLM;
+typedef void CURLSH;
 struct curl_slist;
 
 namespace Networking {
@@ -74,9 +76,23 @@ class ConnectionManager : public Common::Singleton<ConnectionManager> {
 		RequestWithCallback(Request *rq = nullptr, RequestCallback cb = nullptr): request(rq), onDeleteCallback(cb) {}
 	};
 
+	/**
+	 * Transfer is a transfer of an easy handle which is started from
+	 * another thread by performTransfer(), and which is waited for there.
+	 */
+	struct Transfer {
+		CURL *easy;
+		int result; //CURLcode
+		OSystem::SemaphoreRef doneSemaphore; //posted when done, if the backend supports semaphores
+		volatile uint32 done; //set when done otherwise
+	};
+
 	CURLM *_multi;
+	CURLSH *_share;
+	Common::Mutex *_shareMutexes; //one for each kind of shared data
 	bool _timerStarted;
 	Common::Array<RequestWithCallback> _requests, _addedRequests;
+	Common::Array<Transfer *> _transfers, _addedTransfers;
 	Common::Mutex _handleMutex, _addedRequestsMutex;
 	uint32 _frame;
 
@@ -85,7 +101,7 @@ class ConnectionManager : public Common::Singleton<ConnectionManager> {
 	void handle();
 	void interateRequests();
 	void processTransfers();
-	bool hasAddedRequests();
+	void finishTransfer(Transfer *transfer, int result);
 
 public:
 	ConnectionManager();
@@ -98,6 +114,12 @@ public:
 	 */
 	void registerEasyHandle(CURL *easy) const;
 
+	/**
+	 * Removes a registered easy handle from the transfers again. This must
+	 * be done before the handle is cleaned up.
+	 */
+	void unregisterEasyHandle(CURL *easy) const;
+
 	/**
 	 * Use this method to add new Request into manager's queue.
 	 * Manager will periodically call handle() method of these
@@ -113,6 +135,20 @@ public:
 	 */
 	Request *addRequest(Request *request, RequestCallback callback = nullptr);
 
+	/**
+	 * Performs the transfer of an easy handle, which is set up but not
+	 * registered, and waits until it's done.
+	 *
+	 * This is the blocking counterpart of curl_easy_perform() for other
+	 * threads: the transfer is still driven by the multi handle on the
+	 * timer thread, along with all the other ones, so the shared
+	 * connections and caches are only used there. Thus it must not be
+	 * called on the timer thread itself.
+	 *
+	 * @return the CURLcode of the transfer
+	 */
+	int performTransfer(CURL *easy);
+
 	/** Return URL-encoded version of given string. */
 	Common::String urlEncode(Common::String s) const;
 
@@ -194,8 +194,10 @@ NetworkReadStream::NetworkReadStream(const char *url, curl_slist *headersList, c
 }
 
 NetworkReadStream::~NetworkReadStream() {
-	if (_easy)
+	if (_easy) {
+		ConnMan.unregisterEasyHandle(_easy);
 		curl_easy_cleanup(_easy);
+	}
 	free(_bufferCopy);
 }
 
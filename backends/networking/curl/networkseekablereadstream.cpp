@@ -0,0 +1,165 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include "backends/networking/curl/networkseekablereadstream.h"
+#include "backends/networking/curl/connectionmanager.h"
+#include "base/version.h"
+#include "common/textconsole.h"
+#include <curl/curl.h>
+
+namespace Networking {
+
+size_t NetworkSeekableReadStream::curlDataCallback(char *d, size_t n, size_t l, void *p) {
+	NetworkSeekableReadStream *stream = (NetworkSeekableReadStream *)p;
+	size_t size = n * l;
+	//servers ignoring the Range header would send the whole file
+	if (stream->_blockSize + size > BLOCK_SIZE)
+		return 0;
+	memcpy(stream->_block + stream->_blockSize, d, size);
+	stream->_blockSize += size;
+	return size;
+}
+
+NetworkSeekableReadStream *NetworkSeekableReadStream::open(const Common::String &url, curl_slist *headersList, int32 size) {
+	CURL *easy = curl_easy_init();
+	curl_easy_setopt(easy, CURLOPT_URL, url.c_str());
+	curl_easy_setopt(easy, CURLOPT_VERBOSE, 0L);
+	curl_easy_setopt(easy, CURLOPT_FOLLOWLOCATION, 1L);
+	curl_easy_setopt(easy, CURLOPT_HTTPHEADER, headersList);
+	curl_easy_setopt(easy, CURLOPT_USERAGENT, gScummVMFullVersion);
+
+	if (size < 0) {
+		//request the headers only
+		curl_easy_setopt(easy, CURLOPT_NOBODY, 1L);
+		long responseCode = -1;
+#if LIBCURL_VERSION_NUM >= 0x073700
+		// CURLINFO_CONTENT_LENGTH_DOWNLOAD_T introduced in libcurl 7.55.0
+		curl_off_t length = -1;
+		CURLINFO lengthInfo = CURLINFO_CONTENT_LENGTH_DOWNLOAD_T;
+#else
+		double length = -1;
+		CURLINFO lengthInfo = CURLINFO_CONTENT_LENGTH_DOWNLOAD;
+#endif
+		if (ConnMan.performTransfer(easy) == CURLE_OK) {
+			curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &responseCode);
+			curl_easy_getinfo(easy, lengthInfo, &length);
+		}
+		if (responseCode != 200 || length < 0 || length > 0x7FFFFFFF) {
+			warning("NetworkSeekableReadStream: failed to get the size of '%s'", url.c_str());
+			curl_easy_cleanup(easy);
+			curl_slist_free_all(headersList);
+			return nullptr;
+		}
+		size = (int32)length;
+		curl_easy_setopt(easy, CURLOPT_NOBODY, 0L);
+		curl_easy_setopt(easy, CURLOPT_HTTPGET, 1L);
+	}
+
+	return new NetworkSeekableReadStream(easy, headersList, size);
+}
+
+NetworkSeekableReadStream::NetworkSeekableReadStream(CURL *easy, curl_slist *headersList, int32 size) :
+		_easy(easy), _headersList(headersList), _size(size), _pos(0),
+		_block(new byte[BLOCK_SIZE]), _blockStart(0), _blockSize(0), _eos(false), _err(false) {
+	curl_easy_setopt(_easy, CURLOPT_WRITEFUNCTION, curlDataCallback);
+	curl_easy_setopt(_easy, CURLOPT_WRITEDATA, this);
+}
+
+NetworkSeekableReadStream::~NetworkSeekableReadStream() {
+	curl_easy_cleanup(_easy);
+	curl_slist_free_all(_headersList);
+	delete[] _block;
+}
+
+bool NetworkSeekableReadStream::fetchBlock(int32 start) {
+	uint32 expected = MIN<uint32>(BLOCK_SIZE, _size - start);
+	Common::String range = Common::String::format("%d-%d", start, start + expected - 1);
+	curl_easy_setopt(_easy, CURLOPT_RANGE, range.c_str());
+
+	_blockStart = start;
+	_blockSize = 0;
+	CURLcode result = (CURLcode)ConnMan.performTransfer(_easy);
+	long responseCode = -1;
+	curl_easy_getinfo(_easy, CURLINFO_RESPONSE_CODE, &responseCode);
+
+	//a whole file is fine too if it's small enough
+	bool partial = (responseCode == 206 || (responseCode == 200 && start == 0));
+	if (result != CURLE_OK || !partial || _blockSize != expected) {
+		warning("NetworkSeekableReadStream: failed to read bytes %s (%d - %s)", range.c_str(), (int)responseCode, curl_easy_strerror(result));
+		_blockSize = 0;
+		return false;
+	}
+	return true;
+}
+
+uint32 NetworkSeekableReadStream::read(void *dataPtr, uint32 dataSize) {
+	byte *dst = (byte *)dataPtr;
+	uint32 actuallyRead = 0;
+
+	while (actuallyRead < dataSize) {
+		if (_pos >= _size) {
+			_eos = true;
+			break;
+		}
+
+		if (_pos < _blockStart || _pos >= _blockStart + (int32)_blockSize) {
+			if (!fetchBlock(_pos - _pos % BLOCK_SIZE)) {
+				_err = true;
+				break;
+			}
+		}
+
+		uint32 offset = _pos - _blockStart;
+		uint32 count = MIN<uint32>(dataSize - actuallyRead, _blockSize - offset);
+		memcpy(dst + actuallyRead, _block + offset, count);
+		actuallyRead += count;
+		_pos += count;
+	}
+
+	return actuallyRead;
+}
+
+bool NetworkSeekableReadStream::seek(int32 offset, int whence) {
+	switch (whence) {
+	case SEEK_END:
+		offset = _size + offset;
+		// fall through
+	case SEEK_SET:
+		_pos = offset;
+		break;
+	case SEEK_CUR:
+		_pos += offset;
+		break;
+	}
+
+	if (_pos < 0 || _pos > _size) {
+		_pos = CLIP<int32>(_pos, 0, _size);
+		_err = true;
+		return false;
+	}
+	_eos = false;
+	return true;
+}
+
+} // End of namespace Networking
@@ -0,0 +1,88 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BACKENDS_NETWORKING_CURL_NETWORKSEEKABLEREADSTREAM_H
+#define BACKENDS_NETWORKING_CURL_NETWORKSEEKABLEREADSTREAM_H
+
+#include "common/stream.h"
+#include "common/str.h"
+
+typedef void CURL;
+struct curl_slist;
+
+namespace Networking {
+
+/**
+ * NetworkSeekableReadStream reads a remote file over HTTP in blocks,
+ * requesting each one with a Range header when it's needed. Unlike
+ * NetworkReadStream, it doesn't download the whole file first, so
+ * large files can be read from while they stay on the server.
+ *
+ * Reading is blocking: each request is performed by ConnectionManager
+ * on its timer thread, along with all the other transfers, and the
+ * reading thread waits for it. The requests share connections and TLS
+ * sessions with the other transfers, and the connection is kept alive
+ * between the blocks. The stream must not be read on the timer thread.
+ */
+class NetworkSeekableReadStream: public Common::SeekableReadStream {
+	static const uint32 BLOCK_SIZE = 256 * 1024;
+
+	CURL *_easy;
+	curl_slist *_headersList;
+	int32 _size, _pos;
+	byte *_block;
+	int32 _blockStart;
+	uint32 _blockSize;
+	bool _eos, _err;
+
+	NetworkSeekableReadStream(CURL *easy, curl_slist *headersList, int32 size);
+
+	/** Reads the block starting at <start> into _block. */
+	bool fetchBlock(int32 start);
+
+	static size_t curlDataCallback(char *d, size_t n, size_t l, void *p);
+public:
+	/**
+	 * Opens a remote file for reading in blocks.
+	 *
+	 * If <size> is not known, it's requested from the server first.
+	 * The stream takes over <headersList>.
+	 *
+	 * @return the stream, or nullptr if the size could not be determined
+	 */
+	static NetworkSeekableReadStream *open(const Common::String &url, curl_slist *headersList = nullptr, int32 size = -1);
+	virtual ~NetworkSeekableReadStream();
+
+	virtual bool eos() const { return _eos; }
+	virtual bool err() const { return _err; }
+	virtual void clearErr() { _eos = _err = false; }
+
+	virtual uint32 read(void *dataPtr, uint32 dataSize);
+
+	virtual int32 pos() const { return _pos; }
+	virtual int32 size() const { return _size; }
+	virtual bool seek(int32 offset, int whence = SEEK_SET);
+};
+
+} // End of namespace Networking
+
+#endif
@@ -72,10 +72,8 @@ bool Client::readMoreIfNeeded() {
 		return false; //nothing to read into
 	if (_stream->size() - _stream->pos() > 0)
 		return true; //not needed, some data left in the stream
-	if (!_socket)
-		return false;
-	if (!SDLNet_SocketReady(_socket))
-		return false;
+	if (!_socket || !SDLNet_SocketReady(_socket))
+		return _reader.hasBufferedContent(); //Reader might still have some data left
 
 	int bytes = SDLNet_TCP_Recv(_socket, _buffer, CLIENT_BUFFER_SIZE);
 	if (bytes <= 0) {
@@ -190,15 +190,28 @@ uint32 LocalWebserver::getPort() {
 
 void LocalWebserver::handle() {
 	_handleMutex.lock();
-	int numready = SDLNet_CheckSockets(_set, 0);
-	if (numready == -1) {
-		error("LocalWebserver: SDLNet_CheckSockets: %s\n", SDLNet_GetError());
-	} else if (numready) {
-		acceptClient();
-	}
 
-	for (uint32 i = 0; i < MAX_CONNECTIONS; ++i)
-		handleClient(i);
+	//keep handling the clients while they are receiving data, so
+	//uploads are not limited to one buffer per timer tick
+	uint32 startTime = g_system->getMillis();
+	bool received;
+	do {
+		int numready = SDLNet_CheckSockets(_set, 0);
+		if (numready == -1) {
+			error("LocalWebserver: SDLNet_CheckSockets: %s\n", SDLNet_GetError());
+		} else if (numready) {
+			acceptClient();
+		}
+
+		received = false;
+		for (uint32 i = 0; i < MAX_CONNECTIONS; ++i) {
+			bool ready = _client[i].socketIsReady();
+			handleClient(i);
+			//socket is not ready anymore once the data was received
+			if (ready && _client[i].state() != INVALID && !_client[i].socketIsReady())
+				received = true;
+		}
+	} while (received && g_system->getMillis() - startTime < HANDLE_TIME_LIMIT);
 
 	_clients = 0;
 	for (uint32 i = 0; i < MAX_CONNECTIONS; ++i)
@@ -53,6 +53,7 @@ class LocalWebserver : public Common::Singleton<LocalWebserver> {
 	static const uint32 FRAMES_PER_SECOND = 20;
 	static const uint32 TIMER_INTERVAL = 1000000 / FRAMES_PER_SECOND;
 	static const uint32 MAX_CONNECTIONS = 10;
+	static const uint32 HANDLE_TIME_LIMIT = TIMER_INTERVAL / 2000; //ms, half of the interval
 
 	friend void localWebserverTimer(void *); //calls handle()
 
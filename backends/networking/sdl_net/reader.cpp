@@ -64,6 +64,8 @@ Reader &Reader::operator=(Reader &r) {
 	_windowUsed = r._windowUsed;
 	_windowSize = r._windowSize;
 	r._window = nullptr;
+	r._windowUsed = 0;
+	r._windowSize = 0;
 
 	_headersStream = r._headersStream;
 	r._headersStream = nullptr;
@@ -96,39 +98,30 @@ void Reader::cleanup() {
 
 bool Reader::readAndHandleFirstHeaders() {
 	Common::String boundary = "\r\n\r\n";
-	if (_window == nullptr) {
-		makeWindow(boundary.size());
-	}
 	if (_headersStream == nullptr) {
 		_headersStream = new Common::MemoryReadWriteStream(DisposeAfterUse::YES);
 	}
 
-	while (readOneByteInStream(_headersStream, boundary)) {
-		if (_headersStream->size() > SUSPICIOUS_HEADERS_SIZE) {
-			_isBadRequest = true;
-			return true;
-		}
-		if (!bytesLeft())
-			return false;
+	bool found = readInStreamUntil(_headersStream, boundary);
+	if ((uint32)_headersStream->size() > SUSPICIOUS_HEADERS_SIZE) {
+		_isBadRequest = true;
+		return true;
 	}
+	if (!found)
+		return false;
 	handleFirstHeaders(_headersStream);
 
-	freeWindow();
 	_state = RS_READING_CONTENT;
 	return true;
 }
 
 bool Reader::readBlockHeadersIntoStream(Common::WriteStream *stream) {
 	Common::String boundary = "\r\n\r\n";
-	if (_window == nullptr) makeWindow(boundary.size());
 
-	while (readOneByteInStream(stream, boundary)) {
-		if (!bytesLeft())
-			return false;
-	}
+	if (!readInStreamUntil(stream, boundary))
+		return false;
 	if (stream) stream->flush();
 
-	freeWindow();
 	_state = RS_READING_CONTENT;
 	return true;
 }
@@ -285,28 +278,29 @@ bool Reader::readContentIntoStream(Common::WriteStream *stream) {
 		boundary = "\r\n" + boundary;
 	if (_boundary.empty())
 		boundary = "\r\n";
-	if (_window == nullptr)
-		makeWindow(boundary.size());
 
-	while (readOneByteInStream(stream, boundary)) {
-		if (!bytesLeft())
-			return false;
-	}
+	if (!readInStreamUntil(stream, boundary))
+		return false;
 
 	_firstBlock = false;
 	if (stream)
 		stream->flush();
 
-	freeWindow();
 	_state = RS_READING_HEADERS;
 	return true;
 }
 
 void Reader::makeWindow(uint32 size) {
-	freeWindow();
+	if (size <= _windowSize)
+		return;
 
-	_window = new byte[size];
-	_windowUsed = 0;
+	//keep the bytes which were not handled yet
+	byte *window = new byte[size];
+	if (_windowUsed != 0)
+		memcpy(window, _window, _windowUsed);
+	delete[] _window;
+
+	_window = window;
 	_windowSize = size;
 }
 
@@ -317,43 +311,71 @@ void Reader::freeWindow() {
 }
 
 namespace {
-bool windowEqualsString(const byte *window, uint32 windowSize, const Common::String &boundary) {
-	if (boundary.size() != windowSize)
-		return false;
-
-	for (uint32 i = 0; i < windowSize; ++i) {
-		if (window[i] != boundary[i])
-			return false;
+/**
+ * Returns how many bytes from the beginning of the window can't be
+ * a part of the boundary. If the boundary is in the window, it's
+ * where the boundary starts, and <found> is set.
+ */
+uint32 findBoundary(const byte *window, uint32 windowSize, const Common::String &boundary, bool &found) {
+	const uint32 boundarySize = boundary.size();
+	found = false;
+
+	const byte *position = window;
+	const byte *end = window + windowSize;
+	while ((position = (const byte *)memchr(position, boundary[0], end - position)) != nullptr) {
+		uint32 size = MIN<uint32>(boundarySize, end - position);
+		if (memcmp(position, boundary.c_str(), size) == 0) {
+			//the whole boundary, or its beginning at the end of the window
+			found = (size == boundarySize);
+			return position - window;
+		}
+		++position;
 	}
 
-	return true;
+	return windowSize;
 }
 }
 
-bool Reader::readOneByteInStream(Common::WriteStream *stream, const Common::String &boundary) {
-	byte b = readOne();
-	_window[_windowUsed++] = b;
-	if (_windowUsed < _windowSize)
-		return true;
+bool Reader::readInStreamUntil(Common::WriteStream *stream, const Common::String &boundary) {
+	makeWindow(MAX<uint32>(WINDOW_SIZE, 2 * boundary.size()));
 
-	//when window is filled, check whether that's the boundary
-	if (windowEqualsString(_window, _windowSize, boundary))
-		return false;
+	while (true) {
+		uint32 readBytes = MIN<uint32>(_bytesLeft, _windowSize - _windowUsed);
+		if (readBytes != 0) {
+			readBytes = _content->read(_window + _windowUsed, readBytes);
+			_windowUsed += readBytes;
+			_bytesLeft -= readBytes;
+		}
 
-	//if not, add the first byte of the window to the string
-	if (stream)
-		stream->writeByte(_window[0]);
-	for (uint32 i = 1; i < _windowSize; ++i)
-		_window[i - 1] = _window[i];
-	--_windowUsed;
-	return true;
+		//pass the bytes before the boundary straight into the stream
+		bool found;
+		uint32 handledBytes = findBoundary(_window, _windowUsed, boundary, found);
+		if (stream && handledBytes != 0)
+			stream->write(_window, handledBytes);
+		if (found)
+			handledBytes += boundary.size();
+
+		_windowUsed -= handledBytes;
+		_availableBytes -= handledBytes;
+		memmove(_window, _window + handledBytes, _windowUsed);
+
+		if (found)
+			return true;
+		if (_bytesLeft == 0)
+			return false;
+	}
 }
 
 byte Reader::readOne() {
 	byte b = 0;
-	_content->read(&b, 1);
+	if (_windowUsed != 0) {
+		b = _window[0];
+		memmove(_window, _window + 1, --_windowUsed);
+	} else {
+		_content->read(&b, 1);
+		--_bytesLeft;
+	}
 	--_availableBytes;
-	--_bytesLeft;
 	return b;
 }
 
@@ -423,13 +445,15 @@ bool Reader::readBlockContent(Common::WriteStream *stream) {
 	return true;
 }
 
-uint32 Reader::bytesLeft() const { return _bytesLeft; }
+uint32 Reader::bytesLeft() const { return _windowUsed + _bytesLeft; }
 
 void Reader::setContent(Common::MemoryReadWriteStream *stream) {
 	_content = stream;
 	_bytesLeft = stream->size() - stream->pos();
 }
 
+bool Reader::hasBufferedContent() const { return _windowUsed != 0; }
+
 bool Reader::badRequest() const { return _isBadRequest; }
 
 bool Reader::noMoreContent() const { return _allContentRead; }
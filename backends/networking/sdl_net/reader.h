@@ -77,6 +77,7 @@ class Reader {
 	Common::MemoryReadWriteStream *_content;
 	uint32 _bytesLeft;
 
+	/** Bytes which were read from the content, but not handled yet. */
 	byte *_window;
 	uint32 _windowUsed, _windowSize;
 
@@ -105,13 +106,14 @@ class Reader {
 
 	void makeWindow(uint32 size);
 	void freeWindow();
-	bool readOneByteInStream(Common::WriteStream *stream, const Common::String &boundary);
+	bool readInStreamUntil(Common::WriteStream *stream, const Common::String &boundary); //true when boundary was found
 
 	byte readOne();
 	uint32 bytesLeft() const;
 
 public:
 	static const uint32 SUSPICIOUS_HEADERS_SIZE = 1024 * 1024; // 1 MB is really a lot
+	static const uint32 WINDOW_SIZE = 64 * 1024;
 
 	Reader();
 	~Reader();
@@ -125,6 +127,13 @@ public:
 
 	void setContent(Common::MemoryReadWriteStream *stream);
 
+	/**
+	 * Returns whether Reader holds bytes which were read from
+	 * the content, but not handled yet. These are handled by
+	 * the next reading method, even if no content is set.
+	 */
+	bool hasBufferedContent() const;
+
 	bool badRequest() const;
 	bool noMoreContent() const;
 
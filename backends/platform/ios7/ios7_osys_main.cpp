@@ -91,6 +91,7 @@ public:
 		Common::String chrootedFile = getSavePath() + "/" + filename;
 		Common::String realFilePath = _sandboxRootPath + chrootedFile;
 
+		++_changeCount;
 		if (remove(realFilePath.c_str()) != 0) {
 			if (errno == EACCES)
 				setError(Common::kWritePermissionDenied, "Search or write permission denied: "+chrootedFile);
@@ -27,6 +27,7 @@
 #define FORBIDDEN_SYMBOL_EXCEPTION_stdout
 #define FORBIDDEN_SYMBOL_EXCEPTION_stderr
 #define FORBIDDEN_SYMBOL_EXCEPTION_fputs
+#define FORBIDDEN_SYMBOL_EXCEPTION_getenv
 
 #include "backends/modular-backend.h"
 #include "base/main.h"
@@ -38,8 +39,18 @@
 #include "backends/mutex/null/null-mutex.h"
 #include "backends/graphics/null/null-graphics.h"
 #include "audio/mixer_intern.h"
+#include "common/events.h"
+#include "common/profiler.h"
 #include "common/scummsys.h"
 
+#ifdef ENABLE_EVENTRECORDER
+#include "gui/EventRecorder.h"
+#endif
+
+#if defined(POSIX)
+#include <sys/time.h>
+#endif
+
 /*
  * Include header files needed for the getFilesystemFactory() method.
  */
@@ -53,24 +64,67 @@
 	#include "backends/fs/windows/windows-fs-factory.h"
 #endif
 
+/*
+ * Setting SCUMMVM_BENCHMARK turns the backend into a benchmark rig. Time
+ * then only advances when the game waits, so that runs are repeatable and
+ * not limited to real time. Timers fire and the mixer is pulled at
+ * SCUMMVM_BENCHMARK_RATE (22050 by default) as the virtual clock advances.
+ * After SCUMMVM_BENCHMARK seconds of virtual time, or when the game quits
+ * if it is 0, the frames per second and the time taken by the timers, the
+ * mixer and the profiler zones are reported. Recorded events can be
+ * replayed with --record-mode=playback.
+ */
 class OSystem_NULL : public ModularBackend, Common::EventSource {
 public:
 	OSystem_NULL();
 	virtual ~OSystem_NULL();
 
 	virtual void initBackend();
+	virtual void engineDone();
 
 	virtual Common::EventSource *getDefaultEventSource() { return this; }
 	virtual bool pollEvent(Common::Event &event);
 
+	virtual void updateScreen();
+
 	virtual uint32 getMillis(bool skipRecord = false);
+	virtual uint64 getMicros();
 	virtual void delayMillis(uint msecs);
 	virtual void getTimeAndDate(TimeDate &t) const {}
 
 	virtual void logMessage(LogMessageType::Type type, const char *message);
+
+private:
+	enum {
+		/** Calls to getMillis() after which a busy waiting game gets a millisecond. */
+		kBusyWaitCalls = 1000,
+		kMixFrames = 1024
+	};
+
+	bool _benchmark;
+	uint32 _benchmarkDuration;
+	uint32 _outputRate;
+
+	uint32 _virtualMillis;
+	uint _millisCalls;
+	bool _advancing;
+	bool _quitSent;
+
+	uint64 _samplesMixed;
+	int16 *_mixBuffer;
+
+	uint32 _frames;
+	uint64 _startMicros;
+	uint64 _timerMicros;
+	uint64 _mixerMicros;
+
+	void advanceClock(uint msecs);
+	void printBenchmarkReport();
 };
 
-OSystem_NULL::OSystem_NULL() {
+OSystem_NULL::OSystem_NULL() : _benchmark(false), _benchmarkDuration(0), _outputRate(22050),
+		_virtualMillis(0), _millisCalls(0), _advancing(false), _quitSent(false), _samplesMixed(0), _mixBuffer(0),
+		_frames(0), _startMicros(0), _timerMicros(0), _mixerMicros(0) {
 	#if defined(__amigaos4__)
 		_fsFactory = new AmigaOSFilesystemFactory();
 	#elif defined(POSIX)
@@ -85,34 +139,146 @@ OSystem_NULL::OSystem_NULL() {
 }
 
 OSystem_NULL::~OSystem_NULL() {
+	delete[] _mixBuffer;
 }
 
 void OSystem_NULL::initBackend() {
+	const char *benchmark = getenv("SCUMMVM_BENCHMARK");
+	if (benchmark) {
+		_benchmark = true;
+		_benchmarkDuration = atoi(benchmark) * 1000;
+
+		const char *rate = getenv("SCUMMVM_BENCHMARK_RATE");
+		if (rate && atoi(rate) > 0)
+			_outputRate = atoi(rate);
+	}
+
 	_mutexManager = new NullMutexManager();
 	_timerManager = new DefaultTimerManager();
 	_eventManager = new DefaultEventManager(this);
 	_savefileManager = new DefaultSaveFileManager();
 	_graphicsManager = new NullGraphicsManager();
-	_mixer = new Audio::MixerImpl(this, 22050);
-
-	((Audio::MixerImpl *)_mixer)->setReady(false);
+	_mixer = new Audio::MixerImpl(this, _outputRate);
 
-	// Note that both the mixer and the timer manager are useless
-	// this way; they need to be hooked into the system somehow to
-	// be functional. Of course, can't do that in a NULL backend :).
+	// Note that without a benchmark, both the mixer and the timer
+	// manager are useless; nothing drives them.
+	((Audio::MixerImpl *)_mixer)->setReady(_benchmark);
+	if (_benchmark)
+		_mixBuffer = new int16[kMixFrames * 2];
 
 	ModularBackend::initBackend();
+
+	if (_benchmark) {
+		ProfilerMan.setEnabled(true);
+		_startMicros = getMicros();
+	}
+}
+
+void OSystem_NULL::engineDone() {
+	if (_benchmark)
+		printBenchmarkReport();
 }
 
 bool OSystem_NULL::pollEvent(Common::Event &event) {
+	if (_benchmark && _benchmarkDuration && _virtualMillis >= _benchmarkDuration && !_quitSent) {
+		_quitSent = true;
+		event.type = Common::EVENT_QUIT;
+		return true;
+	}
+
 	return false;
 }
 
+void OSystem_NULL::updateScreen() {
+	ModularBackend::updateScreen();
+	_frames++;
+}
+
 uint32 OSystem_NULL::getMillis(bool skipRecord) {
-	return 0;
+	uint32 millis = 0;
+
+	if (_benchmark) {
+		// Keep games which wait for the time to pass from hanging
+		if (++_millisCalls >= kBusyWaitCalls)
+			advanceClock(1);
+		millis = _virtualMillis;
+	}
+
+#ifdef ENABLE_EVENTRECORDER
+	g_eventRec.processMillis(millis, skipRecord);
+#endif
+
+	return millis;
+}
+
+uint64 OSystem_NULL::getMicros() {
+#if defined(POSIX)
+	// Profiling needs the real time, also with a virtual clock
+	timeval tv;
+	gettimeofday(&tv, 0);
+	return (uint64)tv.tv_sec * 1000000 + tv.tv_usec;
+#else
+	return ModularBackend::getMicros();
+#endif
 }
 
 void OSystem_NULL::delayMillis(uint msecs) {
+	if (_benchmark)
+		advanceClock(msecs);
+}
+
+void OSystem_NULL::advanceClock(uint msecs) {
+	_virtualMillis += msecs;
+	_millisCalls = 0;
+
+	// Timer callbacks and audio streams may wait themselves
+	if (_advancing)
+		return;
+	_advancing = true;
+
+	uint64 start = getMicros();
+	((DefaultTimerManager *)_timerManager)->handler();
+	uint64 mixStart = getMicros();
+	_timerMicros += mixStart - start;
+
+	const uint64 samplesDue = (uint64)_virtualMillis * _outputRate / 1000;
+	while (_samplesMixed < samplesDue) {
+		const uint frames = (uint)MIN<uint64>(samplesDue - _samplesMixed, kMixFrames);
+		((Audio::MixerImpl *)_mixer)->mixCallback((byte *)_mixBuffer, frames * 4);
+		_samplesMixed += frames;
+	}
+	_mixerMicros += getMicros() - mixStart;
+
+	_advancing = false;
+}
+
+void OSystem_NULL::printBenchmarkReport() {
+	const uint64 wallMicros = MAX<uint64>(getMicros() - _startMicros, 1);
+
+	Common::String report = Common::String::format("Benchmark: %u frames in %u ms of game time, %u ms of real time, %.1f frames per second\n",
+		_frames, _virtualMillis, (uint32)(wallMicros / 1000), _frames * 1000000.0 / wallMicros);
+	report += Common::String::format("  timers: %u ms, mixer: %u ms, rest: %u ms\n",
+		(uint32)(_timerMicros / 1000), (uint32)(_mixerMicros / 1000), (uint32)((wallMicros - _timerMicros - _mixerMicros) / 1000));
+
+	Common::Array<DefaultTimerManager::TimerStats> timers;
+	((DefaultTimerManager *)_timerManager)->getStats(timers);
+	for (uint i = 0; i < timers.size(); ++i) {
+		report += Common::String::format("  timer %s: %u calls, %u ms\n",
+			timers[i].id.c_str(), timers[i].calls, (uint32)(timers[i].totalMicros / 1000));
+	}
+
+	if (Common::Profiler::isActive()) {
+		for (uint i = 0; i < ProfilerMan.getZoneCount(); ++i) {
+			report += Common::String::format("  zone %s: %u us per frame\n",
+				ProfilerMan.getZoneName(i), ProfilerMan.getAverageZoneTime(i));
+		}
+		for (uint i = 0; i < ProfilerMan.getCounterCount(); ++i) {
+			report += Common::String::format("  counter %s: %u per frame\n",
+				ProfilerMan.getCounterName(i), ProfilerMan.getAverageCount(i));
+		}
+	}
+
+	logMessage(LogMessageType::kInfo, report.c_str());
 }
 
 void OSystem_NULL::logMessage(LogMessageType::Type type, const char *message) {
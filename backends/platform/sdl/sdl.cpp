@@ -47,6 +47,7 @@
 #include "backends/events/default/default-events.h"
 #include "backends/events/sdl/sdl-events.h"
 #include "backends/mutex/sdl/sdl-mutex.h"
+#include "backends/threads/sdl/sdl-threads.h"
 #include "backends/timer/sdl/sdl-timer.h"
 #include "backends/graphics/surfacesdl/surfacesdl-graphics.h"
 #ifdef USE_OPENGL
@@ -169,6 +170,9 @@ void OSystem_SDL::init() {
 	if (_mutexManager == 0)
 		_mutexManager = new SdlMutexManager();
 
+	if (_threadManager == 0)
+		_threadManager = new SdlThreadManager();
+
 	if (_window == 0)
 		_window = new SdlWindow();
 
@@ -553,6 +557,16 @@ uint32 OSystem_SDL::getMillis(bool skipRecord) {
 	return millis;
 }
 
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+uint64 OSystem_SDL::getMicros() {
+	const Uint64 counter = SDL_GetPerformanceCounter();
+	const Uint64 frequency = SDL_GetPerformanceFrequency();
+
+	// Split the conversion to avoid overflowing with high frequencies
+	return (counter / frequency) * 1000000 + (counter % frequency) * 1000000 / frequency;
+}
+#endif
+
 void OSystem_SDL::delayMillis(uint msecs) {
 #ifdef ENABLE_EVENTRECORDER
 	if (!g_eventRec.processDelayMillis())
@@ -560,6 +574,24 @@ void OSystem_SDL::delayMillis(uint msecs) {
 		SDL_Delay(msecs);
 }
 
+void OSystem_SDL::waitForEvents(uint msecs) {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	// Before SDL 2.0.16 waiting for events was implemented by polling every
+	// millisecond, which wakes up the process more often than a plain delay.
+	SDL_version linked;
+	SDL_GetVersion(&linked);
+	if (SDL_VERSIONNUM(linked.major, linked.minor, linked.patch) >= SDL_VERSIONNUM(2, 0, 16)) {
+#ifdef ENABLE_EVENTRECORDER
+		if (!g_eventRec.processDelayMillis())
+#endif
+			SDL_WaitEventTimeout(nullptr, msecs);
+		return;
+	}
+#endif
+
+	delayMillis(msecs);
+}
+
 void OSystem_SDL::getTimeAndDate(TimeDate &td) const {
 	time_t curTime = time(0);
 	struct tm t = *localtime(&curTime);
@@ -95,6 +95,7 @@ bool TizenSaveFileManager::removeSavefile(const Common::String &filename) {
 		// Remove from cache, this invalidates the 'file' iterator.
 		_saveFileCache.erase(file);
 		file = _saveFileCache.end();
+		++_changeCount;
 
 		String unicodeFileName;
 		StringUtil::Utf8ToString(fileNode.getPath().c_str(), unicodeFileName);
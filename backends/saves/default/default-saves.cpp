@@ -41,6 +41,8 @@
 #include "common/fs.h"
 #include "common/archive.h"
 #include "common/config-manager.h"
+#include "common/memstream.h"
+#include "common/textconsole.h"
 #include "common/zlib.h"
 
 #ifndef _WIN32_WCE
@@ -51,13 +53,249 @@
 const char *DefaultSaveFileManager::TIMESTAMPS_FILENAME = "timestamps";
 #endif
 
-DefaultSaveFileManager::DefaultSaveFileManager() {
+namespace {
+
+/**
+ * Savefiles are written to files with this prefix first. It keeps them out
+ * of the listed savefiles and hides them on POSIX systems.
+ */
+const char *const kTempFilePrefix = ".~";
+
+/** Autosave deltas start with this tag. */
+const uint32 kDeltaTag = MKTAG('S', 'D', 'L', 'T');
+const uint32 kDeltaVersion = 1;
+
+/** Unchanged runs shorter than this are stored with the changed bytes around them. */
+const uint32 kDeltaMinCopy = 32;
+
+/**
+ * Deltas written against the same full version before writing a new one.
+ * A new one is also written once a delta is larger than half the savefile.
+ */
+const uint kMaxDeltas = 16;
+
+Common::String getDeltaBaseName(const Common::String &filename, uint index) {
+	// The prefix keeps them out of the listed savefiles
+	return Common::String::format("%s%s.~base%u", kTempFilePrefix, filename.c_str(), index);
+}
+
+uint32 computeChecksum(const byte *data, uint32 size) {
+	// FNV-1a
+	uint32 hash = 2166136261U;
+	for (uint32 i = 0; i < size; ++i) {
+		hash = (hash ^ data[i]) * 16777619U;
+	}
+	return hash;
+}
+
+/**
+ * Store data as runs copied from the same position in base, each followed
+ * by a run of changed bytes.
+ *
+ * @return false if the delta became larger than maxSize.
+ */
+bool encodeDelta(const byte *base, uint32 baseSize, const byte *data, uint32 size, Common::WriteStream &out, uint32 maxSize) {
+	uint32 pos = 0;
+	while (pos < size) {
+		uint32 copy = 0;
+		while (pos + copy < size && pos + copy < baseSize && data[pos + copy] == base[pos + copy]) {
+			++copy;
+		}
+
+		const uint32 start = pos + copy;
+		uint32 end = start;
+		while (end < size) {
+			uint32 same = 0;
+			while (same < kDeltaMinCopy && end + same < size && end + same < baseSize && data[end + same] == base[end + same]) {
+				++same;
+			}
+			if (same == kDeltaMinCopy) {
+				break;
+			}
+			end = MIN(end + same + 1, size);
+		}
+
+		out.writeUint32BE(copy);
+		out.writeUint32BE(end - start);
+		out.write(data + start, end - start);
+		if ((uint32)out.pos() > maxSize) {
+			return false;
+		}
+		pos = end;
+	}
+	return true;
+}
+
+bool decodeDelta(const byte *base, uint32 baseSize, Common::ReadStream &in, byte *data, uint32 size) {
+	uint32 pos = 0;
+	while (pos < size) {
+		const uint32 copy = in.readUint32BE();
+		const uint32 literal = in.readUint32BE();
+		if (in.err() || in.eos() || copy > size - pos || literal > size - pos - copy || pos + copy > baseSize) {
+			return false;
+		}
+
+		memcpy(data + pos, base + pos, copy);
+		pos += copy;
+		if (in.read(data + pos, literal) != literal) {
+			return false;
+		}
+		pos += literal;
+	}
+	return true;
 }
 
-DefaultSaveFileManager::DefaultSaveFileManager(const Common::String &defaultSavepath) {
+} // End of anonymous namespace
+
+struct DefaultSaveFileManager::PendingWrite {
+	enum State {
+		kQueued,
+		kWriting,
+		kWritten,
+		kFailed
+	};
+
+	Common::String filename;	///< Only used on the main thread.
+	Common::String path;
+	Common::String tempPath;
+	bool compress;
+
+	byte *data;
+	uint32 size;
+
+	State state;
+	bool streamOpen;	///< Whether its BufferedSaveStream still refers to it.
+};
+
+/**
+ * Collects a savefile in memory and queues it for writing once finalized.
+ * Checking for errors after that waits until the savefile is written.
+ */
+class DefaultSaveFileManager::BufferedSaveStream : public Common::WriteStream {
+public:
+	BufferedSaveStream(DefaultSaveFileManager *manager, PendingWrite *write)
+	    : _manager(manager), _write(write), _queued(false), _checked(false), _err(false), _buffer(DisposeAfterUse::NO) {}
+
+	virtual ~BufferedSaveStream() {
+		finalize();
+		_manager->releaseWrite(_write);
+	}
+
+	virtual bool err() const {
+		if (_queued && !_checked) {
+			_err = !_manager->waitForWrite(_write);
+			_checked = true;
+		}
+		return _err;
+	}
+
+	virtual uint32 write(const void *dataPtr, uint32 dataSize) {
+		assert(!_queued);
+		return _buffer.write(dataPtr, dataSize);
+	}
+
+	virtual int32 pos() const {
+		return _buffer.pos();
+	}
+
+	virtual void finalize() {
+		if (_queued) {
+			return;
+		}
+
+		_write->data = _buffer.getData();
+		_write->size = _buffer.size();
+		_manager->queueWrite(_write);
+		_queued = true;
+	}
+
+private:
+	DefaultSaveFileManager *_manager;
+	PendingWrite *_write;
+	bool _queued;
+	mutable bool _checked;
+	mutable bool _err;
+	Common::MemoryWriteStreamDynamic _buffer;
+};
+
+/**
+ * Collects an autosave in memory and writes it as a delta once finalized.
+ */
+class DefaultSaveFileManager::AutosaveStream : public Common::WriteStream {
+public:
+	AutosaveStream(DefaultSaveFileManager *manager, const Common::String &filename, bool compress)
+	    : _manager(manager), _filename(filename), _compress(compress), _finalized(false), _err(false), _buffer(DisposeAfterUse::NO) {}
+
+	virtual ~AutosaveStream() {
+		finalize();
+	}
+
+	virtual bool err() const {
+		return _err;
+	}
+
+	virtual uint32 write(const void *dataPtr, uint32 dataSize) {
+		assert(!_finalized);
+		return _buffer.write(dataPtr, dataSize);
+	}
+
+	virtual int32 pos() const {
+		return _buffer.pos();
+	}
+
+	virtual void finalize() {
+		if (_finalized) {
+			return;
+		}
+
+		_finalized = true;
+		_err = !_manager->writeAutosave(_filename, _compress, _buffer.getData(), _buffer.size());
+	}
+
+private:
+	DefaultSaveFileManager *_manager;
+	Common::String _filename;
+	bool _compress;
+	bool _finalized;
+	bool _err;
+	Common::MemoryWriteStreamDynamic _buffer;
+};
+
+DefaultSaveFileManager::DefaultSaveFileManager()
+    : _changeCount(0), _writeMutex(0), _writeSem(0), _writtenSem(0), _writerThread(0), _writerUnavailable(false),
+      _writerQuit(false), _writeFailed(false) {
+}
+
+DefaultSaveFileManager::DefaultSaveFileManager(const Common::String &defaultSavepath)
+    : _changeCount(0), _writeMutex(0), _writeSem(0), _writtenSem(0), _writerThread(0), _writerUnavailable(false),
+      _writerQuit(false), _writeFailed(false) {
 	ConfMan.registerDefault("savepath", defaultSavepath);
 }
 
+DefaultSaveFileManager::~DefaultSaveFileManager() {
+	for (DeltaBaseMap::iterator i = _deltaBases.begin(); i != _deltaBases.end(); ++i) {
+		free(i->_value.data);
+	}
+
+	if (!_writerThread) {
+		return;
+	}
+
+	// The writer thread writes all queued savefiles before it quits
+	g_system->lockMutex(_writeMutex);
+	_writerQuit = true;
+	g_system->unlockMutex(_writeMutex);
+	g_system->postSemaphore(_writeSem);
+	g_system->joinThread(_writerThread);
+
+	removeFinishedWrites();
+	assert(_pendingWrites.empty());
+
+	g_system->deleteSemaphore(_writtenSem);
+	g_system->deleteSemaphore(_writeSem);
+	g_system->deleteMutex(_writeMutex);
+}
+
 
 void DefaultSaveFileManager::checkPath(const Common::FSNode &dir) {
 	clearError();
@@ -73,6 +311,8 @@ void DefaultSaveFileManager::updateSavefilesList(Common::StringArray &lockedFile
 	_cachedDirectory = "";
 
 	//remember the locked files list because some of these files don't exist yet
+	if (_lockedFiles != lockedFiles)
+		++_changeCount;
 	_lockedFiles = lockedFiles;
 }
 
@@ -102,6 +342,8 @@ Common::InSaveFile *DefaultSaveFileManager::openRawFile(const Common::String &fi
 	if (getError().getCode() != Common::kNoError)
 		return nullptr;
 
+	waitForPendingWrite(filename);
+
 	SaveFileCache::const_iterator file = _saveFileCache.find(filename);
 	if (file == _saveFileCache.end()) {
 		return nullptr;
@@ -124,13 +366,16 @@ Common::InSaveFile *DefaultSaveFileManager::openForLoading(const Common::String
 		}
 	}
 
+	waitForPendingWrite(filename);
+
 	SaveFileCache::const_iterator file = _saveFileCache.find(filename);
 	if (file == _saveFileCache.end()) {
 		return nullptr;
 	} else {
 		// Open the file for loading.
 		Common::SeekableReadStream *sf = file->_value.createReadStream();
-		return Common::wrapCompressedReadStream(sf);
+		sf = Common::wrapCompressedReadStream(sf);
+		return sf ? resolveDelta(filename, sf) : nullptr;
 	}
 }
 
@@ -166,22 +411,262 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 		fileNode = file->_value;
 	}
 
-	// Open the file for saving.
-	Common::WriteStream *const sf = fileNode.createWriteStream();
-	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf) : sf);
+	// Writes of the same savefile must not overlap.
+	waitForPendingWrite(filename);
+
+	Common::OutSaveFile *result = new Common::OutSaveFile(createSaveStream(fileNode, filename, compress));
 
 	// Add file to cache now that it exists.
 	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
+	++_changeCount;
 
 	return result;
 }
 
+Common::OutSaveFile *DefaultSaveFileManager::openForAutosaving(const Common::String &filename, bool compress) {
+	if (!ConfMan.getBool("autosave_deltas")) {
+		return openForSaving(filename, compress);
+	}
+
+	// Fail early like openForSaving() would, the savefile is only opened
+	// once the autosave is complete.
+	assureCached(getSavePath());
+	if (getError().getCode() != Common::kNoError)
+		return nullptr;
+
+	for (Common::StringArray::const_iterator i = _lockedFiles.begin(), end = _lockedFiles.end(); i != end; ++i) {
+		if (filename == *i) {
+			return nullptr;
+		}
+	}
+
+	return new Common::OutSaveFile(new AutosaveStream(this, filename, compress));
+}
+
+Common::WriteStream *DefaultSaveFileManager::createSaveStream(const Common::FSNode &fileNode, const Common::String &filename, bool compress) {
+	if (startWriter()) {
+		// Collect the savefile in memory for the writer thread. The paths
+		// are copied, so that no string data is shared between threads.
+		const Common::FSNode tempNode = fileNode.getParent().getChild(kTempFilePrefix + filename);
+
+		PendingWrite *write = new PendingWrite();
+		write->filename = filename;
+		write->path = Common::String(fileNode.getPath().c_str());
+		write->tempPath = Common::String(tempNode.getPath().c_str());
+		write->compress = compress;
+		write->data = nullptr;
+		write->size = 0;
+		write->state = PendingWrite::kQueued;
+		write->streamOpen = true;
+
+		return new BufferedSaveStream(this, write);
+	} else {
+		// Open the file for saving.
+		Common::WriteStream *const sf = fileNode.createWriteStream();
+		return compress ? Common::wrapCompressedWriteStream(sf) : sf;
+	}
+}
+
+bool DefaultSaveFileManager::writeAutosave(const Common::String &filename, bool compress, byte *data, uint32 size) {
+	Common::MemoryWriteStreamDynamic delta(DisposeAfterUse::YES);
+	bool success = true;
+
+	DeltaBaseMap::iterator base = _deltaBases.find(filename);
+	if (base != _deltaBases.end() && base->_value.deltas < kMaxDeltas) {
+		delta.writeUint32BE(kDeltaTag);
+		delta.writeUint32BE(kDeltaVersion);
+		delta.writeUint32BE(base->_value.index);
+		delta.writeUint32BE(base->_value.size);
+		delta.writeUint32BE(base->_value.checksum);
+		delta.writeUint32BE(size);
+
+		if (encodeDelta(base->_value.data, base->_value.size, data, size, delta, size / 2)) {
+			base->_value.deltas++;
+			free(data);
+			data = nullptr;
+		}
+	}
+
+	if (data) {
+		// Write a new full version. The previous one is kept, in case the
+		// delta referring to it can not be replaced.
+		DeltaBase newBase;
+		newBase.data = data;
+		newBase.size = size;
+		newBase.checksum = computeChecksum(data, size);
+		if (base != _deltaBases.end()) {
+			newBase.index = 1 - base->_value.index;
+		} else {
+			// Not known since starting, but the savefile on disk may still
+			// refer to one of the full versions, which must be kept
+			const int referenced = getReferencedDeltaBase(filename);
+			newBase.index = (referenced >= 0) ? 1 - referenced : 0;
+		}
+		newBase.deltas = 0;
+
+		const Common::String baseName = getDeltaBaseName(filename, newBase.index);
+		waitForPendingWrite(baseName);
+		Common::WriteStream *stream = createSaveStream(Common::FSNode(getSavePath()).getChild(baseName), baseName, compress);
+		if (stream) {
+			stream->write(data, size);
+			stream->finalize();
+			success = !stream->err();
+			delete stream;
+		} else {
+			success = false;
+		}
+
+		if (base != _deltaBases.end()) {
+			free(base->_value.data);
+		}
+		_deltaBases[filename] = newBase;
+
+		// The savefile itself is then a delta without any changes
+		Common::MemoryWriteStreamDynamic emptyDelta(DisposeAfterUse::YES);
+		emptyDelta.writeUint32BE(kDeltaTag);
+		emptyDelta.writeUint32BE(kDeltaVersion);
+		emptyDelta.writeUint32BE(newBase.index);
+		emptyDelta.writeUint32BE(size);
+		emptyDelta.writeUint32BE(newBase.checksum);
+		emptyDelta.writeUint32BE(size);
+		encodeDelta(data, size, data, size, emptyDelta, 0xFFFFFFFF);
+
+		Common::OutSaveFile *out = openForSaving(filename, compress);
+		if (!out) {
+			return false;
+		}
+		out->write(emptyDelta.getData(), emptyDelta.size());
+		out->finalize();
+		success = success && !out->err();
+		delete out;
+		return success;
+	}
+
+	Common::OutSaveFile *out = openForSaving(filename, compress);
+	if (!out) {
+		return false;
+	}
+	out->write(delta.getData(), delta.size());
+	out->finalize();
+	success = !out->err();
+	delete out;
+	return success;
+}
+
+int DefaultSaveFileManager::getReferencedDeltaBase(const Common::String &filename) {
+	waitForPendingWrite(filename);
+	const Common::FSNode fileNode = Common::FSNode(getSavePath()).getChild(filename);
+	if (!fileNode.exists()) {
+		return -1;
+	}
+
+	Common::SeekableReadStream *stream = Common::wrapCompressedReadStream(fileNode.createReadStream());
+	if (!stream) {
+		return -1;
+	}
+
+	const uint32 tag = stream->readUint32BE();
+	const uint32 version = stream->readUint32BE();
+	const uint32 index = stream->readUint32BE();
+	const bool valid = !stream->eos() && !stream->err() && tag == kDeltaTag && version == kDeltaVersion && index <= 1;
+	delete stream;
+
+	return valid ? (int)index : -1;
+}
+
+Common::SeekableReadStream *DefaultSaveFileManager::resolveDelta(const Common::String &filename, Common::SeekableReadStream *stream) {
+	const uint32 tag = stream->readUint32BE();
+	if (stream->eos() || stream->err() || tag != kDeltaTag) {
+		stream->seek(0);
+		return stream;
+	}
+
+	const uint32 version = stream->readUint32BE();
+	const uint32 index = stream->readUint32BE();
+	const uint32 baseSize = stream->readUint32BE();
+	const uint32 baseChecksum = stream->readUint32BE();
+	const uint32 size = stream->readUint32BE();
+	if (stream->eos() || stream->err() || version != kDeltaVersion || index > 1) {
+		warning("DefaultSaveFileManager: Autosave '%s' is damaged", filename.c_str());
+		delete stream;
+		return nullptr;
+	}
+
+	// The full version is usually still known from writing the autosave
+	DeltaBase base;
+	DeltaBaseMap::iterator known = _deltaBases.find(filename);
+	if (known != _deltaBases.end() && known->_value.index == index && known->_value.size == baseSize && known->_value.checksum == baseChecksum) {
+		base = known->_value;
+	} else {
+		base.data = nullptr;
+		base.size = baseSize;
+		base.checksum = baseChecksum;
+		base.index = index;
+		base.deltas = 0;
+
+		const Common::String baseName = getDeltaBaseName(filename, index);
+		waitForPendingWrite(baseName);
+		const Common::FSNode baseNode = Common::FSNode(getSavePath()).getChild(baseName);
+		Common::SeekableReadStream *baseStream = Common::wrapCompressedReadStream(baseNode.createReadStream());
+		if (baseStream) {
+			base.data = (byte *)malloc(MAX<uint32>(baseSize, 1));
+			if (baseStream->read(base.data, baseSize) != baseSize || computeChecksum(base.data, baseSize) != baseChecksum) {
+				free(base.data);
+				base.data = nullptr;
+			}
+			delete baseStream;
+		}
+
+		if (!base.data) {
+			warning("DefaultSaveFileManager: The full version of autosave '%s' is missing or damaged", filename.c_str());
+			delete stream;
+			return nullptr;
+		}
+
+		if (known != _deltaBases.end()) {
+			free(known->_value.data);
+		}
+		_deltaBases[filename] = base;
+	}
+
+	byte *data = (byte *)malloc(MAX<uint32>(size, 1));
+	const bool success = decodeDelta(base.data, base.size, *stream, data, size);
+	delete stream;
+
+	if (!success) {
+		warning("DefaultSaveFileManager: Autosave '%s' is damaged", filename.c_str());
+		free(data);
+		return nullptr;
+	}
+
+	return new Common::MemoryReadStream(data, size, DisposeAfterUse::YES);
+}
+
+void DefaultSaveFileManager::removeDeltaBases(const Common::String &filename) {
+	DeltaBaseMap::iterator known = _deltaBases.find(filename);
+	if (known != _deltaBases.end()) {
+		free(known->_value.data);
+		_deltaBases.erase(known);
+	}
+
+	const Common::FSNode savePath(getSavePath());
+	for (uint i = 0; i < 2; ++i) {
+		const Common::FSNode baseNode = savePath.getChild(getDeltaBaseName(filename, i));
+		if (baseNode.exists()) {
+			remove(baseNode.getPath().c_str());
+		}
+	}
+}
+
 bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
 	if (getError().getCode() != Common::kNoError)
 		return false;
 
+	waitForPendingWrite(filename);
+	removeDeltaBases(filename);
+
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
 	// Update file's timestamp
 	Common::HashMap<Common::String, uint32> timestamps = loadTimestamps();
@@ -201,6 +686,7 @@ bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
 		// Remove from cache, this invalidates the 'file' iterator.
 		_saveFileCache.erase(file);
 		file = _saveFileCache.end();
+		++_changeCount;
 
 		// FIXME: remove does not exist on all systems. If your port fails to
 		// compile because of this, please let us know (scummvm-devel).
@@ -257,11 +743,16 @@ void DefaultSaveFileManager::assureCached(const Common::String &savePathName) {
 		return;
 	}
 
+	// Keep the previous cache to find out whether any savefiles changed.
+	const SaveFileCache previousCache = _saveFileCache;
+
 	_saveFileCache.clear();
 	_cachedDirectory.clear();
 
 	if (getError().getCode() != Common::kNoError) {
 		warning("DefaultSaveFileManager::assureCached: Can not cache path '%s': '%s'", savePathName.c_str(), getErrorDesc().c_str());
+		if (!previousCache.empty())
+			++_changeCount;
 		return;
 	}
 
@@ -271,11 +762,17 @@ void DefaultSaveFileManager::assureCached(const Common::String &savePathName) {
 
 	Common::FSList children;
 	if (!savePath.getChildren(children, Common::FSNode::kListFilesOnly)) {
+		if (!previousCache.empty())
+			++_changeCount;
 		return;
 	}
 
 	// Build the savefile name cache.
 	for (Common::FSList::const_iterator file = children.begin(), end = children.end(); file != end; ++file) {
+		if (file->getName().hasPrefix(kTempFilePrefix)) {
+			continue;
+		}
+
 		if (_saveFileCache.contains(file->getName())) {
 			warning("DefaultSaveFileManager::assureCached: Name clash when building cache, ignoring file '%s'", file->getName().c_str());
 		} else {
@@ -283,11 +780,245 @@ void DefaultSaveFileManager::assureCached(const Common::String &savePathName) {
 		}
 	}
 
+	// Files added or removed behind our back, or a different savepath,
+	// change the list of savefiles.
+	bool changed = (previousCache.size() != _saveFileCache.size());
+	for (SaveFileCache::const_iterator file = _saveFileCache.begin(), end = _saveFileCache.end(); file != end && !changed; ++file) {
+		SaveFileCache::const_iterator previous = previousCache.find(file->_key);
+		changed = (previous == previousCache.end() || previous->_value.getPath() != file->_value.getPath());
+	}
+
+	if (changed)
+		++_changeCount;
+
 	// Only now store that we cached 'savePathName' to indicate we successfully
 	// cached the directory.
 	_cachedDirectory = savePathName;
 }
 
+bool DefaultSaveFileManager::waitForPendingWrites() {
+	if (_writerThread) {
+		while (true) {
+			g_system->lockMutex(_writeMutex);
+			bool pending = false;
+			for (uint i = 0; i < _pendingWrites.size() && !pending; ++i) {
+				pending = _pendingWrites[i]->state < PendingWrite::kWritten;
+			}
+			g_system->unlockMutex(_writeMutex);
+
+			if (!pending) {
+				break;
+			}
+			g_system->waitSemaphore(_writtenSem);
+		}
+
+		removeFinishedWrites();
+	}
+
+	const bool success = !_writeFailed;
+	_writeFailed = false;
+	return success;
+}
+
+bool DefaultSaveFileManager::getChangeCount(uint32 &count) {
+	count = _changeCount;
+	return true;
+}
+
+void DefaultSaveFileManager::waitForPendingWrite(const Common::String &filename) {
+	if (!_writerThread) {
+		return;
+	}
+
+	while (true) {
+		g_system->lockMutex(_writeMutex);
+		bool pending = false;
+		for (uint i = 0; i < _pendingWrites.size() && !pending; ++i) {
+			pending = _pendingWrites[i]->state < PendingWrite::kWritten && _pendingWrites[i]->filename.equalsIgnoreCase(filename);
+		}
+		g_system->unlockMutex(_writeMutex);
+
+		if (!pending) {
+			break;
+		}
+		g_system->waitSemaphore(_writtenSem);
+	}
+
+	removeFinishedWrites();
+}
+
+bool DefaultSaveFileManager::waitForWrite(PendingWrite *write) {
+	while (true) {
+		g_system->lockMutex(_writeMutex);
+		const PendingWrite::State state = write->state;
+		g_system->unlockMutex(_writeMutex);
+
+		if (state >= PendingWrite::kWritten) {
+			return state == PendingWrite::kWritten;
+		}
+		g_system->waitSemaphore(_writtenSem);
+	}
+}
+
+void DefaultSaveFileManager::releaseWrite(PendingWrite *write) {
+	g_system->lockMutex(_writeMutex);
+	write->streamOpen = false;
+	g_system->unlockMutex(_writeMutex);
+
+	removeFinishedWrites();
+}
+
+bool DefaultSaveFileManager::startWriter() {
+	if (_writerThread) {
+		return true;
+	} else if (_writerUnavailable) {
+		return false;
+	}
+
+	_writeMutex = g_system->createMutex();
+	_writeSem = g_system->createSemaphore(0);
+	_writtenSem = g_system->createSemaphore(0);
+	if (_writeSem && _writtenSem) {
+		_writerThread = g_system->createThread(writerProc, this);
+	}
+
+	if (!_writerThread) {
+		// Write savefiles directly instead
+		g_system->deleteSemaphore(_writtenSem);
+		g_system->deleteSemaphore(_writeSem);
+		g_system->deleteMutex(_writeMutex);
+		_writtenSem = _writeSem = 0;
+		_writeMutex = 0;
+		_writerUnavailable = true;
+		return false;
+	}
+
+	return true;
+}
+
+void DefaultSaveFileManager::queueWrite(PendingWrite *write) {
+	removeFinishedWrites();
+
+	g_system->lockMutex(_writeMutex);
+	_pendingWrites.push_back(write);
+	g_system->unlockMutex(_writeMutex);
+	g_system->postSemaphore(_writeSem);
+}
+
+void DefaultSaveFileManager::removeFinishedWrites() {
+	if (!_writerThread) {
+		return;
+	}
+
+#if defined(USE_CLOUD) && defined(USE_LIBCURL)
+	bool written = false;
+#endif
+
+	g_system->lockMutex(_writeMutex);
+	for (uint i = 0; i < _pendingWrites.size(); ) {
+		PendingWrite *write = _pendingWrites[i];
+		if (write->state < PendingWrite::kWritten || write->streamOpen) {
+			++i;
+			continue;
+		}
+
+		if (write->state == PendingWrite::kFailed) {
+			warning("DefaultSaveFileManager: Failed to write savefile '%s'", write->filename.c_str());
+			_writeFailed = true;
+		}
+#if defined(USE_CLOUD) && defined(USE_LIBCURL)
+		else
+			written = true;
+#endif
+
+		_pendingWrites.remove_at(i);
+		delete write;
+	}
+	g_system->unlockMutex(_writeMutex);
+
+#if defined(USE_CLOUD) && defined(USE_LIBCURL)
+	// The sync started when the savefile was finalized may have missed it.
+	if (written)
+		CloudMan.syncSaves();
+#endif
+}
+
+bool DefaultSaveFileManager::writeToDisk(PendingWrite &write) {
+	Common::WriteStream *stream = Common::FSNode(write.tempPath).createWriteStream();
+	bool success = (stream != nullptr);
+
+	if (stream) {
+		if (write.compress) {
+			stream = Common::wrapCompressedWriteStream(stream);
+		}
+
+		stream->write(write.data, write.size);
+		stream->finalize();
+		success = !stream->err();
+		delete stream;
+	}
+
+	free(write.data);
+	write.data = nullptr;
+
+	if (success && rename(write.tempPath.c_str(), write.path.c_str()) != 0) {
+		// Replacing an existing file fails on some systems. Move the old
+		// file aside first, and put it back if the new one cannot take its
+		// place, so that the previous savefile is never lost.
+		const Common::String oldPath = write.tempPath + ".old";
+		remove(oldPath.c_str());
+		if (rename(write.path.c_str(), oldPath.c_str()) != 0) {
+			success = false;
+		} else if (rename(write.tempPath.c_str(), write.path.c_str()) != 0) {
+			rename(oldPath.c_str(), write.path.c_str());
+			success = false;
+		} else {
+			remove(oldPath.c_str());
+		}
+	}
+
+	if (!success) {
+		remove(write.tempPath.c_str());
+	}
+
+	return success;
+}
+
+void DefaultSaveFileManager::writerProc(void *param) {
+	DefaultSaveFileManager *manager = (DefaultSaveFileManager *)param;
+
+	while (true) {
+		g_system->waitSemaphore(manager->_writeSem);
+
+		g_system->lockMutex(manager->_writeMutex);
+		PendingWrite *write = nullptr;
+		for (uint i = 0; i < manager->_pendingWrites.size() && !write; ++i) {
+			if (manager->_pendingWrites[i]->state == PendingWrite::kQueued) {
+				write = manager->_pendingWrites[i];
+			}
+		}
+
+		if (!write) {
+			const bool quit = manager->_writerQuit;
+			g_system->unlockMutex(manager->_writeMutex);
+			if (quit) {
+				break;
+			}
+			continue;
+		}
+
+		write->state = PendingWrite::kWriting;
+		g_system->unlockMutex(manager->_writeMutex);
+
+		const bool success = writeToDisk(*write);
+
+		g_system->lockMutex(manager->_writeMutex);
+		write->state = success ? PendingWrite::kWritten : PendingWrite::kFailed;
+		g_system->unlockMutex(manager->_writeMutex);
+		g_system->postSemaphore(manager->_writtenSem);
+	}
+}
+
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
 
 Common::HashMap<Common::String, uint32> DefaultSaveFileManager::loadTimestamps() {
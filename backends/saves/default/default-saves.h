@@ -28,22 +28,38 @@
 #include "common/str.h"
 #include "common/fs.h"
 #include "common/hash-str.h"
+#include "common/system.h"
 #include <limits.h>
 
 /**
  * Provides a default savefile manager implementation for common platforms.
+ *
+ * If the backend supports threads, savefiles are collected in memory and
+ * compressed and written on a background thread once they are finalized.
+ * They are first written to a temporary file, which then replaces the
+ * savefile, so that a failed write never destroys an existing savefile.
+ * Opening or removing a savefile waits until it is written.
+ *
+ * With the "autosave_deltas" option, savefiles opened by openForAutosaving()
+ * are stored as the differences to the last full version, which is kept in
+ * a hidden file next to them. Every few saves, or once the differences grow
+ * large, a new full version is written.
  */
 class DefaultSaveFileManager : public Common::SaveFileManager {
 public:
 	DefaultSaveFileManager();
 	DefaultSaveFileManager(const Common::String &defaultSavepath);
+	virtual ~DefaultSaveFileManager();
 
 	virtual void updateSavefilesList(Common::StringArray &lockedFiles);
 	virtual Common::StringArray listSavefiles(const Common::String &pattern);
 	virtual Common::InSaveFile *openRawFile(const Common::String &filename);
 	virtual Common::InSaveFile *openForLoading(const Common::String &filename);
 	virtual Common::OutSaveFile *openForSaving(const Common::String &filename, bool compress = true);
+	virtual Common::OutSaveFile *openForAutosaving(const Common::String &filename, bool compress = true);
 	virtual bool removeSavefile(const Common::String &filename);
+	virtual bool waitForPendingWrites();
+	virtual bool getChangeCount(uint32 &count);
 
 #ifdef USE_LIBCURL
 
@@ -70,6 +86,12 @@ protected:
 	 */
 	virtual void checkPath(const Common::FSNode &dir);
 
+	/**
+	 * Wait until the given savefile is written, if it is currently being
+	 * written in the background.
+	 */
+	void waitForPendingWrite(const Common::String &filename);
+
 	/**
 	 * Assure that the given save path is cached.
 	 *
@@ -94,11 +116,94 @@ protected:
 	 */
 	Common::StringArray _lockedFiles;
 
+	/**
+	 * Incremented whenever savefiles are changed. Subclasses which change
+	 * savefiles on their own need to increment it too.
+	 */
+	uint32 _changeCount;
+
 private:
 	/**
 	 * The currently cached directory.
 	 */
 	Common::String _cachedDirectory;
+
+	class BufferedSaveStream;
+	class AutosaveStream;
+	struct PendingWrite;
+	friend class BufferedSaveStream;
+	friend class AutosaveStream;
+
+	/** The full version of an autosave which its deltas refer to. */
+	struct DeltaBase {
+		byte *data;
+		uint32 size;
+		uint32 checksum;
+		uint index;		///< Which of the two hidden files holds it.
+		uint deltas;	///< Deltas written against it so far.
+	};
+
+	typedef Common::HashMap<Common::String, DeltaBase, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> DeltaBaseMap;
+	DeltaBaseMap _deltaBases;
+
+	/**
+	 * Create the stream for writing a savefile, which goes through the
+	 * writer thread if possible.
+	 */
+	Common::WriteStream *createSaveStream(const Common::FSNode &fileNode, const Common::String &filename, bool compress);
+
+	/** Write an autosave as a delta, or as a new full version and an empty delta. */
+	bool writeAutosave(const Common::String &filename, bool compress, byte *data, uint32 size);
+
+	/**
+	 * Return the savefile a delta describes, or the stream itself if it is
+	 * not a delta. Takes over the stream.
+	 */
+	Common::SeekableReadStream *resolveDelta(const Common::String &filename, Common::SeekableReadStream *stream);
+
+	/**
+	 * Return which full version the savefile on disk is a delta against,
+	 * or -1 if it is missing or not a delta.
+	 */
+	int getReferencedDeltaBase(const Common::String &filename);
+
+	/** Remove the full versions of an autosave. */
+	void removeDeltaBases(const Common::String &filename);
+
+	/**
+	 * Start the background writer thread unless it is running already.
+	 * @return false if the backend does not support threads.
+	 */
+	bool startWriter();
+	void queueWrite(PendingWrite *write);
+
+	/**
+	 * Wait until a queued savefile is written.
+	 * @return whether it was written successfully.
+	 */
+	bool waitForWrite(PendingWrite *write);
+
+	/** Let a savefile be forgotten once written, as its stream is gone. */
+	void releaseWrite(PendingWrite *write);
+
+	/**
+	 * Forget about savefiles which are written, and warn about those
+	 * which could not be written.
+	 */
+	void removeFinishedWrites();
+
+	static bool writeToDisk(PendingWrite &write);
+	static void writerProc(void *param);
+
+	/** Savefiles queued for writing, in order; guarded by _writeMutex. */
+	Common::Array<PendingWrite *> _pendingWrites;
+	OSystem::MutexRef _writeMutex;
+	OSystem::SemaphoreRef _writeSem;	///< Posted for every queued savefile.
+	OSystem::SemaphoreRef _writtenSem;	///< Posted for every written savefile.
+	OSystem::ThreadRef _writerThread;
+	bool _writerUnavailable;
+	bool _writerQuit;
+	bool _writeFailed;
 };
 
 #endif
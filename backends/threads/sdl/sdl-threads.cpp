@@ -0,0 +1,95 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if defined(SDL_BACKEND)
+
+#include "backends/threads/sdl/sdl-threads.h"
+#include "backends/platform/sdl/sdl-sys.h"
+
+namespace {
+
+// SDL threads return an int, ours don't; the trampoline bridges the two.
+struct SdlThread {
+	SDL_Thread *thread;
+	OSystem::ThreadProc proc;
+	void *param;
+};
+
+int SDLCALL threadTrampoline(void *data) {
+	SdlThread *t = (SdlThread *)data;
+	t->proc(t->param);
+	return 0;
+}
+
+} // End of anonymous namespace
+
+OSystem::ThreadRef SdlThreadManager::createThread(OSystem::ThreadProc proc, void *param) {
+	SdlThread *t = new SdlThread;
+	t->proc = proc;
+	t->param = param;
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	t->thread = SDL_CreateThread(threadTrampoline, "ScummVM worker", t);
+#else
+	t->thread = SDL_CreateThread(threadTrampoline, t);
+#endif
+	if (!t->thread) {
+		delete t;
+		return 0;
+	}
+	return (OSystem::ThreadRef)t;
+}
+
+void SdlThreadManager::joinThread(OSystem::ThreadRef thread) {
+	SdlThread *t = (SdlThread *)thread;
+	SDL_WaitThread(t->thread, NULL);
+	delete t;
+}
+
+uint SdlThreadManager::getCPUCount() {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	int count = SDL_GetCPUCount();
+	return count > 1 ? (uint)count : 1;
+#else
+	// SDL 1.2 has no way to query this.
+	return 1;
+#endif
+}
+
+OSystem::SemaphoreRef SdlThreadManager::createSemaphore(uint initialValue) {
+	return (OSystem::SemaphoreRef) SDL_CreateSemaphore(initialValue);
+}
+
+void SdlThreadManager::waitSemaphore(OSystem::SemaphoreRef sem) {
+	SDL_SemWait((SDL_sem *)sem);
+}
+
+void SdlThreadManager::postSemaphore(OSystem::SemaphoreRef sem) {
+	SDL_SemPost((SDL_sem *)sem);
+}
+
+void SdlThreadManager::deleteSemaphore(OSystem::SemaphoreRef sem) {
+	SDL_DestroySemaphore((SDL_sem *)sem);
+}
+
+#endif
@@ -22,6 +22,7 @@
 
 #include "common/scummsys.h"
 #include "backends/timer/default/default-timer.h"
+#include "common/debug.h"
 #include "common/util.h"
 #include "common/system.h"
 
@@ -31,82 +32,137 @@ struct TimerSlot {
 	Common::String id;
 	uint32 interval;	// in microseconds
 
-	uint32 nextFireTime;	// in milliseconds
-	uint32 nextFireTimeMicro;	// microseconds part of nextFire
+	uint64 nextFireTime;	// in microseconds
+	uint32 sequence;	// orders slots with the same fire time
 
-	TimerSlot *next;
+	uint32 calls;
+	uint64 totalMicros;
+	uint32 maxMicros;
 };
 
-void insertPrioQueue(TimerSlot *head, TimerSlot *newSlot) {
-	// The head points to a fake anchor TimerSlot; this common
-	// trick allows us to get rid of many special cases.
+namespace {
 
-	const uint32 nextFireTime = newSlot->nextFireTime;
-	TimerSlot *slot = head;
-	newSlot->next = 0;
-
-	// Insert the new slot into the sorted list of already scheduled
-	// timers in such a way that the list stays sorted...
-	while (true) {
-		assert(slot);
-		if (slot->next == 0 || nextFireTime < slot->next->nextFireTime) {
-			newSlot->next = slot->next;
-			slot->next = newSlot;
-			return;
-		}
-		slot = slot->next;
-	}
-}
+// When the handler falls behind by more than this many microseconds, for
+// example because the process was suspended, the missed invocations are
+// dropped rather than caught up on in one burst.
+const uint64 kMaxTimerLag = 250000;
 
+} // End of anonymous namespace
 
 DefaultTimerManager::DefaultTimerManager() :
-	_head(0) {
-
-	_head = new TimerSlot();
-	memset(_head, 0, sizeof(TimerSlot));
+	_nextSequence(0), _runningSlot(0), _runningSlotRemoved(false) {
 }
 
 DefaultTimerManager::~DefaultTimerManager() {
 	Common::StackLock lock(_mutex);
 
-	TimerSlot *slot = _head;
-	while (slot) {
-		TimerSlot *next = slot->next;
-		delete slot;
-		slot = next;
+	for (uint i = 0; i < _slots.size(); ++i)
+		delete _slots[i];
+	_slots.clear();
+}
+
+bool DefaultTimerManager::isBefore(uint a, uint b) const {
+	const TimerSlot *slotA = _slots[a];
+	const TimerSlot *slotB = _slots[b];
+
+	if (slotA->nextFireTime != slotB->nextFireTime)
+		return slotA->nextFireTime < slotB->nextFireTime;
+	return (int32)(slotA->sequence - slotB->sequence) < 0;
+}
+
+void DefaultTimerManager::siftUp(uint index) {
+	while (index > 0) {
+		const uint parent = (index - 1) / 2;
+		if (!isBefore(index, parent))
+			break;
+		SWAP(_slots[index], _slots[parent]);
+		index = parent;
 	}
-	_head = 0;
 }
 
-void DefaultTimerManager::handler() {
+void DefaultTimerManager::siftDown(uint index) {
+	while (true) {
+		uint child = index * 2 + 1;
+		if (child >= _slots.size())
+			break;
+		if (child + 1 < _slots.size() && isBefore(child + 1, child))
+			++child;
+		if (!isBefore(child, index))
+			break;
+		SWAP(_slots[index], _slots[child]);
+		index = child;
+	}
+}
+
+void DefaultTimerManager::pushSlot(TimerSlot *slot) {
+	// Slots due at the same time fire in the order they were scheduled.
+	slot->sequence = _nextSequence++;
+	_slots.push_back(slot);
+	siftUp(_slots.size() - 1);
+}
+
+TimerSlot *DefaultTimerManager::popSlot() {
+	TimerSlot *slot = _slots[0];
+	removeSlot(0);
+	return slot;
+}
+
+void DefaultTimerManager::removeSlot(uint index) {
+	const uint last = _slots.size() - 1;
+	if (index != last) {
+		_slots[index] = _slots[last];
+		_slots.pop_back();
+		siftDown(index);
+		siftUp(index);
+	} else {
+		_slots.pop_back();
+	}
+}
+
+uint32 DefaultTimerManager::handler() {
 	Common::StackLock lock(_mutex);
 
-	uint32 curTime = g_system->getMillis(true);
+	const uint64 curTime = g_system->getMicros();
 
 	// Repeat as long as there is a TimerSlot that is scheduled to fire.
-	TimerSlot *slot = _head->next;
-	while (slot && slot->nextFireTime < curTime) {
-		// Remove the slot from the priority queue
-		_head->next = slot->next;
+	while (!_slots.empty() && _slots[0]->nextFireTime <= curTime) {
+		TimerSlot *slot = popSlot();
 
-		// Update the fire time and reinsert the TimerSlot into the priority
-		// queue.
+		// Schedule the next invocation relative to this one rather than to
+		// the current time, so that the timer does not drift.
 		assert(slot->interval > 0);
-		slot->nextFireTime += (slot->interval / 1000);
-		slot->nextFireTimeMicro += (slot->interval % 1000);
-		if (slot->nextFireTimeMicro > 1000) {
-			slot->nextFireTime += slot->nextFireTimeMicro / 1000;
-			slot->nextFireTimeMicro %= 1000;
-		}
-		insertPrioQueue(_head, slot);
+		slot->nextFireTime += slot->interval;
+		if (slot->nextFireTime + kMaxTimerLag < curTime)
+			slot->nextFireTime = curTime + slot->interval;
+		pushSlot(slot);
 
-		// Invoke the timer callback
+		// Invoke the timer callback. It may remove its own timer, in which
+		// case the slot is only deleted afterwards.
 		assert(slot->callback);
+		_runningSlot = slot;
+		_runningSlotRemoved = false;
+
+		const uint64 start = g_system->getMicros();
 		slot->callback(slot->refCon);
+		const uint32 micros = (uint32)(g_system->getMicros() - start);
+
+		_runningSlot = 0;
+		if (_runningSlotRemoved) {
+			delete slot;
+			continue;
+		}
 
-		// Look at the next scheduled timer
-		slot = _head->next;
+		++slot->calls;
+		slot->totalMicros += micros;
+		slot->maxMicros = MAX(slot->maxMicros, micros);
 	}
+
+	if (_slots.empty())
+		return 0xFFFFFFFF;
+
+	const uint64 nextFireTime = _slots[0]->nextFireTime;
+	const uint64 now = g_system->getMicros();
+	return (nextFireTime > now) ? (uint32)MIN<uint64>(nextFireTime - now, 0xFFFFFFFF) : 0;
 }
 
 bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, void *refCon, const Common::String &id) {
@@ -132,11 +188,12 @@ bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, v
 	slot->refCon = refCon;
 	slot->id = id;
 	slot->interval = interval;
-	slot->nextFireTime = g_system->getMillis() + interval / 1000;
-	slot->nextFireTimeMicro = interval % 1000;
-	slot->next = 0;
+	slot->nextFireTime = g_system->getMicros() + interval;
+	slot->calls = 0;
+	slot->totalMicros = 0;
+	slot->maxMicros = 0;
 
-	insertPrioQueue(_head, slot);
+	pushSlot(slot);
 
 	return true;
 }
@@ -144,16 +201,23 @@ bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, v
 void DefaultTimerManager::removeTimerProc(TimerProc callback) {
 	Common::StackLock lock(_mutex);
 
-	TimerSlot *slot = _head;
+	// installTimerProc makes sure there is at most one slot per callback.
+	for (uint i = 0; i < _slots.size(); ++i) {
+		TimerSlot *slot = _slots[i];
+		if (slot->callback != callback)
+			continue;
 
-	while (slot->next) {
-		if (slot->next->callback == callback) {
-			TimerSlot *next = slot->next->next;
-			delete slot->next;
-			slot->next = next;
-		} else {
-			slot = slot->next;
+		if (slot->calls) {
+			debug(2, "Timer '%s': %u calls, %u us on average, %u us at most", slot->id.c_str(), slot->calls,
+			      (uint32)(slot->totalMicros / slot->calls), slot->maxMicros);
 		}
+
+		removeSlot(i);
+		if (slot == _runningSlot)
+			_runningSlotRemoved = true;
+		else
+			delete slot;
+		break;
 	}
 
 	// We need to remove all names referencing the timer proc here.
@@ -173,3 +237,19 @@ void DefaultTimerManager::removeTimerProc(TimerProc callback) {
 			_callbacks.erase(i);
 	}
 }
+
+void DefaultTimerManager::getStats(Common::Array<TimerStats> &stats) {
+	Common::StackLock lock(_mutex);
+
+	stats.clear();
+	for (uint i = 0; i < _slots.size(); ++i) {
+		const TimerSlot *slot = _slots[i];
+
+		TimerStats slotStats;
+		slotStats.id = slot->id;
+		slotStats.calls = slot->calls;
+		slotStats.totalMicros = slot->totalMicros;
+		slotStats.maxMicros = slot->maxMicros;
+		stats.push_back(slotStats);
+	}
+}
@@ -23,6 +23,7 @@
 #ifndef BACKENDS_TIMER_DEFAULT_H
 #define BACKENDS_TIMER_DEFAULT_H
 
+#include "common/array.h"
 #include "common/str.h"
 #include "common/hash-str.h"
 #include "common/timer.h"
@@ -31,12 +32,36 @@
 struct TimerSlot;
 
 class DefaultTimerManager : public Common::TimerManager {
+public:
+	/**
+	 * How much time a timer callback took so far.
+	 */
+	struct TimerStats {
+		Common::String id;
+		uint32 calls;
+		uint64 totalMicros;
+		uint32 maxMicros;
+	};
+
 private:
 	typedef Common::HashMap<Common::String, TimerProc, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> TimerSlotMap;
 
 	Common::Mutex _mutex;
-	TimerSlot *_head;
+	/** Min-heap of the timer slots, ordered by their next fire time. */
+	Common::Array<TimerSlot *> _slots;
 	TimerSlotMap _callbacks;
+	uint32 _nextSequence;
+
+	/** The slot whose callback is running, and whether it got removed meanwhile. */
+	TimerSlot *_runningSlot;
+	bool _runningSlotRemoved;
+
+	void pushSlot(TimerSlot *slot);
+	TimerSlot *popSlot();
+	void removeSlot(uint index);
+	void siftUp(uint index);
+	void siftDown(uint index);
+	bool isBefore(uint a, uint b) const;
 
 public:
 	DefaultTimerManager();
@@ -46,8 +71,16 @@ public:
 
 	/**
 	 * Timer callback, to be invoked at regular time intervals by the backend.
+	 *
+	 * @return The number of microseconds until the next timer is due. Backends
+	 *         which can may use it to invoke the handler again just in time.
+	 */
+	uint32 handler();
+
+	/**
+	 * Get how much time the callbacks of all installed timers took so far.
 	 */
-	void handler();
+	void getStats(Common::Array<TimerStats> &stats);
 };
 
 #endif
@@ -28,10 +28,14 @@
 #include "backends/timer/sdl/sdl-timer.h"
 
 #include "common/textconsole.h"
+#include "common/util.h"
 
 static Uint32 timer_handler(Uint32 interval, void *param) {
-	((DefaultTimerManager *)param)->handler();
-	return interval;
+	const uint32 delay = ((DefaultTimerManager *)param)->handler();
+
+	// Wake up again in time for the next timer, but at least every 10ms so
+	// that newly installed timers are picked up.
+	return (delay >= 10000) ? 10 : MAX<uint32>((delay + 999) / 1000, 1);
 }
 
 SdlTimerManager::SdlTimerManager() {
@@ -113,6 +113,7 @@ static const char HELP_STRING[] =
 	"  --debugflags=FLAGS       Enable engine specific debug flags\n"
 	"                           (separated by commas)\n"
 	"  --debug-channels-only    Show only the specified debug channels\n"
+	"  --startup-trace          Show how long each phase of the startup takes\n"
 	"  -u, --dump-scripts       Enable script dumping if a directory called 'dumps'\n"
 	"                           exists in the current directory\n"
 	"\n"
@@ -131,6 +132,9 @@ static const char HELP_STRING[] =
 	"  --native-mt32            True Roland MT-32 (disable GM emulation)\n"
 	"  --enable-gs              Enable Roland GS mode for MIDI playback\n"
 	"  --output-rate=RATE       Select output sample rate in Hz (e.g. 22050)\n"
+	"  --resampling-quality=MODE\n"
+	"                           Select sample rate conversion quality (fast,\n"
+	"                           linear, hq)\n"
 	"  --opl-driver=DRIVER      Select AdLib (OPL) emulator (db, mame"
 #ifndef DISABLE_NUKED_OPL
                                                                      ", nuked"
@@ -145,7 +149,9 @@ static const char HELP_STRING[] =
 	"                           atari, macintosh)\n"
 #ifdef ENABLE_EVENTRECORDER
 	"  --record-mode=MODE       Specify record mode for event recorder (record, playback,\n"
-	"                           passthrough [default])\n"
+	"                           benchmark, passthrough [default]). Benchmark plays the\n"
+	"                           record back headless as fast as possible and reports\n"
+	"                           the frame times\n"
 	"  --record-file-name=FILE  Specify record file name\n"
 	"  --disable-display        Disable any gfx output. Used for headless events\n"
 	"                           playback by Event Recorder\n"
@@ -213,6 +219,10 @@ void registerDefaults() {
 	ConfMan.registerDefault("gfx_mode", "normal");
 	ConfMan.registerDefault("render_mode", "default");
 	ConfMan.registerDefault("desired_screen_aspect_ratio", "auto");
+	ConfMan.registerDefault("frame_pacing", false);
+	ConfMan.registerDefault("show_frame_time", false);
+	ConfMan.registerDefault("profiler", false);
+	ConfMan.registerDefault("prefetch_files", false);
 
 	// Sound & Music
 	ConfMan.registerDefault("music_volume", 192);
@@ -228,9 +238,11 @@ void registerDefaults() {
 	ConfMan.registerDefault("native_mt32", false);
 	ConfMan.registerDefault("enable_gs", false);
 	ConfMan.registerDefault("midi_gain", 100);
+	ConfMan.registerDefault("resampling_quality", "fast");
 
 	ConfMan.registerDefault("music_driver", "auto");
 	ConfMan.registerDefault("mt32_device", "null");
+	ConfMan.registerDefault("mt32_render_thread", false);
 	ConfMan.registerDefault("gm_device", "null");
 	ConfMan.registerDefault("opl2lpt_parport", "null");
 
@@ -247,6 +259,7 @@ void registerDefaults() {
 	ConfMan.registerDefault("dump_scripts", false);
 	ConfMan.registerDefault("save_slot", -1);
 	ConfMan.registerDefault("autosave_period", 5 * 60); // By default, trigger autosave every 5 minutes
+	ConfMan.registerDefault("autosave_deltas", false);
 
 #if defined(ENABLE_SCUMM) || defined(ENABLE_SWORD2)
 	ConfMan.registerDefault("object_labels", true);
@@ -272,6 +285,7 @@ void registerDefaults() {
 	// Miscellaneous
 	ConfMan.registerDefault("joystick_num", -1);
 	ConfMan.registerDefault("confirm_exit", false);
+	ConfMan.registerDefault("coalesce_mouse_motion", false);
 	ConfMan.registerDefault("disable_sdl_parachute", false);
 
 	ConfMan.registerDefault("disable_display", false);
@@ -477,6 +491,9 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_OPTION_BOOL("debug-channels-only")
 			END_OPTION
 
+			DO_LONG_OPTION_BOOL("startup-trace")
+			END_OPTION
+
 			DO_OPTION('e', "music-driver")
 			END_OPTION
 
@@ -486,6 +503,9 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_OPTION_INT("output-rate")
 			END_OPTION
 
+			DO_LONG_OPTION("resampling-quality")
+			END_OPTION
+
 			DO_OPTION_BOOL('f', "fullscreen")
 			END_OPTION
 
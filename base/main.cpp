@@ -44,6 +44,11 @@
 #include "common/events.h"
 #include "gui/EventRecorder.h"
 #include "common/fs.h"
+#include "common/jobs.h"
+#include "common/macresman.h"
+#include "common/prefetch.h"
+#include "common/profiler.h"
+#include "common/savefile.h"
 #ifdef ENABLE_EVENTRECORDER
 #include "common/recorderfile.h"
 #endif
@@ -55,6 +60,7 @@
 
 #include "gui/gui-manager.h"
 #include "gui/error.h"
+#include "gui/saveload-cache.h"
 
 #include "audio/mididrv.h"
 #include "audio/musicplugin.h"  /* for music manager */
@@ -66,6 +72,7 @@
 #include "graphics/fonts/ttf.h"
 #endif
 
+#include "backends/audiocd/audiocd.h"
 #include "backends/keymapper/keymapper.h"
 #ifdef USE_CLOUD
 #ifdef USE_LIBCURL
@@ -89,6 +96,32 @@
 #include "gui/updates-dialog.h"
 #endif
 
+/**
+ * The startup trace, enabled with --startup-trace, prints how long each
+ * phase of the startup took, up to showing the launcher or running the
+ * game.
+ */
+static bool s_startupTrace = false;
+static uint64 s_startupStart = 0;
+static uint64 s_startupPhaseStart = 0;
+
+static void endStartupPhase(const char *phase) {
+	if (!s_startupTrace)
+		return;
+
+	const uint64 now = g_system->getMicros();
+	debug("Startup: %-12s %8.2f ms", phase, (now - s_startupPhaseStart) / 1000.0);
+	s_startupPhaseStart = now;
+}
+
+static void endStartupTrace() {
+	if (!s_startupTrace)
+		return;
+
+	debug("Startup: %-12s %8.2f ms", "total", (g_system->getMicros() - s_startupStart) / 1000.0);
+	s_startupTrace = false;
+}
+
 static bool launcherDialog() {
 
 	// Discard any command line options. Those that affect the graphics
@@ -147,6 +180,8 @@ static Common::Error runGame(const Plugin *plugin, OSystem &system, const Common
 	Common::Error err = Common::kNoError;
 	Engine *engine = 0;
 
+	endStartupPhase("detection");
+
 #if defined(SDL_BACKEND) && defined(USE_OPENGL) && defined(USE_RGB_COLOR)
 	// HACK: We set up the requested graphics mode setting here to allow the
 	// backend to switch from Surface SDL to OpenGL if necessary. This is
@@ -206,6 +241,8 @@ static Common::Error runGame(const Plugin *plugin, OSystem &system, const Common
 		return err;
 	}
 
+	endStartupPhase("engine");
+
 	// Set the window caption to the game name
 	Common::String caption(ConfMan.get("description"));
 
@@ -246,6 +283,18 @@ static Common::Error runGame(const Plugin *plugin, OSystem &system, const Common
 		}
 	}
 
+	// Read ahead what the game read the last time it ran, and record what
+	// it reads this time
+	const Common::String prefetchManifest = ConfMan.getActiveDomainName() + "-prefetch.txt";
+	if (ConfMan.getBool("prefetch_files")) {
+		Common::InSaveFile *manifest = system.getSavefileManager()->openForLoading(prefetchManifest);
+		if (manifest) {
+			FilePrefetchMan.startPrefetch(*manifest, Common::FSNode(ConfMan.get("path")));
+			delete manifest;
+		}
+		FilePrefetchMan.startRecording();
+	}
+
 	// On creation the engine should have set up all debug levels so we can use
 	// the command line arguments here
 	Common::StringTokenizer tokenizer(edebuglevels, " ,");
@@ -263,6 +312,9 @@ static Common::Error runGame(const Plugin *plugin, OSystem &system, const Common
 	// Inform backend that the engine is about to be run
 	system.engineInit();
 
+	endStartupPhase("game setup");
+	endStartupTrace();
+
 	// Run the engine
 	Common::Error result = engine->run();
 
@@ -275,12 +327,31 @@ static Common::Error runGame(const Plugin *plugin, OSystem &system, const Common
 	// Free up memory
 	delete engine;
 
+	// Stop the audio CD, and let go of the track files of the game, like
+	// the one opened in advance for the next track
+	system.getAudioCDManager()->close();
+
+	if (Common::FilePrefetcher::isRecording()) {
+		FilePrefetchMan.stopRecording();
+		FilePrefetchMan.stopPrefetch();
+
+		Common::OutSaveFile *manifest = system.getSavefileManager()->openForSaving(prefetchManifest, false);
+		if (manifest) {
+			FilePrefetchMan.saveManifest(*manifest);
+			manifest->finalize();
+			delete manifest;
+		}
+	}
+
 	// We clear all debug levels again even though the engine should do it
 	DebugMan.clearAllDebugChannels();
 
 	// Reset the file/directory mappings
 	SearchMan.clear();
 
+	// The resource maps cached by name refer to the game's files
+	Common::MacResManager::clearMapCache();
+
 	// Return result (== 0 means no error)
 	return result;
 }
@@ -301,11 +372,8 @@ static void setupGraphics(OSystem &system) {
 			system.setFeatureState(OSystem::kFeatureFilteringMode, ConfMan.getBool("filtering"));
 	system.endGFXTransaction();
 
-	// When starting up launcher for the first time, the user might have specified
-	// a --gui-theme option, to allow that option to be working, we need to initialize
-	// GUI here.
-	// FIXME: Find a nicer way to allow --gui-theme to be working
-	GUI::GuiManager::instance();
+	// The GUI, and with it the theme, is only set up once it is used. That
+	// is still early enough for a --gui-theme option to take effect.
 
 	// Set initial window caption
 	system.setWindowCaption(gScummVMFullVersion);
@@ -372,6 +440,7 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	// Verify that the backend has been initialized (i.e. g_system has been set).
 	assert(g_system);
 	OSystem &system = *g_system;
+	s_startupStart = s_startupPhaseStart = system.getMicros();
 
 	// Register config manager defaults
 	Base::registerDefaults();
@@ -410,9 +479,15 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	if (settings.contains("debug-channels-only"))
 		gDebugChannelsOnly = true;
 
+	if (settings.contains("startup-trace")) {
+		s_startupTrace = true;
+		settings.erase("startup-trace");
+	}
+	endStartupPhase("config");
 
 	PluginManager::instance().init();
  	PluginManager::instance().loadAllPlugins(); // load plugins for cached plugin manager
+	endStartupPhase("plugins");
 
 	// If we received an invalid music parameter via command line we check this here.
 	// We can't check this before loading the music plugins.
@@ -438,6 +513,12 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	// Init the backend. Must take place after all config data (including
 	// the command line params) was read.
 	system.initBackend();
+	endStartupPhase("backend");
+
+	if (ConfMan.getBool("profiler")) {
+		ProfilerMan.setEnabled(true);
+		ProfilerMan.setOverlayEnabled(true);
+	}
 
 	// If we received an invalid graphics mode parameter via command line
 	// we check this here. We can't do it until after the backend is inited,
@@ -461,6 +542,7 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 		ConfMan.setInt("disable-display", 1, Common::ConfigManager::kTransientDomain);
 	}
 	setupGraphics(system);
+	endStartupPhase("graphics");
 
 	// Init the different managers that are used by the engines.
 	// Do it here to prevent fragmentation later
@@ -486,6 +568,7 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 
 	// Now as the event manager is created, setup the keymapper
 	setupKeymapper(system);
+	endStartupPhase("managers");
 
 #ifdef USE_UPDATES
 	if (!ConfMan.hasKey("updates_check") && g_system->getUpdateManager()) {
@@ -497,11 +580,14 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
 	CloudMan.init();
 	CloudMan.syncSaves();
+	endStartupPhase("cloud");
 #endif
 
 	// Unless a game was specified, show the launcher dialog
-	if (0 == ConfMan.getActiveDomain())
+	if (0 == ConfMan.getActiveDomain()) {
+		endStartupTrace();
 		launcherDialog();
+	}
 
 	// FIXME: We're now looping the launcher. This, of course, doesn't
 	// work as well as it should. In theory everything should be destroyed
@@ -522,6 +608,8 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 				g_eventRec.init(g_eventRec.generateRecordFileName(ConfMan.getActiveDomainName()), GUI::EventRecorder::kRecorderRecord);
 			} else if (recordMode == "playback") {
 				g_eventRec.init(recordFileName, GUI::EventRecorder::kRecorderPlayback);
+			} else if (recordMode == "benchmark") {
+				g_eventRec.init(recordFileName, GUI::EventRecorder::kRecorderPlayback, true);
 			} else if ((recordMode == "info") && (!recordFileName.empty())) {
 				Common::PlaybackFile record;
 				record.openRead(recordFileName);
@@ -620,6 +708,7 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	PluginManager::instance().unloadAllPlugins();
 	PluginManager::destroy();
 	GUI::GuiManager::destroy();
+	GUI::SaveLoadCache::destroy();
 	Common::ConfigManager::destroy();
 	Common::DebugManager::destroy();
 	Common::OSDMessageQueue::destroy();
@@ -638,6 +727,9 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 #endif
 	EngineManager::destroy();
 	Graphics::YUVToRGBManager::destroy();
+	Common::JobSystem::destroy();
+	Common::Profiler::destroy();
+	Common::FilePrefetcher::destroy();
 
 	return 0;
 }
@@ -336,7 +336,13 @@ void PluginManagerUncached::updateConfigWithFileName(const Common::String &gameI
 
 		Common::ConfigManager::Domain *domain = ConfMan.getDomain("plugin_files");
 		assert(domain);
-		(*domain)[gameId] = (*_currentPlugin)->getFileName();
+
+		// Avoid rewriting the config file if nothing changed
+		const Common::String fileName = (*_currentPlugin)->getFileName();
+		if (domain->contains(gameId) && (*domain)[gameId] == fileName)
+			return;
+
+		(*domain)[gameId] = fileName;
 
 		ConfMan.flushToDisk();
 	}
@@ -445,6 +451,7 @@ void PluginManager::addToPluginsInMemList(Plugin *plugin) {
 
 // Engine plugins
 
+#include "engines/advancedDetector.h"
 #include "engines/metaengine.h"
 
 namespace Common {
@@ -517,6 +524,7 @@ DetectionResults EngineManager::detectGames(const Common::FSList &fslist) const
 	DetectedGames candidates;
 	Common::String path = fslist.begin()->getParent().getPath();
 	PluginList plugins;
+	MD5CachePass md5CachePass;
 	PluginList::const_iterator iter;
 	PluginManager::instance().loadFirstPlugin();
 	do {
@@ -531,6 +539,10 @@ DetectionResults EngineManager::detectGames(const Common::FSList &fslist) const
 				engineCandidates[i].engineName = metaEngine.getName();
 				engineCandidates[i].path = path;
 				candidates.push_back(engineCandidates[i]);
+
+				// Remember which plugin detected the game, so that starting it
+				// later on loads just this plugin instead of scanning all of them.
+				PluginManager::instance().updateConfigWithFileName(engineCandidates[i].gameId);
 			}
 
 		}
@@ -24,7 +24,7 @@
 
 namespace Common {
 
-EventDispatcher::EventDispatcher() : _autoFreeMapper(false), _mapper(nullptr) {
+EventDispatcher::EventDispatcher() : _autoFreeMapper(false), _mapper(nullptr), _coalesceMouseMotion(false) {
 }
 
 EventDispatcher::~EventDispatcher() {
@@ -50,17 +50,28 @@ void EventDispatcher::dispatch() {
 	dispatchPoll();
 
 	for (List<SourceEntry>::iterator i = _sources.begin(); i != _sources.end(); ++i) {
+		Event motion;
+		bool motionPending = false;
+
 		while (i->source->pollEvent(event)) {
-			// We only try to process the events via the setup event mapper, when
-			// we have a setup mapper and when the event source allows mapping.
-			assert(_mapper);
-			List<Event> mappedEvents = _mapper->mapEvent(event, i->source);
-
-			for (List<Event>::iterator j = mappedEvents.begin(); j != mappedEvents.end(); ++j) {
-				const Event mappedEvent = *j;
-				dispatchEvent(mappedEvent);
+			if (_coalesceMouseMotion && event.type == EVENT_MOUSEMOVE) {
+				// Hold the mouse move back until an event of another type
+				// shows up, replacing it by any later mouse move
+				motion = event;
+				motionPending = true;
+				continue;
+			}
+
+			if (motionPending) {
+				dispatchMapped(motion, i->source);
+				motionPending = false;
 			}
+
+			dispatchMapped(event, i->source);
 		}
+
+		if (motionPending)
+			dispatchMapped(motion, i->source);
 	}
 
 	List<Event> delayedEvents = _mapper->getDelayedEvents();
@@ -146,6 +157,18 @@ void EventDispatcher::dispatchEvent(const Event &event) {
 	}
 }
 
+void EventDispatcher::dispatchMapped(const Event &event, EventSource *source) {
+	// We only try to process the events via the setup event mapper, when
+	// we have a setup mapper and when the event source allows mapping.
+	assert(_mapper);
+	List<Event> mappedEvents = _mapper->mapEvent(event, source);
+
+	for (List<Event>::iterator j = mappedEvents.begin(); j != mappedEvents.end(); ++j) {
+		const Event mappedEvent = *j;
+		dispatchEvent(mappedEvent);
+	}
+}
+
 void EventDispatcher::dispatchPoll() {
 	for (List<ObserverEntry>::iterator i = _observers.begin(); i != _observers.end(); ++i) {
 		if (i->poll == true)
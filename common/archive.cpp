@@ -21,7 +21,9 @@
  */
 
 #include "common/archive.h"
+#include "common/atomic.h"
 #include "common/fs.h"
+#include "common/mutex.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
@@ -62,6 +64,95 @@ int Archive::listMatchingMembers(ArchiveMemberList &list, const String &pattern)
 
 
 
+namespace {
+
+/** Locks the lookup cache mutex of a SearchSet, if it has one. */
+class CacheLock {
+	Mutex *_mutex;
+
+public:
+	explicit CacheLock(Mutex *mutex) : _mutex(mutex) {
+		if (_mutex)
+			_mutex->lock();
+	}
+
+	~CacheLock() {
+		if (_mutex)
+			_mutex->unlock();
+	}
+};
+
+} // End of anonymous namespace
+
+volatile uint32 SearchSet::_changeCount = 0;
+
+SearchSet::SearchSet() : _cacheChangeCount(atomicLoadAcquire(&_changeCount)) {
+	memset(&_cacheStats, 0, sizeof(_cacheStats));
+
+	// Sets created before the backend cannot be shared between threads
+	// yet, so they do without a lock.
+	_cacheMutex = g_system ? new Mutex() : nullptr;
+}
+
+SearchSet::~SearchSet() {
+	clear();
+	delete _cacheMutex;
+}
+
+void SearchSet::invalidateCache() {
+	CacheLock lock(_cacheMutex);
+	if (!_lookupCache.empty()) {
+		_lookupCache.clear();
+		_cacheStats.invalidations++;
+	}
+}
+
+void SearchSet::changed() {
+	// Parents of this set cache its files as well, but it does not know
+	// them. Counting the change makes all sets flush their caches.
+	atomicFetchAdd(&_changeCount, 1);
+	invalidateCache();
+}
+
+bool SearchSet::lookupCache(const String &name, uint hash, Archive *&archive, uint32 &changes) const {
+	CacheLock lock(_cacheMutex);
+
+	changes = atomicLoadAcquire(&_changeCount);
+	if (changes != _cacheChangeCount) {
+		if (!_lookupCache.empty()) {
+			_lookupCache.clear();
+			_cacheStats.invalidations++;
+		}
+		_cacheChangeCount = changes;
+	}
+
+	LookupCache::const_iterator i = _lookupCache.findWithHash(name, hash);
+	if (i == _lookupCache.end()) {
+		_cacheStats.misses++;
+		return false;
+	}
+
+	_cacheStats.hits++;
+	if (!i->_value)
+		_cacheStats.negativeHits++;
+	archive = i->_value;
+	return true;
+}
+
+void SearchSet::addToCache(const String &name, Archive *archive, uint32 changes) const {
+	CacheLock lock(_cacheMutex);
+
+	// The result may be outdated if a set changed during the lookup
+	if (changes != _cacheChangeCount || changes != atomicLoadAcquire(&_changeCount))
+		return;
+
+	// Engines probing for files by pattern could otherwise grow the cache
+	// without bounds.
+	if (_lookupCache.size() >= kMaxCacheEntries)
+		_lookupCache.clear(true);
+	_lookupCache[name] = archive;
+}
+
 SearchSet::ArchiveNodeList::iterator SearchSet::find(const String &name) {
 	ArchiveNodeList::iterator it = _list.begin();
 	for (; it != _list.end(); ++it) {
@@ -92,6 +183,7 @@ void SearchSet::insert(const Node &node) {
 			break;
 	}
 	_list.insert(it, node);
+	changed();
 }
 
 void SearchSet::add(const String &name, Archive *archive, int priority, bool autoFree) {
@@ -173,6 +265,7 @@ void SearchSet::remove(const String &name) {
 		if (it->_autoFree)
 			delete it->_arc;
 		_list.erase(it);
+		changed();
 	}
 }
 
@@ -187,6 +280,7 @@ void SearchSet::clear() {
 	}
 
 	_list.clear();
+	changed();
 }
 
 void SearchSet::setPriority(const String &name, int priority) {
@@ -209,12 +303,41 @@ bool SearchSet::hasFile(const String &name) const {
 	if (name.empty())
 		return false;
 
+	Archive *archive;
+	uint32 changes;
+	if (lookupCache(name, hashit_lower(name), archive, changes))
+		return archive != nullptr;
+
+	ArchiveNodeList::const_iterator it = _list.begin();
+	for (; it != _list.end(); ++it) {
+		if (it->_arc->hasFile(name)) {
+			addToCache(name, it->_arc, changes);
+			return true;
+		}
+	}
+
+	addToCache(name, nullptr, changes);
+	return false;
+}
+
+bool SearchSet::hasFileAtom(const Atom &name) const {
+	if (name.empty())
+		return false;
+
+	Archive *archive;
+	uint32 changes;
+	if (lookupCache(name, name.hashLower(), archive, changes))
+		return archive != nullptr;
+
 	ArchiveNodeList::const_iterator it = _list.begin();
 	for (; it != _list.end(); ++it) {
-		if (it->_arc->hasFile(name))
+		if (it->_arc->hasFileAtom(name)) {
+			addToCache(name, it->_arc, changes);
 			return true;
+		}
 	}
 
+	addToCache(name, nullptr, changes);
 	return false;
 }
 
@@ -242,12 +365,20 @@ const ArchiveMemberPtr SearchSet::getMember(const String &name) const {
 	if (name.empty())
 		return ArchiveMemberPtr();
 
+	Archive *archive;
+	uint32 changes;
+	if (lookupCache(name, hashit_lower(name), archive, changes))
+		return archive ? archive->getMember(name) : ArchiveMemberPtr();
+
 	ArchiveNodeList::const_iterator it = _list.begin();
 	for (; it != _list.end(); ++it) {
-		if (it->_arc->hasFile(name))
+		if (it->_arc->hasFile(name)) {
+			addToCache(name, it->_arc, changes);
 			return it->_arc->getMember(name);
+		}
 	}
 
+	addToCache(name, nullptr, changes);
 	return ArchiveMemberPtr();
 }
 
@@ -255,13 +386,29 @@ SeekableReadStream *SearchSet::createReadStreamForMember(const String &name) con
 	if (name.empty())
 		return nullptr;
 
+	Archive *archive;
+	uint32 changes;
+	if (lookupCache(name, hashit_lower(name), archive, changes)) {
+		if (!archive)
+			return nullptr;
+
+		SeekableReadStream *stream = archive->createReadStreamForMember(name);
+		if (stream)
+			return stream;
+		// The archive claims the file but cannot open it; give the other
+		// archives a chance, like an uncached lookup would.
+	}
+
 	ArchiveNodeList::const_iterator it = _list.begin();
 	for (; it != _list.end(); ++it) {
 		SeekableReadStream *stream = it->_arc->createReadStreamForMember(name);
-		if (stream)
+		if (stream) {
+			addToCache(name, it->_arc, changes);
 			return stream;
+		}
 	}
 
+	addToCache(name, nullptr, changes);
 	return nullptr;
 }
 
@@ -23,6 +23,9 @@
 #ifndef COMMON_ARCHIVE_H
 #define COMMON_ARCHIVE_H
 
+#include "common/atom.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
 #include "common/str.h"
 #include "common/list.h"
 #include "common/ptr.h"
@@ -31,6 +34,7 @@
 namespace Common {
 
 class FSNode;
+class Mutex;
 class SeekableReadStream;
 
 
@@ -96,6 +100,14 @@ public:
 	 */
 	virtual bool hasFile(const String &name) const = 0;
 
+	/**
+	 * Check if a member with the given interned name is present in the
+	 * Archive. This forwards to hasFileAtom(), which archives indexing their
+	 * members in a hash map may override to reuse the precomputed hash.
+	 */
+	bool hasFile(const Atom &name) const { return hasFileAtom(name); }
+	virtual bool hasFileAtom(const Atom &name) const { return hasFile(name.str()); }
+
 	/**
 	 * Add all members of the Archive matching the specified pattern to list.
 	 * Must only append to list, and not remove elements from it.
@@ -153,7 +165,56 @@ class SearchSet : public Archive {
 	void insert(const Node& node);
 
 public:
-	virtual ~SearchSet() { clear(); }
+	/** Statistics of the file lookup cache. */
+	struct CacheStats {
+		uint32 hits;			///< Lookups answered from the cache.
+		uint32 negativeHits;	///< Hits for files which are not present.
+		uint32 misses;			///< Lookups which had to ask the archives.
+		uint32 invalidations;	///< Number of times the cache was flushed.
+	};
+
+private:
+	enum {
+		kMaxCacheEntries = 4096
+	};
+
+	/**
+	 * Maps file names to the archive which provides them, or to 0 if no
+	 * archive does. Flushed whenever the set of archives of any SearchSet
+	 * changes, so that changes of nested SearchSets reach their parents.
+	 */
+	typedef HashMap<String, Archive *, IgnoreCase_Hash, IgnoreCase_EqualTo> LookupCache;
+	mutable LookupCache _lookupCache;
+	mutable CacheStats _cacheStats;
+
+	/** Value of _changeCount the lookup cache was filled at. */
+	mutable uint32 _cacheChangeCount;
+
+	/** Guards the lookup cache, which const lookups from any thread fill. */
+	Mutex *_cacheMutex;
+
+	/** Number of changes of the archives of all SearchSets. */
+	static volatile uint32 _changeCount;
+
+	/**
+	 * Look a name up in the cache.
+	 * @param changes	set to the change count to pass to addToCache()
+	 */
+	bool lookupCache(const String &name, uint hash, Archive *&archive, uint32 &changes) const;
+
+	/** Remember a lookup result, unless any set changed since lookupCache(). */
+	void addToCache(const String &name, Archive *archive, uint32 changes) const;
+
+	/** Flush the lookup caches of this and all other sets. */
+	void changed();
+
+	// The lookup cache mutex is owned.
+	SearchSet(const SearchSet &);
+	SearchSet &operator=(const SearchSet &);
+
+public:
+	SearchSet();
+	virtual ~SearchSet();
 
 	/**
 	 * Add a new archive to the searchable set.
@@ -236,7 +297,24 @@ public:
 	 */
 	void setPriority(const String& name, int priority);
 
+	/**
+	 * Flush the lookup cache.
+	 *
+	 * hasFile(), getMember() and createReadStreamForMember() remember which
+	 * archive provides a file, and which files are not present at all. The
+	 * cache is flushed automatically when archives are added to or removed
+	 * from this or any other SearchSet, including nested ones, but code
+	 * which changes the contents of another kind of archive already in the
+	 * set (e.g. files created in an FSDirectory) must call this.
+	 */
+	void invalidateCache();
+
+	/** Return the statistics of the lookup cache. */
+	const CacheStats &getCacheStats() const { return _cacheStats; }
+
+	using Archive::hasFile;
 	virtual bool hasFile(const String &name) const;
+	virtual bool hasFileAtom(const Atom &name) const;
 	virtual int listMatchingMembers(ArchiveMemberList &list, const String &pattern) const;
 	virtual int listMembers(ArchiveMemberList &list) const;
 
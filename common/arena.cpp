@@ -0,0 +1,175 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/arena.h"
+#include "common/debug.h"
+#include "common/util.h"
+
+namespace Common {
+
+Arena::Arena(const char *name, size_t blockSize, bool threadSafe)
+	: _name(name), _blockSize(MAX<size_t>(blockSize, classSize(kNumSizeClasses - 1))),
+	  _mutex(nullptr), _currentBlock(0), _offset(0) {
+
+	if (threadSafe) {
+		assert(g_system);
+		_mutex = g_system->createMutex();
+	}
+
+	for (int i = 0; i < kNumSizeClasses; ++i)
+		_freeLists[i] = nullptr;
+
+	memset(&_stats, 0, sizeof(_stats));
+}
+
+Arena::~Arena() {
+	for (uint i = 0; i < _blocks.size(); ++i)
+		::free(_blocks[i].start);
+
+	if (_mutex)
+		g_system->deleteMutex(_mutex);
+}
+
+int Arena::sizeClass(size_t size) {
+	int result = 0;
+	while (classSize(result) < size) {
+		if (++result == kNumSizeClasses)
+			return -1;
+	}
+	return result;
+}
+
+void Arena::lock() const {
+	if (_mutex)
+		g_system->lockMutex(_mutex);
+}
+
+void Arena::unlock() const {
+	if (_mutex)
+		g_system->unlockMutex(_mutex);
+}
+
+void *Arena::allocateFromBlocks(size_t size) {
+	// Try the current block first, then any block kept from before the
+	// last reset, and only then ask the system for a new one.
+	while (_currentBlock < _blocks.size()) {
+		if (_offset + size <= _blocks[_currentBlock].size) {
+			void *result = _blocks[_currentBlock].start + _offset;
+			_offset += size;
+			return result;
+		}
+
+		_currentBlock++;
+		_offset = 0;
+	}
+
+	Block block;
+	block.size = MAX(_blockSize, size);
+	block.start = (byte *)::malloc(block.size);
+	assert(block.start);
+	_blocks.push_back(block);
+	_stats.blockAllocations++;
+	_stats.bytesReserved += block.size;
+
+	_currentBlock = _blocks.size() - 1;
+	_offset = size;
+	return block.start;
+}
+
+void *Arena::allocate(size_t size) {
+	lock();
+
+	const int cls = sizeClass(size);
+	size = (cls >= 0) ? classSize(cls) : ((size + kAlignment - 1) & ~(size_t)(kAlignment - 1));
+
+	void *result;
+	if (cls >= 0 && _freeLists[cls]) {
+		result = _freeLists[cls];
+		_freeLists[cls] = *(void **)result;
+	} else {
+		result = allocateFromBlocks(size);
+	}
+
+	_stats.allocations++;
+	_stats.bytesInUse += size;
+	if (_stats.bytesInUse > _stats.peakBytesInUse)
+		_stats.peakBytesInUse = _stats.bytesInUse;
+
+	unlock();
+	return result;
+}
+
+void Arena::free(void *ptr, size_t size) {
+	if (!ptr)
+		return;
+
+	lock();
+
+	const int cls = sizeClass(size);
+	if (cls >= 0) {
+		*(void **)ptr = _freeLists[cls];
+		_freeLists[cls] = ptr;
+		size = classSize(cls);
+	} else {
+		size = (size + kAlignment - 1) & ~(size_t)(kAlignment - 1);
+	}
+
+	assert(_stats.bytesInUse >= size);
+	_stats.frees++;
+	_stats.bytesInUse -= size;
+
+	unlock();
+}
+
+void Arena::reset(bool releaseMemory) {
+	lock();
+
+	for (int i = 0; i < kNumSizeClasses; ++i)
+		_freeLists[i] = nullptr;
+
+	if (releaseMemory) {
+		for (uint i = 1; i < _blocks.size(); ++i) {
+			_stats.bytesReserved -= _blocks[i].size;
+			::free(_blocks[i].start);
+		}
+		if (_blocks.size() > 1)
+			_blocks.resize(1);
+	}
+
+	_currentBlock = 0;
+	_offset = 0;
+	_stats.resets++;
+	_stats.bytesInUse = 0;
+
+	unlock();
+}
+
+void Arena::printStats() const {
+	lock();
+	debug("Arena '%s': %u allocations, %u frees, %u resets, %u blocks allocated; "
+	      "%u bytes in use (peak %u), %u bytes reserved",
+	      _name, _stats.allocations, _stats.frees, _stats.resets, _stats.blockAllocations,
+	      (uint)_stats.bytesInUse, (uint)_stats.peakBytesInUse, (uint)_stats.bytesReserved);
+	unlock();
+}
+
+} // End of namespace Common
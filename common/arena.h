@@ -0,0 +1,155 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_ARENA_H
+#define COMMON_ARENA_H
+
+#include "common/scummsys.h"
+#include "common/array.h"
+#include "common/noncopyable.h"
+#include "common/system.h"
+
+namespace Common {
+
+/**
+ * An arena allocator for short-lived allocations of mixed sizes.
+ *
+ * Memory is carved out of large blocks. Small requests are rounded up to
+ * one of a few size classes, and freed chunks are kept on a free list per
+ * class so they can be handed out again. Calling reset() releases every
+ * allocation at once, which makes the arena well suited for per-frame
+ * temporaries like dirty rect lists or render tickets: instead of deleting
+ * thousands of objects individually, the owner simply resets the arena
+ * once the frame is done.
+ *
+ * Note that reset() does not run any destructors, so either only store
+ * objects with trivial destructors, or destroy them before resetting.
+ *
+ * Unlike MemoryPool, an arena can optionally be made thread-safe, in which
+ * case all operations are guarded by an OSystem mutex.
+ */
+class Arena : NonCopyable {
+public:
+	/** Allocation statistics, useful for spotting code that churns the heap. */
+	struct Stats {
+		uint32 allocations;		///< Number of calls to allocate().
+		uint32 frees;			///< Number of calls to free().
+		uint32 resets;			///< Number of calls to reset().
+		uint32 blockAllocations;	///< Number of blocks obtained from malloc().
+		size_t bytesInUse;		///< Bytes currently handed out.
+		size_t peakBytesInUse;	///< Maximum value bytesInUse ever reached.
+		size_t bytesReserved;	///< Bytes currently held in blocks.
+	};
+
+	/**
+	 * Create a new arena.
+	 *
+	 * @param name			name used when printing statistics
+	 * @param blockSize		size of the blocks requested from malloc()
+	 * @param threadSafe	whether to guard all operations with a mutex
+	 */
+	explicit Arena(const char *name, size_t blockSize = 64 * 1024, bool threadSafe = false);
+	~Arena();
+
+	/**
+	 * Allocate a chunk of memory. The result is aligned suitably for
+	 * any of our fundamental types.
+	 */
+	void *allocate(size_t size);
+
+	/**
+	 * Return a chunk to the arena. The size must be the same as the one
+	 * passed to allocate(). Chunks larger than the biggest size class
+	 * are only reclaimed by the next reset().
+	 */
+	void free(void *ptr, size_t size);
+
+	/**
+	 * Release all allocations at once. The blocks are kept for reuse,
+	 * unless releaseMemory is set, in which case all but the first one
+	 * are returned to the system.
+	 */
+	void reset(bool releaseMemory = false);
+
+	const Stats &getStats() const { return _stats; }
+	const char *getName() const { return _name; }
+
+	/** Print the statistics of this arena via debug(). */
+	void printStats() const;
+
+	/**
+	 * Call the destructor of an object created with the placement new
+	 * operator below and return its memory to the arena.
+	 */
+	template<class T>
+	void destroy(T *ptr) {
+		if (ptr) {
+			ptr->~T();
+			free(ptr, sizeof(T));
+		}
+	}
+
+private:
+	enum {
+		kAlignment = 8,
+		kNumSizeClasses = 7		// 8, 16, 32, ..., 512 bytes
+	};
+
+	struct Block {
+		byte *start;
+		size_t size;
+	};
+
+	const char *_name;
+	const size_t _blockSize;
+	OSystem::MutexRef _mutex;
+
+	Array<Block> _blocks;
+	uint _currentBlock;
+	size_t _offset;		///< Bump offset in the current block.
+	void *_freeLists[kNumSizeClasses];
+
+	Stats _stats;
+
+	static int sizeClass(size_t size);
+	static size_t classSize(int sizeClass) { return (size_t)kAlignment << sizeClass; }
+
+	void *allocateFromBlocks(size_t size);
+	void lock() const;
+	void unlock() const;
+};
+
+} // End of namespace Common
+
+/**
+ * A custom placement new operator, using a Common::Arena.
+ */
+inline void *operator new(size_t nbytes, Common::Arena &arena) {
+	return arena.allocate(nbytes);
+}
+
+inline void operator delete(void *p, Common::Arena &arena) {
+	// Only invoked if a constructor throws; the size is unknown here, so the
+	// chunk is simply reclaimed by the next reset.
+}
+
+#endif
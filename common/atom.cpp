@@ -0,0 +1,63 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/atom.h"
+#include "common/hash-str.h"
+
+namespace Common {
+
+// HashMap nodes never move, so atoms can point directly at the values.
+typedef HashMap<String, Atom::Entry, CaseSensitiveString_Hash, CaseSensitiveString_EqualTo> AtomTable;
+
+// Allocated on first use to avoid a global constructor.
+static AtomTable *g_atomTable = nullptr;
+
+const Atom::Entry *Atom::intern(const String &str) {
+	if (!g_atomTable)
+		g_atomTable = new AtomTable();
+
+	const uint hash = hashit(str);
+	AtomTable::iterator it = g_atomTable->findWithHash(str, hash);
+	if (it != g_atomTable->end())
+		return &it->_value;
+
+	Entry &entry = (*g_atomTable)[str];
+	entry.str = str;
+	entry.hash = hash;
+	entry.hashLower = hashit_lower(str);
+	return &entry;
+}
+
+Atom::Atom() : _entry(intern(String())) {
+}
+
+Atom::Atom(const String &str) : _entry(intern(str)) {
+}
+
+Atom::Atom(const char *str) : _entry(intern(String(str))) {
+}
+
+uint Atom::getTableSize() {
+	return g_atomTable ? g_atomTable->size() : 0;
+}
+
+} // End of namespace Common
@@ -0,0 +1,104 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_ATOM_H
+#define COMMON_ATOM_H
+
+#include "common/scummsys.h"
+#include "common/func.h"
+#include "common/str.h"
+
+namespace Common {
+
+/**
+ * An interned, immutable string.
+ *
+ * All atoms created from equal strings share a single entry in a global
+ * table, so comparing two atoms is a pointer comparison. The entry also
+ * stores the case sensitive and the case insensitive hash of the string,
+ * which lets hash based containers and archives skip hashing the string
+ * on every lookup.
+ *
+ * Creating an atom has about the cost of one HashMap lookup, so atoms pay
+ * off for names which are looked up repeatedly, e.g. resource file names.
+ * Entries are never removed from the table.
+ *
+ * @note The atom table is not thread-safe; only create atoms from the
+ *       main thread.
+ */
+class Atom {
+public:
+	struct Entry {
+		String str;
+		uint hash;		///< Result of hashit() for the string.
+		uint hashLower;	///< Result of hashit_lower() for the string.
+	};
+
+	/** Construct the atom for the empty string. */
+	Atom();
+	explicit Atom(const String &str);
+	explicit Atom(const char *str);
+
+	const String &str() const { return _entry->str; }
+	const char *c_str() const { return _entry->str.c_str(); }
+	operator const String &() const { return _entry->str; }
+
+	uint size() const { return _entry->str.size(); }
+	bool empty() const { return _entry->str.empty(); }
+
+	/** Case sensitive hash, as computed by hashit(). */
+	uint hash() const { return _entry->hash; }
+	/** Case insensitive hash, as computed by hashit_lower(). */
+	uint hashLower() const { return _entry->hashLower; }
+
+	bool operator==(const Atom &x) const { return _entry == x._entry; }
+	bool operator!=(const Atom &x) const { return _entry != x._entry; }
+
+	bool equalsIgnoreCase(const Atom &x) const {
+		return _entry == x._entry || (_entry->hashLower == x._entry->hashLower && _entry->str.equalsIgnoreCase(x._entry->str));
+	}
+
+	/** Return the number of distinct strings interned so far. */
+	static uint getTableSize();
+
+private:
+	const Entry *_entry;
+
+	static const Entry *intern(const String &str);
+};
+
+template<>
+struct Hash<Atom> {
+	uint operator()(const Atom &x) const { return x.hash(); }
+};
+
+struct Atom_IgnoreCase_Hash {
+	uint operator()(const Atom &x) const { return x.hashLower(); }
+};
+
+struct Atom_IgnoreCase_EqualTo {
+	bool operator()(const Atom &x, const Atom &y) const { return x.equalsIgnoreCase(y); }
+};
+
+} // End of namespace Common
+
+#endif
@@ -0,0 +1,115 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_ATOMIC_H
+#define COMMON_ATOMIC_H
+
+#include "common/scummsys.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Common {
+
+/**
+ * @name Atomic operations
+ * A minimal set of atomic operations on 32-bit values, for data shared
+ * between threads without a mutex. Loads have acquire and stores release
+ * semantics, i.e. everything written before a atomicStoreRelease() is
+ * visible to a thread once its atomicLoadAcquire() sees the new value.
+ *
+ * Compilers without support for any of the used intrinsics are assumed
+ * to target platforms without threads, where plain accesses suffice.
+ */
+//@{
+
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7)))
+
+inline uint32 atomicLoadAcquire(const volatile uint32 *ptr) {
+	return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+inline void atomicStoreRelease(volatile uint32 *ptr, uint32 value) {
+	__atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+/** Add value to *ptr and return the previous value. */
+inline uint32 atomicFetchAdd(volatile uint32 *ptr, uint32 value) {
+	return __atomic_fetch_add(ptr, value, __ATOMIC_ACQ_REL);
+}
+
+#elif defined(__GNUC__)
+
+inline uint32 atomicLoadAcquire(const volatile uint32 *ptr) {
+	uint32 value = *ptr;
+	__sync_synchronize();
+	return value;
+}
+
+inline void atomicStoreRelease(volatile uint32 *ptr, uint32 value) {
+	__sync_synchronize();
+	*ptr = value;
+}
+
+inline uint32 atomicFetchAdd(volatile uint32 *ptr, uint32 value) {
+	return __sync_fetch_and_add(ptr, value);
+}
+
+#elif defined(_MSC_VER)
+
+// MSVC gives volatile accesses acquire and release semantics.
+inline uint32 atomicLoadAcquire(const volatile uint32 *ptr) {
+	return *ptr;
+}
+
+inline void atomicStoreRelease(volatile uint32 *ptr, uint32 value) {
+	*ptr = value;
+}
+
+inline uint32 atomicFetchAdd(volatile uint32 *ptr, uint32 value) {
+	return (uint32)_InterlockedExchangeAdd((volatile long *)ptr, (long)value);
+}
+
+#else
+
+inline uint32 atomicLoadAcquire(const volatile uint32 *ptr) {
+	return *ptr;
+}
+
+inline void atomicStoreRelease(volatile uint32 *ptr, uint32 value) {
+	*ptr = value;
+}
+
+inline uint32 atomicFetchAdd(volatile uint32 *ptr, uint32 value) {
+	uint32 old = *ptr;
+	*ptr = old + value;
+	return old;
+}
+
+#endif
+
+//@}
+
+} // End of namespace Common
+
+#endif
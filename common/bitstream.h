@@ -42,6 +42,12 @@ namespace Common {
  * For example, a bit stream with the layout parameters 32, true, false
  * for valueBits, isLE and isMSB2LSB, reads 32bit little-endian values
  * from the data stream and hands out the bits in the order of LSB to MSB.
+ *
+ * The bit stream starts at the current position of the data stream.
+ * Values are read ahead into a 64-bit window, so multi-bit reads and
+ * peeks of up to 32 bits never have to touch the stream more than once.
+ * As a consequence, the position of the underlying stream is ahead of
+ * the bit stream's position by up to 8 bytes.
  */
 template<class STREAM, int valueBits, bool isLE, bool isMSB2LSB>
 class BitStreamImpl {
@@ -49,10 +55,15 @@ private:
 	STREAM *_stream;			///< The input stream.
 	DisposeAfterUse::Flag _disposeAfterUse; ///< Should we delete the stream on destruction?
 
-	uint32 _value;   ///< Current value.
-	uint8  _inValue; ///< Position within the current value.
-	uint32 _size;    ///< Total bitstream size (in bits)
-	uint32 _pos;     ///< Current bitstream position (in bits)
+	/**
+	 * Bits read from the stream, but not consumed yet. The next bit is the
+	 * MSB for MSB2LSB streams and the LSB otherwise; unused bits are zero.
+	 */
+	uint64 _window;
+	uint8  _inWindow; ///< Number of valid bits in the window.
+	uint32 _start;    ///< Position of the bitstream in the data stream (in bytes)
+	uint32 _size;     ///< Total bitstream size (in bits)
+	uint32 _pos;      ///< Current bitstream position (in bits)
 
 	/** Read a data value. */
 	inline uint32 readData() {
@@ -76,39 +87,66 @@ private:
 		return 0;
 	}
 
-	/** Read the next data value. */
-	inline void readValue() {
-		if (_size - _pos < valueBits)
-			error("BitStreamImpl::readValue(): End of bit stream reached");
+	/**
+	 * Fill the window with as many data values as fit and are left. If the
+	 * data stream ends early, the bit stream ends there too, so that only
+	 * reads which actually need the missing bits fail.
+	 */
+	inline void refill() {
+		while (_inWindow <= 64 - valueBits && _size - _pos > _inWindow) {
+			uint64 value = readData();
+			if (_stream->err() || _stream->eos()) {
+				_size = _pos + _inWindow;
+				break;
+			}
+
+			if (isMSB2LSB)
+				_window |= value << (64 - valueBits - _inWindow);
+			else
+				_window |= value << _inWindow;
 
-		_value = readData();
-		if (_stream->err() || _stream->eos())
-			error("BitStreamImpl::readValue(): Read error");
+			_inWindow += valueBits;
+		}
+	}
 
-		// If we're reading the bits MSB first, we need to shift the value to that position
+	/** Return the next n bits of the window, 0 < n <= 32. */
+	inline uint32 windowBits(uint8 n) const {
 		if (isMSB2LSB)
-			_value <<= 32 - valueBits;
-		}
+			return (uint32)(_window >> (64 - n));
+		else
+			return (uint32)(_window & (((uint64)1 << n) - 1));
+	}
+
+	/** Remove n bits from the window, n <= _inWindow. */
+	inline void consume(uint8 n) {
+		if (isMSB2LSB)
+			_window <<= n;
+		else
+			_window >>= n;
+
+		_inWindow -= n;
+		_pos += n;
+	}
 
 public:
 	/** Create a bit stream using this input data stream and optionally delete it on destruction. */
 	BitStreamImpl(STREAM *stream, DisposeAfterUse::Flag disposeAfterUse = DisposeAfterUse::NO) :
-		_stream(stream), _disposeAfterUse(disposeAfterUse), _value(0), _inValue(0), _pos(0) {
+		_stream(stream), _disposeAfterUse(disposeAfterUse), _window(0), _inWindow(0), _pos(0) {
 
 		if ((valueBits != 8) && (valueBits != 16) && (valueBits != 32))
 			error("BitStreamImpl: Invalid memory layout %d, %d, %d", valueBits, isLE, isMSB2LSB);
 
-		_size = (_stream->size() & ~((uint32) ((valueBits >> 3) - 1))) * 8;
+		init();
 	}
 
 	/** Create a bit stream using this input data stream. */
 	BitStreamImpl(STREAM &stream) :
-		_stream(&stream), _disposeAfterUse(DisposeAfterUse::NO), _value(0), _inValue(0), _pos(0) {
+		_stream(&stream), _disposeAfterUse(DisposeAfterUse::NO), _window(0), _inWindow(0), _pos(0) {
 
 		if ((valueBits != 8) && (valueBits != 16) && (valueBits != 32))
 			error("BitStreamImpl: Invalid memory layout %d, %d, %d", valueBits, isLE, isMSB2LSB);
 
-		_size = (_stream->size() & ~((uint32) ((valueBits >> 3) - 1))) * 8;
+		init();
 	}
 
 	~BitStreamImpl() {
@@ -117,36 +155,27 @@ public:
 	}
 
 private:
-	uint32 getBit_internal() {
-		// Get the current bit
-		uint32 b = 0;
-		if (isMSB2LSB)
-			b = ((_value & 0x80000000) == 0) ? 0 : 1;
-		else
-			b = ((_value & 1) == 0) ? 0 : 1;
-
-		// Shift to the next bit
-		if (isMSB2LSB)
-			_value <<= 1;
-		else
-			_value >>= 1;
-
-		return b;
+	void init() {
+		_start = _stream->pos();
+		_size = ((_stream->size() - _start) & ~((uint32) ((valueBits >> 3) - 1))) * 8;
 	}
 
 public:
+	/** Return whether the bits are handed out starting with the MSB of each value. */
+	static bool isMSBFirst() {
+		return isMSB2LSB;
+	}
+
 	/** Read a bit from the bit stream. */
 	uint32 getBit() {
-		// Check if we need the next value
-		if (_inValue == 0)
-			readValue();
-
-		uint32 b = getBit_internal();
-
-		// Increase the position within the current value
-		_inValue = (_inValue + 1) % valueBits;
-		_pos++;
+		if (_inWindow == 0) {
+			refill();
+			if (_inWindow == 0)
+				error("BitStreamImpl::getBit(): End of bit stream reached");
+		}
 
+		uint32 b = windowBits(1);
+		consume(1);
 		return b;
 	}
 
@@ -167,84 +196,39 @@ public:
 		if (n > 32)
 			error("BitStreamImpl::getBits(): Too many bits requested to be read");
 
-		// Read the number of bits
-		uint32 v = 0;
-
-		uint8 nOrig = n;
-		if (_inValue) {
-			int count = MIN((int)n, valueBits - _inValue);
-			for (int i = 0; i < count; ++i) {
-				if (isMSB2LSB) {
-					v = (v << 1) | getBit_internal();
-				} else {
-					v = (v >> 1) | (getBit_internal() << 31);
-				}
-			}
-
-			n -= count;
-		}
-
-		while (n > 0) {
-			// NB: readValue doesn't care that _inValue is incorrect here
-			readValue();
-
-			int count = MIN((int)n, valueBits);
-			for (int i = 0; i < count; ++i) {
-				if (isMSB2LSB) {
-					v = (v << 1) | getBit_internal();
-				} else {
-					v = (v >> 1) | (getBit_internal() << 31);
-				}
-			}
-
-			n -= count;
+		if (_inWindow < n) {
+			refill();
+			if (_inWindow < n)
+				error("BitStreamImpl::getBits(): End of bit stream reached");
 		}
 
-		_inValue = (_inValue + nOrig) % valueBits;
-		_pos += nOrig;
-
-		if (!isMSB2LSB)
-			v >>= (32 - nOrig);
-
+		uint32 v = windowBits(n);
+		consume(n);
 		return v;
 	}
 
 	/** Read a bit from the bit stream, without changing the stream's position. */
 	uint32 peekBit() {
-		uint32 value   = _value;
-		uint8  inValue = _inValue;
-		uint32 curStreamPos  = _stream->pos();
-		uint32 curPos = _pos;
-
-		uint32 v = getBit();
-
-		_pos     = curPos;
-		_stream->seek(curStreamPos);
-		_inValue = inValue;
-		_value   = value;
-
-		return v;
+		return peekBits(1);
 	}
 
 	/**
 	 * Read a multi-bit value from the bit stream, without changing the stream's position.
 	 *
-	 * The bit order is the same as in getBits().
+	 * The bit order is the same as in getBits(). Bits past the end of the
+	 * stream read as 0.
 	 */
 	uint32 peekBits(uint8 n) {
-		uint32 value   = _value;
-		uint8  inValue = _inValue;
-		uint32 curStreamPos  = _stream->pos();
-		uint32 curPos = _pos;
+		if (n == 0)
+			return 0;
 
-		uint32 v = getBits(n);
+		if (n > 32)
+			error("BitStreamImpl::peekBits(): Too many bits requested to be read");
 
-		_pos     = curPos;
-		_stream->seek(curStreamPos);
-		_inValue = inValue;
-		_value   = value;
+		if (_inWindow < n)
+			refill();
 
-		return v;
+		return windowBits(n);
 	}
 
 	/**
@@ -270,23 +254,27 @@ public:
 
 	/** Rewind the bit stream back to the start. */
 	void rewind() {
-		_stream->seek(0);
+		_stream->seek(_start);
+		init();
 
-		_value   = 0;
-		_inValue = 0;
-		_pos     = 0;
+		_window   = 0;
+		_inWindow = 0;
+		_pos      = 0;
 	}
 
 	/** Skip the specified amount of bits. */
 	void skip(uint32 n) {
-		while (n-- > 0)
-			getBit();
+		while (n > 32) {
+			getBits(32);
+			n -= 32;
+		}
+
+		getBits(n);
 	}
 
 	/** Skip the bits to closest data value border. */
 	void align() {
-		while (_inValue)
-			getBit();
+		skip((valueBits - _pos % valueBits) % valueBits);
 	}
 
 	/** Return the stream position in bits. */
@@ -300,7 +288,7 @@ public:
 	}
 
 	bool eos() const {
-		return _stream->eos() || (_pos >= _size);
+		return _pos >= _size || (_inWindow == 0 && _stream->eos());
 	}
 };
 
@@ -52,12 +52,15 @@ char const *const ConfigManager::kCloudDomain = "cloud";
 #pragma mark -
 
 
+uint32 ConfigManager::_generation = 0;
+
 ConfigManager::ConfigManager() : _activeDomain(nullptr) {
 }
 
 void ConfigManager::defragment() {
 	ConfigManager *newInstance = new ConfigManager();
 	newInstance->copyFrom(*_singleton);
+	newInstance->_settings = _singleton->_settings;
 	delete _singleton;
 	_singleton = newInstance;
 }
@@ -78,6 +81,14 @@ void ConfigManager::copyFrom(ConfigManager &source) {
 	_activeDomainName = source._activeDomainName;
 	_activeDomain = &_gameDomains[_activeDomainName];
 	_filename = source._filename;
+	changed();
+}
+
+void ConfigManager::changed() {
+	_generation++;
+
+	for (uint i = 0; i < _settings.size(); ++i)
+		_settings[i]->update();
 }
 
 
@@ -254,6 +265,8 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 	}
 
 	addDomain(domainName, domain); // Add the last domain found
+
+	changed();
 }
 
 void ConfigManager::flushToDisk() {
@@ -458,6 +471,7 @@ void ConfigManager::removeKey(const String &key, const String &domName) {
 		      key.c_str(), domName.c_str());
 
 	domain->erase(key);
+	changed();
 }
 
 
@@ -539,6 +553,8 @@ void ConfigManager::set(const String &key, const String &value) {
 		(*_activeDomain)[key] = value;
 	else
 		_appDomain[key] = value;
+
+	changed();
 }
 
 void ConfigManager::set(const String &key, const String &value, const String &domName) {
@@ -557,6 +573,7 @@ void ConfigManager::set(const String &key, const String &value, const String &do
 		      key.c_str(), value.c_str(), domName.c_str());
 
 	(*domain)[key] = value;
+	changed();
 
 	// TODO/FIXME: We used to erase the given key from the transient domain
 	// here. Do we still want to do that?
@@ -600,6 +617,7 @@ void ConfigManager::setBool(const String &key, bool value, const String &domName
 
 void ConfigManager::registerDefault(const String &key, const String &value) {
 	_defaultsDomain[key] = value;
+	changed();
 }
 
 void ConfigManager::registerDefault(const String &key, const char *value) {
@@ -626,6 +644,7 @@ void ConfigManager::setActiveDomain(const String &domName) {
 		_activeDomain = &_gameDomains[domName];
 	}
 	_activeDomainName = domName;
+	changed();
 }
 
 void ConfigManager::addGameDomain(const String &domName) {
@@ -657,6 +676,7 @@ void ConfigManager::removeGameDomain(const String &domName) {
 		_activeDomain = nullptr;
 	}
 	_gameDomains.erase(domName);
+	changed();
 }
 
 void ConfigManager::removeMiscDomain(const String &domName) {
@@ -672,6 +692,7 @@ void ConfigManager::renameGameDomain(const String &oldName, const String &newNam
 		_activeDomainName = newName;
 		_activeDomain = &_gameDomains[newName];
 	}
+	changed();
 }
 
 void ConfigManager::renameMiscDomain(const String &oldName, const String &newName) {
@@ -729,4 +750,60 @@ bool ConfigManager::Domain::hasKVComment(const String &key) const {
 	return _keyValueComments.contains(key);
 }
 
+
+#pragma mark -
+
+
+ConfigSettingBase::ConfigSettingBase(const String &key, const String &domName)
+	: _key(key), _domName(domName), _generation(0), _value(0) {
+	ConfMan._settings.push_back(this);
+}
+
+ConfigSettingBase::~ConfigSettingBase() {
+	// The mixer's settings outlive the configuration manager
+	if (!ConfigManager::hasInstance())
+		return;
+
+	Array<ConfigSettingBase *> &settings = ConfMan._settings;
+	for (uint i = 0; i < settings.size(); ++i) {
+		if (settings[i] == this) {
+			settings.remove_at(i);
+			break;
+		}
+	}
+}
+
+void ConfigSettingBase::update() {
+	_generation = ConfigManager::getGeneration();
+	atomicStoreRelease(&_value, read());
+}
+
+template<>
+uint32 ConfigSetting<int>::read() const {
+	if (!_domName.empty() && !ConfMan.getDomain(_domName))
+		return 0;
+
+	const String &value = ConfMan.get(_key, _domName);
+	char *errpos;
+
+	// Same parsing as in ConfigManager::getInt()
+	int ivalue = (int)strtol(value.c_str(), &errpos, 0);
+	if (value.c_str() == errpos)
+		return 0;
+
+	return (uint32)ivalue;
+}
+
+template<>
+uint32 ConfigSetting<bool>::read() const {
+	if (!_domName.empty() && !ConfMan.getDomain(_domName))
+		return 0;
+
+	bool value;
+	if (!parseBool(ConfMan.get(_key, _domName), value))
+		return 0;
+
+	return value ? 1 : 0;
+}
+
 } // End of namespace Common
@@ -24,7 +24,9 @@
 #define COMMON_CONFIG_MANAGER_H
 
 #include "common/array.h"
+#include "common/atomic.h"
 #include "common/hashmap.h"
+#include "common/noncopyable.h"
 #include "common/singleton.h"
 #include "common/str.h"
 #include "common/hash-str.h"
@@ -33,6 +35,7 @@ namespace Common {
 
 class WriteStream;
 class SeekableReadStream;
+class ConfigSettingBase;
 
 /**
  * The (singleton) configuration manager, used to query & set configuration
@@ -61,17 +64,17 @@ public:
 
 		bool contains(const String &key) const { return _entries.contains(key); }
 
-		String &operator[](const String &key) { return _entries[key]; }
+		String &operator[](const String &key) { _generation++; return _entries[key]; }
 		const String &operator[](const String &key) const { return _entries[key]; }
 
-		void setVal(const String &key, const String &value) { _entries.setVal(key, value); }
+		void setVal(const String &key, const String &value) { _generation++; _entries.setVal(key, value); }
 
-		String &getVal(const String &key) { return _entries.getVal(key); }
+		String &getVal(const String &key) { _generation++; return _entries.getVal(key); }
 		const String &getVal(const String &key) const { return _entries.getVal(key); }
 
-		void clear() { _entries.clear(); }
+		void clear() { _generation++; _entries.clear(); }
 
-		void erase(const String &key) { _entries.erase(key); }
+		void erase(const String &key) { _generation++; _entries.erase(key); }
 
 		void setDomainComment(const String &comment);
 		const String &getDomainComment() const;
@@ -174,10 +177,23 @@ public:
 	static void			defragment(); // move in memory to reduce fragmentation
 	void 				copyFrom(ConfigManager &source);
 
+	/**
+	 * Return a counter which changes whenever any configuration value may
+	 * have changed, allowing callers to cache values derived from them.
+	 */
+	static uint32		getGeneration() { return _generation; }
+
 private:
 	friend class Singleton<SingletonBaseType>;
+	friend class ConfigSettingBase;
 	ConfigManager();
 
+	/** Bump the generation and update all registered settings. */
+	void			changed();
+
+	static uint32	_generation;
+	Array<ConfigSettingBase *> _settings;
+
 	void			loadFromStream(SeekableReadStream &stream);
 	void			addDomain(const String &domainName, const Domain &domain);
 	void			writeDomain(WriteStream &stream, const String &name, const Domain &domain);
@@ -210,4 +226,92 @@ private:
 /** Shortcut for accessing the configuration manager. */
 #define ConfMan		Common::ConfigManager::instance()
 
+namespace Common {
+
+/**
+ * Base class of ConfigSetting, see there.
+ */
+class ConfigSettingBase : NonCopyable {
+public:
+	const String &getKey() const { return _key; }
+	const String &getDomainName() const { return _domName; }
+
+	/** Re-read the value from the configuration manager. */
+	void update();
+
+protected:
+	ConfigSettingBase(const String &key, const String &domName);
+	virtual ~ConfigSettingBase();
+
+	/** Return the current value from the configuration manager, packed into 32 bits. */
+	virtual uint32 read() const = 0;
+
+	uint32 load() const { return atomicLoadAcquire(&_value); }
+
+	void updateIfChanged() {
+		if (_generation != ConfigManager::getGeneration())
+			update();
+	}
+
+	const String _key;
+	const String _domName;
+
+private:
+	uint32 _generation;
+	volatile uint32 _value;
+};
+
+/**
+ * A handle to a single configuration value of type int or bool.
+ *
+ * The key is resolved once and the value is cached, so reading it is
+ * a single load, instead of several string based HashMap lookups as with
+ * ConfMan.getInt() and ConfMan.getBool(). Changes made through the
+ * configuration manager are pushed to all existing settings; changes
+ * made directly on a ConfigManager::Domain are picked up by the next
+ * get() call.
+ *
+ * get() must only be called from the main thread. getCached() can also
+ * be called from other threads, e.g. the audio thread, without locking.
+ * It returns the value as of the last change made through ConfMan.
+ *
+ * Unlike ConfMan.getInt() and ConfMan.getBool(), missing or invalid
+ * values read as 0 resp. false instead of raising an error, as settings
+ * are also updated while the configuration is being changed.
+ *
+ * Settings which outlive the configuration manager keep their last value.
+ */
+template<typename T>
+class ConfigSetting : public ConfigSettingBase {
+public:
+	explicit ConfigSetting(const String &key, const String &domName = String())
+		: ConfigSettingBase(key, domName) {
+		update();
+	}
+
+	T get() {
+		updateIfChanged();
+		return getCached();
+	}
+
+	T getCached() const;
+
+protected:
+	virtual uint32 read() const;
+};
+
+template<>
+inline int ConfigSetting<int>::getCached() const { return (int)load(); }
+
+template<>
+uint32 ConfigSetting<int>::read() const;
+
+template<>
+inline bool ConfigSetting<bool>::getCached() const { return load() != 0; }
+
+template<>
+uint32 ConfigSetting<bool>::read() const;
+
+} // End of namespace Common
+
 #endif
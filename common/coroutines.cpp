@@ -95,7 +95,6 @@ CoroBaseContext::~CoroBaseContext() {
 //--------------------- Scheduler Class ------------------------
 
 CoroutineScheduler::CoroutineScheduler() {
-	processList = nullptr;
 	pFreeProcesses = nullptr;
 	pCurrent = nullptr;
 
@@ -107,6 +106,7 @@ CoroutineScheduler::CoroutineScheduler() {
 
 	pRCfunction = nullptr;
 	pidCounter = 0;
+	_wakeSerial = 0;
 
 	active = new PROCESS;
 	active->pPrevious = nullptr;
@@ -124,16 +124,31 @@ CoroutineScheduler::~CoroutineScheduler() {
 		pProc = pProc->pNext;
 	}
 
-	free(processList);
-	processList = nullptr;
+	for (uint i = 0; i < _processBlocks.size(); ++i)
+		delete[] _processBlocks[i];
+	_processBlocks.clear();
 
 	delete active;
 	active = nullptr;
 
 	// Clear the event list
-	Common::List<EVENT *>::iterator i;
-	for (i = _events.begin(); i != _events.end(); ++i)
-		delete *i;
+	for (EventMap::iterator i = _events.begin(); i != _events.end(); ++i)
+		delete i->_value;
+}
+
+void CoroutineScheduler::allocateProcessBlock() {
+	PROCESS *block = new PROCESS[CORO_NUM_PROCESS]();
+	_processBlocks.push_back(block);
+	linkFreeProcessBlock(block);
+}
+
+void CoroutineScheduler::linkFreeProcessBlock(PROCESS *block) {
+	// link all processes of the block in front of the free list
+	for (int i = 0; i < CORO_NUM_PROCESS; i++) {
+		block[i].pNext = (i == CORO_NUM_PROCESS - 1) ? pFreeProcesses : block + i + 1;
+		block[i].pPrevious = nullptr;
+	}
+	pFreeProcesses = block;
 }
 
 void CoroutineScheduler::reset() {
@@ -142,19 +157,6 @@ void CoroutineScheduler::reset() {
 	numProcs = 0;
 #endif
 
-	if (processList == nullptr) {
-		// first time - allocate memory for process list
-		processList = (PROCESS *)calloc(CORO_MAX_PROCESSES, sizeof(PROCESS));
-
-		// make sure memory allocated
-		if (processList == nullptr) {
-			error("Cannot allocate memory for process data");
-		}
-
-		// fill with garbage
-		memset(processList, 'S', CORO_MAX_PROCESSES * sizeof(PROCESS));
-	}
-
 	// Kill all running processes (i.e. free memory allocated for their state).
 	PROCESS *pProc = active->pNext;
 	while (pProc != nullptr) {
@@ -166,56 +168,42 @@ void CoroutineScheduler::reset() {
 
 	// no active processes
 	pCurrent = active->pNext = nullptr;
+	_pidCount.clear();
+	_wakeSerial++;
 
-	// place first process on free list
-	pFreeProcesses = processList;
-
-	// link all other processes after first
-	for (int i = 1; i <= CORO_NUM_PROCESS; i++) {
-		processList[i - 1].pNext = (i == CORO_NUM_PROCESS) ? nullptr : processList + i;
-		processList[i - 1].pPrevious = (i == 1) ? active : processList + (i - 2);
+	// place all processes back on the free list, allocating the first block
+	// if necessary
+	pFreeProcesses = nullptr;
+	if (_processBlocks.empty()) {
+		allocateProcessBlock();
+	} else {
+		for (uint i = _processBlocks.size(); i-- > 0; )
+			linkFreeProcessBlock(_processBlocks[i]);
 	}
 }
 
 
 #ifdef DEBUG
 void CoroutineScheduler::printStats() {
-	debug("%i process of %i used", maxProcs, CORO_NUM_PROCESS);
+	debug("%i process of %i used", maxProcs, (int)_processBlocks.size() * CORO_NUM_PROCESS);
 }
 #endif
 
 #ifdef DEBUG
 void CoroutineScheduler::checkStack() {
-	Common::List<PROCESS *> pList;
-
-	// Check both the active and free process lists
-	for (int i = 0; i < 2; ++i) {
-		PROCESS *p = (i == 0) ? active : pFreeProcesses;
-
-		if (p != NULL) {
-			// Make sure the linkages are correct
-			while (p->pNext != NULL) {
-				assert(p->pNext->pPrevious == p);
-				pList.push_back(p);
-				p = p->pNext;
-			}
-			pList.push_back(p);
-		}
+	uint count = 0;
+
+	// Make sure the linkages of the active list are correct
+	for (PROCESS *p = active; p->pNext != nullptr; p = p->pNext) {
+		assert(p->pNext->pPrevious == p);
+		++count;
 	}
 
 	// Make sure all processes are accounted for
-	for (int idx = 0; idx < CORO_NUM_PROCESS; idx++) {
-		bool found = false;
-		for (Common::List<PROCESS *>::iterator i = pList.begin(); i != pList.end(); ++i) {
-			PROCESS *pTemp = *i;
-			if (*i == &processList[idx]) {
-				found = true;
-				break;
-			}
-		}
+	for (PROCESS *p = pFreeProcesses; p != nullptr; p = p->pNext)
+		++count;
 
-		assert(found);
-	}
+	assert(count == _processBlocks.size() * CORO_NUM_PROCESS);
 }
 #endif
 
@@ -226,7 +214,10 @@ void CoroutineScheduler::schedule() {
 	while (pProc != nullptr) {
 		pNext = pProc->pNext;
 
-		if (--pProc->sleepTime <= 0) {
+		if (--pProc->sleepTime <= 0 && isBlocked(pProc)) {
+			// nothing the process waits for has changed, check again next tick
+			pProc->sleepTime = 1;
+		} else if (pProc->sleepTime <= 0) {
 			// process is ready for dispatch, activate it
 			pCurrent = pProc;
 			pProc->coroAddr(pProc->state, pProc->param);
@@ -248,15 +239,23 @@ void CoroutineScheduler::schedule() {
 	}
 
 	// Disable any events that were pulsed
-	Common::List<EVENT *>::iterator i;
-	for (i = _events.begin(); i != _events.end(); ++i) {
-		EVENT *evt = *i;
+	for (EventMap::iterator i = _events.begin(); i != _events.end(); ++i) {
+		EVENT *evt = i->_value;
 		if (evt->pulsing) {
 			evt->pulsing = evt->signalled = false;
 		}
 	}
 }
 
+bool CoroutineScheduler::isBlocked(const PROCESS *pProc) const {
+	return pProc->wakeTime != 0 && pProc->waitSerial == _wakeSerial && g_system->getMillis() < pProc->wakeTime;
+}
+
+void CoroutineScheduler::blockCurrentProcess(uint32 wakeTime) {
+	pCurrent->waitSerial = _wakeSerial;
+	pCurrent->wakeTime = wakeTime;
+}
+
 void CoroutineScheduler::rescheduleAll() {
 	assert(pCurrent);
 
@@ -348,7 +347,7 @@ void CoroutineScheduler::waitForSingleObject(CORO_PARAM, int pid, uint32 duratio
 
 	CORO_BEGIN_CONTEXT;
 		uint32 endTime;
-		PROCESS *pProcess;
+		bool processActive;
 		EVENT *pEvent;
 	CORO_END_CONTEXT(_ctx);
 
@@ -365,12 +364,12 @@ void CoroutineScheduler::waitForSingleObject(CORO_PARAM, int pid, uint32 duratio
 	// Outer loop for doing checks until expiry
 	while (g_system->getMillis() <= _ctx->endTime) {
 		// Check to see if a process or event with the given Id exists
-		_ctx->pProcess = getProcess(pid);
-		_ctx->pEvent = !_ctx->pProcess ? getEvent(pid) : nullptr;
+		_ctx->processActive = isProcessActive(pid);
+		_ctx->pEvent = !_ctx->processActive ? getEvent(pid) : nullptr;
 
 		// If there's no active process or event, presume it's a process that's finished,
 		// so the waiting can immediately exit
-		if ((_ctx->pProcess == nullptr) && (_ctx->pEvent == nullptr)) {
+		if (!_ctx->processActive && (_ctx->pEvent == nullptr)) {
 			if (expired)
 				*expired = false;
 			break;
@@ -388,12 +387,14 @@ void CoroutineScheduler::waitForSingleObject(CORO_PARAM, int pid, uint32 duratio
 			break;
 		}
 
-		// Sleep until the next cycle
+		// Sleep until the process or event changes, or the time is up
+		blockCurrentProcess(_ctx->endTime == CORO_INFINITE ? CORO_INFINITE : _ctx->endTime + 1);
 		CORO_SLEEP(1);
 	}
 
 	// Signal waiting is done
 	Common::fill(&pCurrent->pidWaiting[0], &pCurrent->pidWaiting[CORO_MAX_PID_WAITING], 0);
+	pCurrent->wakeTime = 0;
 
 	CORO_END_CODE;
 }
@@ -408,7 +409,7 @@ void CoroutineScheduler::waitForMultipleObjects(CORO_PARAM, int nCount, uint32 *
 		bool signalled;
 		bool pidSignalled;
 		int i;
-		PROCESS *pProcess;
+		bool processActive;
 		EVENT *pEvent;
 	CORO_END_CONTEXT(_ctx);
 
@@ -428,11 +429,11 @@ void CoroutineScheduler::waitForMultipleObjects(CORO_PARAM, int nCount, uint32 *
 		_ctx->signalled = bWaitAll;
 
 		for (_ctx->i = 0; _ctx->i < nCount; ++_ctx->i) {
-			_ctx->pProcess = getProcess(pidList[_ctx->i]);
-			_ctx->pEvent = !_ctx->pProcess ? getEvent(pidList[_ctx->i]) : nullptr;
+			_ctx->processActive = isProcessActive(pidList[_ctx->i]);
+			_ctx->pEvent = !_ctx->processActive ? getEvent(pidList[_ctx->i]) : nullptr;
 
 			// Determine the signalled state
-			_ctx->pidSignalled = (_ctx->pProcess) || !_ctx->pEvent ? false : _ctx->pEvent->signalled;
+			_ctx->pidSignalled = _ctx->processActive || !_ctx->pEvent ? false : _ctx->pEvent->signalled;
 
 			if (bWaitAll && !_ctx->pidSignalled)
 				_ctx->signalled = false;
@@ -455,12 +456,14 @@ void CoroutineScheduler::waitForMultipleObjects(CORO_PARAM, int nCount, uint32 *
 			break;
 		}
 
-		// Sleep until the next cycle
+		// Sleep until one of the processes or events changes, or the time is up
+		blockCurrentProcess(_ctx->endTime == CORO_INFINITE ? CORO_INFINITE : _ctx->endTime + 1);
 		CORO_SLEEP(1);
 	}
 
 	// Signal waiting is done
 	Common::fill(&pCurrent->pidWaiting[0], &pCurrent->pidWaiting[CORO_MAX_PID_WAITING], 0);
+	pCurrent->wakeTime = 0;
 
 	CORO_END_CODE;
 }
@@ -471,8 +474,6 @@ void CoroutineScheduler::sleep(CORO_PARAM, uint32 duration) {
 
 	CORO_BEGIN_CONTEXT;
 		uint32 endTime;
-		PROCESS *pProcess;
-		EVENT *pEvent;
 	CORO_END_CONTEXT(_ctx);
 
 	CORO_BEGIN_CODE(_ctx);
@@ -481,9 +482,11 @@ void CoroutineScheduler::sleep(CORO_PARAM, uint32 duration) {
 
 	// Outer loop for doing checks until expiry
 	while (g_system->getMillis() < _ctx->endTime) {
-		// Sleep until the next cycle
+		// Sleep until the time is up
+		blockCurrentProcess(_ctx->endTime);
 		CORO_SLEEP(1);
 	}
+	pCurrent->wakeTime = 0;
 
 	CORO_END_CODE;
 }
@@ -494,8 +497,11 @@ PROCESS *CoroutineScheduler::createProcess(uint32 pid, CORO_ADDR coroAddr, const
 	// get a free process
 	pProc = pFreeProcesses;
 
-	// trap no free process
-	assert(pProc != nullptr); // Out of processes
+	// grow the process table if all processes are in use
+	if (pProc == nullptr) {
+		allocateProcessBlock();
+		pProc = pFreeProcesses;
+	}
 
 #ifdef DEBUG
 	// one more process in use
@@ -536,9 +542,11 @@ PROCESS *CoroutineScheduler::createProcess(uint32 pid, CORO_ADDR coroAddr, const
 
 	// wake process up as soon as possible
 	pProc->sleepTime = 1;
+	pProc->wakeTime = 0;
 
 	// set new process id
 	pProc->pid = pid;
+	_pidCount[pid]++;
 
 	// set new process specific info
 	if (sizeParam) {
@@ -563,11 +571,15 @@ uint32 CoroutineScheduler::createProcess(CORO_ADDR coroAddr, const void *pParam)
 
 void CoroutineScheduler::killProcess(PROCESS *pKillProc) {
 	// make sure a valid process pointer
-	assert(pKillProc >= processList && pKillProc <= processList + CORO_NUM_PROCESS - 1);
+	assert(pKillProc != nullptr && pKillProc->pPrevious != nullptr);
 
 	// can not kill the current process using killProcess !
 	assert(pCurrent != pKillProc);
 
+	freeProcess(pKillProc);
+}
+
+void CoroutineScheduler::freeProcess(PROCESS *pProc) {
 #ifdef DEBUG
 	// one less process in use
 	--numProcs;
@@ -576,24 +588,27 @@ void CoroutineScheduler::killProcess(PROCESS *pKillProc) {
 
 	// Free process' resources
 	if (pRCfunction != nullptr)
-		(pRCfunction)(pKillProc);
+		(pRCfunction)(pProc);
 
-	delete pKillProc->state;
-	pKillProc->state = nullptr;
-
-	// Take the process out of the active chain list
-	pKillProc->pPrevious->pNext = pKillProc->pNext;
-	if (pKillProc->pNext)
-		pKillProc->pNext->pPrevious = pKillProc->pPrevious;
+	delete pProc->state;
+	pProc->state = nullptr;
 
-	// link first free process after pProc
-	pKillProc->pNext = pFreeProcesses;
-	if (pFreeProcesses)
-		pKillProc->pNext->pPrevious = pKillProc;
-	pKillProc->pPrevious = nullptr;
+	// Update the process Id index and wake up any processes waiting for it
+	Common::HashMap<uint32, uint>::iterator it = _pidCount.find(pProc->pid);
+	assert(it != _pidCount.end());
+	if (--it->_value == 0)
+		_pidCount.erase(it);
+	_wakeSerial++;
 
-	// make pKillProc the first free process
-	pFreeProcesses = pKillProc;
+	// Take the process out of the active chain list
+	pProc->pPrevious->pNext = pProc->pNext;
+	if (pProc->pNext)
+		pProc->pNext->pPrevious = pProc->pPrevious;
+
+	// make pProc the first free process
+	pProc->pNext = pFreeProcesses;
+	pProc->pPrevious = nullptr;
+	pFreeProcesses = pProc;
 }
 
 PROCESS *CoroutineScheduler::getCurrentProcess() {
@@ -604,7 +619,7 @@ int CoroutineScheduler::getCurrentPID() const {
 	PROCESS *pProc = pCurrent;
 
 	// make sure a valid process pointer
-	assert(pProc >= processList && pProc <= processList + CORO_NUM_PROCESS - 1);
+	assert(pProc != nullptr);
 
 	// return processes PID
 	return pProc->pid;
@@ -614,6 +629,10 @@ int CoroutineScheduler::killMatchingProcess(uint32 pidKill, int pidMask) {
 	int numKilled = 0;
 	PROCESS *pProc, *pPrev; // process list pointers
 
+	// Without a mask, there's nothing to do unless a process with the Id exists
+	if (pidMask == -1 && !isProcessActive(pidKill))
+		return 0;
+
 	for (pProc = active->pNext, pPrev = active; pProc != nullptr; pPrev = pProc, pProc = pProc->pNext) {
 		if ((pProc->pid & (uint32)pidMask) == pidKill) {
 			// found a matching process
@@ -622,26 +641,7 @@ int CoroutineScheduler::killMatchingProcess(uint32 pidKill, int pidMask) {
 			if (pProc != pCurrent) {
 				// kill this process
 				numKilled++;
-
-				// Free the process' resources
-				if (pRCfunction != nullptr)
-					(pRCfunction)(pProc);
-
-				delete pProc->state;
-				pProc->state = nullptr;
-
-				// make prev point to next to unlink pProc
-				pPrev->pNext = pProc->pNext;
-				if (pProc->pNext)
-					pPrev->pNext->pPrevious = pPrev;
-
-				// link first free process after pProc
-				pProc->pNext = pFreeProcesses;
-				pProc->pPrevious = nullptr;
-				pFreeProcesses->pPrevious = pProc;
-
-				// make pProc the first free process
-				pFreeProcesses = pProc;
+				freeProcess(pProc);
 
 				// set to a process on the active list
 				pProc = pPrev;
@@ -649,12 +649,6 @@ int CoroutineScheduler::killMatchingProcess(uint32 pidKill, int pidMask) {
 		}
 	}
 
-#ifdef DEBUG
-	// adjust process in use
-	numProcs -= numKilled;
-	assert(numProcs >= 0);
-#endif
-
 	// return number of processes killed
 	return numKilled;
 }
@@ -663,23 +657,9 @@ void CoroutineScheduler::setResourceCallback(VFPTRPP pFunc) {
 	pRCfunction = pFunc;
 }
 
-PROCESS *CoroutineScheduler::getProcess(uint32 pid) {
-	PROCESS *pProc = active->pNext;
-	while ((pProc != nullptr) && (pProc->pid != pid))
-		pProc = pProc->pNext;
-
-	return pProc;
-}
-
 EVENT *CoroutineScheduler::getEvent(uint32 pid) {
-	Common::List<EVENT *>::iterator i;
-	for (i = _events.begin(); i != _events.end(); ++i) {
-		EVENT *evt = *i;
-		if (evt->pid == pid)
-			return evt;
-	}
-
-	return nullptr;
+	EventMap::iterator i = _events.find(pid);
+	return (i != _events.end()) ? i->_value : nullptr;
 }
 
 
@@ -690,22 +670,26 @@ uint32 CoroutineScheduler::createEvent(bool bManualReset, bool bInitialState) {
 	evt->signalled = bInitialState;
 	evt->pulsing = false;
 
-	_events.push_back(evt);
+	_events[evt->pid] = evt;
+	_wakeSerial++;
 	return evt->pid;
 }
 
 void CoroutineScheduler::closeEvent(uint32 pidEvent) {
 	EVENT *evt = getEvent(pidEvent);
 	if (evt) {
-		_events.remove(evt);
+		_events.erase(pidEvent);
 		delete evt;
+		_wakeSerial++;
 	}
 }
 
 void CoroutineScheduler::setEvent(uint32 pidEvent) {
 	EVENT *evt = getEvent(pidEvent);
-	if (evt)
+	if (evt) {
 		evt->signalled = true;
+		_wakeSerial++;
+	}
 }
 
 void CoroutineScheduler::resetEvent(uint32 pidEvent) {
@@ -722,6 +706,7 @@ void CoroutineScheduler::pulseEvent(uint32 pidEvent) {
 	// Set the event as signalled and pulsing
 	evt->signalled = true;
 	evt->pulsing = true;
+	_wakeSerial++;
 
 	// If there's an active process, and it's not the first in the queue, then reschedule all
 	// the other prcoesses in the queue to run again this frame
@@ -25,7 +25,8 @@
 
 #include "common/scummsys.h"
 #include "common/util.h"    // for SCUMMVM_CURRENT_FUNCTION
-#include "common/list.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/singleton.h"
 
 namespace Common {
@@ -286,8 +287,9 @@ public:
 // the size of process specific info
 #define CORO_PARAM_SIZE 32
 
-// the maximum number of processes
+// the number of processes allocated at once; the process table grows as needed
 #define CORO_NUM_PROCESS    100
+// no longer a limit of the scheduler, only used for sizing other per-process pools
 #define CORO_MAX_PROCESSES  100
 #define CORO_MAX_PID_WAITING 5
 
@@ -309,6 +311,9 @@ struct PROCESS {
 	uint32 pid;         ///< process ID
 	uint32 pidWaiting[CORO_MAX_PID_WAITING];    ///< Process ID(s) process is currently waiting on
 	char param[CORO_PARAM_SIZE];    ///< process specific info
+
+	uint32 wakeTime;    ///< time at which a waiting process wakes up even if nothing changed, or 0 if not waiting
+	uint32 waitSerial;  ///< scheduler wake serial at the time the process started waiting
 };
 typedef PROCESS *PPROCESS;
 
@@ -344,8 +349,8 @@ private:
 	~CoroutineScheduler();
 
 
-	/** list of all processes */
-	PROCESS *processList;
+	/** blocks of CORO_NUM_PROCESS processes each, making up the process table */
+	Common::Array<PROCESS *> _processBlocks;
 
 	/** active process list - also saves scheduler state */
 	PROCESS *active;
@@ -359,8 +364,19 @@ private:
 	/** Auto-incrementing process Id */
 	int pidCounter;
 
-	/** Event list */
-	Common::List<EVENT *> _events;
+	/** Number of active processes per process Id */
+	Common::HashMap<uint32, uint> _pidCount;
+
+	/** Events by their Id */
+	typedef Common::HashMap<uint32, EVENT *> EventMap;
+	EventMap _events;
+
+	/**
+	 * Incremented whenever a process is killed or an event changes, so
+	 * processes waiting for one of those only need to be dispatched again
+	 * once the serial differs from the one they started waiting at.
+	 */
+	uint32 _wakeSerial;
 
 #ifdef DEBUG
 	// diagnostic process counters
@@ -380,8 +396,21 @@ private:
 	 */
 	VFPTRPP pRCfunction;
 
-	PROCESS *getProcess(uint32 pid);
+	bool isProcessActive(uint32 pid) const { return _pidCount.contains(pid); }
 	EVENT *getEvent(uint32 pid);
+
+	/** Adds another block of processes to the free list. */
+	void allocateProcessBlock();
+	void linkFreeProcessBlock(PROCESS *block);
+
+	/** Releases an active process and moves it to the free list. */
+	void freeProcess(PROCESS *pProc);
+
+	/** Makes the current process wait until the given time or until _wakeSerial changes. */
+	void blockCurrentProcess(uint32 wakeTime);
+
+	/** Returns whether a waiting process can be skipped by schedule(). */
+	bool isBlocked(const PROCESS *pProc) const;
 public:
 	/**
 	 * Kills all processes and places them on the free list.
@@ -48,6 +48,13 @@ protected:
 	 */
 	uint32 getBitsLSB(int n);
 
+	/**
+	 * Get a number of bits from _src stream, without consuming them.
+	 * @param n		number of bits to get, at most 24
+	 * @return n-bits number
+	 */
+	uint32 peekBitsLSB(int n);
+
 	/**
 	 * Get one byte from _src stream.
 	 * @return byte
@@ -62,7 +69,23 @@ protected:
 	 */
 	void putByte(byte b);
 
-	int huffman_lookup(const int *tree);
+	/**
+	 * Lookup table for a Huffman tree, indexed by the next bits of the
+	 * source stream. Each entry holds the decoded value in the lower and
+	 * the length of its code in the upper byte.
+	 */
+	struct HuffmanTable {
+		int bits;
+		uint16 *entries;
+
+		HuffmanTable() : bits(0), entries(nullptr) {}
+		~HuffmanTable() { delete[] entries; }
+	};
+
+	static void buildTable(HuffmanTable &table, const int *tree, int bits);
+	static void fillTable(HuffmanTable &table, const int *tree, int pos, uint32 code, int codeLength);
+
+	int huffmanLookup(const HuffmanTable &table);
 
 	uint32 _dwBits;			///< bits buffer
 	byte _nBits;			///< number of unread bits in _dwBits
@@ -94,6 +117,12 @@ void DecompressorDCL::fetchBitsLSB() {
 	}
 }
 
+uint32 DecompressorDCL::peekBitsLSB(int n) {
+	if (_nBits < n)
+		fetchBitsLSB();
+	return _dwBits & ~(~0UL << n);
+}
+
 uint32 DecompressorDCL::getBitsLSB(int n) {
 	// Fetching more data to buffer if needed
 	if (_nBits < n)
@@ -316,17 +345,34 @@ static const int ascii_tree[] = {
 	LN(509, 128)      LN(510, 26)
 };
 
-int DecompressorDCL::huffman_lookup(const int *tree) {
-	int pos = 0;
+void DecompressorDCL::buildTable(HuffmanTable &table, const int *tree, int bits) {
+	table.bits = bits;
+	table.entries = new uint16[1 << bits];
+	fillTable(table, tree, 0, 0, 0);
+}
 
-	while (!(tree[pos] & HUFFMAN_LEAF)) {
-		int bit = getBitsLSB(1);
-		debug(8, "[%d]:%d->", pos, bit);
-		pos = bit ? tree[pos] & 0xFFF : tree[pos] >> 12;
+void DecompressorDCL::fillTable(HuffmanTable &table, const int *tree, int pos, uint32 code, int codeLength) {
+	if (tree[pos] & HUFFMAN_LEAF) {
+		// The code is read starting with its first bit, so it occupies the
+		// lowest bits of the index. Every value of the remaining bits maps
+		// to the same leaf.
+		const uint16 entry = (codeLength << 8) | (tree[pos] & 0xFF);
+		for (uint32 i = code; i < (1U << table.bits); i += 1 << codeLength)
+			table.entries[i] = entry;
+		return;
 	}
 
-	debug(8, "=%02x\n", tree[pos] & 0xffff);
-	return tree[pos] & 0xFFFF;
+	assert(codeLength < table.bits);
+	fillTable(table, tree, tree[pos] >> 12, code, codeLength + 1);
+	fillTable(table, tree, tree[pos] & 0xFFF, code | (1 << codeLength), codeLength + 1);
+}
+
+int DecompressorDCL::huffmanLookup(const HuffmanTable &table) {
+	const uint16 entry = table.entries[peekBitsLSB(table.bits)];
+	getBitsLSB(entry >> 8);
+
+	debug(8, "=%02x\n", entry & 0xFF);
+	return entry & 0xFF;
 }
 
 #define DCL_BINARY_MODE 0
@@ -345,6 +391,10 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 
 	init(sourceStream, targetStream, targetSize, targetFixedSize);
 
+	HuffmanTable lengthTable, distanceTable, asciiTable;
+	buildTable(lengthTable, length_tree, 7);
+	buildTable(distanceTable, distance_tree, 8);
+
 	byte mode = getByteLSB();
 	byte dictionaryType = getByteLSB();
 
@@ -372,9 +422,12 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 	}
 	dictionaryMask = dictionarySize - 1;
 
+	if (mode == DCL_ASCII_MODE)
+		buildTable(asciiTable, ascii_tree, 13);
+
 	while ((!targetFixedSize) || (_bytesWritten < _targetSize)) {
 		if (getBitsLSB(1)) { // (length,distance) pair
-			value = huffman_lookup(length_tree);
+			value = huffmanLookup(lengthTable);
 
 			if (value < 8)
 				tokenLength = value + 2;
@@ -386,7 +439,7 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 
 			debug(8, " | ");
 
-			value = huffman_lookup(distance_tree);
+			value = huffmanLookup(distanceTable);
 
 			if (tokenLength == 2)
 				tokenOffset = (value << 2) | getBitsLSB(2);
@@ -435,7 +488,7 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 			debug(9, "\n");
 
 		} else { // Copy byte verbatim
-			value = (mode == DCL_ASCII_MODE) ? huffman_lookup(ascii_tree) : getByteLSB();
+			value = (mode == DCL_ASCII_MODE) ? huffmanLookup(asciiTable) : getByteLSB();
 			putByte(value);
 
 			// Also remember it inside dictionary
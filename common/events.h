@@ -341,9 +341,20 @@ public:
 	 * This takes the "autoFree" flag passed to registerObserver into account.
 	 */
 	void unregisterObserver(EventObserver *obs);
+
+	/**
+	 * Enables or disables coalescing of mouse motion.
+	 *
+	 * When enabled, consecutive EVENT_MOUSEMOVE events a source offers in
+	 * one dispatch() are merged into the last of them, so observers only
+	 * see the latest position. The mouse moves stay in order with the other
+	 * events of the source. This is disabled by default.
+	 */
+	void setCoalesceMouseMotion(bool enable) { _coalesceMouseMotion = enable; }
 private:
 	bool _autoFreeMapper;
 	EventMapper *_mapper;
+	bool _coalesceMouseMotion;
 
 	struct Entry {
 		bool autoFree;
@@ -364,6 +375,7 @@ private:
 	List<ObserverEntry> _observers;
 
 	void dispatchEvent(const Event &event);
+	void dispatchMapped(const Event &event, EventSource *source);
 	void dispatchPoll();
 };
 
@@ -31,6 +31,16 @@
 #include "common/util.h"
 #include "common/textconsole.h"
 
+// The radix-4 passes, which do the bulk of the work for larger transforms,
+// process two complex values at once where SSE or NEON are available.
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define FFT_USE_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FFT_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace Common {
 
 FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
@@ -173,11 +183,103 @@ static void name(Complex *z, const float *wre, unsigned int n) { \
 	} while(--n);\
 }
 
+#if defined(FFT_USE_SSE) || defined(FFT_USE_NEON)
+
+#ifdef FFT_USE_SSE
+typedef __m128 Vec4;
+#define VEC_LOAD(p)     _mm_loadu_ps(p)
+#define VEC_STORE(p, x) _mm_storeu_ps(p, x)
+#define VEC_SET(a, b)   _mm_set_ps(b, b, a, a)
+#define VEC_ADD(x, y)   _mm_add_ps(x, y)
+#define VEC_SUB(x, y)   _mm_sub_ps(x, y)
+#define VEC_MUL(x, y)   _mm_mul_ps(x, y)
+#define VEC_SWAP(x)     _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1))
+#define VEC_SIGNS(a, b) _mm_set_ps(b, a, b, a)
+#else
+typedef float32x4_t Vec4;
+#define VEC_LOAD(p)     vld1q_f32(p)
+#define VEC_STORE(p, x) vst1q_f32(p, x)
+#define VEC_ADD(x, y)   vaddq_f32(x, y)
+#define VEC_SUB(x, y)   vsubq_f32(x, y)
+#define VEC_MUL(x, y)   vmulq_f32(x, y)
+#define VEC_SWAP(x)     vrev64q_f32(x)
+
+static inline float32x4_t VEC_SET(float a, float b) {
+	const float v[4] = { a, a, b, b };
+	return vld1q_f32(v);
+}
+
+static inline float32x4_t VEC_SIGNS(float a, float b) {
+	const float v[4] = { a, b, a, b };
+	return vld1q_f32(v);
+}
+#endif
+
+/**
+ * TRANSFORM on z0..z3[0] and z0..z3[1] at once, with the twiddle factors
+ * (wre0, wim0) and (wre1, wim1) respectively. Each vector holds two
+ * complex values; the operations are the same as in the scalar version,
+ * so are the results.
+ */
+static inline void transform2(Complex *z0, Complex *z1, Complex *z2, Complex *z3,
+                              float wre0, float wim0, float wre1, float wim1) {
+	const Vec4 wre = VEC_SET(wre0, wre1);
+	const Vec4 wim = VEC_SET(wim0, wim1);
+	const Vec4 plusMinus = VEC_SIGNS(1.0f, -1.0f);
+	const Vec4 minusPlus = VEC_SIGNS(-1.0f, 1.0f);
+
+	const Vec4 a0 = VEC_LOAD(&z0->re);
+	const Vec4 a1 = VEC_LOAD(&z1->re);
+	const Vec4 a2 = VEC_LOAD(&z2->re);
+	const Vec4 a3 = VEC_LOAD(&z3->re);
+
+	// (t1, t2) and (t5, t6)
+	const Vec4 t12 = VEC_ADD(VEC_MUL(a2, wre), VEC_MUL(VEC_MUL(VEC_SWAP(a2), wim), plusMinus));
+	const Vec4 t56 = VEC_ADD(VEC_MUL(a3, wre), VEC_MUL(VEC_MUL(VEC_SWAP(a3), wim), minusPlus));
+
+	// (t1 + t5, t2 + t6) and (t5 - t1, t6 - t2) = (t3, -t4)
+	const Vec4 sum  = VEC_ADD(t12, t56);
+	const Vec4 diff = VEC_SUB(t56, t12);
+
+	// (t4, t3)
+	const Vec4 rot = VEC_MUL(VEC_SWAP(diff), minusPlus);
+
+	VEC_STORE(&z0->re, VEC_ADD(a0, sum));
+	VEC_STORE(&z2->re, VEC_SUB(a0, sum));
+	VEC_STORE(&z1->re, VEC_ADD(a1, rot));
+	VEC_STORE(&z3->re, VEC_SUB(a1, rot));
+}
+
+/* z[0...8n-1], w[1...2n-1] */
+static void pass(Complex *z, const float *wre, unsigned int n) {
+	const int o1 = 2 * n;
+	const int o2 = 4 * n;
+	const int o3 = 6 * n;
+	const float *wim = wre + o1;
+
+	// The first twiddle factor is exactly 1, as in TRANSFORM_ZERO
+	transform2(z, z + o1, z + o2, z + o3, 1.0f, 0.0f, wre[1], wim[-1]);
+
+	while (--n) {
+		z += 2;
+		wre += 2;
+		wim -= 2;
+		transform2(z, z + o1, z + o2, z + o3, wre[0], wim[0], wre[1], wim[-1]);
+	}
+}
+
+// All inputs are loaded before storing anyway
+#define pass_big pass
+
+#else
+
 PASS(pass)
 #undef BUTTERFLIES
 #define BUTTERFLIES BUTTERFLIES_BIG
 PASS(pass_big)
 
+#endif
+
 void FFT::fft4(Complex *z) {
 	float t1, t2, t3, t4, t5, t6, t7, t8;
 
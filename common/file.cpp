@@ -24,6 +24,7 @@
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/prefetch.h"
 #include "common/textconsole.h"
 #include "common/system.h"
 #include "backends/fs/fs-factory.h"
@@ -31,7 +32,7 @@
 namespace Common {
 
 File::File()
-	: _handle(nullptr) {
+	: _handle(nullptr), _prefetchFile(-1) {
 }
 
 File::~File() {
@@ -56,6 +57,11 @@ bool File::open(const String &filename, Archive &archive) {
 		debug(8, "Opening hashed: %s.", filename.c_str());
 	}
 
+	// Only files found through SearchMan can be looked up again when
+	// they are prefetched
+	if (stream && FilePrefetcher::isRecording() && &archive == &SearchMan)
+		_prefetchFile = FilePrefetchMan.recordOpen(filename);
+
 	return open(stream, filename);
 }
 
@@ -102,6 +108,7 @@ bool File::exists(const String &filename) {
 void File::close() {
 	delete _handle;
 	_handle = nullptr;
+	_prefetchFile = -1;
 }
 
 bool File::isOpen() const {
@@ -140,6 +147,12 @@ bool File::seek(int32 offs, int whence) {
 
 uint32 File::read(void *ptr, uint32 len) {
 	assert(_handle);
+	if (_prefetchFile >= 0 && FilePrefetcher::isRecording()) {
+		const int32 offset = _handle->pos();
+		const uint32 size = _handle->read(ptr, len);
+		FilePrefetchMan.recordRead(_prefetchFile, offset, size);
+		return size;
+	}
 	return _handle->read(ptr, len);
 }
 
@@ -172,7 +185,7 @@ bool DumpFile::open(const String &filename, bool createPath) {
 	return open(node);
 }
 
-bool DumpFile::open(const FSNode &node) {
+bool DumpFile::open(const FSNode &node, bool append) {
 	assert(!_handle);
 
 	if (node.isDirectory()) {
@@ -180,7 +193,7 @@ bool DumpFile::open(const FSNode &node) {
 		return false;
 	}
 
-	_handle = node.createWriteStream();
+	_handle = append ? node.createAppendStream() : node.createWriteStream();
 
 	if (_handle == nullptr)
 		debug(2, "File %s not found", node.getName().c_str());
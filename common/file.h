@@ -44,6 +44,9 @@ protected:
 	/** The name of this file, kept for debugging purposes. */
 	String _name;
 
+	/** The id of this file in the FilePrefetcher recording; -1 if not recorded. */
+	int _prefetchFile;
+
 public:
 	File();
 	virtual ~File();
@@ -144,7 +147,15 @@ public:
 	virtual ~DumpFile();
 
 	virtual bool open(const String &filename, bool createPath = false);
-	virtual bool open(const FSNode &node);
+
+	/**
+	 * Open the file referred by the node.
+	 *
+	 * @param append  Write at the end of an existing file instead of
+	 *                replacing it. This fails if the backend cannot
+	 *                append to files.
+	 */
+	virtual bool open(const FSNode &node, bool append = false);
 
 	virtual void close();
 
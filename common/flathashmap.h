@@ -0,0 +1,525 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// The layout of the hash map in this file follows the "Swiss table" design:
+// keys and values are stored inline in a flat slot array, next to an array of
+// one-byte control words which are probed eight at a time.
+
+#ifndef COMMON_FLATHASHMAP_H
+#define COMMON_FLATHASHMAP_H
+
+#include "common/scummsys.h"
+#include "common/endian.h"
+#include "common/func.h"
+
+namespace Common {
+
+/**
+ * FlatHashMap<Key,Val> is a drop-in alternative to HashMap<Key,Val> which
+ * uses open addressing with the nodes stored inline, instead of one pool
+ * allocated node per entry reached through a pointer array. This saves one
+ * indirection (and usually one cache miss) per lookup, at the cost of moving
+ * nodes around when the table grows.
+ *
+ * Every slot has a control byte which is either empty, deleted, or holds
+ * seven bits of the key's hash. Lookups compare a whole group of eight
+ * control bytes against the hash fragment using plain 64-bit arithmetic
+ * (SWAR), so the key comparison is only performed for likely candidates.
+ *
+ * The interface is the same as the one of HashMap: the nodes expose _key
+ * and _value, erasing entries while iterating is allowed, and the const
+ * getVal returns a default value for missing keys. Unlike HashMap, pointers
+ * and references to values are invalidated whenever new keys are inserted.
+ */
+template<class Key, class Val, class HashFunc = Hash<Key>, class EqualFunc = EqualTo<Key> >
+class FlatHashMap {
+public:
+	typedef uint size_type;
+
+	struct Node {
+		const Key _key;
+		Val _value;
+		explicit Node(const Key &key) : _key(key), _value() {}
+		Node(const Key &key, const Val &value) : _key(key), _value(value) {}
+	};
+
+private:
+	typedef FlatHashMap<Key, Val, HashFunc, EqualFunc> FHM_t;
+
+	enum {
+		FLATHASHMAP_MIN_CAPACITY = 16,
+		FLATHASHMAP_GROUP_WIDTH = 8,
+
+		// The table is rehashed once used and deleted slots together exceed
+		// this fraction of the capacity. It must stay below 1, as lookups
+		// rely on finding an empty slot to terminate.
+		FLATHASHMAP_LOADFACTOR_NUMERATOR = 7,
+		FLATHASHMAP_LOADFACTOR_DENOMINATOR = 8
+	};
+
+	enum {
+		kCtrlEmpty = 0x80,
+		kCtrlDeleted = 0xFE
+		// Values 0x00 - 0x7F mark a used slot and hold the hash fragment.
+	};
+
+	byte *_ctrl;		///< capacity + GROUP_WIDTH control bytes; the tail mirrors the head.
+	Node *_slots;		///< Uninitialized storage for capacity nodes.
+	size_type _mask;	///< Capacity of the map minus one; capacity is a power of two.
+	size_type _size;
+	size_type _deleted;	///< Number of slots marked kCtrlDeleted.
+
+	HashFunc _hash;
+	EqualFunc _equal;
+
+	/** Default value, returned by the const getVal. */
+	const Val _defaultVal;
+
+	static byte hashFragment(size_type hash) {
+		// Many of our hash functions (e.g. for integers) return the key
+		// as is, so mix the bits before taking the fragment from the top.
+		return (byte)((uint32)(hash * 0x9E3779B1U) >> 25);
+	}
+
+	static uint64 broadcast(byte value) {
+		// Spelled out to avoid relying on 64-bit literal suffixes.
+		return (uint64)value * (((uint64)0x01010101 << 32) | 0x01010101);
+	}
+
+	/** Returns a bitmask with bit 7 of byte n set if entry n of the group equals fragment. */
+	static uint64 matchFragment(uint64 group, byte fragment) {
+		const uint64 x = group ^ broadcast(fragment);
+		// May report false positives, these are filtered out by comparing keys.
+		return (x - broadcast(0x01)) & ~x & broadcast(0x80);
+	}
+
+	static uint64 matchEmpty(uint64 group) {
+		// kCtrlEmpty is the only control value with bit 7 set and bit 1 clear.
+		return group & ~(group << 6) & broadcast(0x80);
+	}
+
+	static uint64 matchEmptyOrDeleted(uint64 group) {
+		return group & broadcast(0x80);
+	}
+
+	/** Returns the index of the first byte flagged in a non-zero match mask. */
+	static uint firstMatch(uint64 match) {
+		uint idx = 0;
+		while (!(match & 0x80)) {
+			match >>= 8;
+			idx++;
+		}
+		return idx;
+	}
+
+	uint64 loadGroup(size_type pos) const {
+		return READ_LE_UINT64(_ctrl + pos);
+	}
+
+	void setCtrl(size_type idx, byte value) {
+		_ctrl[idx] = value;
+		// Groups starting near the end of the table wrap around into the
+		// mirrored bytes, which have to be kept in sync.
+		if (idx < FLATHASHMAP_GROUP_WIDTH)
+			_ctrl[_mask + 1 + idx] = value;
+	}
+
+	bool isUsed(size_type idx) const {
+		return !(_ctrl[idx] & 0x80);
+	}
+
+	void allocStorage(size_type capacity);
+	void freeStorage();
+	size_type lookup(const Key &key) const;
+	size_type findInsertSlot(size_type hash) const;
+	size_type lookupAndCreateIfMissing(const Key &key);
+	void rehash(size_type newCapacity);
+	void assign(const FHM_t &map);
+
+	template<class NodeType>
+	class IteratorImpl {
+		friend class FlatHashMap;
+		template<class T> friend class IteratorImpl;
+	protected:
+		typedef const FlatHashMap hashmap_t;
+
+		size_type _idx;
+		hashmap_t *_hashmap;
+
+	protected:
+		IteratorImpl(size_type idx, hashmap_t *hashmap) : _idx(idx), _hashmap(hashmap) {}
+
+		NodeType *deref() const {
+			assert(_hashmap != nullptr);
+			assert(_idx <= _hashmap->_mask);
+			assert(_hashmap->isUsed(_idx));
+			return &_hashmap->_slots[_idx];
+		}
+
+	public:
+		IteratorImpl() : _idx(0), _hashmap(nullptr) {}
+		template<class T>
+		IteratorImpl(const IteratorImpl<T> &c) : _idx(c._idx), _hashmap(c._hashmap) {}
+
+		NodeType &operator*() const { return *deref(); }
+		NodeType *operator->() const { return deref(); }
+
+		bool operator==(const IteratorImpl &iter) const { return _idx == iter._idx && _hashmap == iter._hashmap; }
+		bool operator!=(const IteratorImpl &iter) const { return !(*this == iter); }
+
+		IteratorImpl &operator++() {
+			assert(_hashmap);
+			do {
+				_idx++;
+			} while (_idx <= _hashmap->_mask && !_hashmap->isUsed(_idx));
+			if (_idx > _hashmap->_mask)
+				_idx = (size_type)-1;
+
+			return *this;
+		}
+
+		IteratorImpl operator++(int) {
+			IteratorImpl old = *this;
+			operator ++();
+			return old;
+		}
+	};
+
+public:
+	typedef IteratorImpl<Node> iterator;
+	typedef IteratorImpl<const Node> const_iterator;
+
+	FlatHashMap();
+	FlatHashMap(const FHM_t &map);
+	~FlatHashMap();
+
+	FHM_t &operator=(const FHM_t &map) {
+		if (this == &map)
+			return *this;
+
+		freeStorage();
+		assign(map);
+		return *this;
+	}
+
+	bool contains(const Key &key) const;
+
+	Val &operator[](const Key &key);
+	const Val &operator[](const Key &key) const;
+
+	Val &getVal(const Key &key);
+	const Val &getVal(const Key &key) const;
+	const Val &getVal(const Key &key, const Val &defaultVal) const;
+	void setVal(const Key &key, const Val &val);
+
+	void clear(bool shrinkArray = 0);
+
+	void erase(iterator entry);
+	void erase(const Key &key);
+
+	size_type size() const { return _size; }
+
+	iterator	begin() {
+		for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+			if (isUsed(ctr))
+				return iterator(ctr, this);
+		}
+		return end();
+	}
+	iterator	end() {
+		return iterator((size_type)-1, this);
+	}
+
+	const_iterator	begin() const {
+		for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+			if (isUsed(ctr))
+				return const_iterator(ctr, this);
+		}
+		return end();
+	}
+	const_iterator	end() const {
+		return const_iterator((size_type)-1, this);
+	}
+
+	iterator	find(const Key &key) {
+		return iterator(lookup(key), this);
+	}
+
+	const_iterator	find(const Key &key) const {
+		return const_iterator(lookup(key), this);
+	}
+
+	bool empty() const {
+		return (_size == 0);
+	}
+};
+
+//-------------------------------------------------------
+// FlatHashMap functions
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+FlatHashMap<Key, Val, HashFunc, EqualFunc>::FlatHashMap() : _defaultVal() {
+	allocStorage(FLATHASHMAP_MIN_CAPACITY);
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+FlatHashMap<Key, Val, HashFunc, EqualFunc>::FlatHashMap(const FHM_t &map) : _defaultVal() {
+	assign(map);
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+FlatHashMap<Key, Val, HashFunc, EqualFunc>::~FlatHashMap() {
+	freeStorage();
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::allocStorage(size_type capacity) {
+	assert(capacity >= FLATHASHMAP_MIN_CAPACITY && (capacity & (capacity - 1)) == 0);
+
+	_mask = capacity - 1;
+	_ctrl = new byte[capacity + FLATHASHMAP_GROUP_WIDTH];
+	assert(_ctrl != nullptr);
+	memset(_ctrl, kCtrlEmpty, capacity + FLATHASHMAP_GROUP_WIDTH);
+	_slots = (Node *)malloc(capacity * sizeof(Node));
+	assert(_slots != nullptr);
+
+	_size = 0;
+	_deleted = 0;
+}
+
+/**
+ * Destroys all nodes and releases the storage.
+ *
+ * @note The map is left without storage -- the caller is responsible
+ *       for allocating new storage again!
+ */
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::freeStorage() {
+	for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+		if (isUsed(ctr))
+			_slots[ctr].~Node();
+	}
+
+	delete[] _ctrl;
+	free(_slots);
+	_ctrl = nullptr;
+	_slots = nullptr;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::assign(const FHM_t &map) {
+	allocStorage(map._mask + 1);
+
+	// The capacity is the same, so the layout can be copied verbatim.
+	memcpy(_ctrl, map._ctrl, _mask + 1 + FLATHASHMAP_GROUP_WIDTH);
+	for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+		if (isUsed(ctr))
+			new ((void *)&_slots[ctr]) Node(map._slots[ctr]._key, map._slots[ctr]._value);
+	}
+	_size = map._size;
+	_deleted = map._deleted;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::clear(bool shrinkArray) {
+	if (shrinkArray && _mask >= FLATHASHMAP_MIN_CAPACITY) {
+		freeStorage();
+		allocStorage(FLATHASHMAP_MIN_CAPACITY);
+		return;
+	}
+
+	for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+		if (isUsed(ctr))
+			_slots[ctr].~Node();
+	}
+	memset(_ctrl, kCtrlEmpty, _mask + 1 + FLATHASHMAP_GROUP_WIDTH);
+
+	_size = 0;
+	_deleted = 0;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::rehash(size_type newCapacity) {
+#ifndef NDEBUG
+	const size_type old_size = _size;
+#endif
+	const size_type old_mask = _mask;
+	byte *old_ctrl = _ctrl;
+	Node *old_slots = _slots;
+
+	allocStorage(newCapacity);
+
+	for (size_type ctr = 0; ctr <= old_mask; ++ctr) {
+		if (old_ctrl[ctr] & 0x80)
+			continue;
+
+		// All keys are unique, so we can skip the key comparisons and
+		// directly look for a free slot.
+		const size_type hash = _hash(old_slots[ctr]._key);
+		const size_type idx = findInsertSlot(hash);
+		setCtrl(idx, hashFragment(hash));
+		new ((void *)&_slots[idx]) Node(old_slots[ctr]._key, old_slots[ctr]._value);
+		old_slots[ctr].~Node();
+		_size++;
+	}
+
+	assert(_size == old_size);
+
+	delete[] old_ctrl;
+	free(old_slots);
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+typename FlatHashMap<Key, Val, HashFunc, EqualFunc>::size_type FlatHashMap<Key, Val, HashFunc, EqualFunc>::lookup(const Key &key) const {
+	const size_type hash = _hash(key);
+	const byte fragment = hashFragment(hash);
+	size_type pos = hash & _mask;
+
+	// Triangular probing over groups visits every group once the capacity
+	// is a power of two.
+	for (size_type step = FLATHASHMAP_GROUP_WIDTH; ; step += FLATHASHMAP_GROUP_WIDTH) {
+		const uint64 group = loadGroup(pos);
+		for (uint64 match = matchFragment(group, fragment); match; match &= match - 1) {
+			const size_type idx = (pos + firstMatch(match)) & _mask;
+			if (isUsed(idx) && _equal(_slots[idx]._key, key))
+				return idx;
+		}
+		if (matchEmpty(group))
+			return (size_type)-1;
+		pos = (pos + step) & _mask;
+	}
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+typename FlatHashMap<Key, Val, HashFunc, EqualFunc>::size_type FlatHashMap<Key, Val, HashFunc, EqualFunc>::findInsertSlot(size_type hash) const {
+	size_type pos = hash & _mask;
+	for (size_type step = FLATHASHMAP_GROUP_WIDTH; ; step += FLATHASHMAP_GROUP_WIDTH) {
+		const uint64 match = matchEmptyOrDeleted(loadGroup(pos));
+		if (match)
+			return (pos + firstMatch(match)) & _mask;
+		pos = (pos + step) & _mask;
+	}
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+typename FlatHashMap<Key, Val, HashFunc, EqualFunc>::size_type FlatHashMap<Key, Val, HashFunc, EqualFunc>::lookupAndCreateIfMissing(const Key &key) {
+	size_type ctr = lookup(key);
+	if (ctr != (size_type)-1)
+		return ctr;
+
+	// Keep the load factor below a certain threshold. Deleted slots are
+	// also counted, since they lengthen the probe sequences just the same.
+	size_type capacity = _mask + 1;
+	if ((_size + _deleted + 1) * FLATHASHMAP_LOADFACTOR_DENOMINATOR >
+	        capacity * FLATHASHMAP_LOADFACTOR_NUMERATOR) {
+		// If the table is mostly filled with tombstones, rehashing at the
+		// current capacity is enough to get rid of them.
+		if ((_size + 1) * 2 * FLATHASHMAP_LOADFACTOR_DENOMINATOR >
+		        capacity * FLATHASHMAP_LOADFACTOR_NUMERATOR)
+			capacity = capacity < 500 ? (capacity * 4) : (capacity * 2);
+		rehash(capacity);
+	}
+
+	const size_type hash = _hash(key);
+	ctr = findInsertSlot(hash);
+	if (_ctrl[ctr] == kCtrlDeleted)
+		_deleted--;
+	setCtrl(ctr, hashFragment(hash));
+	new ((void *)&_slots[ctr]) Node(key);
+	_size++;
+
+	return ctr;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+bool FlatHashMap<Key, Val, HashFunc, EqualFunc>::contains(const Key &key) const {
+	return lookup(key) != (size_type)-1;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+Val &FlatHashMap<Key, Val, HashFunc, EqualFunc>::operator[](const Key &key) {
+	return getVal(key);
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+const Val &FlatHashMap<Key, Val, HashFunc, EqualFunc>::operator[](const Key &key) const {
+	return getVal(key);
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+Val &FlatHashMap<Key, Val, HashFunc, EqualFunc>::getVal(const Key &key) {
+	// Fetch the index first, as creating the key may reallocate _slots.
+	const size_type ctr = lookupAndCreateIfMissing(key);
+	return _slots[ctr]._value;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+const Val &FlatHashMap<Key, Val, HashFunc, EqualFunc>::getVal(const Key &key) const {
+	return getVal(key, _defaultVal);
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+const Val &FlatHashMap<Key, Val, HashFunc, EqualFunc>::getVal(const Key &key, const Val &defaultVal) const {
+	const size_type ctr = lookup(key);
+	if (ctr != (size_type)-1)
+		return _slots[ctr]._value;
+	else
+		return defaultVal;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::setVal(const Key &key, const Val &val) {
+	const size_type ctr = lookupAndCreateIfMissing(key);
+	_slots[ctr]._value = val;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::erase(iterator entry) {
+	// Check whether we have a valid iterator
+	assert(entry._hashmap == this);
+	const size_type ctr = entry._idx;
+	assert(ctr <= _mask);
+	assert(isUsed(ctr));
+
+	// The slot is marked as deleted rather than empty, so that probe
+	// sequences passing through it are not cut short.
+	_slots[ctr].~Node();
+	setCtrl(ctr, kCtrlDeleted);
+	_size--;
+	_deleted++;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::erase(const Key &key) {
+	const size_type ctr = lookup(key);
+	if (ctr == (size_type)-1)
+		return;
+
+	_slots[ctr].~Node();
+	setCtrl(ctr, kCtrlDeleted);
+	_size--;
+	_deleted++;
+}
+
+} // End of namespace Common
+
+#endif
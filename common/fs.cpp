@@ -140,6 +140,21 @@ SeekableReadStream *FSNode::createReadStream() const {
 	return _realNode->createReadStream();
 }
 
+SeekableReadStream *FSNode::createMappedReadStream() const {
+	if (_realNode == nullptr)
+		return nullptr;
+
+	if (!_realNode->exists()) {
+		warning("FSNode::createMappedReadStream: '%s' does not exist", getName().c_str());
+		return nullptr;
+	} else if (_realNode->isDirectory()) {
+		warning("FSNode::createMappedReadStream: '%s' is a directory", getName().c_str());
+		return nullptr;
+	}
+
+	return _realNode->createMappedReadStream();
+}
+
 WriteStream *FSNode::createWriteStream() const {
 	if (_realNode == nullptr)
 		return nullptr;
@@ -152,6 +167,18 @@ WriteStream *FSNode::createWriteStream() const {
 	return _realNode->createWriteStream();
 }
 
+WriteStream *FSNode::createAppendStream() const {
+	if (_realNode == nullptr)
+		return nullptr;
+
+	if (_realNode->isDirectory()) {
+		warning("FSNode::createAppendStream: '%s' is a directory", getName().c_str());
+		return nullptr;
+	}
+
+	return _realNode->createAppendStream();
+}
+
 FSDirectory::FSDirectory(const FSNode &node, int depth, bool flat)
   : _node(node), _cached(false), _depth(depth), _flat(flat) {
 }
@@ -191,8 +218,9 @@ FSNode *FSDirectory::lookupCache(NodeCache &cache, const String &name) const {
 	if (!name.empty()) {
 		ensureCached();
 
-		if (cache.contains(name))
-			return &cache[name];
+		NodeCache::iterator it = cache.find(name);
+		if (it != cache.end())
+			return &it->_value;
 	}
 
 	return nullptr;
@@ -206,6 +234,16 @@ bool FSDirectory::hasFile(const String &name) const {
 	return node && node->exists();
 }
 
+bool FSDirectory::hasFileAtom(const Atom &name) const {
+	if (name.empty() || !_node.isDirectory())
+		return false;
+
+	ensureCached();
+
+	NodeCache::const_iterator it = _fileCache.findWithHash(name.str(), name.hashLower());
+	return it != _fileCache.end() && it->_value.exists();
+}
+
 const ArchiveMemberPtr FSDirectory::getMember(const String &name) const {
 	if (name.empty() || !_node.isDirectory())
 		return ArchiveMemberPtr();
@@ -222,6 +222,19 @@ public:
 	 */
 	virtual SeekableReadStream *createReadStream() const;
 
+	/**
+	 * Creates a SeekableReadStream instance corresponding to the file
+	 * referred by this node, which reads straight from a memory mapping of
+	 * the file where the backend supports it. This avoids the intermediate
+	 * copies of buffered reads, and sub streams of the result are served
+	 * without any copies at all; this makes it a good fit for big archive
+	 * files. If the file cannot be mapped, this behaves like
+	 * createReadStream().
+	 *
+	 * @return pointer to the stream object, 0 in case of a failure
+	 */
+	SeekableReadStream *createMappedReadStream() const;
+
 	/**
 	 * Creates a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
@@ -230,6 +243,16 @@ public:
 	 * @return pointer to the stream object, 0 in case of a failure
 	 */
 	WriteStream *createWriteStream() const;
+
+	/**
+	 * Creates a WriteStream instance which appends to the file referred by
+	 * this node, creating it if needed. Not all backends support this, in
+	 * which case 0 is returned and the file has to be written anew with
+	 * createWriteStream().
+	 *
+	 * @return pointer to the stream object, 0 in case of a failure
+	 */
+	WriteStream *createAppendStream() const;
 };
 
 /**
@@ -326,8 +349,15 @@ public:
 	 * Checks for existence in the cache. A full match of relative path and filename is needed
 	 * for success.
 	 */
+	using Archive::hasFile;
 	virtual bool hasFile(const String &name) const;
 
+	/**
+	 * Same as hasFile(), but reuses the case insensitive hash stored in the
+	 * atom for the cache lookup.
+	 */
+	virtual bool hasFileAtom(const Atom &name) const;
+
 	/**
 	 * Returns a list of matching file names. Pattern can use GLOB wildcards.
 	 */
@@ -149,7 +149,8 @@ private:
 	}
 
 	void assign(const HM_t &map);
-	size_type lookup(const Key &key) const;
+	size_type lookup(const Key &key) const { return lookup(key, _hash(key)); }
+	size_type lookup(const Key &key, size_type hash) const;
 	size_type lookupAndCreateIfMissing(const Key &key);
 	void expandStorage(size_type newCapacity);
 
@@ -290,6 +291,29 @@ public:
 		return end();
 	}
 
+	/**
+	 * Variants of contains() and find() for callers which already know the
+	 * hash of the key, e.g. because it was precomputed by Common::Atom.
+	 * The given hash must be the one HashFunc would compute for the key.
+	 */
+	bool containsWithHash(const Key &key, size_type hash) const {
+		return _storage[lookup(key, hash)] != nullptr;
+	}
+
+	iterator	findWithHash(const Key &key, size_type hash) {
+		size_type ctr = lookup(key, hash);
+		if (_storage[ctr])
+			return iterator(ctr, this);
+		return end();
+	}
+
+	const_iterator	findWithHash(const Key &key, size_type hash) const {
+		size_type ctr = lookup(key, hash);
+		if (_storage[ctr])
+			return const_iterator(ctr, this);
+		return end();
+	}
+
 	// TODO: insert() method?
 
 	bool empty() const {
@@ -463,8 +487,7 @@ void HashMap<Key, Val, HashFunc, EqualFunc>::expandStorage(size_type newCapacity
 }
 
 template<class Key, class Val, class HashFunc, class EqualFunc>
-typename HashMap<Key, Val, HashFunc, EqualFunc>::size_type HashMap<Key, Val, HashFunc, EqualFunc>::lookup(const Key &key) const {
-	const size_type hash = _hash(key);
+typename HashMap<Key, Val, HashFunc, EqualFunc>::size_type HashMap<Key, Val, HashFunc, EqualFunc>::lookup(const Key &key, size_type hash) const {
 	size_type ctr = hash & _mask;
 	for (size_type perturb = hash; ; perturb >>= HASHMAP_PERTURB_SHIFT) {
 		if (_storage[ctr] == nullptr)
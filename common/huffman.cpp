@@ -58,6 +58,9 @@ Huffman::Huffman(uint8 maxLength, uint32 codeCount, const uint32 *codes, const u
 		// And put the pointer to the symbol/code struct into the symbol list.
 		_symbols[i] = &_codes[lengths[i] - 1].back();
 	}
+
+	_lookupBits = MIN<uint8>(maxLength, kMaxLookupBits);
+	buildLookupTables();
 }
 
 Huffman::~Huffman() {
@@ -66,6 +69,44 @@ Huffman::~Huffman() {
 void Huffman::setSymbols(const uint32 *symbols) {
 	for (uint32 i = 0; i < _symbols.size(); i++)
 		_symbols[i]->symbol = symbols ? *symbols++ : i;
+
+	buildLookupTables();
+}
+
+void Huffman::buildLookupTables() {
+	const uint32 tableSize = 1 << _lookupBits;
+
+	_lookupMSB.clear();
+	_lookupMSB.resize(tableSize);
+	_lookupLSB.clear();
+	_lookupLSB.resize(tableSize);
+
+	// Going through the codes by length and only filling empty entries
+	// keeps the priorities of the bit-by-bit search in getSymbol().
+	for (uint8 length = 1; length <= _lookupBits; length++) {
+		const uint32 fill = 1 << (_lookupBits - length);
+
+		for (CodeList::const_iterator cCode = _codes[length - 1].begin(); cCode != _codes[length - 1].end(); ++cCode) {
+			if (cCode->code >= (1u << length))
+				continue;
+
+			for (uint32 i = 0; i < fill; i++) {
+				// MSB first: the code makes up the top bits of the index.
+				// LSB first: the code makes up the bottom bits of the index.
+				LookupEntry &msb = _lookupMSB[(cCode->code << (_lookupBits - length)) | i];
+				LookupEntry &lsb = _lookupLSB[cCode->code | (i << length)];
+
+				if (msb.length == 0) {
+					msb.symbol = cCode->symbol;
+					msb.length = length;
+				}
+				if (lsb.length == 0) {
+					lsb.symbol = cCode->symbol;
+					lsb.length = length;
+				}
+			}
+		}
+	}
 }
 
 } // End of namespace Common
@@ -56,6 +56,16 @@ public:
 	/** Return the next symbol in the bitstream. */
 	template<class BITSTREAM>
 	uint32 getSymbol(BITSTREAM &bits) const {
+		// Short codes are resolved with a single table lookup
+		if (_lookupBits > 0) {
+			const LookupTable &table = BITSTREAM::isMSBFirst() ? _lookupMSB : _lookupLSB;
+			const LookupEntry &entry = table[bits.peekBits(_lookupBits)];
+			if (entry.length > 0) {
+				bits.skip(entry.length);
+				return entry.symbol;
+			}
+		}
+
 		uint32 code = 0;
 
 		for (uint32 i = 0; i < _codes.size(); i++) {
@@ -87,6 +97,29 @@ private:
 
 	/** Sorted list of pointers to the symbols. */
 	SymbolList _symbols;
+
+	enum {
+		kMaxLookupBits = 10	///< Maximum number of bits resolved by the lookup tables.
+	};
+
+	struct LookupEntry {
+		uint32 symbol;
+		uint8 length;	///< Length of the code, or 0 if the code is longer than _lookupBits.
+	};
+
+	typedef Array<LookupEntry> LookupTable;
+
+	/** Number of bits looked up at once, the smaller of maxLength and kMaxLookupBits. */
+	uint8 _lookupBits;
+
+	/**
+	 * Tables mapping the next _lookupBits bits in the stream to the symbol
+	 * they start with, for streams handing out the MSB or the LSB first.
+	 */
+	LookupTable _lookupMSB;
+	LookupTable _lookupLSB;
+
+	void buildLookupTables();
 };
 
 } // End of namespace Common
@@ -0,0 +1,298 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/jobs.h"
+#include "common/util.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(JobSystem);
+
+JobSystem::JobSystem()
+	: _initialized(false), _quit(false), _mutex(0), _wakeSem(0), _nextWorker(0) {
+}
+
+JobSystem::~JobSystem() {
+	if (_workers.empty())
+		return;
+
+	g_system->lockMutex(_mutex);
+	_quit = true;
+	g_system->unlockMutex(_mutex);
+
+	for (uint i = 0; i < _workers.size(); ++i)
+		g_system->postSemaphore(_wakeSem);
+
+	// Workers may still be looking at each other's queues until they have
+	// all seen _quit, so only free the queues once every thread is gone.
+	for (uint i = 0; i < _workers.size(); ++i)
+		g_system->joinThread(_workers[i]->thread);
+
+	for (uint i = 0; i < _workers.size(); ++i) {
+		Worker *w = _workers[i];
+		assert(w->count == 0);
+		g_system->deleteMutex(w->mutex);
+		delete w;
+	}
+
+	g_system->deleteSemaphore(_wakeSem);
+	g_system->deleteMutex(_mutex);
+}
+
+void JobSystem::init() {
+	_initialized = true;
+
+	if (!g_system)
+		return;
+
+	const uint numWorkers = g_system->getCPUCount() - 1;
+	if (numWorkers == 0)
+		return;
+
+	_wakeSem = g_system->createSemaphore(0);
+	if (!_wakeSem)
+		return;
+	_mutex = g_system->createMutex();
+
+	// The workers only start looking at _workers once they have been
+	// woken up by the first submit(), so it is safe to grow the array here.
+	_workers.reserve(numWorkers);
+	for (uint i = 0; i < numWorkers; ++i) {
+		Worker *w = new Worker;
+		w->owner = this;
+		w->index = i;
+		w->mutex = g_system->createMutex();
+		w->jobs.resize(16);
+		w->head = 0;
+		w->count = 0;
+
+		w->thread = g_system->createThread(workerProc, w);
+		if (!w->thread) {
+			g_system->deleteMutex(w->mutex);
+			delete w;
+			break;
+		}
+		_workers.push_back(w);
+	}
+
+	if (_workers.empty()) {
+		g_system->deleteSemaphore(_wakeSem);
+		g_system->deleteMutex(_mutex);
+		_wakeSem = 0;
+		_mutex = 0;
+	}
+}
+
+uint JobSystem::getWorkerCount() {
+	if (!_initialized)
+		init();
+	return _workers.size();
+}
+
+void JobSystem::pushBack(Worker *w, const Job &job) {
+	if (w->count == w->jobs.size()) {
+		// Unroll the ring buffer into a buffer twice the size.
+		Array<Job> jobs;
+		jobs.resize(w->jobs.size() * 2);
+		for (uint i = 0; i < w->count; ++i)
+			jobs[i] = w->jobs[(w->head + i) & (w->jobs.size() - 1)];
+		w->jobs = jobs;
+		w->head = 0;
+	}
+
+	w->jobs[(w->head + w->count) & (w->jobs.size() - 1)] = job;
+	w->count++;
+}
+
+bool JobSystem::popBack(Worker *w, Job &job) {
+	if (w->count == 0)
+		return false;
+	w->count--;
+	job = w->jobs[(w->head + w->count) & (w->jobs.size() - 1)];
+	return true;
+}
+
+bool JobSystem::popFront(Worker *w, Job &job) {
+	if (w->count == 0)
+		return false;
+	job = w->jobs[w->head];
+	w->head = (w->head + 1) & (w->jobs.size() - 1);
+	w->count--;
+	return true;
+}
+
+void JobSystem::submit(JobProc proc, void *param, Counter &counter) {
+	if (!_initialized)
+		init();
+
+	if (_workers.empty()) {
+		proc(param);
+		return;
+	}
+
+	Job job;
+	job.proc = proc;
+	job.param = param;
+	job.counter = &counter;
+
+	g_system->lockMutex(_mutex);
+	counter._pending++;
+	Worker *w = _workers[_nextWorker];
+	_nextWorker = (_nextWorker + 1) % _workers.size();
+	g_system->unlockMutex(_mutex);
+
+	g_system->lockMutex(w->mutex);
+	pushBack(w, job);
+	g_system->unlockMutex(w->mutex);
+
+	g_system->postSemaphore(_wakeSem);
+}
+
+bool JobSystem::runQueuedJob(uint first) {
+	// The most recently queued job of our own queue is likely still hot in
+	// the cache; jobs taken from other queues are the oldest ones.
+	for (uint i = 0; i < _workers.size(); ++i) {
+		Worker *w = _workers[(first + i) % _workers.size()];
+		Job job;
+
+		g_system->lockMutex(w->mutex);
+		const bool found = (i == 0) ? popBack(w, job) : popFront(w, job);
+		g_system->unlockMutex(w->mutex);
+
+		if (found) {
+			runJob(job);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void JobSystem::runJob(const Job &job) {
+	job.proc(job.param);
+
+	g_system->lockMutex(_mutex);
+	Counter *counter = job.counter;
+	assert(counter->_pending > 0);
+	if (--counter->_pending == 0 && counter->_sem)
+		g_system->postSemaphore(counter->_sem);
+	g_system->unlockMutex(_mutex);
+}
+
+void JobSystem::wait(Counter &counter) {
+	if (_workers.empty())
+		return;
+
+	// Help out until there is nothing left to steal...
+	uint first = 0;
+	for (;;) {
+		g_system->lockMutex(_mutex);
+		const uint pending = counter._pending;
+		first = _nextWorker;
+		g_system->unlockMutex(_mutex);
+
+		if (pending == 0)
+			return;
+		if (!runQueuedJob(first))
+			break;
+	}
+
+	// ...then block until the remaining jobs, which are all running on
+	// workers by now, have finished.
+	g_system->lockMutex(_mutex);
+	if (counter._pending == 0) {
+		g_system->unlockMutex(_mutex);
+		return;
+	}
+	assert(!counter._sem);
+	OSystem::SemaphoreRef sem = g_system->createSemaphore(0);
+	counter._sem = sem;
+	g_system->unlockMutex(_mutex);
+
+	g_system->waitSemaphore(sem);
+
+	g_system->lockMutex(_mutex);
+	counter._sem = 0;
+	g_system->unlockMutex(_mutex);
+	g_system->deleteSemaphore(sem);
+}
+
+namespace {
+
+struct RangeJob {
+	JobSystem::RangeProc proc;
+	void *param;
+	uint begin;
+	uint end;
+};
+
+void runRangeJob(void *param) {
+	RangeJob *job = (RangeJob *)param;
+	job->proc(job->param, job->begin, job->end);
+}
+
+} // End of anonymous namespace
+
+void JobSystem::parallelFor(uint begin, uint end, uint grainSize, RangeProc proc, void *param) {
+	if (end <= begin)
+		return;
+
+	grainSize = MAX<uint>(grainSize, 1);
+	if (end - begin <= grainSize || getWorkerCount() == 0) {
+		proc(param, begin, end);
+		return;
+	}
+
+	Array<RangeJob> jobs;
+	jobs.resize((end - begin + grainSize - 1) / grainSize);
+	for (uint i = 0; i < jobs.size(); ++i) {
+		jobs[i].proc = proc;
+		jobs[i].param = param;
+		jobs[i].begin = begin + i * grainSize;
+		jobs[i].end = MIN(jobs[i].begin + grainSize, end);
+	}
+
+	Counter counter;
+	for (uint i = 0; i < jobs.size(); ++i)
+		submit(runRangeJob, &jobs[i], counter);
+	wait(counter);
+}
+
+void JobSystem::workerProc(void *param) {
+	Worker *self = (Worker *)param;
+	JobSystem *owner = self->owner;
+
+	for (;;) {
+		g_system->waitSemaphore(owner->_wakeSem);
+
+		g_system->lockMutex(owner->_mutex);
+		const bool quit = owner->_quit;
+		g_system->unlockMutex(owner->_mutex);
+		if (quit)
+			break;
+
+		while (owner->runQueuedJob(self->index))
+			;
+	}
+}
+
+} // End of namespace Common
@@ -0,0 +1,142 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_JOBS_H
+#define COMMON_JOBS_H
+
+#include "common/scummsys.h"
+#include "common/array.h"
+#include "common/noncopyable.h"
+#include "common/singleton.h"
+#include "common/system.h"
+
+namespace Common {
+
+/**
+ * A pool of worker threads for running small, independent jobs in
+ * parallel, e.g. decoding the rows of a video frame or scaling the strips
+ * of a surface.
+ *
+ * Every worker owns a queue of jobs. Submitted jobs are spread over the
+ * queues in turn; a worker takes jobs from the back of its own queue, and
+ * once that runs dry it steals from the front of the other queues, which
+ * keeps all cores busy even if the jobs take very different amounts of
+ * time. A thread waiting for a counter helps by running queued jobs too.
+ *
+ * The workers are created on first use, one less than the number of CPU
+ * cores reported by OSystem::getCPUCount(). If the backend does not
+ * support threads, or there is only one core, every job runs immediately
+ * on the submitting thread, so callers never need a separate code path.
+ *
+ * Jobs may submit further jobs and wait for them. All counters must have
+ * been waited for before the job system is destroyed.
+ */
+class JobSystem : public Singleton<JobSystem> {
+public:
+	typedef void (*JobProc)(void *param);
+	typedef void (*RangeProc)(void *param, uint begin, uint end);
+
+	/**
+	 * Tracks a group of submitted jobs. Pass it to wait() to block until
+	 * all of them have finished. Only one thread may wait on a counter
+	 * at a time.
+	 */
+	class Counter : Common::NonCopyable {
+	public:
+		Counter() : _pending(0), _sem(0) {}
+		~Counter() { assert(_pending == 0); }
+
+	private:
+		friend class JobSystem;
+
+		uint _pending;
+		OSystem::SemaphoreRef _sem;	///< Only set while a thread is blocked in wait().
+	};
+
+	/**
+	 * Queue proc(param) for execution on a worker thread.
+	 * @param counter	incremented now, decremented once the job has run
+	 */
+	void submit(JobProc proc, void *param, Counter &counter);
+
+	/**
+	 * Wait until all jobs associated with the counter have finished. The
+	 * calling thread runs queued jobs while it waits.
+	 */
+	void wait(Counter &counter);
+
+	/**
+	 * Call proc(param, b, e) for consecutive subranges [b, e) covering
+	 * [begin, end), each at most grainSize long, and wait until all of
+	 * them have finished. Subranges may run in any order and in parallel.
+	 */
+	void parallelFor(uint begin, uint end, uint grainSize, RangeProc proc, void *param);
+
+	/** Return the number of worker threads; 0 if all jobs run inline. */
+	uint getWorkerCount();
+
+private:
+	friend class Singleton<SingletonBaseType>;
+	JobSystem();
+	~JobSystem();
+
+	struct Job {
+		JobProc proc;
+		void *param;
+		Counter *counter;
+	};
+
+	/** A worker thread and its double-ended job queue, guarded by a mutex. */
+	struct Worker {
+		JobSystem *owner;
+		uint index;
+		OSystem::ThreadRef thread;
+		OSystem::MutexRef mutex;
+
+		Array<Job> jobs;	///< Ring buffer, its size is always a power of two.
+		uint head;
+		uint count;
+	};
+
+	bool _initialized;
+	bool _quit;
+	Array<Worker *> _workers;
+	OSystem::MutexRef _mutex;		///< Guards counters, _nextWorker and _quit.
+	OSystem::SemaphoreRef _wakeSem;	///< Posted once for every submitted job.
+	uint _nextWorker;
+
+	void init();
+	bool runQueuedJob(uint first);
+	void runJob(const Job &job);
+
+	static void pushBack(Worker *w, const Job &job);
+	static bool popBack(Worker *w, Job &job);
+	static bool popFront(Worker *w, Job &job);
+	static void workerProc(void *param);
+};
+
+} // End of namespace Common
+
+/** Shortcut for accessing the job system. */
+#define JobMan		Common::JobSystem::instance()
+
+#endif
@@ -46,9 +46,11 @@ namespace Common {
 #define MBI_RFLEN 87
 #define MAXNAMELEN 63
 
-MacResManager::MacResManager() {
-	memset(this, 0, sizeof(MacResManager));
-	close();
+MacResManager::MapCache *MacResManager::_mapCache = nullptr;
+
+MacResManager::MacResManager() : _stream(nullptr), _mode(kResForkNone), _resForkOffset(-1), _resForkSize(0),
+		_dataOffset(0), _dataLength(0), _mapOffset(0), _mapLength(0), _resTypes(nullptr), _resLists(nullptr) {
+	memset(&_resMap, 0, sizeof(_resMap));
 }
 
 MacResManager::~MacResManager() {
@@ -59,20 +61,19 @@ void MacResManager::close() {
 	_resForkOffset = -1;
 	_mode = kResForkNone;
 
-	for (int i = 0; i < _resMap.numTypes; i++) {
-		for (int j = 0; j < _resTypes[i].items; j++)
-			if (_resLists[i][j].nameOffset != -1)
-				delete[] _resLists[i][j].name;
-
-		delete[] _resLists[i];
-	}
-
-	delete[] _resLists; _resLists = nullptr;
-	delete[] _resTypes; _resTypes = nullptr;
+	_map.reset();
+	_mapCacheKey.clear();
+	_resLists = nullptr;
+	_resTypes = nullptr;
 	delete _stream; _stream = nullptr;
 	_resMap.numTypes = 0;
 }
 
+void MacResManager::clearMapCache() {
+	delete _mapCache;
+	_mapCache = nullptr;
+}
+
 bool MacResManager::hasDataFork() const {
 	return !_baseFileName.empty();
 }
@@ -113,6 +114,7 @@ bool MacResManager::open(const String &fileName) {
 	if (resFsNode.exists()) {
 		SeekableReadStream *macResForkRawStream = resFsNode.createReadStream();
 
+		_mapCacheKey = fullPath;
 		if (macResForkRawStream && loadFromRawFork(*macResForkRawStream)) {
 			_baseFileName = fileName;
 			return true;
@@ -125,21 +127,24 @@ bool MacResManager::open(const String &fileName) {
 	File *file = new File();
 
 	// Prefer standalone files first, starting with raw forks
-	if (file->open(fileName + ".rsrc") && loadFromRawFork(*file)) {
+	_mapCacheKey = fileName + ".rsrc";
+	if (file->open(_mapCacheKey) && loadFromRawFork(*file)) {
 		_baseFileName = fileName;
 		return true;
 	}
 	file->close();
 
 	// Then try for AppleDouble using Apple's naming
-	if (file->open(constructAppleDoubleName(fileName)) && loadFromAppleDouble(*file)) {
+	_mapCacheKey = constructAppleDoubleName(fileName);
+	if (file->open(_mapCacheKey) && loadFromAppleDouble(*file)) {
 		_baseFileName = fileName;
 		return true;
 	}
 	file->close();
 
 	// Check .bin for MacBinary next
-	if (file->open(fileName + ".bin") && loadFromMacBinary(*file)) {
+	_mapCacheKey = fileName + ".bin";
+	if (file->open(_mapCacheKey) && loadFromMacBinary(*file)) {
 		_baseFileName = fileName;
 		return true;
 	}
@@ -152,11 +157,13 @@ bool MacResManager::open(const String &fileName) {
 		// FIXME: Is this really needed?
 		if (isMacBinary(*file)) {
 			file->seek(0);
+			_mapCacheKey = fileName;
 			if (loadFromMacBinary(*file))
 				return true;
 		}
 
 		file->seek(0);
+		_mapCacheKey.clear();
 		_stream = file;
 		return true;
 	}
@@ -164,6 +171,7 @@ bool MacResManager::open(const String &fileName) {
 	delete file;
 
 	// The file doesn't exist
+	_mapCacheKey.clear();
 	return false;
 }
 
@@ -177,6 +185,7 @@ bool MacResManager::open(const FSNode &path, const String &fileName) {
 	if (resFsNode.exists()) {
 		SeekableReadStream *macResForkRawStream = resFsNode.createReadStream();
 
+		_mapCacheKey = fullPath;
 		if (macResForkRawStream && loadFromRawFork(*macResForkRawStream)) {
 			_baseFileName = fileName;
 			return true;
@@ -190,6 +199,7 @@ bool MacResManager::open(const FSNode &path, const String &fileName) {
 	FSNode fsNode = path.getChild(fileName + ".rsrc");
 	if (fsNode.exists() && !fsNode.isDirectory()) {
 		SeekableReadStream *stream = fsNode.createReadStream();
+		_mapCacheKey = fsNode.getPath();
 		if (loadFromRawFork(*stream)) {
 			_baseFileName = fileName;
 			return true;
@@ -201,6 +211,7 @@ bool MacResManager::open(const FSNode &path, const String &fileName) {
 	fsNode = path.getChild(constructAppleDoubleName(fileName));
 	if (fsNode.exists() && !fsNode.isDirectory()) {
 		SeekableReadStream *stream = fsNode.createReadStream();
+		_mapCacheKey = fsNode.getPath();
 		if (loadFromAppleDouble(*stream)) {
 			_baseFileName = fileName;
 			return true;
@@ -212,6 +223,7 @@ bool MacResManager::open(const FSNode &path, const String &fileName) {
 	fsNode = path.getChild(fileName + ".bin");
 	if (fsNode.exists() && !fsNode.isDirectory()) {
 		SeekableReadStream *stream = fsNode.createReadStream();
+		_mapCacheKey = fsNode.getPath();
 		if (loadFromMacBinary(*stream)) {
 			_baseFileName = fileName;
 			return true;
@@ -228,16 +240,19 @@ bool MacResManager::open(const FSNode &path, const String &fileName) {
 		// FIXME: Is this really needed?
 		if (isMacBinary(*stream)) {
 			stream->seek(0);
+			_mapCacheKey = fsNode.getPath();
 			if (loadFromMacBinary(*stream))
 				return true;
 		}
 
 		stream->seek(0);
+		_mapCacheKey.clear();
 		_stream = stream;
 		return true;
 	}
 
 	// The file doesn't exist
+	_mapCacheKey.clear();
 	return false;
 }
 
@@ -434,6 +449,10 @@ bool MacResManager::loadFromRawFork(SeekableReadStream &stream) {
 }
 
 bool MacResManager::load(SeekableReadStream &stream) {
+	// Only the file open() is trying may use the map cache
+	const String mapCacheKey = _mapCacheKey;
+	_mapCacheKey.clear();
+
 	if (_mode == kResForkNone)
 		return false;
 
@@ -457,7 +476,32 @@ bool MacResManager::load(SeekableReadStream &stream) {
 
 	_stream = &stream;
 
-	readMap();
+	if (!mapCacheKey.empty() && _mapCache) {
+		MapCache::const_iterator i = _mapCache->find(mapCacheKey);
+		if (i != _mapCache->end()) {
+			const ResourceMap &map = *i->_value;
+			if (map.resForkOffset == _resForkOffset && map.streamSize == stream.size() &&
+					map.dataOffset == _dataOffset && map.dataLength == _dataLength &&
+					map.mapOffset == _mapOffset && map.mapLength == _mapLength)
+				_map = i->_value;
+		}
+	}
+
+	if (!_map) {
+		_map = SharedPtr<ResourceMap>(new ResourceMap());
+		readMap(*_map);
+		_map->buildIndex();
+
+		if (!mapCacheKey.empty()) {
+			if (!_mapCache)
+				_mapCache = new MapCache();
+			(*_mapCache)[mapCacheKey] = _map;
+		}
+	}
+
+	_resMap = _map->resMap;
+	_resTypes = _map->resTypes;
+	_resLists = _map->resLists;
 	return true;
 }
 
@@ -480,18 +524,17 @@ SeekableReadStream *MacResManager::getDataFork() {
 }
 
 MacResIDArray MacResManager::getResIDArray(uint32 typeID) {
-	int typeNum = -1;
 	MacResIDArray res;
 
-	for (int i = 0; i < _resMap.numTypes; i++)
-		if (_resTypes[i].id == typeID) {
-			typeNum = i;
-			break;
-		}
+	if (!_map)
+		return res;
 
-	if (typeNum == -1)
+	HashMap<uint32, ResourceMap::TypeIndex>::const_iterator type = _map->types.find(typeID);
+	if (type == _map->types.end())
 		return res;
 
+	const int typeNum = type->_value.typeNum;
+
 	res.resize(_resTypes[typeNum].items);
 
 	for (int i = 0; i < _resTypes[typeNum].items; i++)
@@ -515,46 +558,62 @@ MacResTagArray MacResManager::getResTagArray() {
 }
 
 String MacResManager::getResName(uint32 typeID, uint16 resID) const {
-	int typeNum = -1;
-
-	for (int i = 0; i < _resMap.numTypes; i++)
-		if (_resTypes[i].id == typeID) {
-			typeNum = i;
-			break;
-		}
+	if (!_map)
+		return "";
 
-	if (typeNum == -1)
+	HashMap<uint32, ResourceMap::TypeIndex>::const_iterator type = _map->types.find(typeID);
+	if (type == _map->types.end())
 		return "";
 
-	for (int i = 0; i < _resTypes[typeNum].items; i++)
-		if (_resLists[typeNum][i].id == resID)
-			return _resLists[typeNum][i].name;
+	ResourceMap::IDIndex::const_iterator res = type->_value.ids.find(resID);
+	if (res == type->_value.ids.end())
+		return "";
 
-	return "";
+	return _resLists[type->_value.typeNum][res->_value].name;
 }
 
 SeekableReadStream *MacResManager::getResource(uint32 typeID, uint16 resID) {
-	int typeNum = -1;
-	int resNum = -1;
+	if (!_map)
+		return nullptr;
 
-	for (int i = 0; i < _resMap.numTypes; i++)
-		if (_resTypes[i].id == typeID) {
-			typeNum = i;
-			break;
-		}
+	HashMap<uint32, ResourceMap::TypeIndex>::const_iterator type = _map->types.find(typeID);
+	if (type == _map->types.end())
+		return nullptr;
 
-	if (typeNum == -1)
+	ResourceMap::IDIndex::const_iterator res = type->_value.ids.find(resID);
+	if (res == type->_value.ids.end())
 		return nullptr;
 
-	for (int i = 0; i < _resTypes[typeNum].items; i++)
-		if (_resLists[typeNum][i].id == resID) {
-			resNum = i;
-			break;
-		}
+	return readResource(type->_value.typeNum, res->_value);
+}
+
+SeekableReadStream *MacResManager::getResource(const String &fileName) {
+	if (!_map)
+		return nullptr;
+
+	HashMap<String, ResourceMap::ResIndex, IgnoreCase_Hash, IgnoreCase_EqualTo>::const_iterator res = _map->names.find(fileName);
+	if (res == _map->names.end())
+		return nullptr;
+
+	return readResource(res->_value.typeNum, res->_value.resNum);
+}
+
+SeekableReadStream *MacResManager::getResource(uint32 typeID, const String &fileName) {
+	if (!_map)
+		return nullptr;
+
+	HashMap<uint32, ResourceMap::TypeIndex>::const_iterator type = _map->types.find(typeID);
+	if (type == _map->types.end())
+		return nullptr;
 
-	if (resNum == -1)
+	ResourceMap::NameIndex::const_iterator res = type->_value.names.find(fileName);
+	if (res == type->_value.names.end())
 		return nullptr;
 
+	return readResource(type->_value.typeNum, res->_value);
+}
+
+SeekableReadStream *MacResManager::readResource(int typeNum, int resNum) {
 	_stream->seek(_dataOffset + _resLists[typeNum][resNum].dataOffset);
 	uint32 len = _stream->readUint32BE();
 
@@ -565,76 +624,93 @@ SeekableReadStream *MacResManager::getResource(uint32 typeID, uint16 resID) {
 	return _stream->readStream(len);
 }
 
-SeekableReadStream *MacResManager::getResource(const String &fileName) {
-	for (uint32 i = 0; i < _resMap.numTypes; i++) {
-		for (uint32 j = 0; j < _resTypes[i].items; j++) {
-			if (_resLists[i][j].nameOffset != -1 && fileName.equalsIgnoreCase(_resLists[i][j].name)) {
-				_stream->seek(_dataOffset + _resLists[i][j].dataOffset);
-				uint32 len = _stream->readUint32BE();
+MacResManager::ResourceMap::ResourceMap() : resForkOffset(0), streamSize(0), dataOffset(0), dataLength(0),
+		mapOffset(0), mapLength(0), resTypes(nullptr), resLists(nullptr) {
+	memset(&resMap, 0, sizeof(resMap));
+}
 
-				// Ignore resources with 0 length
-				if (!len)
-					return nullptr;
+MacResManager::ResourceMap::~ResourceMap() {
+	if (!resLists)
+		return;
 
-				return _stream->readStream(len);
-			}
-		}
+	for (int i = 0; i < resMap.numTypes; i++) {
+		for (int j = 0; j < resTypes[i].items; j++)
+			if (resLists[i][j].nameOffset != -1)
+				delete[] resLists[i][j].name;
+
+		delete[] resLists[i];
 	}
 
-	return nullptr;
+	delete[] resLists;
+	delete[] resTypes;
 }
 
-SeekableReadStream *MacResManager::getResource(uint32 typeID, const String &fileName) {
-	for (uint32 i = 0; i < _resMap.numTypes; i++) {
-		if (_resTypes[i].id != typeID)
+void MacResManager::ResourceMap::buildIndex() {
+	// Keep the first of any duplicates, like a search through the lists would
+	for (int i = 0; i < resMap.numTypes; i++) {
+		if (types.contains(resTypes[i].id))
 			continue;
 
-		for (uint32 j = 0; j < _resTypes[i].items; j++) {
-			if (_resLists[i][j].nameOffset != -1 && fileName.equalsIgnoreCase(_resLists[i][j].name)) {
-				_stream->seek(_dataOffset + _resLists[i][j].dataOffset);
-				uint32 len = _stream->readUint32BE();
+		TypeIndex &type = types[resTypes[i].id];
+		type.typeNum = i;
+
+		for (int j = 0; j < resTypes[i].items; j++) {
+			const Resource &res = resLists[i][j];
+			if (!type.ids.contains(res.id))
+				type.ids[res.id] = j;
+
+			if (res.nameOffset == -1)
+				continue;
 
-				// Ignore resources with 0 length
-				if (!len)
-					return nullptr;
+			if (!type.names.contains(res.name))
+				type.names[res.name] = j;
 
-				return _stream->readStream(len);
+			if (!names.contains(res.name)) {
+				ResIndex index;
+				index.typeNum = i;
+				index.resNum = j;
+				names[res.name] = index;
 			}
 		}
 	}
-
-	return nullptr;
 }
 
-void MacResManager::readMap() {
+void MacResManager::readMap(ResourceMap &map) {
+	map.resForkOffset = _resForkOffset;
+	map.streamSize = _stream->size();
+	map.dataOffset = _dataOffset;
+	map.dataLength = _dataLength;
+	map.mapOffset = _mapOffset;
+	map.mapLength = _mapLength;
+
 	_stream->seek(_mapOffset + 22);
 
-	_resMap.resAttr = _stream->readUint16BE();
-	_resMap.typeOffset = _stream->readUint16BE();
-	_resMap.nameOffset = _stream->readUint16BE();
-	_resMap.numTypes = _stream->readUint16BE();
-	_resMap.numTypes++;
+	map.resMap.resAttr = _stream->readUint16BE();
+	map.resMap.typeOffset = _stream->readUint16BE();
+	map.resMap.nameOffset = _stream->readUint16BE();
+	map.resMap.numTypes = _stream->readUint16BE();
+	map.resMap.numTypes++;
 
-	_stream->seek(_mapOffset + _resMap.typeOffset + 2);
-	_resTypes = new ResType[_resMap.numTypes];
+	_stream->seek(_mapOffset + map.resMap.typeOffset + 2);
+	map.resTypes = new ResType[map.resMap.numTypes];
 
-	for (int i = 0; i < _resMap.numTypes; i++) {
-		_resTypes[i].id = _stream->readUint32BE();
-		_resTypes[i].items = _stream->readUint16BE();
-		_resTypes[i].offset = _stream->readUint16BE();
-		_resTypes[i].items++;
+	for (int i = 0; i < map.resMap.numTypes; i++) {
+		map.resTypes[i].id = _stream->readUint32BE();
+		map.resTypes[i].items = _stream->readUint16BE();
+		map.resTypes[i].offset = _stream->readUint16BE();
+		map.resTypes[i].items++;
 
-		debug(8, "resType: <%s> items: %d offset: %d (0x%x)", tag2str(_resTypes[i].id), _resTypes[i].items,  _resTypes[i].offset, _resTypes[i].offset);
+		debug(8, "resType: <%s> items: %d offset: %d (0x%x)", tag2str(map.resTypes[i].id), map.resTypes[i].items,  map.resTypes[i].offset, map.resTypes[i].offset);
 	}
 
-	_resLists = new ResPtr[_resMap.numTypes];
+	map.resLists = new ResPtr[map.resMap.numTypes];
 
-	for (int i = 0; i < _resMap.numTypes; i++) {
-		_resLists[i] = new Resource[_resTypes[i].items];
-		_stream->seek(_resTypes[i].offset + _mapOffset + _resMap.typeOffset);
+	for (int i = 0; i < map.resMap.numTypes; i++) {
+		map.resLists[i] = new Resource[map.resTypes[i].items];
+		_stream->seek(map.resTypes[i].offset + _mapOffset + map.resMap.typeOffset);
 
-		for (int j = 0; j < _resTypes[i].items; j++) {
-			ResPtr resPtr = _resLists[i] + j;
+		for (int j = 0; j < map.resTypes[i].items; j++) {
+			ResPtr resPtr = map.resLists[i] + j;
 
 			resPtr->id = _stream->readUint16BE();
 			resPtr->nameOffset = _stream->readUint16BE();
@@ -646,14 +722,14 @@ void MacResManager::readMap() {
 			resPtr->dataOffset &= 0xFFFFFF;
 		}
 
-		for (int j = 0; j < _resTypes[i].items; j++) {
-			if (_resLists[i][j].nameOffset != -1) {
-				_stream->seek(_resLists[i][j].nameOffset + _mapOffset + _resMap.nameOffset);
+		for (int j = 0; j < map.resTypes[i].items; j++) {
+			if (map.resLists[i][j].nameOffset != -1) {
+				_stream->seek(map.resLists[i][j].nameOffset + _mapOffset + map.resMap.nameOffset);
 
 				byte len = _stream->readByte();
-				_resLists[i][j].name = new char[len + 1];
-				_resLists[i][j].name[len] = 0;
-				_stream->read(_resLists[i][j].name, len);
+				map.resLists[i][j].name = new char[len + 1];
+				map.resLists[i][j].name[len] = 0;
+				_stream->read(map.resLists[i][j].name, len);
 			}
 		}
 	}
@@ -32,6 +32,9 @@
 
 #include "common/array.h"
 #include "common/fs.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
+#include "common/ptr.h"
 #include "common/str.h"
 #include "common/str-array.h"
 
@@ -181,6 +184,15 @@ public:
 	 */
 	bool loadFromMacBinary(SeekableReadStream &stream);
 
+	/**
+	 * Forget the resource maps kept of files which are not open anymore.
+	 *
+	 * Resource maps read by open() stay cached, so that reopening the same
+	 * file does not parse its map again. This should be called when the
+	 * files may have changed, such as when the engine quits.
+	 */
+	static void clearMapCache();
+
 private:
 	SeekableReadStream *_stream;
 	String _baseFileName;
@@ -213,8 +225,6 @@ private:
 		kResForkAppleDouble
 	} _mode;
 
-	void readMap();
-
 	struct ResMap {
 		uint16 resAttr;
 		uint16 typeOffset;
@@ -238,6 +248,59 @@ private:
 
 	typedef Resource *ResPtr;
 
+	/**
+	 * A parsed resource map, together with hashed indexes into it. Maps
+	 * read by open() are shared by all MacResManagers with the same file
+	 * open.
+	 */
+	struct ResourceMap {
+		ResourceMap();
+		~ResourceMap();
+
+		/** The fork header the map was read with. */
+		int32 resForkOffset;
+		int32 streamSize;
+		uint32 dataOffset;
+		uint32 dataLength;
+		uint32 mapOffset;
+		uint32 mapLength;
+
+		ResMap resMap;
+		ResType *resTypes;
+		ResPtr *resLists;
+
+		typedef HashMap<uint16, int> IDIndex;
+		typedef HashMap<String, int, IgnoreCase_Hash, IgnoreCase_EqualTo> NameIndex;
+
+		/** The positions of the resources of one type in its list. */
+		struct TypeIndex {
+			int typeNum;
+			IDIndex ids;
+			NameIndex names;
+		};
+
+		struct ResIndex {
+			int typeNum;
+			int resNum;
+		};
+
+		HashMap<uint32, TypeIndex> types;
+		/** The first resource of any type with each name. */
+		HashMap<String, ResIndex, IgnoreCase_Hash, IgnoreCase_EqualTo> names;
+
+		void buildIndex();
+	};
+
+	typedef HashMap<String, SharedPtr<ResourceMap> > MapCache;
+	static MapCache *_mapCache;
+
+	/** Where the file to be loaded was opened from, if it may use the map cache. */
+	String _mapCacheKey;
+	SharedPtr<ResourceMap> _map;
+
+	void readMap(ResourceMap &map);
+	SeekableReadStream *readResource(int typeNum, int resNum);
+
 	int32 _resForkOffset;
 	uint32 _resForkSize;
 
@@ -245,6 +308,7 @@ private:
 	uint32 _dataLength;
 	uint32 _mapOffset;
 	uint32 _mapLength;
+	// These point into _map
 	ResMap _resMap;
 	ResType *_resTypes;
 	ResPtr  *_resLists;
@@ -71,6 +71,12 @@ public:
 	int32 size() const { return _size; }
 
 	bool seek(int32 offs, int whence = SEEK_SET);
+
+	const byte *getContiguousView(uint32 offset, uint32 size) const {
+		if (offset > _size || size > _size - offset)
+			return nullptr;
+		return _ptrOrig + offset;
+	}
 };
 
 
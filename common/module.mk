@@ -2,6 +2,8 @@ MODULE := common
 
 MODULE_OBJS := \
 	archive.o \
+	arena.o \
+	atom.o \
 	config-manager.o \
 	coroutines.o \
 	dcl.o \
@@ -16,6 +18,7 @@ MODULE_OBJS := \
 	iff_container.o \
 	ini-file.o \
 	installshield_cab.o \
+	jobs.o \
 	json.o \
 	language.o \
 	localization.o \
@@ -24,10 +27,13 @@ MODULE_OBJS := \
 	md5.o \
 	mutex.o \
 	osd_message_queue.o \
+	profiler.o \
 	platform.o \
+	prefetch.o \
 	quicktime.o \
 	random.o \
 	rational.o \
+	region.o \
 	rendermode.o \
 	str.o \
 	stream.o \
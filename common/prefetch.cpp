@@ -0,0 +1,272 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/prefetch.h"
+#include "common/debug.h"
+#include "common/fs.h"
+#include "common/stream.h"
+#include "common/util.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(FilePrefetcher);
+
+volatile uint32 FilePrefetcher::_recording = 0;
+
+FilePrefetcher::FilePrefetcher() : _recordingNumber(0), _mutex(0), _thread(0), _stopRequested(false) {
+	if (g_system)
+		_mutex = g_system->createMutex();
+}
+
+FilePrefetcher::~FilePrefetcher() {
+	atomicStoreRelease(&_recording, 0);
+	stopPrefetch();
+
+	if (_mutex)
+		g_system->deleteMutex(_mutex);
+}
+
+void FilePrefetcher::startRecording() {
+	if (_mutex)
+		g_system->lockMutex(_mutex);
+	_entries.clear();
+	_entryMap.clear();
+	++_recordingNumber;
+	atomicStoreRelease(&_recording, 1);
+	if (_mutex)
+		g_system->unlockMutex(_mutex);
+}
+
+void FilePrefetcher::stopRecording() {
+	atomicStoreRelease(&_recording, 0);
+}
+
+int FilePrefetcher::recordOpen(const String &name) {
+	if (_mutex)
+		g_system->lockMutex(_mutex);
+
+	int index;
+	EntryMap::const_iterator i = _entryMap.find(name);
+	if (i != _entryMap.end()) {
+		index = i->_value;
+	} else {
+		index = _entries.size();
+		_entries.resize(index + 1);
+		_entries[index].name = name;
+		_entryMap[name] = index;
+	}
+
+	// Tag the id with the recording, as indices are reused by the next one
+	int file = -1;
+	if (index < (1 << kIdIndexBits))
+		file = ((_recordingNumber & ((1 << kIdRecordingBits) - 1)) << kIdIndexBits) | index;
+
+	if (_mutex)
+		g_system->unlockMutex(_mutex);
+	return file;
+}
+
+void FilePrefetcher::recordRead(int file, uint32 offset, uint32 size) {
+	if (!size)
+		return;
+
+	if (_mutex)
+		g_system->lockMutex(_mutex);
+	// Files may still be read after a new recording started
+	const uint index = file & ((1 << kIdIndexBits) - 1);
+	const uint recording = (uint)file >> kIdIndexBits;
+	if (isRecording() && file >= 0 && index < _entries.size() &&
+			recording == (_recordingNumber & ((1 << kIdRecordingBits) - 1)))
+		addRange(_entries[index].ranges, offset, offset + size);
+	if (_mutex)
+		g_system->unlockMutex(_mutex);
+}
+
+void FilePrefetcher::addRange(Array<Range> &ranges, uint32 begin, uint32 end) {
+	begin &= ~(uint32)(kBlockSize - 1);
+	end = (end + kBlockSize - 1) & ~(uint32)(kBlockSize - 1);
+
+	// Most reads continue where the last one stopped
+	if (!ranges.empty() && ranges.back().begin <= begin && begin <= ranges.back().end) {
+		ranges.back().end = MAX(ranges.back().end, end);
+		return;
+	}
+
+	uint i = 0;
+	while (i < ranges.size() && ranges[i].end < begin)
+		++i;
+
+	if (i == ranges.size() || ranges[i].begin > end) {
+		Range range;
+		range.begin = begin;
+		range.end = end;
+		ranges.insert_at(i, range);
+		return;
+	}
+
+	ranges[i].begin = MIN(ranges[i].begin, begin);
+	ranges[i].end = MAX(ranges[i].end, end);
+	while (i + 1 < ranges.size() && ranges[i + 1].begin <= ranges[i].end) {
+		ranges[i].end = MAX(ranges[i].end, ranges[i + 1].end);
+		ranges.remove_at(i + 1);
+	}
+}
+
+void FilePrefetcher::saveManifest(WriteStream &stream) const {
+	if (_mutex)
+		g_system->lockMutex(_mutex);
+
+	stream.writeString("# ScummVM file prefetch manifest\n");
+	for (uint i = 0; i < _entries.size(); ++i) {
+		const Entry &entry = _entries[i];
+		// Files which were only checked for are not worth reading ahead
+		if (entry.ranges.empty())
+			continue;
+
+		String line = entry.name + "\t";
+		for (uint j = 0; j < entry.ranges.size(); ++j) {
+			if (j)
+				line += ' ';
+			line += String::format("%u-%u", entry.ranges[j].begin, entry.ranges[j].end);
+		}
+		stream.writeString(line + "\n");
+	}
+
+	if (_mutex)
+		g_system->unlockMutex(_mutex);
+}
+
+bool FilePrefetcher::parseRanges(const String &text, Array<Range> &ranges) {
+	const char *s = text.c_str();
+	while (*s) {
+		char *next;
+		Range range;
+		range.begin = strtoul(s, &next, 10);
+		if (next == s || *next != '-')
+			return false;
+		s = next + 1;
+		range.end = strtoul(s, &next, 10);
+		if (next == s || range.end <= range.begin)
+			return false;
+		s = next;
+		while (*s == ' ')
+			++s;
+		addRange(ranges, range.begin, range.end);
+	}
+	return true;
+}
+
+void FilePrefetcher::startPrefetch(SeekableReadStream &manifest, const FSNode &gameDir) {
+	stopPrefetch();
+
+	// The files are looked up by name, as engines may have added any
+	// subdirectory to SearchMan. SearchMan itself must not be used by the
+	// prefetch thread, and the streams of files in archives may share a
+	// handle with the game, so only plain files are read ahead.
+	typedef HashMap<String, ArchiveMemberPtr, IgnoreCase_Hash, IgnoreCase_EqualTo> MemberMap;
+	MemberMap members;
+	{
+		FSDirectory dir(gameDir, 4);
+		ArchiveMemberList list;
+		dir.listMembers(list);
+		for (ArchiveMemberList::const_iterator i = list.begin(); i != list.end(); ++i) {
+			if (!members.contains((*i)->getName()))
+				members[(*i)->getName()] = *i;
+		}
+	}
+
+	while (!manifest.eos() && !manifest.err()) {
+		const String line = manifest.readLine();
+		if (line.empty() || line[0] == '#')
+			continue;
+
+		const char *tab = strrchr(line.c_str(), '\t');
+		if (!tab)
+			continue;
+		const String name(line.c_str(), tab);
+
+		MemberMap::const_iterator member = members.find(lastPathComponent(name, '/'));
+		if (member == members.end())
+			continue;
+
+		PrefetchFile file;
+		file.member = member->_value;
+		if (parseRanges(tab + 1, file.ranges) && !file.ranges.empty())
+			_prefetchFiles.push_back(file);
+	}
+	members.clear();
+
+	if (_prefetchFiles.empty())
+		return;
+
+	_stopRequested = false;
+	_thread = g_system->createThread(prefetchProc, this);
+	if (!_thread)
+		_prefetchFiles.clear();
+	else
+		debug(1, "FilePrefetcher: Reading ahead %d files", _prefetchFiles.size());
+}
+
+void FilePrefetcher::stopPrefetch() {
+	if (_thread) {
+		_stopRequested = true;
+		g_system->joinThread(_thread);
+		_thread = 0;
+	}
+
+	_prefetchFiles.clear();
+}
+
+void FilePrefetcher::prefetchProc(void *param) {
+	FilePrefetcher *prefetcher = (FilePrefetcher *)param;
+	byte *buffer = new byte[kBlockSize];
+	uint32 total = 0;
+
+	for (uint i = 0; i < prefetcher->_prefetchFiles.size() && total < kMaxPrefetchSize; ++i) {
+		const PrefetchFile &file = prefetcher->_prefetchFiles[i];
+		SeekableReadStream *stream = file.member->createReadStream();
+		if (!stream)
+			continue;
+
+		for (uint j = 0; j < file.ranges.size(); ++j) {
+			if (!stream->seek(file.ranges[j].begin))
+				break;
+
+			uint32 left = file.ranges[j].end - file.ranges[j].begin;
+			while (left && total < kMaxPrefetchSize && !prefetcher->_stopRequested) {
+				const uint32 size = stream->read(buffer, MIN<uint32>(left, kBlockSize));
+				if (!size)
+					break;
+				left -= size;
+				total += size;
+			}
+		}
+
+		delete stream;
+		if (prefetcher->_stopRequested)
+			break;
+	}
+
+	delete[] buffer;
+}
+
+} // End of namespace Common
@@ -0,0 +1,149 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_PREFETCH_H
+#define COMMON_PREFETCH_H
+
+#include "common/scummsys.h"
+#include "common/archive.h"
+#include "common/array.h"
+#include "common/atomic.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
+#include "common/singleton.h"
+#include "common/str.h"
+#include "common/system.h"
+
+namespace Common {
+
+class FSNode;
+class SeekableReadStream;
+class WriteStream;
+
+/**
+ * Records which parts of which files a game reads, and reads them ahead
+ * of time the next time the game starts.
+ *
+ * While recording, every file opened through SearchMan by Common::File is
+ * noted in the order it was first opened, together with the byte ranges
+ * read from it, rounded to kBlockSize. The result is saved as a manifest.
+ *
+ * Prefetching a manifest reads those ranges on a background thread, so
+ * that they are in the OS file cache by the time the game asks for them.
+ * Only files directly in the game directory tree are prefetched; files
+ * inside archives are covered by prefetching their archive. Backends
+ * without threads do not prefetch at all.
+ */
+class FilePrefetcher : public Singleton<FilePrefetcher> {
+public:
+	enum {
+		kBlockSize = 64 * 1024,
+		kMaxPrefetchSize = 256 * 1024 * 1024
+	};
+
+	/**
+	 * Return whether reads are being recorded. This does not create the
+	 * prefetcher, so that it can be checked for every read.
+	 */
+	static bool isRecording() { return atomicLoadAcquire(&_recording) != 0; }
+
+	/** Start recording a new list of files, dropping the previous one. */
+	void startRecording();
+	void stopRecording();
+
+	/**
+	 * Note that a file was opened.
+	 *
+	 * @return the id to pass to recordRead() for reads from it, or -1 if
+	 *         the file is not recorded. Ids from an earlier recording are
+	 *         ignored by recordRead().
+	 */
+	int recordOpen(const String &name);
+
+	/** Note that size bytes were read from the file at offset. */
+	void recordRead(int file, uint32 offset, uint32 size);
+
+	/** Write the recorded files as a manifest. */
+	void saveManifest(WriteStream &stream) const;
+
+	/**
+	 * Read ahead the files listed in a manifest, looking them up in the
+	 * given directory. Stops any prefetch still in progress first.
+	 */
+	void startPrefetch(SeekableReadStream &manifest, const FSNode &gameDir);
+
+	/** Cancel the prefetch and wait for its thread to finish. */
+	void stopPrefetch();
+
+private:
+	friend class Singleton<SingletonBaseType>;
+	FilePrefetcher();
+	~FilePrefetcher();
+
+	/** A range of bytes [begin, end) read from a file. */
+	struct Range {
+		uint32 begin;
+		uint32 end;
+	};
+
+	struct Entry {
+		String name;
+		Array<Range> ranges;
+	};
+
+	struct PrefetchFile {
+		ArchiveMemberPtr member;
+		Array<Range> ranges;
+	};
+
+	typedef HashMap<String, int, IgnoreCase_Hash, IgnoreCase_EqualTo> EntryMap;
+
+	enum {
+		/** Ids hold the entry index in these bits, and the recording above. */
+		kIdIndexBits = 20,
+		kIdRecordingBits = 31 - kIdIndexBits
+	};
+
+	static volatile uint32 _recording;
+
+	uint32 _recordingNumber;	///< Incremented by startRecording(), guarded by _mutex.
+
+	OSystem::MutexRef _mutex;	///< Guards the recorded entries, reads may come from any thread.
+	Array<Entry> _entries;
+	EntryMap _entryMap;
+
+	OSystem::ThreadRef _thread;
+	volatile bool _stopRequested;
+	Array<PrefetchFile> _prefetchFiles;	///< Only accessed by the prefetch thread while it runs.
+
+	static void addRange(Array<Range> &ranges, uint32 begin, uint32 end);
+	static bool parseRanges(const String &text, Array<Range> &ranges);
+
+	static void prefetchProc(void *param);
+};
+
+} // End of namespace Common
+
+/** Shortcut for accessing the file prefetcher. */
+#define FilePrefetchMan		Common::FilePrefetcher::instance()
+
+#endif
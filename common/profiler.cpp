@@ -0,0 +1,313 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/profiler.h"
+#include "common/stream.h"
+#include "common/util.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(Profiler);
+
+bool Profiler::_active = false;
+
+Profiler::Profiler()
+	: _mutex(0), _overlayEnabled(false), _lastOverlayUpdate(0), _zoneCount(0), _lastFrameEnd(0), _counterCount(0),
+	  _frameTimes(nullptr), _frameZoneTimes(nullptr), _frameCounts(nullptr), _frameHead(0), _frameCount(0), _counterFrameCount(0),
+	  _events(nullptr), _eventHead(0), _eventCount(0) {
+	memset(_zones, 0, sizeof(_zones));
+	memset(_currentZoneTimes, 0, sizeof(_currentZoneTimes));
+	memset(_counters, 0, sizeof(_counters));
+	memset(_currentCounts, 0, sizeof(_currentCounts));
+	memset(_counterTotals, 0, sizeof(_counterTotals));
+
+	if (g_system)
+		_mutex = g_system->createMutex();
+}
+
+Profiler::~Profiler() {
+	_active = false;
+
+	if (_mutex)
+		g_system->deleteMutex(_mutex);
+
+	delete[] _frameTimes;
+	delete[] _frameZoneTimes;
+	delete[] _frameCounts;
+	delete[] _events;
+}
+
+void Profiler::lock() const {
+	if (_mutex)
+		g_system->lockMutex(_mutex);
+}
+
+void Profiler::unlock() const {
+	if (_mutex)
+		g_system->unlockMutex(_mutex);
+}
+
+void Profiler::setEnabled(bool enable) {
+	lock();
+
+	if (enable) {
+		if (!_frameTimes) {
+			_frameTimes = new uint32[kFrameHistory];
+			_frameZoneTimes = new uint32[kFrameHistory * kMaxZones];
+			_frameCounts = new uint32[kFrameHistory * kMaxCounters];
+			_events = new Event[kMaxEvents];
+		}
+
+		memset(_currentZoneTimes, 0, sizeof(_currentZoneTimes));
+		memset(_currentCounts, 0, sizeof(_currentCounts));
+		memset(_counterTotals, 0, sizeof(_counterTotals));
+		_lastFrameEnd = 0;
+		_frameHead = _frameCount = _counterFrameCount = 0;
+		_eventHead = _eventCount = 0;
+	}
+
+	_active = enable;
+	unlock();
+}
+
+int Profiler::getZone(const char *name, Track track) {
+	lock();
+
+	int zone = -1;
+	for (uint i = 0; i < _zoneCount && zone < 0; ++i) {
+		if (_zones[i].track == track && !strcmp(_zones[i].name, name))
+			zone = i;
+	}
+
+	if (zone < 0 && _zoneCount < kMaxZones) {
+		zone = _zoneCount++;
+		_zones[zone].name = name;
+		_zones[zone].track = track;
+	}
+
+	unlock();
+	return zone;
+}
+
+void Profiler::addSample(int zone, uint64 start, uint32 duration) {
+	lock();
+
+	if (_active && zone >= 0) {
+		_currentZoneTimes[zone] += duration;
+
+		Event &event = _events[_eventHead];
+		event.start = start;
+		event.duration = duration;
+		event.zone = zone;
+		_eventHead = (_eventHead + 1) % kMaxEvents;
+		_eventCount = MIN<uint>(_eventCount + 1, kMaxEvents);
+	}
+
+	unlock();
+}
+
+void Profiler::addCount(const char *name, uint32 count) {
+	lock();
+
+	if (_active) {
+		// Names are usually the same literal, so compare the pointers first
+		int counter = -1;
+		for (uint i = 0; i < _counterCount && counter < 0; ++i) {
+			if (_counters[i] == name)
+				counter = i;
+		}
+		for (uint i = 0; i < _counterCount && counter < 0; ++i) {
+			if (!strcmp(_counters[i], name))
+				counter = i;
+		}
+
+		if (counter < 0 && _counterCount < kMaxCounters) {
+			counter = _counterCount++;
+			_counters[counter] = name;
+		}
+
+		if (counter >= 0) {
+			_currentCounts[counter] += count;
+			_counterTotals[counter] += count;
+		}
+	}
+
+	unlock();
+}
+
+void Profiler::resetCounters() {
+	lock();
+	memset(_currentCounts, 0, sizeof(_currentCounts));
+	memset(_counterTotals, 0, sizeof(_counterTotals));
+	_counterFrameCount = 0;
+	unlock();
+}
+
+void Profiler::endFrame(uint64 now) {
+	lock();
+
+	if (!_active) {
+		unlock();
+		return;
+	}
+
+	// The first frame end only marks the start of the history
+	if (_lastFrameEnd) {
+		_frameTimes[_frameHead] = (uint32)(now - _lastFrameEnd);
+		memcpy(_frameZoneTimes + _frameHead * kMaxZones, _currentZoneTimes, sizeof(_currentZoneTimes));
+		memcpy(_frameCounts + _frameHead * kMaxCounters, _currentCounts, sizeof(_currentCounts));
+		_frameHead = (_frameHead + 1) % kFrameHistory;
+		_frameCount = MIN<uint>(_frameCount + 1, kFrameHistory);
+		_counterFrameCount = MIN<uint>(_counterFrameCount + 1, kFrameHistory);
+	}
+
+	memset(_currentZoneTimes, 0, sizeof(_currentZoneTimes));
+	memset(_currentCounts, 0, sizeof(_currentCounts));
+	_lastFrameEnd = now;
+
+	const bool showOverlay = _overlayEnabled && g_system && now - _lastOverlayUpdate >= 500000;
+	unlock();
+
+	if (showOverlay) {
+		_lastOverlayUpdate = now;
+		g_system->displayMessageOnOSD(getSummary().c_str());
+	}
+}
+
+uint32 Profiler::getAverageFrameTime() const {
+	lock();
+
+	uint64 total = 0;
+	for (uint i = 0; i < _frameCount; ++i)
+		total += _frameTimes[i];
+
+	unlock();
+	return _frameCount ? (uint32)(total / _frameCount) : 0;
+}
+
+uint32 Profiler::getMaxFrameTime() const {
+	lock();
+
+	uint32 maxTime = 0;
+	for (uint i = 0; i < _frameCount; ++i)
+		maxTime = MAX(maxTime, _frameTimes[i]);
+
+	unlock();
+	return maxTime;
+}
+
+uint32 Profiler::getAverageZoneTime(int zone) const {
+	lock();
+
+	uint64 total = 0;
+	for (uint i = 0; i < _frameCount; ++i)
+		total += _frameZoneTimes[i * kMaxZones + zone];
+
+	unlock();
+	return _frameCount ? (uint32)(total / _frameCount) : 0;
+}
+
+uint64 Profiler::getHistoryTime(uint frameCount) const {
+	uint64 total = 0;
+	for (uint i = 1; i <= frameCount; ++i)
+		total += _frameTimes[(_frameHead + kFrameHistory - i) % kFrameHistory];
+	return total;
+}
+
+uint64 Profiler::getCounterTotal(int counter) const {
+	lock();
+	const uint64 total = _counterTotals[counter];
+	unlock();
+	return total;
+}
+
+uint32 Profiler::getAverageCount(int counter) const {
+	lock();
+
+	uint64 total = 0;
+	for (uint i = 1; i <= _counterFrameCount; ++i)
+		total += _frameCounts[(_frameHead + kFrameHistory - i) % kFrameHistory * kMaxCounters + counter];
+
+	const uint frameCount = _counterFrameCount;
+	unlock();
+	return frameCount ? (uint32)(total / frameCount) : 0;
+}
+
+uint64 Profiler::getCountRate(int counter) const {
+	lock();
+
+	uint64 total = 0;
+	for (uint i = 1; i <= _counterFrameCount; ++i)
+		total += _frameCounts[(_frameHead + kFrameHistory - i) % kFrameHistory * kMaxCounters + counter];
+
+	const uint64 time = getHistoryTime(_counterFrameCount);
+	unlock();
+	return time ? total * 1000000 / time : 0;
+}
+
+namespace {
+
+String formatMillis(uint32 micros) {
+	return String::format("%u.%u", micros / 1000, micros / 100 % 10);
+}
+
+} // End of anonymous namespace
+
+String Profiler::getSummary() const {
+	String summary = "Frame " + formatMillis(getAverageFrameTime()) + " ms, max " + formatMillis(getMaxFrameTime());
+
+	for (uint i = 0; i < _zoneCount; ++i) {
+		const uint32 zoneTime = getAverageZoneTime(i);
+		if (zoneTime)
+			summary += String(", ") + _zones[i].name + " " + formatMillis(zoneTime);
+	}
+
+	return summary;
+}
+
+void Profiler::writeTrace(WriteStream &stream) const {
+	lock();
+
+	stream.writeString("{\"traceEvents\":[\n");
+	stream.writeString("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"main\"}},\n");
+	stream.writeString("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"audio\"}}");
+
+	// Timestamps are relative to the earliest event, so that they fit in 32
+	// bits. Events are recorded when they end, so that may not be the first.
+	const uint first = (_eventHead + kMaxEvents - _eventCount) % kMaxEvents;
+	uint64 base = _eventCount ? _events[first].start : 0;
+	for (uint i = 0; i < _eventCount; ++i)
+		base = MIN(base, _events[(first + i) % kMaxEvents].start);
+	for (uint i = 0; i < _eventCount; ++i) {
+		const Event &event = _events[(first + i) % kMaxEvents];
+		const Zone &zone = _zones[event.zone];
+
+		// Zone names are string literals, which never need escaping
+		stream.writeString(String::format(",\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%u,\"dur\":%u,\"pid\":1,\"tid\":%d}",
+		                                  zone.name, (uint32)(event.start - base), event.duration, (int)zone.track));
+	}
+
+	stream.writeString("\n]}\n");
+	unlock();
+}
+
+} // End of namespace Common
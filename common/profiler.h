@@ -0,0 +1,239 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_PROFILER_H
+#define COMMON_PROFILER_H
+
+#include "common/scummsys.h"
+#include "common/noncopyable.h"
+#include "common/singleton.h"
+#include "common/str.h"
+#include "common/system.h"
+
+namespace Common {
+
+class WriteStream;
+
+/**
+ * A lightweight profiler which shows where the time of a frame goes.
+ *
+ * Code marks the zones to measure with PROFILE_ZONE, which times the rest
+ * of the enclosing scope. The profiler is disabled by default, in which
+ * case a zone costs a single check. Once enabled, it keeps the time spent
+ * in every zone for each of the last kFrameHistory frames, and the last
+ * kMaxEvents zone timings, which can be written as a Chrome trace.
+ *
+ * A frame ends whenever the screen is updated. Zones may be measured on
+ * any thread, but zones measured outside of the main thread need a track
+ * of their own, so that they do not appear nested in traces.
+ *
+ * Hot paths can also count events with PROFILE_COUNT, such as resource
+ * cache misses or blitted sprites. Counters keep a total since they were
+ * last reset, and their counts for each frame of the history, from which
+ * rates per frame and per second are derived.
+ *
+ * All times are in microseconds.
+ */
+class Profiler : public Singleton<Profiler> {
+public:
+	enum {
+		kMaxZones = 32,
+		kMaxCounters = 32,
+		kFrameHistory = 128,
+		kMaxEvents = 16384
+	};
+
+	/** The timelines zones are shown on in traces. */
+	enum Track {
+		kTrackMain = 0,
+		kTrackAudio = 1
+	};
+
+	/**
+	 * Return whether the profiler is enabled. This does not create the
+	 * profiler, so that zones can be measured on any thread.
+	 */
+	static bool isActive() { return _active; }
+
+	/**
+	 * Enable or disable the profiler. Enabling it starts a new history.
+	 */
+	void setEnabled(bool enable);
+
+	/**
+	 * Periodically show a summary of the frame history as OSD message.
+	 */
+	void setOverlayEnabled(bool enable) { _overlayEnabled = enable; }
+	bool isOverlayEnabled() const { return _overlayEnabled; }
+
+	/**
+	 * Return the id of the zone with the given name, registering it on its
+	 * first use.
+	 *
+	 * @return the zone id, or -1 if there are too many zones.
+	 */
+	int getZone(const char *name, Track track);
+
+	/** Record that a zone started at the given time and took duration. */
+	void addSample(int zone, uint64 start, uint32 duration);
+
+	/**
+	 * Add count to the counter with the given name, registering it on its
+	 * first use. The name must be a string literal or live as long.
+	 */
+	void addCount(const char *name, uint32 count);
+
+	/** Restart all counters from zero, without touching the zones. */
+	void resetCounters();
+
+	/** Mark the end of the current frame. */
+	void endFrame(uint64 now);
+
+	/** Return the number of frames in the history. */
+	uint getFrameCount() const { return _frameCount; }
+
+	/** Return the number of registered zones. */
+	uint getZoneCount() const { return _zoneCount; }
+	const char *getZoneName(int zone) const { return _zones[zone].name; }
+
+	/** Return the average and the longest frame time in the history. */
+	uint32 getAverageFrameTime() const;
+	uint32 getMaxFrameTime() const;
+
+	/** Return the average time per frame spent in a zone. */
+	uint32 getAverageZoneTime(int zone) const;
+
+	/** Return the number of registered counters. */
+	uint getCounterCount() const { return _counterCount; }
+	const char *getCounterName(int counter) const { return _counters[counter]; }
+
+	/** Return the count since the counters were last reset. */
+	uint64 getCounterTotal(int counter) const;
+
+	/**
+	 * Return the average count per frame and per second, over the frames of
+	 * the history since the counters were last reset.
+	 */
+	uint32 getAverageCount(int counter) const;
+	uint64 getCountRate(int counter) const;
+
+	/** Return a one line summary of the frame history. */
+	String getSummary() const;
+
+	/**
+	 * Write the recorded zone timings in the Chrome trace event format,
+	 * which can be viewed with chrome://tracing or Perfetto.
+	 */
+	void writeTrace(WriteStream &stream) const;
+
+private:
+	friend class Singleton<SingletonBaseType>;
+	Profiler();
+	~Profiler();
+
+	struct Zone {
+		const char *name;
+		Track track;
+	};
+
+	struct Event {
+		uint64 start;
+		uint32 duration;
+		int zone;
+	};
+
+	static bool _active;
+
+	OSystem::MutexRef _mutex;	///< Guards all below, samples may come from any thread.
+	bool _overlayEnabled;
+	uint64 _lastOverlayUpdate;
+
+	Zone _zones[kMaxZones];
+	uint _zoneCount;
+
+	uint32 _currentZoneTimes[kMaxZones];
+	uint64 _lastFrameEnd;
+
+	const char *_counters[kMaxCounters];
+	uint _counterCount;
+	uint32 _currentCounts[kMaxCounters];
+	uint64 _counterTotals[kMaxCounters];
+
+	uint32 *_frameTimes;		///< kFrameHistory entries.
+	uint32 *_frameZoneTimes;	///< kMaxZones entries per frame.
+	uint32 *_frameCounts;		///< kMaxCounters entries per frame.
+	uint _frameHead;
+	uint _frameCount;
+	uint _counterFrameCount;	///< Frames of the history since the counters were reset.
+
+	Event *_events;
+	uint _eventHead;
+	uint _eventCount;
+
+	void lock() const;
+	void unlock() const;
+
+	/** Return the sum of the last frameCount frame times. */
+	uint64 getHistoryTime(uint frameCount) const;
+};
+
+/**
+ * Measures the time until the end of its scope as a profiler zone.
+ */
+class ProfileZone : NonCopyable {
+public:
+	ProfileZone(const char *name, Profiler::Track track = Profiler::kTrackMain) : _zone(-1), _start(0) {
+		if (Profiler::isActive()) {
+			_zone = Profiler::instance().getZone(name, track);
+			_start = g_system->getMicros();
+		}
+	}
+
+	~ProfileZone() {
+		if (_zone >= 0 && Profiler::isActive())
+			Profiler::instance().addSample(_zone, _start, (uint32)(g_system->getMicros() - _start));
+	}
+
+private:
+	int _zone;
+	uint64 _start;
+};
+
+} // End of namespace Common
+
+/** Shortcut for accessing the profiler. */
+#define ProfilerMan		Common::Profiler::instance()
+
+/** Measure the rest of the enclosing scope as the zone with the given name. */
+#define PROFILE_ZONE(name)	Common::ProfileZone profileZone(name)
+
+/** Measure the rest of the enclosing scope as a zone on the given track. */
+#define PROFILE_TRACK_ZONE(name, track)	Common::ProfileZone profileZone(name, track)
+
+/** Add count to the counter with the given name while the profiler is enabled. */
+#define PROFILE_COUNT(name, count) \
+	do { \
+		if (Common::Profiler::isActive()) \
+			ProfilerMan.addCount(name, count); \
+	} while (0)
+
+#endif
@@ -0,0 +1,240 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/region.h"
+#include "common/algorithm.h"
+
+namespace Common {
+
+namespace {
+
+struct Span {
+	int16 left, right;
+};
+
+/**
+ * Collect the horizontal spans of the band of rects covering row y,
+ * starting the search at index, which is advanced past all bands above y.
+ */
+void getBandSpans(const Array<Rect> &rects, uint &index, int16 y, Array<Span> &spans) {
+	spans.clear();
+
+	while (index < rects.size() && rects[index].bottom <= y)
+		index++;
+
+	if (index >= rects.size() || rects[index].top > y)
+		return;
+
+	const int16 top = rects[index].top;
+	for (uint i = index; i < rects.size() && rects[i].top == top; i++) {
+		Span span = { rects[i].left, rects[i].right };
+		spans.push_back(span);
+	}
+}
+
+/**
+ * Which parts of two areas to keep: those only in the first, those only
+ * in the second and those in both.
+ */
+struct Keep {
+	bool onlyA, onlyB, both;
+};
+
+/**
+ * Combine two sorted lists of disjoint spans by walking the elementary
+ * intervals between all of their end points.
+ */
+void combineSpans(const Array<Span> &a, const Array<Span> &b, const Keep &keep, Array<int16> &points, Array<Span> &result) {
+	result.clear();
+
+	points.clear();
+	for (uint i = 0; i < a.size(); i++) {
+		points.push_back(a[i].left);
+		points.push_back(a[i].right);
+	}
+	for (uint i = 0; i < b.size(); i++) {
+		points.push_back(b[i].left);
+		points.push_back(b[i].right);
+	}
+	sort(points.begin(), points.end());
+
+	uint ia = 0, ib = 0;
+	for (uint i = 0; i + 1 < points.size(); i++) {
+		const int16 x0 = points[i], x1 = points[i + 1];
+		if (x0 == x1)
+			continue;
+
+		while (ia < a.size() && a[ia].right <= x0)
+			ia++;
+		while (ib < b.size() && b[ib].right <= x0)
+			ib++;
+
+		const bool inA = ia < a.size() && a[ia].left <= x0;
+		const bool inB = ib < b.size() && b[ib].left <= x0;
+		if (!(inA && inB ? keep.both : inA ? keep.onlyA : inB && keep.onlyB))
+			continue;
+
+		if (!result.empty() && result.back().right == x0) {
+			result.back().right = x1;
+		} else {
+			Span span = { x0, x1 };
+			result.push_back(span);
+		}
+	}
+}
+
+} // End of anonymous namespace
+
+Rect Region::getBounds() const {
+	if (_rects.empty())
+		return Rect();
+
+	Rect bounds = _rects.front();
+	for (uint i = 1; i < _rects.size(); i++)
+		bounds.extend(_rects[i]);
+	return bounds;
+}
+
+uint32 Region::getArea() const {
+	uint32 area = 0;
+	for (uint i = 0; i < _rects.size(); i++)
+		area += (uint32)_rects[i].width() * _rects[i].height();
+	return area;
+}
+
+bool Region::contains(int16 x, int16 y) const {
+	for (uint i = 0; i < _rects.size() && _rects[i].top <= y; i++) {
+		if (_rects[i].contains(x, y))
+			return true;
+	}
+	return false;
+}
+
+bool Region::intersects(const Rect &rect) const {
+	if (rect.isEmpty())
+		return false;
+
+	for (uint i = 0; i < _rects.size() && _rects[i].top < rect.bottom; i++) {
+		if (_rects[i].intersects(rect))
+			return true;
+	}
+	return false;
+}
+
+void Region::unite(const Rect &rect) {
+	if (rect.isEmpty())
+		return;
+
+	// Adding a rect fully below the region, as when drawing from top to
+	// bottom, only appends a band
+	if (_rects.empty() || rect.top >= _rects.back().bottom) {
+		if (!_rects.empty() && rect.top == _rects.back().bottom) {
+			const Rect &last = _rects.back();
+			if (last.left == rect.left && last.right == rect.right &&
+					(_rects.size() == 1 || _rects[_rects.size() - 2].top != last.top)) {
+				_rects.back().bottom = rect.bottom;
+				return;
+			}
+		}
+		_rects.push_back(rect);
+		return;
+	}
+
+	combine(Region(rect), kOpUnion);
+}
+
+void Region::translate(int16 dx, int16 dy) {
+	for (uint i = 0; i < _rects.size(); i++)
+		_rects[i].translate(dx, dy);
+}
+
+void Region::combine(const Region &other, Operation op) {
+	// Handle the trivial cases without rebuilding the region
+	if (other._rects.empty()) {
+		if (op == kOpIntersect)
+			_rects.clear();
+		return;
+	}
+	if (_rects.empty()) {
+		if (op == kOpUnion)
+			_rects = other._rects;
+		return;
+	}
+
+	// Split the area into bands at every top and bottom of both regions
+	Array<int16> ys;
+	ys.reserve((_rects.size() + other._rects.size()) * 2);
+	for (uint i = 0; i < _rects.size(); i++) {
+		ys.push_back(_rects[i].top);
+		ys.push_back(_rects[i].bottom);
+	}
+	for (uint i = 0; i < other._rects.size(); i++) {
+		ys.push_back(other._rects[i].top);
+		ys.push_back(other._rects[i].bottom);
+	}
+	sort(ys.begin(), ys.end());
+
+	static const Keep keeps[] = {
+		{ true, true, true },	// kOpUnion
+		{ false, false, true },	// kOpIntersect
+		{ true, false, false }	// kOpSubtract
+	};
+	const Keep &keep = keeps[op];
+
+	Array<Rect> result;
+	Array<Span> spansA, spansB, spans;
+	Array<int16> points;
+	uint indexA = 0, indexB = 0;
+	uint lastBand = 0;
+	uint lastBandSize = 0;
+
+	for (uint i = 0; i + 1 < ys.size(); i++) {
+		const int16 y0 = ys[i], y1 = ys[i + 1];
+		if (y0 == y1)
+			continue;
+
+		getBandSpans(_rects, indexA, y0, spansA);
+		getBandSpans(other._rects, indexB, y0, spansB);
+		combineSpans(spansA, spansB, keep, points, spans);
+		if (spans.empty())
+			continue;
+
+		// Extend the previous band instead if it has the same spans
+		bool coalesce = lastBandSize == spans.size() && result[lastBand].bottom == y0;
+		for (uint j = 0; coalesce && j < spans.size(); j++)
+			coalesce = result[lastBand + j].left == spans[j].left && result[lastBand + j].right == spans[j].right;
+
+		if (coalesce) {
+			for (uint j = 0; j < spans.size(); j++)
+				result[lastBand + j].bottom = y1;
+		} else {
+			lastBand = result.size();
+			lastBandSize = spans.size();
+			for (uint j = 0; j < spans.size(); j++)
+				result.push_back(Rect(spans[j].left, y0, spans[j].right, y1));
+		}
+	}
+
+	_rects = result;
+}
+
+} // End of namespace Common
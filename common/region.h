@@ -0,0 +1,102 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_REGION_H
+#define COMMON_REGION_H
+
+#include "common/array.h"
+#include "common/rect.h"
+
+namespace Common {
+
+/**
+ * An area made up of any number of rectangles, e.g. the dirty parts of a
+ * screen.
+ *
+ * The area is kept as a list of disjoint rectangles in y-x banded form:
+ * the rectangles are grouped into horizontal bands of the same top and
+ * bottom, sorted from top to bottom, and the rectangles of a band are
+ * sorted from left to right and never touch. Vertically adjacent bands
+ * with the same horizontal spans are merged. Every area thus has exactly
+ * one representation, and no pixel is covered twice, so drawing the
+ * rectangles of a region never draws anything more than once.
+ *
+ * Union, intersection and subtraction all run in time linear in the
+ * number of rectangles of both regions, times the number of bands.
+ */
+class Region {
+public:
+	typedef Array<Rect>::const_iterator const_iterator;
+
+	Region() {}
+	Region(const Rect &rect) { if (!rect.isEmpty()) _rects.push_back(rect); }
+
+	bool isEmpty() const { return _rects.empty(); }
+	void clear() { _rects.clear(); }
+
+	/** Return the disjoint rectangles making up the region, in y-x banded order. */
+	const Array<Rect> &getRects() const { return _rects; }
+	const_iterator begin() const { return _rects.begin(); }
+	const_iterator end() const { return _rects.end(); }
+	uint size() const { return _rects.size(); }
+
+	/** Return the smallest rectangle containing the whole region. */
+	Rect getBounds() const;
+
+	/** Return the number of pixels covered by the region. */
+	uint32 getArea() const;
+
+	bool contains(int16 x, int16 y) const;
+	bool intersects(const Rect &rect) const;
+
+	/** Add an area to the region. */
+	void unite(const Region &other) { combine(other, kOpUnion); }
+	void unite(const Rect &rect);
+
+	/** Limit the region to the parts also covered by an area. */
+	void intersect(const Region &other) { combine(other, kOpIntersect); }
+	void intersect(const Rect &rect) { combine(Region(rect), kOpIntersect); }
+
+	/** Remove an area from the region. */
+	void subtract(const Region &other) { combine(other, kOpSubtract); }
+	void subtract(const Rect &rect) { combine(Region(rect), kOpSubtract); }
+
+	void translate(int16 dx, int16 dy);
+
+	bool operator==(const Region &other) const { return _rects == other._rects; }
+	bool operator!=(const Region &other) const { return _rects != other._rects; }
+
+private:
+	enum Operation {
+		kOpUnion,
+		kOpIntersect,
+		kOpSubtract
+	};
+
+	Array<Rect> _rects;
+
+	void combine(const Region &other, Operation op);
+};
+
+} // End of namespace Common
+
+#endif
@@ -0,0 +1,128 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_RINGBUFFER_H
+#define COMMON_RINGBUFFER_H
+
+#include "common/scummsys.h"
+#include "common/atomic.h"
+#include "common/noncopyable.h"
+
+namespace Common {
+
+/**
+ * A bounded queue for handing data from one thread to another without
+ * locking, e.g. from the main thread to the audio callback.
+ *
+ * Exactly one thread may call push() and exactly one (possibly different)
+ * thread may call pop() and front(); with more producers or consumers
+ * the queue needs to be guarded by a mutex after all. Neither side ever
+ * blocks: push() fails if the queue is full, pop() if it is empty.
+ *
+ * The capacity is rounded up to a power of two. All elements are
+ * constructed up front and assigned to on push(), so T must be default
+ * constructible and assignable.
+ */
+template<class T>
+class SPSCRingBuffer : NonCopyable {
+public:
+	typedef uint size_type;
+
+	explicit SPSCRingBuffer(size_type capacity) : _head(0), _tail(0) {
+		size_type size = 1;
+		while (size < capacity)
+			size <<= 1;
+		_mask = size - 1;
+		_buffer = new T[size];
+	}
+
+	~SPSCRingBuffer() {
+		delete[] _buffer;
+	}
+
+	/**
+	 * Append an element. Producer only.
+	 * @return false if the queue is full.
+	 */
+	bool push(const T &value) {
+		const uint32 head = _head;
+		if (head - atomicLoadAcquire(&_tail) > _mask)
+			return false;
+
+		_buffer[head & _mask] = value;
+		atomicStoreRelease(&_head, head + 1);
+		return true;
+	}
+
+	/**
+	 * Remove the oldest element and store it in value. Consumer only.
+	 * @return false if the queue is empty.
+	 */
+	bool pop(T &value) {
+		const uint32 tail = _tail;
+		if (atomicLoadAcquire(&_head) == tail)
+			return false;
+
+		value = _buffer[tail & _mask];
+		atomicStoreRelease(&_tail, tail + 1);
+		return true;
+	}
+
+	/**
+	 * Return the oldest element without removing it, or nullptr if the queue
+	 * is empty. Consumer only.
+	 */
+	T *front() {
+		const uint32 tail = _tail;
+		if (atomicLoadAcquire(&_head) == tail)
+			return nullptr;
+		return &_buffer[tail & _mask];
+	}
+
+	/**
+	 * Return the number of queued elements. If called from a thread other
+	 * than the consumer or producer, the result may be outdated as soon as
+	 * it is returned.
+	 */
+	size_type size() const {
+		const uint32 tail = atomicLoadAcquire(&_tail);
+		return atomicLoadAcquire(&_head) - tail;
+	}
+
+	bool empty() const { return size() == 0; }
+	size_type capacity() const { return _mask + 1; }
+
+private:
+	T *_buffer;
+	uint32 _mask;
+
+	// Keep the indices on separate cache lines, so producer and consumer
+	// do not invalidate each other's cache on every access. Both only ever
+	// grow and wrap around at 2^32; their difference is the queue size.
+	volatile uint32 _head;		///< Next slot to write, owned by the producer.
+	byte _padding[64 - sizeof(uint32)];
+	volatile uint32 _tail;		///< Next slot to read, owned by the consumer.
+};
+
+} // End of namespace Common
+
+#endif
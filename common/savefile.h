@@ -142,6 +142,23 @@ public:
 	 */
 	virtual OutSaveFile *openForSaving(const String &name, bool compress = true) = 0;
 
+	/**
+	 * Open a savefile which is rewritten often, such as an autosave, for
+	 * saving.
+	 *
+	 * Managers may store such a savefile as the differences to an earlier
+	 * version, kept in a hidden file. It is still loaded, copied, renamed
+	 * and removed like any other savefile, but the file itself can not be
+	 * read without this manager. The default implementation is the same as
+	 * openForSaving().
+	 *
+	 * @param name      The name of the savefile.
+	 * @param compress  Toggles whether to compress the resulting save file
+	 *                  (default) or not.
+	 * @return Pointer to an OutSaveFile, or NULL if an error occurred.
+	 */
+	virtual OutSaveFile *openForAutosaving(const String &name, bool compress = true) { return openForSaving(name, compress); }
+
 	/**
 	 * Open the file with the specified name in the given directory for loading.
 	 *
@@ -204,6 +221,28 @@ public:
 	 * for saving or loading because they are being synced by CloudManager.
 	 */
 	virtual void updateSavefilesList(StringArray &lockedFiles) = 0;
+
+	/**
+	 * Wait until all savefiles finalized so far are written.
+	 *
+	 * Savefile managers may write savefiles in the background once they are
+	 * finalized, in which case errors occurring then are only reported here.
+	 *
+	 * @return true if all of them were written successfully, false otherwise.
+	 */
+	virtual bool waitForPendingWrites() { return true; }
+
+	/**
+	 * Return a counter which changes whenever savefiles are created, changed
+	 * or removed through this manager, or the list of savefiles changed
+	 * otherwise. It allows callers to cache information parsed from
+	 * savefiles.
+	 *
+	 * @param count  Set to the current value of the counter.
+	 * @return true if the manager tracks changes, false if cached information
+	 *         can never be assumed to be up to date.
+	 */
+	virtual bool getChangeCount(uint32 &count) { return false; }
 };
 
 } // End of namespace Common
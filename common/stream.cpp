@@ -32,6 +32,79 @@ void WriteStream::writeString(const String &str) {
 	write(str.c_str(), str.size());
 }
 
+namespace {
+
+// Plain loops, which compilers turn into vector code where available.
+void swapArray16(uint16 *data, uint32 count) {
+	for (uint32 i = 0; i < count; ++i)
+		data[i] = SWAP_BYTES_16(data[i]);
+}
+
+void swapArray32(uint32 *data, uint32 count) {
+	for (uint32 i = 0; i < count; ++i)
+		data[i] = SWAP_BYTES_32(data[i]);
+}
+
+// Floats are swapped bytewise, to not access them through an integer
+// pointer.
+void swapArray32Bytes(void *data, uint32 count) {
+	byte *b = (byte *)data;
+	for (uint32 i = 0; i < count; ++i, b += 4) {
+		SWAP(b[0], b[3]);
+		SWAP(b[1], b[2]);
+	}
+}
+
+} // End of anonymous namespace
+
+uint32 ReadStream::readUint16ArrayLE(uint16 *dst, uint32 count) {
+	count = read(dst, count * 2) / 2;
+#ifdef SCUMM_BIG_ENDIAN
+	swapArray16(dst, count);
+#endif
+	return count;
+}
+
+uint32 ReadStream::readUint16ArrayBE(uint16 *dst, uint32 count) {
+	count = read(dst, count * 2) / 2;
+#ifdef SCUMM_LITTLE_ENDIAN
+	swapArray16(dst, count);
+#endif
+	return count;
+}
+
+uint32 ReadStream::readUint32ArrayLE(uint32 *dst, uint32 count) {
+	count = read(dst, count * 4) / 4;
+#ifdef SCUMM_BIG_ENDIAN
+	swapArray32(dst, count);
+#endif
+	return count;
+}
+
+uint32 ReadStream::readUint32ArrayBE(uint32 *dst, uint32 count) {
+	count = read(dst, count * 4) / 4;
+#ifdef SCUMM_LITTLE_ENDIAN
+	swapArray32(dst, count);
+#endif
+	return count;
+}
+
+uint32 ReadStream::readFloatArrayLE(float *dst, uint32 count) {
+	count = read(dst, count * 4) / 4;
+#ifdef SCUMM_BIG_ENDIAN
+	swapArray32Bytes(dst, count);
+#endif
+	return count;
+}
+
+uint32 ReadStream::readFloatArrayBE(float *dst, uint32 count) {
+	count = read(dst, count * 4) / 4;
+#ifdef SCUMM_LITTLE_ENDIAN
+	swapArray32Bytes(dst, count);
+#endif
+	return count;
+}
+
 SeekableReadStream *ReadStream::readStream(uint32 dataSize) {
 	void *buf = malloc(dataSize);
 	dataSize = read(buf, dataSize);
@@ -261,6 +334,12 @@ bool SeekableSubReadStream::seek(int32 offset, int whence) {
 	return ret;
 }
 
+const byte *SeekableSubReadStream::getContiguousView(uint32 offset, uint32 size) const {
+	if (offset > _end - _begin || size > _end - _begin - offset)
+		return nullptr;
+	return _parentStream->getContiguousView(_begin + offset, size);
+}
+
 uint32 SafeSeekableSubReadStream::read(void *dataPtr, uint32 dataSize) {
 	// Make sure the parent stream is at the right position
 	seek(0, SEEK_CUR);
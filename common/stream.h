@@ -443,6 +443,91 @@ public:
 		return f;
 	}
 
+	/**
+	 * Read an array of unsigned 16-bit words stored in little endian
+	 * (LSB first) order from the stream.
+	 * This is considerably faster than calling readUint16LE() in a loop,
+	 * since all data is fetched with a single read() and then converted
+	 * in place.
+	 *
+	 * @param dst	the buffer to store the values in
+	 * @param count	the number of values to read
+	 * @return the number of values which were actually read; check err()
+	 *         and eos() to find out why, if it is less than count.
+	 */
+	uint32 readUint16ArrayLE(uint16 *dst, uint32 count);
+
+	/**
+	 * Read an array of unsigned 16-bit words stored in big endian
+	 * (MSB first) order from the stream.
+	 * @see readUint16ArrayLE
+	 */
+	uint32 readUint16ArrayBE(uint16 *dst, uint32 count);
+
+	/**
+	 * Read an array of unsigned 32-bit words stored in little endian
+	 * (LSB first) order from the stream.
+	 * @see readUint16ArrayLE
+	 */
+	uint32 readUint32ArrayLE(uint32 *dst, uint32 count);
+
+	/**
+	 * Read an array of unsigned 32-bit words stored in big endian
+	 * (MSB first) order from the stream.
+	 * @see readUint16ArrayLE
+	 */
+	uint32 readUint32ArrayBE(uint32 *dst, uint32 count);
+
+	/**
+	 * Read an array of signed 16-bit words stored in little endian
+	 * (LSB first) order from the stream.
+	 * @see readUint16ArrayLE
+	 */
+	FORCEINLINE uint32 readSint16ArrayLE(int16 *dst, uint32 count) {
+		return readUint16ArrayLE((uint16 *)dst, count);
+	}
+
+	/**
+	 * Read an array of signed 16-bit words stored in big endian
+	 * (MSB first) order from the stream.
+	 * @see readUint16ArrayLE
+	 */
+	FORCEINLINE uint32 readSint16ArrayBE(int16 *dst, uint32 count) {
+		return readUint16ArrayBE((uint16 *)dst, count);
+	}
+
+	/**
+	 * Read an array of signed 32-bit words stored in little endian
+	 * (LSB first) order from the stream.
+	 * @see readUint16ArrayLE
+	 */
+	FORCEINLINE uint32 readSint32ArrayLE(int32 *dst, uint32 count) {
+		return readUint32ArrayLE((uint32 *)dst, count);
+	}
+
+	/**
+	 * Read an array of signed 32-bit words stored in big endian
+	 * (MSB first) order from the stream.
+	 * @see readUint16ArrayLE
+	 */
+	FORCEINLINE uint32 readSint32ArrayBE(int32 *dst, uint32 count) {
+		return readUint32ArrayBE((uint32 *)dst, count);
+	}
+
+	/**
+	 * Read an array of 32-bit floating point values stored in little
+	 * endian (LSB first) order from the stream.
+	 * @see readUint16ArrayLE
+	 */
+	uint32 readFloatArrayLE(float *dst, uint32 count);
+
+	/**
+	 * Read an array of 32-bit floating point values stored in big
+	 * endian (MSB first) order from the stream.
+	 * @see readUint16ArrayLE
+	 */
+	uint32 readFloatArrayBE(float *dst, uint32 count);
+
 	/**
 	 * Read the specified amount of data into a malloc'ed buffer
 	 * which then is wrapped into a MemoryReadStream.
@@ -511,6 +596,22 @@ public:
 	 */
 	virtual bool skip(uint32 offset) { return seek(offset, SEEK_CUR); }
 
+	/**
+	 * Returns a pointer to the data of the given range of the stream, if
+	 * the stream is backed by one contiguous block of memory. This allows
+	 * to decode data in place, instead of reading it into a freshly
+	 * allocated buffer first. The stream position is not changed.
+	 *
+	 * The pointer stays valid as long as the stream (and, for sub streams,
+	 * their parent stream) is alive.
+	 *
+	 * @param offset	the start of the range, relative to the stream start
+	 * @param size		the size of the range in bytes
+	 * @return a pointer to the range, or 0 if the stream is not memory
+	 *         backed or the range is not completely inside the stream
+	 */
+	virtual const byte *getContiguousView(uint32 offset, uint32 size) const { return nullptr; }
+
 	/**
 	 * Reads at most one less than the number of characters specified
 	 * by bufSize from the and stores them in the string buf. Reading
@@ -77,6 +77,12 @@ public:
 	virtual int32 size() const { return _end - _begin; }
 
 	virtual bool seek(int32 offset, int whence = SEEK_SET);
+
+	/**
+	 * Forwards to the parent stream, so sub streams of memory backed streams
+	 * can be decoded in place as well.
+	 */
+	virtual const byte *getContiguousView(uint32 offset, uint32 size) const;
 };
 
 /**
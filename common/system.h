@@ -37,6 +37,10 @@ namespace Graphics {
 struct Surface;
 }
 
+namespace Image {
+class PacketCodec;
+}
+
 namespace Common {
 class EventManager;
 struct Rect;
@@ -93,6 +97,22 @@ enum Type {
 
 } // End of namespace LogMessageType
 
+/**
+ * Interface for users of the buffer returned by OSystem::getScreenBuffer(),
+ * which the backend tells before it frees that buffer.
+ */
+class ScreenBufferListener {
+public:
+	virtual ~ScreenBufferListener() {}
+
+	/**
+	 * Called right before the screen buffer is freed, for example because
+	 * the screen size or format changes. The pixels are still valid during
+	 * the call, but must not be used anymore afterwards.
+	 */
+	virtual void screenBufferReleased() = 0;
+};
+
 /**
  * Interface for ScummVM backends. If you want to port ScummVM to a system
  * which is not currently covered by any of our backends, this is the place
@@ -778,6 +798,42 @@ public:
 	 */
 	virtual void unlockScreen() = 0;
 
+	/**
+	 * Return the game screen buffer of the backend, so that engines can
+	 * draw into it directly instead of into a buffer of their own which is
+	 * then copied with copyRectToScreen().
+	 *
+	 * Unlike the surface returned by lockScreen(), the buffer needs no
+	 * locking and keeps its contents. Changes to it are only shown once
+	 * they have been passed to markScreenDirty().
+	 *
+	 * The buffer has a single user at a time. The backend calls the
+	 * screenBufferReleased() method of the listener before it frees the
+	 * buffer, or when another listener asks for it. The listener stays
+	 * registered until then or until releaseScreenBuffer() is called, and
+	 * must not be destroyed before.
+	 *
+	 * The returned surface must *not* be deleted by the client code.
+	 *
+	 * @param listener	the object to tell when the buffer is freed
+	 * @return the screen buffer, or 0 if the backend does not support
+	 *         drawing into it directly
+	 * @see getScreenFormat
+	 */
+	virtual Graphics::Surface *getScreenBuffer(ScreenBufferListener *listener) { return 0; }
+
+	/**
+	 * Stop using the buffer returned by getScreenBuffer(). Does nothing if
+	 * the listener does not use the buffer anymore.
+	 */
+	virtual void releaseScreenBuffer(ScreenBufferListener *listener) {}
+
+	/**
+	 * Mark an area of the buffer returned by getScreenBuffer() as changed,
+	 * so that the next updateScreen() call shows it.
+	 */
+	virtual void markScreenDirty(const Common::Rect &r) {}
+
 	/**
 	 * Fills the screen with a given color value.
 	 *
@@ -994,9 +1050,30 @@ public:
 	*/
 	virtual uint32 getMillis(bool skipRecord = false) = 0;
 
+	/**
+	 * Get the number of microseconds since an arbitrary point in time.
+	 * This is meant for profiling and for scheduling timers, so the value
+	 * is never recorded by the event recorder. The default implementation
+	 * is only as precise as getMillis().
+	 */
+	virtual uint64 getMicros() { return (uint64)getMillis(true) * 1000; }
+
 	/** Delay/sleep for the specified amount of milliseconds. */
 	virtual void delayMillis(uint msecs) = 0;
 
+	/**
+	 * Wait until an event is available or the specified amount of
+	 * milliseconds has elapsed, whichever comes first. Available events
+	 * can then be fetched with EventManager::pollEvent.
+	 *
+	 * Loops which poll for events should prefer this over delayMillis,
+	 * so that input is handled without added latency while the process
+	 * can still sleep when idle.
+	 *
+	 * The default implementation delays for the whole amount of time.
+	 */
+	virtual void waitForEvents(uint msecs) { delayMillis(msecs); }
+
 	/**
 	 * Get the current time and date, in the local timezone.
 	 * Corresponds on many systems to the combination of time()
@@ -1113,6 +1190,71 @@ public:
 
 
 
+	/**
+	 * @name Thread handling
+	 * Backends which support running code on additional threads can
+	 * implement these methods; they are used by Common::JobSystem to spread
+	 * work over the available CPU cores. The default implementations report
+	 * that threads are not available, in which case all work is done on the
+	 * calling thread.
+	 *
+	 * Backends implementing these methods must also provide real (i.e. non
+	 * dummy) mutexes.
+	 */
+	//@{
+
+	typedef struct OpaqueThread *ThreadRef;
+	typedef struct OpaqueSemaphore *SemaphoreRef;
+	typedef void (*ThreadProc)(void *param);
+
+	/**
+	 * Start a new thread which runs proc(param).
+	 * @return the newly created thread, or 0 if threads are not supported
+	 *         or an error occurred.
+	 */
+	virtual ThreadRef createThread(ThreadProc proc, void *param) { return 0; }
+
+	/**
+	 * Wait until the given thread has finished, and free its resources.
+	 * @param thread	the thread to wait for.
+	 */
+	virtual void joinThread(ThreadRef thread) {}
+
+	/**
+	 * Return the number of CPU cores available to ScummVM, which is a hint
+	 * for how many threads are worth creating.
+	 */
+	virtual uint getCPUCount() { return 1; }
+
+	/**
+	 * Create a new counting semaphore.
+	 * @param initialValue	the initial value of the semaphore.
+	 * @return the newly created semaphore, or 0 if an error occurred.
+	 */
+	virtual SemaphoreRef createSemaphore(uint initialValue) { return 0; }
+
+	/**
+	 * Wait until the value of the semaphore is positive, then decrement it.
+	 * @param sem	the semaphore to wait on.
+	 */
+	virtual void waitSemaphore(SemaphoreRef sem) {}
+
+	/**
+	 * Increment the value of the semaphore, waking up one waiting thread.
+	 * @param sem	the semaphore to post.
+	 */
+	virtual void postSemaphore(SemaphoreRef sem) {}
+
+	/**
+	 * Delete the given semaphore. No thread may be waiting on it.
+	 * @param sem	the semaphore to delete.
+	 */
+	virtual void deleteSemaphore(SemaphoreRef sem) {}
+
+	//@}
+
+
+
 	/** @name Sound */
 	//@{
 
@@ -1141,6 +1283,32 @@ public:
 
 
 
+	/** @name Video */
+	//@{
+
+	/**
+	 * Create a codec which decodes video streams with the decoding hardware
+	 * of the platform, e.g. through VA-API, VideoToolbox or MediaCodec.
+	 * Video decoders fall back to their software codecs if the backend
+	 * does not provide one.
+	 *
+	 * Supported tags:
+	 *  - MKTAG('M','P','G','2'): MPEG-1 and MPEG-2 video elementary streams
+	 *
+	 * @param tag    the compression of the stream
+	 * @param width  the width of the frames
+	 * @param height the height of the frames
+	 * @param format the format the frames are to be decoded into
+	 * @return the codec, or nullptr if the hardware cannot decode the stream
+	 */
+	virtual Image::PacketCodec *createHardwareVideoCodec(uint32 tag, uint width, uint height, const Graphics::PixelFormat &format) {
+		return nullptr;
+	}
+
+	//@}
+
+
+
 	/** @name Miscellaneous */
 	//@{
 	/** Quit (exit) the application. */
@@ -41,7 +41,9 @@ public:
 	 * written following the same safety guidelines as any other threaded code.
 	 *
 	 * @note Although the interval is specified in microseconds, the actual timer resolution
-	 *       may be lower. In particular, with the SDL backend the timer resolution is 10ms.
+	 *       may be lower. In particular, with the SDL backend the timer resolution is 1ms.
+	 *       Over time the callback is invoked at the requested rate nevertheless, since
+	 *       every invocation is scheduled relative to the previous one.
 	 * @param proc		the callback
 	 * @param interval	the interval in which the timer shall be invoked (in microseconds)
 	 * @param refCon	an arbitrary void pointer; will be passed to the timer callback
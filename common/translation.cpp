@@ -46,7 +46,7 @@ bool operator<(const TLanguage &l, const TLanguage &r) {
 	return strcmp(l.name, r.name) < 0;
 }
 
-TranslationManager::TranslationManager() : _currentLang(-1), _charmap(nullptr) {
+TranslationManager::TranslationManager() : _currentLang(-1), _requestedLang(-1), _charmap(nullptr) {
 	loadTranslationsInfoDat();
 
 	// Set the default language
@@ -101,11 +101,15 @@ void TranslationManager::setLanguage(const String &lang) {
 		langIndex = findMatchingLanguage(langCut);
 	}
 
+	_requestedLang = langIndex;
+}
+
+void TranslationManager::loadRequestedLanguage() const {
 	// Load messages for that language.
 	// Call it even if the index is -1 to unload previously loaded translations.
-	if (langIndex != _currentLang) {
-		loadLanguageDat(langIndex);
-		_currentLang = langIndex;
+	if (_requestedLang != _currentLang) {
+		loadLanguageDat(_requestedLang);
+		_currentLang = _requestedLang;
 	}
 }
 
@@ -114,6 +118,8 @@ const char *TranslationManager::getTranslation(const char *message) const {
 }
 
 const char *TranslationManager::getTranslation(const char *message, const char *context) const {
+	loadRequestedLanguage();
+
 	// If no language is set or message is empty, return msgid as is
 	if (_currentTranslationMessages.empty() || *message == '\0')
 		return message;
@@ -166,15 +172,21 @@ const char *TranslationManager::getTranslation(const char *message, const char *
 }
 
 String TranslationManager::getCurrentCharset() const {
+	loadRequestedLanguage();
 	if (_currentCharset.empty())
 		return "ASCII";
 	return _currentCharset;
 }
 
 String TranslationManager::getCurrentLanguage() const {
-	if (_currentLang == -1)
+	if (_requestedLang == -1)
 		return "C";
-	return _langs[_currentLang];
+	return _langs[_requestedLang];
+}
+
+const uint32 *TranslationManager::getCharsetMapping() const {
+	loadRequestedLanguage();
+	return _charmap;
 }
 
 String TranslationManager::getTranslation(const String &message) const {
@@ -224,7 +236,7 @@ String TranslationManager::getLangById(int id) const {
 	return "";
 }
 
-bool TranslationManager::openTranslationsFile(File &inFile) {
+bool TranslationManager::openTranslationsFile(File &inFile) const {
 	// First look in the Themepath if we can find the file.
 	if (ConfMan.hasKey("themepath") && openTranslationsFile(FSNode(ConfMan.get("themepath")), inFile))
 		return true;
@@ -245,7 +257,7 @@ bool TranslationManager::openTranslationsFile(File &inFile) {
 	return false;
 }
 
-bool TranslationManager::openTranslationsFile(const FSNode &node, File &inFile, int depth) {
+bool TranslationManager::openTranslationsFile(const FSNode &node, File &inFile, int depth) const {
 	if (!node.exists() || !node.isReadable() || !node.isDirectory())
 		return false;
 
@@ -336,7 +348,7 @@ void TranslationManager::loadTranslationsInfoDat() {
 	}
 }
 
-void TranslationManager::loadLanguageDat(int index) {
+void TranslationManager::loadLanguageDat(int index) const {
 	_currentTranslationMessages.clear();
 	_currentCharset.clear();
 	// Sanity check
@@ -428,7 +440,7 @@ void TranslationManager::loadLanguageDat(int index) {
 
 }
 
-bool TranslationManager::checkHeader(File &in) {
+bool TranslationManager::checkHeader(File &in) const {
 	char buf[13];
 	int ver;
 
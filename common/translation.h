@@ -83,6 +83,9 @@ public:
 	 * parameter. If the parameter is an empty string, it sets the default
 	 * system language.
 	 *
+	 * The messages of the language are only loaded once a translation is
+	 * needed, as the language may be set several times during startup.
+	 *
 	 * @param lang Language to setup.
 	 */
 	void setLanguage(const String &lang);
@@ -167,7 +170,7 @@ public:
 	 * The return value might be 0 in case it's a default ASCII/ISO-8859-1
 	 * map.
 	 */
-	const uint32 *getCharsetMapping() const { return _charmap; }
+	const uint32 *getCharsetMapping() const;
 
 	/**
 	 * Returns currently selected translation language
@@ -189,13 +192,13 @@ private:
 	 * then if needed using the Themepath. If found it opens the given File
 	 * to read the translations.dat file.
 	 */
-	bool openTranslationsFile(File &);
+	bool openTranslationsFile(File &) const;
 
 	/**
 	 * Find the translations.dat file in the given directory node.
 	 * If found it opens the given File to read the translations.dat file.
 	 */
-	bool openTranslationsFile(const FSNode &node, File &, int depth = -1);
+	bool openTranslationsFile(const FSNode &node, File &, int depth = -1) const;
 
 	/**
 	 * Load the list of languages from the translations.dat file
@@ -207,24 +210,33 @@ private:
 	 *
 	 * @param index of the language in the list of languages
 	 */
-	void loadLanguageDat(int index);
+	void loadLanguageDat(int index) const;
+
+	/**
+	 * Load the messages of the language last set, if they are not loaded yet.
+	 */
+	void loadRequestedLanguage() const;
 
 	/**
 	 * Check the header of the given file to make sure it is a valid translations data file.
 	 */
-	bool checkHeader(File &in);
+	bool checkHeader(File &in) const;
 
 	StringArray _langs;
 	StringArray _langNames;
 	StringArray _charmaps;
 
 	StringArray _messageIds;
-	Array<PoMessageEntry> _currentTranslationMessages;
-	String _currentCharset;
-	int _currentLang;
+
+	// The messages of the requested language are loaded on first use, from
+	// const lookups as well.
+	mutable Array<PoMessageEntry> _currentTranslationMessages;
+	mutable String _currentCharset;
+	mutable int _currentLang;	///< The language whose messages are loaded
+	int _requestedLang;			///< The language last set
 
 	uint32 _charmapStart;
-	uint32 *_charmap;
+	mutable uint32 *_charmap;
 };
 
 } // End of namespace Common
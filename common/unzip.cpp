@@ -106,6 +106,11 @@ typedef struct {
 #include "common/fs.h"
 #include "common/unzip.h"
 #include "common/memstream.h"
+#include "common/bufferedstream.h"
+#include "common/ptr.h"
+#include "common/substream.h"
+#include "common/system.h"
+#include "common/zlib.h"
 
 #include "common/hashmap.h"
 #include "common/hash-str.h"
@@ -382,6 +387,7 @@ typedef Common::HashMap<Common::String, cached_file_in_zip, Common::IgnoreCase_H
 */
 typedef struct {
 	Common::SeekableReadStream *_stream;				/* io structore of the zipfile */
+	Common::SharedPtr<Common::SeekableReadStream> _streamRef;	/* owns _stream, shared with streamed members */
 	unz_global_info gi;				/* public global information */
 	uLong byte_before_the_zipfile;	/* byte before the zipfile, (>0 for sfx)*/
 	uLong num_file;					/* number of the current file in the zipfile*/
@@ -544,6 +550,7 @@ unzFile unzOpen(Common::SeekableReadStream *stream) {
 	int err=UNZ_OK;
 
 	us->_stream = stream;
+	us->_streamRef = Common::SharedPtr<Common::SeekableReadStream>(stream);
 
 	central_pos = unzlocal_SearchCentralDir(*us->_stream);
 	if (central_pos==0)
@@ -595,7 +602,6 @@ unzFile unzOpen(Common::SeekableReadStream *stream) {
 		err=UNZ_BADZIPFILE;
 
 	if (err != UNZ_OK) {
-		delete us->_stream;
 		delete us;
 		return nullptr;
 	}
@@ -605,13 +611,24 @@ unzFile unzOpen(Common::SeekableReadStream *stream) {
 	us->central_pos = central_pos;
 	us->pfile_in_zip_read = nullptr;
 
+	// Building the index reads each central directory entry in many tiny
+	// pieces, so read through a buffer for the time being.
+	Common::ScopedPtr<Common::SeekableReadStream> buffered(
+		Common::wrapBufferedSeekableReadStream(stream, 64 * 1024, DisposeAfterUse::NO));
+	us->_stream = buffered.get();
+
 	err = unzGoToFirstFile((unzFile)us);
 
 	while (err == UNZ_OK) {
-		// Get the file details
+		// Get the file name. The rest of the entry has already been parsed
+		// by unzGoToFirstFile()/unzGoToNextFile(), so don't do it again.
 		char szCurrentFileName[UNZ_MAXFILENAMEINZIP+1];
-		unzGetCurrentFileInfo(us, nullptr, szCurrentFileName, sizeof(szCurrentFileName) - 1,
-							nullptr, 0, nullptr, 0);
+		uLong nameSize = us->cur_file_info.size_filename;
+		if (nameSize > UNZ_MAXFILENAMEINZIP)
+			nameSize = UNZ_MAXFILENAMEINZIP;
+		us->_stream->seek(us->pos_in_central_dir + us->byte_before_the_zipfile + SIZECENTRALDIRITEM, SEEK_SET);
+		nameSize = us->_stream->read(szCurrentFileName, nameSize);
+		szCurrentFileName[nameSize] = '\0';
 
 		// Save details into the hash
 		cached_file_in_zip fe;
@@ -626,6 +643,8 @@ unzFile unzOpen(Common::SeekableReadStream *stream) {
 		// Move to the next file
 		err = unzGoToNextFile((unzFile)us);
 	}
+
+	us->_stream = stream;
 	return (unzFile)us;
 }
 
@@ -644,7 +663,6 @@ int unzClose(unzFile file) {
 	if (s->pfile_in_zip_read != nullptr)
 		unzCloseCurrentFile(file);
 
-	delete s->_stream;
 	delete s;
 	return UNZ_OK;
 }
@@ -1420,9 +1438,53 @@ int unzGetGlobalComment(unzFile file, char *szComment, uLong uSizeBuf) {
 namespace Common {
 
 
+/**
+ * The mutex guarding the archive file. It is shared with the streamed
+ * members, which may outlive the archive. Not set up if the archive was
+ * opened without a backend.
+ */
+class ZipStreamMutex {
+	OSystem::MutexRef _mutex;
+
+public:
+	ZipStreamMutex() : _mutex(g_system ? g_system->createMutex() : nullptr) {}
+
+	~ZipStreamMutex() {
+		if (_mutex)
+			g_system->deleteMutex(_mutex);
+	}
+
+	void lock() {
+		if (_mutex)
+			g_system->lockMutex(_mutex);
+	}
+
+	void unlock() {
+		if (_mutex)
+			g_system->unlockMutex(_mutex);
+	}
+};
+
 class ZipArchive : public Archive {
 	unzFile _zipFile;
 
+	/**
+	 * Members at least this large are decompressed on the fly instead of
+	 * being read into memory as a whole.
+	 */
+	static const uint32 kStreamingThreshold = 1024 * 1024;
+
+	/**
+	 * Guards the current file state of _zipFile and the position of the
+	 * archive file, so members can be opened and read from several threads.
+	 */
+	SharedPtr<ZipStreamMutex> _mutex;
+
+	SeekableReadStream *createStreamingMember(const unz_file_info &fileInfo) const;
+	byte *readRawCurrentMember(const unz_file_info &fileInfo) const;
+	void lock() const;
+	void unlock() const;
+
 public:
 	ZipArchive(unzFile zipFile);
 
@@ -1453,7 +1515,7 @@ public:
 };
 */
 
-ZipArchive::ZipArchive(unzFile zipFile) : _zipFile(zipFile) {
+ZipArchive::ZipArchive(unzFile zipFile) : _zipFile(zipFile), _mutex(new ZipStreamMutex()) {
 	assert(_zipFile);
 }
 
@@ -1461,8 +1523,19 @@ ZipArchive::~ZipArchive() {
 	unzClose(_zipFile);
 }
 
+void ZipArchive::lock() const {
+	_mutex->lock();
+}
+
+void ZipArchive::unlock() const {
+	_mutex->unlock();
+}
+
 bool ZipArchive::hasFile(const String &name) const {
-	return (unzLocateFile(_zipFile, name.c_str(), 2) == UNZ_OK);
+	// The index never changes after opening, so unlike unzLocateFile(),
+	// which also selects the file, this does not need the lock.
+	const unz_s *const archive = (const unz_s *)_zipFile;
+	return name.size() < UNZ_MAXFILENAMEINZIP && archive->_hash.contains(name);
 }
 
 int ZipArchive::listMembers(ArchiveMemberList &list) const {
@@ -1485,36 +1558,131 @@ const ArchiveMemberPtr ZipArchive::getMember(const String &name) const {
 	return ArchiveMemberPtr(new GenericArchiveMember(name, this));
 }
 
-SeekableReadStream *ZipArchive::createReadStreamForMember(const String &name) const {
-	if (unzLocateFile(_zipFile, name.c_str(), 2) != UNZ_OK)
+/**
+ * A view of a member's data inside the archive file. It keeps the archive
+ * file alive, so the member may outlive the ZipArchive, and it restores
+ * the file position before each read while holding the archive's mutex,
+ * so several members can be used at the same time, from any thread.
+ */
+class ZipMemberReadStream : public SafeSeekableSubReadStream {
+	SharedPtr<SeekableReadStream> _archiveStream;
+	SharedPtr<ZipStreamMutex> _mutex;
+
+public:
+	ZipMemberReadStream(const SharedPtr<SeekableReadStream> &archiveStream, const SharedPtr<ZipStreamMutex> &mutex, uint32 begin, uint32 end)
+		: SafeSeekableSubReadStream(archiveStream.get(), begin, end, DisposeAfterUse::NO),
+		  _archiveStream(archiveStream), _mutex(mutex) {
+	}
+
+	virtual uint32 read(void *dataPtr, uint32 dataSize) {
+		_mutex->lock();
+		const uint32 size = SafeSeekableSubReadStream::read(dataPtr, dataSize);
+		_mutex->unlock();
+		return size;
+	}
+
+	virtual bool seek(int32 offset, int whence = SEEK_SET) {
+		_mutex->lock();
+		const bool result = SafeSeekableSubReadStream::seek(offset, whence);
+		_mutex->unlock();
+		return result;
+	}
+};
+
+SeekableReadStream *ZipArchive::createStreamingMember(const unz_file_info &fileInfo) const {
+	const unz_s *const archive = (const unz_s *)_zipFile;
+	const file_in_zip_read_info_s *const info = archive->pfile_in_zip_read;
+
+	const uint32 begin = info->pos_in_zipfile + info->byte_before_the_zipfile;
+	SeekableReadStream *data = new ZipMemberReadStream(archive->_streamRef, _mutex, begin, begin + fileInfo.compressed_size);
+
+	if (fileInfo.compression_method == 0)
+		return data;
+
+	// The CRC is not checked in this case, since the data is not
+	// necessarily ever read in full.
+	return wrapDeflateReadStream(data, fileInfo.uncompressed_size);
+}
+
+byte *ZipArchive::readRawCurrentMember(const unz_file_info &fileInfo) const {
+	const unz_s *const archive = (const unz_s *)_zipFile;
+	const file_in_zip_read_info_s *const info = archive->pfile_in_zip_read;
+
+	byte *buffer = (byte *)malloc(fileInfo.compressed_size);
+	assert(buffer);
+
+	archive->_stream->seek(info->pos_in_zipfile + info->byte_before_the_zipfile, SEEK_SET);
+	if (archive->_stream->read(buffer, fileInfo.compressed_size) != fileInfo.compressed_size) {
+		free(buffer);
 		return nullptr;
+	}
+	return buffer;
+}
 
+SeekableReadStream *ZipArchive::createReadStreamForMember(const String &name) const {
 	unz_file_info fileInfo;
-	if (unzOpenCurrentFile(_zipFile) != UNZ_OK)
-		return nullptr;
 
-	if (unzGetCurrentFileInfo(_zipFile, &fileInfo, nullptr, 0, nullptr, 0, nullptr, 0) != UNZ_OK)
+	lock();
+
+	if (unzLocateFile(_zipFile, name.c_str(), 2) != UNZ_OK ||
+	    unzOpenCurrentFile(_zipFile) != UNZ_OK ||
+	    unzGetCurrentFileInfo(_zipFile, &fileInfo, nullptr, 0, nullptr, 0, nullptr, 0) != UNZ_OK) {
+		unlock();
 		return nullptr;
+	}
+
+	if (fileInfo.uncompressed_size >= kStreamingThreshold) {
+		SeekableReadStream *stream = createStreamingMember(fileInfo);
+		unzCloseCurrentFile(_zipFile);
+		unlock();
+		return stream;
+	}
+
+#if defined(USE_ZLIB)
+	if (fileInfo.compression_method == Z_DEFLATED && fileInfo.uncompressed_size > 0) {
+		// Only fetch the compressed data while holding the lock, so that
+		// members opened from several threads are decompressed in parallel.
+		byte *compressed = readRawCurrentMember(fileInfo);
+		unzCloseCurrentFile(_zipFile);
+		unlock();
+
+		if (!compressed)
+			return nullptr;
+
+		byte *buffer = (byte *)malloc(fileInfo.uncompressed_size);
+		assert(buffer);
+
+		const bool success = Common::inflateZlibHeaderless(buffer, fileInfo.uncompressed_size, compressed, fileInfo.compressed_size) &&
+		                     crc32(0, buffer, fileInfo.uncompressed_size) == fileInfo.crc;
+		free(compressed);
+
+		if (!success) {
+			free(buffer);
+			return nullptr;
+		}
+
+		return new MemoryReadStream(buffer, fileInfo.uncompressed_size, DisposeAfterUse::YES);
+	}
+#endif
 
 	byte *buffer = (byte *)malloc(fileInfo.uncompressed_size);
 	assert(buffer);
 
 	if (unzReadCurrentFile(_zipFile, buffer, fileInfo.uncompressed_size) != (int)fileInfo.uncompressed_size) {
+		unzCloseCurrentFile(_zipFile);
+		unlock();
 		free(buffer);
 		return nullptr;
 	}
 
 	if (unzCloseCurrentFile(_zipFile) != UNZ_OK) {
+		unlock();
 		free(buffer);
 		return nullptr;
 	}
 
+	unlock();
 	return new MemoryReadStream(buffer, fileInfo.uncompressed_size, DisposeAfterUse::YES);
-
-	// FIXME: instead of reading all into a memory stream, we could
-	// instead create a new ZipStream class. But then we have to be
-	// careful to handle the case where the client code opens multiple
-	// files in the archive and tries to use them independently.
 }
 
 Archive *makeZipArchive(const String &name) {
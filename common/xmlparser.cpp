@@ -28,6 +28,39 @@
 
 namespace Common {
 
+namespace {
+
+/** The types of records in the compiled form of a file */
+enum {
+	kCompiledOpenKey = 1,	///< A key which is closed by a later kCompiledCloseKey
+	kCompiledClosedKey = 2,	///< A self-closed key
+	kCompiledCloseKey = 3
+};
+
+void writeCompiledString(WriteStream &stream, const String &str) {
+	assert(str.size() <= 0xFFFF);
+	stream.writeUint16LE(str.size());
+	stream.write(str.c_str(), str.size());
+}
+
+String readCompiledString(SeekableReadStream &stream) {
+	const uint16 length = stream.readUint16LE();
+
+	char buffer[256];
+	if (length <= sizeof(buffer)) {
+		stream.read(buffer, length);
+		return String(buffer, length);
+	}
+
+	char *data = new char[length];
+	stream.read(data, length);
+	String str(data, length);
+	delete[] data;
+	return str;
+}
+
+} // End of anonymous namespace
+
 XMLParser::~XMLParser() {
 	while (!_activeKey.empty())
 		freeNode(_activeKey.pop());
@@ -80,6 +113,12 @@ void XMLParser::close() {
 bool XMLParser::parserError(const String &errStr) {
 	_state = kParserError;
 
+	if (!_stream) {
+		// Parsing the compiled form, which has no text to quote
+		g_system->logMessage(LogMessageType::kError, ("\n\nParser error: " + errStr + "\n\n").c_str());
+		return false;
+	}
+
 	const int startPosition = _stream->pos();
 	int currentPosition = startPosition;
 	int lineCount = 1;
@@ -387,6 +426,9 @@ bool XMLParser::parse() {
 
 		case kParserNeedPropertyName:
 			if (activeClosure) {
+				if (_compiled)
+					_compiled->writeByte(kCompiledCloseKey);
+
 				if (!closeKey()) {
 					parserError("Missing data when closing key '" + _activeKey.top()->name + "'.");
 					break;
@@ -411,6 +453,9 @@ bool XMLParser::parse() {
 			}
 
 			if (_char == '>') {
+				if (_compiled && !activeHeader)
+					writeCompiledKey(selfClosure);
+
 				if (activeHeader && !selfClosure) {
 					parserError("XML Header must be self-closed.");
 				} else if (parseActiveKey(selfClosure)) {
@@ -462,6 +507,82 @@ bool XMLParser::parse() {
 	return true;
 }
 
+bool XMLParser::parse(WriteStream &compiled) {
+	_compiled = &compiled;
+	bool result = parse();
+	_compiled = nullptr;
+
+	return result;
+}
+
+void XMLParser::writeCompiledKey(bool closed) {
+	const ParserNode *key = _activeKey.top();
+
+	_compiled->writeByte(closed ? kCompiledClosedKey : kCompiledOpenKey);
+	writeCompiledString(*_compiled, key->name);
+
+	_compiled->writeUint16LE(key->values.size());
+	for (StringMap::const_iterator i = key->values.begin(); i != key->values.end(); ++i) {
+		writeCompiledString(*_compiled, i->_key);
+		writeCompiledString(*_compiled, i->_value);
+	}
+}
+
+bool XMLParser::parseCompiled(SeekableReadStream &compiled) {
+	if (_XMLkeys == nullptr)
+		buildLayout();
+
+	while (!_activeKey.empty())
+		freeNode(_activeKey.pop());
+
+	cleanup();
+
+	_state = kParserNeedKey;
+
+	while (_state != kParserError) {
+		const byte type = compiled.readByte();
+		if (compiled.eos())
+			break;
+
+		if (type == kCompiledCloseKey) {
+			if (_activeKey.empty())
+				return parserError("Unexpected closure.");
+
+			const String name = _activeKey.top()->name;
+			if (!closeKey())
+				return parserError("Missing data when closing key '" + name + "'.");
+
+			continue;
+		}
+
+		ParserNode *node = allocNode();
+		node->name = readCompiledString(compiled);
+		node->ignore = false;
+		node->header = false;
+		node->depth = _activeKey.size();
+		node->layout = nullptr;
+
+		const uint16 valueCount = compiled.readUint16LE();
+		for (uint16 i = 0; i < valueCount; ++i) {
+			const String key = readCompiledString(compiled);
+			node->values[key] = readCompiledString(compiled);
+		}
+
+		_activeKey.push(node);
+
+		if (!parseActiveKey(type == kCompiledClosedKey))
+			return false;
+	}
+
+	if (_state == kParserError)
+		return false;
+
+	if (!_activeKey.empty())
+		return parserError("Unexpected end of file.");
+
+	return true;
+}
+
 bool XMLParser::skipSpaces() {
 	if (!isSpace(_char))
 		return false;
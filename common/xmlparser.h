@@ -37,6 +37,7 @@
 namespace Common {
 
 class SeekableReadStream;
+class WriteStream;
 
 #define MAX_XML_DEPTH 8
 
@@ -92,7 +93,7 @@ public:
 	/**
 	 * Parser constructor.
 	 */
-	XMLParser() : _XMLkeys(nullptr), _stream(nullptr) {}
+	XMLParser() : _XMLkeys(nullptr), _stream(nullptr), _compiled(nullptr) {}
 
 	virtual ~XMLParser();
 
@@ -187,6 +188,23 @@ public:
 	 */
 	bool parse();
 
+	/**
+	 * Parses the loaded data stream like parse(), and appends a compiled
+	 * form of it to a stream.
+	 *
+	 * The compiled form holds the keys and their values, already split into
+	 * tokens. parseCompiled() runs the same checks and callbacks on it as
+	 * parsing the XML did, without having to tokenize it again. Only the
+	 * XML header is left out.
+	 */
+	bool parse(WriteStream &compiled);
+
+	/**
+	 * Parses data in the compiled form written by parse(WriteStream &).
+	 * No data stream needs to be loaded for this.
+	 */
+	bool parseCompiled(SeekableReadStream &compiled);
+
 	/**
 	 * Returns the active node being parsed (the one on top of
 	 * the node stack).
@@ -340,6 +358,7 @@ private:
 	char _char;
 	SeekableReadStream *_stream;
 	String _fileName;
+	WriteStream *_compiled; /** Receives the compiled form while parsing, if set */
 
 	ParserState _state; /** Internal state of the parser */
 
@@ -347,6 +366,8 @@ private:
 	String _token; /** Current text token */
 
 	Stack<ParserNode *> _activeKey; /** Node stack of the parsed keys */
+
+	void writeCompiledKey(bool closed);
 };
 
 } // End of namespace Common
@@ -24,10 +24,12 @@
 #define FORBIDDEN_SYMBOL_ALLOW_ALL
 
 #include "common/zlib.h"
+#include "common/array.h"
 #include "common/ptr.h"
 #include "common/util.h"
 #include "common/stream.h"
 #include "common/debug.h"
+#include "common/profiler.h"
 #include "common/textconsole.h"
 
 #if defined(USE_ZLIB)
@@ -48,7 +50,11 @@ namespace Common {
 #if defined(USE_ZLIB)
 
 bool uncompress(byte *dst, unsigned long *dstLen, const byte *src, unsigned long srcLen) {
-	return Z_OK == ::uncompress(dst, dstLen, src, srcLen);
+	if (Z_OK != ::uncompress(dst, dstLen, src, srcLen))
+		return false;
+
+	PROFILE_COUNT("bytes decompressed", *dstLen);
+	return true;
 }
 
 bool inflateZlibHeaderless(byte *dst, uint dstLen, const byte *src, uint srcLen, const byte *dict, uint dictLen) {
@@ -145,18 +151,42 @@ bool inflateZlibInstallShield(byte *dst, uint dstLen, const byte *src, uint srcL
 static bool _shownBackwardSeekingWarning = false;
 #endif
 
+// zran style checkpoints need inflatePrime() and the block boundary
+// information reported by inflate(Z_BLOCK).
+#if ZLIB_VERNUM >= 0x1230
+#define ZLIB_HAS_CHECKPOINTS
+#endif
+
 /**
  * A simple wrapper class which can be used to wrap around an arbitrary
  * other SeekableReadStream and will then provide on-the-fly decompression support.
- * Assumes the compressed data to be in gzip format.
+ * Assumes the compressed data to be in gzip or zlib format, or to be raw
+ * deflate data if rawDeflate is set.
+ *
+ * While decompressing, the stream records a checkpoint at the first block
+ * boundary after every CHECKPOINT_SPAN bytes of output. A checkpoint holds
+ * the input position and the last 32KB of output, which is all inflate
+ * needs to resume from there, so seeking only has to decompress the data
+ * between the nearest checkpoint and the target instead of everything from
+ * the start of the stream.
  */
 class GZipReadStream : public SeekableReadStream {
 protected:
 	enum {
-		BUFSIZE = 16384		// 1 << MAX_WBITS
+		BUFSIZE = 16384,		// 1 << MAX_WBITS
+		WINDOWSIZE = 32768,		// The maximum deflate distance
+		CHECKPOINT_SPAN = 1024 * 1024
+	};
+
+	struct Checkpoint {
+		uint32 outPos;	///< Position in the decompressed data.
+		uint32 inPos;	///< Offset of the first input byte not fully consumed.
+		int bits;		///< Number of bits of the previous byte still unused.
+		byte *window;	///< The WINDOWSIZE bytes of output preceding outPos.
 	};
 
 	byte	_buf[BUFSIZE];
+	byte	_window[WINDOWSIZE];	///< Ring buffer of the most recent output, indexed by _pos.
 
 	ScopedPtr<SeekableReadStream> _wrapped;
 	z_stream _stream;
@@ -164,16 +194,82 @@ protected:
 	uint32 _pos;
 	uint32 _origSize;
 	bool _eos;
+	bool _rawDeflate;
+	Array<Checkpoint> _checkpoints;
+
+	void resetInflate(int windowBits) {
+		inflateEnd(&_stream);
+		_stream = z_stream();
+		_zlibErr = inflateInit2(&_stream, windowBits);
+
+		// Setup input buffer
+		_stream.next_in = _buf;
+		_stream.avail_in = 0;
+	}
+
+	void restart() {
+		_pos = 0;
+		_wrapped->seek(0, SEEK_SET);
+
+		// Adding 32 to windowBits indicates to zlib that it is supposed to
+		// automatically detect whether gzip or zlib headers are used for
+		// the compressed file. This feature was added in zlib 1.2.0.4,
+		// released 10 August 2003.
+		// Note: This is *crucial* for savegame compatibility, do *not* remove!
+		resetInflate(_rawDeflate ? -MAX_WBITS : MAX_WBITS + 32);
+	}
+
+#ifdef ZLIB_HAS_CHECKPOINTS
+	void addCheckpoint() {
+		Checkpoint cp;
+		cp.outPos = _pos;
+		cp.inPos = _wrapped->pos() - _stream.avail_in;
+		cp.bits = _stream.data_type & 7;
+		cp.window = (byte *)malloc(WINDOWSIZE);
+		if (!cp.window)
+			return;
+
+		// Unroll the ring buffer, oldest byte first.
+		const uint32 split = _pos & (WINDOWSIZE - 1);
+		memcpy(cp.window, _window + split, WINDOWSIZE - split);
+		memcpy(cp.window + WINDOWSIZE - split, _window, split);
+		_checkpoints.push_back(cp);
+	}
+
+	bool restoreCheckpoint(const Checkpoint &cp) {
+		// The gzip or zlib header has been dealt with before the checkpoint
+		// was taken, so resume with raw inflate.
+		resetInflate(-MAX_WBITS);
+		if (_zlibErr != Z_OK)
+			return false;
+
+		_wrapped->seek(cp.inPos - (cp.bits ? 1 : 0), SEEK_SET);
+		if (cp.bits) {
+			const byte partial = _wrapped->readByte();
+			_zlibErr = inflatePrime(&_stream, cp.bits, partial >> (8 - cp.bits));
+		}
+		if (_zlibErr == Z_OK)
+			_zlibErr = inflateSetDictionary(&_stream, cp.window, WINDOWSIZE);
+		if (_zlibErr != Z_OK)
+			return false;
+
+		const uint32 split = cp.outPos & (WINDOWSIZE - 1);
+		memcpy(_window + split, cp.window, WINDOWSIZE - split);
+		memcpy(_window, cp.window + WINDOWSIZE - split, split);
+		_pos = cp.outPos;
+		return true;
+	}
+#endif
 
 public:
 
-	GZipReadStream(SeekableReadStream *w, uint32 knownSize = 0) : _wrapped(w), _stream() {
+	GZipReadStream(SeekableReadStream *w, uint32 knownSize = 0, bool rawDeflate = false) : _wrapped(w), _stream(), _rawDeflate(rawDeflate) {
 		assert(w != nullptr);
 
 		// Verify file header is correct
 		w->seek(0, SEEK_SET);
-		uint16 header = w->readUint16BE();
-		assert(header == 0x1F8B ||
+		uint16 header = rawDeflate ? 0 : w->readUint16BE();
+		assert(rawDeflate || header == 0x1F8B ||
 		       ((header & 0x0F00) == 0x0800 && header % 31 == 0));
 
 		if (header == 0x1F8B) {
@@ -185,26 +281,15 @@ public:
 			// use an otherwise known size if supplied.
 			_origSize = knownSize;
 		}
-		_pos = 0;
-		w->seek(0, SEEK_SET);
 		_eos = false;
 
-		// Adding 32 to windowBits indicates to zlib that it is supposed to
-		// automatically detect whether gzip or zlib headers are used for
-		// the compressed file. This feature was added in zlib 1.2.0.4,
-		// released 10 August 2003.
-		// Note: This is *crucial* for savegame compatibility, do *not* remove!
-		_zlibErr = inflateInit2(&_stream, MAX_WBITS + 32);
-		if (_zlibErr != Z_OK)
-			return;
-
-		// Setup input buffer
-		_stream.next_in = _buf;
-		_stream.avail_in = 0;
+		restart();
 	}
 
 	~GZipReadStream() {
 		inflateEnd(&_stream);
+		for (uint i = 0; i < _checkpoints.size(); ++i)
+			free(_checkpoints[i].window);
 	}
 
 	bool err() const { return (_zlibErr != Z_OK) && (_zlibErr != Z_STREAM_END); }
@@ -214,26 +299,57 @@ public:
 	}
 
 	uint32 read(void *dataPtr, uint32 dataSize) {
-		_stream.next_out = (byte *)dataPtr;
-		_stream.avail_out = dataSize;
+		byte *dst = (byte *)dataPtr;
+		uint32 total = 0;
 
-		// Keep going while we get no error
-		while (_zlibErr == Z_OK && _stream.avail_out) {
+		if (_rawDeflate && dataSize > _origSize - _pos) {
+			// Raw deflate data has no end marker zlib could rely on, so
+			// stop at the size we were told.
+			dataSize = _origSize - _pos;
+			_eos = true;
+		}
+
+		// Keep going while we get no error. The output goes through the
+		// window first, since checkpoints need the most recent output.
+		while (_zlibErr == Z_OK && total < dataSize) {
 			if (_stream.avail_in == 0 && !_wrapped->eos()) {
 				// If we are out of input data: Read more data, if available.
 				_stream.next_in = _buf;
 				_stream.avail_in = _wrapped->read(_buf, BUFSIZE);
 			}
+
+			const uint32 offset = _pos & (WINDOWSIZE - 1);
+			const uint32 chunk = MIN<uint32>(dataSize - total, WINDOWSIZE - offset);
+			_stream.next_out = _window + offset;
+			_stream.avail_out = chunk;
+#ifdef ZLIB_HAS_CHECKPOINTS
+			_zlibErr = inflate(&_stream, Z_BLOCK);
+#else
 			_zlibErr = inflate(&_stream, Z_NO_FLUSH);
-		}
+#endif
 
-		// Update the position counter
-		_pos += dataSize - _stream.avail_out;
+			const uint32 produced = chunk - _stream.avail_out;
+			memcpy(dst + total, _window + offset, produced);
+			total += produced;
+			// Update the position counter
+			_pos += produced;
+
+#ifdef ZLIB_HAS_CHECKPOINTS
+			// Bit 7 of data_type is set at the end of a block, bit 6 if
+			// it was the last one.
+			if (_zlibErr == Z_OK && (_stream.data_type & 0xC0) == 0x80) {
+				const uint32 last = _checkpoints.empty() ? 0 : _checkpoints.back().outPos;
+				if (_pos >= last + CHECKPOINT_SPAN)
+					addCheckpoint();
+			}
+#endif
+		}
 
-		if (_zlibErr == Z_STREAM_END && _stream.avail_out > 0)
+		if (_zlibErr == Z_STREAM_END && total < dataSize)
 			_eos = true;
 
-		return dataSize - _stream.avail_out;
+		PROFILE_COUNT("bytes decompressed", total);
+		return total;
 	}
 
 	bool eos() const {
@@ -262,6 +378,19 @@ public:
 
 		assert(newPos >= 0);
 
+#ifdef ZLIB_HAS_CHECKPOINTS
+		// Resume from the closest checkpoint before the target, unless
+		// we are already past it and in front of the target.
+		int best = (int)_checkpoints.size() - 1;
+		while (best >= 0 && _checkpoints[best].outPos > (uint32)newPos)
+			--best;
+
+		if (best >= 0 && ((uint32)newPos < _pos || _checkpoints[best].outPos > _pos)) {
+			if (!restoreCheckpoint(_checkpoints[best]))
+				return false;
+		}
+#endif
+
 		if ((uint32)newPos < _pos) {
 			// To search backward, we have to restart the whole decompression
 			// from the start of the file. A rather wasteful operation, best
@@ -277,23 +406,21 @@ public:
 			}
 #endif
 
-			_pos = 0;
-			_wrapped->seek(0, SEEK_SET);
-			_zlibErr = inflateReset(&_stream);
+			restart();
 			if (_zlibErr != Z_OK)
 				return false; // FIXME: STREAM REWRITE
-			_stream.next_in = _buf;
-			_stream.avail_in = 0;
 		}
 
 		offset = newPos - _pos;
 
-		// Skip the given amount of data (very inefficient if one tries to skip
-		// huge amounts of data, but usually client code will only skip a few
-		// bytes, so this should be fine.
+		// Skip the given amount of data. With checkpoints in place this is
+		// at most CHECKPOINT_SPAN bytes for data that was read before.
 		byte tmpBuf[1024];
 		while (!err() && offset > 0) {
-			offset -= read(tmpBuf, MIN((int32)sizeof(tmpBuf), offset));
+			uint32 skipped = read(tmpBuf, MIN((int32)sizeof(tmpBuf), offset));
+			if (skipped == 0)
+				break;
+			offset -= skipped;
 		}
 
 		_eos = false;
@@ -432,6 +559,17 @@ SeekableReadStream *wrapCompressedReadStream(SeekableReadStream *toBeWrapped, ui
 	return toBeWrapped;
 }
 
+SeekableReadStream *wrapDeflateReadStream(SeekableReadStream *toBeWrapped, uint32 uncompressedSize) {
+	if (!toBeWrapped)
+		return nullptr;
+#if defined(USE_ZLIB)
+	return new GZipReadStream(toBeWrapped, uncompressedSize, true);
+#else
+	delete toBeWrapped;
+	return nullptr;
+#endif
+}
+
 WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped) {
 #if defined(USE_ZLIB)
 	if (toBeWrapped)
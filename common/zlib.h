@@ -121,6 +121,25 @@ bool inflateZlibInstallShield(byte *dst, uint dstLen, const byte *src, uint srcL
  */
 SeekableReadStream *wrapCompressedReadStream(SeekableReadStream *toBeWrapped, uint32 knownSize = 0);
 
+/**
+ * Take an arbitrary SeekableReadStream containing raw deflate data, i.e.
+ * without any gzip or zlib header, as found in ZIP archives, and wrap it
+ * in a custom stream which provides transparent on-the-fly decompression.
+ * If there is no ZLIB support, NULL is returned and the stream is destroyed.
+ *
+ * The created stream records checkpoints while decompressing, so seeking
+ * back to data which has been read before is cheap. The same applies to
+ * the streams created by wrapCompressedReadStream().
+ * The created stream also becomes responsible for freeing the passed stream.
+ *
+ * It is safe to call this with a NULL parameter (in this case, NULL is
+ * returned).
+ *
+ * @param toBeWrapped		the stream containing the raw deflate data
+ * @param uncompressedSize	the size of the decompressed data
+ */
+SeekableReadStream *wrapDeflateReadStream(SeekableReadStream *toBeWrapped, uint32 uncompressedSize);
+
 /**
  * Take an arbitrary WriteStream and wrap it in a custom stream which provides
  * transparent on-the-fly compression. The compressed data is written in the
@@ -518,8 +518,7 @@ void AccessEngine::synchronize(Common::Serializer &s) {
 	s.syncAsUint32LE(_newTime);
 	s.syncAsUint32LE(_newDate);
 
-	for (int i = 0; i < 256; ++i)
-		s.syncAsUint16LE(_flags[i]);
+	s.syncArrayAsUint16LE(_flags, 256);
 	for (int i = 0; i < 100; ++i)
 		s.syncAsByte(_establishTable[i]);
 
@@ -23,6 +23,7 @@
 #include "common/debug.h"
 #include "common/util.h"
 #include "common/file.h"
+#include "common/jobs.h"
 #include "common/macresman.h"
 #include "common/md5.h"
 #include "common/config-manager.h"
@@ -216,6 +217,9 @@ const ExtraGuiOptions AdvancedMetaEngine::getExtraGuiOptions(const Common::Strin
 Common::Error AdvancedMetaEngine::createInstance(OSystem *syst, Engine **engine) const {
 	assert(engine);
 
+	// The files may have changed since they were last detected
+	MD5CachePass md5CachePass;
+
 	Common::Language language = Common::UNK_LANG;
 	Common::Platform platform = Common::kPlatformUnknown;
 	Common::String extra;
@@ -363,33 +367,122 @@ void AdvancedMetaEngine::composeFileHashMap(FileMap &allFiles, const Common::FSL
 	}
 }
 
+namespace {
+
+/** A file hashed ahead of detection by one of the job system's workers. */
+struct HashedFile {
+	const Common::FSNode *node;
+	FileProperties props;
+	bool valid;
+};
+
+struct HashedFiles {
+	Common::Array<HashedFile> files;
+	uint md5Bytes;
+};
+
+void hashFiles(void *param, uint begin, uint end) {
+	HashedFiles *hashed = (HashedFiles *)param;
+	for (uint i = begin; i < end; ++i) {
+		HashedFile &file = hashed->files[i];
+		Common::File testFile;
+		file.valid = testFile.open(*file.node);
+		if (file.valid) {
+			file.props.size = (int32)testFile.size();
+			file.props.md5 = Common::computeStreamMD5AsString(testFile, hashed->md5Bytes);
+		}
+	}
+}
+
+} // End of anonymous namespace
+
+void AdvancedMetaEngine::hashFilesInParallel(const FileMap &allFiles) const {
+	if (!MD5Man.isActive() || !JobMan.getWorkerCount())
+		return;
+
+	// Collect the files some game description needs, which are not known
+	// yet. Resource forks are left to getFileProperties().
+	HashedFiles hashed;
+	hashed.md5Bytes = _md5Bytes;
+	Common::HashMap<Common::String, bool, Common::CaseSensitiveString_Hash, Common::CaseSensitiveString_EqualTo> queued;
+
+	for (const byte *descPtr = _gameDescriptors; ((const ADGameDescription *)descPtr)->gameId != nullptr; descPtr += _descItemSize) {
+		const ADGameDescription *g = (const ADGameDescription *)descPtr;
+		if (g->flags & ADGF_MACRESFORK)
+			continue;
+
+		for (const ADGameFileDescription *fileDesc = g->filesDescriptions; fileDesc->fileName; fileDesc++) {
+			FileMap::const_iterator file = allFiles.find(fileDesc->fileName);
+			if (file == allFiles.end())
+				continue;
+
+			const Common::String key = file->_value.getPath();
+			FileProperties tmp;
+			if (queued.contains(key) || MD5Man.get(key, _md5Bytes, tmp))
+				continue;
+
+			queued[key] = true;
+			HashedFile hashedFile;
+			hashedFile.node = &file->_value;
+			hashedFile.valid = false;
+			hashed.files.push_back(hashedFile);
+		}
+	}
+
+	if (hashed.files.size() < 2)
+		return;
+
+	JobMan.parallelFor(0, hashed.files.size(), 1, hashFiles, &hashed);
+
+	for (uint i = 0; i < hashed.files.size(); ++i) {
+		if (hashed.files[i].valid)
+			MD5Man.set(hashed.files[i].node->getPath(), _md5Bytes, hashed.files[i].props);
+	}
+}
+
 bool AdvancedMetaEngine::getFileProperties(const Common::FSNode &parent, const FileMap &allFiles, const ADGameDescription &game, const Common::String fname, FileProperties &fileProps) const {
 	// FIXME/TODO: We don't handle the case that a file is listed as a regular
 	// file and as one with resource fork.
 
 	if (game.flags & ADGF_MACRESFORK) {
-		Common::MacResManager macResMan;
+		// The resource fork has a different MD5 than the file itself, so it
+		// gets its own cache entry.
+		const Common::String key = "resfork:" + parent.getPath() + '/' + fname;
 
-		if (!macResMan.open(parent, fname))
-			return false;
+		if (MD5Man.get(key, _md5Bytes, fileProps)) {
+			if (fileProps.size != 0)
+				return true;
+		} else {
+			Common::MacResManager macResMan;
 
-		fileProps.md5 = macResMan.computeResForkMD5AsString(_md5Bytes);
-		fileProps.size = macResMan.getResForkDataSize();
+			if (!macResMan.open(parent, fname))
+				return false;
 
-		if (fileProps.size != 0)
-			return true;
+			fileProps.md5 = macResMan.computeResForkMD5AsString(_md5Bytes);
+			fileProps.size = macResMan.getResForkDataSize();
+			MD5Man.set(key, _md5Bytes, fileProps);
+
+			if (fileProps.size != 0)
+				return true;
+		}
 	}
 
-	if (!allFiles.contains(fname))
+	FileMap::const_iterator file = allFiles.find(fname);
+	if (file == allFiles.end())
 		return false;
 
+	const Common::String key = file->_value.getPath();
+	if (MD5Man.get(key, _md5Bytes, fileProps))
+		return true;
+
 	Common::File testFile;
 
-	if (!testFile.open(allFiles[fname]))
+	if (!testFile.open(file->_value))
 		return false;
 
 	fileProps.size = (int32)testFile.size();
 	fileProps.md5 = Common::computeStreamMD5AsString(testFile, _md5Bytes);
+	MD5Man.set(key, _md5Bytes, fileProps);
 	return true;
 }
 
@@ -403,6 +496,9 @@ ADDetectedGames AdvancedMetaEngine::detectGame(const Common::FSNode &parent, con
 
 	debug(3, "Starting detection in dir '%s'", parent.getPath().c_str());
 
+	// Hash the candidate files at once, the loop below then finds them cached
+	hashFilesInParallel(allFiles);
+
 	// Check which files are included in some ADGameDescription *and* are present.
 	// Compute MD5s and file sizes for these files.
 	for (descPtr = _gameDescriptors; ((const ADGameDescription *)descPtr)->gameId != nullptr; descPtr += _descItemSize) {
@@ -612,3 +708,24 @@ void AdvancedMetaEngine::initSubSystems(const ADGameDescription *gameDesc) const
 	}
 #endif
 }
+
+namespace Common {
+DECLARE_SINGLETON(MD5CacheManager);
+}
+
+bool MD5CacheManager::get(const Common::String &key, uint md5Bytes, FileProperties &fileProps) const {
+	if (!isActive())
+		return false;
+
+	MD5Cache::const_iterator it = _cache.find(makeKey(key, md5Bytes));
+	if (it == _cache.end())
+		return false;
+
+	fileProps = it->_value;
+	return true;
+}
+
+void MD5CacheManager::set(const Common::String &key, uint md5Bytes, const FileProperties &fileProps) {
+	if (isActive())
+		_cache[makeKey(key, md5Bytes)] = fileProps;
+}
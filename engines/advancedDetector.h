@@ -27,6 +27,7 @@
 #include "engines/engine.h"
 
 #include "common/hash-str.h"
+#include "common/singleton.h"
 
 #include "common/gui_options.h" // FIXME: Temporary hack?
 
@@ -326,6 +327,12 @@ protected:
 	 */
 	void composeFileHashMap(FileMap &allFiles, const Common::FSList &fslist, int depth, const Common::String &parentName = Common::String()) const;
 
+	/**
+	 * Compute the properties of all files the game descriptions refer to
+	 * on the job system's workers, and put them into the MD5 cache.
+	 */
+	void hashFilesInParallel(const FileMap &allFiles) const;
+
 	/** Get the properties (size and MD5) of this file. */
 	bool getFileProperties(const Common::FSNode &parent, const FileMap &allFiles, const ADGameDescription &game, const Common::String fname, FileProperties &fileProps) const;
 
@@ -333,4 +340,54 @@ protected:
 	DetectedGame toDetectedGame(const ADDetectedGame &adGame) const;
 };
 
+/**
+ * Singleton class which caches the file properties computed while detecting
+ * games. All engines using the AdvancedDetector look at the same directory
+ * during one detection pass, and many of them probe files with the same name
+ * (e.g. executables or generic data file names), so this avoids reading and
+ * hashing those files over and over again.
+ *
+ * The cache is keyed by the path of the file and the number of bytes hashed.
+ * As files might change between detection passes, entries are only kept
+ * while a pass is running, see MD5CachePass. Outside of passes, nothing is
+ * cached.
+ */
+class MD5CacheManager : public Common::Singleton<MD5CacheManager> {
+public:
+	bool get(const Common::String &key, uint md5Bytes, FileProperties &fileProps) const;
+	void set(const Common::String &key, uint md5Bytes, const FileProperties &fileProps);
+
+	/** Return whether a detection pass is running, so that entries are kept. */
+	bool isActive() const { return _passes > 0; }
+
+private:
+	friend class Common::Singleton<SingletonBaseType>;
+	friend class MD5CachePass;
+	MD5CacheManager() : _passes(0) {}
+
+	typedef Common::HashMap<Common::String, FileProperties, Common::CaseSensitiveString_Hash, Common::CaseSensitiveString_EqualTo> MD5Cache;
+	MD5Cache _cache;
+	uint _passes;
+
+	static Common::String makeKey(const Common::String &key, uint md5Bytes) {
+		return Common::String::format("%s:%u", key.c_str(), md5Bytes);
+	}
+};
+
+/** Convenience shortcut for accessing the MD5 cache manager. */
+#define MD5Man MD5CacheManager::instance()
+
+/**
+ * Keeps the MD5 cache in use for the lifetime of this object. Passes may
+ * be nested; the cache is emptied once the outermost one ends.
+ */
+class MD5CachePass : Common::NonCopyable {
+public:
+	MD5CachePass() { MD5Man._passes++; }
+	~MD5CachePass() {
+		if (--MD5Man._passes == 0)
+			MD5Man._cache.clear(true);
+	}
+};
+
 #endif
@@ -170,6 +170,8 @@ public:
 
 	byte getColor(int16 x, int16 y);
 	byte getPriority(int16 x, int16 y);
+	byte *getGameScreen() { return _gameScreen; }
+	byte *getPriorityScreen() { return _priorityScreen; }
 	bool checkControlPixel(int16 x, int16 y, byte newPriority);
 
 	byte getCGAMixtureColor(byte color);
@@ -27,6 +27,9 @@
 
 namespace Agi {
 
+/** Number of drawn pictures kept, each takes about 53KB */
+static const uint kMaxCachedPictures = 8;
+
 PictureMgr::PictureMgr(AgiBase *agi, GfxMgr *gfx) {
 	_vm = agi;
 	_gfx = gfx;
@@ -48,6 +51,10 @@ PictureMgr::PictureMgr(AgiBase *agi, GfxMgr *gfx) {
 	_width = _height = 0;
 }
 
+PictureMgr::~PictureMgr() {
+	clearCache();
+}
+
 void PictureMgr::putVirtPixel(int x, int y) {
 	byte drawMask = 0;
 
@@ -838,6 +845,29 @@ void PictureMgr::draw_Fill(int16 x, int16 y) {
 	if (!_scrOn && !_priOn)
 		return;
 
+	// Work out once which screen decides if a pixel gets filled, and which of
+	// its values can be filled. Filling a pixel always makes it unfillable.
+	const byte *checkScreen = _gfx->getGameScreen();
+	bool fillable[256];
+
+	if (_flags & kPicFTrollMode) {
+		for (int i = 0; i < 256; i++)
+			fillable[i] = (i != 11) && (i != _scrColor);
+	} else if (_scrOn && _scrColor != 15) {
+		for (int i = 0; i < 256; i++)
+			fillable[i] = (i == 15);
+	} else if (_priOn && !_scrOn && _priColor != 4) {
+		checkScreen = _gfx->getPriorityScreen();
+		for (int i = 0; i < 256; i++)
+			fillable[i] = (i == 4);
+	} else {
+		return;
+	}
+
+	byte *gameScreen = _gfx->getGameScreen();
+	byte *priorityScreen = _gfx->getPriorityScreen();
+	const int originOffset = _yOffset * SCRIPT_WIDTH + _xOffset;
+
 	// Push initial pixel on the stack
 	Common::Stack<Common::Point> stack;
 	stack.push(Common::Point(x, y));
@@ -845,65 +875,52 @@ void PictureMgr::draw_Fill(int16 x, int16 y) {
 	// Exit if stack is empty
 	while (!stack.empty()) {
 		Common::Point p = stack.pop();
-		unsigned int c;
-		bool newspanUp, newspanDown;
 
-		if (!draw_FillCheck(p.x, p.y))
+		if (p.x < 0 || p.x >= _width || p.y < 0 || p.y >= _height)
 			continue;
 
-		// Scan for left border
-		for (c = p.x - 1; draw_FillCheck(c, p.y); c--)
-			;
-
-		newspanUp = newspanDown = true;
-		for (c++; draw_FillCheck(c, p.y); c++) {
-			putVirtPixel(c, p.y);
-			if (draw_FillCheck(c, p.y - 1)) {
-				if (newspanUp) {
-					stack.push(Common::Point(c, p.y - 1));
-					newspanUp = false;
-				}
-			} else {
-				newspanUp = true;
-			}
+		const int rowOffset = originOffset + p.y * SCRIPT_WIDTH;
+		const byte *checkRow = checkScreen + rowOffset;
 
-			if (draw_FillCheck(c, p.y + 1)) {
-				if (newspanDown) {
-					stack.push(Common::Point(c, p.y + 1));
-					newspanDown = false;
+		if (!fillable[checkRow[p.x]])
+			continue;
+
+		// Scan for the borders of the span and fill it
+		int16 left = p.x;
+		while (left > 0 && fillable[checkRow[left - 1]])
+			left--;
+
+		int16 right = p.x;
+		while (right < _width - 1 && fillable[checkRow[right + 1]])
+			right++;
+
+		if (_scrOn)
+			memset(gameScreen + rowOffset + left, _scrColor, right - left + 1);
+		if (_priOn)
+			memset(priorityScreen + rowOffset + left, _priColor, right - left + 1);
+
+		// Continue with one pixel of each fillable run above and below the span
+		for (int16 nextY = p.y - 1; nextY <= p.y + 1; nextY += 2) {
+			if (nextY < 0 || nextY >= _height)
+				continue;
+
+			const byte *nextRow = checkScreen + originOffset + nextY * SCRIPT_WIDTH;
+			bool newSpan = true;
+
+			for (int16 c = left; c <= right; c++) {
+				if (fillable[nextRow[c]]) {
+					if (newSpan) {
+						stack.push(Common::Point(c, nextY));
+						newSpan = false;
+					}
+				} else {
+					newSpan = true;
 				}
-			} else {
-				newspanDown = true;
 			}
 		}
 	}
 }
 
-int PictureMgr::draw_FillCheck(int16 x, int16 y) {
-	byte screenColor;
-	byte screenPriority;
-
-	if (x < 0 || x >= _width || y < 0 || y >= _height)
-		return false;
-
-	x += _xOffset;
-	y += _yOffset;
-
-	screenColor = _gfx->getColor(x, y);
-	screenPriority = _gfx->getPriority(x, y);
-
-	if (_flags & kPicFTrollMode)
-		return ((screenColor != 11) && (screenColor != _scrColor));
-
-	if (!_priOn && _scrOn && _scrColor != 15)
-		return (screenColor == 15);
-
-	if (_priOn && !_scrOn && _priColor != 4)
-		return screenPriority == 4;
-
-	return (_scrOn && screenColor == 15 && _scrColor != 15);
-}
-
 /**
  * Decode an AGI picture resource.
  * This function decodes an AGI picture resource into the correct slot
@@ -931,14 +948,21 @@ int PictureMgr::decodePicture(int16 resourceNr, bool clearScreen, bool agi256, i
 	_width = pic_width;
 	_height = pic_height;
 
-	if (clearScreen && !agi256) { // 256 color pictures should always fill the whole screen, so no clearing for them.
-		_gfx->clear(15, 4); // Clear 16 color AGI screen (Priority 4, color white).
-	}
+	const bool cacheable = isCacheable(clearScreen, agi256, pic_width, pic_height);
 
-	if (!agi256) {
-		drawPicture(); // Draw 16 color picture.
-	} else {
-		drawPictureAGI256();
+	if (!cacheable || !restoreFromCache(resourceNr)) {
+		if (clearScreen && !agi256) { // 256 color pictures should always fill the whole screen, so no clearing for them.
+			_gfx->clear(15, 4); // Clear 16 color AGI screen (Priority 4, color white).
+		}
+
+		if (!agi256) {
+			drawPicture(); // Draw 16 color picture.
+		} else {
+			drawPictureAGI256();
+		}
+
+		if (cacheable)
+			addToCache(resourceNr);
 	}
 
 	if (clearScreen)
@@ -996,6 +1020,58 @@ int PictureMgr::unloadPicture(int n) {
 	return errOK;
 }
 
+/**
+ * Check if a picture can be taken from the cache.
+ * Only pictures drawn onto a cleared screen are cached, as they do not depend
+ * on what was shown before. Overlays are always drawn.
+ */
+bool PictureMgr::isCacheable(bool clearScreen, bool agi256, int16 pic_width, int16 pic_height) const {
+	return clearScreen && !agi256 && !_flags &&
+		pic_width == _DEFAULT_WIDTH && pic_height == _DEFAULT_HEIGHT &&
+		!_xOffset && !_yOffset;
+}
+
+bool PictureMgr::restoreFromCache(int16 resourceNr) {
+	for (Common::List<CachedPicture>::iterator i = _cache.begin(); i != _cache.end(); ++i) {
+		if (i->resourceNr != resourceNr || i->dataSize != _dataSize)
+			continue;
+
+		_gfx->block_restore(0, 0, _DEFAULT_WIDTH, _DEFAULT_HEIGHT, i->screens);
+
+		CachedPicture entry = *i;
+		_cache.erase(i);
+		_cache.push_front(entry);
+		return true;
+	}
+
+	return false;
+}
+
+void PictureMgr::addToCache(int16 resourceNr) {
+	CachedPicture entry;
+
+	if (_cache.size() >= kMaxCachedPictures) {
+		// Reuse the buffer of the least recently used picture
+		entry = _cache.back();
+		_cache.pop_back();
+	} else {
+		entry.screens = new byte[_DEFAULT_WIDTH * _DEFAULT_HEIGHT * 2];
+	}
+
+	entry.resourceNr = resourceNr;
+	entry.dataSize = _dataSize;
+	_gfx->block_save(0, 0, _DEFAULT_WIDTH, _DEFAULT_HEIGHT, entry.screens);
+
+	_cache.push_front(entry);
+}
+
+void PictureMgr::clearCache() {
+	for (Common::List<CachedPicture>::iterator i = _cache.begin(); i != _cache.end(); ++i)
+		delete[] i->screens;
+
+	_cache.clear();
+}
+
 void PictureMgr::clear() {
 	_gfx->clear(15, 4); // Clear 16 color AGI screen (Priority 4, color white).
 }
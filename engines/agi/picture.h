@@ -23,6 +23,8 @@
 #ifndef AGI_PICTURE_H
 #define AGI_PICTURE_H
 
+#include "common/list.h"
+
 namespace Agi {
 
 #define _DEFAULT_WIDTH      160
@@ -63,6 +65,7 @@ class PictureMgr {
 
 public:
 	PictureMgr(AgiBase *agi, GfxMgr *gfx);
+	~PictureMgr();
 
 	int16 getResourceNr() { return _resourceNr; };
 
@@ -98,10 +101,14 @@ private:
 	void draw_LineShort();
 	void draw_LineAbsolute();
 
-	int  draw_FillCheck(int16 x, int16 y);
 	void draw_Fill(int16 x, int16 y);
 	void draw_Fill();
 
+	bool isCacheable(bool clearScreen, bool agi256, int16 pic_width, int16 pic_height) const;
+	bool restoreFromCache(int16 resourceNr);
+	void addToCache(int16 resourceNr);
+	void clearCache();
+
 public:
 	void showPic(); // <-- for regular AGI games
 	void showPic(int16 x, int16 y, int16 pic_width, int16 pic_height); // <-- for preAGI games
@@ -151,6 +158,16 @@ private:
 
 	int _flags;
 	int _currentStep;
+
+	/** The visual and priority screens of a picture drawn onto a cleared screen. */
+	struct CachedPicture {
+		int16 resourceNr;
+		uint32 dataSize;
+		byte *screens;
+	};
+
+	/** Recently drawn pictures, most recently used first. */
+	Common::List<CachedPicture> _cache;
 };
 
 } // End of namespace Agi
@@ -382,6 +382,7 @@ AGOSEngine::AGOSEngine(OSystem *system, const AGOSGameDescription *gd)
 	_vgaSpriteChanged = 0;
 
 	_block = 0;
+	_depackedImagesSize = 0;
 	_blockEnd = 0;
 	_vgaMemPtr = 0;
 	_vgaMemEnd = 0;
@@ -951,6 +952,7 @@ AGOSEngine::~AGOSEngine() {
 		_scaleBuf->free();
 	delete _scaleBuf;
 	free(_zoneBuffers);
+	clearDepackedImages();
 
 	if (_window4BackScn)
 		_window4BackScn->free();
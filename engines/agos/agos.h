@@ -27,6 +27,7 @@
 
 #include "common/array.h"
 #include "common/error.h"
+#include "common/hashmap.h"
 #include "common/keyboard.h"
 #include "common/random.h"
 #include "common/rect.h"
@@ -467,6 +468,22 @@ protected:
 	byte *_vgaFrozenBase, *_vgaRealBase;
 	byte *_zoneBuffers;
 
+	/** A compressed image, decoded once and stored by rows. */
+	struct DepackedImage {
+		const byte *src;
+		uint16 width, height;
+		bool transparent;	///< Whether any pixel has color 0
+		byte *pixels;
+	};
+
+	enum {
+		kMaxDepackedImagesSize = 8 * 1024 * 1024
+	};
+
+	typedef Common::HashMap<uint32, DepackedImage> DepackedImageMap;
+	DepackedImageMap _depackedImages;
+	uint32 _depackedImagesSize;
+
 	byte *_curVgaFile1;
 	byte *_curVgaFile2;
 
@@ -1142,6 +1159,9 @@ public:
 protected:
 	bool drawImage_clip(VC10_state *state);
 
+	const DepackedImage &getDepackedImage(const VC10_state *state);
+	void clearDepackedImages();
+
 	void drawImage_init(int16 image, uint16 palette, int16 x, int16 y, uint16 flags);
 
 	virtual void drawImage(VC10_state *state);
@@ -82,6 +82,57 @@ void vc10_skip_cols(VC10_state *vs) {
 	}
 }
 
+const AGOSEngine::DepackedImage &AGOSEngine::getDepackedImage(const VC10_state *state) {
+	// Images are drawn every frame while they are shown, so it pays to
+	// keep them decoded. They are looked up by their address in the VGA
+	// memory, which is why the cache is cleared whenever that is reused.
+	const uint32 key = (uint32)(uintptr)state->srcPtr;
+	DepackedImageMap::iterator i = _depackedImages.find(key);
+	if (i != _depackedImages.end() && i->_value.src == state->srcPtr &&
+			i->_value.width == state->width && i->_value.height == state->height)
+		return i->_value;
+
+	const uint32 size = state->width * state->height;
+	if (_depackedImagesSize + size > kMaxDepackedImagesSize)
+		clearDepackedImages();
+
+	DepackedImage &image = _depackedImages[key];
+	if (image.pixels) {
+		_depackedImagesSize -= image.width * image.height;
+		free(image.pixels);
+	}
+	image.src = state->srcPtr;
+	image.width = state->width;
+	image.height = state->height;
+	image.transparent = false;
+	image.pixels = (byte *)malloc(size);
+	_depackedImagesSize += size;
+
+	VC10_state depack;
+	depack.srcPtr = state->srcPtr;
+	depack.depack_cont = -0x80;
+	depack.dh = state->height;
+	for (uint x = 0; x < state->width; x++) {
+		const byte *src = vc10_depackColumn(&depack);
+		byte *dst = image.pixels + x;
+		for (uint y = 0; y < state->height; y++) {
+			if (!src[y])
+				image.transparent = true;
+			*dst = src[y];
+			dst += state->width;
+		}
+	}
+
+	return image;
+}
+
+void AGOSEngine::clearDepackedImages() {
+	for (DepackedImageMap::iterator i = _depackedImages.begin(); i != _depackedImages.end(); ++i)
+		free(i->_value.pixels);
+	_depackedImages.clear();
+	_depackedImagesSize = 0;
+}
+
 void AGOSEngine::decodeColumn(byte *dst, const byte *src, uint16 height, uint16 pitch) {
 	int8 reps = (int8)0x80;
 	byte color;
@@ -367,68 +418,41 @@ void AGOSEngine_Feeble::drawImage(VC10_state *state) {
 
 			state->surf_addr += state->x + state->y * state->surf_pitch;
 
-			uint w, h;
-			byte *src, *dst, *dstPtr;
-
-			state->dl = state->width;
-			state->dh = state->height;
-
-			vc10_skip_cols(state);
-
-
-			if (state->flags & kDFMasked) {
-				if (getGameType() == GType_FF && !getBitFlag(81)) {
-					if (state->x > _feebleRect.right) {
-						return;
-					}
-					if (state->y > _feebleRect.bottom) {
-						return;
-					}
-					if (state->x + state->width < _feebleRect.left) {
-						return;
-					}
-					if (state->y + state->height < _feebleRect.top) {
-						return;
-					}
+			if ((state->flags & kDFMasked) && getGameType() == GType_FF && !getBitFlag(81)) {
+				if (state->x > _feebleRect.right) {
+					return;
 				}
+				if (state->y > _feebleRect.bottom) {
+					return;
+				}
+				if (state->x + state->width < _feebleRect.left) {
+					return;
+				}
+				if (state->y + state->height < _feebleRect.top) {
+					return;
+				}
+			}
 
-				dstPtr = state->surf_addr;
-				w = 0;
-				do {
-					byte color;
-
-					src = vc10_depackColumn(state);
-					dst = dstPtr;
+			const DepackedImage &image = getDepackedImage(state);
+			const byte *src = image.pixels + state->x_skip + state->y_skip * image.width;
+			byte *dst = state->surf_addr;
 
-					h = 0;
-					do {
-						color = *src;
-						if (color)
-							*dst = color;
-						dst += state->surf_pitch;
-						src++;
-					} while (++h != state->draw_height);
-					dstPtr++;
-				} while (++w != state->draw_width);
+			// Masked images never draw color 0, not even with kDFNonTrans
+			if (!image.transparent || (!(state->flags & kDFMasked) && (state->flags & kDFNonTrans))) {
+				for (uint h = 0; h != state->draw_height; h++) {
+					memcpy(dst, src, state->draw_width);
+					dst += state->surf_pitch;
+					src += image.width;
+				}
 			} else {
-				dstPtr = state->surf_addr;
-				w = 0;
-				do {
-					byte color;
-
-					src = vc10_depackColumn(state);
-					dst = dstPtr;
-
-					h = 0;
-					do {
-						color = *src;
-						if ((state->flags & kDFNonTrans) || color != 0)
-							*dst = color;
-						dst += state->surf_pitch;
-						src++;
-					} while (++h != state->draw_height);
-					dstPtr++;
-				} while (++w != state->draw_width);
+				for (uint h = 0; h != state->draw_height; h++) {
+					for (uint w = 0; w != state->draw_width; w++) {
+						if (src[w])
+							dst[w] = src[w];
+					}
+					dst += state->surf_pitch;
+					src += image.width;
+				}
 			}
 		}
 	} else {
@@ -768,6 +768,8 @@ void AGOSEngine::decompressPN(Common::Stack<uint32> &dataList, uint8 *&dataOut,
 void AGOSEngine::loadVGABeardFile(uint16 id) {
 	uint32 offs, size;
 
+	clearDepackedImages();
+
 	if (getFeatures() & GF_OLD_BUNDLE) {
 		Common::File in;
 		char filename[15];
@@ -30,6 +30,7 @@
 
 #include "common/debug-channels.h"
 #include "common/endian.h"
+#include "common/profiler.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
@@ -151,17 +152,19 @@ void AGOSEngine::setupVgaOpcodes() {
 
 // VGA Script parser
 void AGOSEngine::runVgaScript() {
+	// Neither of these can change while the script runs
+	const bool dumpScript = DebugMan.isDebugChannelEnabled(kDebugVGAOpcode);
+	const bool byteOpcodes = (getGameType() == GType_SIMON2 || getGameType() == GType_FF || getGameType() == GType_PP);
+
 	for (;;) {
 		uint opcode;
 
-		if (DebugMan.isDebugChannelEnabled(kDebugVGAOpcode)) {
-			if (_vcPtr != (const byte *)&_vcGetOutOfCode) {
-				debugN("%.5d %.5X: %5d %4d ", _vgaTickCounter, (unsigned int)(_vcPtr - _curVgaFile1), _vgaCurSpriteId, _vgaCurZoneNum);
-				dumpVideoScript(_vcPtr, true);
-			}
+		if (dumpScript && _vcPtr != (const byte *)&_vcGetOutOfCode) {
+			debugN("%.5d %.5X: %5d %4d ", _vgaTickCounter, (unsigned int)(_vcPtr - _curVgaFile1), _vgaCurSpriteId, _vgaCurZoneNum);
+			dumpVideoScript(_vcPtr, true);
 		}
 
-		if (getGameType() == GType_SIMON2 || getGameType() == GType_FF || getGameType() == GType_PP) {
+		if (byteOpcodes) {
 			opcode = *_vcPtr++;
 		} else {
 			opcode = READ_BE_UINT16(_vcPtr);
@@ -649,6 +652,8 @@ void AGOSEngine::drawImage_init(int16 image, uint16 palette, int16 x, int16 y, u
 	if (height == 0 || width == 0)
 		return;
 
+	PROFILE_COUNT("sprites drawn", 1);
+
 	if (DebugMan.isDebugChannelEnabled(kDebugImageDump))
 		dumpSingleBitmap(_vgaCurZoneNum, state.image, state.srcPtr, width, height,
 											 state.palette);
@@ -119,6 +119,9 @@ void AGOSEngine::setZoneBuffers() {
 }
 
 byte *AGOSEngine::allocBlock(uint32 size) {
+	// The new block may overwrite images which were decoded already
+	clearDepackedImages();
+
 	for (;;) {
 		_block = _vgaMemPtr;
 		_blockEnd = _block + size;
@@ -25,6 +25,7 @@
 #include "graphics/palette.h"
 #include "graphics/surface.h"
 #include "video/avi_decoder.h"
+#include "video/video_player.h"
 
 namespace Bbvs {
 
@@ -54,23 +55,12 @@ void BbvsEngine::playVideo(int videoNum) {
 
 	videoDecoder->start();
 
+	Video::VideoPlayer videoPlayer(videoDecoder);
 	bool skipVideo = false;
 
 	while (!shouldQuit() && !videoDecoder->endOfVideo() && !skipVideo) {
-		if (videoDecoder->needsUpdate()) {
-			const Graphics::Surface *frame = videoDecoder->decodeNextFrame();
-			if (frame) {
-				if (frame->format.bytesPerPixel > 1) {
-					Graphics::Surface *frame1 = frame->convertTo(_system->getScreenFormat());
-					_system->copyRectToScreen(frame1->getPixels(), frame1->pitch, 0, 0, frame1->w, frame1->h);
-					frame1->free();
-					delete frame1;
-				} else {
-					_system->copyRectToScreen(frame->getPixels(), frame->pitch, 0, 0, frame->w, frame->h);
-				}
-				_system->updateScreen();
-			}
-		}
+		if (videoPlayer.update())
+			_system->updateScreen();
 
 		Common::Event event;
 		while (_system->getEventManager()->pollEvent(event)) {
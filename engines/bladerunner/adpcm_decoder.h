@@ -23,22 +23,21 @@
 #ifndef BLADERUNNER_ADPCM_DECODER_H
 #define BLADERUNNER_ADPCM_DECODER_H
 
-#include "common/types.h"
+#include "audio/decoders/adpcm_intern.h"
 
 namespace BladeRunner {
 
 class ADPCMWestwoodDecoder {
-	int16 _stepIndex;
-	int32 _predictor;
+	Audio::IMAChannelStatus _status;
 
 public:
-	ADPCMWestwoodDecoder()
-		: _stepIndex(0), _predictor(0) {
+	ADPCMWestwoodDecoder() {
+		setParameters(0, 0);
 	}
 
 	void setParameters(int16 stepIndex, int32 predictor) {
-		_stepIndex = stepIndex;
-		_predictor = predictor;
+		_status.stepIndex = stepIndex;
+		_status.last = predictor;
 	}
 
 	void decode(uint8 *in, size_t size, int16 *out);
@@ -46,6 +46,7 @@ Fog::Fog() {
 	_parameter1         = 0.0f;
 	_parameter2         = 0.0f;
 	_parameter3         = 0.0f;
+	_viewPositionTValid = false;
 	_next               = nullptr;
 }
 
@@ -107,6 +108,16 @@ void Fog::setupFrame(int frame) {
 	_matrix._m[2][2] = (_animatedParameters & 0x400 ? _m33ptr[offset] : *_m33ptr);
 	_matrix._m[2][3] = (_animatedParameters & 0x800 ? _m34ptr[offset] : *_m34ptr);
 	_inverted = invertMatrix(_matrix);
+	_viewPositionTValid = false;
+}
+
+Vector3 Fog::transformViewPosition(Vector3 viewPosition) {
+	if (!_viewPositionTValid || viewPosition.x != _viewPosition.x || viewPosition.y != _viewPosition.y || viewPosition.z != _viewPosition.z) {
+		_viewPosition = viewPosition;
+		_viewPositionT = _matrix * viewPosition;
+		_viewPositionTValid = true;
+	}
+	return _viewPositionT;
 }
 
 void FogCone::read(Common::ReadStream *stream, int frameCount) {
@@ -120,7 +131,7 @@ void FogCone::calculateCoeficient(Vector3 position, Vector3 viewPosition, float
 	*coeficient = 0.0f;
 
 	Vector3 positionT = _matrix * position;
-	Vector3 viewPositionT = _matrix * viewPosition;
+	Vector3 viewPositionT = transformViewPosition(viewPosition);
 
 	Vector3 vectorT = (viewPositionT - positionT).normalize();
 
@@ -159,6 +170,8 @@ void FogSphere::read(Common::ReadStream *stream, int frameCount) {
 	_frameCount = frameCount;
 	int size = readCommon(stream);
 	_parameter1 = stream->readFloatLE();
+	_parameter1Cos = cos(_parameter1);
+	_parameter1Tan = tan(_parameter1);
 	readAnimationData(stream, size - 52);
 }
 
@@ -166,7 +179,7 @@ void FogSphere::calculateCoeficient(Vector3 position, Vector3 viewPosition, floa
 	*coeficient = 0.0f;
 
 	Vector3 positionT = _matrix * position;
-	Vector3 viewPositionT = _matrix * viewPosition;
+	Vector3 viewPositionT = transformViewPosition(viewPosition);
 
 	Vector3 v158 = Vector3::cross(positionT, viewPositionT);
 
@@ -177,12 +190,12 @@ void FogSphere::calculateCoeficient(Vector3 position, Vector3 viewPosition, floa
 		}
 
 		float v173 = sqrt(1.0f - v167.z * v167.z);
-		if (v173 > cos(_parameter1)) {
+		if (v173 > _parameter1Cos) {
 			Vector3 v37 = Vector3(v167.y, -v167.x, 0.0f).normalize();
 
 			float v41 = 1.0f / v173 / v173 - 1.0f;
 			float v42 = sqrt(v41);
-			float v43 = tan(_parameter1);
+			float v43 = _parameter1Tan;
 			float v44 = sqrt(v43 * v43 - v41);
 
 			Vector3 v45 = v44 * v37;
@@ -294,7 +307,7 @@ void FogBox::read(Common::ReadStream *stream, int frameCount) {
 
 void FogBox::calculateCoeficient(Vector3 position, Vector3 viewPosition, float *coeficient) {
 	Vector3 positionT = _matrix * position;
-	Vector3 viewPositionT = _matrix * viewPosition;
+	Vector3 viewPositionT = transformViewPosition(viewPosition);
 
 	Vector3 positionTadj = positionT;
 	Vector3 viewPositionTadj = viewPositionT;
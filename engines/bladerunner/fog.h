@@ -64,6 +64,11 @@ protected:
 	float      _parameter2;
 	float      _parameter3;
 
+	// The view position stays the same for a whole frame
+	bool       _viewPositionTValid;
+	Vector3    _viewPosition;
+	Vector3    _viewPositionT;
+
 	Fog       *_next;
 
 public:
@@ -80,6 +85,8 @@ protected:
 	int readCommon(Common::ReadStream *stream);
 	void readAnimationData(Common::ReadStream *stream, int count);
 
+	Vector3 transformViewPosition(Vector3 viewPosition);
+
 };
 
 class FogCone : public Fog {
@@ -88,6 +95,9 @@ class FogCone : public Fog {
 };
 
 class FogSphere : public Fog {
+	float _parameter1Cos;
+	float _parameter1Tan;
+
 	void read(Common::ReadStream *stream, int frameCount);
 	void calculateCoeficient(Vector3 position, Vector3 viewPosition, float *coeficient);
 };
@@ -69,9 +69,7 @@ bool Font::open(const Common::String &fileName, int screenWidth, int screenHeigh
 		_characters[i].height = stream->readUint32LE();
 		_characters[i].dataOffset = stream->readUint32LE();
 	}
-	for (int i = 0; i < _dataSize; i++) {
-		_data[i] = stream->readUint16LE();
-	}
+	stream->readUint16ArrayLE(_data, _dataSize);
 	return true;
 }
 
@@ -210,10 +210,9 @@ bool Scene::close(bool isLoadingGame) {
 }
 
 int Scene::advanceFrame() {
-	int frame = _vqaPlayer->update();
+	int frame = _vqaPlayer->update(false, true, nullptr, _vm->_zbuffer);
 	if (frame >= 0) {
 		blit(_vm->_surfaceBack, _vm->_surfaceFront);
-		_vqaPlayer->updateZBuffer(_vm->_zbuffer);
 		_vqaPlayer->updateView(_vm->_view);
 		_vqaPlayer->updateScreenEffects(_vm->_screenEffects);
 		_vqaPlayer->updateLights(_vm->_lights);
@@ -47,7 +47,9 @@ void ScreenEffects::readVqa(Common::SeekableReadStream *stream) {
 		return;
 	}
 
-	entryCount = MIN(entryCount, 7);
+	if (entryCount > kMaxEntries) {
+		entryCount = kMaxEntries;
+	}
 	_entries.resize(entryCount);
 
 	for (Common::Array<Entry>::iterator entry = _entries.begin(); entry != _entries.end(); entry++) {
@@ -137,4 +139,31 @@ void ScreenEffects::getColor(Color256 *outColor, uint16 x, uint16 y, uint16 z) c
 	*outColor = color;
 }
 
+void ScreenEffects::getLineEntries(LineEntries *lineEntries, uint16 y) const {
+	lineEntries->count = 0;
+	for (Common::Array<const Entry>::iterator entry = _entries.begin(); entry != _entries.end(); entry++) {
+		uint16 y1 = (y / 2) - entry->y;
+		if (y1 < entry->height) {
+			lineEntries->entries[lineEntries->count] = entry;
+			lineEntries->rows[lineEntries->count] = entry->data + y1 * entry->width;
+			++lineEntries->count;
+		}
+	}
+}
+
+void ScreenEffects::getColor(Color256 *outColor, const LineEntries &lineEntries, uint16 x, uint16 z) {
+	Color256 color = { 0, 0, 0 };
+	for (uint i = 0; i != lineEntries.count; ++i) {
+		const Entry *entry = lineEntries.entries[i];
+		uint16 x1 = (x / 2) - entry->x;
+		if (x1 < entry->width && z > entry->z) {
+			Color256 entryColor = entry->palette[lineEntries.rows[i][x1]];
+			color.r += entryColor.r;
+			color.g += entryColor.g;
+			color.b += entryColor.b;
+		}
+	}
+	*outColor = color;
+}
+
 } // End of namespace BladeRunner
@@ -37,6 +37,8 @@ class BladeRunnerEngine;
 
 class ScreenEffects {
 public:
+	static const int kMaxEntries = 7;
+
 	struct Entry {
 		Color256 palette[16];
 		uint16  x;
@@ -47,6 +49,13 @@ public:
 		uint8  *data;
 	};
 
+	// The entries covering one screen line, see getLineEntries()
+	struct LineEntries {
+		const Entry *entries[kMaxEntries];
+		const uint8 *rows[kMaxEntries];
+		uint         count;
+	};
+
 	BladeRunnerEngine *_vm;
 
 	Common::Array<Entry>  _entries;
@@ -60,6 +69,11 @@ public:
 	void readVqa(Common::SeekableReadStream *stream);
 	void getColor(Color256 *outColor, uint16 x, uint16 y, uint16 z) const;
 
+	// Finds the entries for a screen line once, so the pixels along it do
+	// not all have to test every entry
+	void getLineEntries(LineEntries *lineEntries, uint16 y) const;
+	static void getColor(Color256 *outColor, const LineEntries &lineEntries, uint16 x, uint16 z);
+
 	//TODO
 	//bool isAffectingArea(int x, int y, int width, int height, int unk);
 };
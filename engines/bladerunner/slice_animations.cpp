@@ -45,11 +45,14 @@ bool SliceAnimations::open(const Common::String &name) {
 
 	_palettes.resize(_paletteCount);
 
+	byte rgb[256 * 3];
 	for (uint32 i = 0; i != _paletteCount; ++i) {
+		file.read(rgb, sizeof(rgb));
+
 		for (uint32 j = 0; j != 256; ++j) {
-			uint8 color_r = file.readByte();
-			uint8 color_g = file.readByte();
-			uint8 color_b = file.readByte();
+			uint8 color_r = rgb[3 * j + 0];
+			uint8 color_g = rgb[3 * j + 1];
+			uint8 color_b = rgb[3 * j + 2];
 
 			_palettes[i].color[j].r = color_r;
 			_palettes[i].color[j].g = color_g;
@@ -85,6 +88,8 @@ bool SliceAnimations::open(const Common::String &name) {
 }
 
 SliceAnimations::~SliceAnimations() {
+	finishReadAhead();
+
 	for (uint32 i = 0; i != _pages.size(); ++i)
 		free(_pages[i]._data);
 }
@@ -109,6 +114,7 @@ bool SliceAnimations::openFrames(int fileNumber) {
 	if (_framesPageFile._fileNumber == fileNumber)
 		return true;
 
+	finishReadAhead();
 	_framesPageFile.close();
 
 	if (fileNumber == 1 && _framesPageFile.open("CDFRAMES.DAT")) // For Chapter1 we try both CDFRAMES.DAT and CDFRAMES1.DAT
@@ -132,8 +138,13 @@ bool SliceAnimations::PageFile::open(const Common::String &name) {
 	uint32 pageCount  = _file.readUint32LE();
 	uint32 dataOffset = 8 + 4 * pageCount;
 
+	Common::Array<uint32> pageNumbers;
+	pageNumbers.resize(pageCount);
+	if (pageCount)
+		pageCount = _file.readUint32ArrayLE(&pageNumbers[0], pageCount);
+
 	for (uint32 i = 0; i != pageCount; ++i) {
-		uint32 pageNumber = _file.readUint32LE();
+		uint32 pageNumber = pageNumbers[i];
 		if (pageNumber == 0xffffffff)
 			continue;
 		_pageOffsets[pageNumber] = dataOffset + i * _sliceAnimations->_pageSize;
@@ -156,9 +167,10 @@ void *SliceAnimations::PageFile::loadPage(uint32 pageNumber) {
 
 	uint32 pageSize = _sliceAnimations->_pageSize;
 
-	// TODO: Retire oldest pages if we exceed some memory limit
-
 	void *data = malloc(pageSize);
+
+	// Pages are also read by the read-ahead job
+	Common::StackLock lock(_sliceAnimations->_fileMutex);
 	_file.seek(_pageOffsets[pageNumber], SEEK_SET);
 	uint32 r = _file.read(data, pageSize);
 	assert(r == pageSize);
@@ -166,6 +178,75 @@ void *SliceAnimations::PageFile::loadPage(uint32 pageNumber) {
 	return data;
 }
 
+void *SliceAnimations::loadPage(uint32 page) {
+	void *data = _coreAnimPageFile.loadPage(page);
+
+	if (!data)
+		data = _framesPageFile.loadPage(page);
+
+	return data;
+}
+
+void SliceAnimations::retirePages(uint32 keepPage) {
+	while (_pageMemory > kPageMemoryBudget) {
+		int oldest = -1;
+		for (uint32 i = 0; i != _pages.size(); ++i) {
+			if (!_pages[i]._data || i == keepPage)
+				continue;
+			if (oldest == -1 || _pages[i]._lastAccess < _pages[oldest]._lastAccess)
+				oldest = i;
+		}
+
+		if (oldest == -1)
+			break;
+
+		free(_pages[oldest]._data);
+		_pages[oldest]._data = nullptr;
+		_pageMemory -= _pageSize;
+	}
+}
+
+void SliceAnimations::readAheadProc(void *param) {
+	ReadAhead *readAhead = (ReadAhead *)param;
+	readAhead->_data = readAhead->_sliceAnimations->loadPage(readAhead->_page);
+}
+
+void SliceAnimations::startReadAhead(uint32 page) {
+	if (_readAhead._pending) {
+		if (_readAhead._page == page)
+			return;
+		finishReadAhead();
+		if (_pages[page]._data)
+			return;
+	}
+
+	_readAhead._page    = page;
+	_readAhead._data    = nullptr;
+	_readAhead._pending = true;
+	JobMan.submit(readAheadProc, &_readAhead, _readAhead._counter);
+}
+
+void SliceAnimations::finishReadAhead() {
+	if (!_readAhead._pending)
+		return;
+
+	JobMan.wait(_readAhead._counter);
+	_readAhead._pending = false;
+
+	Page &page = _pages[_readAhead._page];
+	if (!_readAhead._data)
+		return;
+
+	if (page._data) {
+		free(_readAhead._data);
+	} else {
+		page._data = _readAhead._data;
+		page._lastAccess = _vm->_system->getMillis();
+		_pageMemory += _pageSize;
+	}
+	_readAhead._data = nullptr;
+}
+
 void *SliceAnimations::getFramePtr(uint32 animation, uint32 frame) {
 	assert(frame < _animations[animation].frameCount);
 
@@ -173,17 +254,27 @@ void *SliceAnimations::getFramePtr(uint32 animation, uint32 frame) {
 	uint32 page        = frameOffset / _pageSize;
 	uint32 pageOffset  = frameOffset % _pageSize;
 
-	if (!_pages[page]._data)
-		_pages[page]._data = _coreAnimPageFile.loadPage(page);
+	if (!_pages[page]._data && _readAhead._pending && _readAhead._page == page)
+		finishReadAhead();
 
-	if (!_pages[page]._data)
-		_pages[page]._data = _framesPageFile.loadPage(page);
-
-	if (!_pages[page]._data)
-		error("Unable to locate page %d for animation %d frame %d", page, animation, frame);
+	if (!_pages[page]._data) {
+		_pages[page]._data = loadPage(page);
+		if (!_pages[page]._data)
+			error("Unable to locate page %d for animation %d frame %d", page, animation, frame);
+		_pageMemory += _pageSize;
+	}
 
 	_pages[page]._lastAccess = _vm->_system->getMillis();
 
+	// Animations loop, so the frame after the last one is the first one
+	uint32 nextFrame  = (frame + 1) % _animations[animation].frameCount;
+	uint32 nextPage   = (_animations[animation].offset + nextFrame * _animations[animation].frameSize) / _pageSize;
+	if (nextPage != page && !_pages[nextPage]._data)
+		startReadAhead(nextPage);
+
+	// The page of the returned frame has to stay until the frame is drawn
+	retirePages(page);
+
 	return (byte *)_pages[page]._data + pageOffset;
 }
 
@@ -25,6 +25,8 @@
 
 #include "common/array.h"
 #include "common/file.h"
+#include "common/jobs.h"
+#include "common/mutex.h"
 #include "common/str.h"
 #include "common/types.h"
 
@@ -76,12 +78,27 @@ class SliceAnimations {
 		void *loadPage(uint32 page);
 	};
 
+	// Reads the page of the next frame in the background
+	struct ReadAhead {
+		SliceAnimations           *_sliceAnimations;
+		uint32                     _page;
+		void                      *_data;
+		bool                       _pending;
+		Common::JobSystem::Counter _counter;
+
+		ReadAhead(SliceAnimations *sliceAnimations) : _sliceAnimations(sliceAnimations), _page(0), _data(nullptr), _pending(false) {}
+	};
+
+	// Least recently used pages are retired above this
+	static const uint32 kPageMemoryBudget = 32 * 1024 * 1024;
+
 	BladeRunnerEngine *_vm;
 
 	uint32 _timestamp;
 	uint32 _pageSize;
 	uint32 _pageCount;
 	uint32 _paletteCount;
+	uint32 _pageMemory;
 
 	Common::Array<Palette>      _palettes;
 	Common::Array<Animation>    _animations;
@@ -90,6 +107,16 @@ class SliceAnimations {
 	PageFile _coreAnimPageFile;
 	PageFile _framesPageFile;
 
+	ReadAhead     _readAhead;
+	Common::Mutex _fileMutex;
+
+	void *loadPage(uint32 page);
+	void  retirePages(uint32 keepPage);
+	void  startReadAhead(uint32 page);
+	void  finishReadAhead();
+
+	static void readAheadProc(void *param);
+
 public:
 	SliceAnimations(BladeRunnerEngine *vm)
 		: _vm(vm)
@@ -98,7 +125,9 @@ public:
 		, _timestamp(0)
 		, _pageSize(0)
 		, _pageCount(0)
-		, _paletteCount(0) {}
+		, _paletteCount(0)
+		, _pageMemory(0)
+		, _readAhead(this) {}
 	~SliceAnimations();
 
 	bool open(const Common::String &name);
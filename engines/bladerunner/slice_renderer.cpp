@@ -28,6 +28,7 @@
 #include "bladerunner/set_effects.h"
 #include "bladerunner/slice_animations.h"
 
+#include "common/jobs.h"
 #include "common/memstream.h"
 #include "common/rect.h"
 #include "common/util.h"
@@ -410,14 +411,6 @@ void SliceRenderer::drawInWorld(int animationId, int animationFrame, Vector3 pos
 		&setEffectsColorCoeficient,
 		&setEffectColor);
 
-	_lightsColor.r = setEffectsColorCoeficient * sliceRendererLights._finalColor.r * 65536.0f;
-	_lightsColor.g = setEffectsColorCoeficient * sliceRendererLights._finalColor.g * 65536.0f;
-	_lightsColor.b = setEffectsColorCoeficient * sliceRendererLights._finalColor.b * 65536.0f;
-
-	_setEffectColor.r = setEffectColor.r * 31.0f * 65536.0f;
-	_setEffectColor.g = setEffectColor.g * 31.0f * 65536.0f;
-	_setEffectColor.b = setEffectColor.b * 31.0f * 65536.0f;
-
 	setupLookupTable(_m12lookup, sliceLineIterator._sliceMatrix(0, 1));
 	setupLookupTable(_m11lookup, sliceLineIterator._sliceMatrix(0, 0));
 	_m13 = sliceLineIterator._sliceMatrix(0, 2);
@@ -439,10 +432,13 @@ void SliceRenderer::drawInWorld(int animationId, int animationFrame, Vector3 pos
 		drawShadowInWorld(transparency, surface, zbuffer);
 	}
 
-	int frameY = sliceLineIterator._startY;
+	// The colors of the lines are calculated first, in order, as the lights
+	// carry their colors over from line to line. Each line only touches its
+	// own row of the surface and the z-buffer, so they are then drawn in
+	// parallel.
+	_sliceLines.clear();
 
-	uint16 *frameLinePtr  = (uint16 *)surface.getPixels() + 640 * frameY;
-	uint16 *zBufferLinePtr = zbuffer + 640 * frameY;
+	int frameY = sliceLineIterator._startY;
 
 	while (sliceLineIterator._currentY <= sliceLineIterator._endY) {
 		sliceLine = sliceLineIterator.line();
@@ -457,22 +453,43 @@ void SliceRenderer::drawInWorld(int animationId, int animationFrame, Vector3 pos
 				&setEffectColor);
 		}
 
-		_lightsColor.r = setEffectsColorCoeficient * sliceRendererLights._finalColor.r * 65536.0f;
-		_lightsColor.g = setEffectsColorCoeficient * sliceRendererLights._finalColor.g * 65536.0f;
-		_lightsColor.b = setEffectsColorCoeficient * sliceRendererLights._finalColor.b * 65536.0f;
+		if (frameY >= 0 && frameY < 480) {
+			SliceLine line;
+			line.y = frameY;
+			line.slice = (int)sliceLine;
 
-		_setEffectColor.r = setEffectColor.r * 31.0f * 65536.0f;
-		_setEffectColor.g = setEffectColor.g * 31.0f * 65536.0f;
-		_setEffectColor.b = setEffectColor.b * 31.0f * 65536.0f;
+			line.lightsColor.r = setEffectsColorCoeficient * sliceRendererLights._finalColor.r * 65536.0f;
+			line.lightsColor.g = setEffectsColorCoeficient * sliceRendererLights._finalColor.g * 65536.0f;
+			line.lightsColor.b = setEffectsColorCoeficient * sliceRendererLights._finalColor.b * 65536.0f;
 
-		if (frameY >= 0 && frameY < 480) {
-			drawSlice((int)sliceLine, true, frameLinePtr, zBufferLinePtr, frameY);
+			line.setEffectColor.r = setEffectColor.r * 31.0f * 65536.0f;
+			line.setEffectColor.g = setEffectColor.g * 31.0f * 65536.0f;
+			line.setEffectColor.b = setEffectColor.b * 31.0f * 65536.0f;
+
+			_sliceLines.push_back(line);
 		}
 
 		sliceLineIterator.advance();
 		frameY += 1;
-		frameLinePtr += 640;
-		zBufferLinePtr += 640;
+	}
+
+	if (_sliceLines.empty()) {
+		return;
+	}
+
+	SliceLinesJob job;
+	job.renderer = this;
+	job.lines = &_sliceLines[0];
+	job.frame = (uint16 *)surface.getPixels();
+	job.zbuffer = zbuffer;
+	JobMan.parallelFor(0, _sliceLines.size(), 32, drawSliceLines, &job);
+}
+
+void SliceRenderer::drawSliceLines(void *param, uint begin, uint end) {
+	const SliceLinesJob *job = (const SliceLinesJob *)param;
+	for (uint i = begin; i < end; ++i) {
+		const SliceLine &line = job->lines[i];
+		job->renderer->drawSlice(line.slice, true, job->frame + 640 * line.y, job->zbuffer + 640 * line.y, line.y, line.lightsColor, line.setEffectColor);
 	}
 }
 
@@ -530,7 +547,7 @@ void SliceRenderer::drawOnScreen(int animationId, int animationFrame, int screen
 	while (currentSlice < _frameSliceCount) {
 		if (currentY >= 0 && currentY < 480) {
 			memset(lineZbuffer, 0xFF, 640 * 2);
-			drawSlice(currentSlice, false, frameLinePtr, lineZbuffer, currentY);
+			drawSlice(currentSlice, false, frameLinePtr, lineZbuffer, currentY, Color(), Color());
 			currentSlice += sliceStep;
 			currentY--;
 			frameLinePtr -= 640;
@@ -538,7 +555,7 @@ void SliceRenderer::drawOnScreen(int animationId, int animationFrame, int screen
 	}
 }
 
-void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, uint16 *zbufLinePtr, int y) {
+void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, uint16 *zbufLinePtr, int y, const Color &lightsColor, const Color &setEffectColor) {
 	if (slice < 0 || (uint32)slice >= _frameSliceCount) {
 		return;
 	}
@@ -553,6 +570,12 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 
 	uint32 polyCount = READ_LE_UINT32(p);
 	p += 4;
+
+	ScreenEffects::LineEntries screenEffectsLine;
+	if (advanced) {
+		_screenEffects->getLineEntries(&screenEffectsLine, y);
+	}
+
 	while (polyCount--) {
 		uint32 vertexCount = READ_LE_UINT32(p);
 		p += 4;
@@ -575,12 +598,12 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 					int color555 = palette.color555[p[2]];
 					if (advanced) {
 						Color256 aescColor = { 0, 0, 0 };
-						_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
+						ScreenEffects::getColor(&aescColor, screenEffectsLine, vertexX, vertexZ);
 
 						Color256 color = palette.color[p[2]];
-						color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) >> 16) + aescColor.r;
-						color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) >> 16) + aescColor.g;
-						color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) >> 16) + aescColor.b;
+						color.r = ((int)(setEffectColor.r + lightsColor.r * color.r) >> 16) + aescColor.r;
+						color.g = ((int)(setEffectColor.g + lightsColor.g * color.g) >> 16) + aescColor.g;
+						color.b = ((int)(setEffectColor.b + lightsColor.b * color.b) >> 16) + aescColor.b;
 
 						int bladeToScummVmConstant = 256 / 32;
 						color555 = _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
@@ -28,6 +28,7 @@
 #include "bladerunner/view.h"
 #include "bladerunner/matrix.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 
 #include "graphics/surface.h"
@@ -86,11 +87,24 @@ class SliceRenderer {
 	Vector3 _shadowPolygonDefault[12];
 	Vector3 _shadowPolygonCurrent[12];
 
-	Color _setEffectColor;
-	Color _lightsColor;
-
 	Graphics::PixelFormat _pixelFormat;
 
+	struct SliceLine {
+		int y;
+		int slice;
+		Color lightsColor;
+		Color setEffectColor;
+	};
+
+	struct SliceLinesJob {
+		SliceRenderer *renderer;
+		const SliceLine *lines;
+		uint16 *frame;
+		uint16 *zbuffer;
+	};
+
+	Common::Array<SliceLine> _sliceLines;
+
 public:
 	SliceRenderer(BladeRunnerEngine *vm);
 	~SliceRenderer();
@@ -114,7 +128,8 @@ private:
 	Matrix3x2 calculateFacingRotationMatrix();
 	void loadFrame(int animation, int frame);
 
-	void drawSlice(int slice, bool advanced, uint16 *frameLinePtr, uint16 *zbufLinePtr, int y);
+	void drawSlice(int slice, bool advanced, uint16 *frameLinePtr, uint16 *zbufLinePtr, int y, const Color &lightsColor, const Color &setEffectColor);
+	static void drawSliceLines(void *param, uint begin, uint end);
 	void drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 	void drawShadowPolygon(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 };
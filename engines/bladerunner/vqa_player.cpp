@@ -26,6 +26,7 @@
 
 #include "audio/decoders/raw.h"
 
+#include "common/jobs.h"
 #include "common/system.h"
 
 namespace BladeRunner {
@@ -71,7 +72,7 @@ void VQAPlayer::close() {
 	_s = nullptr;
 }
 
-int VQAPlayer::update(bool forceDraw, bool advanceFrame, Graphics::Surface *customSurface) {
+int VQAPlayer::update(bool forceDraw, bool advanceFrame, Graphics::Surface *customSurface, ZBuffer *zbuffer) {
 	uint32 now = 60 * _vm->_system->getMillis();
 	int result = -1;
 
@@ -111,7 +112,19 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, Graphics::Surface *cust
 	} else if (advanceFrame) {
 		_frame = _frameNext;
 		_decoder.readFrame(_frameNext, kVQAReadVideo);
+
+		// The z-buffer is decoded alongside the video frame, neither reads
+		// the stream or the data of the other
+		ZBufferJob zbufferJob;
+		Common::JobSystem::Counter zbufferCounter;
+		if (zbuffer != nullptr) {
+			zbufferJob.decoder = &_decoder;
+			zbufferJob.zbuffer = zbuffer;
+			JobMan.submit(decodeZBufferProc, &zbufferJob, zbufferCounter);
+		}
+
 		_decoder.decodeVideoFrame(customSurface != nullptr ? customSurface : _surface, _frameNext);
+		JobMan.wait(zbufferCounter);
 
 		int audioPreloadFrames = 14;
 
@@ -148,6 +161,11 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, Graphics::Surface *cust
 	return result;
 }
 
+void VQAPlayer::decodeZBufferProc(void *param) {
+	ZBufferJob *job = (ZBufferJob *)param;
+	job->decoder->decodeZBuffer(job->zbuffer);
+}
+
 void VQAPlayer::updateZBuffer(ZBuffer *zbuffer) {
 	_decoder.decodeZBuffer(zbuffer);
 }
@@ -106,7 +106,7 @@ public:
 	bool open(const Common::String &name);
 	void close();
 
-	int  update(bool forceDraw = false, bool advanceFrame = true, Graphics::Surface *customSurface = nullptr);
+	int  update(bool forceDraw = false, bool advanceFrame = true, Graphics::Surface *customSurface = nullptr, ZBuffer *zbuffer = nullptr);
 	void updateZBuffer(ZBuffer *zbuffer);
 	void updateView(View *view);
 	void updateScreenEffects(ScreenEffects *screenEffects);
@@ -123,7 +123,14 @@ public:
 	int getFrameCount();
 
 private:
+	struct ZBufferJob {
+		VQADecoder *decoder;
+		ZBuffer    *zbuffer;
+	};
+
 	void queueAudioFrame(Audio::AudioStream *audioStream);
+
+	static void decodeZBufferProc(void *param);
 };
 
 } // End of namespace BladeRunner
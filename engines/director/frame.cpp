@@ -95,6 +95,7 @@ Frame::Frame(const Frame &frame) {
 
 Frame::~Frame() {
 	delete _palette;
+	clearDrawRects();
 }
 
 void Frame::readChannel(Common::SeekableSubReadStreamEndian &stream, uint16 offset, uint16 size) {
@@ -403,7 +404,7 @@ void Frame::readSprite(Common::SeekableSubReadStreamEndian &stream, uint16 offse
 }
 
 void Frame::prepareFrame(Score *score) {
-	_drawRects.clear();
+	clearDrawRects();
 	renderSprites(*score->_surface, false);
 	renderSprites(*score->_trailSurface, true);
 
@@ -641,6 +642,31 @@ void Frame::addDrawRect(uint16 spriteId, Common::Rect &rect) {
 	_drawRects.push_back(fi);
 }
 
+void Frame::clearDrawRects() {
+	for (uint i = 0; i < _drawRects.size(); i++)
+		delete _drawRects[i];
+
+	_drawRects.clear();
+}
+
+// Sets coverage[j] to whether getSpriteIDFromPos() is not 0 at
+// (left + j, y), for a whole row at once
+void Frame::getSpriteCoverage(byte *coverage, int left, int width, int y) {
+	memset(coverage, 0, width);
+
+	// Rects drawn later are in front, so they overwrite earlier ones
+	for (uint dr = 0; dr < _drawRects.size(); dr++) {
+		const Common::Rect &rect = _drawRects[dr]->rect;
+		if (y < rect.top || y >= rect.bottom)
+			continue;
+
+		int x1 = MAX<int>(rect.left, left);
+		int x2 = MIN<int>(rect.right, left + width);
+		if (x1 < x2)
+			memset(coverage + x1 - left, _drawRects[dr]->spriteId != 0, x2 - x1);
+	}
+}
+
 void Frame::renderShape(Graphics::ManagedSurface &surface, uint16 spriteId) {
 	Common::Rect shapeRect = Common::Rect(_sprites[spriteId]->_startPoint.x,
 		_sprites[spriteId]->_startPoint.y,
@@ -880,12 +906,15 @@ void Frame::drawBackgndTransSprite(Graphics::ManagedSurface &target, const Graph
 
 void Frame::drawGhostSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
 	uint8 skipColor = _vm->getPaletteColorCount() - 1;
+	Common::Array<byte> coverage(drawRect.width());
 	for (int ii = 0; ii < sprite.h; ii++) {
 		const byte *src = (const byte *)sprite.getBasePtr(0, ii);
 		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + ii);
 
+		getSpriteCoverage(coverage.begin(), drawRect.left, drawRect.width(), drawRect.top + ii);
+
 		for (int j = 0; j < drawRect.width(); j++) {
-			if ((getSpriteIDFromPos(Common::Point(drawRect.left + j, drawRect.top + ii)) != 0) && (*src != skipColor))
+			if (coverage[j] && (*src != skipColor))
 				*dst = (_vm->getPaletteColorCount() - 1) - *src; // Oposite color
 
 			src++;
@@ -896,12 +925,15 @@ void Frame::drawGhostSprite(Graphics::ManagedSurface &target, const Graphics::Su
 
 void Frame::drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
 	uint8 skipColor = _vm->getPaletteColorCount() - 1;
+	Common::Array<byte> coverage(drawRect.width());
 	for (int ii = 0; ii < sprite.h; ii++) {
 		const byte *src = (const byte *)sprite.getBasePtr(0, ii);
 		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + ii);
 
+		getSpriteCoverage(coverage.begin(), drawRect.left, drawRect.width(), drawRect.top + ii);
+
 		for (int j = 0; j < drawRect.width(); j++) {
-			if ((getSpriteIDFromPos(Common::Point(drawRect.left + j, drawRect.top + ii)) != 0)) {
+			if (coverage[j]) {
 				if (*src != skipColor) {
 					*dst = (*dst == *src ? (*src == 0 ? 0xff : 0) : *src);
 				}
@@ -916,8 +948,8 @@ void Frame::drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::
 
 void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
 	// Like background trans, but all white pixels NOT ENCLOSED by coloured pixels are transparent
-	Graphics::Surface tmp;
-	tmp.copyFrom(sprite);
+	// The flood fill below only builds a mask, so the sprite can be read in place
+	const Graphics::Surface &tmp = sprite;
 
 	// Searching white color in the corners
 	int whiteColor = -1;
@@ -926,7 +958,7 @@ void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Su
 		int x = (corner & 0x1) ? tmp.w - 1 : 0;
 		int y = (corner & 0x2) ? tmp.h - 1 : 0;
 
-		byte color = *(byte *)tmp.getBasePtr(x, y);
+		byte color = *(const byte *)tmp.getBasePtr(x, y);
 
 		if (_vm->getPalette()[color * 3 + 0] == 0xff &&
 			_vm->getPalette()[color * 3 + 1] == 0xff &&
@@ -947,7 +979,7 @@ void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Su
 				*dst = *src;
 		}
 	} else {
-		Graphics::FloodFill ff(&tmp, whiteColor, 0, true);
+		Graphics::FloodFill ff(const_cast<Graphics::Surface *>(&tmp), whiteColor, 0, true);
 
 		for (int yy = 0; yy < tmp.h; yy++) {
 			ff.addSeed(0, yy);
@@ -970,8 +1002,6 @@ void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Su
 					*dst = *src;
 		}
 	}
-
-	tmp.free();
 }
 
 uint16 Frame::getSpriteIDFromPos(Common::Point pos) {
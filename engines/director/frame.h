@@ -139,6 +139,8 @@ private:
 	void drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
 	void inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics::Surface &spriteSurface, uint16 spriteId, Common::Rect drawRect);
 	void addDrawRect(uint16 entityId, Common::Rect &rect);
+	void clearDrawRects();
+	void getSpriteCoverage(byte *coverage, int left, int width, int y);
 
 public:
 	byte _channelData[kChannelDataSize];
@@ -92,18 +92,21 @@ ScriptType Lingo::event2script(LEvent ev) {
 }
 
 Symbol *Lingo::getHandler(Common::String &name) {
-	if (!_eventHandlerTypeIds.contains(name)) {
-		if (_builtins.contains(name))
-			return _builtins[name];
+	Common::HashMap<Common::String, uint32>::const_iterator typeId = _eventHandlerTypeIds.find(name);
+	if (typeId == _eventHandlerTypeIds.end()) {
+		SymbolHash::const_iterator builtin = _builtins.find(name);
+		if (builtin != _builtins.end())
+			return builtin->_value;
 
 		return NULL;
 	}
 
-	uint32 entityIndex = ENTITY_INDEX(_eventHandlerTypeIds[name], _currentEntityId);
-	if (!_handlers.contains(entityIndex))
+	uint32 entityIndex = ENTITY_INDEX(typeId->_value, _currentEntityId);
+	Common::HashMap<uint32, Symbol *>::const_iterator handler = _handlers.find(entityIndex);
+	if (handler == _handlers.end())
 		return NULL;
 
-	return _handlers[entityIndex];
+	return handler->_value;
 }
 
 void Lingo::primaryEventHandler(LEvent event) {
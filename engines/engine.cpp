@@ -294,7 +294,9 @@ void initGraphics(int width, int height, const Graphics::PixelFormat *format) {
 
 	OSystem::TransactionError gfxError = g_system->endGFXTransaction();
 
-	if (!splash && !GUI::GuiManager::instance()._launched)
+	// The GUI is only created once it is used, so a game started directly
+	// does not need to load the theme here
+	if (!splash && (!GUI::GuiManager::hasInstance() || !g_gui._launched))
 		splashScreen();
 
 	if (gfxError == OSystem::kTransactionSuccess)
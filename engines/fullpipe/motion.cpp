@@ -2743,79 +2743,169 @@ MovGraphLink *MctlGraph::getNearestLink(int x, int y) {
 		return 0;
 }
 
+int MctlGraph::getGraphNodeIndex(MovGraphNode *node) {
+	for (uint i = 0; i < _graphNodes.size(); i++)
+		if (_graphNodes[i] == node)
+			return i;
+
+	return -1;
+}
+
+void MctlGraph::buildAdjacency() {
+	debugC(4, kDebugPathfinding, "MctlGraph::buildAdjacency()");
+
+	_graphNodes.clear();
+	_graphLinks.clear();
+	_graphAdjacency.clear();
+
+	for (LinkList::iterator i = _links.begin(); i != _links.end(); ++i) {
+		MovGraphLink *lnk = static_cast<MovGraphLink *>(*i);
+		GraphLink graphLink;
+
+		graphLink.link = lnk;
+
+		MovGraphNode *ends[2] = { lnk->_graphSrc, lnk->_graphDst };
+		int idx[2];
+
+		for (int j = 0; j < 2; j++) {
+			idx[j] = getGraphNodeIndex(ends[j]);
+
+			if (idx[j] < 0) {
+				idx[j] = _graphNodes.size();
+				_graphNodes.push_back(ends[j]);
+				_graphAdjacency.push_back(Common::Array<int>());
+			}
+		}
+
+		graphLink.src = idx[0];
+		graphLink.dst = idx[1];
+
+		_graphAdjacency[idx[0]].push_back(_graphLinks.size());
+		if (idx[1] != idx[0])
+			_graphAdjacency[idx[1]].push_back(_graphLinks.size());
+
+		_graphLinks.push_back(graphLink);
+	}
+}
+
 double MctlGraph::iterate(LinkInfo *linkInfoSource, LinkInfo *linkInfoDest, MovGraphLinkList *listObj) {
 	debugC(4, kDebugPathfinding, "MctlGraph::iterate(...)");
 
-	LinkInfo linkInfoWorkSource;
+	if (linkInfoSource->link == linkInfoDest->link && linkInfoSource->node == linkInfoDest->node) {
+		if (linkInfoSource->link)
+			listObj->push_back(linkInfoSource->link);
 
-	if (linkInfoSource->link != linkInfoDest->link || linkInfoSource->node != linkInfoDest->node) {
-		double minDistance = -1.0;
+		return 0.0;
+	}
 
-		if (linkInfoSource->node) {
-			for (LinkList::iterator i = _links.begin(); i != _links.end(); ++i) {
-				MovGraphLink *lnk = static_cast<MovGraphLink *>(*i);
+	// The links never change after the scene is loaded, but the list is
+	// only filled in after construction
+	if (_graphLinks.size() != _links.size())
+		buildAdjacency();
 
-				if ((lnk->_graphSrc == linkInfoSource->node || lnk->_graphDst == linkInfoSource->node) && !(lnk->_flags & 0xA0000000)) {
-					linkInfoWorkSource.node = 0;
-					linkInfoWorkSource.link = lnk;
+	const uint numNodes = _graphNodes.size();
+	Common::Array<double> distance(numNodes, -1.0);
+	Common::Array<int> via(numNodes, -1);
+	Common::Array<bool> done(numNodes, false);
 
-					MovGraphLinkList tmpList;
+	// A link is entered from either of its ends without being walked
+	if (linkInfoSource->node) {
+		int idx = getGraphNodeIndex(linkInfoSource->node);
 
-					lnk->_flags |= 0x80000000;
+		if (idx < 0)
+			return -1.0;
 
-					double newDistance = iterate(&linkInfoWorkSource, linkInfoDest, &tmpList);
+		distance[idx] = 0.0;
+	} else {
+		int idx = getGraphNodeIndex(linkInfoSource->link->_graphSrc);
 
-					if (newDistance >= 0.0 && (minDistance < 0.0 || newDistance + lnk->_length < minDistance)) {
-						listObj->clear();
-						listObj->push_back(tmpList);
+		if (idx >= 0)
+			distance[idx] = 0.0;
 
-						minDistance = newDistance + lnk->_length;
-					}
+		idx = getGraphNodeIndex(linkInfoSource->link->_graphDst);
 
-					lnk->_flags &= 0x7FFFFFFF;
-				}
-			}
-		} else if (linkInfoSource->link) {
-			linkInfoWorkSource.node = linkInfoSource->link->_graphSrc;
-			linkInfoWorkSource.link = 0;
+		if (idx >= 0)
+			distance[idx] = 0.0;
+	}
 
-			MovGraphLinkList tmpList;
+	int destIdx = linkInfoDest->node ? getGraphNodeIndex(linkInfoDest->node) : -1;
 
-			double newDistance = iterate(&linkInfoWorkSource, linkInfoDest, &tmpList);
+	if (linkInfoDest->node && destIdx < 0)
+		return -1.0;
 
-			if (newDistance >= 0.0) {
-				listObj->clear();
+	// Dijkstra over the nodes. Links with the 0x20000000 flag are closed.
+	for (;;) {
+		int cur = -1;
 
-				listObj->push_back(linkInfoSource->link);
-				listObj->push_back(tmpList);
+		for (uint i = 0; i < numNodes; i++)
+			if (!done[i] && distance[i] >= 0.0 && (cur < 0 || distance[i] < distance[cur]))
+				cur = i;
 
-				minDistance = newDistance;
-			}
+		if (cur < 0 || cur == destIdx)
+			break;
 
-			linkInfoWorkSource.link = 0;
-			linkInfoWorkSource.node = linkInfoSource->link->_graphDst;
+		done[cur] = true;
 
-			tmpList.clear();
+		for (uint i = 0; i < _graphAdjacency[cur].size(); i++) {
+			const GraphLink &graphLink = _graphLinks[_graphAdjacency[cur][i]];
+
+			if (graphLink.link->_flags & 0xA0000000)
+				continue;
+
+			int next = graphLink.src == cur ? graphLink.dst : graphLink.src;
+			double newDistance = distance[cur] + graphLink.link->_length;
+
+			if (!done[next] && (distance[next] < 0.0 || newDistance < distance[next])) {
+				distance[next] = newDistance;
+				via[next] = _graphAdjacency[cur][i];
+			}
+		}
+	}
 
-			newDistance = iterate(&linkInfoWorkSource, linkInfoDest, &tmpList);
+	// The destination link is walked in full, from whichever end is closer
+	double minDistance = -1.0;
+	int endIdx = -1;
 
-			if (newDistance >= 0 && (minDistance < 0.0 || newDistance < minDistance)) {
-				listObj->clear();
+	if (linkInfoDest->node) {
+		minDistance = distance[destIdx];
+		endIdx = destIdx;
+	} else if (!(linkInfoDest->link->_flags & 0xA0000000)) {
+		MovGraphNode *ends[2] = { linkInfoDest->link->_graphSrc, linkInfoDest->link->_graphDst };
 
-				listObj->push_back(linkInfoSource->link);
-				listObj->push_back(tmpList);
+		for (int j = 0; j < 2; j++) {
+			int idx = getGraphNodeIndex(ends[j]);
 
-				minDistance = newDistance;
+			if (idx >= 0 && distance[idx] >= 0.0 && (minDistance < 0.0 || distance[idx] + linkInfoDest->link->_length < minDistance)) {
+				minDistance = distance[idx] + linkInfoDest->link->_length;
+				endIdx = idx;
 			}
 		}
+	}
 
-		return minDistance;
-	} else {
-		if (linkInfoSource->link)
-			listObj->push_back(linkInfoSource->link);
+	if (minDistance < 0.0)
+		return -1.0;
 
-		return 0.0;
+	MovGraphLinkList path;
+
+	for (int idx = endIdx; via[idx] >= 0; ) {
+		const GraphLink &graphLink = _graphLinks[via[idx]];
+
+		path.push_back(graphLink.link);
+		idx = graphLink.src == idx ? graphLink.dst : graphLink.src;
 	}
+
+	listObj->clear();
+
+	if (linkInfoSource->link)
+		listObj->push_back(linkInfoSource->link);
+
+	for (int i = path.size() - 1; i >= 0; i--)
+		listObj->push_back(path[i]);
+
+	if (linkInfoDest->link)
+		listObj->push_back(linkInfoDest->link);
+
+	return minDistance;
 }
 
 MovGraphNode *MovGraph::calcOffset(int ox, int oy) {
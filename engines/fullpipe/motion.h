@@ -396,6 +396,21 @@ public:
 	double iterate(LinkInfo *linkInfoSource, LinkInfo *linkInfoDest, MovGraphLinkList *listObj);
 
 	MessageQueue *makeLineQueue(MctlMQ *movinfo);
+
+private:
+	struct GraphLink {
+		MovGraphLink *link;
+		int src;
+		int dst;
+	};
+
+	/** The links indexed by node, for searching paths with iterate() */
+	Common::Array<MovGraphNode *> _graphNodes;
+	Common::Array<GraphLink> _graphLinks;
+	Common::Array<Common::Array<int> > _graphAdjacency;
+
+	int getGraphNodeIndex(MovGraphNode *node);
+	void buildAdjacency();
 };
 
 class MctlConnectionPoint : public CObject {
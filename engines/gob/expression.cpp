@@ -32,19 +32,12 @@
 
 namespace Gob {
 
-Expression::Stack::Stack(size_t size) {
-	opers  = new byte[size];
-	values = new int32[size];
-	memset(opers , 0, size * sizeof(byte ));
-	memset(values, 0, size * sizeof(int32));
+Expression::Stack::Stack() {
+	memset(opers , 0, sizeof(opers ));
+	memset(values, 0, sizeof(values));
 }
 
-Expression::Stack::~Stack() {
-	delete[] opers;
-	delete[] values;
-}
-
-Expression::StackFrame::StackFrame(const Stack &stack) {
+Expression::StackFrame::StackFrame(Stack &stack) {
 	opers = stack.opers - 1;
 	values = stack.values - 1;
 	pos = -1;
@@ -62,11 +55,16 @@ void Expression::StackFrame::pop(int count) {
 	pos    -= count;
 }
 
-Expression::Expression(GobEngine *vm) : _vm(vm) {
+Expression::Expression(GobEngine *vm) : _vm(vm), _compiledScript(0) {
 	_resultStr[0] = 0;
 	_resultInt = 0;
 }
 
+void Expression::clearCompiledExprs() {
+	_compiledExprs.clear();
+	_compiledScript = 0;
+}
+
 int32 Expression::encodePtr(byte *ptr, int type) {
 	int32 offset = 0;
 
@@ -996,6 +994,130 @@ void Expression::getResult(byte operation, int32 value, byte *type) {
 	}
 }
 
+// Load a value from a compiled expression
+void Expression::loadCompiledValue(const CompiledToken &token, const StackFrame &stackFrame) {
+	*stackFrame.opers = OP_LOAD_IMM_INT16;
+
+	switch (token.operation) {
+	case OP_LOAD_VAR_INT16:
+		*stackFrame.values = (int16) READ_VARO_UINT16(token.value);
+		break;
+
+	case OP_LOAD_VAR_INT8:
+		*stackFrame.values = (int8) READ_VARO_UINT8(token.value);
+		break;
+
+	case OP_LOAD_VAR_INT32:
+		*stackFrame.values = READ_VARO_UINT32(token.value);
+		break;
+
+	case OP_LOAD_VAR_INT32_AS_INT16:
+		*stackFrame.values = (int16) READ_VARO_UINT16(token.value);
+		break;
+
+	default:
+		*stackFrame.values = token.value;
+		break;
+	}
+}
+
+const Expression::CompiledExpr *Expression::getCompiledExpr(byte stopToken) {
+	Script *script = _vm->_game->_script;
+
+	if (script->getData() != _compiledScript) {
+		_compiledExprs.clear();
+		_compiledScript = script->getData();
+	}
+
+	const uint32 key = (script->pos() << 8) | stopToken;
+
+	CompiledExprMap::const_iterator it = _compiledExprs.find(key);
+	if (it != _compiledExprs.end())
+		return it->_value.length ? &it->_value : 0;
+
+	CompiledExpr &expr = _compiledExprs[key];
+	compileExpr(expr, stopToken);
+
+	return expr.length ? &expr : 0;
+}
+
+void Expression::compileExpr(CompiledExpr &expr, byte stopToken) {
+	Script *script = _vm->_game->_script;
+
+	const int32 size = script->getSize() - script->pos();
+	bool hasOperand = false;
+	int32 pos = 0;
+
+	// Follows the tokens in the same order parseExpr() checks them
+	while (pos < size) {
+		CompiledToken token;
+		token.operation = script->peekByte(pos);
+		token.value = 0;
+
+		int32 tokenSize = 1;
+
+		switch (token.operation) {
+		case OP_LOAD_VAR_INT16:
+			token.value = script->peekUint16(pos + 1) * 2;
+			tokenSize = 3;
+			break;
+
+		case OP_LOAD_VAR_INT8:
+			token.value = script->peekUint16(pos + 1);
+			tokenSize = 3;
+			break;
+
+		case OP_LOAD_VAR_INT32:
+		case OP_LOAD_VAR_INT32_AS_INT16:
+			token.value = script->peekUint16(pos + 1) * 4;
+			tokenSize = 3;
+			break;
+
+		case OP_LOAD_IMM_INT32:
+			token.value = script->peekInt32(pos + 1);
+			tokenSize = 5;
+			break;
+
+		case OP_LOAD_IMM_INT16:
+			token.value = script->peekInt16(pos + 1);
+			tokenSize = 3;
+			break;
+
+		case OP_LOAD_IMM_INT8:
+			token.value = script->peekInt8(pos + 1);
+			tokenSize = 2;
+			break;
+
+		default:
+			// Variable offsets, arrays, strings and functions need the full parser.
+			// So do logical operators, since they skip parts of the expression.
+			if ((token.operation == 14) || (token.operation == 15) ||
+			    ((token.operation >= OP_ARRAY_INT8) && (token.operation <= OP_FUNC)) ||
+			    (token.operation == OP_OR) || (token.operation == OP_AND))
+				return;
+
+			if ((token.operation != stopToken) &&
+			    ((token.operation < OP_NEG) || (token.operation > OP_NOT)) &&
+			    ((token.operation < OP_LESS) || (token.operation > OP_NEQ)))
+				return;
+			break;
+		}
+
+		const bool isStop = (tokenSize == 1) && (token.operation == stopToken);
+		if (tokenSize > 1)
+			hasOperand = true;
+
+		expr.tokens.push_back(token);
+		pos += tokenSize;
+
+		if (isStop) {
+			if (hasOperand && (pos <= size))
+				expr.length = pos;
+			return;
+		}
+	}
+}
+
 int16 Expression::parseExpr(byte stopToken, byte *type) {
 	Stack stack;
 	StackFrame stackFrame(stack);
@@ -1003,15 +1125,26 @@ int16 Expression::parseExpr(byte stopToken, byte *type) {
 	int16 brackStart;
 	uint32 varBase;
 
+	const CompiledExpr *compiled = getCompiledExpr(stopToken);
+	uint tokenIndex = 0;
+
 	while (true) {
-		getVarBase(varBase);
+		const CompiledToken *token = 0;
+		if (compiled) {
+			token = &compiled->tokens[tokenIndex++];
+			varBase = 0;
+		} else
+			getVarBase(varBase);
 
 		stackFrame.push();
 
-		operation = _vm->_game->_script->readByte();
+		operation = token ? token->operation : _vm->_game->_script->readByte();
 		if ((operation >= OP_ARRAY_INT8) && (operation <= OP_FUNC)) {
 
-			loadValue(operation, varBase, stackFrame);
+			if (token)
+				loadCompiledValue(*token, stackFrame);
+			else
+				loadValue(operation, varBase, stackFrame);
 
 			if ((stackFrame.pos > 0) && ((stackFrame.opers[-1] == OP_NEG) || (stackFrame.opers[-1] == OP_NOT))) {
 				stackFrame.pop();
@@ -1095,6 +1228,10 @@ int16 Expression::parseExpr(byte stopToken, byte *type) {
 			if (operation != stopToken)
 				continue;
 
+			// Move past the compiled expression, without changing the state of the script
+			if (compiled)
+				_vm->_game->_script->readString(compiled->length);
+
 			getResult(stack.opers[0], stack.values[0], type);
 
 			return 0;
@@ -24,6 +24,8 @@
 #define GOB_EXPRESSION_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 
 namespace Gob {
 
@@ -122,14 +124,18 @@ public:
 	int32 getResultInt();
 	char *getResultStr();
 
+	/** Forget all compiled expressions, e.g. because their script was unloaded. */
+	void clearCompiledExprs();
+
 private:
 	class Stack {
 	public:
-		byte *opers;
-		int32 *values;
+		enum { kSize = 20 };
 
-		Stack(size_t size = 20);
-		~Stack();
+		byte opers[kSize];
+		int32 values[kSize];
+
+		Stack();
 	};
 	class StackFrame {
 	public:
@@ -137,7 +143,7 @@ private:
 		int32 *values;
 		int16 pos;
 
-		StackFrame(const Stack &stack);
+		StackFrame(Stack &stack);
 
 		void push(int count = 1);
 		void pop(int count = 1);
@@ -149,8 +155,35 @@ private:
 		kResStr   = 2
 	};
 
+	/** An operand or operator of a compiled expression. */
+	struct CompiledToken {
+		byte operation;
+		int32 value; ///< The immediate value, or the offset of the variable
+	};
+
+	/**
+	 * An expression in the script, already split into tokens.
+	 *
+	 * Only expressions consisting of integer immediates, plain variables and
+	 * operators are compiled. Their evaluation does not depend on anything
+	 * but the variables, so the tokens can be reused every time the script
+	 * reaches the expression again.
+	 */
+	struct CompiledExpr {
+		uint32 length; ///< Size of the expression in the script, 0 if it can't be compiled
+		Common::Array<CompiledToken> tokens;
+
+		CompiledExpr() : length(0) {}
+	};
+
+	/** Compiled expressions, by script offset and stop token. */
+	typedef Common::HashMap<uint32, CompiledExpr> CompiledExprMap;
+
 	GobEngine *_vm;
 
+	CompiledExprMap _compiledExprs;
+	byte *_compiledScript; ///< The script data the compiled expressions belong to
+
 	int32 _resultInt;
 	char _resultStr[200];
 
@@ -163,6 +196,10 @@ private:
 			uint16 *size = 0, uint16 *type = 0);
 	int cmpHelper(const StackFrame &stackFrame);
 	void loadValue(byte operation, uint32 varBase, const StackFrame &stackFrame);
+	void loadCompiledValue(const CompiledToken &token, const StackFrame &stackFrame);
+
+	const CompiledExpr *getCompiledExpr(byte stopToken);
+	void compileExpr(CompiledExpr &expr, byte stopToken);
 
 	void simpleArithmetic1(StackFrame &stackFrame);
 	void simpleArithmetic2(StackFrame &stackFrame);
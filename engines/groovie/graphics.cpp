@@ -117,6 +117,17 @@ void GraphicsMan::updateScreen(Graphics::Surface *source) {
 	change();
 }
 
+void GraphicsMan::updateScreen(Graphics::Surface *source, const Common::Rect &rect) {
+	Common::Rect area = rect;
+	area.clip(source->w, source->h);
+	if (area.isEmpty())
+		return;
+
+	int top = isFullScreen() ? 0 : 80;
+	_vm->_system->copyRectToScreen(source->getBasePtr(area.left, area.top), source->pitch, area.left, top + area.top, area.width(), area.height());
+	change();
+}
+
 bool GraphicsMan::isFading() {
 	return _fading;
 }
@@ -41,6 +41,7 @@ public:
 	void switchToFullScreen(bool fullScreen);
 	bool isFullScreen() { return (_foreground.h == 480); }
 	void updateScreen(Graphics::Surface *source);
+	void updateScreen(Graphics::Surface *source, const Common::Rect &rect);
 	Graphics::Surface _foreground;	// The main surface that most things are drawn to
 	Graphics::Surface _background;	// Used occasionally, mostly (only?) in puzzles
 
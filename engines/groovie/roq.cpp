@@ -128,17 +128,26 @@ void ROQPlayer::buildShowBuf() {
 	if (_alpha)
 		_fg->copyFrom(*_bg);
 
+	// Handle transparency in Gamepad videos
+	// TODO: For now, we detect these videos by checking for full screen
+	const bool whiteIsTransparent = (_fg->h == 480);
+	const uint32 white = _vm->_pixelFormat.RGBToColor(255, 255, 255);
+
 	for (int line = 0; line < _bg->h; line++) {
 		uint32 *out = _alpha ? (uint32 *)_fg->getBasePtr(0, line) : (uint32 *)_bg->getBasePtr(0, line);
 		uint32 *in = (uint32 *)_currBuf->getBasePtr(0, line / _scaleY);
 
+		// Unscaled opaque lines are copied as they are
+		if (!_alpha && !whiteIsTransparent && _scaleX == 1) {
+			memcpy(out, in, _bg->w * sizeof(uint32));
+			continue;
+		}
+
 		for (int x = 0; x < _bg->w; x++) {
 			// Copy a pixel, checking the alpha channel first
 			if (_alpha && !(*in & 0xFF))
 				out++;
-			else if (_fg->h == 480 && *in == _vm->_pixelFormat.RGBToColor(255, 255, 255))
-				// Handle transparency in Gamepad videos
-				// TODO: For now, we detect these videos by checking for full screen
+			else if (whiteIsTransparent && *in == white)
 				out++;
 			else
 				*out++ = *in;
@@ -350,18 +359,23 @@ bool ROQPlayer::processBlockQuadCodebook(ROQBlockHeader &blockHeader) {
 	uint32 *codebook = _codebook2;
 
 	for (int i = 0; i < newNum2blocks; i++) {
+		// Read the whole entry at once
+		byte entry[10];
+		const byte *data = entry;
+		_file->read(entry, _alpha ? 10 : 6);
+
 		// Read the 4 Y components and their alpha channel
 		byte y[4];
 		byte a[4];
 
 		for (int j = 0; j < 4; j++) {
-			y[j] = _file->readByte();
-			a[j] = _alpha ? _file->readByte() : 255;
+			y[j] = *data++;
+			a[j] = _alpha ? *data++ : 255;
 		}
 
 		// Read the subsampled Cb and Cr
-		byte u = _file->readByte();
-		byte v = _file->readByte();
+		byte u = *data++;
+		byte v = *data++;
 
 		// Convert the codebook to RGB right here
 		for (int j = 0; j < 4; j++) {
@@ -640,17 +654,19 @@ void ROQPlayer::paint8(byte i, int destx, int desty) {
 	}
 
 	byte *block4 = &_codebook4[i * 4];
+	uint32 pitch = _currBuf->pitch / 4;
 	for (int y4 = 0; y4 < 2; y4++) {
 		for (int x4 = 0; x4 < 2; x4++) {
 			uint32 *block2 = _codebook2 + *block4++ * 4;
+			uint32 *ptr = (uint32 *)_currBuf->getBasePtr(destx + x4 * 4, desty + y4 * 4);
 
+			// Each pixel of the 2x2 block is doubled in both directions
 			for (int y2 = 0; y2 < 2; y2++) {
-				for (int x2 = 0; x2 < 2; x2++) {
-					uint32 *ptr = (uint32 *)_currBuf->getBasePtr(destx + x4 * 4 + x2 * 2, desty + y4 * 4 + y2 * 2);
-					uint32 pitch = _currBuf->pitch / 4;
+				for (int x2 = 0; x2 < 4; x2 += 2) {
 					uint32 color = *block2++;
-					ptr[0] = ptr[1] = ptr[pitch] = ptr[pitch + 1] = color;
+					ptr[x2] = ptr[x2 + 1] = ptr[pitch + x2] = ptr[pitch + x2 + 1] = color;
 				}
+				ptr += pitch * 2;
 			}
 		}
 	}
@@ -131,6 +131,7 @@ uint16 VDXPlayer::loadInternal() {
 bool VDXPlayer::playFrameInternal() {
 	byte currRes = 0x80;
 	Common::ReadStream *vdxData = 0;
+	_changedTiles.clear();
 	while (currRes == 0x80) {
 		currRes = _file->readByte();
 
@@ -191,7 +192,10 @@ bool VDXPlayer::playFrameInternal() {
 		//if (_flagSeven) {
 			//_vm->_graphicsMan->mergeFgAndBg();
 		//}
-		_vm->_graphicsMan->updateScreen(_bg);
+		// Only upload the tiles changed by the frame
+		for (uint i = 0; i < _changedTiles.size(); i++)
+			_vm->_graphicsMan->updateScreen(_bg, _changedTiles[i]);
+		_vm->_graphicsMan->change();
 	}
 
 	// Report the end of the video if we reached the end of the file or if we
@@ -494,6 +498,7 @@ void VDXPlayer::decodeBlockDelta(uint32 offset, byte *colors, uint16 imageWidth)
 	// Move the pointers to the beginning of the current block
 	int32 blockOff = _origX + _origY * imageWidth;
 	dest += blockOff;
+	addChangedTile(offset % imageWidth + _origX, offset / imageWidth + _origY);
 	byte *fgBuf = 0;
 	if (_flagSeven) {
 		fgBuf = (byte *)_fg->getPixels() + offset + blockOff;
@@ -526,6 +531,16 @@ void VDXPlayer::decodeBlockDelta(uint32 offset, byte *colors, uint16 imageWidth)
 	}
 }
 
+void VDXPlayer::addChangedTile(int16 x, int16 y) {
+	Common::Rect tile(x, y, x + TILE_SIZE, y + TILE_SIZE);
+
+	// Tiles are decoded line by line, so only the last rect can grow
+	if (!_changedTiles.empty() && _changedTiles.back().top == tile.top)
+		_changedTiles.back().extend(tile);
+	else
+		_changedTiles.push_back(tile);
+}
+
 void VDXPlayer::chunkSound(Common::ReadStream *in) {
 	if (getOverrideSpeed())
 		setOverrideSpeed(false);
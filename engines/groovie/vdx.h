@@ -25,6 +25,9 @@
 
 #include "groovie/player.h"
 
+#include "common/array.h"
+#include "common/rect.h"
+
 namespace Common {
 class ReadStream;
 }
@@ -68,6 +71,11 @@ private:
 	//bool _flagTransparent;
 	//bool _flagUpdateStill;
 
+	// Parts of the background changed by the current animation frame,
+	// one rect per line of tiles
+	Common::Array<Common::Rect> _changedTiles;
+	void addChangedTile(int16 x, int16 y);
+
 	void getStill(Common::ReadStream *in);
 	void getDelta(Common::ReadStream *in);
 	void expandColorMap(byte *out, uint16 colorMap, uint8 color1, uint8 color0);
@@ -35,6 +35,27 @@
 
 namespace Hopkins {
 
+/**
+ * Converts a line of 8-bit palette pixels into 16-bit screen pixels
+ */
+static inline void convert8BitLine(byte *destP, const byte *srcP, int width, const byte *palettePixels) {
+	for (int xp = 0; xp < width; ++xp, destP += 2)
+		WRITE_UINT16(destP, READ_UINT16(palettePixels + 2 * srcP[xp]));
+}
+
+/**
+ * Converts a line of 8-bit palette pixels into 16-bit screen pixels, scaled
+ * up twice in both directions
+ */
+static inline void convert8BitLineScaleX2(byte *destP, int destPitch, const byte *srcP, int width, const byte *palettePixels) {
+	for (int xp = 0; xp < width; ++xp, destP += 4) {
+		// Both halves are the same, so the byte order of the pair does not matter
+		uint32 pixelPair = READ_UINT16(palettePixels + 2 * srcP[xp]) * 0x10001;
+		WRITE_UINT32(destP, pixelPair);
+		WRITE_UINT32(destP + destPitch, pixelPair);
+	}
+}
+
 GraphicsManager::GraphicsManager(HopkinsEngine *vm) {
 	_vm = vm;
 
@@ -420,15 +441,8 @@ void GraphicsManager::display8BitRect(const byte *surface, int xs, int ys, int w
 
 	for (int yp = 0; yp < height; ++yp) {
 		// Copy over the line, using the source pixels as lookups into the pixels palette
-		const byte *lineSrcP = srcP;
-		byte *lineDestP = destP;
-
-		for (int xp = 0; xp < width; ++xp) {
-			lineDestP[0] = _palettePixels[lineSrcP[0] * 2];
-			lineDestP[1] = _palettePixels[(lineSrcP[0] * 2) + 1];
-			lineDestP += 2;
-			lineSrcP++;
-		}
+		convert8BitLine(destP, srcP, width, _palettePixels);
+
 		// Move to the start of the next line
 		srcP += _lineNbr2;
 		destP += _screenLineSize;
@@ -439,38 +453,15 @@ void GraphicsManager::display8BitRect(const byte *surface, int xs, int ys, int w
 }
 
 void GraphicsManager::displayScaled8BitRect(const byte *surface, int xp, int yp, int width, int height, int destX, int destY) {
-	const byte *palette;
-	byte *loopDestP;
-	const byte *loopSrcP;
-	int yCtr;
-
 	assert(_videoPtr);
 	const byte *srcP = surface + xp + 320 * yp;
-	byte *destP = (byte *)_videoPtr + 30 * _screenLineSize + destX + destX + destX + destX + _screenLineSize * 2 * destY;
-	int yCount = height;
-	int xCount = width;
+	byte *destP = (byte *)_videoPtr + 30 * _screenLineSize + destX * 4 + _screenLineSize * 2 * destY;
 
-	do {
-		yCtr = yCount;
-		int xCtr = xCount;
-		loopSrcP = srcP;
-		loopDestP = destP;
-		int savedXCount = xCount;
-		palette = _palettePixels;
-
-		do {
-			destP[0] = destP[2] = destP[_screenLineSize] = destP[_screenLineSize + 2] = palette[2 * srcP[0]];
-			destP[1] = destP[3] = destP[_screenLineSize + 1] = destP[_screenLineSize + 3] = palette[(2 * srcP[0]) + 1];
-			++srcP;
-			destP += 4;
-			--xCtr;
-		} while (xCtr);
-
-		xCount = savedXCount;
-		destP = loopDestP + _screenLineSize * 2;
-		srcP = loopSrcP + 320;
-		yCount = yCtr - 1;
-	} while (yCtr != 1);
+	for (int yCtr = 0; yCtr < height; ++yCtr) {
+		convert8BitLineScaleX2(destP, _screenLineSize, srcP, width, _palettePixels);
+		destP += _screenLineSize * 2;
+		srcP += 320;
+	}
 
 	addRefreshRect(destX, destY, destX + width, destY + width);
 }
@@ -771,9 +762,9 @@ void GraphicsManager::copyVideoVbe16(const byte *srcData) {
 				byte *destP = (byte *)_videoPtr + destOffset * 2;
 				destOffset += pixelCount;
 
+				uint16 pixel = READ_UINT16(_palettePixels + 2 * pixelIndex);
 				while (pixelCount--) {
-					destP[0] = _palettePixels[2 * pixelIndex];
-					destP[1] = _palettePixels[(2 * pixelIndex) + 1];
+					WRITE_UINT16(destP, pixel);
 					destP += 2;
 				}
 
@@ -784,9 +775,9 @@ void GraphicsManager::copyVideoVbe16(const byte *srcData) {
 				byte *destP = (byte *)_videoPtr + destOffset * 2;
 				destOffset += pixelCount;
 
+				uint16 pixel = READ_UINT16(_palettePixels + 2 * pixelIndex);
 				while (pixelCount--) {
-					destP[0] = _palettePixels[2 * pixelIndex];
-					destP[1] = _palettePixels[(2 * pixelIndex) + 1];
+					WRITE_UINT16(destP, pixel);
 					destP += 2;
 				}
 
@@ -794,8 +785,7 @@ void GraphicsManager::copyVideoVbe16(const byte *srcData) {
 			}
 		} else {
 			byte *destP = (byte *)_videoPtr + destOffset * 2;
-			destP[0] = _palettePixels[2 * srcByte];
-			destP[1] = _palettePixels[(2 * srcByte) + 1];
+			WRITE_UINT16(destP, READ_UINT16(_palettePixels + 2 * srcByte));
 			++srcP;
 			++destOffset;
 		}
@@ -1268,25 +1258,15 @@ void GraphicsManager::fastDisplay2(const byte *objectData, int xp, int yp, int i
  * Copy from surface to video buffer, scale 2x.
  */
 void GraphicsManager::copy16bFromSurfaceScaleX2(const byte *surface) {
-	byte *palPtr;
-	int curPixel;
-
 	lockScreen();
 
 	assert(_videoPtr);
 	const byte *curSurface = surface;
 	byte *destPtr = 30 * _screenLineSize + (byte *)_videoPtr;
 	for (int y = 200; y; y--) {
-		byte *oldDestPtr = destPtr;
-		for (int x = 320; x; x--) {
-			curPixel = 2 * *curSurface;
-			palPtr = _palettePixels + curPixel;
-			destPtr[0] = destPtr[2] = destPtr[_screenLineSize] = destPtr[_screenLineSize + 2] = palPtr[0];
-			destPtr[1] = destPtr[3] = destPtr[_screenLineSize + 1] = destPtr[_screenLineSize + 3] = palPtr[1];
-			++curSurface;
-			destPtr += 4;
-		}
-		destPtr = _screenLineSize * 2 + oldDestPtr;
+		convert8BitLineScaleX2(destPtr, _screenLineSize, curSurface, 320, _palettePixels);
+		curSurface += 320;
+		destPtr += _screenLineSize * 2;
 	}
 
 	unlockScreen();
@@ -50,6 +50,10 @@ KyraRpgEngine::KyraRpgEngine(OSystem *system, const GameFlags &flags) : KyraEngi
 	_blockBrightness = _wllVcnOffset = 0;
 	_blockDrawingBuffer = 0;
 	_sceneWindowBuffer = 0;
+	_sceneWindowBlocks = 0;
+	_sceneWindowColTable = 0;
+	_sceneWindowBrightness = 0;
+	_sceneWindowBufferValid = false;
 	_monsterShapes = _monsterPalettes = 0;
 
 	_doorShapes = 0;
@@ -134,6 +138,8 @@ KyraRpgEngine::~KyraRpgEngine() {
 	delete[] _vcnShift;
 	delete[] _blockDrawingBuffer;
 	delete[] _sceneWindowBuffer;
+	delete[] _sceneWindowBlocks;
+	delete[] _sceneWindowColTable;
 
 	delete[] _lvlShapeTop;
 	delete[] _lvlShapeBottom;
@@ -170,6 +176,8 @@ Common::Error KyraRpgEngine::init() {
 	memset(_blockDrawingBuffer, 0, 1320 * sizeof(uint16));
 	_sceneWindowBuffer = new uint8[21120];
 	memset(_sceneWindowBuffer, 0, 21120);
+	_sceneWindowBlocks = new uint16[660];
+	_sceneWindowColTable = new uint8[128];
 
 	_lvlShapeTop = new int16[18];
 	memset(_lvlShapeTop, 0, 18 * sizeof(int16));
@@ -229,6 +229,10 @@ protected:
 	uint8 *_vcnColTable;
 	uint16 *_blockDrawingBuffer;
 	uint8 *_sceneWindowBuffer;
+	uint16 *_sceneWindowBlocks;
+	uint8 *_sceneWindowColTable;
+	uint8 _sceneWindowBrightness;
+	bool _sceneWindowBufferValid;
 	uint8 _blockBrightness;
 	uint8 _wllVcnOffset;
 
@@ -295,6 +295,7 @@ void EoBCoreEngine::loadVcnData(const char *file, const uint8 *cgaMapping) {
 
 	delete[] _vcnBlocks;
 	_vcnBlocks = new uint8[vcnSize];
+	_sceneWindowBufferValid = false;
 
 	if (_configRenderMode == Common::kRenderCGA) {
 		uint8 *tmp = _screen->encodeShape(0, 0, 1, 8, false, cgaMapping);
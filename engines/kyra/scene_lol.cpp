@@ -348,6 +348,7 @@ void LoLEngine::loadLevelGraphics(const char *file, int specialColor, int weight
 
 	delete[] _vcnBlocks;
 	_vcnBlocks = new uint8[vcnLen];
+	_sceneWindowBufferValid = false;
 
 	if (!_flags.use16ColorMode) {
 		delete[] _vcnShift;
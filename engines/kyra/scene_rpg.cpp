@@ -346,6 +346,19 @@ bool KyraRpgEngine::checkSceneUpdateNeed(int block) {
 }
 
 void KyraRpgEngine::drawVcnBlocks() {
+	// The walls, floor and ceiling only need to be drawn again when the
+	// visible blocks or their colors have changed. Monsters and decorations
+	// are drawn on top of them afterwards.
+	if (_sceneWindowBufferValid && _sceneWindowBrightness == _blockBrightness && !memcmp(_sceneWindowBlocks, _blockDrawingBuffer, 660 * sizeof(uint16)) && !memcmp(_sceneWindowColTable, _vcnColTable, 128)) {
+		screen()->copyBlockToPage(_sceneDrawPage1, _sceneXoffset, 0, 176, 120, _sceneWindowBuffer);
+		return;
+	}
+
+	memcpy(_sceneWindowBlocks, _blockDrawingBuffer, 660 * sizeof(uint16));
+	memcpy(_sceneWindowColTable, _vcnColTable, 128);
+	_sceneWindowBrightness = _blockBrightness;
+	_sceneWindowBufferValid = true;
+
 	uint8 *d = _sceneWindowBuffer;
 	uint16 *bdb = _blockDrawingBuffer;
 
@@ -1460,17 +1460,6 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 		&Screen::drawShapeSkipScaleDownwind
 	};
 
-	static const DsLineFunc dsLineFunc[] = {
-		&Screen::drawShapeProcessLineNoScaleUpwind,
-		&Screen::drawShapeProcessLineNoScaleDownwind,
-		&Screen::drawShapeProcessLineNoScaleUpwind,
-		&Screen::drawShapeProcessLineNoScaleDownwind,
-		&Screen::drawShapeProcessLineScaleUpwind,
-		&Screen::drawShapeProcessLineScaleDownwind,
-		&Screen::drawShapeProcessLineScaleUpwind,
-		&Screen::drawShapeProcessLineScaleDownwind
-	};
-
 	static const DsPlotFunc dsPlotFunc[] = {
 		&Screen::drawShapePlotType0,		// used by Kyra 1 + 2
 		&Screen::drawShapePlotType1,		// used by Kyra 3
@@ -1510,7 +1499,6 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 	const int drawFunc = flags & 0x0F;
 	_dsProcessMargin = dsMarginFunc[drawFunc];
 	_dsScaleSkip = dsSkipFunc[drawFunc];
-	_dsProcessLine = dsLineFunc[drawFunc];
 
 	const int ppc = (flags >> 8) & 0x3F;
 	_dsPlot = dsPlotFunc[ppc];
@@ -1526,6 +1514,9 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 		return;
 	}
 
+	const DsLineFunc dsLine2 = getDrawShapeLineFunc(drawFunc, dsPlot2);
+	const DsLineFunc dsLine3 = getDrawShapeLineFunc(drawFunc, dsPlot3);
+
 	int curY = y;
 	const uint8 *src = shapeData;
 	uint8 *dst = _dsDstPage = getPagePtr(pageNum);
@@ -1705,7 +1696,7 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 					if (flags & 0x800)
 						normalPlot = (curY > _maskMinY && curY < _maskMaxY);
 					_dsPlot = normalPlot ? dsPlot2 : dsPlot3;
-					(this->*_dsProcessLine)(d, src, cnt, scaleState);
+					(this->*(normalPlot ? dsLine2 : dsLine3))(d, src, cnt, scaleState);
 				}
 				cnt += _dsOffscreenRight;
 				if (cnt)
@@ -1833,12 +1824,13 @@ int Screen::drawShapeSkipScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt)
 	return found ? 0 : _dsOffscreenScaleVal1;
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineNoScaleUpwind(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
 	do {
 		uint8 c = *src++;
 		if (c) {
 			uint8 *d = dst++;
-			(this->*_dsPlot)(d, c);
+			(this->*plot)(d, c);
 			cnt--;
 		} else {
 			c = *src++;
@@ -1848,12 +1840,13 @@ void Screen::drawShapeProcessLineNoScaleUpwind(uint8 *&dst, const uint8 *&src, i
 	} while (cnt > 0);
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineNoScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
 	do {
 		uint8 c = *src++;
 		if (c) {
 			uint8 *d = dst--;
-			(this->*_dsPlot)(d, c);
+			(this->*plot)(d, c);
 			cnt--;
 		} else {
 			c = *src++;
@@ -1863,6 +1856,7 @@ void Screen::drawShapeProcessLineNoScaleDownwind(uint8 *&dst, const uint8 *&src,
 	} while (cnt > 0);
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState) {
 	int c = 0;
 
@@ -1882,7 +1876,7 @@ void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int
 				scaleState = r & 0xFF;
 			}
 		} else if (scaleState) {
-			(this->*_dsPlot)(dst++, c);
+			(this->*plot)(dst++, c);
 			scaleState -= 0x100;
 			cnt--;
 		}
@@ -1891,6 +1885,7 @@ void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int
 	cnt = -1;
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState) {
 	int c = 0;
 
@@ -1910,7 +1905,7 @@ void Screen::drawShapeProcessLineScaleDownwind(uint8 *&dst, const uint8 *&src, i
 				scaleState = r & 0xFF;
 			}
 		} else {
-			(this->*_dsPlot)(dst--, c);
+			(this->*plot)(dst--, c);
 			scaleState -= 0x100;
 			cnt--;
 		}
@@ -1919,6 +1914,39 @@ void Screen::drawShapeProcessLineScaleDownwind(uint8 *&dst, const uint8 *&src, i
 	cnt = -1;
 }
 
+Screen::DsLineFunc Screen::getDrawShapeLineFunc(int drawFunc, DsPlotFunc plot) {
+#define DS_LINE_FUNCS(plotFunc) { \
+		&Screen::drawShapeProcessLineNoScaleUpwind<plotFunc>, \
+		&Screen::drawShapeProcessLineNoScaleDownwind<plotFunc>, \
+		&Screen::drawShapeProcessLineNoScaleUpwind<plotFunc>, \
+		&Screen::drawShapeProcessLineNoScaleDownwind<plotFunc>, \
+		&Screen::drawShapeProcessLineScaleUpwind<plotFunc>, \
+		&Screen::drawShapeProcessLineScaleDownwind<plotFunc>, \
+		&Screen::drawShapeProcessLineScaleUpwind<plotFunc>, \
+		&Screen::drawShapeProcessLineScaleDownwind<plotFunc> \
+	}
+
+	static const DsLineFunc dsLineFuncType0[] = DS_LINE_FUNCS(&Screen::drawShapePlotType0);
+	static const DsLineFunc dsLineFuncType4[] = DS_LINE_FUNCS(&Screen::drawShapePlotType4);
+	static const DsLineFunc dsLineFuncType37[] = DS_LINE_FUNCS(&Screen::drawShapePlotType37);
+	static const DsLineFunc dsLineFuncIndirect[] = DS_LINE_FUNCS(&Screen::drawShapePlotIndirect);
+
+#undef DS_LINE_FUNCS
+
+	// The other plotting methods are rarely used, so they are called through _dsPlot
+	if (plot == &Screen::drawShapePlotType0)
+		return dsLineFuncType0[drawFunc];
+	else if (plot == &Screen::drawShapePlotType4)
+		return dsLineFuncType4[drawFunc];
+	else if (plot == &Screen::drawShapePlotType37)
+		return dsLineFuncType37[drawFunc];
+	return dsLineFuncIndirect[drawFunc];
+}
+
+void Screen::drawShapePlotIndirect(uint8 *dst, uint8 cmd) {
+	(this->*_dsPlot)(dst, cmd);
+}
+
 void Screen::drawShapePlotType0(uint8 *dst, uint8 cmd) {
 	*dst = cmd;
 }
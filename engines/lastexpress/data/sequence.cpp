@@ -78,8 +78,12 @@ void FrameInfo::read(Common::SeekableReadStream *in, bool isSequence) {
 
 AnimFrame::AnimFrame(Common::SeekableReadStream *in, const FrameInfo &f, bool /* ignoreSubtype */) : _palette(NULL) {
 	_palSize = 1;
-	// TODO: use just the needed rectangle
+	_imageOffset = 0;
+
+	// Frames are decoded onto a full screen, as some of them refer back to
+	// earlier pixels. Only the rows they cover are kept afterwards.
 	_image.create(640, 480, Graphics::PixelFormat::createFormatCLUT8());
+	uint32 end = 0;
 
 	//debugC(6, kLastExpressDebugGraphics, "    Offsets: data=%d, unknown=%d, palette=%d", f.dataOffset, f.unknown, f.paletteOffset);
 	//debugC(6, kLastExpressDebugGraphics, "    Position: (%d, %d) - (%d, %d)", f.xPos1, f.yPos1, f.xPos2, f.yPos2);
@@ -99,24 +103,25 @@ AnimFrame::AnimFrame(Common::SeekableReadStream *in, const FrameInfo &f, bool /*
 		// Empty frame
 		break;
 	case 3:
-		decomp3(in, f);
+		end = decomp3(in, f);
 		break;
 	case 4:
-		decomp4(in, f);
+		end = decomp4(in, f);
 		break;
 	case 5:
-		decomp5(in, f);
+		end = decomp5(in, f);
 		break;
 	case 7:
-		decomp7(in, f);
+		end = decomp7(in, f);
 		break;
 	case 255:
-		decompFF(in, f);
+		end = decompFF(in, f);
 		break;
 	default:
 		error("[AnimFrame::AnimFrame] Unknown frame compression: %d", f.compressionType);
 	}
 
+	cropImage(f.initialSkip / 2, end);
 	readPalette(in, f);
 	_rect = Common::Rect((int16)f.xPos1, (int16)f.yPos1, (int16)f.xPos2, (int16)f.yPos2);
 	//_rect.debugPrint(0, "Frame rect:");
@@ -129,14 +134,35 @@ AnimFrame::~AnimFrame() {
 
 Common::Rect AnimFrame::draw(Graphics::Surface *s) {
 	byte *inp = (byte *)_image.getPixels();
-	uint16 *outp = (uint16 *)s->getPixels();
-	for (int i = 0; i < 640 * 480; i++, inp++, outp++) {
+	uint16 *outp = (uint16 *)s->getPixels() + _imageOffset;
+	for (int i = 0; i < _image.w * _image.h; i++, inp++, outp++) {
 		if (*inp)
 			*outp = _palette[*inp];
 	}
 	return _rect;
 }
 
+uint32 AnimFrame::getMemorySize() const {
+	return _image.w * _image.h + _palSize * sizeof(uint16);
+}
+
+void AnimFrame::cropImage(uint32 start, uint32 end) {
+	// Keep the rows between the first and the last decoded pixel
+	uint32 firstRow = MIN<uint32>(start / 640, 480);
+	uint32 lastRow = MIN<uint32>((end + 639) / 640, 480);
+	if (end <= start)
+		firstRow = lastRow = 0;
+
+	Graphics::Surface image;
+	image.create(640, lastRow - firstRow, Graphics::PixelFormat::createFormatCLUT8());
+	if (image.h)
+		memcpy(image.getPixels(), _image.getBasePtr(0, firstRow), image.w * image.h);
+
+	_image.free();
+	_image = image;
+	_imageOffset = firstRow * 640;
+}
+
 void AnimFrame::readPalette(Common::SeekableReadStream *in, const FrameInfo &f) {
 	// Read the palette
 	in->seek((int)f.paletteOffset);
@@ -146,15 +172,15 @@ void AnimFrame::readPalette(Common::SeekableReadStream *in, const FrameInfo &f)
 	}
 }
 
-void AnimFrame::decomp3(Common::SeekableReadStream *in, const FrameInfo &f) {
-	decomp34(in, f, 0x7, 3);
+uint32 AnimFrame::decomp3(Common::SeekableReadStream *in, const FrameInfo &f) {
+	return decomp34(in, f, 0x7, 3);
 }
 
-void AnimFrame::decomp4(Common::SeekableReadStream *in, const FrameInfo &f) {
-	decomp34(in, f, 0xf, 4);
+uint32 AnimFrame::decomp4(Common::SeekableReadStream *in, const FrameInfo &f) {
+	return decomp34(in, f, 0xf, 4);
 }
 
-void AnimFrame::decomp34(Common::SeekableReadStream *in, const FrameInfo &f, byte mask, byte shift) {
+uint32 AnimFrame::decomp34(Common::SeekableReadStream *in, const FrameInfo &f, byte mask, byte shift) {
 	byte *p = (byte *)_image.getPixels();
 
 	uint32 skip = f.initialSkip / 2;
@@ -167,7 +193,8 @@ void AnimFrame::decomp34(Common::SeekableReadStream *in, const FrameInfo &f, byt
 	uint32 numBlanks = 640 - (f.xPos2 - f.xPos1);
 
 	in->seek((int)f.dataOffset);
-	for (uint32 out = skip; out < size; ) {
+	uint32 out = skip;
+	while (out < size) {
 		uint16 opcode = in->readByte();
 
 		if (opcode & 0x80) {
@@ -197,9 +224,11 @@ void AnimFrame::decomp34(Common::SeekableReadStream *in, const FrameInfo &f, byt
 			}
 		}
 	}
+
+	return out;
 }
 
-void AnimFrame::decomp5(Common::SeekableReadStream *in, const FrameInfo &f) {
+uint32 AnimFrame::decomp5(Common::SeekableReadStream *in, const FrameInfo &f) {
 	byte *p = (byte *)_image.getPixels();
 
 	uint32 skip = f.initialSkip / 2;
@@ -210,7 +239,8 @@ void AnimFrame::decomp5(Common::SeekableReadStream *in, const FrameInfo &f) {
 	//assert (f.yPos2 == size / 640);
 
 	in->seek((int)f.dataOffset);
-	for (uint32 out = skip; out < size; ) {
+	uint32 out = skip;
+	while (out < size) {
 		uint16 opcode = in->readByte();
 		if (!(opcode & 0x1f)) {
 			opcode = (uint16)((opcode << 3) + in->readByte());
@@ -232,9 +262,11 @@ void AnimFrame::decomp5(Common::SeekableReadStream *in, const FrameInfo &f) {
 			}
 		}
 	}
+
+	return out;
 }
 
-void AnimFrame::decomp7(Common::SeekableReadStream *in, const FrameInfo &f) {
+uint32 AnimFrame::decomp7(Common::SeekableReadStream *in, const FrameInfo &f) {
 	byte *p = (byte *)_image.getPixels();
 
 	uint32 skip = f.initialSkip / 2;
@@ -247,7 +279,8 @@ void AnimFrame::decomp7(Common::SeekableReadStream *in, const FrameInfo &f) {
 	uint32 numBlanks = 640 - (f.xPos2 - f.xPos1);
 
 	in->seek((int)f.dataOffset);
-	for (uint32 out = skip; out < size; ) {
+	uint32 out = skip;
+	while (out < size) {
 		uint16 opcode = in->readByte();
 		if (opcode & 0x80) {
 			if (opcode & 0x40) {
@@ -285,16 +318,19 @@ void AnimFrame::decomp7(Common::SeekableReadStream *in, const FrameInfo &f) {
 			out++;
 		}
 	}
+
+	return out;
 }
 
-void AnimFrame::decompFF(Common::SeekableReadStream *in, const FrameInfo &f) {
+uint32 AnimFrame::decompFF(Common::SeekableReadStream *in, const FrameInfo &f) {
 	byte *p = (byte *)_image.getPixels();
 
 	uint32 skip = f.initialSkip / 2;
 	uint32 size = f.decompressedEndOffset / 2;
 
 	in->seek((int)f.dataOffset);
-	for (uint32 out = skip; out < size; ) {
+	uint32 out = skip;
+	while (out < size) {
 		uint16 opcode = in->readByte();
 
 		if (opcode < 0x80) {
@@ -326,6 +362,8 @@ void AnimFrame::decompFF(Common::SeekableReadStream *in, const FrameInfo &f) {
 			}
 		}
 	}
+
+	return out;
 }
 
 
@@ -338,6 +376,7 @@ Sequence::~Sequence() {
 }
 
 void Sequence::reset() {
+	clearCache();
 	_frames.clear();
 	delete _stream;
 	_stream = NULL;
@@ -420,6 +459,46 @@ AnimFrame *Sequence::getFrame(uint16 index) {
 	return new AnimFrame(_stream, *frame);
 }
 
+AnimFrame *Sequence::getCachedFrame(uint16 index) {
+	for (Common::List<CachedFrame>::iterator i = _cache.begin(); i != _cache.end(); ++i) {
+		if (i->index != index)
+			continue;
+
+		CachedFrame entry = *i;
+		_cache.erase(i);
+		_cache.push_front(entry);
+		return entry.frame;
+	}
+
+	AnimFrame *frame = getFrame(index);
+	if (!frame)
+		return NULL;
+
+	// Drop the least recently used frames, but keep the one being drawn
+	uint32 size = frame->getMemorySize();
+	while (!_cache.empty() && _cacheSize + size > _maxCacheSize) {
+		_cacheSize -= _cache.back().frame->getMemorySize();
+		delete _cache.back().frame;
+		_cache.pop_back();
+	}
+
+	CachedFrame entry;
+	entry.index = index;
+	entry.frame = frame;
+	_cache.push_front(entry);
+	_cacheSize += size;
+
+	return frame;
+}
+
+void Sequence::clearCache() {
+	for (Common::List<CachedFrame>::iterator i = _cache.begin(); i != _cache.end(); ++i)
+		delete i->frame;
+
+	_cache.clear();
+	_cacheSize = 0;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // SequenceFrame
 SequenceFrame::~SequenceFrame() {
@@ -434,15 +513,11 @@ Common::Rect SequenceFrame::draw(Graphics::Surface *surface) {
 	if (!_sequence || _frame >= _sequence->count())
 		return Common::Rect();
 
-	AnimFrame *f = _sequence->getFrame(_frame);
+	AnimFrame *f = _sequence->getCachedFrame(_frame);
 	if (!f)
 		return Common::Rect();
 
-	Common::Rect rect = f->draw(surface);
-
-	delete f;
-
-	return rect;
+	return f->draw(surface);
 }
 
 bool SequenceFrame::setFrame(uint16 frame) {
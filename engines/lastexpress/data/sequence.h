@@ -75,6 +75,7 @@
 #include "lastexpress/shared.h"
 
 #include "common/array.h"
+#include "common/list.h"
 #include "common/rect.h"
 #include "common/str.h"
 
@@ -134,16 +135,22 @@ public:
 	~AnimFrame();
 	Common::Rect draw(Graphics::Surface *s);
 
+	/** Size of the decoded frame in memory. */
+	uint32 getMemorySize() const;
+
 private:
-	void decomp3(Common::SeekableReadStream *in, const FrameInfo &f);
-	void decomp4(Common::SeekableReadStream *in, const FrameInfo &f);
-	void decomp34(Common::SeekableReadStream *in, const FrameInfo &f, byte mask, byte shift);
-	void decomp5(Common::SeekableReadStream *in, const FrameInfo &f);
-	void decomp7(Common::SeekableReadStream *in, const FrameInfo &f);
-	void decompFF(Common::SeekableReadStream *in, const FrameInfo &f);
+	// The decompression functions return the offset past the last decoded pixel
+	uint32 decomp3(Common::SeekableReadStream *in, const FrameInfo &f);
+	uint32 decomp4(Common::SeekableReadStream *in, const FrameInfo &f);
+	uint32 decomp34(Common::SeekableReadStream *in, const FrameInfo &f, byte mask, byte shift);
+	uint32 decomp5(Common::SeekableReadStream *in, const FrameInfo &f);
+	uint32 decomp7(Common::SeekableReadStream *in, const FrameInfo &f);
+	uint32 decompFF(Common::SeekableReadStream *in, const FrameInfo &f);
 	void readPalette(Common::SeekableReadStream *in, const FrameInfo &f);
+	void cropImage(uint32 start, uint32 end);
 
-	Graphics::Surface _image;
+	Graphics::Surface _image;     ///< The decoded rows of the frame
+	uint32 _imageOffset;          ///< On-screen offset of the first decoded row
 	uint16 _palSize;
 	uint16 *_palette;
 	Common::Rect _rect;
@@ -151,7 +158,7 @@ private:
 
 class Sequence {
 public:
-	Sequence(Common::String name) : _stream(NULL), _isLoaded(false), _name(name), _field30(15) {}
+	Sequence(Common::String name) : _stream(NULL), _isLoaded(false), _name(name), _field30(15), _cacheSize(0) {}
 	~Sequence();
 
 	static Sequence *load(Common::String name, Common::SeekableReadStream *stream = NULL, byte field30 = 15);
@@ -162,6 +169,12 @@ public:
 	AnimFrame *getFrame(uint16 index = 0);
 	FrameInfo *getFrameInfo(uint16 index = 0);
 
+	/**
+	 * Get a decoded frame, keeping it for the next time it is drawn.
+	 * The frame belongs to the sequence and must not be deleted.
+	 */
+	AnimFrame *getCachedFrame(uint16 index);
+
 	Common::String getName() { return _name; }
 	byte getField30() { return _field30; }
 
@@ -170,8 +183,15 @@ public:
 private:
 	static const uint32 _sequenceHeaderSize = 8;
 	static const uint32 _sequenceFrameSize = 68;
+	static const uint32 _maxCacheSize = 1024 * 1024;
+
+	struct CachedFrame {
+		uint16 index;
+		AnimFrame *frame;
+	};
 
 	void reset();
+	void clearCache();
 
 	Common::Array<FrameInfo> _frames;
 	Common::SeekableReadStream *_stream;
@@ -179,6 +199,9 @@ private:
 
 	Common::String _name;
 	byte _field30; // used when copying sequences
+
+	Common::List<CachedFrame> _cache; ///< Decoded frames, most recently used first
+	uint32 _cacheSize;
 };
 
 class SequenceFrame : public Drawable {
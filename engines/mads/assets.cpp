@@ -54,6 +54,7 @@ SpriteAsset::~SpriteAsset() {
 	for (uint i = 0; i < _frames.size(); ++i)
 		delete _frames[i]._frame;
 
+	delete[] _frameData;
 	delete _charInfo;
 }
 
@@ -61,6 +62,8 @@ void SpriteAsset::load(Common::SeekableReadStream *stream, int flags) {
 	int curFrame = 0;
 	uint32 frameOffset = 0;
 	MadsPack sprite(stream);
+	_frameData = nullptr;
+	_frameDataSize = 0;
 	_frameRate = 0;
 	_pixelSpeed = 0;
 	_maxWidth = 0;
@@ -136,16 +139,15 @@ void SpriteAsset::load(Common::SeekableReadStream *stream, int flags) {
 	}
 
 	spriteStream = sprite.getItemStream(1);
-	Common::SeekableReadStream *spriteDataStream = sprite.getItemStream(3);
 	SpriteAssetFrame frame;
-	Common::Array<int> frameSizes;
 	for (curFrame = 0; curFrame < _frameCount; curFrame++) {
 		frame._stream = 0;
 		frame._comp = 0;
+		frame._frame = nullptr;
 		frameOffset = spriteStream->readUint32LE();
 		_frameOffsets.push_back(frameOffset);
 		uint32 frameSize = spriteStream->readUint32LE();
-		frameSizes.push_back(frameSize);
+		_frameSizes.push_back(frameSize);
 
 		frame._bounds.left = spriteStream->readSint16LE();
 		frame._bounds.top  = spriteStream->readSint16LE();
@@ -157,53 +159,65 @@ void SpriteAsset::load(Common::SeekableReadStream *stream, int flags) {
 			_frameCount, frame._bounds.left, frame._bounds.top,
 			frame._bounds.width(), frame._bounds.height());
 
-		if (_mode == 0) {
-			// Create a frame and decompress the raw pixel data
-			uint32 currPos = (uint32)spriteDataStream->pos();
-			frame._frame = new MSprite(spriteDataStream, palette, frame._bounds);
-			assert((uint32)spriteDataStream->pos() == (currPos + frameSize));
-		}
-
 		_frames.push_back(frame);
 	}
 
-	if (_mode != 0) {
+	delete spriteStream;
+
+	// Keep the pixel data, so that frames can be decoded when they are first
+	// used. Scenes load many sprite sets of which only a few frames are shown.
+	Common::SeekableReadStream *spriteDataStream = sprite.getItemStream(3);
+	_frameDataSize = spriteDataStream->size();
+	_frameData = new byte[_frameDataSize];
+	spriteDataStream->read(_frameData, _frameDataSize);
+	delete spriteDataStream;
+
+	_framePalette = palette;
+}
+
+void SpriteAsset::decodeFrame(int frameIndex) {
+	SpriteAssetFrame &frame = _frames[frameIndex];
+
+	if (_mode == 0) {
+		// The raw pixel data of the frames follow each other
+		uint32 offset = 0;
+		for (int i = 0; i < frameIndex; ++i)
+			offset += _frameSizes[i];
+
+		Common::MemoryReadStream rs(_frameData, _frameDataSize);
+		rs.seek(offset);
+		frame._frame = new MSprite(&rs, _framePalette, frame._bounds);
+		assert((uint32)rs.pos() == offset + _frameSizes[frameIndex]);
+	} else {
 		// Handle decompressing Fab encoded data
-		for (curFrame = 0; curFrame < _frameCount; curFrame++) {
-			FabDecompressor fab;
+		FabDecompressor fab;
 
-			int srcSize = (curFrame == (_frameCount - 1)) ? spriteDataStream->size() - _frameOffsets[curFrame] :
-				_frameOffsets[curFrame + 1] - _frameOffsets[curFrame];
-			byte *srcData = new byte[srcSize];
-			assert(srcData);
-			spriteDataStream->read(srcData, srcSize);
+		uint32 offset = _frameOffsets[frameIndex] - _frameOffsets[0];
+		int srcSize = (frameIndex == (_frameCount - 1)) ? _frameDataSize - offset :
+			_frameOffsets[frameIndex + 1] - _frameOffsets[frameIndex];
 
-			byte *destData = new byte[frameSizes[curFrame]];
-			assert(destData);
+		byte *destData = new byte[_frameSizes[frameIndex]];
+		assert(destData);
 
-			fab.decompress(srcData, srcSize, destData, frameSizes[curFrame]);
+		fab.decompress(_frameData + offset, srcSize, destData, _frameSizes[frameIndex]);
 
-			// Load the frames
-			Common::MemoryReadStream *rs = new Common::MemoryReadStream(destData, frameSizes[curFrame]);
-			_frames[curFrame]._frame = new MSprite(rs, palette, _frames[curFrame]._bounds);
-			delete rs;
+		Common::MemoryReadStream rs(destData, _frameSizes[frameIndex]);
+		frame._frame = new MSprite(&rs, _framePalette, frame._bounds);
 
-			delete[] srcData;
-			delete[] destData;
-		}
+		delete[] destData;
 	}
-
-	delete spriteStream;
-	delete spriteDataStream;
 }
 
 MSprite *SpriteAsset::getFrame(int frameIndex) {
-	if ((uint)frameIndex < _frames.size()) {
-		return _frames[frameIndex]._frame;
-	} else {
+	if ((uint)frameIndex >= _frames.size()) {
 		debugC(kDebugGraphics, "SpriteAsset::getFrame: Invalid frame %d, out of %d", frameIndex, _frames.size());
-		return _frames[_frames.size() - 1]._frame;
+		frameIndex = _frames.size() - 1;
 	}
+
+	if (!_frames[frameIndex]._frame)
+		decodeFrame(frameIndex);
+
+	return _frames[frameIndex]._frame;
 }
 
 /*------------------------------------------------------------------------*/
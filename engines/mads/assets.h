@@ -73,10 +73,21 @@ private:
 	uint8 _mode;
 	bool _isBackground;
 
+	// Frames are only decoded when they are first used
+	Common::Array<RGB6> _framePalette;
+	Common::Array<uint32> _frameSizes;
+	byte *_frameData;
+	uint32 _frameDataSize;
+
 	/**
 	 * Load the data for the asset
 	 */
 	void load(Common::SeekableReadStream *stream, int flags);
+
+	/**
+	 * Decode the pixels of a frame
+	 */
+	void decodeFrame(int frameIndex);
 public:
 	SpriteSetCharInfo *_charInfo;
 	int _usageIndex;
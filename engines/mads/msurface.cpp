@@ -359,6 +359,25 @@ void BaseSurface::copyFrom(BaseSurface &src, const Common::Point &destPos, int d
 		if (flipped)
 			srcPtr += copyRect.width() - 1;
 
+		if (depthSurface == nullptr) {
+			// Without a depth surface every pixel has a depth of 15
+			if (depth > 15)
+				return;
+
+			for (int rowCtr = 0; rowCtr < copyRect.height(); ++rowCtr) {
+				const byte *srcP = srcPtr;
+				for (int xCtr = 0; xCtr < copyRect.width(); ++xCtr, srcP += direction) {
+					if (*srcP != transparentColor)
+						destPtr[xCtr] = *srcP;
+				}
+
+				srcPtr += src.w;
+				destPtr += this->w;
+			}
+
+			return;
+		}
+
 		// 100% scaling variation
 		for (int rowCtr = 0; rowCtr < copyRect.height(); ++rowCtr) {
 			// Copy each byte one at a time checking against the depth
@@ -347,6 +347,7 @@ void MohawkEngine_Riven::changeToStack(uint16 stackId) {
 
 	// Clear the graphics cache; images aren't used across stack boundaries
 	_gfx->clearCache();
+	_gfx->clearPrefetchedImages();
 
 	// Clear the old stack files out
 	for (uint32 i = 0; i < _mhk.size(); i++)
@@ -526,6 +527,9 @@ void MohawkEngine_Riven::changeToCard(uint16 dest) {
 	_card = new RivenCard(this, dest);
 	_card->enter(true);
 
+	// Get the next cards ready while the player looks at this one
+	_card->prefetchDestinationPictures();
+
 	// Now we need to redraw the cursor if necessary and handle mouse over scripts
 	_stack->queueMouseCursorRefresh();
 
@@ -483,6 +483,40 @@ void RivenCard::drawPicture(uint16 index, bool queue) {
 	}
 }
 
+void RivenCard::prefetchDestinationPictures() {
+	Common::Array<uint16> cards;
+	for (uint i = 0; i < _hotspots.size(); i++) {
+		_hotspots[i]->getDestinationCards(cards);
+	}
+
+	// The first picture list is the one drawn when entering a card,
+	// unless its load script activates another one
+	Common::Array<uint16> images;
+	for (uint i = 0; i < cards.size(); i++) {
+		if (cards[i] == _id || !_vm->hasResource(ID_PLST, cards[i]))
+			continue;
+
+		Common::SeekableReadStream *plst = _vm->getResource(ID_PLST, cards[i]);
+		uint16 recordCount = plst->readUint16BE();
+
+		for (uint16 j = 0; j < recordCount; j++) {
+			uint16 index = plst->readUint16BE();
+			uint16 imageId = plst->readUint16BE();
+			plst->skip(8); // Rect
+
+			if (index == 1) {
+				if (Common::find(images.begin(), images.end(), imageId) == images.end())
+					images.push_back(imageId);
+				break;
+			}
+		}
+
+		delete plst;
+	}
+
+	_vm->_gfx->prefetchImages(images);
+}
+
 RivenCard::Picture RivenCard::getPicture(uint16 index) const {
 	for (uint16 i = 0; i < _pictureList.size(); i++) {
 		if (_pictureList[i].index == index) {
@@ -1046,6 +1080,11 @@ RivenScriptPtr RivenHotspot::getScript(uint16 scriptType) const {
 	return RivenScriptPtr();
 }
 
+void RivenHotspot::getDestinationCards(Common::Array<uint16> &cards) const {
+	for (uint16 i = 0; i < _scripts.size(); i++)
+		_scripts[i].script->getDestinationCards(cards);
+}
+
 void RivenHotspot::applyPropertiesPatches(uint32 cardGlobalId) {
 	// In Jungle island, one of the bridge hotspots does not have a name
 	// This breaks keyboard navigation. Set the proper name.
@@ -140,6 +140,9 @@ public:
 	/** Frame update handler for mouse dragging */
 	RivenScriptPtr onMouseDragUpdate();
 
+	/** Start decoding the first picture of the cards the hotspots switch to */
+	void prefetchDestinationPictures();
+
 	/** Write all of the card's data to standard output */
 	void dump() const;
 
@@ -264,6 +267,9 @@ public:
 	/** Write all of the hotspot's data to standard output */
 	void dump() const;
 
+	/** Append the ids of the cards the hotspot's scripts may switch to */
+	void getDestinationCards(Common::Array<uint16> &cards) const;
+
 	/** Apply patches to the hotspot's scripts to fix bugs in the original game scripts */
 	void applyScriptPatches(uint32 cardGlobalId);
 
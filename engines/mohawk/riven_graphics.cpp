@@ -340,16 +340,77 @@ RivenGraphics::~RivenGraphics() {
 	_mainScreen->free();
 	delete _mainScreen;
 	delete _bitmapDecoder;
+	clearPrefetchedImages();
 	clearFliesEffect();
 	clearWaterEffect();
 }
 
 MohawkSurface *RivenGraphics::decodeImage(uint16 id) {
-	MohawkSurface *surface = _bitmapDecoder->decodeImage(_vm->getResource(ID_TBMP, id));
+	MohawkSurface *surface = nullptr;
+
+	PrefetchedImageMap::iterator it = _prefetchedImages.find(id);
+	if (it != _prefetchedImages.end()) {
+		JobMan.wait(it->_value->counter);
+		surface = it->_value->surface;
+		it->_value->surface = nullptr;
+		removePrefetchedImage(it);
+	}
+
+	if (!surface)
+		surface = _bitmapDecoder->decodeImage(_vm->getResource(ID_TBMP, id));
+
 	surface->convertToTrueColor();
 	return surface;
 }
 
+void RivenGraphics::prefetchImages(const Common::Array<uint16> &images) {
+	for (PrefetchedImageMap::iterator it = _prefetchedImages.begin(); it != _prefetchedImages.end(); ) {
+		PrefetchedImageMap::iterator cur = it++;
+		if (Common::find(images.begin(), images.end(), cur->_key) == images.end())
+			removePrefetchedImage(cur);
+	}
+
+	for (uint i = 0; i < images.size() && _prefetchedImages.size() < kMaxPrefetchedImages; i++) {
+		if (_prefetchedImages.contains(images[i]) || !_vm->hasResource(ID_TBMP, images[i]))
+			continue;
+
+		// The archive stream is shared, so the data is read here rather than in the job
+		Common::SeekableReadStream *resource = _vm->getResource(ID_TBMP, images[i]);
+
+		PrefetchedImage *image = new PrefetchedImage();
+		image->stream = resource->readStream(resource->size());
+		image->surface = nullptr;
+		delete resource;
+
+		_prefetchedImages[images[i]] = image;
+		JobMan.submit(decodePrefetchedImageProc, image, image->counter);
+	}
+}
+
+void RivenGraphics::decodePrefetchedImageProc(void *param) {
+	PrefetchedImage *image = (PrefetchedImage *)param;
+
+	// The decoder keeps state while decoding, so each job uses its own
+	MohawkBitmap decoder;
+	image->surface = decoder.decodeImage(image->stream);
+	image->stream = nullptr;
+}
+
+void RivenGraphics::removePrefetchedImage(PrefetchedImageMap::iterator it) {
+	PrefetchedImage *image = it->_value;
+	JobMan.wait(image->counter);
+
+	delete image->stream;
+	delete image->surface;
+	delete image;
+	_prefetchedImages.erase(it);
+}
+
+void RivenGraphics::clearPrefetchedImages() {
+	while (!_prefetchedImages.empty())
+		removePrefetchedImage(_prefetchedImages.begin());
+}
+
 void RivenGraphics::copyImageToScreen(uint16 image, uint32 left, uint32 top, uint32 right, uint32 bottom) {
 	Graphics::Surface *surface = findImage(image)->getSurface();
 
@@ -25,6 +25,9 @@
 
 #include "mohawk/graphics.h"
 
+#include "common/hashmap.h"
+#include "common/jobs.h"
+
 namespace Mohawk {
 
 class MohawkEngine_Riven;
@@ -96,6 +99,15 @@ public:
 	void updateCredits();
 	uint getCurCreditsImage() const { return _creditsImage; }
 
+	// Prefetching
+	/**
+	 * Start decoding images in the background, so they are ready once a card
+	 * using them is entered. Previously prefetched images not in the list are
+	 * dropped.
+	 */
+	void prefetchImages(const Common::Array<uint16> &images);
+	void clearPrefetchedImages();
+
 protected:
 	MohawkSurface *decodeImage(uint16 id) override;
 	MohawkEngine *getVM() override { return (MohawkEngine *)_vm; }
@@ -130,6 +142,23 @@ private:
 
 	// Credits
 	uint _creditsImage, _creditsPos;
+
+	// Prefetching
+	enum {
+		kMaxPrefetchedImages = 8
+	};
+
+	struct PrefetchedImage {
+		Common::SeekableReadStream *stream;
+		MohawkSurface *surface;
+		Common::JobSystem::Counter counter;
+	};
+
+	typedef Common::HashMap<uint16, PrefetchedImage *> PrefetchedImageMap;
+	PrefetchedImageMap _prefetchedImages;
+
+	static void decodePrefetchedImageProc(void *param);
+	void removePrefetchedImage(PrefetchedImageMap::iterator it);
 };
 
 /**
@@ -240,6 +240,12 @@ RivenScript &RivenScript::operator+=(const RivenScript &other) {
 	return *this;
 }
 
+void RivenScript::getDestinationCards(Common::Array<uint16> &cards) const {
+	for (uint i = 0; i < _commands.size(); i++) {
+		_commands[i]->getDestinationCards(cards);
+	}
+}
+
 const char *RivenScript::getTypeName(uint16 type) {
 	static const char *names[] = {
 		"MouseDown",
@@ -816,6 +822,11 @@ RivenCommandType RivenSimpleCommand::getType() const {
 	return _type;
 }
 
+void RivenSimpleCommand::getDestinationCards(Common::Array<uint16> &cards) const {
+	if (_type == kRivenCommandChangeCard && !_arguments.empty())
+		cards.push_back(_arguments[0]);
+}
+
 RivenSwitchCommand::RivenSwitchCommand(MohawkEngine_Riven *vm) :
 		RivenCommand(vm),
 		_variableId(0) {
@@ -903,6 +914,12 @@ void RivenSwitchCommand::applyCardPatches(uint32 globalId, int scriptType, uint1
 	}
 }
 
+void RivenSwitchCommand::getDestinationCards(Common::Array<uint16> &cards) const {
+	for (uint i = 0; i < _branches.size(); i++) {
+		_branches[i].script->getDestinationCards(cards);
+	}
+}
+
 RivenStackChangeCommand::RivenStackChangeCommand(MohawkEngine_Riven *vm, uint16 stackId, uint32 globalCardId, bool byStackId) :
 		RivenCommand(vm),
 		_stackId(stackId),
@@ -134,6 +134,9 @@ public:
 	/** Append the commands of the other script to this script */
 	RivenScript &operator+=(const RivenScript &other);
 
+	/** Append the ids of the cards the script may switch to */
+	void getDestinationCards(Common::Array<uint16> &cards) const;
+
 	/** Get a caption for a script type */
 	static const char *getTypeName(uint16 type);
 
@@ -267,6 +270,9 @@ public:
 	/** Apply card patches for the command's sub-scripts */
 	virtual void applyCardPatches(uint32 globalId, int scriptType, uint16 hotspotId) {}
 
+	/** Append the ids of the cards the command may switch to */
+	virtual void getDestinationCards(Common::Array<uint16> &cards) const {}
+
 protected:
 	MohawkEngine_Riven *_vm;
 };
@@ -291,6 +297,7 @@ public:
 	virtual void dump(byte tabs) override;
 	virtual void execute() override;
 	virtual RivenCommandType getType() const override;
+	virtual void getDestinationCards(Common::Array<uint16> &cards) const override;
 
 private:
 	typedef void (RivenSimpleCommand::*OpcodeProcRiven)(uint16 op, const ArgumentArray &args);
@@ -365,6 +372,7 @@ public:
 	virtual void execute() override;
 	virtual RivenCommandType getType() const override;
 	virtual void applyCardPatches(uint32 globalId, int scriptType, uint16 hotspotId) override;
+	virtual void getDestinationCards(Common::Array<uint16> &cards) const override;
 
 private:
 	RivenSwitchCommand(MohawkEngine_Riven *vm);
@@ -20,10 +20,16 @@
  *
  */
 
+#include "common/algorithm.h"
+
 #include "neverhood/resourceman.h"
 
 namespace Neverhood {
 
+// Resources which aren't used anymore are kept in memory up to this size,
+// so loading them again doesn't need to decompress them again
+static const uint32 kMaxUnusedResourceDataSize = 8 * 1024 * 1024;
+
 ResourceHandle::ResourceHandle()
 	: _resourceFileEntry(NULL), _data(NULL) {
 }
@@ -31,7 +37,7 @@ ResourceHandle::ResourceHandle()
 ResourceHandle::~ResourceHandle() {
 }
 
-ResourceMan::ResourceMan() {
+ResourceMan::ResourceMan() : _dataUseCounter(0) {
 }
 
 ResourceMan::~ResourceMan() {
@@ -150,9 +156,11 @@ void ResourceMan::loadResource(ResourceHandle &resourceHandle, bool applyResourc
 			}
 
 			resourceData->data = new byte[entry->size];
+			resourceData->dataSize = entry->size;
 			resourceHandle._resourceFileEntry->archive->load(entry, resourceData->data, 0);
 			resourceData->dataRefCount = 1;
 		}
+		resourceData->lastUse = ++_dataUseCounter;
 		resourceHandle._data = resourceData->data;
 	}
 }
@@ -167,14 +175,29 @@ void ResourceMan::unloadResource(ResourceHandle &resourceHandle) {
 	}
 }
 
+static bool resourceDataUsedEarlier(const ResourceData *a, const ResourceData *b) {
+	return a->lastUse < b->lastUse;
+}
+
 void ResourceMan::purgeResources() {
+	Common::Array<ResourceData*> unusedData;
+	uint32 unusedDataSize = 0;
 	for (Common::HashMap<uint32, ResourceData*>::iterator it = _data.begin(); it != _data.end(); ++it) {
 		ResourceData *resourceData = (*it)._value;
-		if (resourceData->dataRefCount == 0) {
-			delete[] resourceData->data;
-			resourceData->data = NULL;
+		if (resourceData->dataRefCount == 0 && resourceData->data) {
+			unusedData.push_back(resourceData);
+			unusedDataSize += resourceData->dataSize;
 		}
 	}
+
+	// Free the resources which were used longest ago first
+	Common::sort(unusedData.begin(), unusedData.end(), resourceDataUsedEarlier);
+	for (uint i = 0; i < unusedData.size() && unusedDataSize > kMaxUnusedResourceDataSize; i++) {
+		ResourceData *resourceData = unusedData[i];
+		unusedDataSize -= resourceData->dataSize;
+		delete[] resourceData->data;
+		resourceData->data = NULL;
+	}
 }
 
 } // End of namespace Neverhood
@@ -44,8 +44,10 @@ struct Resource {
 
 struct ResourceData {
 	byte *data;
+	uint32 dataSize;
 	int dataRefCount;
-	ResourceData() : data(NULL), dataRefCount() {}
+	uint32 lastUse;
+	ResourceData() : data(NULL), dataSize(0), dataRefCount(), lastUse(0) {}
 };
 
 class ResourceMan;
@@ -87,6 +89,7 @@ protected:
 	EntriesMap _entries;
 	Common::HashMap<uint32, ResourceData*> _data;
 	Common::Array<Resource*> _resources;
+	uint32 _dataUseCounter;
 };
 
 } // End of namespace Neverhood
@@ -38,12 +38,10 @@ Screen::Screen(NeverhoodEngine *vm)
 
 	_renderQueue = new RenderQueue();
 	_prevRenderQueue = new RenderQueue();
-	_microTiles = new MicroTileArray(640, 480);
 
 }
 
 Screen::~Screen() {
-	delete _microTiles;
 	delete _renderQueue;
 	delete _prevRenderQueue;
 	_backScreen->free();
@@ -61,7 +59,7 @@ void Screen::update() {
 		return;
 	}
 
-	_microTiles->clear();
+	_dirtyRegion.clear();
 
 	for (RenderQueue::iterator it = _renderQueue->begin(); it != _renderQueue->end(); ++it) {
 		RenderItem &renderItem = (*it);
@@ -78,34 +76,32 @@ void Screen::update() {
 	for (RenderQueue::iterator jt = _prevRenderQueue->begin(); jt != _prevRenderQueue->end(); ++jt) {
 		RenderItem &prevRenderItem = (*jt);
 		if (prevRenderItem._refresh)
-			_microTiles->addRect(Common::Rect(prevRenderItem._destX, prevRenderItem._destY, prevRenderItem._destX + prevRenderItem._width, prevRenderItem._destY + prevRenderItem._height));
+			_dirtyRegion.unite(Common::Rect(prevRenderItem._destX, prevRenderItem._destY, prevRenderItem._destX + prevRenderItem._width, prevRenderItem._destY + prevRenderItem._height));
 	}
 
 	for (RenderQueue::iterator it = _renderQueue->begin(); it != _renderQueue->end(); ++it) {
 		RenderItem &renderItem = (*it);
 		if (renderItem._refresh)
-			_microTiles->addRect(Common::Rect(renderItem._destX, renderItem._destY, renderItem._destX + renderItem._width, renderItem._destY + renderItem._height));
+			_dirtyRegion.unite(Common::Rect(renderItem._destX, renderItem._destY, renderItem._destX + renderItem._width, renderItem._destY + renderItem._height));
 		renderItem._refresh = true;
 	}
 
-	RectangleList *updateRects = _microTiles->getRectangles();
+	_dirtyRegion.intersect(Common::Rect(640, 480));
 
 	for (RenderQueue::iterator it = _renderQueue->begin(); it != _renderQueue->end(); ++it) {
 		RenderItem &renderItem = (*it);
-		for (RectangleList::iterator ri = updateRects->begin(); ri != updateRects->end(); ++ri)
+		for (Common::Region::const_iterator ri = _dirtyRegion.begin(); ri != _dirtyRegion.end(); ++ri)
 			blitRenderItem(renderItem, *ri);
 	}
 
 	SWAP(_renderQueue, _prevRenderQueue);
 	_renderQueue->clear();
 
-	for (RectangleList::iterator ri = updateRects->begin(); ri != updateRects->end(); ++ri) {
-		Common::Rect &r = *ri;
+	for (Common::Region::const_iterator ri = _dirtyRegion.begin(); ri != _dirtyRegion.end(); ++ri) {
+		const Common::Rect &r = *ri;
 		_vm->_system->copyRectToScreen((const byte*)_backScreen->getBasePtr(r.left, r.top), _backScreen->pitch, r.left, r.top, r.width(), r.height());
 	}
 
-	delete updateRects;
-
 }
 
 uint32 Screen::getNextFrameTime() {
@@ -409,9 +405,7 @@ void Screen::blitRenderItem(const RenderItem &renderItem, const Common::Rect &cl
 		}
 	} else {
 		while (height--) {
-			for (int xc = 0; xc < width; xc++)
-				if (source[xc] != 0)
-					dest[xc] = source[xc];
+			blitTransparentLine(dest, source, width);
 			source += surface->pitch;
 			dest += _backScreen->pitch;
 		}
@@ -419,4 +413,29 @@ void Screen::blitRenderItem(const RenderItem &renderItem, const Common::Rect &cl
 
 }
 
+void Screen::blitTransparentLine(byte *dest, const byte *source, int width) {
+	int xc = 0;
+
+	// Sprites mostly consist of long runs of either transparent or opaque
+	// pixels, so check four pixels at once and only look at single pixels
+	// on the edges
+	for (; xc + 4 <= width; xc += 4) {
+		const uint32 pixels = READ_UINT32(source + xc);
+		if (pixels == 0)
+			continue;
+		if (((pixels - 0x01010101) & ~pixels & 0x80808080) == 0) {
+			// No transparent pixel among them
+			WRITE_UINT32(dest + xc, pixels);
+		} else {
+			for (int i = xc; i < xc + 4; i++)
+				if (source[i] != 0)
+					dest[i] = source[i];
+		}
+	}
+
+	for (; xc < width; xc++)
+		if (source[xc] != 0)
+			dest[xc] = source[xc];
+}
+
 } // End of namespace Neverhood
@@ -24,9 +24,9 @@
 #define NEVERHOOD_SCREEN_H
 
 #include "common/array.h"
+#include "common/region.h"
 #include "graphics/surface.h"
 #include "neverhood/neverhood.h"
-#include "neverhood/microtiles.h"
 #include "neverhood/graphics.h"
 
 namespace Video {
@@ -89,9 +89,10 @@ public:
 	void queueBlit(const Graphics::Surface *surface, int16 destX, int16 destY, NRect &ddRect, bool transparent, byte version,
 		const Graphics::Surface *shadowSurface = NULL);
 	void blitRenderItem(const RenderItem &renderItem, const Common::Rect &clipRect);
+	static void blitTransparentLine(byte *dest, const byte *source, int width);
 protected:
 	NeverhoodEngine *_vm;
-	MicroTileArray *_microTiles;
+	Common::Region _dirtyRegion;
 	Graphics::Surface *_backScreen;
 	Video::SmackerDecoder *_smackerDecoder, *_savedSmackerDecoder;
 	int32 _ticks;
@@ -72,15 +72,16 @@ void ScreenFader::setFaderValue(const int32 value) {
 			// The original game does a gamma fade here using the Mac API. In order to do
 			// that, it would require an immense amount of CPU processing. This does a
 			// linear fade instead, which looks fairly well, IMO.
+			byte fadeTable[256];
+			makeFadeTable(fadeTable, value);
+
 			Graphics::Surface *screen = g_system->lockScreen();
 
-			for (uint y = 0; y < _screen.h; y++) {
-				for (uint x = 0; x < _screen.w; x++) {
-					if (_screen.format.bytesPerPixel == 2)
-						WRITE_UINT16(screen->getBasePtr(x, y), fadePixel(READ_UINT16(_screen.getBasePtr(x, y)), value));
-					else
-						WRITE_UINT32(screen->getBasePtr(x, y), fadePixel(READ_UINT32(_screen.getBasePtr(x, y)), value));
-				}
+			for (int y = 0; y < _screen.h; y++) {
+				if (_screen.format.bytesPerPixel == 2)
+					fadeRow<uint16>((uint16 *)screen->getBasePtr(0, y), (const uint16 *)_screen.getBasePtr(0, y), _screen.w, fadeTable);
+				else
+					fadeRow<uint32>((uint32 *)screen->getBasePtr(0, y), (const uint32 *)_screen.getBasePtr(0, y), _screen.w, fadeTable);
 			}
 
 			g_system->unlockScreen();
@@ -93,21 +94,24 @@ static inline byte fadeComponent(byte comp, int32 percent) {
 	return comp * percent / 100;
 }
 
-uint32 ScreenFader::fadePixel(uint32 color, int32 percent) const {
-	byte r, g, b;
-	_screen.format.colorToRGB(color, r, g, b);
-
-	if (_isBlack) {
-		r = fadeComponent(r, percent);
-		g = fadeComponent(g, percent);
-		b = fadeComponent(b, percent);
-	} else {
-		r = 0xFF - fadeComponent(0xFF - r, percent);
-		g = 0xFF - fadeComponent(0xFF - g, percent);
-		b = 0xFF - fadeComponent(0xFF - b, percent);
+void ScreenFader::makeFadeTable(byte *fadeTable, int32 percent) const {
+	for (int i = 0; i < 256; i++) {
+		if (_isBlack)
+			fadeTable[i] = fadeComponent(i, percent);
+		else
+			fadeTable[i] = 0xFF - fadeComponent(0xFF - i, percent);
 	}
+}
 
-	return _screen.format.RGBToColor(r, g, b);
+template<typename PixelInt>
+void ScreenFader::fadeRow(PixelInt *dst, const PixelInt *src, int width, const byte *fadeTable) const {
+	const Graphics::PixelFormat &format = _screen.format;
+
+	for (int x = 0; x < width; x++) {
+		byte r, g, b;
+		format.colorToRGB(src[x], r, g, b);
+		dst[x] = format.RGBToColor(fadeTable[r], fadeTable[g], fadeTable[b]);
+	}
 }
 
 Transition::Transition(const DisplayElementID id) : FaderAnimation(id) {
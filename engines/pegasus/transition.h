@@ -46,7 +46,9 @@ public:
 
 private:
 	bool _isBlack;
-	uint32 fadePixel(uint32 color, int32 percent) const;
+	void makeFadeTable(byte *fadeTable, int32 percent) const;
+	template<typename PixelInt>
+	void fadeRow(PixelInt *dst, const PixelInt *src, int width, const byte *fadeTable) const;
 	Graphics::Surface _screen;
 };
 
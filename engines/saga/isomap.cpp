@@ -98,6 +98,7 @@ IsoMap::IsoMap(SagaEngine *vm) : _vm(vm) {
 	_viewScroll.y = (128 - 8) * 16 - 64;
 	_viewDiff = 1;
 	_platformHeight = 0;
+	_mapCacheValid = false;
 	_queueCount = _readCount = 0;
 
 	for (int i = 0; i < SAGA_DRAGON_SEARCH_DIAMETER; i++)
@@ -121,6 +122,8 @@ void IsoMap::loadImages(const ByteArray &resourceData) {
 	uint16 i;
 	size_t offsetDiff;
 
+	_mapCacheValid = false;
+
 	if (resourceData.empty()) {
 		error("IsoMap::loadImages wrong resourceLength");
 	}
@@ -160,6 +163,8 @@ void IsoMap::loadPlatforms(const ByteArray &resourceData) {
 	TilePlatformData *tilePlatformData;
 	uint16 i, x, y;
 
+	_mapCacheValid = false;
+
 	if (resourceData.empty()) {
 		error("IsoMap::loadPlatforms wrong resourceLength");
 	}
@@ -188,6 +193,8 @@ void IsoMap::loadPlatforms(const ByteArray &resourceData) {
 void IsoMap::loadMap(const ByteArray &resourceData) {
 	uint16 x, y;
 
+	_mapCacheValid = false;
+
 	if (resourceData.size() != SAGA_TILEMAP_LEN) {
 		error("IsoMap::loadMap wrong resource length %d", resourceData.size());
 	}
@@ -208,6 +215,8 @@ void IsoMap::loadMetaTiles(const ByteArray &resourceData) {
 	MetaTileData *metaTileData;
 	uint16 i, j;
 
+	_mapCacheValid = false;
+
 	if (resourceData.empty()) {
 		error("IsoMap::loadMetaTiles wrong resourceLength");
 	}
@@ -231,6 +240,8 @@ void IsoMap::loadMulti(const ByteArray &resourceData) {
 	uint16 i;
 	int16 offsetDiff;
 
+	_mapCacheValid = false;
+
 	if (resourceData.size() < 2) {
 		error("IsoMap::loadMetaTiles wrong resourceLength");
 	}
@@ -274,6 +285,7 @@ void IsoMap::clear() {
 	_multiTable.clear();
 	_tileData.clear();
 	_multiTableData.clear();
+	_mapCacheValid = false;
 }
 
 void IsoMap::adjustScroll(bool jump) {
@@ -367,9 +379,61 @@ int16 IsoMap::findMulti(int16 tileIndex, int16 absU, int16 absV, int16 absH) {
 }
 
 void IsoMap::draw() {
-	_tileClip = _vm->_scene->getSceneClip();
-	_vm->_gfx->drawRect(_tileClip, 0);
-	drawTiles(NULL);
+	const Rect &sceneClip = _vm->_scene->getSceneClip();
+	int width = sceneClip.width();
+	int height = sceneClip.height();
+	byte *pixels = _vm->_gfx->getBackBufferPixels();
+	int pitch = _vm->_gfx->getBackBufferPitch();
+	Point delta(_viewScroll.x - _mapCacheScroll.x, _viewScroll.y - _mapCacheScroll.y);
+
+	if (!_mapCacheValid || _mapCacheClip != sceneClip || ABS<int>(delta.x) >= width || ABS<int>(delta.y) >= height) {
+		_tileClip = sceneClip;
+		_vm->_gfx->drawRect(_tileClip, 0);
+		drawTiles(NULL);
+	} else if (delta.x == 0 && delta.y == 0) {
+		_vm->_gfx->drawRegion(sceneClip, &_mapCache.front());
+		return;
+	} else {
+		// Move the part of the map which is still visible, and only draw the
+		// strips which scrolling has uncovered. Tiles are clipped exactly to
+		// _tileClip, so this gives the same picture as drawing everything.
+		int srcX = MAX<int>(delta.x, 0);
+		int dstX = MAX<int>(-delta.x, 0);
+		int count = width - ABS<int>(delta.x);
+
+		for (int y = MAX<int>(-delta.y, 0); y < MIN<int>(height, height - delta.y); y++)
+			memcpy(pixels + (sceneClip.top + y) * pitch + sceneClip.left + dstX, &_mapCache[(y + delta.y) * width + srcX], count);
+
+		if (delta.x != 0) {
+			_tileClip = sceneClip;
+			if (delta.x > 0)
+				_tileClip.left = sceneClip.right - delta.x;
+			else
+				_tileClip.right = sceneClip.left - delta.x;
+			_vm->_gfx->drawRect(_tileClip, 0);
+			drawTiles(NULL);
+		}
+
+		if (delta.y != 0) {
+			_tileClip = sceneClip;
+			if (delta.y > 0)
+				_tileClip.top = sceneClip.bottom - delta.y;
+			else
+				_tileClip.bottom = sceneClip.top - delta.y;
+			_vm->_gfx->drawRect(_tileClip, 0);
+			drawTiles(NULL);
+		}
+
+		_vm->_render->addDirtyRect(sceneClip);
+	}
+
+	_mapCache.resize(width * height);
+	for (int y = 0; y < height; y++)
+		memcpy(&_mapCache[y * width], pixels + (sceneClip.top + y) * pitch + sceneClip.left, width);
+
+	_mapCacheClip = sceneClip;
+	_mapCacheScroll = _viewScroll;
+	_mapCacheValid = true;
 }
 
 void IsoMap::setMapPosition(int x, int y) {
@@ -1609,6 +1673,8 @@ void IsoMap::setTileDoorState(int doorNumber, int doorState) {
 	}
 
 	multiTileEntryData = &_multiTable[doorNumber];
+	if (multiTileEntryData->currentState != doorState)
+		_mapCacheValid = false;
 	multiTileEntryData->currentState = doorState;
 }
 
@@ -222,6 +222,13 @@ private:
 
 	Point _mapPosition;
 
+	// The map as last drawn by draw(), so that it only needs to be drawn
+	// again where scrolling has uncovered it
+	ByteArray _mapCache;
+	Rect _mapCacheClip;
+	Point _mapCacheScroll;
+	bool _mapCacheValid;
+
 // path finding stuff
 	uint16 _platformHeight;
 
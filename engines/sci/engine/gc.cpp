@@ -54,12 +54,14 @@ void WorklistManager::push(reg_t reg) {
 	if (!reg.getSegment()) // No numbers
 		return;
 
-	debugC(kDebugLevelGC, "[GC] Adding %04x:%04x", PRINT_REG(reg));
-
-	if (_map.contains(reg))
+	// Look the address up only once: new entries are added as false
+	bool &known = _map[reg];
+	if (known)
 		return; // already dealt with it
 
-	_map.setVal(reg, true);
+	debugC(kDebugLevelGC, "[GC] Adding %04x:%04x", PRINT_REG(reg));
+
+	known = true;
 	_worklist.push_back(reg);
 }
 
@@ -68,20 +70,25 @@ void WorklistManager::pushArray(const Common::Array<reg_t> &tmp) {
 		push(*it);
 }
 
-static AddrSet *normalizeAddresses(SegManager *segMan, const AddrSet &nonnormal_map) {
-	AddrSet *normal_map = new AddrSet();
+static void normalizeAddresses(SegManager *segMan, AddrSet &map) {
+	// Most addresses are canonic already, so only the canonic addresses of
+	// the others are added, rather than building a new set. The additional
+	// addresses left in the set are never deallocatable ones.
+	Common::Array<reg_t> canonic;
 
-	for (AddrSet::const_iterator i = nonnormal_map.begin(); i != nonnormal_map.end(); ++i) {
-		reg_t reg = i->_key;
+	for (AddrSet::const_iterator i = map.begin(); i != map.end(); ++i) {
+		const reg_t reg = i->_key;
 		SegmentObj *mobj = segMan->getSegmentObj(reg.getSegment());
 
 		if (mobj) {
-			reg = mobj->findCanonicAddress(segMan, reg);
-			normal_map->setVal(reg, true);
+			const reg_t canonicReg = mobj->findCanonicAddress(segMan, reg);
+			if (canonicReg != reg)
+				canonic.push_back(canonicReg);
 		}
 	}
 
-	return normal_map;
+	for (Common::Array<reg_t>::const_iterator i = canonic.begin(); i != canonic.end(); ++i)
+		map.setVal(*i, true);
 }
 
 static void processWorkList(SegManager *segMan, WorklistManager &wm, const Common::Array<SegmentObj *> &heap) {
@@ -102,7 +109,8 @@ static void processWorkList(SegManager *segMan, WorklistManager &wm, const Commo
 AddrSet *findAllActiveReferences(EngineState *s) {
 	assert(!s->_executionStack.empty());
 
-	WorklistManager wm;
+	AddrSet *activeRefs = new AddrSet();
+	WorklistManager wm(*activeRefs);
 
 	// Initialize registers
 	wm.push(s->r_acc);
@@ -176,7 +184,8 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 	if (g_sci->_gfxPorts)
 		g_sci->_gfxPorts->processEngineHunkList(wm);
 
-	return normalizeAddresses(s->_segMan, wm._map);
+	normalizeAddresses(s->_segMan, *activeRefs);
+	return activeRefs;
 }
 
 void run_gc(EngineState *s) {
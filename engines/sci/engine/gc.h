@@ -57,7 +57,9 @@ void run_gc(EngineState *s);
 
 struct WorklistManager {
 	Common::Array<reg_t> _worklist;
-	AddrSet _map;	// used for 2 contains() calls, inside push() and run_gc()
+	AddrSet &_map;	// used for 2 contains() calls, inside push() and run_gc()
+
+	explicit WorklistManager(AddrSet &map) : _map(map) {}
 
 	void push(reg_t reg);
 	void pushArray(const Common::Array<reg_t> &tmp);
@@ -111,13 +111,26 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// A* set membership
+	bool inOpenSet;
+	bool inClosedSet;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = NULL;
+		inOpenSet = false;
+		inClosedSet = false;
 	}
 };
 
+// Polygon edge, with its bounding box
+struct Edge {
+	Vertex *vertex;
+	Common::Point p, q;
+	int16 left, top, right, bottom;
+};
+
 class VertexList: public Common::List<Vertex *> {
 public:
 	bool contains(Vertex *v) {
@@ -250,6 +263,9 @@ struct PathfindingState {
 	// Total number of vertices
 	int vertices;
 
+	// All polygon edges, in the order of vertex_index
+	Common::Array<Edge> edges;
+
 	// Point to prepend and append to final path
 	Common::Point *_prependPoint;
 	Common::Point *_appendPoint;
@@ -668,33 +684,45 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 	VertexList *visVerts = new VertexList();
 
+	const Common::Point &a = vertex_cur->v;
+
 	for (int i = 0; i < s->vertices; i++) {
 		Vertex *vertex = s->vertex_index[i];
+		const Common::Point &b = vertex->v;
 
 		// Make sure we don't intersect a polygon locally at the vertices
-		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		if ((vertex == vertex_cur) || (inside(b, vertex_cur)) || (inside(a, vertex)))
 			continue;
 
+		// Edges outside of the bounding box of (a, b) can neither have their
+		// start on it nor properly intersect it. This does not hold when a
+		// equals b, see between().
+		const bool useBox = (a != b);
+		const int16 left = MIN(a.x, b.x), right = MAX(a.x, b.x);
+		const int16 top = MIN(a.y, b.y), bottom = MAX(a.y, b.y);
+
 		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
-					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
-
-					// This edge won't properly intersect, so we continue
-					continue;
-				}
+		uint j;
+		for (j = 0; j < s->edges.size(); j++) {
+			const Edge &edge = s->edges[j];
 
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+			if (useBox && (edge.right < left || edge.left > right || edge.bottom < top || edge.top > bottom))
+				continue;
+
+			if (between(a, b, edge.p)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(a, edge.vertex)) || (inside(b, edge.vertex)))
 					break;
+
+				// This edge won't properly intersect, so we continue
+				continue;
 			}
+
+			if (intersect_proper(a, b, edge.p, edge.q))
+				break;
 		}
 
-		if (j == s->vertices)
+		if (j == s->edges.size())
 			visVerts->push_front(vertex);
 	}
 
@@ -1299,6 +1327,21 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 
 	pf_s->vertices = count;
 
+	for (int i = 0; i < count; i++) {
+		Vertex *vertex = pf_s->vertex_index[i];
+		if (VERTEX_HAS_EDGES(vertex)) {
+			Edge edge;
+			edge.vertex = vertex;
+			edge.p = vertex->v;
+			edge.q = CLIST_NEXT(vertex)->v;
+			edge.left = MIN(edge.p.x, edge.q.x);
+			edge.right = MAX(edge.p.x, edge.q.x);
+			edge.top = MIN(edge.p.y, edge.q.y);
+			edge.bottom = MAX(edge.p.y, edge.q.y);
+			pf_s->edges.push_back(edge);
+		}
+	}
+
 	return pf_s;
 }
 
@@ -1317,6 +1360,7 @@ static void AStar(PathfindingState *s) {
 	VertexList openSet;
 
 	openSet.push_front(s->vertex_start);
+	s->vertex_start->inOpenSet = true;
 	s->vertex_start->costG = 0;
 	s->vertex_start->costF = (uint32)sqrt((float)s->vertex_start->v.sqrDist(s->vertex_end->v));
 
@@ -1343,7 +1387,9 @@ static void AStar(PathfindingState *s) {
 
 		// Move vertex from set open to set closed
 		closedSet.push_front(vertex_min);
+		vertex_min->inClosedSet = true;
 		openSet.erase(vertex_min_it);
+		vertex_min->inOpenSet = false;
 
 		VertexList *visVerts = visible_vertices(s, vertex_min);
 
@@ -1351,11 +1397,13 @@ static void AStar(PathfindingState *s) {
 			uint32 new_dist;
 			Vertex *vertex = *it;
 
-			if (closedSet.contains(vertex))
+			if (vertex->inClosedSet)
 				continue;
 
-			if (!openSet.contains(vertex))
+			if (!vertex->inOpenSet) {
 				openSet.push_front(vertex);
+				vertex->inOpenSet = true;
+			}
 
 			new_dist = vertex_min->costG + (uint32)sqrt((float)vertex_min->v.sqrDist(vertex->v));
 
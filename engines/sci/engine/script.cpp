@@ -51,6 +51,8 @@ void Script::freeScript(const bool keepLocalsSegment) {
 	_nr = 0;
 
 	_buf.clear();
+	_instructionIndex.clear();
+	_instructions.clear();
 	_script.clear();
 	_heap.clear();
 	_exports.clear();
@@ -705,6 +707,28 @@ bool Script::relocateLocal(SegmentId segment, int location, uint32 offset) {
 		return false;
 }
 
+const Script::DecodedInstruction &Script::getInstruction(uint32 offset) {
+	if (_instructionIndex.empty())
+		_instructionIndex.resize(_buf->size());
+
+	const uint16 index = _instructionIndex[offset];
+	if (index)
+		return _instructions[index - 1];
+
+	DecodedInstruction instruction;
+	instruction.size = readPMachineInstruction(getBuf(offset), instruction.extOpcode, instruction.opparams);
+
+	// The index can't refer to any more instructions
+	if (_instructions.size() == 0xFFFF) {
+		_uncachedInstruction = instruction;
+		return _uncachedInstruction;
+	}
+
+	_instructions.push_back(instruction);
+	_instructionIndex[offset] = _instructions.size();
+	return _instructions.back();
+}
+
 uint32 Script::getRelocationOffset(const uint32 offset) const {
 	if (getSciVersion() == SCI_VERSION_3) {
 		SciSpan<const byte> relocStart = _buf->subspan(_buf->getUint32SEAt(8));
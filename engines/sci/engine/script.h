@@ -94,6 +94,23 @@ private:
 
 	ObjMap _objects;	/**< Table for objects, contains property variables */
 
+public:
+	/** An instruction of the script, with its operands already read */
+	struct DecodedInstruction {
+		int16 opparams[4];
+		uint16 size;	/**< Size of the instruction in the buffer */
+		byte extOpcode;
+	};
+
+private:
+	/**
+	 * For each offset of the buffer, the index of the instruction decoded
+	 * there plus one, or 0 if no instruction has been decoded there yet.
+	 */
+	Common::Array<uint16> _instructionIndex;
+	Common::Array<DecodedInstruction> _instructions;
+	DecodedInstruction _uncachedInstruction;
+
 protected:
 	offsetLookupArrayType _offsetLookupArray; // Table of all elements of currently loaded script, that may get pointed to
 
@@ -118,6 +135,14 @@ public:
 	}
 
 	const byte *getBuf(uint offset = 0) const { return _buf->getUnsafeDataAt(offset); }
+
+	/**
+	 * Returns the instruction at the given offset of the buffer. Each
+	 * instruction is only decoded the first time it is executed, as the
+	 * code of the scripts can't be told apart from their data up front.
+	 * The returned reference is only valid until the next call.
+	 */
+	const DecodedInstruction &getInstruction(uint32 offset);
 	SciSpan<const byte> getSpan(uint offset) const { return _buf->subspan(offset); }
 
 	int getScriptNumber() const { return _nr; }
@@ -7554,6 +7554,8 @@ void ScriptPatcher::initSignature(const SciScriptPatcherEntry *patchTable) {
 	curEntry = patchTable;
 	curRuntimeEntry = _runtimeTable;
 	while (curEntry->signatureData) {
+		_scriptEntries[curEntry->scriptNr].push_back(curEntry - patchTable);
+
 		// process signature
 		curRuntimeEntry->active = curEntry->defaultActive;
 		curRuntimeEntry->magicDWord = 0;
@@ -7777,26 +7779,66 @@ void ScriptPatcher::processScript(uint16 scriptNr, SciSpan<byte> scriptData) {
 			}
 		}
 
-		curEntry = signatureTable;
-		curRuntimeEntry = _runtimeTable;
-
-		while (curEntry->signatureData) {
-			if ((scriptNr == curEntry->scriptNr) && (curRuntimeEntry->active)) {
-				int32 foundOffset = 0;
-				int16 applyCount = curEntry->applyCount;
-				do {
-					foundOffset = findSignature(curEntry, curRuntimeEntry, scriptData);
-					if (foundOffset != -1) {
-						// found, so apply the patch
-						debugC(kDebugLevelScriptPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, foundOffset);
-						applyPatch(curEntry, scriptData, foundOffset);
-					}
-					applyCount--;
-				} while ((foundOffset != -1) && (applyCount));
+		ScriptEntryMap::const_iterator entries = _scriptEntries.find(scriptNr);
+		if (entries == _scriptEntries.end())
+			return;
+
+		// Scripts get reloaded whenever they are instantiated again, e.g. on
+		// every room change. Patching the same data again patches the same
+		// offsets, so the signatures only need to be searched for once.
+		const uint32 checksum = calculateChecksum(scriptData);
+		PatchedScriptMap::const_iterator cached = _patchedScripts.find(scriptNr);
+		if (cached != _patchedScripts.end() && cached->_value.size == scriptData.size() && cached->_value.checksum == checksum) {
+			const Common::Array<PatchLocation> &patches = cached->_value.patches;
+			for (uint i = 0; i < patches.size(); ++i) {
+				curEntry = &signatureTable[patches[i].entryIndex];
+				debugC(kDebugLevelScriptPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, patches[i].offset);
+				applyPatch(curEntry, scriptData, patches[i].offset);
 			}
-			curEntry++; curRuntimeEntry++;
+			return;
+		}
+
+		PatchedScript &patched = _patchedScripts[scriptNr];
+		patched.size = scriptData.size();
+		patched.checksum = checksum;
+		patched.patches.clear();
+
+		const Common::Array<uint16> &entryIndices = entries->_value;
+		for (uint i = 0; i < entryIndices.size(); ++i) {
+			curEntry = &signatureTable[entryIndices[i]];
+			curRuntimeEntry = &_runtimeTable[entryIndices[i]];
+			if (!curRuntimeEntry->active)
+				continue;
+
+			int32 foundOffset = 0;
+			int16 applyCount = curEntry->applyCount;
+			do {
+				foundOffset = findSignature(curEntry, curRuntimeEntry, scriptData);
+				if (foundOffset != -1) {
+					// found, so apply the patch
+					debugC(kDebugLevelScriptPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, foundOffset);
+					applyPatch(curEntry, scriptData, foundOffset);
+
+					PatchLocation location;
+					location.entryIndex = entryIndices[i];
+					location.offset = foundOffset;
+					patched.patches.push_back(location);
+				}
+				applyCount--;
+			} while ((foundOffset != -1) && (applyCount));
 		}
 	}
 }
 
+uint32 ScriptPatcher::calculateChecksum(const SciSpan<const byte> &scriptData) {
+	// FNV-1a
+	const byte *data = scriptData.getUnsafeDataAt(0, scriptData.size());
+	uint32 checksum = 2166136261u;
+	for (uint32 i = 0; i < scriptData.size(); ++i) {
+		checksum ^= data[i];
+		checksum *= 16777619;
+	}
+	return checksum;
+}
+
 } // End of namespace Sci
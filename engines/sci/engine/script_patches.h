@@ -23,6 +23,9 @@
 #ifndef SCI_ENGINE_SCRIPT_PATCHES_H
 #define SCI_ENGINE_SCRIPT_PATCHES_H
 
+#include "common/array.h"
+#include "common/hashmap.h"
+
 #include "sci/sci.h"
 
 namespace Sci {
@@ -117,11 +120,33 @@ private:
 	// returns -1 in case it was not found or an offset to the matching data
 	int32 findSignature(const SciScriptPatcherEntry *patchEntry, const SciScriptPatcherRuntimeEntry *runtimeEntry, const SciSpan<const byte> &scriptData);
 
+	// Calculates a checksum of the unpatched script data, to recognize it when the script gets reloaded
+	static uint32 calculateChecksum(const SciSpan<const byte> &scriptData);
+
 	// Applies a patch to a given script + offset (overwrites parts)
 	void applyPatch(const SciScriptPatcherEntry *patchEntry, SciSpan<byte> scriptData, int32 signatureOffset);
 
+	struct PatchLocation {
+		uint16 entryIndex;
+		int32 offset;
+	};
+
+	// The patches applied to the last loaded data of a script, so they can be
+	// applied again without searching for their signatures when the script
+	// gets reloaded
+	struct PatchedScript {
+		uint32 size;
+		uint32 checksum;
+		Common::Array<PatchLocation> patches;
+	};
+
+	typedef Common::HashMap<uint16, Common::Array<uint16> > ScriptEntryMap;
+	typedef Common::HashMap<uint16, PatchedScript> PatchedScriptMap;
+
 	Selector *_selectorIdTable;
 	SciScriptPatcherRuntimeEntry *_runtimeTable;
+	ScriptEntryMap _scriptEntries; // indices into the patch table, by script number
+	PatchedScriptMap _patchedScripts;
 	bool _isMacSci11;
 };
 
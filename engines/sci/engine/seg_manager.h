@@ -46,6 +46,31 @@ enum ScriptLoadType {
 
 class Script;
 
+/**
+ * The result of looking up a selector in a class and its superclasses.
+ */
+struct ClassSelectorLookup {
+	int varIndex; /**< Index of the selector as a variable, or -1 */
+	reg_t funcp; /**< Method of the selector, or NULL_REG */
+};
+
+struct ClassSelectorKey {
+	reg_t classPos;
+	Selector selector;
+
+	bool operator==(const ClassSelectorKey &other) const {
+		return classPos == other.classPos && selector == other.selector;
+	}
+};
+
+struct ClassSelectorKey_Hash {
+	uint operator()(const ClassSelectorKey &x) const {
+		return (x.classPos.getSegment() << 3) ^ x.classPos.getOffset() ^ (x.selector << 16);
+	}
+};
+
+typedef Common::HashMap<ClassSelectorKey, ClassSelectorLookup, ClassSelectorKey_Hash> ClassSelectorCache;
+
 class SegManager : public Common::Serializable {
 	friend class Console;
 public:
@@ -149,6 +174,13 @@ public:
 	 */
 	Script *getScriptIfLoaded(SegmentId seg) const;
 
+	/**
+	 * Return the cache of the selector lookups in classes, used by
+	 * lookupSelector(). It is cleared whenever a script is instantiated or
+	 * freed, as classes only stay in place while their script is loaded.
+	 */
+	ClassSelectorCache &getClassSelectorCache() { return _classSelectorCache; }
+
 	// 2. Clones
 
 	/**
@@ -461,6 +493,7 @@ private:
 	Common::Array<Class> _classTable; /**< Table of all classes */
 	/** Map script ids to segment ids. */
 	Common::HashMap<int, SegmentId> _scriptSegMap;
+	ClassSelectorCache _classSelectorCache;
 
 	ResourceManager *_resMan;
 	ScriptPatcher *_scriptPatcher;
@@ -310,6 +310,37 @@ void invokeSelector(EngineState *s, reg_t object, int selectorId,
 	run_vm(s); // Start a new vm
 }
 
+/**
+ * Looks up a selector in a class and its superclasses. The result is cached,
+ * so the class must be in a loaded script.
+ */
+static const ClassSelectorLookup &lookupClassSelector(SegManager *segMan, const Object *classObj, Selector selectorId) {
+	ClassSelectorCache &cache = segMan->getClassSelectorCache();
+	ClassSelectorKey key;
+	key.classPos = classObj->getPos();
+	key.selector = selectorId;
+
+	ClassSelectorCache::const_iterator i = cache.find(key);
+	if (i != cache.end())
+		return i->_value;
+
+	ClassSelectorLookup &lookup = cache[key];
+	lookup.varIndex = classObj->locateVarSelector(segMan, selectorId);
+	lookup.funcp = NULL_REG;
+
+	if (lookup.varIndex < 0) {
+		for (const Object *obj = classObj; obj; obj = segMan->getObject(obj->getSuperClassSelector())) {
+			const int index = obj->funcSelectorPosition(selectorId);
+			if (index >= 0) {
+				lookup.funcp = obj->getFunction(index);
+				break;
+			}
+		}
+	}
+
+	return lookup;
+}
+
 SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector selectorId, ObjVarRef *varp, reg_t *fptr) {
 	const Object *obj = segMan->getObject(obj_location);
 	int index;
@@ -325,6 +356,38 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x, %s", PRINT_REG(obj_location), origin.toString().c_str());
 	}
 
+	// Variables are looked up in the class of the object, and methods in the
+	// object itself before its class. SCI3 objects have their own variable
+	// selectors, so only lookups in the classes of older objects are cached.
+	const Object *classObj = getSciVersion() != SCI_VERSION_3 ? obj->getClass(segMan) : nullptr;
+	if (classObj && classObj->isClass() && segMan->getScriptIfLoaded(classObj->getPos().getSegment())) {
+		const ClassSelectorLookup &lookup = lookupClassSelector(segMan, classObj, selectorId);
+
+		if (lookup.varIndex >= 0) {
+			if (varp) {
+				varp->obj = obj_location;
+				varp->varindex = lookup.varIndex;
+			}
+			return kSelectorVariable;
+		}
+
+		if (obj != classObj) {
+			index = obj->funcSelectorPosition(selectorId);
+			if (index >= 0) {
+				if (fptr)
+					*fptr = obj->getFunction(index);
+				return kSelectorMethod;
+			}
+		}
+
+		if (lookup.funcp.isNull())
+			return kSelectorNone;
+
+		if (fptr)
+			*fptr = lookup.funcp;
+		return kSelectorMethod;
+	}
+
 	index = obj->locateVarSelector(segMan, selectorId);
 
 	if (index >= 0) {
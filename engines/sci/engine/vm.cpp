@@ -23,6 +23,7 @@
 #include "common/config-manager.h"
 #include "common/debug.h"
 #include "common/debug-channels.h"
+#include "common/profiler.h"
 
 #include "sci/sci.h"
 #include "sci/console.h"
@@ -562,9 +563,22 @@ uint32 findOffset(const int16 relOffset, const Script *scr, const uint32 pcOffse
 	return offset;
 }
 
+/**
+ * Counts the instructions run_vm() executes, and adds them to the profiler
+ * counter once it returns, rather than for every instruction.
+ */
+struct InstructionCounter {
+	uint32 count;
+
+	InstructionCounter() : count(0) {}
+	~InstructionCounter() { PROFILE_COUNT("script instructions", count); }
+};
+
 void run_vm(EngineState *s) {
 	assert(s);
 
+	InstructionCounter instructions;
+
 	int temp;
 	reg_t r_temp; // Temporary register
 	StackPtr s_temp; // Temporary stack pointer
@@ -651,9 +665,12 @@ void run_vm(EngineState *s) {
 			s->xs->addr.pc.getOffset(), scr->getBufSize());
 
 		// Get opcode
-		byte extOpcode;
-		s->xs->addr.pc.incOffset(readPMachineInstruction(scr->getBuf(s->xs->addr.pc.getOffset()), extOpcode, opparams));
+		const Script::DecodedInstruction &instruction = scr->getInstruction(s->xs->addr.pc.getOffset());
+		const byte extOpcode = instruction.extOpcode;
+		memcpy(opparams, instruction.opparams, sizeof(opparams));
+		s->xs->addr.pc.incOffset(instruction.size);
 		const byte opcode = extOpcode >> 1;
+		++instructions.count;
 		//debug("%s: %d, %d, %d, %d, acc = %04x:%04x, script %d, local script %d", opcodeNames[opcode], opparams[0], opparams[1], opparams[2], opparams[3], PRINT_REG(s->r_acc), scr->getScriptNumber(), local_script->getScriptNumber());
 
 #ifdef ABORT_ON_INFINITE_LOOP
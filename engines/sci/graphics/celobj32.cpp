@@ -20,6 +20,7 @@
  *
  */
 
+#include "sci/console.h"
 #include "sci/resource.h"
 #include "sci/engine/features.h"
 #include "sci/engine/seg_manager.h"
@@ -86,9 +87,9 @@ bool CelObj::_drawBlackLines = false;
 void CelObj::init() {
 	CelObj::deinit();
 	_drawBlackLines = false;
-	_nextCacheId = 1;
 	_scaler.reset(new CelScaler());
-	_cache.reset(new CelCache(100));
+	// SSCI keeps 100 cels, which busy scenes exceed every frame
+	_cache.reset(new CelCache(500));
 }
 
 void CelObj::deinit() {
@@ -109,6 +110,7 @@ struct SCALER_NoScale {
 	const int16 _lastIndex;
 	const int16 _sourceX;
 	const int16 _sourceY;
+	byte _buffer[kCelScalerTableSize];
 
 	SCALER_NoScale(const CelObj &celObj, const int16 maxWidth, const Common::Point &scaledPosition) :
 	_row(nullptr),
@@ -135,13 +137,22 @@ struct SCALER_NoScale {
 		}
 	}
 
-	inline byte read() {
-		assert(_row != _rowEdge);
-
+	/**
+	 * Reads the next `width` pixels of the current row. Rows which are not
+	 * mirrored are read straight from the source.
+	 */
+	inline const byte *readRow(const int16 width) {
 		if (FLIP) {
-			return *_row--;
+			assert(_row - width >= _rowEdge);
+			for (int16 x = 0; x < width; ++x) {
+				_buffer[x] = *_row--;
+			}
+			return _buffer;
 		} else {
-			return *_row++;
+			assert(_row + width <= _rowEdge);
+			const byte *const row = _row;
+			_row += width;
+			return row;
 		}
 	}
 };
@@ -155,6 +166,7 @@ struct SCALER_Scale {
 	const byte *_row;
 	READER _reader;
 	int16 _x;
+	byte _buffer[kCelScalerTableSize];
 	static int16 _valuesX[kCelScalerTableSize];
 	static int16 _valuesY[kCelScalerTableSize];
 
@@ -237,9 +249,17 @@ struct SCALER_Scale {
 		assert(_x >= _minX && _x <= _maxX);
 	}
 
-	inline byte read() {
-		assert(_x >= _minX && _x <= _maxX);
-		return _row[_valuesX[_x++]];
+	/**
+	 * Reads the next `width` scaled pixels of the current row.
+	 */
+	inline const byte *readRow(const int16 width) {
+		assert(_x >= _minX && _x + width - 1 <= _maxX);
+		const int16 *const valuesX = _valuesX + _x;
+		for (int16 x = 0; x < width; ++x) {
+			_buffer[x] = _row[valuesX[x]];
+		}
+		_x += width;
+		return _buffer;
 	}
 };
 
@@ -384,6 +404,30 @@ struct MAPPER_NoMD {
 			*target = pixel;
 		}
 	}
+
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor) const {
+		// Pixels are checked four at a time: groups without any transparent
+		// pixel are copied at once, and fully transparent ones are skipped
+		const uint32 skipColors = skipColor * 0x01010101;
+		int16 x = 0;
+		for (; x + 4 <= width; x += 4) {
+			const uint32 pixels = READ_UINT32(source + x);
+			const uint32 diff = pixels ^ skipColors;
+			if (diff == 0) {
+				continue;
+			} else if (((diff - 0x01010101) & ~diff & 0x80808080) == 0) {
+				WRITE_UINT32(target + x, pixels);
+			} else {
+				for (int16 i = x; i < x + 4; ++i) {
+					draw(target + i, source[i], skipColor);
+				}
+			}
+		}
+
+		for (; x < width; ++x) {
+			draw(target + x, source[x], skipColor);
+		}
+	}
 };
 
 /**
@@ -394,6 +438,10 @@ struct MAPPER_NoMDNoSkip {
 	inline void draw(byte *target, const byte pixel, const uint8) const {
 		*target = pixel;
 	}
+
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8) const {
+		memcpy(target, source, width);
+	}
 };
 
 /**
@@ -412,6 +460,12 @@ struct MAPPER_Map {
 			}
 		}
 	}
+
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor) const {
+		for (int16 x = 0; x < width; ++x) {
+			draw(target + x, source[x], skipColor);
+		}
+	}
 };
 
 /**
@@ -426,6 +480,15 @@ struct MAPPER_NoMap {
 			*target = pixel;
 		}
 	}
+
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor) const {
+		const uint8 startColor = g_sci->_gfxRemap32->getStartColor();
+		for (int16 x = 0; x < width; ++x) {
+			if (source[x] != skipColor && source[x] < startColor) {
+				target[x] = source[x];
+			}
+		}
+	}
 };
 
 void CelObj::draw(Buffer &target, const ScreenItem &screenItem, const Common::Rect &targetRect) const {
@@ -602,45 +665,64 @@ void CelObj::submitPalette() const {
 #pragma mark -
 #pragma mark CelObj - Caching
 
-int CelObj::_nextCacheId = 1;
-Common::ScopedPtr<CelCache> CelObj::_cache;
-
-int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
-	*nextInsertIndex = -1;
-	int oldestId = _nextCacheId + 1;
-	int oldestIndex = 0;
+CelCache::CelCache(const uint maxSize) :
+	_maxSize(maxSize),
+	_hits(0),
+	_misses(0) {}
 
-	for (int i = 0, len = _cache->size(); i < len; ++i) {
-		CelCacheEntry &entry = (*_cache)[i];
+CelCache::~CelCache() {
+	for (CelList::iterator it = _cels.begin(); it != _cels.end(); ++it) {
+		delete *it;
+	}
+}
 
-		if (entry.celObj == nullptr) {
-			if (*nextInsertIndex == -1) {
-				*nextInsertIndex = i;
-			}
-		} else if (entry.celObj->_info == celInfo) {
-			entry.id = ++_nextCacheId;
-			return i;
-		} else if (oldestId > entry.id) {
-			oldestId = entry.id;
-			oldestIndex = i;
-		}
+const CelObj *CelCache::find(const CelInfo32 &celInfo) {
+	CelMap::iterator position = _positions.find(celInfo);
+	if (position == _positions.end()) {
+		++_misses;
+		return nullptr;
 	}
 
-	if (*nextInsertIndex == -1) {
-		*nextInsertIndex = oldestIndex;
+	++_hits;
+	CelObj *const celObj = *position->_value;
+	_cels.erase(position->_value);
+	_cels.push_front(celObj);
+	position->_value = _cels.begin();
+	return celObj;
+}
+
+void CelCache::put(CelObj *const celObj) {
+	if (_cels.size() >= _maxSize) {
+		CelObj *const oldest = _cels.back();
+		_positions.erase(oldest->_info);
+		_cels.pop_back();
+		delete oldest;
 	}
 
-	return -1;
+	_cels.push_front(celObj);
+	_positions[celObj->_info] = _cels.begin();
 }
 
-void CelObj::putCopyInCache(const int cacheIndex) const {
-	if (cacheIndex == -1) {
-		error("Invalid cache index");
+void CelCache::printDebugInfo(Console *con) const {
+	const uint lookups = _hits + _misses;
+	con->debugPrintf("%u of %u cels cached\n", _cels.size(), _maxSize);
+	con->debugPrintf("%u hits, %u misses (%u%% hits)\n", _hits, _misses, lookups ? _hits * 100 / lookups : 0);
+}
+
+Common::ScopedPtr<CelCache> CelObj::_cache;
+
+void CelObj::printCacheDebugInfo(Console *con) {
+	if (_cache) {
+		_cache->printDebugInfo(con);
 	}
+}
 
-	CelCacheEntry &entry = (*_cache)[cacheIndex];
-	entry.celObj.reset(duplicate());
-	entry.id = ++_nextCacheId;
+const CelObj *CelObj::searchCache(const CelInfo32 &celInfo) const {
+	return _cache->find(celInfo);
+}
+
+void CelObj::putCopyInCache() const {
+	_cache->put(duplicate());
 }
 
 #pragma mark -
@@ -671,12 +753,8 @@ struct RENDERER {
 			}
 
 			_scaler.setTarget(targetRect.left, targetRect.top + y);
-
-			for (int16 x = 0; x < targetWidth; ++x) {
-				_mapper.draw(targetPixel++, _scaler.read(), _skipColor);
-			}
-
-			targetPixel += skipStride;
+			_mapper.drawRow(targetPixel, _scaler.readRow(targetWidth), targetWidth, _skipColor);
+			targetPixel += targetWidth + skipStride;
 		}
 	}
 };
@@ -886,16 +964,13 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 	_compressionType = kCelCompressionInvalid;
 	_transparent = true;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjView *const cachedCelObj = dynamic_cast<CelObjView *>(entry.celObj.get());
+	const CelObj *const cachedEntry = searchCache(_info);
+	if (cachedEntry != nullptr) {
+		const CelObjView *const cachedCelObj = dynamic_cast<const CelObjView *>(cachedEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjView in cache slot %d", cacheIndex);
+			error("Expected a CelObjView in the cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1005,7 +1080,7 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 		_remap = analyzeForRemap();
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	putCopyInCache();
 }
 
 bool CelObjView::analyzeUncompressedForRemap() const {
@@ -1105,16 +1180,13 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 	_transparent = true;
 	_remap = false;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjPic *const cachedCelObj = dynamic_cast<CelObjPic *>(entry.celObj.get());
+	const CelObj *const cachedEntry = searchCache(_info);
+	if (cachedEntry != nullptr) {
+		const CelObjPic *const cachedCelObj = dynamic_cast<const CelObjPic *>(cachedEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjPic in cache slot %d", cacheIndex);
+			error("Expected a CelObjPic in the cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1178,7 +1250,7 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 		}
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	putCopyInCache();
 }
 
 bool CelObjPic::analyzeUncompressedForSkip() const {
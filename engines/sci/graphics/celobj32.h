@@ -23,6 +23,8 @@
 #ifndef SCI_GRAPHICS_CELOBJ32_H
 #define SCI_GRAPHICS_CELOBJ32_H
 
+#include "common/hashmap.h"
+#include "common/list.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "sci/resource.h"
@@ -105,7 +107,7 @@ struct CelInfo32 {
 
 	// This is the equivalence criteria used by CelObj::searchCache in at least
 	// SSCI SQ6. Notably, it does not check the color field.
-	inline bool operator==(const CelInfo32 &other) {
+	inline bool operator==(const CelInfo32 &other) const {
 		return (
 			type == other.type &&
 			resourceId == other.resourceId &&
@@ -115,7 +117,7 @@ struct CelInfo32 {
 		);
 	}
 
-	inline bool operator!=(const CelInfo32 &other) {
+	inline bool operator!=(const CelInfo32 &other) const {
 		return !(*this == other);
 	}
 
@@ -138,18 +140,58 @@ struct CelInfo32 {
 	}
 };
 
+struct CelInfo32_Hash {
+	uint operator()(const CelInfo32 &x) const {
+		// Like the equivalence criteria, this does not use the color field
+		return (x.type << 28) ^ (x.resourceId << 12) ^ (x.loopNo << 6) ^ x.celNo ^
+			(x.bitmap.getSegment() << 16) ^ x.bitmap.getOffset();
+	}
+};
+
+class Console;
 class CelObj;
-struct CelCacheEntry {
+
+/**
+ * A cache of cel objects, which drops the least recently used cel once it is
+ * full. Cels are looked up by their CelInfo32.
+ */
+class CelCache {
+public:
+	explicit CelCache(uint maxSize);
+	~CelCache();
+
 	/**
-	 * A monotonically increasing cache ID used to identify the least recently
-	 * used item in the cache for replacement.
+	 * Returns the cel matching the given CelInfo32 and marks it as most
+	 * recently used, or returns null if it is not in the cache.
 	 */
-	int id;
-	Common::ScopedPtr<CelObj> celObj;
-	CelCacheEntry() : id(0) {}
-};
+	const CelObj *find(const CelInfo32 &celInfo);
+
+	/**
+	 * Puts a cel into the cache, which takes ownership of it. It must not be
+	 * in the cache already.
+	 */
+	void put(CelObj *celObj);
 
-typedef Common::Array<CelCacheEntry> CelCache;
+	void printDebugInfo(Console *con) const;
+
+private:
+	typedef Common::List<CelObj *> CelList;
+	typedef Common::HashMap<CelInfo32, CelList::iterator, CelInfo32_Hash> CelMap;
+
+	/**
+	 * The cached cels, most recently used first.
+	 */
+	CelList _cels;
+
+	/**
+	 * The position of each cached cel in `_cels`.
+	 */
+	CelMap _positions;
+
+	uint _maxSize;
+	uint _hits;
+	uint _misses;
+};
 
 #pragma mark -
 #pragma mark CelScaler
@@ -446,13 +488,13 @@ private:
 
 #pragma mark -
 #pragma mark CelObj - Caching
-protected:
+public:
 	/**
-	 * A monotonically increasing cache ID used to identify the least recently
-	 * used item in the cache for replacement.
+	 * Prints the size and the hit rate of the cel cache.
 	 */
-	static int _nextCacheId;
+	static void printCacheDebugInfo(Console *con);
 
+protected:
 	/**
 	 * A cache of cel objects used to avoid reinitialisation overhead for cels
 	 * with the same CelInfo32.
@@ -461,16 +503,14 @@ protected:
 
 	/**
 	 * Searches the cel cache for a CelObj matching the provided CelInfo32. If
-	 * not found, -1 is returned. `nextInsertIndex` will receive the index of
-	 * the oldest item in the cache, which can be used to replace the oldest
-	 * item with a newer item.
+	 * not found, null is returned.
 	 */
-	int searchCache(const CelInfo32 &celInfo, int *nextInsertIndex) const;
+	const CelObj *searchCache(const CelInfo32 &celInfo) const;
 
 	/**
-	 * Puts a copy of this CelObj into the cache at the given cache index.
+	 * Puts a copy of this CelObj into the cache.
 	 */
-	void putCopyInCache(int index) const;
+	void putCopyInCache() const;
 };
 
 #pragma mark -
@@ -20,6 +20,8 @@
  *
  */
 
+#include "common/algorithm.h"
+
 #include "sci/console.h"
 #include "sci/engine/features.h"
 #include "sci/engine/kernel.h"
@@ -314,6 +316,115 @@ void Plane::breakEraseListByPlanes(RectList &eraseList, const PlaneList &planeLi
 	eraseList.pack();
 }
 
+/**
+ * A uniform grid over the screen rects of the items of a plane. It finds the
+ * items which may intersect a rect without testing every item. The items are
+ * returned in list order, so draw lists are built in the same order as when
+ * testing every item.
+ */
+class ScreenItemGrid {
+public:
+	typedef Common::Array<ScreenItemList::size_type> IndexList;
+
+	ScreenItemGrid(const ScreenItemList &screenItemList, const ScreenItemList::size_type screenItemCount) :
+		_screenItemCount(screenItemCount),
+		_columns(0),
+		_rows(0),
+		_query(0) {
+
+		for (ScreenItemList::size_type i = 0; i < screenItemCount; ++i) {
+			const ScreenItem *item = screenItemList[i];
+			if (item != nullptr && !item->_screenRect.isEmpty()) {
+				if (_bounds.isEmpty()) {
+					_bounds = item->_screenRect;
+				} else {
+					_bounds.extend(item->_screenRect);
+				}
+			}
+		}
+
+		if (!_bounds.isEmpty()) {
+			_columns = (_bounds.width() + kCellSize - 1) / kCellSize;
+			_rows = (_bounds.height() + kCellSize - 1) / kCellSize;
+			_cells.resize(_columns * _rows);
+		}
+
+		for (ScreenItemList::size_type i = 0; i < screenItemCount; ++i) {
+			const ScreenItem *item = screenItemList[i];
+			if (item == nullptr) {
+				continue;
+			}
+
+			// Empty rects can still intersect others, as intersects() only
+			// compares the edges
+			const Common::Rect &rect = item->_screenRect;
+			if (rect.isEmpty()) {
+				_emptyItems.push_back(i);
+				continue;
+			}
+
+			for (int row = getRow(rect.top); row <= getRow(rect.bottom - 1); ++row) {
+				for (int column = getColumn(rect.left); column <= getColumn(rect.right - 1); ++column) {
+					_cells[row * _columns + column].push_back(i);
+				}
+			}
+		}
+
+		_lastQuery.resize(screenItemCount);
+	}
+
+	/**
+	 * Finds the indexes of the items which may intersect the given rect, in
+	 * ascending order.
+	 */
+	void findCandidates(const Common::Rect &rect, IndexList &candidates) {
+		candidates.clear();
+
+		if (rect.isEmpty()) {
+			for (ScreenItemList::size_type i = 0; i < _screenItemCount; ++i) {
+				candidates.push_back(i);
+			}
+			return;
+		}
+
+		++_query;
+		candidates = _emptyItems;
+
+		if (rect.intersects(_bounds)) {
+			const int lastRow = getRow(MIN(rect.bottom, _bounds.bottom) - 1);
+			const int lastColumn = getColumn(MIN(rect.right, _bounds.right) - 1);
+			for (int row = getRow(MAX(rect.top, _bounds.top)); row <= lastRow; ++row) {
+				for (int column = getColumn(MAX(rect.left, _bounds.left)); column <= lastColumn; ++column) {
+					const IndexList &cell = _cells[row * _columns + column];
+					for (IndexList::const_iterator it = cell.begin(); it != cell.end(); ++it) {
+						if (_lastQuery[*it] != _query) {
+							_lastQuery[*it] = _query;
+							candidates.push_back(*it);
+						}
+					}
+				}
+			}
+		}
+
+		Common::sort(candidates.begin(), candidates.end());
+	}
+
+private:
+	enum { kCellSize = 64 };
+
+	inline int getRow(const int16 y) const { return (y - _bounds.top) / kCellSize; }
+	inline int getColumn(const int16 x) const { return (x - _bounds.left) / kCellSize; }
+
+	ScreenItemList::size_type _screenItemCount;
+	Common::Rect _bounds;
+	int _columns;
+	int _rows;
+	Common::Array<IndexList> _cells;
+	IndexList _emptyItems;
+	Common::Array<uint> _lastQuery;
+	uint _query;
+};
+
 void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList &drawList, RectList &eraseList) {
 	const ScreenItemList::size_type screenItemCount = _screenItemList.size();
 	const ScreenItemList::size_type visiblePlaneItemCount = visiblePlane._screenItemList.size();
@@ -431,6 +542,10 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 	DrawList::size_type drawListSizePrimary = drawList.size();
 	const RectList::size_type eraseListCount = eraseList.size();
 
+	// The screen rects of the items do not change from here on
+	ScreenItemGrid grid(_screenItemList, MIN(screenItemCount, _screenItemList.size()));
+	ScreenItemGrid::IndexList candidates;
+
 	if (getSciVersion() == SCI_VERSION_3) {
 		_screenItemList.sort();
 		bool pictureDrawn = false;
@@ -478,8 +593,9 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 		// Add all items overlapping the erase list to the draw list
 		for (RectList::size_type i = 0; i < eraseListCount; ++i) {
 			const Common::Rect &rect = *eraseList[i];
-			for (ScreenItemList::size_type j = 0; j < screenItemCount; ++j) {
-				ScreenItem *item = _screenItemList[j];
+			grid.findCandidates(rect, candidates);
+			for (ScreenItemGrid::IndexList::const_iterator it = candidates.begin(); it != candidates.end(); ++it) {
+				ScreenItem *item = _screenItemList[*it];
 				if (
 					item != nullptr &&
 					!item->_created && !item->_updated && !item->_deleted &&
@@ -504,14 +620,17 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 				drawListEntry = drawList[i];
 			}
 
-			for (ScreenItemList::size_type j = 0; j < screenItemCount; ++j) {
-				ScreenItem *newItem = nullptr;
-				if (j < _screenItemList.size()) {
-					newItem = _screenItemList[j];
-				}
+			if (drawListEntry == nullptr) {
+				continue;
+			}
+
+			grid.findCandidates(drawListEntry->rect, candidates);
+			for (ScreenItemGrid::IndexList::const_iterator it = candidates.begin(); it != candidates.end(); ++it) {
+				const ScreenItemList::size_type j = *it;
+				ScreenItem *newItem = _screenItemList[j];
 
 				if (
-					drawListEntry != nullptr && newItem != nullptr &&
+					newItem != nullptr &&
 					!newItem->_created && !newItem->_updated && !newItem->_deleted
 				) {
 					const ScreenItem *drawnItem = drawListEntry->screenItem;
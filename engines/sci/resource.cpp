@@ -22,9 +22,11 @@
 
 // Resource library
 
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
+#include "common/profiler.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #ifdef ENABLE_SCI32
@@ -963,10 +965,15 @@ ResourceManager::ResourceManager(const bool detectionMode) :
 	_detectionMode(detectionMode) {}
 
 void ResourceManager::init() {
-	_maxMemoryLRU = 256 * 1024; // 256KiB
 	_memoryLocked = 0;
-	_memoryLRU = 0;
-	_LRU.clear();
+	_LRU.resources.clear();
+	_LRU.memory = 0;
+	_LRU.maxMemory = 256 * 1024; // 256KiB
+	for (int i = 0; i < kResourceTypeInvalid; i++) {
+		_typeLRU[i].resources.clear();
+		_typeLRU[i].memory = 0;
+		_typeLRU[i].maxMemory = 0;
+	}
 	_resMap.clear();
 	_audioMapSCI1 = NULL;
 #ifdef ENABLE_SCI32
@@ -1013,13 +1020,7 @@ void ResourceManager::init() {
 
 	debugC(1, kDebugLevelResMan, "resMan: Detected %s", getSciVersionDesc(getSciVersion()));
 
-	// Resources in SCI32 games are significantly larger than SCI16
-	// games and can cause immediate exhaustion of the LRU resource
-	// cache, leading to constant decompression of picture resources
-	// and making the renderer very slow.
-	if (getSciVersion() >= SCI_VERSION_2) {
-		_maxMemoryLRU = 4096 * 1024; // 4MiB
-	}
+	initLRUBudgets();
 
 	switch (_viewType) {
 	case kViewEga:
@@ -1062,13 +1063,49 @@ ResourceManager::~ResourceManager() {
 	}
 }
 
+void ResourceManager::initLRUBudgets() {
+	// Resources in SCI32 games are significantly larger than SCI16
+	// games and can cause immediate exhaustion of the LRU resource
+	// cache, leading to constant decompression of picture resources
+	// and making the renderer very slow.
+	if (getSciVersion() >= SCI_VERSION_2) {
+		_LRU.maxMemory = 4096 * 1024; // 4MiB
+	}
+
+	// Audio resources are large and rarely used twice in a row, so they get
+	// a budget of their own instead of pushing pics and views out
+	_typeLRU[kResourceTypeAudio].maxMemory = _LRU.maxMemory;
+	_typeLRU[kResourceTypeAudio36].maxMemory = _LRU.maxMemory;
+
+	if (_detectionMode)
+		return;
+
+	// The budgets can be set in KiB with "sci_cache_size", and with
+	// "sci_cache_size_<type>" for each resource type, e.g.
+	// "sci_cache_size_view". Resource types without a budget of their own
+	// share the first one.
+	if (ConfMan.hasKey("sci_cache_size"))
+		_LRU.maxMemory = ConfMan.getInt("sci_cache_size") * 1024;
+
+	for (int i = 0; i < kResourceTypeInvalid; i++) {
+		const Common::String key = Common::String::format("sci_cache_size_%s", getResourceTypeName((ResourceType)i));
+		if (ConfMan.hasKey(key))
+			_typeLRU[i].maxMemory = ConfMan.getInt(key) * 1024;
+	}
+}
+
+ResourceManager::LRUList &ResourceManager::getLRU(ResourceType type) {
+	return _typeLRU[type].maxMemory ? _typeLRU[type] : _LRU;
+}
+
 void ResourceManager::removeFromLRU(Resource *res) {
 	if (res->_status != kResStatusEnqueued) {
 		warning("resMan: trying to remove resource that isn't enqueued");
 		return;
 	}
-	_LRU.remove(res);
-	_memoryLRU -= res->size();
+	LRUList &lru = getLRU(res->getType());
+	lru.resources.erase(res->_lruPosition);
+	lru.memory -= res->size();
 	res->_status = kResStatusAllocated;
 }
 
@@ -1077,12 +1114,14 @@ void ResourceManager::addToLRU(Resource *res) {
 		warning("resMan: trying to enqueue resource with state %d", res->_status);
 		return;
 	}
-	_LRU.push_front(res);
-	_memoryLRU += res->size();
+	LRUList &lru = getLRU(res->getType());
+	lru.resources.push_front(res);
+	lru.memory += res->size();
+	res->_lruPosition = lru.resources.begin();
 #if SCI_VERBOSE_RESMAN
 	debug("Adding %s (%d bytes) to lru control: %d bytes total",
 	      res->_id.toString().c_str(), res->size,
-	      _memoryLRU);
+	      lru.memory);
 #endif
 	res->_status = kResStatusEnqueued;
 }
@@ -1090,24 +1129,37 @@ void ResourceManager::addToLRU(Resource *res) {
 void ResourceManager::printLRU() {
 	int mem = 0;
 	int entries = 0;
-	Common::List<Resource *>::iterator it = _LRU.begin();
-	Resource *res;
-
-	while (it != _LRU.end()) {
-		res = *it;
-		debug("\t%s: %u bytes", res->_id.toString().c_str(), res->size());
-		mem += res->size();
-		++entries;
-		++it;
+	int memoryLRU = 0;
+
+	for (int i = 0; i <= kResourceTypeInvalid; i++) {
+		const LRUList &lru = (i < kResourceTypeInvalid) ? _typeLRU[i] : _LRU;
+
+		for (Common::List<Resource *>::const_iterator it = lru.resources.begin(); it != lru.resources.end(); ++it) {
+			const Resource *res = *it;
+			debug("\t%s: %u bytes", res->_id.toString().c_str(), res->size());
+			mem += res->size();
+			++entries;
+		}
+
+		memoryLRU += lru.memory;
 	}
 
-	debug("Total: %d entries, %d bytes (mgr says %d)", entries, mem, _memoryLRU);
+	debug("Total: %d entries, %d bytes (mgr says %d)", entries, mem, memoryLRU);
 }
 
 void ResourceManager::freeOldResources() {
-	while (_maxMemoryLRU < _memoryLRU) {
-		assert(!_LRU.empty());
-		Resource *goner = _LRU.back();
+	freeOldResources(_LRU);
+
+	for (int i = 0; i < kResourceTypeInvalid; i++) {
+		if (_typeLRU[i].maxMemory)
+			freeOldResources(_typeLRU[i]);
+	}
+}
+
+void ResourceManager::freeOldResources(LRUList &lru) {
+	while (lru.maxMemory < lru.memory) {
+		assert(!lru.resources.empty());
+		Resource *goner = lru.resources.back();
 		removeFromLRU(goner);
 		goner->unalloc();
 #ifdef SCI_VERBOSE_RESMAN
@@ -1135,9 +1187,14 @@ Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	if (!retval)
 		return NULL;
 
-	if (retval->_status == kResStatusNoMalloc)
+	if (retval->_status == kResStatusNoMalloc) {
+		PROFILE_COUNT("resource cache misses", 1);
 		loadResource(retval);
-	else if (retval->_status == kResStatusEnqueued)
+	} else {
+		PROFILE_COUNT("resource cache hits", 1);
+	}
+
+	if (retval->_status == kResStatusEnqueued)
 		// The resource is removed from its current position
 		// in the LRU list because it has been requested
 		// again. Below, it will either be locked, or it
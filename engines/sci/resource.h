@@ -296,6 +296,7 @@ protected:
 	int32 _fileOffset; /**< Offset in file */
 	ResourceStatus _status;
 	uint16 _lockers; /**< Number of places where this resource was locked */
+	Common::List<Resource *>::iterator _lruPosition; /**< Position in its LRU list, while enqueued */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
 
@@ -468,18 +469,25 @@ public:
 protected:
 	bool _detectionMode;
 
-	// Maximum number of bytes to allow being allocated for resources
-	// Note: maxMemory will not be interpreted as a hard limit, only as a restriction
-	// for resources which are not explicitly locked. However, a warning will be
-	// issued whenever this limit is exceeded.
-	int _maxMemoryLRU;
+	/**
+	 * A Last Resource Used list, holding the resources which are loaded but
+	 * not locked, most recently used first.
+	 */
+	struct LRUList {
+		Common::List<Resource *> resources;
+		int memory;    ///< Amount of resource bytes in the list
+		// Maximum number of bytes to allow being allocated for the resources
+		// in the list. It is not a hard limit, only a restriction for
+		// resources which are not explicitly locked.
+		int maxMemory;
+	};
 
 	ViewType _viewType; // Used to determine if the game has EGA or VGA graphics
 	typedef Common::List<ResourceSource *> SourcesList;
 	SourcesList _sources;
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
-	int _memoryLRU;		///< Amount of resource bytes under LRU control
-	Common::List<Resource *> _LRU; ///< Last Resource Used list
+	LRUList _LRU;		///< LRU list of the resource types without a budget of their own
+	LRUList _typeLRU[kResourceTypeInvalid]; ///< LRU lists of the resource types with a budget of their own
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
 	ResourceSource *_audioMapSCI1; ///< Currently loaded audio map for SCI1
@@ -540,6 +548,7 @@ protected:
 	void disposeVolumeFileStream(Common::SeekableReadStream *fileStream, ResourceSource *source);
 	void loadResource(Resource *res);
 	void freeOldResources();
+	void freeOldResources(LRUList &lru);
 	bool validateResource(const ResourceId &resourceId, const Common::String &sourceMapLocation, const Common::String &sourceName, const uint32 offset, const uint32 size, const uint32 sourceSize) const;
 	Resource *addResource(ResourceId resId, ResourceSource *src, uint32 offset, uint32 size = 0, const Common::String &sourceMapLocation = Common::String("(no map location)"));
 	Resource *updateResource(ResourceId resId, ResourceSource *src, uint32 size, const Common::String &sourceMapLocation = Common::String("(no map location)"));
@@ -612,6 +621,8 @@ protected:
 	bool hasOldScriptHeader();
 
 	void printLRU();
+	void initLRUBudgets();
+	LRUList &getLRU(ResourceType type);
 	void addToLRU(Resource *res);
 	void removeFromLRU(Resource *res);
 
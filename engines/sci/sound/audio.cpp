@@ -357,7 +357,15 @@ Audio::RewindableAudioStream *AudioPlayer::getAudioStream(uint32 number, uint32
 	byte audioFlags;
 	uint32 audioCompressionType = audioRes->getAudioCompressionType();
 
-	if (audioCompressionType) {
+	// Sound effects are played over and over again, speech (audio36) is not
+	const bool cacheable = audioCompressionType && volume == 65535;
+	const Common::String cacheKey = Common::String::format("%u", number);
+	if (cacheable)
+		audioSeekStream = _decodedCache.find(cacheKey);
+
+	if (audioSeekStream) {
+		// Already decoded before
+	} else if (audioCompressionType) {
 #if (defined(USE_MAD) || defined(USE_VORBIS) || defined(USE_FLAC))
 		// Compressed audio made by our tool
 		byte *compressedData = (byte *)malloc(audioRes->size());
@@ -387,6 +395,9 @@ Audio::RewindableAudioStream *AudioPlayer::getAudioStream(uint32 number, uint32
 #endif
 			break;
 		}
+
+		if (cacheable)
+			audioSeekStream = _decodedCache.insert(cacheKey, audioSeekStream);
 #else
 		error("Compressed audio file encountered, but no appropriate decoder is compiled in");
 #endif
@@ -25,6 +25,7 @@
 #define SCI_AUDIO_H
 
 #include "sci/engine/vm_types.h"
+#include "audio/decodedcache.h"
 #include "audio/mixer.h"
 
 namespace Audio {
@@ -85,6 +86,12 @@ private:
 	uint32 _audioCdStart;
 	bool _wPlayFlag;
 	bool _initCD;
+
+	/**
+	 * Decoded sound effects from MP3/OGG/FLAC compressed resource files,
+	 * which would otherwise be decoded again whenever they are played
+	 */
+	Audio::DecodedAudioCache _decodedCache;
 };
 
 } // End of namespace Sci
@@ -703,30 +703,39 @@ bool Audio32::stopRobotAudio() {
 #pragma mark Playback
 
 uint16 Audio32::play(int16 channelIndex, const ResourceId resourceId, const bool autoPlay, const bool loop, const int16 volume, const reg_t soundNode, const bool monitor) {
-	Common::StackLock lock(_mutex);
+	{
+		Common::StackLock lock(_mutex);
 
-	freeUnusedChannels();
+		freeUnusedChannels();
 
-	if (channelIndex != kNoExistingChannel) {
-		AudioChannel &channel = getChannel(channelIndex);
-		MutableLoopAudioStream *stream = dynamic_cast<MutableLoopAudioStream *>(channel.stream.get());
-		if (stream == nullptr) {
-			error("[Audio32::play]: Unable to cast stream for resource %s", resourceId.toString().c_str());
-		}
+		if (channelIndex != kNoExistingChannel) {
+			AudioChannel &channel = getChannel(channelIndex);
+			MutableLoopAudioStream *stream = dynamic_cast<MutableLoopAudioStream *>(channel.stream.get());
+			if (stream == nullptr) {
+				error("[Audio32::play]: Unable to cast stream for resource %s", resourceId.toString().c_str());
+			}
 
-		if (channel.pausedAtTick) {
-			resume(channelIndex);
+			if (channel.pausedAtTick) {
+				resume(channelIndex);
+				return MIN(65534, 1 + stream->getLength().msecs() * 60 / 1000);
+			}
+
+			warning("Tried to resume channel %s that was not paused", channel.id.toString().c_str());
 			return MIN(65534, 1 + stream->getLength().msecs() * 60 / 1000);
 		}
 
-		warning("Tried to resume channel %s that was not paused", channel.id.toString().c_str());
-		return MIN(65534, 1 + stream->getLength().msecs() * 60 / 1000);
+		if (_numActiveChannels == _channels.size()) {
+			warning("Audio mixer is full when trying to play %s", resourceId.toString().c_str());
+			return 0;
+		}
 	}
 
-	if (_numActiveChannels == _channels.size()) {
-		warning("Audio mixer is full when trying to play %s", resourceId.toString().c_str());
-		return 0;
-	}
+	// The mutex is not held while the resource is loaded and its stream is
+	// set up, since loading may have to read from disk, and the audio thread
+	// would be stuck waiting for the mutex in the meantime instead of mixing
+	// the channels which are already playing. Channels are only ever added
+	// from the main thread, so the free channel found above is still free
+	// once the mutex is taken again.
 
 	// SSCI normally searches in this order:
 	//
@@ -770,21 +779,6 @@ uint16 Audio32::play(int16 channelIndex, const ResourceId resourceId, const bool
 		return 0;
 	}
 
-	channelIndex = _numActiveChannels++;
-
-	AudioChannel &channel = getChannel(channelIndex);
-	channel.id = resourceId;
-	channel.resource = resource;
-	channel.robot = false;
-	channel.fadeStartTick = 0;
-	channel.soundNode = soundNode;
-	channel.volume = volume < 0 || volume > kMaxVolume ? (int)kMaxVolume : volume;
-	channel.pan = -1;
-
-	if (monitor) {
-		_monitoredChannelIndex = channelIndex;
-	}
-
 	Common::SeekableReadStream *dataStream = resource->makeStream();
 
 	Audio::RewindableAudioStream *audioStream;
@@ -808,8 +802,8 @@ uint16 Audio32::play(int16 channelIndex, const ResourceId resourceId, const bool
 		audioStream = Audio::makeRawStream(dataStream, _globalSampleRate, flags, DisposeAfterUse::YES);
 	}
 
-	channel.stream.reset(new MutableLoopAudioStream(audioStream, loop));
-	channel.converter.reset(Audio::makeRateConverter(channel.stream->getRate(), getRate(), channel.stream->isStereo(), false));
+	MutableLoopAudioStream *stream = new MutableLoopAudioStream(audioStream, loop);
+	Audio::RateConverter *converter = Audio::makeRateConverter(stream->getRate(), getRate(), stream->isStereo(), false);
 
 	// SSCI sets up a decompression buffer here for the audio stream, plus
 	// writes information about the sample to the channel to convert to the
@@ -818,9 +812,23 @@ uint16 Audio32::play(int16 channelIndex, const ResourceId resourceId, const bool
 	// need to do any of these things since we use audio streams, and allocate
 	// and fill the monitoring buffer when reading audio data from the stream.
 
-	MutableLoopAudioStream *stream = dynamic_cast<MutableLoopAudioStream *>(channel.stream.get());
-	if (stream == nullptr) {
-		error("[Audio32::play]: Unable to cast stream for resource %s", resourceId.toString().c_str());
+	Common::StackLock lock(_mutex);
+
+	channelIndex = _numActiveChannels++;
+
+	AudioChannel &channel = getChannel(channelIndex);
+	channel.id = resourceId;
+	channel.resource = resource;
+	channel.robot = false;
+	channel.fadeStartTick = 0;
+	channel.soundNode = soundNode;
+	channel.volume = volume < 0 || volume > kMaxVolume ? (int)kMaxVolume : volume;
+	channel.pan = -1;
+	channel.stream.reset(stream);
+	channel.converter.reset(converter);
+
+	if (monitor) {
+		_monitoredChannelIndex = channelIndex;
 	}
 
 	channel.duration = /* round up */ 1 + (stream->getLength().msecs() * 60 / 1000);
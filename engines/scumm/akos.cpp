@@ -339,6 +339,8 @@ void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
 
+	_costume = costume;
+
 	akhd = (const AkosHeader *) _vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	akof = (const AkosOffset *) _vm->findResourceData(MKTAG('A','K','O','F'), akos);
 	akci = _vm->findResourceData(MKTAG('A','K','C','I'), akos);
@@ -1095,10 +1097,6 @@ void AkosRenderer::akos16SetupBitReader(const byte *src) {
 		_akos16.bits >>= (n);
 
 
-void AkosRenderer::akos16SkipData(int32 numbytes) {
-	akos16DecodeLine(0, numbytes, 0);
-}
-
 void AkosRenderer::akos16DecodeLine(byte *buf, int32 numbytes, int32 dir) {
 	uint16 bits, tmp_bits;
 
@@ -1145,6 +1143,34 @@ void AkosRenderer::akos16DecodeLine(byte *buf, int32 numbytes, int32 dir) {
 	}
 }
 
+const byte *AkosRenderer::akos16DecodeFrame() {
+	Akos16FrameKey key;
+	key.costume = _costume;
+	key.offset = _srcptr - akcd;
+
+	Akos16FrameCache::iterator it = _akos16Frames.find(key);
+	if (it != _akos16Frames.end())
+		return it->_value.begin();
+
+	// Keep the memory used by the decoded frames within bounds. The frames
+	// of the costumes on screen are quickly decoded again.
+	const uint32 size = _width * _height;
+	if (_akos16FramesSize + size > 1024 * 1024) {
+		_akos16Frames.clear();
+		_akos16FramesSize = 0;
+	}
+
+	Common::Array<byte> &frame = _akos16Frames[key];
+	frame.resize(size);
+	_akos16FramesSize += size;
+
+	// The frame data is one run of pixels, row by row
+	akos16SetupBitReader(_srcptr);
+	akos16DecodeLine(frame.begin(), size, 1);
+
+	return frame.begin();
+}
+
 void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir,
 		int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf) {
 	byte *tmp_buf = _akos16.buffer;
@@ -1157,11 +1183,7 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 		tmp_buf += (t_width - 1);
 	}
 
-	akos16SetupBitReader(src);
-
-	if (numskip_before != 0) {
-		akos16SkipData(numskip_before);
-	}
+	src += numskip_before;
 
 	maskpitch = _numStrips;
 
@@ -1170,14 +1192,17 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 	assert(t_height > 0);
 	assert(t_width > 0);
 	while (t_height--) {
-		akos16DecodeLine(tmp_buf, t_width, dir);
+		if (dir < 0) {
+			for (int32 i = 0; i < t_width; i++)
+				tmp_buf[-i] = src[i];
+		} else {
+			memcpy(tmp_buf, src, t_width);
+		}
 		bompApplyMask(_akos16.buffer, maskptr, maskbit, t_width, transparency);
 		bool HE7Check = (_vm->_game.heversion == 70);
 		bompApplyShadow(_shadow_mode, _shadow_table, _akos16.buffer, dest, t_width, transparency, HE7Check);
 
-		if (numskip_after != 0)	{
-			akos16SkipData(numskip_after);
-		}
+		src += t_width + numskip_after;
 		dest += pitch;
 		maskptr += maskpitch;
 	}
@@ -1290,7 +1315,7 @@ byte AkosRenderer::codec16(int xmoveCur, int ymoveCur) {
 
 	byte *dst = (byte *)_out.getBasePtr(width_unk, height_unk);
 
-	akos16Decompress(dst, _out.pitch, _srcptr, cur_x, out_height, dir, numskip_before, numskip_after, transparency, clip.left, clip.top, _zbuf);
+	akos16Decompress(dst, _out.pitch, akos16DecodeFrame(), cur_x, out_height, dir, numskip_before, numskip_after, transparency, clip.left, clip.top, _zbuf);
 	return 0;
 }
 
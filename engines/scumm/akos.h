@@ -23,6 +23,9 @@
 #ifndef SCUMM_AKOS_H
 #define SCUMM_AKOS_H
 
+#include "common/array.h"
+#include "common/hashmap.h"
+
 #include "scumm/base-costume.h"
 
 namespace Scumm {
@@ -55,6 +58,7 @@ protected:
 class AkosRenderer : public BaseCostumeRenderer {
 protected:
 	uint16 _codec;
+	int _costume;
 
 	// actor _palette
 	uint16 _palette[256];
@@ -85,9 +89,34 @@ protected:
 		byte buffer[336];
 	} _akos16;
 
+	// Frames decoded by codec16, so that drawing them again does not need
+	// to run the bit reader. They are identified by the costume and the
+	// offset of their data in the costume, which do not change.
+	struct Akos16FrameKey {
+		int costume;
+		uint32 offset;
+
+		bool operator==(const Akos16FrameKey &other) const {
+			return costume == other.costume && offset == other.offset;
+		}
+	};
+
+	struct Akos16FrameKey_Hash {
+		uint operator()(const Akos16FrameKey &key) const {
+			return key.costume * 31 + key.offset;
+		}
+	};
+
+	typedef Common::HashMap<Akos16FrameKey, Common::Array<byte>, Akos16FrameKey_Hash> Akos16FrameCache;
+
+	Akos16FrameCache _akos16Frames;
+	uint32 _akos16FramesSize;
+
 public:
 	AkosRenderer(ScummEngine *scumm) : BaseCostumeRenderer(scumm) {
 		_useBompPalette = false;
+		_costume = 0;
+		_akos16FramesSize = 0;
 		akhd = 0;
 		akpl = 0;
 		akci = 0;
@@ -117,8 +146,8 @@ protected:
 	byte codec16(int xmoveCur, int ymoveCur);
 	byte codec32(int xmoveCur, int ymoveCur);
 	void akos16SetupBitReader(const byte *src);
-	void akos16SkipData(int32 numskip);
 	void akos16DecodeLine(byte *buf, int32 numbytes, int32 dir);
+	const byte *akos16DecodeFrame();
 	void akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir, int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf);
 
 	void markRectAsDirty(Common::Rect rect);
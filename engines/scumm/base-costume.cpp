@@ -21,6 +21,8 @@
  */
 
 
+#include "common/profiler.h"
+
 #include "scumm/base-costume.h"
 #include "scumm/costume.h"
 
@@ -30,6 +32,8 @@ byte BaseCostumeRenderer::drawCostume(const VirtScreen &vs, int numStrips, const
 	int i;
 	byte result = 0;
 
+	PROFILE_COUNT("sprites drawn", 1);
+
 	_out = vs;
 	if (drawToBackBuf)
 		_out.setPixels(vs.getBackPixels(0, 0));
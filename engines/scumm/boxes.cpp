@@ -571,7 +571,47 @@ bool ScummEngine::checkXYInBoxBounds(int boxnum, int x, int y) {
 	return true;
 }
 
+void ScummEngine::invalidateBoxCache() {
+	_boxCacheValid = false;
+}
+
+void ScummEngine::updateBoxCache() {
+	if (_boxCacheValid)
+		return;
+
+	_boxCacheValid = true;
+	_boxCoordsCache.clear();
+	_boxMatrixRows.clear();
+
+	const int numOfBoxes = getNumBoxes();
+	for (int i = 0; i < numOfBoxes; i++)
+		_boxCoordsCache.push_back(decodeBoxCoordinates(i));
+
+	// Rows of the box matrix are skipped the same way getNextBox() did
+	if (_game.version >= 3 && getResourceAddress(rtMatrix, 1)) {
+		const byte *start = getBoxMatrixBaseAddr();
+		const byte *end = start + getResourceSize(rtMatrix, 1);
+		const byte *boxm = start;
+
+		for (int i = 0; i < numOfBoxes && boxm < end; i++) {
+			_boxMatrixRows.push_back(boxm - start);
+			while (boxm < end && *boxm != 0xFF)
+				boxm += 3;
+			boxm++;
+		}
+	}
+}
+
 BoxCoords ScummEngine::getBoxCoordinates(int boxnum) {
+	updateBoxCache();
+	if (boxnum >= 0 && boxnum < (int)_boxCoordsCache.size())
+		return _boxCoordsCache[boxnum];
+
+	// Out of range boxes are handled by the workarounds in getBoxBaseAddr()
+	return decodeBoxCoordinates(boxnum);
+}
+
+BoxCoords ScummEngine::decodeBoxCoordinates(int boxnum) {
 	BoxCoords tmp, *box = &tmp;
 	Box *bp = getBoxBaseAddr(boxnum);
 	assert(bp);
@@ -774,10 +814,15 @@ int ScummEngine::getNextBox(byte from, byte to) {
 		return 0;
 
 	// Skip up to the matrix data for box 'from'
-	for (i = 0; i < from && boxm < end; i++) {
-		while (boxm < end && *boxm != 0xFF)
-			boxm += 3;
-		boxm++;
+	updateBoxCache();
+	if (from < _boxMatrixRows.size()) {
+		boxm += _boxMatrixRows[from];
+	} else {
+		for (i = 0; i < from && boxm < end; i++) {
+			while (boxm < end && *boxm != 0xFF)
+				boxm += 3;
+			boxm++;
+		}
 	}
 
 	// Now search for the entry for box 'to'
@@ -1063,6 +1108,7 @@ void ScummEngine::createBoxMatrix() {
 	}
 	addToMatrix(0xFF);
 
+	invalidateBoxCache();
 
 #if BOX_DEBUG
 	debug("Itinerary matrix:\n");
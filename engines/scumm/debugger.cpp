@@ -37,6 +37,8 @@
 
 namespace Scumm {
 
+extern const char *nameOfResType(ResType type);
+
 void debugC(int channel, const char *s, ...) {
 	char buf[STRINGBUFLEN];
 	va_list va;
@@ -79,6 +81,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("scr",       WRAP_METHOD(ScummDebugger, Cmd_Script));
 	registerCmd("scripts",   WRAP_METHOD(ScummDebugger, Cmd_PrintScript));
 	registerCmd("importres", WRAP_METHOD(ScummDebugger, Cmd_ImportRes));
+	registerCmd("resources", WRAP_METHOD(ScummDebugger, Cmd_PrintResources));
 
 	if (_vm->_game.id == GID_LOOM)
 		registerCmd("drafts",  WRAP_METHOD(ScummDebugger, Cmd_PrintDraft));
@@ -322,6 +325,38 @@ bool ScummDebugger::Cmd_ImportRes(int argc, const char** argv) {
 	return true;
 }
 
+bool ScummDebugger::Cmd_PrintResources(int argc, const char **argv) {
+	ResourceManager *res = _vm->_res;
+
+	debugPrintf("+--------------+-------------+------------+-------------+------------+\n");
+	debugPrintf("| Type         |      Loaded |      Bytes |      Locked |   Off heap |\n");
+	debugPrintf("+--------------+-------------+------------+-------------+------------+\n");
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		const ResourceManager::ResTypeData &data = res->_types[type];
+		uint loaded = 0, locked = 0, offHeap = 0;
+		uint32 size = 0;
+		for (ResId idx = 0; idx < data.size(); ++idx) {
+			const ResourceManager::Resource &r = data[idx];
+			if (!r._address)
+				continue;
+			++loaded;
+			size += r._size;
+			if (r.isLocked())
+				++locked;
+			if (r.isOffHeap())
+				++offHeap;
+		}
+		if (data.empty())
+			continue;
+		debugPrintf("| %-12s | %5d/%5d | %10d | %11d | %10d |\n", nameOfResType(type), loaded, data.size(), size, locked, offHeap);
+	}
+	debugPrintf("+--------------+-------------+------------+-------------+------------+\n");
+	debugPrintf("Allocated %d bytes, expiring from %d down to %d bytes\n",
+		res->getAllocatedSize(), res->getMaxHeapThreshold(), res->getMinHeapThreshold());
+
+	return true;
+}
+
 bool ScummDebugger::Cmd_PrintScript(int argc, const char **argv) {
 	int i;
 	ScriptSlot *ss = _vm->vm.slot;
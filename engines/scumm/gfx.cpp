@@ -46,6 +46,16 @@ extern "C" void asmDrawStripToScreen(int height, int width, void const* text, vo
 extern "C" void asmCopy8Col(byte* dst, int dstPitch, const byte* src, int height, uint8 bitDepth);
 #endif /* USE_ARM_GFX_ASM */
 
+// Text is composited over the game graphics sixteen pixels at a time with
+// SSE2 or NEON, where available.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCUMM_GFX_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SCUMM_GFX_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace Scumm {
 
 static void blit(byte *dst, int dstPitch, const byte *src, int srcPitch, int w, int h, uint8 bitDepth);
@@ -214,7 +224,11 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_vertStripNextInc = 0;
 	_zbufferDisabled = false;
 	_objectMode = false;
+	_backgroundMode = false;
 	_distaff = false;
+
+	_bgStrips.smap = 0;
+	_bgStrips.height = 0;
 }
 
 Gdi::~Gdi() {
@@ -275,6 +289,7 @@ void Gdi::init() {
 }
 
 void Gdi::roomChanged(byte *roomptr) {
+	_bgStrips.smap = 0;
 }
 
 void GdiNES::roomChanged(byte *roomptr) {
@@ -580,16 +595,24 @@ void ScummEngine::updateDirtyScreen(VirtScreenNumber slot) {
 
 	for (i = 0; i < _gdi->_numStrips; i++) {
 		if (vs->bdirty[i]) {
-			const int top = vs->tdirty[i];
-			const int bottom = vs->bdirty[i];
+			int top = vs->tdirty[i];
+			int bottom = vs->bdirty[i];
 			vs->tdirty[i] = vs->h;
 			vs->bdirty[i] = 0;
-			if (i != (_gdi->_numStrips - 1) && vs->bdirty[i + 1] == bottom && vs->tdirty[i + 1] == top) {
-				// Simple optimizations: if two or more neighboring strips
-				// form one bigger rectangle, coalesce them.
+
+			// Simple optimization: if the dirty areas of two or more
+			// neighboring strips overlap, coalesce them into one bigger
+			// rectangle. This redraws a few clean pixels, but hands fewer
+			// and larger rectangles to the backend.
+			while (i != (_gdi->_numStrips - 1) && vs->bdirty[i + 1] > top && vs->tdirty[i + 1] < bottom) {
+				++i;
+				top = MIN<int>(top, vs->tdirty[i]);
+				bottom = MAX<int>(bottom, vs->bdirty[i]);
+				vs->tdirty[i] = vs->h;
+				vs->bdirty[i] = 0;
 				w += 8;
-				continue;
 			}
+
 			drawStripToScreen(vs, start * 8, w, top, bottom);
 			w = 8;
 		}
@@ -597,6 +620,74 @@ void ScummEngine::updateDirtyScreen(VirtScreenNumber slot) {
 	}
 }
 
+#ifndef USE_ARM_GFX_ASM
+/**
+ * Composite a row of 8-bit text pixels over the game graphics. Text pixels
+ * with the value CHARSET_MASK_TRANSPARENCY let the game graphics through.
+ * The width must be a multiple of four.
+ */
+static void compositeTextRow8(byte *dst, const byte *src, const byte *text, int width) {
+	int w = 0;
+
+#if defined(SCUMM_GFX_USE_SSE2)
+	const __m128i transparency = _mm_set1_epi8((char)CHARSET_MASK_TRANSPARENCY);
+	for (; w + 16 <= width; w += 16) {
+		const __m128i textPixels = _mm_loadu_si128((const __m128i *)(text + w));
+		const __m128i srcPixels = _mm_loadu_si128((const __m128i *)(src + w));
+		const __m128i mask = _mm_cmpeq_epi8(textPixels, transparency);
+		_mm_storeu_si128((__m128i *)(dst + w), _mm_or_si128(_mm_and_si128(mask, srcPixels), _mm_andnot_si128(mask, textPixels)));
+	}
+#elif defined(SCUMM_GFX_USE_NEON)
+	const uint8x16_t transparency = vdupq_n_u8(CHARSET_MASK_TRANSPARENCY);
+	for (; w + 16 <= width; w += 16) {
+		const uint8x16_t textPixels = vld1q_u8(text + w);
+		vst1q_u8(dst + w, vbslq_u8(vceqq_u8(textPixels, transparency), vld1q_u8(src + w), textPixels));
+	}
+#endif
+
+	// We blit four pixels at a time, for improved performance.
+	const uint32 *src32 = (const uint32 *)(src + w);
+	const uint32 *text32 = (const uint32 *)(text + w);
+	uint32 *dst32 = (uint32 *)(dst + w);
+	for (; w < width; w += 4) {
+		uint32 temp = *text32++;
+
+		// Generate a byte mask for those text pixels (bytes) with
+		// value CHARSET_MASK_TRANSPARENCY. In the end, each byte
+		// in mask will be either equal to 0x00 or 0xFF.
+		// Doing it this way avoids branches and bytewise operations,
+		// at the cost of readability ;).
+		uint32 mask = temp ^ CHARSET_MASK_TRANSPARENCY_32;
+		mask = (((mask & 0x7f7f7f7f) + 0x7f7f7f7f) | mask) & 0x80808080;
+		mask = ((mask >> 7) + 0x7f7f7f7f) ^ 0x80808080;
+
+		// The following line is equivalent to this code:
+		//   *dst32++ = (*src32++ & mask) | (temp & ~mask);
+		// However, some compilers can generate somewhat better
+		// machine code for this equivalent statement:
+		*dst32++ = ((temp ^ *src32++) & mask) ^ temp;
+	}
+}
+#endif
+
+/**
+ * Check whether sixteen text pixels all have the value
+ * CHARSET_MASK_TRANSPARENCY, i.e. no text is drawn there.
+ */
+static inline bool isTextTransparent16(const byte *text) {
+#if defined(SCUMM_GFX_USE_SSE2)
+	const __m128i mask = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)text), _mm_set1_epi8((char)CHARSET_MASK_TRANSPARENCY));
+	return _mm_movemask_epi8(mask) == 0xFFFF;
+#elif defined(SCUMM_GFX_USE_NEON)
+	const uint8x16_t mask = vceqq_u8(vld1q_u8(text), vdupq_n_u8(CHARSET_MASK_TRANSPARENCY));
+	const uint8x8_t halves = vand_u8(vget_low_u8(mask), vget_high_u8(mask));
+	return vget_lane_u64(vreinterpret_u64_u8(halves), 0) == 0xFFFFFFFFFFFFFFFFULL;
+#else
+	return READ_UINT32(text) == CHARSET_MASK_TRANSPARENCY_32 && READ_UINT32(text + 4) == CHARSET_MASK_TRANSPARENCY_32 &&
+		READ_UINT32(text + 8) == CHARSET_MASK_TRANSPARENCY_32 && READ_UINT32(text + 12) == CHARSET_MASK_TRANSPARENCY_32;
+#endif
+}
+
 /**
  * Blit the specified rectangle from the given virtual screen to the display.
  * Note: t and b are in *virtual screen* coordinates, while x is relative to
@@ -667,6 +758,17 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 
 			for (int h = 0; h < height * m; ++h) {
 				for (int w = 0; w < width * m; ++w) {
+					// Where no text is drawn, the game graphics are copied
+					// as they are
+					if (vs->format.bytesPerPixel == 2 && (w & 15) == 0 && w + 16 <= width * m && isTextTransparent16(textPtr)) {
+						memcpy(dstPtr, srcPtr, 16 * 2);
+						dstPtr += 16 * 2;
+						srcPtr += 16 * 2;
+						textPtr += 16;
+						w += 15;
+						continue;
+					}
+
 					uint16 tmp = *textPtr++;
 					if (tmp == CHARSET_MASK_TRANSPARENCY) {
 						tmp = READ_UINT16(srcPtr);
@@ -685,35 +787,15 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 #ifdef USE_ARM_GFX_ASM
 			asmDrawStripToScreen(height, width, text, src, _compositeBuf, vs->pitch, width, _textSurface.pitch);
 #else
-			// We blit four pixels at a time, for improved performance.
-			const uint32 *src32 = (const uint32 *)src;
-			uint32 *dst32 = (uint32 *)_compositeBuf;
-
-			vsPitch >>= 2;
+			const byte *srcPtr = (const byte *)src;
+			const byte *textPtr = (const byte *)text;
+			byte *dstPtr = _compositeBuf;
 
-			const uint32 *text32 = (const uint32 *)text;
-			const int textPitch = (_textSurface.pitch - width * m) >> 2;
 			for (int h = height * m; h > 0; --h) {
-				for (int w = width * m; w > 0; w -= 4) {
-					uint32 temp = *text32++;
-
-					// Generate a byte mask for those text pixels (bytes) with
-					// value CHARSET_MASK_TRANSPARENCY. In the end, each byte
-					// in mask will be either equal to 0x00 or 0xFF.
-					// Doing it this way avoids branches and bytewise operations,
-					// at the cost of readability ;).
-					uint32 mask = temp ^ CHARSET_MASK_TRANSPARENCY_32;
-					mask = (((mask & 0x7f7f7f7f) + 0x7f7f7f7f) | mask) & 0x80808080;
-					mask = ((mask >> 7) + 0x7f7f7f7f) ^ 0x80808080;
-
-					// The following line is equivalent to this code:
-					//   *dst32++ = (*src32++ & mask) | (temp & ~mask);
-					// However, some compilers can generate somewhat better
-					// machine code for this equivalent statement:
-					*dst32++ = ((temp ^ *src32++) & mask) ^ temp;
-				}
-				src32 += vsPitch;
-				text32 += textPitch;
+				compositeTextRow8(dstPtr, srcPtr, textPtr, width * m);
+				dstPtr += width * m;
+				srcPtr += width * m + vsPitch;
+				textPtr += _textSurface.pitch;
 			}
 #endif
 		}
@@ -1008,7 +1090,7 @@ void ScummEngine::redrawBGStrip(int start, int num) {
 	else
 		room = getResourceAddress(rtRoom, _roomResource);
 
-	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, 0);
+	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, Gdi::dbBackground);
 }
 
 void ScummEngine::restoreBackground(Common::Rect rect, byte backColor) {
@@ -1793,6 +1875,7 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	_vertStripNextInc = height * vs->pitch - 1 * vs->format.bytesPerPixel;
 
 	_objectMode = (flag & dbObjectMode) == dbObjectMode;
+	_backgroundMode = (flag & dbBackground) != 0;
 	prepareDrawBitmap(ptr, vs, x, y, width, height, stripnr, numstrip);
 
 	sx = x - vs->xstart / 8;
@@ -1908,6 +1991,9 @@ bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width,
 			_roomPalette = _vm->_roomPalette;
 	}
 
+	if (_backgroundMode && vs->number == kMainVirtScreen && vs->format.bytesPerPixel == 1 && y == 0)
+		return decompressBackgroundStrip(dstPtr, vs->pitch, stripnr, smap_ptr, smap_ptr + offset, height);
+
 	return decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
 }
 
@@ -2422,6 +2508,50 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	return transpStrip;
 }
 
+bool Gdi::decompressBackgroundStrip(byte *dst, int dstPitch, int stripnr, const byte *smap_ptr, const byte *src, int numLinesToProcess) {
+	// The decompressed pixels also depend on the room palette, which scripts
+	// may change while the room is shown
+	if (_bgStrips.smap != smap_ptr || _bgStrips.height != numLinesToProcess || memcmp(_bgStrips.palette, _roomPalette, sizeof(_bgStrips.palette))) {
+		_bgStrips.smap = smap_ptr;
+		_bgStrips.height = numLinesToProcess;
+		memcpy(_bgStrips.palette, _roomPalette, sizeof(_bgStrips.palette));
+		_bgStrips.states.clear();
+		_bgStrips.pixels.clear();
+	}
+
+	if (stripnr >= (int)_bgStrips.states.size()) {
+		_bgStrips.states.resize(stripnr + 1);
+		_bgStrips.pixels.resize((stripnr + 1) * 8 * numLinesToProcess);
+	}
+
+	byte &state = _bgStrips.states[stripnr];
+	byte *pixels = &_bgStrips.pixels[stripnr * 8 * numLinesToProcess];
+
+	if (state == kStripNotDecoded) {
+		// The vertical decoders step back to the top of the next column by
+		// _vertStripNextInc, which has to match the pitch of the cache
+		const uint32 vertStripNextInc = _vertStripNextInc;
+		_vertStripNextInc = numLinesToProcess * 8 - 1;
+		const bool transpStrip = decompressBitmap(pixels, 8, src, numLinesToProcess);
+		_vertStripNextInc = vertStripNextInc;
+
+		// Transparent pixels keep what was drawn before, so such strips
+		// cannot be copied from the cache
+		state = transpStrip ? kStripTransparent : kStripDecoded;
+	}
+
+	if (state == kStripTransparent)
+		return decompressBitmap(dst, dstPitch, src, numLinesToProcess);
+
+	for (int h = 0; h < numLinesToProcess; ++h) {
+		memcpy(dst, pixels, 8);
+		dst += dstPitch;
+		pixels += 8;
+	}
+
+	return false;
+}
+
 void Gdi::decompressMaskImg(byte *dst, const byte *src, int height) const {
 	byte b, c;
 
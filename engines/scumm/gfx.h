@@ -24,6 +24,7 @@
 #define SCUMM_GFX_H
 
 #include "common/system.h"
+#include "common/array.h"
 #include "common/list.h"
 
 #include "graphics/surface.h"
@@ -197,6 +198,28 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/** Flag which is true when the room background is being rendered, false otherwise. */
+	bool _backgroundMode;
+
+	enum BackgroundStripState {
+		kStripNotDecoded = 0,
+		kStripDecoded,
+		kStripTransparent
+	};
+
+	/**
+	 * The strips of the room background, as decompressed by
+	 * decompressBitmap(). Each strip is decompressed the first time it is
+	 * drawn, and only copied when it is drawn again, e.g. while scrolling.
+	 */
+	struct {
+		const byte *smap;
+		int height;
+		byte palette[256];
+		Common::Array<byte> states;
+		Common::Array<byte> pixels;
+	} _bgStrips;
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -208,6 +231,7 @@ public:
 protected:
 	/* Bitmap decompressors */
 	bool decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLinesToProcess);
+	bool decompressBackgroundStrip(byte *dst, int dstPitch, int stripnr, const byte *smap_ptr, const byte *src, int numLinesToProcess);
 
 	void drawStripEGA(byte *dst, int dstPitch, const byte *src, int height) const;
 
@@ -270,7 +294,8 @@ public:
 	enum DrawBitmapFlags {
 		dbAllowMaskOr   = 1 << 0,
 		dbDrawMaskOnAll = 1 << 1,
-		dbObjectMode    = 2 << 2
+		dbObjectMode    = 2 << 2,
+		dbBackground    = 1 << 4
 	};
 };
 
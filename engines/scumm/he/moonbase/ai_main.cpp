@@ -164,6 +164,7 @@ AI::AI(ScummEngine_v100he *vm) : _vm(vm) {
 
 void AI::resetAI() {
 	_aiState = STATE_CHOOSE_BEHAVIOR;
+	clearQueryCaches();
 	debugC(DEBUG_MOONBASE_AI, "----------------------> Resetting AI");
 
 	for (int i = 1; i != 5; i++) {
@@ -315,6 +316,9 @@ int AI::masterControlProgram(const int paramCount, const int32 *params) {
 
 	switch (_aiState) {
 	case STATE_CHOOSE_BEHAVIOR:
+		// Units may have moved since the last turn
+		clearQueryCaches();
+
 		_behavior = chooseBehavior();
 		debugC(DEBUG_MOONBASE_AI, "Behavior mode: %d", _behavior);
 
@@ -2412,7 +2416,13 @@ int AI::getClosestUnit(int x, int y, int radius, int player, int alignment, int
 }
 
 int AI::getDistance(int originX, int originY, int endX, int endY) {
+	AIDistanceKey key(originX, originY, endX, endY);
+	Common::HashMap<AIDistanceKey, int, AIDistanceKey_Hash>::const_iterator i = _distanceCache.find(key);
+	if (i != _distanceCache.end())
+		return i->_value;
+
 	int retVal = _vm->_moonbase->callScummFunction(_mcpParams[F_GET_WORLD_DIST], 4, originX, originY, endX, endY);
+	_distanceCache[key] = retVal;
 	return retVal;
 }
 
@@ -2427,7 +2437,18 @@ int AI::calcAngle(int originX, int originY, int endX, int endY, int noWrapFlag)
 }
 
 int AI::getTerrain(int x, int y) {
+	// Only coordinates which fit into the key are cached
+	const bool cacheable = (x >= 0 && x <= 0xFFFF && y >= 0 && y <= 0xFFFF);
+	const uint32 key = ((uint32)x << 16) | (uint32)y;
+	if (cacheable) {
+		Common::HashMap<uint32, int>::const_iterator i = _terrainCache.find(key);
+		if (i != _terrainCache.end())
+			return i->_value;
+	}
+
 	int retVal = _vm->_moonbase->callScummFunction(_mcpParams[F_GET_TERRAIN_TYPE], 2, x, y);
+	if (cacheable)
+		_terrainCache[key] = retVal;
 	return retVal;
 }
 
@@ -2744,6 +2765,11 @@ void AI::limitLocation(int &a, int &b, int c, int d) {
 	}
 }
 
+void AI::clearQueryCaches() {
+	_distanceCache.clear();
+	_terrainCache.clear();
+}
+
 int AI::energyPoolSize(int pool) {
 	int width = getEnergyPoolWidth(pool);
 
@@ -24,6 +24,7 @@
 #define SCUMM_HE_MOONBASE_AI_MAIN_H
 
 #include "common/array.h"
+#include "common/hashmap.h"
 #include "scumm/he/moonbase/ai_tree.h"
 
 namespace Scumm {
@@ -83,6 +84,22 @@ enum {
 	MIN_DIST = 108
 };
 
+struct AIDistanceKey {
+	int originX, originY, endX, endY;
+
+	AIDistanceKey(int ox, int oy, int ex, int ey) : originX(ox), originY(oy), endX(ex), endY(ey) {}
+
+	bool operator==(const AIDistanceKey &other) const {
+		return originX == other.originX && originY == other.originY && endX == other.endX && endY == other.endY;
+	}
+};
+
+struct AIDistanceKey_Hash {
+	uint operator()(const AIDistanceKey &key) const {
+		return (uint)key.originX * 73856093 ^ (uint)key.originY * 19349663 ^ (uint)key.endX * 83492791 ^ (uint)key.endY;
+	}
+};
+
 class AI {
 public:
 	AI(ScummEngine_v100he *vm);
@@ -186,6 +203,7 @@ private:
 	int getEnemyUnitsVisible(int playerNum);
 
 	void limitLocation(int &a, int &b, int c, int d);
+	void clearQueryCaches();
 	int energyPoolSize(int pool);
 	int getMaxCollectors(int pool);
 
@@ -204,6 +222,15 @@ public:
 	patternList *_moveList[5];
 
 	const int32 *_mcpParams;
+
+private:
+	/**
+	 * Results of the distance and terrain queries, which the searches ask
+	 * for the same points over and over. Each query runs a script, so they
+	 * are kept for the turn of the current player.
+	 */
+	Common::HashMap<AIDistanceKey, int, AIDistanceKey_Hash> _distanceCache;
+	Common::HashMap<uint32, int> _terrainCache;
 };
 
 } // End of namespace Scumm
@@ -121,9 +121,19 @@ Tree::~Tree() {
 		}
 	}
 
+	for (Common::SortedArray<TreeNode *>::iterator i = _currentMap->begin(); i != _currentMap->end(); ++i)
+		_treeNodePool.deleteChunk(*i);
 	delete _currentMap;
 }
 
+Node *Tree::popTreeNode(Common::SortedArray<TreeNode *> &openList) {
+	TreeNode *treeNode = openList.front();
+	Node *node = treeNode->node;
+	openList.erase(openList.begin());
+	_treeNodePool.deleteChunk(treeNode);
+	return node;
+}
+
 Node *Tree::aStarSearch() {
 	Common::SortedArray<TreeNode *> mmfpOpen(compareTreeNodes);
 
@@ -135,11 +145,10 @@ Node *Tree::aStarSearch() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		mmfpOpen.insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		mmfpOpen.insert(newTreeNode(pBaseNode->getObjectT(), pBaseNode));
 
 		while (mmfpOpen.size() && (retNode == NULL)) {
-			currentNode = mmfpOpen.front()->node;
-			mmfpOpen.erase(mmfpOpen.begin());
+			currentNode = popTreeNode(mmfpOpen);
 
 			if ((currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes)) {
 				// Generate nodes
@@ -152,7 +161,7 @@ Node *Tree::aStarSearch() {
 					if (currentT == SUCCESS)
 						retNode = *i;
 					else
-						mmfpOpen.insert(new TreeNode(currentT, (*i)));
+						mmfpOpen.insert(newTreeNode(currentT, (*i)));
 				}
 			} else {
 				retNode = currentNode;
@@ -162,6 +171,9 @@ Node *Tree::aStarSearch() {
 		retNode = pBaseNode;
 	}
 
+	while (mmfpOpen.size())
+		popTreeNode(mmfpOpen);
+
 	return retNode;
 }
 
@@ -174,7 +186,7 @@ Node *Tree::aStarSearch_singlePassInit() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		_currentMap->insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		_currentMap->insert(newTreeNode(pBaseNode->getObjectT(), pBaseNode));
 	} else {
 		retNode = pBaseNode;
 	}
@@ -198,8 +210,7 @@ Node *Tree::aStarSearch_singlePass() {
 			return retNode;
 		}
 
-		_currentNode = _currentMap->front()->node;
-		_currentMap->erase(_currentMap->begin());
+		_currentNode = popTreeNode(*_currentMap);
 	}
 
 	if ((_currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes) && ((!maxTime) || (_ai->getTimerValue(3) < maxTime))) {
@@ -222,7 +233,7 @@ Node *Tree::aStarSearch_singlePass() {
 					retNode = *i;
 					i = vChildren.end() - 1;
 				} else {
-					_currentMap->insert(new TreeNode(currentT, (*i)));
+					_currentMap->insert(newTreeNode(currentT, (*i)));
 				}
 			}
 
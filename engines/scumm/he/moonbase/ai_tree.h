@@ -24,6 +24,7 @@
 #define SCUMM_HE_MOONBASE_AI_TREE_H
 
 #include "common/array.h"
+#include "common/memorypool.h"
 #include "scumm/he/moonbase/ai_node.h"
 
 namespace Scumm {
@@ -52,6 +53,12 @@ private:
 	Common::SortedArray<TreeNode *> *_currentMap;
 	Node *_currentNode;
 
+	/** The entries of the open lists, which come and go at a high rate */
+	Common::ObjectPool<TreeNode> _treeNodePool;
+
+	TreeNode *newTreeNode(float value, Node *node) { return new (_treeNodePool) TreeNode(value, node); }
+	Node *popTreeNode(Common::SortedArray<TreeNode *> &openList);
+
 	AI *_ai;
 
 public:
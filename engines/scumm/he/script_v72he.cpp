@@ -151,15 +151,18 @@ byte *ScummEngine_v72he::defineArray(int array, int type, int dim2start, int dim
 }
 
 int ScummEngine_v72he::readArray(int array, int idx2, int idx1) {
-	debug(9, "readArray (array %d, idx2 %d, idx1 %d)", readVar(array), idx2, idx1);
+	// Array accesses are among the most frequent operations of HE scripts,
+	// so the variable holding the array is only read once.
+	const int arrayId = readVar(array);
+	debug(9, "readArray (array %d, idx2 %d, idx1 %d)", arrayId, idx2, idx1);
 
-	if (readVar(array) == 0)
+	if (arrayId == 0)
 		error("readArray: Reference to zeroed array pointer");
 
-	ArrayHeader *ah = (ArrayHeader *)getResourceAddress(rtString, readVar(array));
+	ArrayHeader *ah = (ArrayHeader *)getResourceAddress(rtString, arrayId);
 
 	if (!ah)
-		error("readArray: invalid array %d (%d)", array, readVar(array));
+		error("readArray: invalid array %d (%d)", array, arrayId);
 
 	if (idx2 < (int)FROM_LE_32(ah->dim2start) || idx2 > (int)FROM_LE_32(ah->dim2end) ||
 		idx1 < (int)FROM_LE_32(ah->dim1start) || idx1 > (int)FROM_LE_32(ah->dim1end)) {
@@ -187,15 +190,16 @@ int ScummEngine_v72he::readArray(int array, int idx2, int idx1) {
 }
 
 void ScummEngine_v72he::writeArray(int array, int idx2, int idx1, int value) {
-	debug(9, "writeArray (array %d, idx2 %d, idx1 %d, value %d)", readVar(array), idx2, idx1, value);
+	const int arrayId = readVar(array);
+	debug(9, "writeArray (array %d, idx2 %d, idx1 %d, value %d)", arrayId, idx2, idx1, value);
 
-	if (readVar(array) == 0)
+	if (arrayId == 0)
 		error("writeArray: Reference to zeroed array pointer");
 
-	ArrayHeader *ah = (ArrayHeader *)getResourceAddress(rtString, readVar(array));
+	ArrayHeader *ah = (ArrayHeader *)getResourceAddress(rtString, arrayId);
 
 	if (!ah)
-		error("writeArray: Invalid array (%d) reference", readVar(array));
+		error("writeArray: Invalid array (%d) reference", arrayId);
 
 	if (idx2 < (int)FROM_LE_32(ah->dim2start) || idx2 > (int)FROM_LE_32(ah->dim2end) ||
 		idx1 < (int)FROM_LE_32(ah->dim1start) || idx1 > (int)FROM_LE_32(ah->dim1end)) {
@@ -33,8 +33,80 @@
 #include "scumm/he/wiz_he.h"
 #include "scumm/he/moonbase/moonbase.h"
 
+// Transparent blits of raw images test sixteen 8-bit or eight 16-bit pixels
+// at a time with SSE2 or NEON, where available.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCUMM_WIZ_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SCUMM_WIZ_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace Scumm {
 
+/**
+ * Copy a row of 8-bit pixels, leaving out those with the transparent color.
+ */
+static void copyTransparentRow8(uint8 *dst, const uint8 *src, int w, uint8 transColor) {
+	int i = 0;
+
+#if defined(SCUMM_WIZ_USE_SSE2)
+	const __m128i trans = _mm_set1_epi8((char)transColor);
+	for (; i + 16 <= w; i += 16) {
+		const __m128i srcPixels = _mm_loadu_si128((const __m128i *)(src + i));
+		const __m128i mask = _mm_cmpeq_epi8(srcPixels, trans);
+		const __m128i dstPixels = _mm_loadu_si128((const __m128i *)(dst + i));
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_and_si128(mask, dstPixels), _mm_andnot_si128(mask, srcPixels)));
+	}
+#elif defined(SCUMM_WIZ_USE_NEON)
+	const uint8x16_t trans = vdupq_n_u8(transColor);
+	for (; i + 16 <= w; i += 16) {
+		const uint8x16_t srcPixels = vld1q_u8(src + i);
+		vst1q_u8(dst + i, vbslq_u8(vceqq_u8(srcPixels, trans), vld1q_u8(dst + i), srcPixels));
+	}
+#endif
+
+	for (; i < w; ++i) {
+		if (src[i] != transColor)
+			dst[i] = src[i];
+	}
+}
+
+#if defined(USE_RGB_COLOR) && defined(SCUMM_LITTLE_ENDIAN)
+/**
+ * Copy a row of little endian 16-bit pixels, leaving out those with the
+ * transparent color. On little endian hosts, all destination types store
+ * the pixels as they are in the image.
+ */
+static void copyTransparentRow16(uint8 *dst, const uint8 *src, int w, uint16 transColor) {
+	int i = 0;
+
+#if defined(SCUMM_WIZ_USE_SSE2)
+	const __m128i trans = _mm_set1_epi16((short)transColor);
+	for (; i + 8 <= w; i += 8) {
+		const __m128i srcPixels = _mm_loadu_si128((const __m128i *)(src + i * 2));
+		const __m128i mask = _mm_cmpeq_epi16(srcPixels, trans);
+		const __m128i dstPixels = _mm_loadu_si128((const __m128i *)(dst + i * 2));
+		_mm_storeu_si128((__m128i *)(dst + i * 2), _mm_or_si128(_mm_and_si128(mask, dstPixels), _mm_andnot_si128(mask, srcPixels)));
+	}
+#elif defined(SCUMM_WIZ_USE_NEON)
+	const uint16x8_t trans = vdupq_n_u16(transColor);
+	for (; i + 8 <= w; i += 8) {
+		const uint16x8_t srcPixels = vreinterpretq_u16_u8(vld1q_u8(src + i * 2));
+		const uint16x8_t dstPixels = vreinterpretq_u16_u8(vld1q_u8(dst + i * 2));
+		vst1q_u8(dst + i * 2, vreinterpretq_u8_u16(vbslq_u16(vceqq_u16(srcPixels, trans), dstPixels, srcPixels)));
+	}
+#endif
+
+	for (; i < w; ++i) {
+		uint16 col = READ_LE_UINT16(src + i * 2);
+		if (col != transColor)
+			WRITE_LE_UINT16(dst + i * 2, col);
+	}
+}
+#endif
+
 Wiz::Wiz(ScummEngine_v71he *vm) : _vm(vm) {
 	_imagesNum = 0;
 	memset(&_images, 0, sizeof(_images));
@@ -646,6 +718,16 @@ void Wiz::copyRaw16BitWizImage(uint8 *dst, const uint8 *src, int dstPitch, int d
 		int w = r1.width();
 		src += (r1.top * srcw + r1.left) * 2;
 		dst += r2.top * dstPitch + r2.left * 2;
+#ifdef SCUMM_LITTLE_ENDIAN
+		if (transColor >= 0 && transColor <= 0xFFFF) {
+			while (h--) {
+				copyTransparentRow16(dst, src, w, transColor);
+				src += srcw * 2;
+				dst += dstPitch;
+			}
+			return;
+		}
+#endif
 		while (h--) {
 			for (int i = 0; i < w; ++ i) {
 				uint16 col = READ_LE_UINT16(src + 2 * i);
@@ -905,9 +987,14 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dstPtr += dstInc;
+					if (type != kWizXMap && dstInc == 1) {
+						memset(dstPtr, (type == kWizRMap) ? palPtr[*dataPtr] : *dataPtr, code);
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr++;
 				} else {
@@ -925,10 +1012,16 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dataPtr++;
-						dstPtr += dstInc;
+					if (type == kWizCopy && dstInc == 1) {
+						memcpy(dstPtr, dataPtr, code);
+						dataPtr += code;
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dataPtr++;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
@@ -952,6 +1045,18 @@ void Wiz::decompressRawWizImage(uint8 *dst, int dstPitch, int dstType, const uin
 	if (w <= 0 || h <= 0) {
 		return;
 	}
+	if (type == kWizCopy && bitDepth == 1) {
+		while (h--) {
+			if (transColor < 0 || transColor > 0xFF) {
+				memcpy(dst, src, w);
+			} else {
+				copyTransparentRow8(dst, src, w, transColor);
+			}
+			src += srcPitch;
+			dst += dstPitch;
+		}
+		return;
+	}
 	while (h--) {
 		for (int i = 0; i < w; ++i) {
 			uint8 col = src[i];
@@ -149,6 +149,8 @@ BundleMgr::BundleMgr(BundleDirCache *cache) {
 	_fileBundleId = -1;
 	_file = new ScummFile();
 	_compInputBuff = NULL;
+	_prefetchBlock = -1;
+	_prefetchInputBuff = NULL;
 }
 
 BundleMgr::~BundleMgr() {
@@ -201,6 +203,11 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 
 void BundleMgr::close() {
 	if (_file->isOpen()) {
+		JobMan.wait(_prefetchCounter);
+		_prefetchBlock = -1;
+		free(_prefetchInputBuff);
+		_prefetchInputBuff = NULL;
+
 		_file->close();
 		_bundleTable = NULL;
 		_numFiles = 0;
@@ -242,10 +249,35 @@ bool BundleMgr::loadCompTable(int32 index) {
 	// CMI hack: one more byte at the end of input buffer
 	_compInputBuff = (byte *)malloc(maxSize + 1);
 	assert(_compInputBuff);
+	_prefetchInputBuff = (byte *)malloc(maxSize + 1);
+	assert(_prefetchInputBuff);
 
 	return true;
 }
 
+void BundleMgr::prefetchBlock(int32 index, int block) {
+	if (block >= _numCompItems || block == _prefetchBlock || block == _lastBlock)
+		return;
+
+	JobMan.wait(_prefetchCounter);
+
+	// The file is read here, only the decompression runs on a worker
+	_prefetchCodec = _compTable[block].codec;
+	_prefetchInputSize = _compTable[block].size;
+	// CMI hack: one more zero byte at the end of input buffer
+	_prefetchInputBuff[_prefetchInputSize] = 0;
+	_file->seek(_bundleTable[index].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_prefetchInputBuff, _prefetchInputSize);
+	_prefetchBlock = block;
+
+	JobMan.submit(prefetchProc, this, _prefetchCounter);
+}
+
+void BundleMgr::prefetchProc(void *param) {
+	BundleMgr *mgr = (BundleMgr *)param;
+	mgr->_prefetchOutputSize = BundleCodecs::decompressCodec(mgr->_prefetchCodec, mgr->_prefetchInputBuff, mgr->_prefetchOutputBuff, mgr->_prefetchInputSize);
+}
+
 int32 BundleMgr::decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside) {
 	return decompressSampleByIndex(_curSampleId, offset, size, compFinal, headerSize, headerOutside);
 }
@@ -288,11 +320,18 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 	for (i = firstBlock; i <= lastBlock; i++) {
 		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
+			if (_prefetchBlock == i) {
+				JobMan.wait(_prefetchCounter);
+				memcpy(_compOutputBuff, _prefetchOutputBuff, sizeof(_compOutputBuff));
+				_outputSize = _prefetchOutputSize;
+				_prefetchBlock = -1;
+			} else {
+				// CMI hack: one more zero byte at the end of input buffer
+				_compInputBuff[_compTable[i].size] = 0;
+				_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
+				_file->read(_compInputBuff, _compTable[i].size);
+				_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
+			}
 			if (_outputSize > 0x2000) {
 				error("_outputSize: %d", _outputSize);
 			}
@@ -327,6 +366,8 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 		skip = 0;
 	}
 
+	prefetchBlock(index, _lastBlock + 1);
+
 	return finalSize;
 }
 
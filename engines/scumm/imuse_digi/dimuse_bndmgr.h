@@ -25,6 +25,7 @@
 
 #include "common/scummsys.h"
 #include "common/file.h"
+#include "common/jobs.h"
 
 namespace Scumm {
 
@@ -90,7 +91,19 @@ private:
 	int _outputSize;
 	int _lastBlock;
 
+	// The block following the last one requested is decompressed ahead of
+	// time by the job system, as sounds are mostly read in order
+	int _prefetchBlock;
+	int32 _prefetchCodec;
+	int32 _prefetchInputSize;
+	byte *_prefetchInputBuff;
+	byte _prefetchOutputBuff[0x2000];
+	int _prefetchOutputSize;
+	Common::JobSystem::Counter _prefetchCounter;
+
 	bool loadCompTable(int32 index);
+	void prefetchBlock(int32 index, int block);
+	static void prefetchProc(void *param);
 
 public:
 
@@ -20,6 +20,7 @@
  *
  */
 
+#include "common/profiler.h"
 #include "common/str.h"
 #ifndef MACOSX
 #include "common/config-manager.h"
@@ -736,8 +737,13 @@ byte *ScummEngine::getResourceAddress(ResType type, ResId idx) {
 		return NULL;
 
 	// If the resource is missing, but loadable from the game data files, try to do so.
-	if (!_res->_types[type][idx]._address && _res->_types[type]._mode != kDynamicResTypeMode) {
-		ensureResourceLoaded(type, idx);
+	if (_res->_types[type]._mode != kDynamicResTypeMode) {
+		if (!_res->_types[type][idx]._address) {
+			PROFILE_COUNT("resource cache misses", 1);
+			ensureResourceLoaded(type, idx);
+		} else {
+			PROFILE_COUNT("resource cache hits", 1);
+		}
 	}
 
 	ptr = (byte *)_res->_types[type][idx]._address;
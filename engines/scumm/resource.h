@@ -225,6 +225,13 @@ public:
 
 	void resourceStats();
 
+	/** Return the number of bytes used by all loaded resources. */
+	uint32 getAllocatedSize() const { return _allocatedSize; }
+	/** Return the limit above which resources start to be expired. */
+	uint32 getMaxHeapThreshold() const { return _maxHeapThreshold; }
+	/** Return the limit down to which resources are expired. */
+	uint32 getMinHeapThreshold() const { return _minHeapThreshold; }
+
 //protected:
 	bool validateResource(const char *str, ResType type, ResId idx) const;
 protected:
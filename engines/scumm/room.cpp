@@ -522,6 +522,8 @@ void ScummEngine::resetRoomSubBlocks() {
 		}
 	}
 
+	invalidateBoxCache();
+
 	//
 	// Load scale data
 	//
@@ -800,6 +802,8 @@ void ScummEngine_v3old::resetRoomSubBlocks() {
 
 	}
 
+	invalidateBoxCache();
+
 	//
 	// No scale data in old bundle games
 	//
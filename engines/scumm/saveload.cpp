@@ -159,6 +159,9 @@ Common::SeekableReadStream *ScummEngine::openSaveFileForReading(int slot, bool c
 
 Common::WriteStream *ScummEngine::openSaveFileForWriting(int slot, bool compat, Common::String &fileName) {
 	fileName = makeSavegameName(slot, compat);
+	// Slot 0 is the autosave slot
+	if (slot == 0 && !compat)
+		return _saveFileMan->openForAutosaving(fileName);
 	return _saveFileMan->openForSaving(fileName);
 }
 
@@ -449,6 +452,9 @@ bool ScummEngine::loadState(int slot, bool compat, Common::String &filename) {
 	saveLoadWithSerializer(ser);
 	delete in;
 
+	// The box resources have been replaced
+	invalidateBoxCache();
+
 	// Update volume settings
 	syncSoundSettings();
 
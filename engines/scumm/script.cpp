@@ -21,6 +21,7 @@
  */
 
 #include "common/config-manager.h"
+#include "common/profiler.h"
 #include "common/util.h"
 #include "common/system.h"
 
@@ -459,6 +460,7 @@ void ScummEngine::refreshScriptPointer() {
 /** Execute a script - Read opcode, and execute it from the table */
 void ScummEngine::executeScript() {
 	int c;
+	uint32 instructions = 0;
 	while (_currentScript != 0xFF) {
 
 		if (_showStack == 1) {
@@ -484,8 +486,10 @@ void ScummEngine::executeScript() {
 		}
 
 		executeOpcode(_opcode);
-
+		++instructions;
 	}
+
+	PROFILE_COUNT("script instructions", instructions);
 }
 
 void ScummEngine::executeOpcode(byte i) {
@@ -886,6 +890,7 @@ void ScummEngine::unfreezeScripts() {
 
 
 void ScummEngine::runAllScripts() {
+	PROFILE_ZONE("script VM");
 	int i;
 
 	for (i = 0; i < NUM_SCRIPT_SLOT; i++)
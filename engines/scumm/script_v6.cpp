@@ -3053,6 +3053,8 @@ void ScummEngine_v6::o6_setBoxSet() {
 	assert(matrix);
 	memcpy(matrix, boxm + 8, mboxSize);
 
+	invalidateBoxCache();
+
 	if (_game.version == 7)
 		putActors();
 }
@@ -24,6 +24,7 @@
 #include "common/debug-channels.h"
 #include "common/md5.h"
 #include "common/events.h"
+#include "common/profiler.h"
 #include "common/system.h"
 #include "common/translation.h"
 
@@ -119,7 +120,8 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	  _debugger(0),
 	  _currentScript(0xFF), // Let debug() work on init stage
 	  _messageDialog(0), _pauseDialog(0), _versionDialog(0),
-	  _rnd("scumm")
+	  _rnd("scumm"),
+	  _subtitles("subtitles")
 	  {
 
 #ifdef USE_RGB_COLOR
@@ -305,6 +307,7 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	_defaultTalkDelay = 0;
 	_saveSound = 0;
 	memset(_extraBoxFlags, 0, sizeof(_extraBoxFlags));
+	_boxCacheValid = false;
 	memset(_scaleSlots, 0, sizeof(_scaleSlots));
 	_charset = NULL;
 	_charsetColor = 0;
@@ -2188,6 +2191,8 @@ void ScummEngine_v0::scummLoop(int delta) {
 }
 
 void ScummEngine::scummLoop(int delta) {
+	PROFILE_ZONE("engine update");
+
 	if (_game.version >= 3) {
 		VAR(VAR_TMR_1) += delta;
 		VAR(VAR_TMR_2) += delta;
@@ -2499,6 +2504,8 @@ void ScummEngine_v8::scummLoop_handleSaveLoad() {
 #endif
 
 void ScummEngine::scummLoop_handleDrawing() {
+	PROFILE_ZONE("render");
+
 	if (camera._cur != camera._last || _bgNeedsRedraw || _fullRedraw) {
 		_V0Delay._screenScroll = true;
 
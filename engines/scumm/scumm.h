@@ -25,6 +25,7 @@
 
 #include "engines/engine.h"
 
+#include "common/config-manager.h"
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
@@ -39,6 +40,7 @@
 #include "graphics/surface.h"
 #include "graphics/sjis.h"
 
+#include "scumm/boxes.h"
 #include "scumm/gfx.h"
 #include "scumm/detection.h"
 #include "scumm/script.h"
@@ -402,6 +404,9 @@ public:
 	/** Random number generator */
 	Common::RandomSource _rnd;
 
+	/** The "subtitles" setting, which text printing checks every frame */
+	Common::ConfigSetting<bool> _subtitles;
+
 	/** Graphics manager */
 	Gdi *_gdi;
 
@@ -1160,7 +1165,23 @@ public:
 	int getScale(int box, int x, int y);
 	int getScaleFromSlot(int slot, int x, int y);
 
+	/**
+	 * Drop the decoded box coordinates and box matrix rows. Has to be called
+	 * whenever the box or box matrix resources are replaced.
+	 */
+	void invalidateBoxCache();
+
 protected:
+	// The coordinates of the boxes of the room, and the offset of the row
+	// of each box in the box matrix, for v3 and newer games. Both are
+	// decoded on first use after invalidateBoxCache().
+	bool _boxCacheValid;
+	Common::Array<BoxCoords> _boxCoordsCache;
+	Common::Array<uint16> _boxMatrixRows;
+
+	void updateBoxCache();
+	BoxCoords decodeBoxCoordinates(int boxnum);
+
 	// Scaling slots/items
 	struct ScaleSlot {
 		int x1, y1, scale1;
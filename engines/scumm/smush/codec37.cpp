@@ -325,6 +325,33 @@ void Codec37Decoder::maketable(int pitch, int index) {
 		dst += 4;						  \
 	} while (0)
 
+/*
+ * Copy a run of 4x4 pixel blocks from the same place in the other buffer.
+ * The blocks of one row are next to each other, so each row of pixels is
+ * copied at once. The run stops early when the last row of blocks is done.
+ */
+
+#define COPY_4X4_RUN(dst, next_offs, length, i, bw, bh, pitch)		  \
+	do {								  \
+		int32 left = length;					  \
+		while (left > 0) {					  \
+			int32 n = MIN<int32>(left, i);			  \
+			int x;						  \
+			for (x=0; x<4; x++) {				  \
+				memcpy(dst + pitch * x, dst + next_offs + pitch * x, n * 4); \
+			}						  \
+			dst += n * 4;					  \
+			left -= n;					  \
+			i -= n;						  \
+			if (i == 0) {					  \
+				dst += pitch * 3;			  \
+				i = bw;					  \
+				if (--bh == 0)				  \
+					break;				  \
+			}						  \
+		}							  \
+	} while (0)
+
 void Codec37Decoder::proc1(byte *dst, const byte *src, int32 next_offs, int bw, int bh, int pitch, int16 *offset_table) {
 	uint8 code;
 	bool filling, skipCode;
@@ -439,16 +466,7 @@ void Codec37Decoder::proc4WithFDFE(byte *dst, const byte *src, int32 next_offs,
 				LITERAL_1X1(src, dst, pitch);
 			} else if (code == 0x00) {
 				int32 length = *src++ + 1;
-				for (int32 l = 0; l < length; l++) {
-					byte *dst2 = dst + next_offs;
-					COPY_4X4(dst2, dst, pitch);
-					i--;
-					if (i == 0) {
-						dst += pitch * 3;
-						bh--;
-						i = bw;
-					}
-				}
+				COPY_4X4_RUN(dst, next_offs, length, i, bw, bh, pitch);
 				if (bh == 0) {
 					return;
 				}
@@ -471,16 +489,7 @@ void Codec37Decoder::proc4WithoutFDFE(byte *dst, const byte *src, int32 next_off
 				LITERAL_1X1(src, dst, pitch);
 			} else if (code == 0x00) {
 				int32 length = *src++ + 1;
-				for (int32 l = 0; l < length; l++) {
-					byte *dst2 = dst + next_offs;
-					COPY_4X4(dst2, dst, pitch);
-					i--;
-					if (i == 0) {
-						dst += pitch * 3;
-						bh--;
-						i = bw;
-					}
-				}
+				COPY_4X4_RUN(dst, next_offs, length, i, bw, bh, pitch);
 				if (bh == 0) {
 					return;
 				}
@@ -28,7 +28,10 @@
 
 namespace Sherlock {
 
-Cache::Cache(SherlockEngine *vm) : _vm(vm) {
+// The most data which cache entries that may be evicted can take up
+static const uint32 kMaxCacheSize = 16 * 1024 * 1024;
+
+Cache::Cache(SherlockEngine *vm) : _vm(vm), _size(0), _useCounter(0) {
 }
 
 bool Cache::isCached(const Common::String &filename) const {
@@ -45,12 +48,12 @@ void Cache::load(const Common::String &name) {
 	if (!f.open(name))
 		error("Could not read file - %s", name.c_str());
 
-	load(name, f);
+	load(name, f, true);
 
 	f.close();
 }
 
-void Cache::load(const Common::String &name, Common::SeekableReadStream &stream) {
+void Cache::load(const Common::String &name, Common::SeekableReadStream &stream, bool pinned) {
 	// First check if the entry already exists
 	if (_resources.contains(name))
 		return;
@@ -58,29 +61,52 @@ void Cache::load(const Common::String &name, Common::SeekableReadStream &stream)
 	int32 signature = stream.readUint32BE();
 	stream.seek(0);
 
-	// Allocate a new cache entry
-	_resources[name] = CacheEntry();
-	CacheEntry &cacheEntry = _resources[name];
+	// If the file is compressed, the decompressed data gets cached
+	Common::SeekableReadStream *decompressed = nullptr;
+	if (signature == MKTAG('L', 'Z', 'V', 26))
+		decompressed = _vm->_res->decompress(stream);
+	Common::SeekableReadStream &source = decompressed ? *decompressed : stream;
+	const uint32 size = source.size();
+
+	// Make room for the new entry
+	if (!pinned) {
+		evict(size);
+		_size += size;
+	}
 
-	// Check whether the file is compressed
-	if (signature == MKTAG('L', 'Z', 'V', 26)) {
-		// It's compressed, so decompress the file and store its data in the cache entry
-		Common::SeekableReadStream *decompressed = _vm->_res->decompress(stream);
-		cacheEntry.resize(decompressed->size());
-		decompressed->read(&cacheEntry[0], decompressed->size());
+	// Allocate a new cache entry, and read the data into it
+	CacheEntry &cacheEntry = _resources[name];
+	cacheEntry._lastUse = ++_useCounter;
+	cacheEntry._pinned = pinned;
+	cacheEntry._data.resize(size);
+	source.read(&cacheEntry._data[0], size);
 
-		delete decompressed;
-	} else {
-		// It's not, so read the raw data of the file into the cache entry
-		cacheEntry.resize(stream.size());
-		stream.read(&cacheEntry[0], stream.size());
-	}
+	delete decompressed;
 }
 
-Common::SeekableReadStream *Cache::get(const Common::String &filename) const {
+Common::SeekableReadStream *Cache::get(const Common::String &filename) {
+	CacheEntry &cacheEntry = _resources[filename];
+	cacheEntry._lastUse = ++_useCounter;
+
 	// Return a memory stream that encapsulates the data
-	const CacheEntry &cacheEntry = _resources[filename];
-	return new Common::MemoryReadStream(&cacheEntry[0], cacheEntry.size());
+	return new Common::MemoryReadStream(&cacheEntry._data[0], cacheEntry._data.size());
+}
+
+void Cache::evict(uint32 size) {
+	while (_size + size > kMaxCacheSize) {
+		CacheHash::iterator oldest = _resources.end();
+		for (CacheHash::iterator i = _resources.begin(); i != _resources.end(); ++i) {
+			if (!i->_value._pinned && (oldest == _resources.end() || i->_value._lastUse < oldest->_value._lastUse))
+				oldest = i;
+		}
+
+		if (oldest == _resources.end())
+			break;
+
+		debug(3, "Removing %s from the cache", oldest->_key.c_str());
+		_size -= oldest->_value._data.size();
+		_resources.erase(oldest);
+	}
 }
 
 /*----------------------------------------------------------------*/
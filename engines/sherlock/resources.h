@@ -35,7 +35,13 @@
 
 namespace Sherlock {
 
-typedef Common::Array<byte> CacheEntry;
+struct CacheEntry {
+	Common::Array<byte> _data;
+	uint32 _lastUse;
+	bool _pinned;
+
+	CacheEntry() : _lastUse(0), _pinned(false) {}
+};
 typedef Common::HashMap<Common::String, CacheEntry, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> CacheHash;
 
 struct LibraryEntry {
@@ -55,6 +61,14 @@ class Cache {
 private:
 	SherlockEngine *_vm;
 	CacheHash _resources;
+	uint32 _size;
+	uint32 _useCounter;
+
+	/**
+	 * Removes the least recently used entries which aren't pinned, until
+	 * the given number of bytes fit into the cache
+	 */
+	void evict(uint32 size);
 public:
 	Cache(SherlockEngine *_vm);
 
@@ -66,19 +80,21 @@ public:
 	/**
 	 * Loads a file into the cache if it's not already present, and returns it.
 	 * If the file is LZW compressed, automatically decompresses it and loads
-	 * the uncompressed version into memory
+	 * the uncompressed version into memory. Files loaded this way are pinned,
+	 * so they stay in the cache for good
 	 */
 	void load(const Common::String &name);
 
 	/**
-	 * Load a cache entry based on a passed stream
+	 * Load a cache entry based on a passed stream. The entry may be evicted
+	 * again when other entries are loaded, once the cache is full
 	 */
-	void load(const Common::String &name, Common::SeekableReadStream &stream);
+	void load(const Common::String &name, Common::SeekableReadStream &stream, bool pinned = false);
 
 	/**
 	 * Get a file from the cache
 	 */
-	Common::SeekableReadStream *get(const Common::String &filename) const;
+	Common::SeekableReadStream *get(const Common::String &filename);
 };
 
 class Resources {
@@ -69,6 +69,9 @@ void GraphicsManager::init() {
 	// Sprites
 	_spriteLayers = new SpriteLayers;
 	_spriteLayers->numLayers = 0;
+	_decodedSprites.clear();
+	_decodedSpriteSize = 0;
+	_spriteUseCount = 0;
 
 	// Sprite Bank
 	_allLoadedBanks.clear();
@@ -125,10 +128,13 @@ void GraphicsManager::kill() {
 	// kill sprite banks
 	LoadedSpriteBanks::iterator it;
 	for (it = _allLoadedBanks.begin(); it != _allLoadedBanks.end(); ++it) {
+		forgetSpriteBank((*it)->bank);
 		delete (*it);
 		(*it) = nullptr;
 	}
 	_allLoadedBanks.clear();
+	_decodedSprites.clear();
+	_decodedSpriteSize = 0;
 
 	// kill zbuffer
 	if (_zBuffer) {
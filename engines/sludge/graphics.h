@@ -216,6 +216,15 @@ private:
 	void blendColor(Graphics::Surface * surface, uint32 color, Graphics::TSpriteBlendMode mode);
 	Graphics::Surface *applyLightmapToSprite(Graphics::Surface *&blitted, OnScreenPerson *thisPerson, bool mirror, int x, int y, int x1, int y1, int diffX, int diffY);
 
+	// Decoded animation sprites, freed again least recently used first
+	// once they take more than kMaxDecodedSpriteSize bytes
+	enum { kMaxDecodedSpriteSize = 16 * 1024 * 1024 };
+	Common::List<Sprite *> _decodedSprites;
+	uint32 _decodedSpriteSize;
+	uint32 _spriteUseCount;
+	void decodeSprite(Sprite &single, const SpritePalette &pal);
+	void trimDecodedSprites();
+
 	// Sprite banks
 	LoadedSpriteBanks _allLoadedBanks;
 
@@ -40,6 +40,54 @@
 
 namespace Sludge {
 
+// Turns the palette indices of a sprite into its surface, and the burn
+// surface of a font
+static void convertSprite(Sprite &single, const SpritePalette &pal, bool isFont) {
+	const uint size = single.width * single.height;
+	const byte *data = single.indices;
+
+	single.surface.create(single.width, single.height, *g_sludge->getScreenPixelFormat());
+	if (isFont)
+		single.burnSurface.create(single.width, single.height, *g_sludge->getScreenPixelFormat());
+
+	// Transparent pixels take the colour of the last opaque one
+	int transColour = -1;
+	for (uint i = 0; i < size; ++i) {
+		if (data[i]) {
+			transColour = data[i];
+			break;
+		}
+	}
+
+	for (int y = 0; y < single.surface.h; y++) {
+		byte *target = (byte *)single.surface.getBasePtr(0, y);
+		byte *burn = isFont ? (byte *)single.burnSurface.getBasePtr(0, y) : nullptr;
+		for (int x = 0; x < single.surface.w; x++, target += 4) {
+			byte s = *data++;
+			if (s) {
+				target[0] = (byte)255;
+				target[1] = (byte)pal.b[s];
+				target[2] = (byte)pal.g[s];
+				target[3] = (byte)pal.r[s];
+				transColour = s;
+			} else if (transColour >= 0) {
+				target[0] = (byte)0;
+				target[1] = (byte)pal.b[transColour];
+				target[2] = (byte)pal.g[transColour];
+				target[3] = (byte)pal.r[transColour];
+			}
+			if (burn) {
+				if (s)
+					burn[0] = pal.r[s];
+				burn[1] = (byte)255;
+				burn[2] = (byte)255;
+				burn[3] = (byte)255;
+				burn += 4;
+			}
+		}
+	}
+}
+
 // This function is only used to kill text font
 void GraphicsManager::forgetSpriteBank(SpriteBank &forgetme) {
 	// kill the sprite bank
@@ -58,6 +106,7 @@ void GraphicsManager::forgetSpriteBank(SpriteBank &forgetme) {
 		for (int i = 0; i < forgetme.total; ++i) {
 			forgetme.sprites[i].surface.free();
 			forgetme.sprites[i].burnSurface.free();
+			delete[] forgetme.sprites[i].indices;
 		}
 
 		delete []forgetme.sprites;
@@ -121,9 +170,6 @@ bool GraphicsManager::loadSpriteBank(int fileNum, SpriteBank &loadhere, bool isF
 	loadhere.sprites = new Sprite[total];
 	if (!checkNew(loadhere.sprites))
 		return false;
-	byte **spriteData = new byte *[total];
-	if (!checkNew(spriteData))
-		return false;
 
 	// version 1, 2, read how many now
 	if (spriteBankVersion && spriteBankVersion < 3) {
@@ -163,15 +209,13 @@ bool GraphicsManager::loadSpriteBank(int fileNum, SpriteBank &loadhere, bool isF
 		}
 
 		// init data
-		loadhere.sprites[i].surface.create(picwidth, picheight, *g_sludge->getScreenPixelFormat());
-		if (isFont) {
-			loadhere.sprites[i].burnSurface.create(picwidth, picheight, *g_sludge->getScreenPixelFormat());
-		}
+		loadhere.sprites[i].width = picwidth;
+		loadhere.sprites[i].height = picheight;
 		data = (byte *)new byte[picwidth * (picheight + 1)];
 		if (!checkNew(data))
 			return false;
 		memset(data + picwidth * picheight, 0, picwidth);
-		spriteData[i] = data;
+		loadhere.sprites[i].indices = data;
 
 		// read color
 		if (spriteBankVersion == 2) { // RUN LENGTH COMPRESSED DATA
@@ -220,49 +264,14 @@ bool GraphicsManager::loadSpriteBank(int fileNum, SpriteBank &loadhere, bool isF
 	}
 	loadhere.myPalette.originalRed = loadhere.myPalette.originalGreen = loadhere.myPalette.originalBlue = 255;
 
-	// convert
-	for (int i = 0; i < total; i++) {
-		int fromhere = 0;
-		int transColour = -1;
-		int size = loadhere.sprites[i].surface.w * loadhere.sprites[i].surface.h;
-		while (fromhere < size) {
-			byte s = spriteData[i][fromhere++];
-			if (s) {
-				transColour = s;
-				break;
-			}
-		}
-		fromhere = 0;
-		for (int y = 0; y < loadhere.sprites[i].surface.h; y++) {
-			for (int x = 0; x < loadhere.sprites[i].surface.w; x++) {
-				byte *target = (byte *)loadhere.sprites[i].surface.getBasePtr(x, y);
-				byte s = spriteData[i][fromhere++];
-				if (s) {
-					target[0] = (byte)255;
-					target[1] = (byte)loadhere.myPalette.b[s];
-					target[2] = (byte)loadhere.myPalette.g[s];
-					target[3] = (byte)loadhere.myPalette.r[s];
-					transColour = s;
-				} else if (transColour >= 0) {
-					target[0] = (byte)0;
-					target[1] = (byte)loadhere.myPalette.b[transColour];
-					target[2] = (byte)loadhere.myPalette.g[transColour];
-					target[3] = (byte)loadhere.myPalette.r[transColour];
-				}
-				if (isFont) {
-					target = (byte *)loadhere.sprites[i].burnSurface.getBasePtr(x, y);
-					if (s)
-						target[0] = loadhere.myPalette.r[s];
-					target[1] = (byte)255;
-					target[2] = (byte)255;
-					target[3] = (byte)255;
-				}
-			}
+	// Fonts are drawn right away, animation sprites only get decoded when needed
+	if (isFont) {
+		for (int i = 0; i < total; i++) {
+			convertSprite(loadhere.sprites[i], loadhere.myPalette, true);
+			delete[] loadhere.sprites[i].indices;
+			loadhere.sprites[i].indices = nullptr;
 		}
-		delete[] spriteData[i];
 	}
-	delete[] spriteData;
-	spriteData = NULL;
 
 	g_sludge->_resMan->finishAccess();
 
@@ -273,6 +282,8 @@ bool GraphicsManager::loadSpriteBank(int fileNum, SpriteBank &loadhere, bool isF
 
 // pasteSpriteToBackDrop uses the colour specified by the setPasteColour (or setPasteColor)
 void GraphicsManager::pasteSpriteToBackDrop(int x1, int y1, Sprite &single, const SpritePalette &fontPal) {
+	decodeSprite(single, fontPal);
+
 	// kill zBuffer
 	if (_zBuffer->originalNum >= 0 && _zBuffer->sprites) {
 		int num = _zBuffer->originalNum;
@@ -291,6 +302,8 @@ void GraphicsManager::pasteSpriteToBackDrop(int x1, int y1, Sprite &single, cons
 // burnSpriteToBackDrop adds text in the colour specified by setBurnColour
 // using the differing brightness levels of the font to achieve an anti-aliasing effect.
 void GraphicsManager::burnSpriteToBackDrop(int x1, int y1, Sprite &single, const SpritePalette &fontPal) {
+	decodeSprite(single, fontPal);
+
 	// kill zBuffer
 	if (_zBuffer->originalNum >= 0 && _zBuffer->sprites) {
 		int num = _zBuffer->originalNum;
@@ -307,6 +320,8 @@ void GraphicsManager::burnSpriteToBackDrop(int x1, int y1, Sprite &single, const
 }
 
 void GraphicsManager::fontSprite(bool flip, int x, int y, Sprite &single, const SpritePalette &fontPal) {
+	decodeSprite(single, fontPal);
+
 	float x1 = (float)x - (float)single.xhot / _cameraZoom;
 	float y1 = (float)y - (float)single.yhot / _cameraZoom;
 
@@ -417,6 +432,8 @@ Graphics::Surface *GraphicsManager::applyLightmapToSprite(Graphics::Surface *&bl
 }
 
 bool GraphicsManager::scaleSprite(Sprite &single, const SpritePalette &fontPal, OnScreenPerson *thisPerson, bool mirror) {
+	decodeSprite(single, fontPal);
+
 	float x = thisPerson->x;
 	float y = thisPerson->y;
 
@@ -524,6 +541,7 @@ void GraphicsManager::displaySpriteLayers() {
 		}
 	}
 	killSpriteLayers();
+	trimDecodedSprites();
 }
 
 void GraphicsManager::killSpriteLayers() {
@@ -543,8 +561,36 @@ void GraphicsManager::killSpriteLayers() {
 	_spriteLayers->numLayers = 0;
 }
 
+void GraphicsManager::decodeSprite(Sprite &single, const SpritePalette &pal) {
+	single.lastUse = ++_spriteUseCount;
+	if (!single.indices || single.surface.getPixels())
+		return;
+
+	// pal is the palette of the sprite's own bank, fonts never get here
+	convertSprite(single, pal, false);
+	_decodedSprites.push_back(&single);
+	_decodedSpriteSize += single.surface.pitch * single.surface.h;
+}
+
+void GraphicsManager::trimDecodedSprites() {
+	// Must not be called while sprite layers still point to the surfaces
+	while (_decodedSpriteSize > kMaxDecodedSpriteSize) {
+		Common::List<Sprite *>::iterator oldest = _decodedSprites.begin();
+		for (Common::List<Sprite *>::iterator it = oldest; it != _decodedSprites.end(); ++it) {
+			if ((*it)->lastUse < (*oldest)->lastUse)
+				oldest = it;
+		}
+
+		Sprite *single = *oldest;
+		_decodedSpriteSize -= single->surface.pitch * single->surface.h;
+		single->surface.free();
+		_decodedSprites.erase(oldest);
+	}
+}
+
 // Paste a scaled sprite onto the backdrop
 void GraphicsManager::fixScaleSprite(int x, int y, Sprite &single, const SpritePalette &fontPal, OnScreenPerson *thisPerson, int camX, int camY, bool mirror) {
+	decodeSprite(single, fontPal);
 
 	float scale = thisPerson->scale;
 	bool useZB = !(thisPerson->extra & EXTRA_NOZB);
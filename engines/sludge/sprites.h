@@ -31,6 +31,14 @@ struct Sprite {
 	int xhot, yhot;
 	Graphics::Surface surface;
 	Graphics::Surface burnSurface;
+
+	// Animation sprites keep their palette indices and are only decoded
+	// into surface when drawn, see GraphicsManager::decodeSprite()
+	byte *indices;
+	uint16 width, height;
+	uint32 lastUse;
+
+	Sprite() : xhot(0), yhot(0), indices(nullptr), width(0), height(0), lastUse(0) {}
 };
 
 class SpritePalette {
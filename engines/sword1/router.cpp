@@ -77,6 +77,8 @@ Router::Router(ObjectMan *pObjMan, ResMan *pResMan) {
 	_playerTargetX = _playerTargetY = _playerTargetDir = _playerTargetStance = 0;
 	_diagonalx = _diagonaly = 0;
 	_slidyWalkAnimatorState = false;
+	_nodeReachGrid = -1;
+	_nodeReachDiagonalX = _nodeReachDiagonalY = 0;
 }
 
 /*
@@ -1431,7 +1433,7 @@ bool Router::scan(int32 level) {
 						distance = (6 * ABS(x2 - x1) + 36 * ABS(y2 - y1)) / (36 * 14) + 1;
 
 					if (distance + _node[i].dist < _node[_nNodes].dist && distance + _node[i].dist < _node[j].dist) {
-						if (newCheck(0, x1, y1, x2, y2)) {
+						if (nodeCheck(i, j)) {
 							_node[j].level = level + 1;
 							_node[j].dist = distance + _node[i].dist;
 							_node[j].prev = i;
@@ -1447,6 +1449,17 @@ bool Router::scan(int32 level) {
 }
 
 
+bool Router::nodeCheck(int32 from, int32 to) {
+	// The start and target nodes are different for every route
+	if (from == 0 || to == _nNodes)
+		return newCheck(0, _node[from].x, _node[from].y, _node[to].x, _node[to].y) != 0;
+
+	if (_nodeReach[from][to] == kNodeUnchecked)
+		_nodeReach[from][to] = newCheck(0, _node[from].x, _node[from].y, _node[to].x, _node[to].y) ? kNodeReachable : kNodeBlocked;
+
+	return _nodeReach[from][to] == kNodeReachable;
+}
+
 int32 Router::newCheck(int32 status, int32 x1, int32 y1, int32 x2, int32 y2) {
 	/*********************************************************************
 	 * newCheck routine checks if the route between two points can be
@@ -1952,6 +1965,13 @@ int32 Router::LoadWalkResources(Object *megaObject, int32 x, int32 y, int32 dir)
 	_diagonalx =  _modX[3]; //36
 	_diagonaly =  _modY[3]; //8
 
+	if (walkGridResourceId != _nodeReachGrid || _diagonalx != _nodeReachDiagonalX || _diagonaly != _nodeReachDiagonalY) {
+		memset(_nodeReach, kNodeUnchecked, sizeof(_nodeReach));
+		_nodeReachGrid = walkGridResourceId;
+		_nodeReachDiagonalX = _diagonalx;
+		_nodeReachDiagonalY = _diagonaly;
+	}
+
 	// mega data ready
 
 	// finish setting grid by putting mega _node at begining
@@ -134,11 +134,24 @@ private:
 
 	bool        _slidyWalkAnimatorState;
 
+	// Whether newCheck() finds a way between two nodes of the floor. This
+	// only depends on the walk grid and the mega's diagonal step, so it is
+	// kept for all routes through the same grid.
+	enum {
+		kNodeUnchecked = 0,
+		kNodeBlocked,
+		kNodeReachable
+	};
+
+	uint8       _nodeReach[O_GRID_SIZE][O_GRID_SIZE];
+	int32       _nodeReachGrid, _nodeReachDiagonalX, _nodeReachDiagonalY;
+
 	int32 LoadWalkResources(Object *mega, int32 x, int32 y, int32 dir);
 	int32 getRoute();
 	int32 checkTarget(int32 x, int32 y);
 
 	bool scan(int32 level);
+	bool nodeCheck(int32 from, int32 to);
 	int32 newCheck(int32 status, int32 x1, int32 x2, int32 y1, int32 y2);
 	bool check(int32 x1, int32 y1, int32 x2, int32 y2);
 	bool horizCheck(int32 x1, int32 y, int32 x2);
@@ -324,6 +324,13 @@ int32 Router::getRoute() {
 
 		// This is the routine that finds a route using scan()
 
+		if (memcmp(_walkGridList, _nodeReachGridList, sizeof(_walkGridList)) || _diagonalx != _nodeReachDiagonalX || _diagonaly != _nodeReachDiagonalY) {
+			memset(_nodeReach, kNodeUnchecked, sizeof(_nodeReach));
+			memcpy(_nodeReachGridList, _walkGridList, sizeof(_walkGridList));
+			_nodeReachDiagonalX = _diagonalx;
+			_nodeReachDiagonalY = _diagonaly;
+		}
+
 		int32 level = 1;
 
 		while (scan(level))
@@ -1689,7 +1696,7 @@ bool Router::scan(int32 level) {
 						distance = (6 * ABS(x2 - x1) + 36 * ABS(y2 - y1)) / (36 * 14) + 1;
 
 					if (distance + _node[i].dist < _node[_nNodes].dist && distance + _node[i].dist < _node[j].dist) {
-						if (newCheck(0, x1, y1, x2, y2)) {
+						if (nodeCheck(i, j)) {
 							_node[j].level = level + 1;
 							_node[j].dist = distance + _node[i].dist;
 							_node[j].prev = i;
@@ -1704,6 +1711,17 @@ bool Router::scan(int32 level) {
 	return changed;
 }
 
+bool Router::nodeCheck(int32 from, int32 to) {
+	// The start and target nodes are different for every route
+	if (from == 0 || to == _nNodes)
+		return newCheck(0, _node[from].x, _node[from].y, _node[to].x, _node[to].y) != 0;
+
+	if (_nodeReach[from][to] == kNodeUnchecked)
+		_nodeReach[from][to] = newCheck(0, _node[from].x, _node[from].y, _node[to].x, _node[to].y) ? kNodeReachable : kNodeBlocked;
+
+	return _nodeReach[from][to] == kNodeReachable;
+}
+
 int32 Router::newCheck(int32 status, int32 x1, int32 y1, int32 x2, int32 y2) {
 	/*********************************************************************
 	 * newCheck routine checks if the route between two points can be
@@ -134,6 +134,20 @@ private:
 	int32 _diagonalx;
 	int32 _diagonaly;
 
+	// Whether newCheck() finds a way between two nodes of the walk grids.
+	// This only depends on the grids and the mega's diagonal step, so it
+	// is kept for all routes through the same grids.
+	enum {
+		kNodeUnchecked = 0,
+		kNodeBlocked,
+		kNodeReachable
+	};
+
+	uint8 _nodeReach[O_GRID_SIZE][O_GRID_SIZE];
+	int32 _nodeReachGridList[MAX_WALKGRIDS];
+	int32 _nodeReachDiagonalX;
+	int32 _nodeReachDiagonalY;
+
 	int32 _firstStandFrame;
 
 	int32 _firstStandingTurnLeftFrame;
@@ -168,6 +182,7 @@ private:
 	void setUpWalkGrid(byte *ob_mega, int32 x, int32 y, int32 dir);
 	void loadWalkData(byte *ob_walkdata);
 	bool scan(int32 level);
+	bool nodeCheck(int32 from, int32 to);
 
 	int32 newCheck(int32 status, int32 x1, int32 y1, int32 x2, int32 y2);
 	bool lineCheck(int32 x1, int32 x2, int32 y1, int32 y2);
@@ -198,6 +213,9 @@ public:
 		memset(_bars, 0, sizeof(_bars));
 		memset(_node, 0, sizeof(_node));
 		memset(_walkGridList, 0, sizeof(_walkGridList));
+		memset(_nodeReachGridList, 0, sizeof(_nodeReachGridList));
+		_nodeReachDiagonalX = _nodeReachDiagonalY = 0;
+		memset(_nodeReach, kNodeUnchecked, sizeof(_nodeReach));
 		memset(_route, 0, sizeof(_route));
 		memset(_smoothPath, 0, sizeof(_smoothPath));
 		memset(_modularPath, 0, sizeof(_modularPath));
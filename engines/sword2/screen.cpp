@@ -71,6 +71,9 @@ Screen::Screen(Sword2Engine *vm, int16 width, int16 height) {
 		_blockSurfaces[i] = NULL;
 
 	_lightMask = NULL;
+
+	_spriteCacheSize = 0;
+
 	_needFullRedraw = false;
 
 	memset(&_thisScreen, 0, sizeof(_thisScreen));
@@ -114,6 +117,7 @@ Screen::~Screen() {
 	free(_dirtyGrid);
 	closeBackgroundLayer();
 	free(_lightMask);
+	clearSpriteCache();
 }
 
 uint32 Screen::getTick() {
@@ -668,7 +672,7 @@ void Screen::processImage(BuildUnit *build_unit) {
 		_vm->_debugger->_rectY2 = spriteInfo.y + spriteInfo.scaledHeight;
 	}
 
-	uint32 rv = drawSprite(&spriteInfo);
+	uint32 rv = drawSprite(&spriteInfo, build_unit->anim_resource, build_unit->anim_pc);
 	if (rv) {
 		error("Driver Error %.8x with sprite %s (%d, %d) in processImage",
 			rv,
@@ -25,6 +25,7 @@
 #ifndef	SWORD2_SCREEN_H
 #define	SWORD2_SCREEN_H
 
+#include "common/list.h"
 #include "common/rect.h"
 #include "common/stream.h"
 
@@ -50,6 +51,9 @@
 #define SCALE_MAXWIDTH   512
 #define SCALE_MAXHEIGHT  512
 
+// Memory budget for decompressed sprites
+#define SPRITE_CACHE_SIZE (2 * 1024 * 1024)
+
 // Dirty grid cell size
 #define CELLWIDE         10
 #define CELLDEEP         20
@@ -341,6 +345,23 @@ private:
 	uint16 _xScale[SCALE_MAXWIDTH];
 	uint16 _yScale[SCALE_MAXHEIGHT];
 
+	// Decompressed animation frames, most recently drawn first. Frames
+	// are kept as long as they fit into the memory budget.
+
+	struct CachedSprite {
+		uint32 resource;
+		uint32 frame;
+		uint32 size;
+		byte *data;
+	};
+
+	Common::List<CachedSprite> _spriteCache;
+	uint32 _spriteCacheSize;
+
+	byte *findCachedSprite(uint32 resource, uint32 frame, uint32 size);
+	bool addCachedSprite(uint32 resource, uint32 frame, uint32 size, byte *data);
+	void clearSpriteCache();
+
 	void blitBlockSurface(BlockSurface *s, Common::Rect *r, Common::Rect *clipRect);
 
 	uint16 _layer;
@@ -423,7 +444,7 @@ public:
 	int32 createSurface(SpriteInfo *s, byte **surface);
 	void drawSurface(SpriteInfo *s, byte *surface, Common::Rect *clipRect = NULL);
 	void deleteSurface(byte *surface);
-	int32 drawSprite(SpriteInfo *s);
+	int32 drawSprite(SpriteInfo *s, int32 resource = -1, uint32 frame = 0);
 
 	void scaleImageFast(byte *dst, uint16 dstPitch, uint16 dstWidth,
 		uint16 dstHeight, byte *src, uint16 srcPitch, uint16 srcWidth,
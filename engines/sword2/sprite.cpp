@@ -482,7 +482,7 @@ void Screen::deleteSurface(byte *surface) {
 // FIXME: I'm sure this could be optimized. There's plenty of data copying and
 // mallocing here.
 
-int32 Screen::drawSprite(SpriteInfo *s) {
+int32 Screen::drawSprite(SpriteInfo *s, int32 resource, uint32 frame) {
 	byte *src, *dst;
 	byte *sprite, *newSprite;
 	uint16 scale;
@@ -494,7 +494,15 @@ int32 Screen::drawSprite(SpriteInfo *s) {
 	// -----------------------------------------------------------------
 	// Decompression and mirroring
 	// -----------------------------------------------------------------
-	if (s->type & RDSPR_NOCOMPRESSION) {
+
+	// Compressed PC animation frames are kept once decompressed. The PSX
+	// decoders change the sprite info, so those are not cached.
+	bool cacheable = resource >= 0 && !(s->type & RDSPR_NOCOMPRESSION) && !Sword2Engine::isPsx();
+	byte *cachedSprite = cacheable ? findCachedSprite(resource, frame, s->w * s->h) : NULL;
+
+	if (cachedSprite) {
+		sprite = cachedSprite;
+	} else if (s->type & RDSPR_NOCOMPRESSION) {
 		if (Sword2Engine::isPsx()) { // PSX Uncompressed sprites
 			if (s->w > 254 && !s->isText) { // We need to recompose these frames
 				recomposePsxSprite(s);
@@ -613,6 +621,9 @@ int32 Screen::drawSprite(SpriteInfo *s) {
 		}
 	}
 
+	if (cacheable && !cachedSprite && addCachedSprite(resource, frame, s->w * s->h, sprite))
+		freeSprite = false;
+
 	if (s->type & RDSPR_FLIP) {
 		newSprite = (byte *)malloc(s->w * s->h);
 		if (newSprite == NULL) {
@@ -844,6 +855,53 @@ int32 Screen::drawSprite(SpriteInfo *s) {
 	return RD_OK;
 }
 
+byte *Screen::findCachedSprite(uint32 resource, uint32 frame, uint32 size) {
+	for (Common::List<CachedSprite>::iterator it = _spriteCache.begin(); it != _spriteCache.end(); ++it) {
+		if (it->resource != resource || it->frame != frame || it->size != size)
+			continue;
+
+		CachedSprite entry = *it;
+		_spriteCache.erase(it);
+		_spriteCache.push_front(entry);
+		return entry.data;
+	}
+
+	return NULL;
+}
+
+/**
+ * Keeps a decompressed sprite for later use. On success, the cache takes
+ * over the sprite data.
+ */
+bool Screen::addCachedSprite(uint32 resource, uint32 frame, uint32 size, byte *data) {
+	if (size > SPRITE_CACHE_SIZE)
+		return false;
+
+	while (_spriteCacheSize + size > SPRITE_CACHE_SIZE) {
+		_spriteCacheSize -= _spriteCache.back().size;
+		free(_spriteCache.back().data);
+		_spriteCache.pop_back();
+	}
+
+	CachedSprite entry;
+	entry.resource = resource;
+	entry.frame = frame;
+	entry.size = size;
+	entry.data = data;
+	_spriteCache.push_front(entry);
+	_spriteCacheSize += size;
+
+	return true;
+}
+
+void Screen::clearSpriteCache() {
+	for (Common::List<CachedSprite>::iterator it = _spriteCache.begin(); it != _spriteCache.end(); ++it)
+		free(it->data);
+
+	_spriteCache.clear();
+	_spriteCacheSize = 0;
+}
+
 /**
  * Opens the light masking sprite for a room.
  */
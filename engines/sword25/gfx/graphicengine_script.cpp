@@ -254,6 +254,8 @@ static int endFrame(lua_State *L) {
 
 	lua_pushbooleancpp(L, pGE->endFrame());
 
+	Kernel::getInstance()->getScript()->endFrame();
+
 	return 1;
 }
 
@@ -42,17 +42,12 @@ bool ImgLoader::decodePNGImage(const byte *fileDataPtr, uint fileSize, Graphics:
 	assert(dest);
 	Common::MemoryReadStream *fileStr = new Common::MemoryReadStream(fileDataPtr, fileSize, DisposeAfterUse::NO);
 
+	// Decode straight into the destination, the rows are converted to its
+	// format on the way
 	::Image::PNGDecoder png;
-	if (!png.loadStream(*fileStr)) // the fileStr pointer, and thus pFileData will be deleted after this is done
+	if (!png.loadStreamInto(*fileStr, *dest, Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0)))
 		error("Error while reading PNG image");
 
-	const Graphics::Surface *sourceSurface = png.getSurface();
-	Graphics::Surface *pngSurface = sourceSurface->convertTo(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), png.getPalette());
-
-	dest->copyFrom(*pngSurface);
-
-	pngSurface->free();
-	delete pngSurface;
 	delete fileStr;
 
 	// Signal success
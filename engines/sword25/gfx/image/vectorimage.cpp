@@ -215,7 +215,7 @@ Common::Rect CalculateBoundingBox(const VectorImageElement &vectorImageElement)
 // Construction
 // -----------------------------------------------------------------------------
 
-VectorImage::VectorImage(const byte *pFileData, uint fileSize, bool &success, const Common::String &fname) : _pixelData(0), _fname(fname) {
+VectorImage::VectorImage(const byte *pFileData, uint fileSize, bool &success, const Common::String &fname) : _pixelData(0), _pixelWidth(0), _pixelHeight(0), _fname(fname) {
 	success = false;
 	_bgColor = 0;
 
@@ -616,23 +616,15 @@ bool VectorImage::blit(int posX, int posY,
                        uint color,
                        int width, int height,
 					   RectangleList *updateRects) {
-	static VectorImage *oldThis = 0;
-	static int              oldWidth = -2;
-	static int              oldHeight = -2;
-
 	// If width or height to 0, nothing needs to be shown.
 	if (width == 0 || height == 0)
 		return true;
 
-	// Determine if the old image in the cache can not be reused and must be recalculated
-	if (!(oldThis == this && oldWidth == width && oldHeight == height)) {
+	// Every image keeps its last rendering, which is only recalculated if
+	// it is drawn at a different size
+	if (!_pixelData || _pixelWidth != width || _pixelHeight != height)
 		render(width, height);
 
-		oldThis = this;
-		oldHeight = height;
-		oldWidth = width;
-	}
-
 	RenderedImage *rend = new RenderedImage();
 
 	rend->replaceContent(_pixelData, width, height);
@@ -226,6 +226,8 @@ private:
 	Common::Rect                         _boundingBox;
 
 	byte *_pixelData;
+	int _pixelWidth;	///< The size _pixelData was rendered at
+	int _pixelHeight;
 
 	Common::String _fname;
 	uint _bgColor;
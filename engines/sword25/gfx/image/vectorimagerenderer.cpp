@@ -59,29 +59,22 @@ void art_rgb_fill_run1(byte *buf, byte r, byte g, byte b, int n) {
 }
 
 void art_rgb_run_alpha1(byte *buf, byte r, byte g, byte b, int alpha, int n) {
-	int i;
-	int v;
-
-	for (i = 0; i < n; i++) {
-#if defined(SCUMM_LITTLE_ENDIAN)
-		v = *buf;
-		*buf++ = MIN(v + alpha, 0xff);
-		v = *buf;
-		*buf++ = v + (((b - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((g - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((r - v) * alpha + 0x80) >> 8);
-#else
-		v = *buf;
-		*buf++ = v + (((r - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((g - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((b - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = MIN(v + alpha, 0xff);
-#endif
+	// The pixels hold R, G, B and the alpha in this order from the most
+	// significant byte on, which is A, B, G, R in memory on little endian
+	// systems. The colors are blended two at a time, as
+	// v + (((c - v) * alpha + 0x80) >> 8) equals
+	// (v * (256 - alpha) + c * alpha + 0x80) >> 8, which fits in 16 bits.
+	// The alpha is accumulated instead.
+	uint32 *pixel = (uint32 *)buf;
+	const uint32 inverse = 256 - alpha;
+	const uint32 rb = (((uint32)r << 16) | b) * alpha + 0x00800080;
+	const uint32 g0 = ((uint32)g << 16) * alpha + 0x00800080;
+
+	for (int i = 0; i < n; i++) {
+		const uint32 v = *pixel;
+		const uint32 rbv = (((v >> 8) & 0x00FF00FF) * inverse + rb) & 0xFF00FF00;
+		const uint32 gv = (((v & 0x00FF00FF) * inverse + g0) >> 8) & 0x00FF0000;
+		*pixel++ = rbv | gv | MIN<uint32>((v & 0xFF) + alpha, 0xFF);
 	}
 }
 
@@ -411,6 +404,8 @@ void VectorImage::render(int width, int height) {
 
 	_pixelData = (byte *)malloc(width * height * 4);
 	memset(_pixelData, 0, width * height * 4);
+	_pixelWidth = width;
+	_pixelHeight = height;
 
 	for (uint e = 0; e < _elements.size(); e++) {
 
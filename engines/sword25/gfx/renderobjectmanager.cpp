@@ -47,21 +47,23 @@ namespace Sword25 {
 
 void RenderObjectQueue::add(RenderObject *renderObject) {
 	push_back(RenderObjectQueueItem(renderObject, renderObject->getBbox(), renderObject->getVersion()));
+	_versions[renderObject] = renderObject->getVersion();
 }
 
-bool RenderObjectQueue::exists(const RenderObjectQueueItem &renderObjectQueueItem) {
-	for (RenderObjectQueue::iterator it = begin(); it != end(); ++it)
-		if ((*it)._renderObject == renderObjectQueueItem._renderObject &&
-			(*it)._version == renderObjectQueueItem._version)
-			return true;
-	return false;
+bool RenderObjectQueue::exists(const RenderObjectQueueItem &renderObjectQueueItem) const {
+	Common::HashMap<RenderObject *, int>::const_iterator it = _versions.find(renderObjectQueueItem._renderObject);
+	return it != _versions.end() && it->_value == renderObjectQueueItem._version;
+}
+
+void RenderObjectQueue::clear() {
+	Common::List<RenderObjectQueueItem>::clear();
+	_versions.clear();
 }
 
 RenderObjectManager::RenderObjectManager(int width, int height, int framebufferCount) :
-	_frameStarted(false) {
+	_frameStarted(false), _screenRect(width, height) {
 	// Wurzel des BS_RenderObject-Baumes erzeugen.
 	_rootPtr = (new RootRenderObject(this, width, height))->getHandle();
-	_uta = new MicroTileArray(width, height);
 	_currQueue = new RenderObjectQueue();
 	_prevQueue = new RenderObjectQueue();
 }
@@ -69,7 +71,6 @@ RenderObjectManager::RenderObjectManager(int width, int height, int framebufferC
 RenderObjectManager::~RenderObjectManager() {
 	// Die Wurzel des Baumes lschen, damit werden alle BS_RenderObjects mitgelscht.
 	_rootPtr.erase();
-	delete _uta;
 	delete _currQueue;
 	delete _prevQueue;
 }
@@ -100,21 +101,25 @@ bool RenderObjectManager::render() {
 	_currQueue->clear();
 	_rootPtr->preRender(_currQueue);
 
-	_uta->clear();
+	_dirtyRegion.clear();
 
 	// Add rectangles of objects which don't exist in this frame any more
 	for (RenderObjectQueue::iterator it = _prevQueue->begin(); it != _prevQueue->end(); ++it) {
 		if (!_currQueue->exists(*it))
-			_uta->addRect((*it)._bbox);
+			_dirtyRegion.unite((*it)._bbox);
 	}
 
 	// Add rectangles of objects which are different from the previous frame
 	for (RenderObjectQueue::iterator it = _currQueue->begin(); it != _currQueue->end(); ++it) {
 		if (!_prevQueue->exists(*it))
-			_uta->addRect((*it)._bbox);
+			_dirtyRegion.unite((*it)._bbox);
 	}
 
-	RectangleList *updateRects = _uta->getRectangles();
+	_dirtyRegion.intersect(_screenRect);
+
+	RectangleList *updateRects = new RectangleList();
+	for (Common::Region::const_iterator rectIt = _dirtyRegion.begin(); rectIt != _dirtyRegion.end(); ++rectIt)
+		updateRects->push_back(*rectIt);
 	Common::Array<int> updateRectsMinZ;
 
 	updateRectsMinZ.reserve(updateRects->size());
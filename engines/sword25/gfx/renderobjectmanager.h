@@ -42,15 +42,20 @@
 #ifndef SWORD25_RENDEROBJECTMANAGER_H
 #define SWORD25_RENDEROBJECTMANAGER_H
 
+#include "common/hashmap.h"
+#include "common/hash-ptr.h"
 #include "common/rect.h"
 #include "sword25/kernel/common.h"
 #include "sword25/gfx/renderobjectptr.h"
 #include "sword25/kernel/persistable.h"
 
-#include "sword25/gfx/microtiles.h"
+#include "common/region.h"
 
 namespace Sword25 {
 
+class RectangleList : public Common::List<Common::Rect> {
+};
+
 class Kernel;
 class RenderObject;
 class TimedRenderObject;
@@ -67,7 +72,13 @@ struct RenderObjectQueueItem {
 class RenderObjectQueue : public Common::List<RenderObjectQueueItem> {
 public:
 	void add(RenderObject *renderObject);
-	bool exists(const RenderObjectQueueItem &renderObjectQueueItem);
+	bool exists(const RenderObjectQueueItem &renderObjectQueueItem) const;
+	void clear();
+
+private:
+	// The versions of the objects in the queue, so that comparing two
+	// queues does not have to search them
+	Common::HashMap<RenderObject *, int> _versions;
 };
 
 /**
@@ -131,7 +142,8 @@ private:
 	typedef Common::Array<RenderObjectPtr<TimedRenderObject> > RenderObjectList;
 	RenderObjectList _timedRenderObjects;
 
-	MicroTileArray *_uta;
+	Common::Rect _screenRect;
+	Common::Region _dirtyRegion;
 	RenderObjectQueue *_currQueue, *_prevQueue;
 
 	// RenderObject-Tree Variablen
@@ -99,6 +99,14 @@ void OutputPersistenceBlock::writeMarker(byte marker) {
 void OutputPersistenceBlock::rawWrite(const void *dataPtr, size_t size) {
 	if (size > 0) {
 		uint oldSize = _data.size();
+
+		// resize() only makes room for exactly the new size, which would
+		// copy the whole buffer for each value written
+		uint capacity = INITIAL_BUFFER_SIZE;
+		while (capacity < oldSize + size)
+			capacity *= 2;
+		_data.reserve(capacity);
+
 		_data.resize(oldSize + size);
 		memcpy(&_data[oldSize], dataPtr, size);
 	}
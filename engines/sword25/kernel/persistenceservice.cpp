@@ -332,9 +332,17 @@ bool PersistenceService::saveGame(uint slotID, const Common::String &screenshotF
 		warning("The screenshot file \"%s\" does not exist. Savegame is written without a screenshot.", filename.c_str());
 	}
 
+	// The savefile manager may write the file in the background. err()
+	// waits for that, so that failing to write it is not ignored.
 	file->finalize();
+	const bool written = !file->err();
 	delete file;
 
+	if (!written) {
+		warning("Unable to write savegame file \"%s\".", filename.c_str());
+		return false;
+	}
+
 	// Savegameinformationen fr diesen Slot aktualisieren.
 	_impl->readSlotSavegameInformation(slotID);
 
@@ -29,8 +29,10 @@
  *
  */
 
+#include "common/memorypool.h"
 #include "common/memstream.h"
 #include "common/debug-channels.h"
+#include "common/system.h"
 
 #include "sword25/sword25.h"
 #include "sword25/package/packagemanager.h"
@@ -50,13 +52,62 @@ namespace Sword25 {
 LuaScriptEngine::LuaScriptEngine(Kernel *KernelPtr) :
 	ScriptEngine(KernelPtr),
 	_state(0),
-	_pcallErrorhandlerRegistryIndex(0) {
+	_pcallErrorhandlerRegistryIndex(0),
+	_gcNextCycleKB(0) {
+	for (int i = 0; i < kNumAllocPools; ++i)
+		_allocPools[i] = new Common::MemoryPool((i + 1) * kAllocPoolGranularity);
 }
 
 LuaScriptEngine::~LuaScriptEngine() {
 	// Lua de-initialisation
 	if (_state)
 		lua_close(_state);
+
+	// Lua frees all its memory when it is closed, so the pools are deleted after that
+	for (int i = 0; i < kNumAllocPools; ++i)
+		delete _allocPools[i];
+}
+
+Common::MemoryPool *LuaScriptEngine::getAllocPool(size_t size) {
+	if (size == 0 || size > kNumAllocPools * kAllocPoolGranularity)
+		return 0;
+
+	return _allocPools[(size - 1) / kAllocPoolGranularity];
+}
+
+void *LuaScriptEngine::allocCB(void *ud, void *ptr, size_t osize, size_t nsize) {
+	// Most of what the scripts allocate are small strings, tables and closures,
+	// which are taken from the pools. Larger blocks are left to realloc().
+	LuaScriptEngine *engine = (LuaScriptEngine *)ud;
+	Common::MemoryPool *oldPool = ptr ? engine->getAllocPool(osize) : 0;
+	Common::MemoryPool *newPool = engine->getAllocPool(nsize);
+
+	if (nsize == 0) {
+		if (oldPool)
+			oldPool->freeChunk(ptr);
+		else
+			free(ptr);
+		return 0;
+	}
+
+	if (ptr && oldPool == newPool) {
+		// The block stays in the same pool, or was not in a pool
+		return newPool ? ptr : realloc(ptr, nsize);
+	}
+
+	void *newPtr = newPool ? newPool->allocChunk() : malloc(nsize);
+	if (!newPtr)
+		return 0;
+
+	if (ptr) {
+		memcpy(newPtr, ptr, MIN(osize, nsize));
+		if (oldPool)
+			oldPool->freeChunk(ptr);
+		else
+			free(ptr);
+	}
+
+	return newPtr;
 }
 
 namespace {
@@ -75,7 +126,7 @@ void debugHook(lua_State *L, lua_Debug *ar) {
 
 bool LuaScriptEngine::init() {
 	// Lua-State initialisation, as well as standard libaries initialisation
-	_state = luaL_newstate();
+	_state = lua_newstate(allocCB, this);
 	if (!_state || ! registerStandardLibs() || !registerStandardLibExtensions()) {
 		error("Lua could not be initialized.");
 		return false;
@@ -512,4 +563,21 @@ bool LuaScriptEngine::unpersist(InputPersistenceBlock &reader) {
 	return true;
 }
 
+void LuaScriptEngine::endFrame() {
+	// The incremental collector only runs along with allocations, and may then
+	// take long steps to keep up. Stepping it for a limited time after each
+	// frame instead spreads the work. Once a cycle is finished, the next one
+	// is started when the memory use has doubled, as Lua does by default.
+	if (lua_gc(_state, LUA_GCCOUNT, 0) < _gcNextCycleKB)
+		return;
+
+	const uint32 start = g_system->getMillis();
+	do {
+		if (lua_gc(_state, LUA_GCSTEP, 0)) {
+			_gcNextCycleKB = lua_gc(_state, LUA_GCCOUNT, 0) * 2;
+			break;
+		}
+	} while (g_system->getMillis() - start < 1);
+}
+
 } // End of namespace Sword25
@@ -39,6 +39,10 @@
 
 struct lua_State;
 
+namespace Common {
+class MemoryPool;
+}
+
 namespace Sword25 {
 
 class Kernel;
@@ -93,10 +97,28 @@ public:
 	 */
 	virtual bool unpersist(InputPersistenceBlock &reader);
 
+	/**
+	 * Steps the garbage collector for a limited time
+	 */
+	virtual void endFrame();
+
 private:
+	enum {
+		kAllocPoolGranularity = 16,
+		kNumAllocPools = 8
+	};
+
 	lua_State *_state;
 	int _pcallErrorhandlerRegistryIndex;
 
+	/** Pools for the small blocks Lua allocates, in steps of kAllocPoolGranularity bytes */
+	Common::MemoryPool *_allocPools[kNumAllocPools];
+	/** Memory use in KB at which endFrame() starts the next garbage collection cycle */
+	int _gcNextCycleKB;
+
+	static void *allocCB(void *ud, void *ptr, size_t osize, size_t nsize);
+	Common::MemoryPool *getAllocPool(size_t size);
+
 	bool registerStandardLibs();
 	bool registerStandardLibExtensions();
 	bool executeBuffer(const byte *data, uint size, const Common::String &name) const;
@@ -86,6 +86,12 @@ public:
 
 	virtual bool persist(OutputPersistenceBlock &writer) = 0;
 	virtual bool unpersist(InputPersistenceBlock &reader) = 0;
+
+	/**
+	 * Called after each frame has been drawn. Script engines may use the time
+	 * for housekeeping, like garbage collection.
+	 */
+	virtual void endFrame() {}
 };
 
 } // End of namespace Sword25
@@ -71,97 +71,79 @@ int16 Tinsel_ADPCMStream::decodeTinsel(int16 code, double eVal) {
 	return (int16) CLIP<double>(sample, -32768.0, 32767.0);
 }
 
-int Tinsel4_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
-	int samples;
-	uint16 data;
-	const double eVal = 1.142822265;
-
-	samples = 0;
-
-	assert(numSamples % 2 == 0);
+int Tinsel_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
+	int samples = readBlockSamples(buffer, numSamples);
 
 	while (samples < numSamples && !_stream->eos() && _stream->pos() < _endpos) {
-		if (_blockPos[0] == _blockAlign) {
-			readBufferTinselHeader();
-			_blockPos[0] = 0;
-		}
+		readBufferTinselHeader();
 
-		for (; samples < numSamples && _blockPos[0] < _blockAlign && !_stream->eos() && _stream->pos() < _endpos; samples += 2, _blockPos[0]++) {
-			// Read 1 byte = 8 bits = two 4 bit blocks
-			data = _stream->readByte();
-			buffer[samples] = decodeTinsel((data << 8) & 0xF000, eVal);
-			buffer[samples+1] = decodeTinsel((data << 12) & 0xF000, eVal);
-		}
+		const uint32 size = readBlock(_blockAlign);
+		_blockSamplePos = 0;
+		decodeBlock(size, !_stream->eos() && _stream->pos() < _endpos);
+
+		samples += readBlockSamples(buffer + samples, numSamples - samples);
 	}
 
 	return samples;
 }
 
-int Tinsel6_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
-	int samples;
-	const double eVal = 1.032226562;
+void Tinsel4_ADPCMStream::decodeBlock(uint32 size, bool moreData) {
+	const double eVal = 1.142822265;
 
-	samples = 0;
+	_blockSamples.resize(size * 2);
+	int16 *out = _blockSamples.begin();
 
-	while (samples < numSamples && !_stream->eos() && _stream->pos() < _endpos) {
-		if (_blockPos[0] == _blockAlign) {
-			readBufferTinselHeader();
-			_blockPos[0] = 0;
-			_chunkPos = 0;
-		}
+	for (uint32 i = 0; i < size; i++) {
+		// 1 byte = 8 bits = two 4 bit blocks
+		const byte data = _blockData[i];
+		*out++ = decodeTinsel((data << 8) & 0xF000, eVal);
+		*out++ = decodeTinsel((data << 12) & 0xF000, eVal);
+	}
+}
 
-		for (; samples < numSamples && _blockPos[0] < _blockAlign && !_stream->eos() && _stream->pos() < _endpos; samples++, _chunkPos = (_chunkPos + 1) % 4) {
-
-			switch (_chunkPos) {
-			case 0:
-				_chunkData = _stream->readByte();
-				buffer[samples] = decodeTinsel((_chunkData << 8) & 0xFC00, eVal);
-				break;
-			case 1:
-				_chunkData = (_chunkData << 8) | (_stream->readByte());
-				buffer[samples] = decodeTinsel((_chunkData << 6) & 0xFC00, eVal);
-				_blockPos[0]++;
-				break;
-			case 2:
-				_chunkData = (_chunkData << 8) | (_stream->readByte());
-				buffer[samples] = decodeTinsel((_chunkData << 4) & 0xFC00, eVal);
-				_blockPos[0]++;
-				break;
-			case 3:
-				_chunkData = (_chunkData << 8);
-				buffer[samples] = decodeTinsel((_chunkData << 2) & 0xFC00, eVal);
-				_blockPos[0]++;
-				break;
-			}
+void Tinsel6_ADPCMStream::decodeBlock(uint32 size, bool moreData) {
+	const double eVal = 1.032226562;
 
+	// 3 bytes = 24 bits = four 6 bit blocks. The last block of a chunk
+	// needs no further byte, but is only decoded if the stream goes on.
+	const uint32 chunks = size / 3;
+	const uint32 left = size % 3;
+	_blockSamples.resize(chunks * 4 + left);
+	int16 *out = _blockSamples.begin();
+
+	for (uint32 i = 0; i < size; i += 3) {
+		uint16 chunkData = _blockData[i];
+		*out++ = decodeTinsel((chunkData << 8) & 0xFC00, eVal);
+		if (i + 1 == size)
+			break;
+
+		chunkData = (chunkData << 8) | _blockData[i + 1];
+		*out++ = decodeTinsel((chunkData << 6) & 0xFC00, eVal);
+		if (i + 2 == size)
+			break;
+
+		chunkData = (chunkData << 8) | _blockData[i + 2];
+		*out++ = decodeTinsel((chunkData << 4) & 0xFC00, eVal);
+		if (i + 3 == size && !moreData) {
+			_blockSamples.resize(_blockSamples.size() - 1);
+			break;
 		}
 
+		chunkData = (chunkData << 8);
+		*out++ = decodeTinsel((chunkData << 2) & 0xFC00, eVal);
 	}
-
-	return samples;
 }
 
-int Tinsel8_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
-	int samples;
-	byte data;
+void Tinsel8_ADPCMStream::decodeBlock(uint32 size, bool moreData) {
 	const double eVal = 1.007843258;
 
-	samples = 0;
-
-	while (samples < numSamples && !_stream->eos() && _stream->pos() < _endpos) {
-		if (_blockPos[0] == _blockAlign) {
-			readBufferTinselHeader();
-			_blockPos[0] = 0;
-		}
+	_blockSamples.resize(size);
+	int16 *out = _blockSamples.begin();
 
-		for (; samples < numSamples && _blockPos[0] < _blockAlign && !_stream->eos() && _stream->pos() < _endpos; samples++, _blockPos[0]++) {
-			// Read 1 byte = 8 bits = one 8 bit block
-			data = _stream->readByte();
-			buffer[samples] = decodeTinsel(data << 8, eVal);
-		}
+	for (uint32 i = 0; i < size; i++) {
+		// 1 byte = 8 bits = one 8 bit block
+		*out++ = decodeTinsel(_blockData[i] << 8, eVal);
 	}
-
-	return samples;
 }
 
 
@@ -44,6 +44,13 @@ protected:
 	int16 decodeTinsel(int16, double);
 	void readBufferTinselHeader();
 
+	/**
+	 * Decode the @p size bytes of block data in _blockData into
+	 * _blockSamples. @p moreData tells whether the stream goes on after
+	 * the block.
+	 */
+	virtual void decodeBlock(uint32 size, bool moreData) = 0;
+
 public:
 	Tinsel_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
 		: ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {
@@ -57,43 +64,34 @@ public:
 		memset(&_status, 0, sizeof(_status));
 	}
 
+	virtual int readBuffer(int16 *buffer, const int numSamples);
 };
 
 class Tinsel4_ADPCMStream : public Tinsel_ADPCMStream {
+protected:
+	virtual void decodeBlock(uint32 size, bool moreData);
+
 public:
 	Tinsel4_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
 		: Tinsel_ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {}
-
-	virtual int readBuffer(int16 *buffer, const int numSamples);
 };
 
 class Tinsel6_ADPCMStream : public Tinsel_ADPCMStream {
 protected:
-	uint8 _chunkPos;
-	uint16 _chunkData;
-
-	void reset() {
-		ADPCMStream::reset();
-		_chunkPos = 0;
-		_chunkData = 0;
-	}
+	virtual void decodeBlock(uint32 size, bool moreData);
 
 public:
 	Tinsel6_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
-		: Tinsel_ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {
-		_chunkPos = 0;
-		_chunkData = 0;
-	}
-
-	virtual int readBuffer(int16 *buffer, const int numSamples);
+		: Tinsel_ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {}
 };
 
 class Tinsel8_ADPCMStream : public Tinsel_ADPCMStream {
+protected:
+	virtual void decodeBlock(uint32 size, bool moreData);
+
 public:
 	Tinsel8_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
 		: Tinsel_ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {}
-
-	virtual int readBuffer(int16 *buffer, const int numSamples);
 };
 
 
@@ -343,6 +343,9 @@ BMVPlayer::BMVPlayer() {
 	numAdvancePackets = 0;
 	nextReadSlot = 0;
 	bFileEnd = 0;
+	slotBuffer = 0;
+	slotBufferLength = 0;
+	bSlotReadPending = false;
 
 	memset(moviePal, 0, sizeof(moviePal));
 
@@ -661,6 +664,49 @@ void BMVPlayer::LoadSlots(int number) {
 	}
 }
 
+/**
+ * Reads the next slot of the movie file into slotBuffer.
+ * Runs on a worker thread.
+ */
+void BMVPlayer::ReadSlotProc(void *param) {
+	BMVPlayer *bmv = (BMVPlayer *)param;
+
+	bmv->slotBufferLength = bmv->stream.read(bmv->slotBuffer, SLOT_SIZE);
+}
+
+/**
+ * Copies the next slot of the movie file to dest, and starts reading the
+ * one after it in the background, so a slow disk doesn't hold up playback.
+ * Returns the number of bytes read.
+ */
+uint32 BMVPlayer::ReadSlot(byte *dest) {
+	if (!bSlotReadPending)
+		JobMan.submit(ReadSlotProc, this, slotCounter);
+
+	JobMan.wait(slotCounter);
+	memcpy(dest, slotBuffer, slotBufferLength);
+	const uint32 length = slotBufferLength;
+
+	if (length == SLOT_SIZE) {
+		JobMan.submit(ReadSlotProc, this, slotCounter);
+		bSlotReadPending = true;
+	} else {
+		bSlotReadPending = false;
+	}
+
+	return length;
+}
+
+/**
+ * Waits for a slot being read in the background.
+ */
+void BMVPlayer::FinishSlotRead() {
+	if (bSlotReadPending) {
+		JobMan.wait(slotCounter);
+		bSlotReadPending = false;
+	}
+}
+
 /**
  * Called from the foreground when starting playback of a movie.
  */
@@ -678,6 +724,11 @@ void BMVPlayer::InitializeBMV() {
 	if (screenBuffer == NULL)
 		error(NO_MEM, "FMV screen buffer");
 
+	// Read ahead buffer
+	slotBuffer = (byte *)malloc(SLOT_SIZE);
+	if (slotBuffer == NULL)
+		error(NO_MEM, "FMV read ahead buffer");
+
 	// Pass the sceen buffer to the decompresser
 	InitBMV(screenBuffer);
 
@@ -719,10 +770,15 @@ void BMVPlayer::FinishBMV() {
 	// Notify the sound channel
 	FinishMovieSound();
 
-	// Close the file stream
+	// Close the file stream, once it isn't read from anymore
+	FinishSlotRead();
 	if (stream.isOpen())
 		stream.close();
 
+	// Release the read ahead buffer
+	free(slotBuffer);
+	slotBuffer = NULL;
+
 	// Release the data buffer
 	free(bigBuffer);
 	bigBuffer = NULL;
@@ -812,7 +868,7 @@ bool BMVPlayer::MaintainBuffer() {
 		return false;
 	}
 
-	if (stream.read(bigBuffer + nextReadSlot * SLOT_SIZE, SLOT_SIZE) != SLOT_SIZE) {
+	if (ReadSlot(bigBuffer + nextReadSlot * SLOT_SIZE) != SLOT_SIZE) {
 		bFileEnd = true;
 	}
 
@@ -26,6 +26,7 @@
 
 #include "common/coroutines.h"
 #include "common/file.h"
+#include "common/jobs.h"
 
 #include "audio/mixer.h"
 
@@ -86,6 +87,14 @@ class BMVPlayer {
 	/// Set when the whole file has been read
 	bool bFileEnd;
 
+	/// The next slot of the file, read ahead in the background
+	byte *slotBuffer;
+	uint32 slotBufferLength;
+	Common::JobSystem::Counter slotCounter;
+
+	/// Set while slotBuffer is being or has been read ahead
+	bool bSlotReadPending;
+
 	/// Palette
 	COLORREF moviePal[256];
 
@@ -147,6 +156,9 @@ private:
 	int MovieCommand(char cmd, int commandOffset);
 	int FollowingPacket(int thisPacket, bool bReallyImportant);
 	void LoadSlots(int number);
+	static void ReadSlotProc(void *param);
+	uint32 ReadSlot(byte *dest);
+	void FinishSlotRead();
 	void InitializeBMV();
 	bool MaintainBuffer();
 	bool DoBMVFrame();
@@ -27,6 +27,8 @@
 #include "tinsel/palette.h"
 #include "tinsel/tinsel.h"		// for _vm
 
+#include "common/region.h"
+
 namespace Tinsel {
 
 /**
@@ -80,22 +82,6 @@ bool UnionRectangle(Common::Rect &pDest, const Common::Rect &pSrc1, const Common
 	return !pDest.isEmpty();
 }
 
-/**
- * Check if the two rectangles are next to each other.
- * @param pSrc1			a source rectangle
- * @param pSrc2			a source rectangle
- */
-static bool LooseIntersectRectangle(const Common::Rect &pSrc1, const Common::Rect &pSrc2) {
-	Common::Rect pDest;
-
-	pDest.left   = MAX(pSrc1.left, pSrc2.left);
-	pDest.top    = MAX(pSrc1.top, pSrc2.top);
-	pDest.right  = MIN(pSrc1.right, pSrc2.right);
-	pDest.bottom = MIN(pSrc1.bottom, pSrc2.bottom);
-
-	return pDest.isValidRect();
-}
-
 /**
  * Adds velocities and creates clipping rectangles for all the
  * objects that have moved on the specified object list.
@@ -168,6 +154,10 @@ void FindMovingObjects(OBJECT **pObjList, Common::Point *pWin, Common::Rect *pCl
 /**
  * Merges any clipping rectangles that overlap to try and reduce
  * the total number of clip rectangles.
+ * The rectangles are replaced by the disjoint rectangles of their union,
+ * so no area gets redrawn twice. When that union covers most of its
+ * bounding rectangle, the bounding rectangle is used instead, as every
+ * clip rectangle costs a pass over the display lists.
  */
 void MergeClipRect() {
 	RectList &s_rectList = _vm->_clipRects;
@@ -175,25 +165,19 @@ void MergeClipRect() {
 	if (s_rectList.size() <= 1)
 		return;
 
-	RectList::iterator rOuter, rInner;
-
-	for (rOuter = s_rectList.begin(); rOuter != s_rectList.end(); ++rOuter) {
-		rInner = rOuter;
-		while (++rInner != s_rectList.end()) {
+	Common::Region region;
+	for (RectList::const_iterator r = s_rectList.begin(); r != s_rectList.end(); ++r)
+		region.unite(*r);
 
-			if (LooseIntersectRectangle(*rOuter, *rInner)) {
-				// these two rectangles overlap or
-				// are next to each other - merge them
+	s_rectList.clear();
 
-				UnionRectangle(*rOuter, *rOuter, *rInner);
-
-				// remove the inner rect from the list
-				s_rectList.erase(rInner);
-
-				// move back to beginning of list
-				rInner = rOuter;
-			}
-		}
+	const Common::Rect rcBounds = region.getBounds();
+	if ((uint32)rcBounds.width() * rcBounds.height() * 3 <= region.getArea() * 4) {
+		// at most a quarter of the bounding rectangle is unchanged
+		s_rectList.push_back(rcBounds);
+	} else {
+		for (Common::Region::const_iterator r = region.begin(); r != region.end(); ++r)
+			s_rectList.push_back(*r);
 	}
 }
 
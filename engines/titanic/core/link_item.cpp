@@ -169,7 +169,7 @@ void CLinkItem::setDestination(int roomNumber, int nodeNumber,
 	_viewNumber = viewNumber;
 	_linkMode = linkMode;
 
-	_name = formName();
+	setName(formName());
 }
 
 CViewItem *CLinkItem::getDestView() const {
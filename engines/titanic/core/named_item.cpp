@@ -51,6 +51,11 @@ void CNamedItem::load(SimpleFile *file) {
 	CTreeItem::load(file);
 }
 
+void CNamedItem::setName(const CString &name) {
+	_name = name;
+	++_linkChanges;
+}
+
 bool CNamedItem::isEquals(const CString &name, bool startsWith) const {
 	if (startsWith) {
 		return getName().left(name.size()).compareToIgnoreCase(name) == 0;
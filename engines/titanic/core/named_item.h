@@ -58,6 +58,11 @@ public:
 	 */
 	virtual const CString getName() const { return _name; }
 
+	/**
+	 * Renames the item, keeping name lookups of the project up to date
+	 */
+	void setName(const CString &name);
+
 	/**
 	 * Returns true if the item's name matches a passed name
 	 */
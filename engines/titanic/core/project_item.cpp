@@ -73,7 +73,40 @@ void CFileListItem::load(SimpleFile *file) {
 /*------------------------------------------------------------------------*/
 
 CProjectItem::CProjectItem() : _nextRoomNumber(0), _nextMessageNumber(0),
-		_nextObjectNumber(0), _gameManager(nullptr) {
+		_nextObjectNumber(0), _gameManager(nullptr), _nameIndexChanges(0),
+		_nameIndexValid(false) {
+}
+
+CTreeItem *CProjectItem::findItemByName(const CString &name) {
+	if (!_nameIndexValid || _nameIndexChanges != _linkChanges) {
+		_nameIndex.clear();
+
+		for (CTreeItem *treeItem = this; treeItem; treeItem = treeItem->scan(this)) {
+			const CString itemName = treeItem->getName();
+			if (!_nameIndex.contains(itemName))
+				_nameIndex[itemName] = treeItem;
+		}
+
+		_nameIndexChanges = _linkChanges;
+		_nameIndexValid = true;
+	}
+
+	// Names should be changed through setName(), but some are assigned
+	// directly. Make sure a hit still matches, and that a miss really is one.
+	NameIndex::const_iterator i = _nameIndex.find(name);
+	if (i != _nameIndex.end() && i->_value->getName().equalsIgnoreCase(name))
+		return i->_value;
+
+	for (CTreeItem *treeItem = this; treeItem; treeItem = treeItem->scan(this)) {
+		if (treeItem->getName().equalsIgnoreCase(name)) {
+			_nameIndexValid = false;
+			return treeItem;
+		}
+	}
+
+	if (i != _nameIndex.end())
+		_nameIndexValid = false;
+	return nullptr;
 }
 
 void CProjectItem::save(SimpleFile *file, int indent) {
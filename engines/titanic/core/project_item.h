@@ -24,6 +24,8 @@
 #define TITANIC_PROJECT_ITEM_H
 
 #include "common/scummsys.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
 #include "common/str.h"
 #include "engines/savestate.h"
 #include "graphics/surface.h"
@@ -92,6 +94,11 @@ private:
 	int _nextObjectNumber;
 	CGameManager *_gameManager;
 
+	typedef Common::HashMap<Common::String, CTreeItem *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> NameIndex;
+	NameIndex _nameIndex;
+	uint _nameIndexChanges;
+	bool _nameIndexValid;
+
 	/**
 	 * Called during save, iterates through the children to do some stuff
 	 */
@@ -171,6 +178,14 @@ public:
 	 */
 	virtual void load(SimpleFile *file);
 
+	/**
+	 * Finds the first item in the project with the given name, ignoring
+	 * case, the same item a scan of the whole tree would find. Uses an
+	 * index that is rebuilt when items have been linked or destroyed
+	 * since it was last built.
+	 */
+	CTreeItem *findItemByName(const CString &name);
+
 	/**
 	 * Get the game manager for the project
 	 */
@@ -40,10 +40,16 @@ namespace Titanic {
 
 EMPTY_MESSAGE_MAP(CTreeItem, CMessageTarget);
 
+uint CTreeItem::_linkChanges;
+
 CTreeItem::CTreeItem() : _parent(nullptr), _firstChild(nullptr),
 	_nextSibling(nullptr), _priorSibling(nullptr), _field14(0) {
 }
 
+CTreeItem::~CTreeItem() {
+	++_linkChanges;
+}
+
 void CTreeItem::dump(int indent) {
 	CString line = dumpItem(indent);
 	debug("%s", line.c_str());
@@ -186,6 +192,7 @@ void CTreeItem::addUnder(CTreeItem *newParent) {
 }
 
 void CTreeItem::setParent(CTreeItem *newParent) {
+	++_linkChanges;
 	_parent = newParent;
 	_priorSibling = nullptr;
 	_nextSibling = newParent->_firstChild;
@@ -196,6 +203,7 @@ void CTreeItem::setParent(CTreeItem *newParent) {
 }
 
 void CTreeItem::addSibling(CTreeItem *item) {
+	++_linkChanges;
 	_priorSibling = item;
 	_nextSibling = item->_nextSibling;
 	_parent = item->_parent;
@@ -240,6 +248,8 @@ int CTreeItem::destroyChildren() {
 }
 
 void CTreeItem::detach() {
+	++_linkChanges;
+
 	// Delink this item from any prior and/or next siblings
 	if (_priorSibling)
 		_priorSibling->_nextSibling = _nextSibling;
@@ -253,6 +263,7 @@ void CTreeItem::detach() {
 }
 
 void CTreeItem::attach(CTreeItem *item) {
+	++_linkChanges;
 	_nextSibling = item;
 	_priorSibling = item->_priorSibling;
 	_parent = item->_parent;
@@ -266,18 +277,21 @@ void CTreeItem::attach(CTreeItem *item) {
 }
 
 CNamedItem *CTreeItem::findByName(const CString &name, bool subMatch) {
-	CString nameLower = name;
-	nameLower.toLowercase();
+	// Whole names looked up from the root use the index of the project
+	if (!subMatch && !_parent) {
+		CProjectItem *project = dynamic_cast<CProjectItem *>(this);
+		if (project)
+			return dynamic_cast<CNamedItem *>(project->findItemByName(name));
+	}
 
 	for (CTreeItem *treeItem = this; treeItem; treeItem = treeItem->scan(this)) {
-		CString itemName = treeItem->getName();
-		itemName.toLowercase();
+		const CString itemName = treeItem->getName();
 
 		if (subMatch) {
-			if (!itemName.left(nameLower.size()).compareTo(nameLower))
+			if (itemName.hasPrefixIgnoreCase(name))
 				return dynamic_cast<CNamedItem *>(treeItem);
 		} else {
-			if (!itemName.compareTo(nameLower))
+			if (itemName.equalsIgnoreCase(name))
 				return dynamic_cast<CNamedItem *>(treeItem);
 		}
 	}
@@ -44,9 +44,17 @@ private:
 	CTreeItem *_priorSibling;
 	CTreeItem *_firstChild;
 	int _field14;
+public:
+	/**
+	 * Incremented whenever items are linked into or out of any tree,
+	 * renamed or destroyed, so lookups can tell when cached results are
+	 * stale
+	 */
+	static uint _linkChanges;
 public:
 	CLASSDEF;
 	CTreeItem();
+	virtual ~CTreeItem();
 
 
 	/**
@@ -104,7 +104,7 @@ bool CParrotLobbyLinkUpdater::ActMsg(CActMsg *msg) {
 				if (val)
 					linkName += (char)(0x60 + val);
 
-				link->_name = linkName;
+				link->setName(linkName);
 				break;
 			}
 		}
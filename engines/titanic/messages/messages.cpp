@@ -73,12 +73,11 @@ bool CMessage::execute(CTreeItem *target, const ClassDef *classDef, int flags) {
 }
 
 bool CMessage::execute(const CString &target, const ClassDef *classDef, int flags) {
-	// Scan for the target by name
+	// Look up the target by name
 	CProjectItem *project = g_vm->_window->_project;
-	for (CTreeItem *treeItem = project; treeItem; treeItem = treeItem->scan(project)) {
-		if (!treeItem->getName().compareToIgnoreCase(target))
-			return execute(treeItem, classDef, flags);
-	}
+	CTreeItem *treeItem = project->findItemByName(target);
+	if (treeItem)
+		return execute(treeItem, classDef, flags);
 
 	return false;
 }
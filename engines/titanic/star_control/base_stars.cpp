@@ -28,6 +28,16 @@
 #include "titanic/support/simple_file.h"
 #include "titanic/titanic.h"
 
+// The stars are transformed four components at a time with SSE2 or NEON,
+// where available.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TITANIC_STARS_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TITANIC_STARS_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace Titanic {
 
 CBaseStarEntry::CBaseStarEntry() : _red(0), _value(0.0) {
@@ -126,8 +136,59 @@ void CBaseStars::resetEntry(CBaseStarEntry &entry) {
 		entry._data[idx] = 0;
 }
 
+void CBaseStars::transformStars(const FPose &pose) {
+	_transformed.resize(_data.size());
+
+	// The sums are done in the same order as a scalar
+	// x * row1 + y * row2 + z * row3 + vector would, so the
+	// results do not depend on the instruction set
+#if defined(TITANIC_STARS_USE_SSE2)
+	const __m128 row1 = _mm_set_ps(0.0f, pose._row1._z, pose._row1._y, pose._row1._x);
+	const __m128 row2 = _mm_set_ps(0.0f, pose._row2._z, pose._row2._y, pose._row2._x);
+	const __m128 row3 = _mm_set_ps(0.0f, pose._row3._z, pose._row3._y, pose._row3._x);
+	const __m128 vector = _mm_set_ps(0.0f, pose._vector._z, pose._vector._y, pose._vector._x);
+
+	for (uint idx = 0; idx < _data.size(); ++idx) {
+		const FVector &position = _data[idx]._position;
+		__m128 sum = _mm_mul_ps(_mm_set1_ps(position._x), row1);
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(position._y), row2));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(position._z), row3));
+		_mm_storeu_ps(&_transformed[idx]._x, _mm_add_ps(sum, vector));
+	}
+#elif defined(TITANIC_STARS_USE_NEON)
+	const float row1Data[4] = { pose._row1._x, pose._row1._y, pose._row1._z, 0.0f };
+	const float row2Data[4] = { pose._row2._x, pose._row2._y, pose._row2._z, 0.0f };
+	const float row3Data[4] = { pose._row3._x, pose._row3._y, pose._row3._z, 0.0f };
+	const float vectorData[4] = { pose._vector._x, pose._vector._y, pose._vector._z, 0.0f };
+	const float32x4_t row1 = vld1q_f32(row1Data);
+	const float32x4_t row2 = vld1q_f32(row2Data);
+	const float32x4_t row3 = vld1q_f32(row3Data);
+	const float32x4_t vector = vld1q_f32(vectorData);
+
+	for (uint idx = 0; idx < _data.size(); ++idx) {
+		const FVector &position = _data[idx]._position;
+		// Separate multiplies and adds, a fused multiply-add would round differently
+		float32x4_t sum = vmulq_f32(vdupq_n_f32(position._x), row1);
+		sum = vaddq_f32(sum, vmulq_f32(vdupq_n_f32(position._y), row2));
+		sum = vaddq_f32(sum, vmulq_f32(vdupq_n_f32(position._z), row3));
+		vst1q_f32(&_transformed[idx]._x, vaddq_f32(sum, vector));
+	}
+#else
+	for (uint idx = 0; idx < _data.size(); ++idx) {
+		const FVector &position = _data[idx]._position;
+		TransformedStar &star = _transformed[idx];
+		star._x = position._x * pose._row1._x + position._y * pose._row2._x + position._z * pose._row3._x + pose._vector._x;
+		star._y = position._x * pose._row1._y + position._y * pose._row2._y + position._z * pose._row3._y + pose._vector._y;
+		star._z = position._x * pose._row1._z + position._y * pose._row2._z + position._z * pose._row3._z + pose._vector._z;
+		star._w = 0.0f;
+	}
+#endif
+}
+
 void CBaseStars::draw(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup) {
 	if (!_data.empty()) {
+		transformStars(camera->getPose());
+
 		switch (camera->getStarColor()) {
 		case WHITE: // draw white, green, and red stars (mostly white)
 			switch (surfaceArea->_bpp) {
@@ -177,13 +238,13 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	for (uint idx = 0; idx < _data.size(); ++idx) {
 		CBaseStarEntry &entry = _data[idx];
 		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
+		const TransformedStar &star = _transformed[idx];
+		tempZ = star._z;
 		if (tempZ <= minVal)
 			continue;
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
+		tempY = star._y;
+		tempX = star._x;
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ; 
 
 		if (total2 < 1.0e12) {
@@ -262,13 +323,13 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	for (uint idx = 0; idx < _data.size(); ++idx) {
 		CBaseStarEntry &entry = _data[idx];
 		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
+		const TransformedStar &star = _transformed[idx];
+		tempZ = star._z;
 		if (tempZ <= minVal)
 			continue;
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
+		tempY = star._y;
+		tempX = star._x;
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
 		if (total2 < 1.0e12) {
@@ -351,13 +412,13 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	for (uint idx = 0; idx < _data.size(); ++idx) {
 		CBaseStarEntry &entry = _data[idx];
 		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
+		const TransformedStar &star = _transformed[idx];
+		tempZ = star._z;
 		if (tempZ <= minVal)
 			continue;
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
+		tempY = star._y;
+		tempX = star._x;
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
 		if (total2 < 1.0e12) {
@@ -458,13 +519,13 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 		const CBaseStarEntry &entry = _data[idx];
 		const FVector &vector = entry._position;
 
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
+		const TransformedStar &star = _transformed[idx];
+		tempZ = star._z;
 		if (tempZ <= minVal)
 			continue;
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
+		tempY = star._y;
+		tempX = star._x;
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
 		if (total2 < 1.0e12) {
@@ -74,6 +74,21 @@ struct CStarPosition : public Common::Point {
  */
 class CBaseStars {
 private:
+	/**
+	 * Position of a star relative to the camera, padded for SIMD
+	 */
+	struct TransformedStar {
+		float _x, _y, _z, _w;
+	};
+
+	Common::Array<TransformedStar> _transformed;
+private:
+	/**
+	 * Transforms the positions of all the stars by the camera pose
+	 * in one pass, ahead of drawing them
+	 */
+	void transformStars(const FPose &pose);
+
 	void draw1(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
 	void draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
 	void draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
@@ -35,6 +35,12 @@ namespace Titanic {
 
 #define DEFAULT_FPS 15.0
 
+// Memory available for frames in the frame cache
+#define FRAME_CACHE_SIZE (8 * 1024 * 1024)
+
+Common::List<AVISurface::CachedFrame *> *AVISurface::_frameCache;
+uint AVISurface::_frameCacheSize;
+
 Video::AVIDecoder::AVIVideoTrack &AVIDecoder::getVideoTrack(uint idx) {
 	assert(idx < _videoTracks.size());
 	AVIVideoTrack *track = static_cast<AVIVideoTrack *>(_videoTracks[idx].track);
@@ -47,6 +53,7 @@ AVISurface::AVISurface(const CResourceKey &key) : _movieName(key.getString()) {
 	_movieFrameSurface[0] = _movieFrameSurface[1] = nullptr;
 	_framePixels = false;
 	_priorFrameTime = 0;
+	_decoderBehind = false;
 
 	// Reset current frame. We need to keep track of frames separately from the decoder,
 	// since it needs to be able to go beyond the frame count or to negative to allow
@@ -74,6 +81,14 @@ AVISurface::AVISurface(const CResourceKey &key) : _movieName(key.getString()) {
 }
 
 AVISurface::~AVISurface() {
+	if (_frameCache) {
+		for (Common::List<CachedFrame *>::iterator i = _frameCache->begin(); i != _frameCache->end(); ) {
+			Common::List<CachedFrame *>::iterator cur = i++;
+			if ((*cur)->_owner == this)
+				removeCachedFrame(cur);
+		}
+	}
+
 	if (_videoSurface)
 		_videoSurface->_flipVertically = false;
 	delete _movieFrameSurface[0];
@@ -81,6 +96,18 @@ AVISurface::~AVISurface() {
 	delete _decoder;
 }
 
+void AVISurface::init() {
+	_frameCache = new Common::List<CachedFrame *>();
+	_frameCacheSize = 0;
+}
+
+void AVISurface::deinit() {
+	while (!_frameCache->empty())
+		removeCachedFrame(_frameCache->begin());
+	delete _frameCache;
+	_frameCache = nullptr;
+}
+
 bool AVISurface::play(uint flags, CGameObject *obj) {
 	if (flags & MOVIE_REVERSE)
 		return play(_decoder->getFrameCount() - 1, 0, flags, obj);
@@ -176,7 +203,11 @@ void AVISurface::seekToFrame(uint frameNumber) {
 	if (isReversed() && frameNumber == _decoder->getFrameCount())
 		--frameNumber;
 
-	if ((int)frameNumber != _currentFrame) {
+	// A frame shown from the frame cache was not decoded, so the
+	// decoder has to catch up even if it's the same frame
+	if ((int)frameNumber != _currentFrame || _decoderBehind) {
+		_decoderBehind = false;
+
 		if (!isReversed() && frameNumber > 0) {
 			_decoder->seekToFrame(frameNumber - 1);
 			renderFrame();
@@ -359,8 +390,81 @@ void AVISurface::setFrame(int frameNumber) {
 	if (frameNumber >= (int)_decoder->getFrameCount())
 		frameNumber = _decoder->getFrameCount() - 1;
 
+	// Frames shown this way are often shown again, such as when
+	// switching back and forth between views
+	if ((frameNumber != _currentFrame || _decoderBehind) && showCachedFrame(frameNumber))
+		return;
+
 	seekToFrame(frameNumber);
-	renderFrame();
+	if (_decoder->needsUpdate()) {
+		renderFrame();
+		cacheFrame(frameNumber);
+	}
+}
+
+bool AVISurface::showCachedFrame(int frameNumber) {
+	for (Common::List<CachedFrame *>::iterator i = _frameCache->begin(); i != _frameCache->end(); ++i) {
+		CachedFrame *frame = *i;
+		if (frame->_owner != this || frame->_frameNumber != frameNumber)
+			continue;
+
+		for (int idx = 0; idx < _streamCount; ++idx) {
+			if (!_movieFrameSurface[idx])
+				_movieFrameSurface[idx] = new Graphics::ManagedSurface(frame->_surfaces[idx]->w,
+					frame->_surfaces[idx]->h, frame->_surfaces[idx]->format);
+			_movieFrameSurface[idx]->blitFrom(*frame->_surfaces[idx]);
+		}
+		copyToVideoSurface();
+
+		_currentFrame = _priorFrame = frameNumber;
+		_decoderBehind = true;
+
+		// Move it to the front as the most recently used frame
+		_frameCache->erase(i);
+		_frameCache->push_front(frame);
+		return true;
+	}
+
+	return false;
+}
+
+void AVISurface::cacheFrame(int frameNumber) {
+	uint size = 0;
+	for (int idx = 0; idx < _streamCount; ++idx) {
+		if (!_movieFrameSurface[idx])
+			return;
+		size += _movieFrameSurface[idx]->pitch * _movieFrameSurface[idx]->h;
+	}
+
+	if (size > FRAME_CACHE_SIZE / 4)
+		return;
+
+	while (!_frameCache->empty() && _frameCacheSize + size > FRAME_CACHE_SIZE)
+		removeCachedFrame(--_frameCache->end());
+
+	CachedFrame *frame = new CachedFrame();
+	frame->_owner = this;
+	frame->_frameNumber = frameNumber;
+	frame->_size = size;
+	frame->_surfaces[0] = frame->_surfaces[1] = nullptr;
+	for (int idx = 0; idx < _streamCount; ++idx) {
+		const Graphics::ManagedSurface &src = *_movieFrameSurface[idx];
+		frame->_surfaces[idx] = new Graphics::ManagedSurface(src.w, src.h, src.format);
+		frame->_surfaces[idx]->blitFrom(src);
+	}
+
+	_frameCache->push_front(frame);
+	_frameCacheSize += size;
+}
+
+void AVISurface::removeCachedFrame(Common::List<CachedFrame *>::iterator i) {
+	CachedFrame *frame = *i;
+	_frameCacheSize -= frame->_size;
+	_frameCache->erase(i);
+
+	delete frame->_surfaces[0];
+	delete frame->_surfaces[1];
+	delete frame;
 }
 
 bool AVISurface::isNextFrame() {
@@ -405,6 +509,11 @@ bool AVISurface::renderFrame() {
 		}
 	}
 
+	copyToVideoSurface();
+	return false;
+}
+
+void AVISurface::copyToVideoSurface() {
 	if (!_framePixels) {
 		if (_videoSurface->lock()) {
 			// Blit the frame directly to the video surface
@@ -432,8 +541,6 @@ bool AVISurface::renderFrame() {
 
 		_videoSurface->unlock();
 	}
-
-	return false;
 }
 
 bool AVISurface::addEvent(int *frameNumber, CGameObject *obj) {
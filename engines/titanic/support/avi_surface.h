@@ -23,6 +23,7 @@
 #ifndef TITANIC_AVI_SURFACE_H
 #define TITANIC_AVI_SURFACE_H
 
+#include "common/list.h"
 #include "common/stream.h"
 #include "video/avi_decoder.h"
 #include "graphics/managed_surface.h"
@@ -98,6 +99,22 @@ public:
 };
 
 class AVISurface {
+private:
+	/**
+	 * A copy of the frame surfaces of a movie frame shown by setFrame
+	 */
+	struct CachedFrame {
+		AVISurface *_owner;
+		int _frameNumber;
+		Graphics::ManagedSurface *_surfaces[2];
+		uint _size;
+	};
+
+	/**
+	 * Cached frames of all movies, most recently used first
+	 */
+	static Common::List<CachedFrame *> *_frameCache;
+	static uint _frameCacheSize;
 private:
 	AVIDecoder *_decoder;
 	CVideoSurface *_videoSurface;
@@ -109,12 +126,33 @@ private:
 	int _currentFrame, _priorFrame;
 	uint32 _priorFrameTime;
 	Common::String _movieName;
+	bool _decoderBehind;
 private:
 	/**
 	 * Render a frame to the video surface
 	 */
 	bool renderFrame();
 
+	/**
+	 * Copies the frame surfaces to the video surface
+	 */
+	void copyToVideoSurface();
+
+	/**
+	 * Shows a frame from the frame cache, if it's present
+	 */
+	bool showCachedFrame(int frameNumber);
+
+	/**
+	 * Adds the current frame surfaces to the frame cache
+	 */
+	void cacheFrame(int frameNumber);
+
+	/**
+	 * Removes a frame from the frame cache
+	 */
+	static void removeCachedFrame(Common::List<CachedFrame *>::iterator i);
+
 	/**
 	 * Sets up for video decompression
 	 */
@@ -146,6 +184,16 @@ public:
 	AVISurface(const CResourceKey &key);
 	virtual ~AVISurface();
 
+	/**
+	 * Initializes statics
+	 */
+	static void init();
+
+	/**
+	 * Deinitializes statics
+	 */
+	static void deinit();
+
 	/**
 	 * Start playing the loaded AVI video
 	 */
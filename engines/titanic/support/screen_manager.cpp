@@ -103,6 +103,7 @@ void OSScreenManager::setMode(int width, int height, int bpp, uint numBackSurfac
 	_directDrawManager.initVideo(width, height, bpp, numBackSurfaces);
 
 	_vm->_screen->create(width, height, g_system->getScreenFormat());
+	_vm->_screen->useScreenBuffer();
 	_frontRenderSurface = new OSVideoSurface(this, nullptr);
 	_frontRenderSurface->setSurface(this, _directDrawManager._mainSurface);
 
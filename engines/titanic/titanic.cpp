@@ -38,6 +38,7 @@
 #include "titanic/pet_control/pet_control.h"
 #include "titanic/sound/music_room.h"
 #include "titanic/sound/music_room_instrument.h"
+#include "titanic/support/avi_surface.h"
 #include "titanic/support/files_manager.h"
 #include "titanic/support/simple_file.h"
 #include "titanic/true_talk/tt_npc_script.h"
@@ -102,6 +103,7 @@ bool TitanicEngine::initialize() {
 	CGetLiftEye2::init();
 	CHose::init();
 	CMovie::init();
+	AVISurface::init();
 	CMusicRoomInstrument::init();
 	CParrotLobbyObject::init();
 	CSGTNavigation::init();
@@ -146,6 +148,7 @@ void TitanicEngine::deinitialize() {
 	CTelevision::deinit();
 	TTnpcScript::deinit();
 	CMovie::deinit();
+	AVISurface::deinit();
 	CSaveableObject::freeClassList();
 }
 
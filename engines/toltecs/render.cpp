@@ -40,13 +40,11 @@ Common::Rect makeRect(int16 x, int16 y, int16 width, int16 height) {
 RenderQueue::RenderQueue(ToltecsEngine *vm) : _vm(vm) {
 	_currQueue = new RenderQueueArray();
 	_prevQueue = new RenderQueueArray();
-	_updateUta = new MicroTileArray(640, 400);
 }
 
 RenderQueue::~RenderQueue() {
 	delete _currQueue;
 	delete _prevQueue;
-	delete _updateUta;
 }
 
 void RenderQueue::addSprite(SpriteDrawItem &sprite) {
@@ -114,7 +112,7 @@ void RenderQueue::update() {
 
 	bool doFullRefresh = _vm->_screen->_fullRefresh;
 
-	_updateUta->clear();
+	_updateRegion.clear();
 
 	if (!doFullRefresh) {
 
@@ -275,35 +273,41 @@ void RenderQueue::invalidateItemsByRect(const Common::Rect &rect, const RenderQu
 }
 
 void RenderQueue::addDirtyRect(const Common::Rect &rect) {
-	_updateUta->addRect(rect);
+	_updateRegion.unite(rect);
+}
+
+void RenderQueue::getDirtyRects(Common::List<Common::Rect> &rects) {
+	Common::Region region = _updateRegion;
+	region.intersect(Common::Rect(640, _vm->_cameraHeight));
+
+	for (Common::Region::const_iterator rect = region.begin(); rect != region.end(); ++rect)
+		rects.push_back(*rect);
 }
 
 void RenderQueue::restoreDirtyBackground() {
-	int n_rects = 0;
-	Common::Rect *rects = _updateUta->getRectangles(&n_rects, 0, 0, 639, _vm->_cameraHeight - 1);
-	for (int i = 0; i < n_rects; i++) {
-		byte *destp = _vm->_screen->_frontScreen + rects[i].left + rects[i].top * 640;
-		byte *srcp = _vm->_screen->_backScreen + (_vm->_cameraX + rects[i].left) + (_vm->_cameraY + rects[i].top) * _vm->_sceneWidth;
-		int16 w = rects[i].width();
-		int16 h = rects[i].height();
+	Common::List<Common::Rect> rects;
+	getDirtyRects(rects);
+	for (Common::List<Common::Rect>::const_iterator rect = rects.begin(); rect != rects.end(); ++rect) {
+		byte *destp = _vm->_screen->_frontScreen + rect->left + rect->top * 640;
+		byte *srcp = _vm->_screen->_backScreen + (_vm->_cameraX + rect->left) + (_vm->_cameraY + rect->top) * _vm->_sceneWidth;
+		int16 w = rect->width();
+		int16 h = rect->height();
 		while (h--) {
 			memcpy(destp, srcp, w);
 			destp += 640;
 			srcp += _vm->_sceneWidth;
 		}
-		invalidateItemsByRect(rects[i], NULL);
+		invalidateItemsByRect(*rect, NULL);
 	}
-	delete[] rects;
 }
 
 void RenderQueue::updateDirtyRects() {
-	int n_rects = 0;
-	Common::Rect *rects = _updateUta->getRectangles(&n_rects, 0, 0, 639, _vm->_cameraHeight - 1);
-	for (int i = 0; i < n_rects; i++) {
-		_vm->_system->copyRectToScreen(_vm->_screen->_frontScreen + rects[i].left + rects[i].top * 640,
-			640, rects[i].left, rects[i].top, rects[i].width(), rects[i].height());
+	Common::List<Common::Rect> rects;
+	getDirtyRects(rects);
+	for (Common::List<Common::Rect>::const_iterator rect = rects.begin(); rect != rects.end(); ++rect) {
+		_vm->_system->copyRectToScreen(_vm->_screen->_frontScreen + rect->left + rect->top * 640,
+			640, rect->left, rect->top, rect->width(), rect->height());
 	}
-	delete[] rects;
 }
 
 
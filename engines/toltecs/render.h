@@ -23,11 +23,12 @@
 #ifndef TOLTECS_RENDER_H
 #define TOLTECS_RENDER_H
 
+#include "common/region.h"
+
 #include "graphics/surface.h"
 
 #include "toltecs/segmap.h"
 #include "toltecs/screen.h"
-#include "toltecs/microtiles.h"
 
 namespace Toltecs {
 
@@ -80,7 +81,7 @@ protected:
 
 	ToltecsEngine *_vm;
 	RenderQueueArray *_currQueue, *_prevQueue;
-	MicroTileArray *_updateUta;
+	Common::Region _updateRegion;
 
 	bool rectIntersectsItem(const Common::Rect &rect);
     RenderQueueItem *findItemInQueue(RenderQueueArray *queue, const RenderQueueItem &item);
@@ -88,6 +89,7 @@ protected:
     void invalidateItemsByRect(const Common::Rect &rect, const RenderQueueItem *item);
 
     void addDirtyRect(const Common::Rect &rect);
+    void getDirtyRects(Common::List<Common::Rect> &rects);
     void restoreDirtyBackground();
     void updateDirtyRects();
 
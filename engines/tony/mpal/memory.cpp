@@ -32,15 +32,44 @@ namespace MPAL {
 *       MemoryManager methods
 \****************************************************************************/
 
+MemoryItem *MemoryManager::_pooledBlocks[MemoryManager::kNumSizeClasses];
+uint MemoryManager::_numPooledBlocks[MemoryManager::kNumSizeClasses];
+
+/**
+ * Returns the size class for a block size, or -1 if blocks of that size are
+ * not pooled
+ */
+int MemoryManager::getSizeClass(uint32 size) {
+	for (int sizeClass = 0; sizeClass < kNumSizeClasses; ++sizeClass) {
+		if (size <= (1U << (sizeClass + kMinSizeClassShift)))
+			return sizeClass;
+	}
+
+	return -1;
+}
+
 /**
  * Allocates a new memory block
  * @return					Returns a MemoryItem instance for the new block
  */
 MpalHandle MemoryManager::allocate(uint32 size, uint flags) {
-	MemoryItem *newItem = (MemoryItem *)malloc(sizeof(MemoryItem) + size);
+	MemoryItem *newItem;
+	int sizeClass = getSizeClass(size);
+
+	if (sizeClass == -1) {
+		newItem = (MemoryItem *)malloc(sizeof(MemoryItem) + size);
+	} else if (_pooledBlocks[sizeClass]) {
+		newItem = _pooledBlocks[sizeClass];
+		_pooledBlocks[sizeClass] = newItem->_nextFree;
+		--_numPooledBlocks[sizeClass];
+	} else {
+		newItem = (MemoryItem *)malloc(sizeof(MemoryItem) + (1U << (sizeClass + kMinSizeClassShift)));
+	}
+
 	newItem->_id = BLOCK_ID;
 	newItem->_size = size;
 	newItem->_lockCount = 0;
+	newItem->_nextFree = nullptr;
 
 	// If requested, clear the allocated data block
 	if ((flags & GMEM_ZEROINIT) != 0) {
@@ -82,13 +111,32 @@ uint32 MemoryManager::getSize(MpalHandle handle) {
 	return item->_size;
 }
 
+/**
+ * Returns a block to the pool of its size class, or frees it
+ */
+void MemoryManager::releaseItem(MemoryItem *item) {
+	int sizeClass = getSizeClass(item->_size);
+
+	// Clearing the ID catches blocks which are freed twice
+	item->_id = 0;
+
+	if (sizeClass == -1 || _numPooledBlocks[sizeClass] >= kMaxPooledBlocks) {
+		free(item);
+		return;
+	}
+
+	item->_nextFree = _pooledBlocks[sizeClass];
+	_pooledBlocks[sizeClass] = item;
+	++_numPooledBlocks[sizeClass];
+}
+
 /**
  * Erases a given item
  */
 void MemoryManager::freeBlock(MpalHandle handle) {
 	MemoryItem *item = (MemoryItem *)handle;
 	assert(item->_id == BLOCK_ID);
-	free(item);
+	releaseItem(item);
 }
 
 /**
@@ -96,28 +144,22 @@ void MemoryManager::freeBlock(MpalHandle handle) {
  */
 void MemoryManager::destroyItem(MpalHandle handle) {
 	MemoryItem *item = getItem(handle);
-	assert(item->_id == BLOCK_ID);
-	free(item);
-}
-
-/**
- * Locks an item for access
- */
-byte *MemoryManager::lockItem(MpalHandle handle) {
-	MemoryItem *item = (MemoryItem *)handle;
-	assert(item->_id == BLOCK_ID);
-	++item->_lockCount;
-	return &item->_data[0];
+	releaseItem(item);
 }
 
 /**
- * Unlocks a locked item
+ * Frees the blocks kept in the pools
  */
-void MemoryManager::unlockItem(MpalHandle handle) {
-	MemoryItem *item = (MemoryItem *)handle;
-	assert(item->_id == BLOCK_ID);
-	assert(item->_lockCount > 0);
-	--item->_lockCount;
+void MemoryManager::freePooledBlocks() {
+	for (int sizeClass = 0; sizeClass < kNumSizeClasses; ++sizeClass) {
+		while (_pooledBlocks[sizeClass]) {
+			MemoryItem *item = _pooledBlocks[sizeClass];
+			_pooledBlocks[sizeClass] = item->_nextFree;
+			free(item);
+		}
+
+		_numPooledBlocks[sizeClass] = 0;
+	}
 }
 
 } // end of namespace MPAL
@@ -32,27 +32,70 @@ namespace MPAL {
 
 typedef void *MpalHandle;
 
+const uint32 BLOCK_ID = 0x12345678;
+
 struct MemoryItem {
 	uint32 _id;
 	uint32 _size;
 	int _lockCount;
+	MemoryItem *_nextFree;	// Next block of the same size class while pooled
 	byte _data[1];
 
 	// Casting for access to data
 	operator void *() { return &_data[0]; }
 };
 
+/**
+ * Small blocks are taken from pools of free blocks with the same size class,
+ * as MPAL allocates and frees many short lived blocks while running dialogs
+ * and item actions.
+ */
 class MemoryManager {
 private:
+	enum {
+		kMinSizeClassShift = 4,   // 16 bytes
+		kNumSizeClasses = 7,      // Up to 1024 bytes
+		kMaxPooledBlocks = 64     // Per size class
+	};
+
+	static MemoryItem *_pooledBlocks[kNumSizeClasses];
+	static uint _numPooledBlocks[kNumSizeClasses];
+
 	static MemoryItem *getItem(MpalHandle handle);
+	static int getSizeClass(uint32 size);
+	static void releaseItem(MemoryItem *item);
 public:
 	static MpalHandle allocate(uint32 size, uint flags);
 	static void *alloc(uint32 size, uint flags);
 	static void freeBlock(MpalHandle handle);
 	static void destroyItem(MpalHandle handle);
 	static uint32 getSize(MpalHandle handle);
-	static byte *lockItem(MpalHandle handle);
-	static void unlockItem(MpalHandle handle);
+	static void freePooledBlocks();
+
+	/**
+	 * Locks an item for access. Blocks never move, so the lock count is
+	 * only kept to catch unbalanced unlocks in development builds.
+	 */
+	static byte *lockItem(MpalHandle handle) {
+		MemoryItem *item = (MemoryItem *)handle;
+#ifndef RELEASE_BUILD
+		assert(item->_id == BLOCK_ID);
+		++item->_lockCount;
+#endif
+		return &item->_data[0];
+	}
+
+	/**
+	 * Unlocks a locked item
+	 */
+	static void unlockItem(MpalHandle handle) {
+#ifndef RELEASE_BUILD
+		MemoryItem *item = (MemoryItem *)handle;
+		assert(item->_id == BLOCK_ID);
+		assert(item->_lockCount > 0);
+		--item->_lockCount;
+#endif
+	}
 };
 
 // defines
@@ -68,8 +111,6 @@ public:
 #define GMEM_MOVEABLE 2
 #define GMEM_ZEROINIT 4
 
-const uint32 BLOCK_ID = 0x12345678;
-
 } // end of namespace MPAL
 
 } // end of namespace Tony
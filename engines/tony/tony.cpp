@@ -725,6 +725,7 @@ void TonyEngine::close() {
 	_window.close();
 	mpalFree();
 	freeMpc();
+	MPAL::MemoryManager::freePooledBlocks();
 	delete[] _curThumbnail;
 }
 
@@ -209,15 +209,44 @@ bool PathFinding::findClosestWalkingPoint(int16 xx, int16 yy, int16 *fxx, int16
 	if (origY == -1)
 		origY = yy;
 
-	for (int16 y = 0; y < _height; y++) {
-		for (int16 x = 0; x < _width; x++) {
-			if (isWalkable(x, y) && isLikelyWalkable(x, y)) {
-				int32 ndist = (x - xx) * (x - xx) + (y - yy) * (y - yy);
-				int32 ndist2 = (x - origX) * (x - origX) + (y - origY) * (y - origY);
-				if (currentFound < 0 || ndist < dist || (ndist == dist && ndist2 < dist2)) {
-					dist = ndist;
-					dist2 = ndist2;
-					currentFound = y * _width + x;
+	const uint8 *mask = _currentMask->getDataPtr();
+
+	// Rows are visited going outwards from yy, until they are all further
+	// away than the closest point found. Ties are broken by the position
+	// in the mask, like a scan of the whole mask in order would.
+	const int32 maxDy = MAX<int32>(ABS<int32>(yy), ABS<int32>(_height - 1 - yy));
+	for (int32 dy = 0; mask && dy <= maxDy; dy++) {
+		if (currentFound >= 0 && dy * dy > dist)
+			break;
+
+		for (int32 side = 0; side < (dy ? 2 : 1); side++) {
+			int32 y = side ? yy + dy : yy - dy;
+			if (y < 0 || y >= _height)
+				continue;
+
+			int32 startX = 0;
+			int32 endX = _width - 1;
+			if (currentFound >= 0) {
+				int32 rest = dist - dy * dy;
+				int32 r = (int32)sqrt((double)rest);
+				while (r * r > rest)
+					r--;
+				while ((r + 1) * (r + 1) <= rest)
+					r++;
+				startX = MAX<int32>(startX, xx - r);
+				endX = MIN<int32>(endX, xx + r);
+			}
+
+			for (int32 x = startX; x <= endX; x++) {
+				if ((mask[y * _width + x] & 0x1f) && isLikelyWalkable(x, y)) {
+					int32 ndist = (x - xx) * (x - xx) + (y - yy) * (y - yy);
+					int32 ndist2 = (x - origX) * (x - origX) + (y - origY) * (y - origY);
+					int32 node = y * _width + x;
+					if (currentFound < 0 || ndist < dist || (ndist == dist && (ndist2 < dist2 || (ndist2 == dist2 && node < currentFound)))) {
+						dist = ndist;
+						dist2 = ndist2;
+						currentFound = node;
+					}
 				}
 			}
 		}
@@ -250,14 +279,14 @@ void PathFinding::walkLine(int16 x, int16 y, int16 x2, int16 y2) {
 	int32 cdx = (dx << 16) / t;
 	int32 cdy = (dy << 16) / t;
 
-	_tempPath.clear();
+	// The path is stored from the destination back to the start
+	_tempPath.resize(t + 1);
+	_tempPath[0] = Common::Point(x2, y2);
 	for (int32 i = t; i > 0; i--) {
-		_tempPath.insert_at(0, Common::Point(bx >> 16, by >> 16));
+		_tempPath[i] = Common::Point(bx >> 16, by >> 16);
 		bx += cdx;
 		by += cdy;
 	}
-
-	_tempPath.insert_at(0, Common::Point(x2, y2));
 }
 
 bool PathFinding::lineIsWalkable(int16 x, int16 y, int16 x2, int16 y2) {
@@ -276,8 +305,12 @@ bool PathFinding::lineIsWalkable(int16 x, int16 y, int16 x2, int16 y2) {
 	int32 cdx = (dx << 16) / t;
 	int32 cdy = (dy << 16) / t;
 
+	const uint8 *mask = _currentMask->getDataPtr();
+	if (!mask)
+		return false;
+
 	for (int32 i = t; i > 0; i--) {
-		if (!isWalkable(bx >> 16, by >> 16))
+		if (!(mask[(by >> 16) * _width + (bx >> 16)] & 0x1f))
 			return false;
 		bx += cdx;
 		by += cdy;
@@ -305,6 +338,12 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 		return true;
 	}
 
+	const uint8 *mask = _currentMask->getDataPtr();
+	if (!mask) {
+		_tempPath.clear();
+		return false;
+	}
+
 	// no direct line, we use the standard A* algorithm
 	memset(_sq , 0, _width * _height * sizeof(uint16));
 	_heap->clear();
@@ -330,8 +369,8 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 				if (px != curX || py != curY) {
 					uint16 wei = abs(px - curX) + abs(py - curY);
 
-					if (isWalkable(px, py)) { // walkable ?
-						int32 curPNode = px + py * _width;
+					int32 curPNode = px + py * _width;
+					if (mask[curPNode] & 0x1f) { // walkable ?
 						uint32 sum = _sq[curNode] + wei * (1 + (isLikelyWalkable(px, py) ? 5 : 0));
 						if (sum > (uint32)0xFFFF) {
 							warning("PathFinding::findPath sum exceeds maximum representable!");
@@ -383,7 +422,7 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 			for (int16 py = startY; py <= endY; py++) {
 				if (px != curX || py != curY) {
 					int32 PNode = px + py * _width;
-					if (_sq[PNode] && (isWalkable(px, py))) {
+					if (_sq[PNode] && (mask[PNode] & 0x1f)) {
 						if (_sq[PNode] < bestscore) {
 							bestscore = _sq[PNode];
 							bestX = px;
@@ -305,10 +305,8 @@ void Scene::synchronize(Serializer &s) {
 		s.syncAsSint16LE(useless);
 	}
 
-	for (int i = 0; i < 256; ++i)
-		s.syncAsUint16LE(_enabledSections[i]);
-	for (int i = 0; i < 256; ++i)
-		s.syncAsSint16LE(_zoomPercents[i]);
+	s.syncArrayAsUint16LE(_enabledSections, 256);
+	s.syncArrayAsSint16LE(_zoomPercents, 256);
 
 	if (s.getVersion() >= 7)
 		_bgSceneObjects.synchronize(s);
@@ -31,6 +31,7 @@
 #include "engines/wintermute/base/file/base_disk_file.h"
 #include "engines/wintermute/base/file/base_save_thumb_file.h"
 #include "engines/wintermute/base/file/base_package.h"
+#include "engines/wintermute/base/file/base_file_entry.h"
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/wintermute.h"
 #include "common/debug.h"
@@ -44,10 +45,16 @@
 #include "common/file.h"
 #include "common/savefile.h"
 #include "common/fs.h"
+#include "common/memstream.h"
 #include "common/unzip.h"
 
 namespace Wintermute {
 
+// Compressed files are kept decompressed up to this size, as sprites,
+// scripts and definitions are often opened again and again
+static const uint32 kMaxCachedPkgFileSize = 64 * 1024;
+static const uint32 kCachedPkgFilesBudget = 1024 * 1024;
+
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
@@ -57,6 +64,8 @@ BaseFileManager::BaseFileManager(Common::Language lang, bool detectionMode) {
 	_detectionMode = detectionMode;
 	_language = lang;
 	_resources = nullptr;
+	_cachedPkgFilesSize = 0;
+	_cachedPkgFilesUse = 0;
 	initResources();
 	initPaths();
 	registerPackages();
@@ -80,6 +89,7 @@ bool BaseFileManager::cleanup() {
 	_openFiles.clear();
 
 	// delete packages
+	clearPkgCaches();
 	_packages.clear();
 
 	// get rid of the resources:
@@ -281,6 +291,9 @@ bool BaseFileManager::registerPackage(Common::FSNode file, const Common::String
 	PackageSet *pack = new PackageSet(file, filename, searchSignature);
 	_packages.add(file.getName(), pack, pack->getPriority() , true);
 
+	// The new package may override files which have been opened before
+	clearPkgCaches();
+
 	return STATUS_OK;
 }
 
@@ -308,14 +321,82 @@ Common::SeekableReadStream *BaseFileManager::openPkgFile(const Common::String &f
 			upcName.setChar('\\', (uint32)i);
 		}
 	}
-	Common::ArchiveMemberPtr entry = _packages.getMember(upcName);
-	if (!entry) {
-		return nullptr;
+	Common::ArchiveMemberPtr entry;
+	Common::HashMap<Common::String, Common::ArchiveMemberPtr>::iterator i = _pkgMembers.find(upcName);
+	if (i != _pkgMembers.end()) {
+		entry = i->_value;
+	} else {
+		entry = _packages.getMember(upcName);
+		if (!entry) {
+			return nullptr;
+		}
+		_pkgMembers[upcName] = entry;
+	}
+
+	// All members of the packages are BaseFileEntries
+	const BaseFileEntry *fileEntry = (const BaseFileEntry *)entry.get();
+	if (fileEntry->_compressedLength != 0 && fileEntry->_length <= kMaxCachedPkgFileSize) {
+		return openCachedPkgFile(upcName, entry);
 	}
+
 	file = entry->createReadStream();
 	return file;
 }
 
+Common::SeekableReadStream *BaseFileManager::openCachedPkgFile(const Common::String &upcName, const Common::ArchiveMemberPtr &entry) {
+	Common::HashMap<Common::String, CachedPkgFile>::iterator i = _cachedPkgFiles.find(upcName);
+	if (i == _cachedPkgFiles.end()) {
+		Common::SeekableReadStream *stream = entry->createReadStream();
+		if (!stream) {
+			return nullptr;
+		}
+
+		CachedPkgFile cached;
+		cached.size = stream->size();
+		cached.data = new byte[cached.size];
+		if (stream->read(cached.data, cached.size) != cached.size || stream->err()) {
+			delete[] cached.data;
+			stream->seek(0);
+			return stream;
+		}
+		delete stream;
+
+		// Make room by dropping the files which have not been used the longest
+		while (!_cachedPkgFiles.empty() && _cachedPkgFilesSize + cached.size > kCachedPkgFilesBudget) {
+			Common::HashMap<Common::String, CachedPkgFile>::iterator oldest = _cachedPkgFiles.begin();
+			for (Common::HashMap<Common::String, CachedPkgFile>::iterator j = _cachedPkgFiles.begin(); j != _cachedPkgFiles.end(); ++j) {
+				if (j->_value.lastUse < oldest->_value.lastUse) {
+					oldest = j;
+				}
+			}
+			_cachedPkgFilesSize -= oldest->_value.size;
+			delete[] oldest->_value.data;
+			_cachedPkgFiles.erase(oldest);
+		}
+
+		_cachedPkgFilesSize += cached.size;
+		_cachedPkgFiles[upcName] = cached;
+		i = _cachedPkgFiles.find(upcName);
+	}
+
+	i->_value.lastUse = ++_cachedPkgFilesUse;
+
+	// Callers own the stream, so it gets a copy
+	byte *data = new byte[i->_value.size];
+	memcpy(data, i->_value.data, i->_value.size);
+	return new Common::MemoryReadStream(data, i->_value.size, DisposeAfterUse::YES);
+}
+
+void BaseFileManager::clearPkgCaches() {
+	for (Common::HashMap<Common::String, CachedPkgFile>::iterator i = _cachedPkgFiles.begin(); i != _cachedPkgFiles.end(); ++i) {
+		delete[] i->_value.data;
+	}
+	_cachedPkgFiles.clear();
+	_cachedPkgFilesSize = 0;
+
+	_pkgMembers.clear();
+}
+
 bool BaseFileManager::hasFile(const Common::String &filename) {
 	if (scumm_strnicmp(filename.c_str(), "savegame:", 9) == 0) {
 		BasePersistenceManager pm(BaseEngine::instance().getGameTargetName());
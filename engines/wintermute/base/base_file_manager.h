@@ -33,6 +33,8 @@
 #include "common/str.h"
 #include "common/fs.h"
 #include "common/file.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/language.h"
 
 namespace Wintermute {
@@ -62,10 +64,27 @@ private:
 	void initResources();
 	Common::SeekableReadStream *openFileRaw(const Common::String &filename);
 	Common::SeekableReadStream *openPkgFile(const Common::String &filename);
+	Common::SeekableReadStream *openCachedPkgFile(const Common::String &upcName, const Common::ArchiveMemberPtr &entry);
+	void clearPkgCaches();
 	Common::FSList _packagePaths;
 	bool registerPackage(Common::FSNode package, const Common::String &filename = "", bool searchSignature = false);
 	bool _detectionMode;
 	Common::SearchSet _packages;
+
+	// Members of the packages which have been opened, by their normalized
+	// name, so the packages need not be searched again
+	Common::HashMap<Common::String, Common::ArchiveMemberPtr> _pkgMembers;
+
+	// Small compressed files which have been opened, decompressed
+	struct CachedPkgFile {
+		byte *data;
+		uint32 size;
+		uint32 lastUse;
+	};
+	Common::HashMap<Common::String, CachedPkgFile> _cachedPkgFiles;
+	uint32 _cachedPkgFilesSize;
+	uint32 _cachedPkgFilesUse;
+
 	Common::Array<Common::SeekableReadStream *> _openFiles;
 	Common::Language _language;
 	Common::Archive *_resources;
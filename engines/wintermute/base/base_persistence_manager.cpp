@@ -478,7 +478,10 @@ void BasePersistenceManager::putString(const char *val) {
 }
 
 Common::String BasePersistenceManager::getStringObj() {
-	return getString();
+	char *str = getString();
+	Common::String ret = str ? str : "";
+	delete[] str;
+	return ret;
 }
 
 //////////////////////////////////////////////////////////////////////////
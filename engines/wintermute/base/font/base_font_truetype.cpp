@@ -55,14 +55,23 @@ BaseFontTT::BaseFontTT(BaseGame *inGame) : BaseFont(inGame) {
 	_fallbackFont = nullptr;
 	_deletableFont = nullptr;
 
-	for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-		_cachedTexts[i] = nullptr;
-	}
+	_cachedTextsMemory = 0;
+	_measuredMaxWidth = -2;
+	_measuredWidth = _measuredHeight = 0;
 
 	_lineHeight = 0;
 	_maxCharWidth = _maxCharHeight = 0;
 }
 
+//////////////////////////////////////////////////////////////////////////
+static uint32 hashText(const WideString &text) {
+	uint32 hash = 0;
+	for (uint32 i = 0; i < text.size(); i++) {
+		hash = hash * 31 + text[i];
+	}
+	return hash;
+}
+
 //////////////////////////////////////////////////////////////////////////
 BaseFontTT::~BaseFontTT(void) {
 	clearCache();
@@ -82,12 +91,13 @@ BaseFontTT::~BaseFontTT(void) {
 
 //////////////////////////////////////////////////////////////////////////
 void BaseFontTT::clearCache() {
-	for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-		if (_cachedTexts[i]) {
-			delete _cachedTexts[i];
-		}
-		_cachedTexts[i] = nullptr;
+	for (uint32 i = 0; i < _cachedTexts.size(); i++) {
+		delete _cachedTexts[i];
 	}
+	_cachedTexts.clear();
+	_cachedTextsMemory = 0;
+
+	_measuredMaxWidth = -2;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -95,16 +105,14 @@ void BaseFontTT::initLoop() {
 	// we need more aggressive cache management on iOS not to waste too much memory on fonts
 	if (_gameRef->_constrainedMemory) {
 		// purge all cached images not used in the last frame
-		for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-			if (_cachedTexts[i] == nullptr) {
-				continue;
-			}
-
+		for (uint32 i = 0; i < _cachedTexts.size(); ) {
 			if (!_cachedTexts[i]->_marked) {
+				_cachedTextsMemory -= _cachedTexts[i]->_memory;
 				delete _cachedTexts[i];
-				_cachedTexts[i] = nullptr;
+				_cachedTexts.remove_at(i);
 			} else {
 				_cachedTexts[i]->_marked = false;
+				i++;
 			}
 		}
 	}
@@ -174,28 +182,18 @@ void BaseFontTT::drawText(const byte *text, int x, int y, int width, TTextAlign
 	BaseRenderer *renderer = _gameRef->_renderer;
 
 	// find cached surface, if exists
-	uint32 minUseTime = UINT_MAX;
-	int minIndex = -1;
+	uint32 hash = hashText(textStr);
 	BaseSurface *surface = nullptr;
 	int textOffset = 0;
 
-	for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-		if (_cachedTexts[i] == nullptr) {
-			minUseTime = 0;
-			minIndex = i;
-		} else {
-			if (_cachedTexts[i]->_text == textStr && _cachedTexts[i]->_align == align && _cachedTexts[i]->_width == width && _cachedTexts[i]->_maxHeight == maxHeight && _cachedTexts[i]->_maxLength == maxLength) {
-				surface = _cachedTexts[i]->_surface;
-				textOffset = _cachedTexts[i]->_textOffset;
-				_cachedTexts[i]->_marked = true;
-				_cachedTexts[i]->_lastUsed = g_system->getMillis();
-				break;
-			} else {
-				if (_cachedTexts[i]->_lastUsed < minUseTime) {
-					minUseTime = _cachedTexts[i]->_lastUsed;
-					minIndex = i;
-				}
-			}
+	for (uint32 i = 0; i < _cachedTexts.size(); i++) {
+		BaseCachedTTFontText *cached = _cachedTexts[i];
+		if (cached->_hash == hash && cached->_align == align && cached->_width == width && cached->_maxHeight == maxHeight && cached->_maxLength == maxLength && cached->_text == textStr) {
+			surface = cached->_surface;
+			textOffset = cached->_textOffset;
+			cached->_marked = true;
+			cached->_lastUsed = g_system->getMillis();
+			break;
 		}
 	}
 
@@ -204,21 +202,36 @@ void BaseFontTT::drawText(const byte *text, int x, int y, int width, TTextAlign
 		debugC(kWintermuteDebugFont, "Draw text: %s", text);
 		surface = renderTextToTexture(textStr, width, align, maxHeight, textOffset);
 		if (surface) {
-			// write surface to cache
-			if (_cachedTexts[minIndex] != nullptr) {
-				delete _cachedTexts[minIndex];
+			BaseCachedTTFontText *cached = new BaseCachedTTFontText;
+			cached->_surface = surface;
+			cached->_align = align;
+			cached->_width = width;
+			cached->_maxHeight = maxHeight;
+			cached->_maxLength = maxLength;
+			cached->_text = textStr;
+			cached->_hash = hash;
+			cached->_textOffset = textOffset;
+			cached->_memory = surface->getWidth() * surface->getHeight() * 4;
+			cached->_marked = true;
+			cached->_lastUsed = g_system->getMillis();
+
+			// drop the texts which have not been drawn for the longest time
+			// until the new one fits; the colors of the layers are applied
+			// when drawing, so a text is only rendered once for all of them
+			while (!_cachedTexts.empty() && _cachedTextsMemory + cached->_memory > CACHED_TEXTS_MEMORY) {
+				uint32 oldest = 0;
+				for (uint32 i = 1; i < _cachedTexts.size(); i++) {
+					if (_cachedTexts[i]->_lastUsed < _cachedTexts[oldest]->_lastUsed) {
+						oldest = i;
+					}
+				}
+				_cachedTextsMemory -= _cachedTexts[oldest]->_memory;
+				delete _cachedTexts[oldest];
+				_cachedTexts.remove_at(oldest);
 			}
-			_cachedTexts[minIndex] = new BaseCachedTTFontText;
-
-			_cachedTexts[minIndex]->_surface = surface;
-			_cachedTexts[minIndex]->_align = align;
-			_cachedTexts[minIndex]->_width = width;
-			_cachedTexts[minIndex]->_maxHeight = maxHeight;
-			_cachedTexts[minIndex]->_maxLength = maxLength;
-			_cachedTexts[minIndex]->_text = textStr;
-			_cachedTexts[minIndex]->_textOffset = textOffset;
-			_cachedTexts[minIndex]->_marked = true;
-			_cachedTexts[minIndex]->_lastUsed = g_system->getMillis();
+
+			_cachedTexts.push_back(cached);
+			_cachedTextsMemory += cached->_memory;
 		}
 	}
 
@@ -541,9 +554,9 @@ bool BaseFontTT::persist(BasePersistenceManager *persistMgr) {
 	}
 
 	if (!persistMgr->getIsSaving()) {
-		for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-			_cachedTexts[i] = nullptr;
-		}
+		_cachedTexts.clear();
+		_cachedTextsMemory = 0;
+		_measuredMaxWidth = -2;
 		_fallbackFont = _font = _deletableFont = nullptr;
 	}
 
@@ -561,6 +574,7 @@ bool BaseFontTT::initFont() {
 	if (!_fontFile) {
 		return STATUS_FAILED;
 	}
+	_measuredMaxWidth = -2;
 #ifdef USE_FREETYPE2
 	Common::String fallbackFilename;
 	// Handle Bold atleast for the fallback-case.
@@ -642,6 +656,12 @@ bool BaseFontTT::initFont() {
 void BaseFontTT::measureText(const WideString &text, int maxWidth, int maxHeight, int &textWidth, int &textHeight) {
 	//TextLineList lines;
 
+	if (maxWidth == _measuredMaxWidth && text == _measuredText) {
+		textWidth = _measuredWidth;
+		textHeight = _measuredHeight;
+		return;
+	}
+
 	if (maxWidth >= 0) {
 		Common::Array<WideString> lines;
 		_font->wordWrapText(text, maxWidth, lines);
@@ -658,6 +678,11 @@ void BaseFontTT::measureText(const WideString &text, int maxWidth, int maxHeight
 		textWidth = _font->getStringWidth(text);
 		textHeight = _fontHeight;
 	}
+
+	_measuredText = text;
+	_measuredMaxWidth = maxWidth;
+	_measuredWidth = textWidth;
+	_measuredHeight = textHeight;
 	/*
 	    TextLineList::iterator it;
 	    for (it = lines.begin(); it != lines.end(); ++it) {
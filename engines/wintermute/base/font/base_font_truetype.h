@@ -36,7 +36,8 @@
 #include "graphics/surface.h"
 #include "graphics/font.h"
 
-#define NUM_CACHED_TEXTS 30
+// Memory the rendered texts of a font may use, at 4 bytes per pixel
+#define CACHED_TEXTS_MEMORY (2 * 1024 * 1024)
 
 namespace Wintermute {
 
@@ -46,6 +47,7 @@ private:
 	class BaseCachedTTFontText {
 	public:
 		WideString _text;
+		uint32 _hash;
 		int32 _width;
 		TTextAlign _align;
 		int32 _maxHeight;
@@ -53,6 +55,7 @@ private:
 		BaseSurface *_surface;
 		int32 _priority;
 		int32 _textOffset;
+		uint32 _memory;
 		bool _marked;
 		uint32 _lastUsed;
 
@@ -61,7 +64,9 @@ private:
 			_width = _maxHeight = _maxLength = -1;
 			_align = TAL_LEFT;
 			_surface = nullptr;
+			_hash = 0;
 			_textOffset = 0;
+			_memory = 0;
 			_lastUsed = 0;
 			_marked = false;
 		}
@@ -121,7 +126,15 @@ private:
 
 	BaseSurface *renderTextToTexture(const WideString &text, int width, TTextAlign align, int maxHeight, int &textOffset);
 
-	BaseCachedTTFontText *_cachedTexts[NUM_CACHED_TEXTS];
+	Common::Array<BaseCachedTTFontText *> _cachedTexts;
+	uint32 _cachedTextsMemory;
+
+	// The last text measured, as formatting code measures the same text
+	// several times
+	WideString _measuredText;
+	int _measuredMaxWidth;
+	int _measuredWidth;
+	int _measuredHeight;
 
 	bool initFont();
 
@@ -87,6 +87,13 @@ bool BaseImage::loadFile(const Common::String &filename) {
 	return true;
 }
 
+void BaseImage::loadDecoder(const Common::String &filename, Image::ImageDecoder *decoder) {
+	_filename = filename;
+	_decoder = decoder;
+	_surface = _decoder->getSurface();
+	_palette = _decoder->getPalette();
+}
+
 byte BaseImage::getAlphaAt(int x, int y) const {
 	if (!_surface) {
 		return 0xFF;
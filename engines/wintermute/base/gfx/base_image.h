@@ -49,6 +49,11 @@ public:
 	~BaseImage();
 
 	bool loadFile(const Common::String &filename);
+	/**
+	 * Take over an image which has already been decoded, e.g. by an
+	 * Image::ImagePreloader, instead of loading it from a file.
+	 */
+	void loadDecoder(const Common::String &filename, Image::ImageDecoder *decoder);
 	const Graphics::Surface *getSurface() const {
 		return _surface;
 	};
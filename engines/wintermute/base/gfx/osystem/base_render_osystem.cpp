@@ -43,17 +43,31 @@
 
 namespace Wintermute {
 
+/**
+ * Hash the arguments of a draw call which RenderTicket::operator== compares,
+ * leaving out the transform, as only few draw calls change just it.
+ */
+static uint hashTicket(const BaseSurfaceOSystem *owner, const Common::Rect &srcRect, const Common::Rect &dstRect) {
+	uint hash = (uint)(size_t)owner;
+	hash = hash * 31 + (uint16)srcRect.left + ((uint)(uint16)srcRect.top << 16);
+	hash = hash * 31 + (uint16)srcRect.right + ((uint)(uint16)srcRect.bottom << 16);
+	hash = hash * 31 + (uint16)dstRect.left + ((uint)(uint16)dstRect.top << 16);
+	hash = hash * 31 + (uint16)dstRect.right + ((uint)(uint16)dstRect.bottom << 16);
+	return hash;
+}
+
 BaseRenderer *makeOSystemRenderer(BaseGame *inGame) {
 	return new BaseRenderOSystem(inGame);
 }
 
 //////////////////////////////////////////////////////////////////////////
-BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
+BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame), _imagePreloader(32 * 1024 * 1024) {
 	_renderSurface = new Graphics::Surface();
 	_blankSurface = new Graphics::Surface();
 	_lastFrameIter = _renderQueue.end();
 	_needsFlip = true;
 	_skipThisFrame = false;
+	_spriteBatchDepth = 0;
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
@@ -165,6 +179,7 @@ bool BaseRenderOSystem::flip() {
 		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
 			(*it)->_wantsDraw = false;
 		}
+		countPendingTickets();
 
 		addDirtyRect(_renderRect);
 		return true;
@@ -200,6 +215,7 @@ bool BaseRenderOSystem::flip() {
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
+	countPendingTickets();
 
 	g_system->updateScreen();
 
@@ -283,7 +299,8 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 		return;
 	}
 
-	if (owner) { // Fade-tickets are owner-less
+	// Fade-tickets are owner-less
+	if (owner && _pendingTickets.contains(hashTicket(owner, *srcRect, *dstRect))) {
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
 		RenderQueueIterator it = _lastFrameIter;
 		++it;
@@ -326,6 +343,11 @@ void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
 			invalidateTicket(*it);
 		}
 	}
+	invalidateTransformsFromSurface(surf);
+}
+
+void BaseRenderOSystem::invalidateTransformsFromSurface(BaseSurfaceOSystem *surf) {
+	_transformCache.remove(surf);
 }
 
 void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
@@ -352,6 +374,11 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 	assert(!renderTicket->_wantsDraw);
 	renderTicket->_wantsDraw = true;
 
+	Common::HashMap<uint, uint>::iterator pending = _pendingTickets.find(hashTicket(renderTicket->_owner, *renderTicket->getSrcRect(), renderTicket->_dstRect));
+	if (pending != _pendingTickets.end() && --pending->_value == 0) {
+		_pendingTickets.erase(pending);
+	}
+
 	++_lastFrameIter;
 	// Not in the same order?
 	if (*_lastFrameIter != renderTicket) {
@@ -452,6 +479,14 @@ void BaseRenderOSystem::drawTickets() {
 
 }
 
+void BaseRenderOSystem::countPendingTickets() {
+	_pendingTickets.clear();
+	for (RenderQueueIterator it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		RenderTicket *ticket = *it;
+		++_pendingTickets[hashTicket(ticket->_owner, *ticket->getSrcRect(), ticket->_dstRect)];
+	}
+}
+
 // Replacement for SDL2's SDL_RenderCopy
 void BaseRenderOSystem::drawFromSurface(RenderTicket *ticket) {
 	ticket->drawToSurface(_renderSurface);
@@ -575,6 +610,7 @@ void BaseRenderOSystem::endSaveLoad() {
 	// so just skip this single frame.
 	_skipThisFrame = true;
 	_lastFrameIter = _renderQueue.end();
+	countPendingTickets();
 
 	_renderSurface->fillRect(Common::Rect(0, 0, _renderSurface->h, _renderSurface->w), _renderSurface->format.ARGBToColor(255, 0, 0, 0));
 	g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
@@ -582,11 +618,46 @@ void BaseRenderOSystem::endSaveLoad() {
 }
 
 bool BaseRenderOSystem::startSpriteBatch() {
+	++_spriteBatchDepth;
 	return STATUS_OK;
 }
 
 bool BaseRenderOSystem::endSpriteBatch() {
+	// The surfaces may change once the batch is done
+	if (_spriteBatchDepth > 0 && --_spriteBatchDepth == 0) {
+		_batchedSurfaces.clear();
+	}
 	return STATUS_OK;
 }
 
+uint BaseRenderOSystem::BatchKey_Hash::operator()(const BatchKey &key) const {
+	return hashTicket(nullptr, key.srcRect, Common::Rect()) ^ (uint)(size_t)key.surf;
+}
+
+Common::SharedPtr<Graphics::Surface> BaseRenderOSystem::findBatchedSurface(const Graphics::Surface *surf, const Common::Rect &srcRect) const {
+	if (_spriteBatchDepth == 0) {
+		return Common::SharedPtr<Graphics::Surface>();
+	}
+
+	BatchKey key;
+	key.surf = surf;
+	key.srcRect = srcRect;
+	BatchedSurfaceMap::const_iterator it = _batchedSurfaces.find(key);
+	if (it == _batchedSurfaces.end()) {
+		return Common::SharedPtr<Graphics::Surface>();
+	}
+	return it->_value;
+}
+
+void BaseRenderOSystem::addBatchedSurface(const Graphics::Surface *surf, const Common::Rect &srcRect, const Common::SharedPtr<Graphics::Surface> &copy) {
+	if (_spriteBatchDepth == 0) {
+		return;
+	}
+
+	BatchKey key;
+	key.surf = surf;
+	key.srcRect = srcRect;
+	_batchedSurfaces[key] = copy;
+}
+
 } // End of namespace Wintermute
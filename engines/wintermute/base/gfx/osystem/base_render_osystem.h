@@ -33,7 +33,11 @@
 #include "common/rect.h"
 #include "graphics/surface.h"
 #include "common/list.h"
+#include "common/hashmap.h"
+#include "common/ptr.h"
+#include "graphics/transform_cache.h"
 #include "graphics/transform_struct.h"
+#include "image/preloader.h"
 
 namespace Wintermute {
 class BaseSurfaceOSystem;
@@ -80,6 +84,18 @@ public:
 
 	void invalidateTicket(RenderTicket *renderTicket);
 	void invalidateTicketsFromSurface(BaseSurfaceOSystem *surf);
+	/**
+	 * Drop the cached scaled and rotated copies of a surface,
+	 * after its pixels changed.
+	 * @param surf the surface whose copies are dropped.
+	 */
+	void invalidateTransformsFromSurface(BaseSurfaceOSystem *surf);
+	Graphics::TransformCache &getTransformCache() { return _transformCache; }
+	/**
+	 * The images of surfaces which have been created but not loaded yet
+	 * are decoded in the background by this.
+	 */
+	Image::ImagePreloader &getImagePreloader() { return _imagePreloader; }
 	/**
 	 * Insert a new ticket into the queue, adding a dirty rect
 	 * @param renderTicket the ticket to be added.
@@ -107,8 +123,24 @@ public:
 	float getScaleRatioY() const override {
 		return _ratioY;
 	}
+	/**
+	 * Sprite batches bracket draws which tend to use the same parts of a
+	 * surface over and over, like the tiles of an image, the glyphs of a
+	 * text or the particles of an emitter. Within a batch, tickets for the
+	 * same part of a surface share one copy of its pixels.
+	 */
 	virtual bool startSpriteBatch() override;
 	virtual bool endSpriteBatch() override;
+	/**
+	 * Return the copy of a part of a surface made for a ticket earlier in
+	 * the current sprite batch, if any.
+	 */
+	Common::SharedPtr<Graphics::Surface> findBatchedSurface(const Graphics::Surface *surf, const Common::Rect &srcRect) const;
+	/**
+	 * Remember the copy of a part of a surface made for a ticket, so that
+	 * later tickets of the current sprite batch can share it.
+	 */
+	void addBatchedSurface(const Graphics::Surface *surf, const Common::Rect &srcRect, const Common::SharedPtr<Graphics::Surface> &copy);
 	void endSaveLoad();
 	void drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform);
 	BaseSurface *createSurface() override;
@@ -126,11 +158,39 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
+	/**
+	 * Count the tickets of last frame by their hash, after the queue has
+	 * been cleaned up for the next frame.
+	 */
+	void countPendingTickets();
 	Common::Rect *_dirtyRect;
 	Common::List<RenderTicket *> _renderQueue;
+	Graphics::TransformCache _transformCache;
+	Image::ImagePreloader _imagePreloader;
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
+	/**
+	 * The number of tickets of last frame which have not been drawn again
+	 * yet, i.e. those after _lastFrameIter, by the hash of their arguments.
+	 * New draw calls only look for a ticket to reuse if there is one with
+	 * the same hash, so draws which changed do not walk the whole queue.
+	 */
+	Common::HashMap<uint, uint> _pendingTickets;
+
+	struct BatchKey {
+		const Graphics::Surface *surf;
+		Common::Rect srcRect;
+
+		bool operator==(const BatchKey &other) const { return surf == other.surf && srcRect == other.srcRect; }
+	};
+	struct BatchKey_Hash {
+		uint operator()(const BatchKey &key) const;
+	};
+	typedef Common::HashMap<BatchKey, Common::SharedPtr<Graphics::Surface>, BatchKey_Hash> BatchedSurfaceMap;
+
+	int _spriteBatchDepth;
+	BatchedSurfaceMap _batchedSurfaces;
 	Common::Rect _renderRect;
 	Graphics::Surface *_renderSurface;
 	Graphics::Surface *_blankSurface;
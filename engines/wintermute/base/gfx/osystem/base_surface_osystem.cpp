@@ -127,12 +127,28 @@ bool BaseSurfaceOSystem::create(const Common::String &filename, bool defaultCK,
 		_lifeTime = -1;
 	}
 
+	// The image is only loaded once it is drawn for the first time, so
+	// start decoding it in the meantime
+	if (!_loaded && !_filename.hasPrefix("savegame:")) {
+		Common::SeekableReadStream *file = BaseFileManager::getEngineInstance()->openFile(_filename);
+		if (file) {
+			BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
+			renderer->getImagePreloader().prefetch(_filename, *file);
+			BaseFileManager::getEngineInstance()->closeFile(file);
+		}
+	}
+
 	return STATUS_OK;
 }
 
 bool BaseSurfaceOSystem::finishLoad() {
+	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
+
 	BaseImage *image = new BaseImage();
-	if (!image->loadFile(_filename)) {
+	Image::ImageDecoder *decoder = renderer->getImagePreloader().take(_filename);
+	if (decoder) {
+		image->loadDecoder(_filename, decoder);
+	} else if (!image->loadFile(_filename)) {
 		delete image;
 		return false;
 	}
@@ -188,6 +204,8 @@ bool BaseSurfaceOSystem::finishLoad() {
 
 	_loaded = true;
 
+	renderer->invalidateTransformsFromSurface(this);
+
 	return true;
 }
 
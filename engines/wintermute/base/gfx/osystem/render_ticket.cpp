@@ -29,6 +29,7 @@
 
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/gfx/osystem/render_ticket.h"
+#include "engines/wintermute/base/gfx/osystem/base_render_osystem.h"
 #include "engines/wintermute/base/gfx/osystem/base_surface_osystem.h"
 #include "graphics/transform_tools.h"
 #include "common/textconsole.h"
@@ -43,12 +44,42 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	_wantsDraw(true),
 	_transform(transform) {
 	if (surf) {
-		_surface = new Graphics::Surface();
-		_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
-		assert(_surface->format.bytesPerPixel == 4);
+		const bool rotate = _transform._angle != Graphics::kDefaultAngle;
+		const bool scale = !rotate &&
+		                   (dstRect->width() != srcRect->width() || dstRect->height() != srcRect->height()) &&
+		                   _transform._numTimesX * _transform._numTimesY == 1;
+
+		// Scaled and rotated sprites tend to be drawn the same way frame
+		// after frame, so keep them around instead of transforming again
+		Graphics::TransformCache *cache = nullptr;
+		Graphics::TFilteringMode filter = Graphics::FILTER_NEAREST;
+		if (owner && (rotate || scale)) {
+			cache = &static_cast<BaseRenderOSystem *>(owner->_gameRef->_renderer)->getTransformCache();
+			if (owner->_gameRef->getBilinearFiltering()) {
+				filter = Graphics::FILTER_BILINEAR;
+			}
+			_surface = cache->find(owner, *srcRect, (uint16)dstRect->width(), (uint16)dstRect->height(), _transform, filter);
+			if (_surface) {
+				return;
+			}
+		}
+
+		// Untransformed draws in a sprite batch share their copies
+		BaseRenderOSystem *renderer = nullptr;
+		if (owner && !rotate && !scale) {
+			renderer = static_cast<BaseRenderOSystem *>(owner->_gameRef->_renderer);
+			_surface = renderer->findBatchedSurface(surf, *srcRect);
+			if (_surface) {
+				return;
+			}
+		}
+
+		Graphics::Surface *clipped = new Graphics::Surface();
+		clipped->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
+		assert(clipped->format.bytesPerPixel == 4);
 		// Get a clipped copy of the surface
-		for (int i = 0; i < _surface->h; i++) {
-			memcpy(_surface->getBasePtr(0, i), surf->getBasePtr(srcRect->left, srcRect->top + i), srcRect->width() * _surface->format.bytesPerPixel);
+		for (int i = 0; i < clipped->h; i++) {
+			memcpy(clipped->getBasePtr(0, i), surf->getBasePtr(srcRect->left, srcRect->top + i), srcRect->width() * clipped->format.bytesPerPixel);
 		}
 		// Then scale it if necessary
 		//
@@ -58,40 +89,35 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 		// NB: Mirroring and rotation are probably done in the wrong order.
 		// (Mirroring should most likely be done before rotation. See also
 		// TransformTools.)
-		if (_transform._angle != Graphics::kDefaultAngle) {
-			Graphics::TransparentSurface src(*_surface, false);
-			Graphics::Surface *temp;
-			if (owner->_gameRef->getBilinearFiltering()) {
+		Graphics::Surface *temp = clipped;
+		if (rotate) {
+			Graphics::TransparentSurface src(*clipped, false);
+			if (filter == Graphics::FILTER_BILINEAR) {
 				temp = src.rotoscaleT<Graphics::FILTER_BILINEAR>(transform);
 			} else {
 				temp = src.rotoscaleT<Graphics::FILTER_NEAREST>(transform);
 			}
-			_surface->free();
-			delete _surface;
-			_surface = temp;
-		} else if ((dstRect->width() != srcRect->width() ||
-					dstRect->height() != srcRect->height()) &&
-					_transform._numTimesX * _transform._numTimesY == 1) {
-			Graphics::TransparentSurface src(*_surface, false);
-			Graphics::Surface *temp;
-			if (owner->_gameRef->getBilinearFiltering()) {
+		} else if (scale) {
+			Graphics::TransparentSurface src(*clipped, false);
+			if (filter == Graphics::FILTER_BILINEAR) {
 				temp = src.scaleT<Graphics::FILTER_BILINEAR>(dstRect->width(), dstRect->height());
 			} else {
 				temp = src.scaleT<Graphics::FILTER_NEAREST>(dstRect->width(), dstRect->height());
 			}
-			_surface->free();
-			delete _surface;
-			_surface = temp;
 		}
-	} else {
-		_surface = nullptr;
-	}
-}
+		if (temp != clipped) {
+			clipped->free();
+			delete clipped;
+		}
 
-RenderTicket::~RenderTicket() {
-	if (_surface) {
-		_surface->free();
-		delete _surface;
+		if (cache) {
+			_surface = cache->insert(owner, *srcRect, (uint16)dstRect->width(), (uint16)dstRect->height(), _transform, filter, temp);
+		} else {
+			_surface = Common::SharedPtr<Graphics::Surface>(temp, Graphics::SurfaceDeleter());
+			if (renderer) {
+				renderer->addBatchedSurface(surf, *srcRect, _surface);
+			}
+		}
 	}
 }
 
@@ -64,12 +64,15 @@ ScScript::ScScript(BaseGame *inGame, ScEngine *engine) : BaseClass(inGame) {
 
 	_functions = nullptr;
 	_numFunctions = 0;
+	_functionPos.clear();
 
 	_methods = nullptr;
 	_numMethods = 0;
+	_methodPos.clear();
 
 	_events = nullptr;
 	_numEvents = 0;
+	_eventPos.clear();
 
 	_externals = nullptr;
 	_numExternals = 0;
@@ -181,9 +184,14 @@ bool ScScript::initTables() {
 
 	_numFunctions = getDWORD();
 	_functions = new TFunctionPos[_numFunctions];
+	_functionPos.clear();
 	for (uint32 i = 0; i < _numFunctions; i++) {
 		_functions[i].pos = getDWORD();
 		_functions[i].name = getString();
+		// The first of several functions with the same name is called
+		if (!_functionPos.contains(_functions[i].name)) {
+			_functionPos[_functions[i].name] = _functions[i].pos;
+		}
 	}
 
 
@@ -192,9 +200,12 @@ bool ScScript::initTables() {
 
 	_numEvents = getDWORD();
 	_events = new TEventPos[_numEvents];
+	_eventPos.clear();
 	for (uint32 i = 0; i < _numEvents; i++) {
 		_events[i].pos = getDWORD();
 		_events[i].name = getString();
+		// The last of several handlers of the same event is called
+		_eventPos[_events[i].name] = _events[i].pos;
 	}
 
 
@@ -224,9 +235,13 @@ bool ScScript::initTables() {
 
 	_numMethods = getDWORD();
 	_methods = new TMethodPos[_numMethods];
+	_methodPos.clear();
 	for (uint32 i = 0; i < _numMethods; i++) {
 		_methods[i].pos = getDWORD();
 		_methods[i].name = getString();
+		if (!_methodPos.contains(_methods[i].name)) {
+			_methodPos[_methods[i].name] = _methods[i].pos;
+		}
 	}
 
 
@@ -420,18 +435,21 @@ void ScScript::cleanup() {
 	}
 	_functions = nullptr;
 	_numFunctions = 0;
+	_functionPos.clear();
 
 	if (_methods) {
 		delete[] _methods;
 	}
 	_methods = nullptr;
 	_numMethods = 0;
+	_methodPos.clear();
 
 	if (_events) {
 		delete[] _events;
 	}
 	_events = nullptr;
 	_numEvents = 0;
+	_eventPos.clear();
 
 
 	if (_externals) {
@@ -469,18 +487,23 @@ void ScScript::cleanup() {
 
 //////////////////////////////////////////////////////////////////////////
 uint32 ScScript::getDWORD() {
-	_scriptStream->seek((int32)_iP);
-	uint32 ret = _scriptStream->readUint32LE();
+	// Read straight from the buffer, this is called for every instruction
+	uint32 ret = 0;
+	if (_iP + sizeof(uint32) <= _bufferSize) {
+		ret = READ_LE_UINT32(_buffer + _iP);
+	}
 	_iP += sizeof(uint32);
-//	assert(oldRet == ret);
 	return ret;
 }
 
 //////////////////////////////////////////////////////////////////////////
 double ScScript::getFloat() {
-	_scriptStream->seek((int32)_iP);
 	byte buffer[8];
-	_scriptStream->read(buffer, 8);
+	if (_iP + 8 <= _bufferSize) {
+		memcpy(buffer, _buffer + _iP, 8);
+	} else {
+		memset(buffer, 0, 8);
+	}
 
 #ifdef SCUMM_BIG_ENDIAN
 	// TODO: For lack of a READ_LE_UINT64
@@ -504,7 +527,6 @@ char *ScScript::getString() {
 		_iP++;
 	}
 	_iP++; // string terminator
-	_scriptStream->seek(_iP);
 
 	return ret;
 }
@@ -837,11 +859,9 @@ bool ScScript::executeInstruction() {
 		if (op1->isNULL() || op2->isNULL()) {
 			_operand->setNULL();
 		} else if (op1->getType() == VAL_STRING || op2->getType() == VAL_STRING) {
-			char *tempStr = new char [strlen(op1->getString()) + strlen(op2->getString()) + 1];
-			strcpy(tempStr, op1->getString());
-			strcat(tempStr, op2->getString());
-			_operand->setString(tempStr);
-			delete[] tempStr;
+			Common::String sum = op1->getString();
+			sum += op2->getString();
+			_operand->setString(sum);
 		} else if (op1->getType() == VAL_INT && op2->getType() == VAL_INT) {
 			_operand->setInt(op1->getInt() + op2->getInt());
 		} else {
@@ -1106,23 +1126,15 @@ bool ScScript::executeInstruction() {
 
 //////////////////////////////////////////////////////////////////////////
 uint32 ScScript::getFuncPos(const Common::String &name) {
-	for (uint32 i = 0; i < _numFunctions; i++) {
-		if (name == _functions[i].name) {
-			return _functions[i].pos;
-		}
-	}
-	return 0;
+	PosMap::const_iterator i = _functionPos.find(name);
+	return i != _functionPos.end() ? i->_value : 0;
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 uint32 ScScript::getMethodPos(const Common::String &name) const {
-	for (uint32 i = 0; i < _numMethods; i++) {
-		if (name == _methods[i].name) {
-			return _methods[i].pos;
-		}
-	}
-	return 0;
+	PosMap::const_iterator i = _methodPos.find(name);
+	return i != _methodPos.end() ? i->_value : 0;
 }
 
 
@@ -1154,16 +1166,15 @@ ScValue *ScScript::getVar(char *name) {
 	if (ret == nullptr) {
 		//RuntimeError("Variable '%s' is inaccessible in the current block. Consider changing the script.", name);
 		_gameRef->LOG(0, "Warning: variable '%s' is inaccessible in the current block. Consider changing the script (script:%s, line:%d)", name, _filename, _currentLine);
-		ScValue *val = new ScValue(_gameRef);
+		ScValue val(_gameRef);
 		ScValue *scope = _scopeStack->getTop();
 		if (scope) {
-			scope->setProp(name, val);
+			scope->setProp(name, &val);
 			ret = _scopeStack->getTop()->getProp(name);
 		} else {
-			_globals->setProp(name, val);
+			_globals->setProp(name, &val);
 			ret = _globals->getProp(name);
 		}
-		delete val;
 	}
 
 	return ret;
@@ -1348,12 +1359,8 @@ ScScript *ScScript::invokeEventHandler(const Common::String &eventName, bool unb
 
 //////////////////////////////////////////////////////////////////////////
 uint32 ScScript::getEventPos(const Common::String &name) const {
-	for (int i = _numEvents - 1; i >= 0; i--) {
-		if (scumm_stricmp(name.c_str(), _events[i].name) == 0) {
-			return _events[i].pos;
-		}
-	}
-	return 0;
+	EventPosMap::const_iterator i = _eventPos.find(name);
+	return i != _eventPos.end() ? i->_value : 0;
 }
 
 
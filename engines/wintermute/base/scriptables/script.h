@@ -34,6 +34,8 @@
 #include "engines/wintermute/base/scriptables/dcscript.h"   // Added by ClassView
 #include "engines/wintermute/coll_templ.h"
 #include "engines/wintermute/persistent.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 
 namespace Wintermute {
 class BaseScriptHolder;
@@ -162,6 +164,13 @@ private:
 	uint32 _numMethods;
 	uint32 _numEvents;
 
+	// Positions of the entries of the tables above, by name
+	typedef Common::HashMap<Common::String, uint32> PosMap;
+	typedef Common::HashMap<Common::String, uint32, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> EventPosMap;
+	PosMap _functionPos;
+	PosMap _methodPos;
+	EventPosMap _eventPos;
+
 	bool initScript();
 	bool initTables();
 
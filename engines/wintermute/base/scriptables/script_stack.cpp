@@ -122,24 +122,29 @@ void ScStack::correctParams(uint32 expectedParams) {
 	if (expectedParams < nuParams) { // too many params
 		while (expectedParams < nuParams) {
 			//Pop();
-			delete _values[_sP - expectedParams];
+			// The value is kept above the top for reuse by later pushes
+			ScValue *val = _values[_sP - expectedParams];
 			_values.remove_at(_sP - expectedParams);
+			val->cleanup();
+			_values.add(val);
 			nuParams--;
 			_sP--;
 		}
 	} else if (expectedParams > nuParams) { // need more params
 		while (expectedParams > nuParams) {
 			//Push(null_val);
-			ScValue *nullVal = new ScValue(_gameRef);
+			ScValue *nullVal;
+			if ((int32)_values.size() > _sP + 1) {
+				nullVal = _values[_values.size() - 1];
+				_values.remove_at(_values.size() - 1);
+				nullVal->cleanup();
+			} else {
+				nullVal = new ScValue(_gameRef);
+			}
 			nullVal->setNULL();
 			_values.insert_at(_sP - nuParams + 1, nullVal);
 			nuParams++;
 			_sP++;
-
-			if ((int32)_values.size() > _sP + 1) {
-				delete _values[_values.size() - 1];
-				_values.remove_at(_values.size() - 1);
-			}
 		}
 	}
 }
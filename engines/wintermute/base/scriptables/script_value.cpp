@@ -122,9 +122,7 @@ ScValue::ScValue(BaseGame *inGame, const char *val) : BaseClass(inGame) {
 void ScValue::cleanup(bool ignoreNatives) {
 	deleteProps();
 
-	if (_valString) {
-		delete[] _valString;
-	}
+	freeStringVal();
 
 	if (!ignoreNatives) {
 		if (_valNative && !_persistent) {
@@ -449,23 +447,37 @@ void ScValue::setString(const Common::String &val) {
 
 //////////////////////////////////////////////////////////////////////////
 void ScValue::setStringVal(const char *val) {
-	if (_valString) {
-		delete[] _valString;
-		_valString = nullptr;
-	}
-
 	if (val == nullptr) {
-		_valString = nullptr;
+		freeStringVal();
 		return;
 	}
 
-	_valString = new char [strlen(val) + 1];
-	if (_valString) {
-		strcpy(_valString, val);
+	// val may point into the current string, so it is copied before that
+	// is freed
+	const uint32 size = strlen(val) + 1;
+	if (size <= sizeof(_valStringInline)) {
+		// Short strings, which scripts build all the time, need no allocation
+		memmove(_valStringInline, val, size);
+		freeStringVal();
+		_valString = _valStringInline;
+	} else {
+		char *str = new char[size];
+		memcpy(str, val, size);
+		freeStringVal();
+		_valString = str;
 	}
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void ScValue::freeStringVal() {
+	if (_valString != _valStringInline) {
+		delete[] _valString;
+	}
+	_valString = nullptr;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 void ScValue::setNULL() {
 	if (_type == VAL_VARIABLE_REF) {
@@ -963,44 +975,34 @@ int ScValue::compareStrict(ScValue *val1, ScValue *val2) {
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProperty(const char *propName, int32 value) {
-	ScValue *val = new ScValue(_gameRef,  value);
-	bool ret =  DID_SUCCEED(setProp(propName, val));
-	delete val;
-	return ret;
+	ScValue val(_gameRef, value);
+	return DID_SUCCEED(setProp(propName, &val));
 }
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProperty(const char *propName, const char *value) {
-	ScValue *val = new ScValue(_gameRef,  value);
-	bool ret =  DID_SUCCEED(setProp(propName, val));
-	delete val;
-	return ret;
+	ScValue val(_gameRef, value);
+	return DID_SUCCEED(setProp(propName, &val));
 }
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProperty(const char *propName, double value) {
-	ScValue *val = new ScValue(_gameRef,  value);
-	bool ret =  DID_SUCCEED(setProp(propName, val));
-	delete val;
-	return ret;
+	ScValue val(_gameRef, value);
+	return DID_SUCCEED(setProp(propName, &val));
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProperty(const char *propName, bool value) {
-	ScValue *val = new ScValue(_gameRef,  value);
-	bool ret =  DID_SUCCEED(setProp(propName, val));
-	delete val;
-	return ret;
+	ScValue val(_gameRef, value);
+	return DID_SUCCEED(setProp(propName, &val));
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProperty(const char *propName) {
-	ScValue *val = new ScValue(_gameRef);
-	bool ret =  DID_SUCCEED(setProp(propName, val));
-	delete val;
-	return ret;
+	ScValue val(_gameRef);
+	return DID_SUCCEED(setProp(propName, &val));
 }
 
 } // End of namespace Wintermute
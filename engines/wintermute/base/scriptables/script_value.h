@@ -89,7 +89,10 @@ private:
 	bool _valBool;
 	int32 _valInt;
 	double _valFloat;
-	char *_valString;
+	char *_valString;	///< Points to _valStringInline for short strings
+	char _valStringInline[24];
+
+	void freeStringVal();
 public:
 	TValType _type;
 	ScValue(BaseGame *inGame);
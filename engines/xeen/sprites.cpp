@@ -188,8 +188,9 @@ void SpriteResource::drawOffset(XSurface &dest, uint16 offset, const Common::Poi
 			// to handle both deciding which pixels to draw in a scaled image, as well as when images
 			// have been horizontally flipped. Note that we allocate an extra line for before and after our
 			// work line, just in case the sprite is screwed up and overruns the line
+			// Only the part of the work line that gets drawn out needs to be initialized
 			int tempLine[SCREEN_WIDTH * 3];
-			Common::fill(&tempLine[SCREEN_WIDTH], &tempLine[SCREEN_WIDTH * 3], -1);
+			Common::fill(&tempLine[SCREEN_WIDTH], &tempLine[SCREEN_WIDTH + MIN(width, SCREEN_WIDTH * 2)], -1);
 			int *lineP = flipped ? &tempLine[SCREEN_WIDTH + width - 1 - xOffset] : &tempLine[SCREEN_WIDTH + xOffset];
 
 			// Build up the line
@@ -277,29 +278,49 @@ void SpriteResource::drawOffset(XSurface &dest, uint16 offset, const Common::Poi
 			int16 xp = destPos.x;
 			lineP = &tempLine[SCREEN_WIDTH];
 
-			for (int xCtr = 0; xCtr < width; ++xCtr, ++lineP) {
-				bit = (scaleMaskX >> 15) & 1;
-				scaleMaskX = ((scaleMaskX & 0x7fff) << 1) + bit;
-
-				if (bit) {
-					// Check whether there's a pixel to write, and we're within the allowable bounds. Note that for
-					// the SPRFLAG_SCENE_CLIPPED or when enlarging, we also have an extra horizontal bounds check
-					if (*lineP != -1 && xp >= bounds.left && xp < bounds.right) {
-						drawBounds.left = MIN(drawBounds.left, xp);
-						drawBounds.right = MAX((int)drawBounds.right, xp + 1);
-						*destP = (byte)*lineP;
-						if (enlarge) {
-							*(destP + SCREEN_WIDTH) = (byte)*lineP;
-							*(destP + 1) = (byte)*lineP;
-							*(destP + 1 + SCREEN_WIDTH) = (byte)*lineP;
-						}
+			if (scaleMaskXCopy == 0xFFFF && !enlarge) {
+				// Unscaled lines can be clipped once up front, rather than checking every pixel
+				int xStart = MAX(bounds.left - destPos.x, 0);
+				int xEnd = MIN(bounds.right - destPos.x, width);
+				int drawnLeft = xEnd, drawnRight = xStart;
+
+				for (int xCtr = xStart; xCtr < xEnd; ++xCtr) {
+					if (lineP[xCtr] != -1) {
+						destP[xCtr] = (byte)lineP[xCtr];
+						drawnLeft = MIN(drawnLeft, xCtr);
+						drawnRight = xCtr + 1;
 					}
+				}
+
+				if (drawnLeft < drawnRight) {
+					drawBounds.left = MIN((int)drawBounds.left, destPos.x + drawnLeft);
+					drawBounds.right = MAX((int)drawBounds.right, destPos.x + drawnRight);
+				}
+			} else {
+				for (int xCtr = 0; xCtr < width; ++xCtr, ++lineP) {
+					bit = (scaleMaskX >> 15) & 1;
+					scaleMaskX = ((scaleMaskX & 0x7fff) << 1) + bit;
+
+					if (bit) {
+						// Check whether there's a pixel to write, and we're within the allowable bounds. Note that for
+						// the SPRFLAG_SCENE_CLIPPED or when enlarging, we also have an extra horizontal bounds check
+						if (*lineP != -1 && xp >= bounds.left && xp < bounds.right) {
+							drawBounds.left = MIN(drawBounds.left, xp);
+							drawBounds.right = MAX((int)drawBounds.right, xp + 1);
+							*destP = (byte)*lineP;
+							if (enlarge) {
+								*(destP + SCREEN_WIDTH) = (byte)*lineP;
+								*(destP + 1) = (byte)*lineP;
+								*(destP + 1 + SCREEN_WIDTH) = (byte)*lineP;
+							}
+						}
 
-					++xp;
-					++destP;
-					if (enlarge) {
-						++destP;
 						++xp;
+						++destP;
+						if (enlarge) {
+							++destP;
+							++xp;
+						}
 					}
 				}
 			}
@@ -110,6 +110,8 @@ const Graphics::Surface *FogFx::draw(const Graphics::Surface &srcSubRect) {
 }
 
 void FogFx::update() {
+	_changed = true;
+
 	_pos += _engine->getScriptManager()->getStateValue(StateKey_EF9_Speed);
 	_pos %= _fog.w;
 
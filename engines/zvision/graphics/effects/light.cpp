@@ -92,6 +92,8 @@ const Graphics::Surface *LightFx::draw(const Graphics::Surface &srcSubRect) {
 }
 
 void LightFx::update() {
+	_changed = true;
+
 	if (_up)
 		_pos++;
 	else
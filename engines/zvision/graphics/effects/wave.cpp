@@ -58,15 +58,66 @@ WaveFx::WaveFx(ZVision *engine, uint32 key, Common::Rect region, bool ported, in
 			}
 		phase += spd;
 	}
+
+	uint32 frameSize = _surface.pitch * _surface.h;
+	_frameCache.resize(MIN<uint32>(_frameCount, frameSize ? kFrameCacheSize / frameSize : 0));
+	for (uint i = 0; i < _frameCache.size(); i++)
+		_frameCache[i] = nullptr;
 }
 
 WaveFx::~WaveFx() {
 	for (uint16 i = 0; i < _ampls.size(); i++)
 		_ampls[i].clear();
 	_ampls.clear();
+
+	clearFrameCache();
+	_source.free();
+}
+
+bool WaveFx::isSameSource(const Graphics::Surface &srcSubRect) {
+	if (srcSubRect.w != _source.w || srcSubRect.h != _source.h || srcSubRect.format != _source.format)
+		return false;
+
+	for (int16 y = 0; y < srcSubRect.h; y++) {
+		if (memcmp(srcSubRect.getBasePtr(0, y), _source.getBasePtr(0, y), srcSubRect.w * srcSubRect.format.bytesPerPixel))
+			return false;
+	}
+
+	return true;
+}
+
+void WaveFx::clearFrameCache() {
+	for (uint i = 0; i < _frameCache.size(); i++) {
+		if (_frameCache[i]) {
+			_frameCache[i]->free();
+			delete _frameCache[i];
+			_frameCache[i] = nullptr;
+		}
+	}
 }
 
 const Graphics::Surface *WaveFx::draw(const Graphics::Surface &srcSubRect) {
+	// The frames only depend on the phase and the image below the effect
+	if (!isSameSource(srcSubRect)) {
+		clearFrameCache();
+		_source.copyFrom(srcSubRect);
+	}
+
+	if ((uint)_frame >= _frameCache.size()) {
+		drawFrame(srcSubRect);
+		return &_surface;
+	}
+
+	if (!_frameCache[_frame]) {
+		drawFrame(srcSubRect);
+		_frameCache[_frame] = new Graphics::Surface();
+		_frameCache[_frame]->copyFrom(_surface);
+	}
+
+	return _frameCache[_frame];
+}
+
+void WaveFx::drawFrame(const Graphics::Surface &srcSubRect) {
 	for (int16 y = 0; y < _halfHeight; y++) {
 		uint16 *abc  = (uint16 *)_surface.getBasePtr(0, y);
 		uint16 *abc2  = (uint16 *)_surface.getBasePtr(0, _halfHeight + y);
@@ -134,11 +185,10 @@ const Graphics::Surface *WaveFx::draw(const Graphics::Surface &srcSubRect) {
 			abc4++;
 		}
 	}
-
-	return &_surface;
 }
 
 void WaveFx::update() {
+	_changed = true;
 	_frame = (_frame + 1) % _frameCount;
 }
 
@@ -45,6 +45,18 @@ private:
 	int16 _frameCount;
 	int16 _halfWidth, _halfHeight;
 	Common::Array< Common::Array< int8 > > _ampls;
+
+	// Frames drawn from the current source image, as long as they fit in the budget
+	enum {
+		kFrameCacheSize = 4 * 1024 * 1024
+	};
+
+	Graphics::Surface _source;
+	Common::Array<Graphics::Surface *> _frameCache;
+
+	bool isSameSource(const Graphics::Surface &srcSubRect);
+	void clearFrameCache();
+	void drawFrame(const Graphics::Surface &srcSubRect);
 };
 } // End of namespace ZVision
 
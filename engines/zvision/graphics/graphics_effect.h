@@ -36,7 +36,7 @@ class ZVision;
 class GraphicsEffect {
 public:
 
-	GraphicsEffect(ZVision *engine, uint32 key, Common::Rect region, bool ported) : _engine(engine), _key(key), _region(region), _ported(ported) {
+	GraphicsEffect(ZVision *engine, uint32 key, Common::Rect region, bool ported) : _engine(engine), _key(key), _region(region), _ported(ported), _changed(true) {
 		_surface.create(_region.width(), _region.height(), _engine->_resourcePixelFormat);
 	}
 	virtual ~GraphicsEffect() {}
@@ -53,6 +53,15 @@ public:
 		return _ported;
 	}
 
+	// Whether the effect has to be drawn again, even if the image below it did not change
+	bool hasChanged() {
+		return _changed;
+	}
+
+	void clearChanged() {
+		_changed = false;
+	}
+
 	virtual const Graphics::Surface *draw(const Graphics::Surface &srcSubRect) {
 		return &_surface;
 	}
@@ -64,6 +73,7 @@ protected:
 	uint32 _key;
 	Common::Rect _region;
 	bool _ported;
+	bool _changed;
 	Graphics::Surface _surface;
 
 // Static member functions
@@ -51,6 +51,7 @@ RenderManager::RenderManager(ZVision *engine, uint32 windowWidth, uint32 windowH
 	  _backgroundOffset(0),
 	  _renderTable(_workingWindow.width(), _workingWindow.height()),
 	  _doubleFPS(doubleFPS),
+	  _effectsChanged(false),
 	  _subid(0) {
 
 	_backgroundSurface.create(_workingWindow.width(), _workingWindow.height(), _pixelFormat);
@@ -76,41 +77,62 @@ void RenderManager::renderSceneToScreen() {
 	Graphics::Surface *out = &_warpedSceneSurface;
 	Graphics::Surface *in = &_backgroundSurface;
 	Common::Rect outWndDirtyRect;
+	Common::Rect windowRect(_workingWindow.width(), _workingWindow.height());
 
-	// If we have graphical effects, we apply them using a temporary buffer
+	if (_effectsChanged) {
+		_backgroundSurfaceDirtyRect = windowRect;
+		_effectsChanged = false;
+	}
+
+	// If we have graphical effects, we apply them using a temporary buffer.
+	// The buffer is kept between frames, and only the effects that changed or
+	// that are over a changed part of the scene are drawn again. Overlapping
+	// effects are drawn again together, so they are applied in the same order.
 	if (!_effects.empty()) {
-		bool copied = false;
-		Common::Rect windowRect(_workingWindow.width(), _workingWindow.height());
+		Common::Rect dirtyRect = _backgroundSurfaceDirtyRect;
 
-		for (EffectsList::iterator it = _effects.begin(); it != _effects.end(); it++) {
-			Common::Rect rect = (*it)->getRegion();
-			Common::Rect screenSpaceLocation = rect;
+		bool extended = true;
+		while (extended) {
+			extended = false;
 
-			if ((*it)->isPort()) {
-				screenSpaceLocation = transformBackgroundSpaceRectToScreenSpace(screenSpaceLocation);
+			for (EffectsList::iterator it = _effects.begin(); it != _effects.end(); it++) {
+				Common::Rect screenSpaceLocation = getEffectScreenSpaceRect(*it);
+				screenSpaceLocation.clip(windowRect);
+				if (screenSpaceLocation.isEmpty() || dirtyRect.contains(screenSpaceLocation))
+					continue;
+
+				if ((*it)->hasChanged() || dirtyRect.intersects(screenSpaceLocation)) {
+					if (dirtyRect.isEmpty())
+						dirtyRect = screenSpaceLocation;
+					else
+						dirtyRect.extend(screenSpaceLocation);
+					extended = true;
+				}
 			}
+		}
 
-			if (windowRect.intersects(screenSpaceLocation)) {
-				if (!copied) {
-					copied = true;
-					_effectSurface.copyFrom(_backgroundSurface);
-					in = &_effectSurface;
-				}
-				const Graphics::Surface *post;
-				if ((*it)->isPort())
-					post = (*it)->draw(_currentBackgroundImage.getSubArea(rect));
-				else
-					post = (*it)->draw(_effectSurface.getSubArea(rect));
-				Common::Rect empty;
-				blitSurfaceToSurface(*post, empty, _effectSurface, screenSpaceLocation.left, screenSpaceLocation.top);
-				screenSpaceLocation.clip(windowRect);
-				if (_backgroundSurfaceDirtyRect .isEmpty()) {
-					_backgroundSurfaceDirtyRect = screenSpaceLocation;
-				} else {
-					_backgroundSurfaceDirtyRect.extend(screenSpaceLocation);
+		if (!dirtyRect.isEmpty()) {
+			_effectSurface.copyRectToSurface(_backgroundSurface, dirtyRect.left, dirtyRect.top, dirtyRect);
+
+			for (EffectsList::iterator it = _effects.begin(); it != _effects.end(); it++) {
+				Common::Rect rect = (*it)->getRegion();
+				Common::Rect screenSpaceLocation = getEffectScreenSpaceRect(*it);
+
+				if (dirtyRect.intersects(screenSpaceLocation)) {
+					const Graphics::Surface *post;
+					if ((*it)->isPort())
+						post = (*it)->draw(_currentBackgroundImage.getSubArea(rect));
+					else
+						post = (*it)->draw(_effectSurface.getSubArea(rect));
+					Common::Rect empty;
+					blitSurfaceToSurface(*post, empty, _effectSurface, screenSpaceLocation.left, screenSpaceLocation.top);
+					(*it)->clearChanged();
 				}
 			}
 		}
+
+		_backgroundSurfaceDirtyRect = dirtyRect;
+		in = &_effectSurface;
 	}
 
 	RenderTable::RenderState state = _renderTable.getRenderState();
@@ -777,8 +799,18 @@ Common::Point RenderManager::getBkgSize() {
 	return Common::Point(_backgroundWidth, _backgroundHeight);
 }
 
+Common::Rect RenderManager::getEffectScreenSpaceRect(GraphicsEffect *effect) {
+	Common::Rect rect = effect->getRegion();
+
+	if (effect->isPort())
+		rect = transformBackgroundSpaceRectToScreenSpace(rect);
+
+	return rect;
+}
+
 void RenderManager::addEffect(GraphicsEffect *_effect) {
 	_effects.push_back(_effect);
+	_effectsChanged = true;
 }
 
 void RenderManager::deleteEffect(uint32 ID) {
@@ -786,6 +818,7 @@ void RenderManager::deleteEffect(uint32 ID) {
 		if ((*it)->getKey() == ID) {
 			delete *it;
 			it = _effects.erase(it);
+			_effectsChanged = true;
 		}
 	}
 }
@@ -132,6 +132,9 @@ private:
 	// Visual effects list
 	EffectsList _effects;
 
+	// Set when effects are added or removed, so the whole scene is drawn again
+	bool _effectsChanged;
+
 	bool _doubleFPS;
 
 public:
@@ -302,6 +305,9 @@ public:
 	// Delete effect(s) by ID (ID equal to slot of action:region that create this effect)
 	void deleteEffect(uint32 ID);
 
+	// Get the rect covered by an effect on the working window
+	Common::Rect getEffectScreenSpaceRect(GraphicsEffect *effect);
+
 	// Create "mask" for effects - (color +/- depth) will be selected as not transparent. Like color selection
 	// xy - base color
 	// depth - +/- of base color
@@ -42,7 +42,8 @@ public:
 
 private:
 	uint _numColumns, _numRows;
-	Common::Point *_internalBuffer;
+	// Index of the source pixel of each warped pixel, in row-major order
+	uint32 *_internalBuffer;
 	RenderState _renderState;
 
 	struct {
@@ -90,6 +91,7 @@ public:
 private:
 	void generatePanoramaLookupTable();
 	void generateTiltLookupTable();
+	void setSourcePixel(uint x, uint y, int32 sourceX, int32 sourceY);
 };
 
 } // End of namespace ZVision
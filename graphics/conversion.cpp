@@ -25,6 +25,16 @@
 
 #include "common/endian.h"
 
+// 16 bit to 32 bit conversions, e.g. RGB565 to RGBA8888, are done eight
+// pixels at a time where SSE2 or NEON are available.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CONVERSION_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define CONVERSION_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace Graphics {
 
 // TODO: YUV to RGB conversion function
@@ -96,6 +106,263 @@ inline void crossBlitLogic3BppSource(byte *dst, const byte *src, const uint w, c
 	}
 }
 
+/**
+ * Converting a color between two pixel formats only ever copies single bits
+ * around (see PixelFormat::colorToARGB and PixelFormat::ARGBToColor), apart
+ * from the constant alpha of formats without alpha. The converted color is
+ * thus the bitwise or of the converted bytes of the color, which lets us
+ * convert with one table lookup per source byte.
+ */
+struct ColorLookup {
+	uint32 table[4][256];
+
+	ColorLookup(const PixelFormat &srcFmt, const PixelFormat &dstFmt) {
+		for (uint i = 0; i < srcFmt.bytesPerPixel; ++i) {
+			for (uint j = 0; j < 256; ++j) {
+				byte a, r, g, b;
+				srcFmt.colorToARGB(j << (i * 8), a, r, g, b);
+				table[i][j] = dstFmt.ARGBToColor(a, r, g, b);
+			}
+		}
+	}
+
+	inline uint32 convert16(uint32 color) const {
+		return table[0][color & 0xFF] | table[1][(color >> 8) & 0xFF];
+	}
+
+	inline uint32 convert24(uint32 color) const {
+		return convert16(color) | table[2][(color >> 16) & 0xFF];
+	}
+
+	inline uint32 convert32(uint32 color) const {
+		return convert24(color) | table[3][color >> 24];
+	}
+};
+
+// Building the tables costs about as much as converting a thousand pixels
+const uint kColorLookupMinPixels = 4096;
+
+template<typename SrcColor, typename DstColor, bool backward>
+inline void crossBlitLookupLogic(byte *dst, const byte *src, const uint w, const uint h,
+                                 const ColorLookup &lookup,
+                                 const uint srcDelta, const uint dstDelta) {
+	for (uint y = 0; y < h; ++y) {
+		for (uint x = 0; x < w; ++x) {
+			const uint32 color = *(const SrcColor *)src;
+			if (sizeof(SrcColor) == 2)
+				*(DstColor *)dst = lookup.convert16(color);
+			else
+				*(DstColor *)dst = lookup.convert32(color);
+
+			if (backward) {
+				src -= sizeof(SrcColor);
+				dst -= sizeof(DstColor);
+			} else {
+				src += sizeof(SrcColor);
+				dst += sizeof(DstColor);
+			}
+		}
+
+		if (backward) {
+			src -= srcDelta;
+			dst -= dstDelta;
+		} else {
+			src += srcDelta;
+			dst += dstDelta;
+		}
+	}
+}
+
+template<typename DstColor, bool backward>
+inline void crossBlitLookupLogic3BppSource(byte *dst, const byte *src, const uint w, const uint h,
+                                           const ColorLookup &lookup,
+                                           const uint srcDelta, const uint dstDelta) {
+	uint32 color = 0;
+	uint8 *col = (uint8 *)&color;
+#ifdef SCUMM_BIG_ENDIAN
+	col++;
+#endif
+	for (uint y = 0; y < h; ++y) {
+		for (uint x = 0; x < w; ++x) {
+			memcpy(col, src, 3);
+			*(DstColor *)dst = lookup.convert24(color);
+
+			if (backward) {
+				src -= 3;
+				dst -= sizeof(DstColor);
+			} else {
+				src += 3;
+				dst += sizeof(DstColor);
+			}
+		}
+
+		if (backward) {
+			src -= srcDelta;
+			dst -= dstDelta;
+		} else {
+			src += srcDelta;
+			dst += dstDelta;
+		}
+	}
+}
+
+#if defined(CONVERSION_USE_SSE2) || defined(CONVERSION_USE_NEON)
+
+/**
+ * Converts 16 bit colors to 32 bit colors, eight at a time. Only
+ * destination formats with 8 bit channels (or none at all) are handled,
+ * so every channel is just expanded like ColorComponent::expand does and
+ * shifted into place.
+ */
+class CrossBlit16To32 {
+public:
+	static bool isSupported(const PixelFormat &srcFmt, const PixelFormat &dstFmt) {
+		return srcFmt.bytesPerPixel == 2 && dstFmt.bytesPerPixel == 4 &&
+		       (dstFmt.rLoss == 0 || dstFmt.rLoss == 8) && (dstFmt.gLoss == 0 || dstFmt.gLoss == 8) &&
+		       (dstFmt.bLoss == 0 || dstFmt.bLoss == 8) && (dstFmt.aLoss == 0 || dstFmt.aLoss == 8);
+	}
+
+	CrossBlit16To32(const PixelFormat &srcFmt, const PixelFormat &dstFmt) : _numChannels(0), _constant(0) {
+		addChannel(srcFmt.aBits(), srcFmt.aShift, dstFmt.aLoss, dstFmt.aShift, 0xFF);
+		addChannel(srcFmt.rBits(), srcFmt.rShift, dstFmt.rLoss, dstFmt.rShift, 0);
+		addChannel(srcFmt.gBits(), srcFmt.gShift, dstFmt.gLoss, dstFmt.gShift, 0);
+		addChannel(srcFmt.bBits(), srcFmt.bShift, dstFmt.bLoss, dstFmt.bShift, 0);
+	}
+
+	/**
+	 * Convert the last (backward) or first pixels of a row which are a
+	 * multiple of eight, returning their number.
+	 */
+	template<bool backward>
+	uint convertRow(uint32 *dst, const uint16 *src, const uint w) const {
+		const uint count = w & ~7;
+		if (backward) {
+			// Point at the first of the pixels to convert
+			dst -= count - 1;
+			src -= count - 1;
+			for (uint x = count; x > 0; x -= 8)
+				convert8(dst + x - 8, src + x - 8);
+		} else {
+			for (uint x = 0; x < count; x += 8)
+				convert8(dst + x, src + x);
+		}
+		return count;
+	}
+
+private:
+	struct Channel {
+		uint srcShift;
+		uint16 srcMask;
+		uint bits;
+		uint dstShift;
+	};
+
+	Channel _channels[4];
+	uint _numChannels;
+	uint32 _constant;
+
+	void addChannel(uint bits, uint srcShift, uint dstLoss, uint dstShift, uint32 fill) {
+		if (dstLoss == 8)
+			return;
+
+		if (bits == 0) {
+			_constant |= fill << dstShift;
+			return;
+		}
+
+		Channel &channel = _channels[_numChannels++];
+		channel.srcShift = srcShift;
+		channel.srcMask = (1 << bits) - 1;
+		channel.bits = bits;
+		channel.dstShift = dstShift;
+	}
+
+#if defined(CONVERSION_USE_SSE2)
+	inline void convert8(uint32 *dst, const uint16 *src) const {
+		const __m128i colors = _mm_loadu_si128((const __m128i *)src);
+		const __m128i zero = _mm_setzero_si128();
+		__m128i lo = _mm_set1_epi32(_constant);
+		__m128i hi = lo;
+
+		for (uint i = 0; i < _numChannels; ++i) {
+			const Channel &channel = _channels[i];
+			__m128i v = _mm_and_si128(_mm_srl_epi16(colors, _mm_cvtsi32_si128(channel.srcShift)), _mm_set1_epi16(channel.srcMask));
+			v = _mm_sll_epi16(v, _mm_cvtsi32_si128(8 - channel.bits));
+			__m128i expanded = v;
+			for (uint shift = channel.bits; shift < 8; shift += channel.bits)
+				expanded = _mm_or_si128(expanded, _mm_srl_epi16(v, _mm_cvtsi32_si128(shift)));
+
+			const __m128i dstShift = _mm_cvtsi32_si128(channel.dstShift);
+			lo = _mm_or_si128(lo, _mm_sll_epi32(_mm_unpacklo_epi16(expanded, zero), dstShift));
+			hi = _mm_or_si128(hi, _mm_sll_epi32(_mm_unpackhi_epi16(expanded, zero), dstShift));
+		}
+
+		_mm_storeu_si128((__m128i *)dst, lo);
+		_mm_storeu_si128((__m128i *)(dst + 4), hi);
+	}
+#else
+	inline void convert8(uint32 *dst, const uint16 *src) const {
+		const uint16x8_t colors = vld1q_u16(src);
+		uint32x4_t lo = vdupq_n_u32(_constant);
+		uint32x4_t hi = lo;
+
+		for (uint i = 0; i < _numChannels; ++i) {
+			const Channel &channel = _channels[i];
+			uint16x8_t v = vandq_u16(vshlq_u16(colors, vdupq_n_s16(-(int16)channel.srcShift)), vdupq_n_u16(channel.srcMask));
+			v = vshlq_u16(v, vdupq_n_s16(8 - channel.bits));
+			uint16x8_t expanded = v;
+			for (uint shift = channel.bits; shift < 8; shift += channel.bits)
+				expanded = vorrq_u16(expanded, vshlq_u16(v, vdupq_n_s16(-(int16)shift)));
+
+			const int32x4_t dstShift = vdupq_n_s32(channel.dstShift);
+			lo = vorrq_u32(lo, vshlq_u32(vmovl_u16(vget_low_u16(expanded)), dstShift));
+			hi = vorrq_u32(hi, vshlq_u32(vmovl_u16(vget_high_u16(expanded)), dstShift));
+		}
+
+		vst1q_u32(dst, lo);
+		vst1q_u32(dst + 4, hi);
+	}
+#endif
+};
+
+template<bool backward>
+inline void crossBlit16To32Logic(byte *dst, const byte *src, const uint w, const uint h,
+                                 const CrossBlit16To32 &converter, const ColorLookup &lookup,
+                                 const uint srcDelta, const uint dstDelta) {
+	for (uint y = 0; y < h; ++y) {
+		uint x = 0;
+
+		// When converting backwards in place the vector code must not
+		// overwrite source pixels left of the ones it reads, so the
+		// remaining pixels are converted first.
+		if (backward) {
+			for (; x < (w & 7); ++x) {
+				*(uint32 *)dst = lookup.convert16(*(const uint16 *)src);
+				src -= 2;
+				dst -= 4;
+			}
+		}
+
+		const uint count = converter.convertRow<backward>((uint32 *)dst, (const uint16 *)src, w);
+		if (backward) {
+			src -= count * 2 + srcDelta;
+			dst -= count * 4 + dstDelta;
+		} else {
+			src += count * 2;
+			dst += count * 4;
+			for (x = count; x < w; ++x) {
+				*(uint32 *)dst = lookup.convert16(*(const uint16 *)src);
+				src += 2;
+				dst += 4;
+			}
+			src += srcDelta;
+			dst += dstDelta;
+		}
+	}
+}
+
+#endif
+
 } // End of anonymous namespace
 
 // Function to blit a rect from one color format to another
@@ -130,7 +397,44 @@ bool crossBlit(byte *dst, const byte *src,
 	const uint srcDelta = (srcPitch - w * srcFmt.bytesPerPixel);
 	const uint dstDelta = (dstPitch - w * dstFmt.bytesPerPixel);
 
-	// TODO: optimized cases for dstDelta of 0
+	// Larger blits are converted using lookup tables
+	if (w * h >= kColorLookupMinPixels) {
+		const ColorLookup lookup(srcFmt, dstFmt);
+
+		if (dstFmt.bytesPerPixel == 2) {
+			if (srcFmt.bytesPerPixel == 2) {
+				crossBlitLookupLogic<uint16, uint16, false>(dst, src, w, h, lookup, srcDelta, dstDelta);
+			} else if (srcFmt.bytesPerPixel == 3) {
+				crossBlitLookupLogic3BppSource<uint16, false>(dst, src, w, h, lookup, srcDelta, dstDelta);
+			} else {
+				crossBlitLookupLogic<uint32, uint16, false>(dst, src, w, h, lookup, srcDelta, dstDelta);
+			}
+		} else if (dstFmt.bytesPerPixel == 4) {
+			if (srcFmt.bytesPerPixel == 2) {
+				// Blit from bottom right to top left, see below
+				dst += h * dstPitch - dstDelta - dstFmt.bytesPerPixel;
+				src += h * srcPitch - srcDelta - srcFmt.bytesPerPixel;
+#if defined(CONVERSION_USE_SSE2) || defined(CONVERSION_USE_NEON)
+				if (CrossBlit16To32::isSupported(srcFmt, dstFmt)) {
+					const CrossBlit16To32 converter(srcFmt, dstFmt);
+					crossBlit16To32Logic<true>(dst, src, w, h, converter, lookup, srcDelta, dstDelta);
+					return true;
+				}
+#endif
+				crossBlitLookupLogic<uint16, uint32, true>(dst, src, w, h, lookup, srcDelta, dstDelta);
+			} else if (srcFmt.bytesPerPixel == 3) {
+				dst += h * dstPitch - dstDelta - dstFmt.bytesPerPixel;
+				src += h * srcPitch - srcDelta - srcFmt.bytesPerPixel;
+				crossBlitLookupLogic3BppSource<uint32, true>(dst, src, w, h, lookup, srcDelta, dstDelta);
+			} else {
+				crossBlitLookupLogic<uint32, uint32, false>(dst, src, w, h, lookup, srcDelta, dstDelta);
+			}
+		} else {
+			return false;
+		}
+		return true;
+	}
+
 	if (dstFmt.bytesPerPixel == 2) {
 		if (srcFmt.bytesPerPixel == 2) {
 			crossBlitLogic<uint16, uint16, false>(dst, src, w, h, srcFmt, dstFmt, srcDelta, dstDelta);
@@ -167,4 +471,51 @@ bool crossBlit(byte *dst, const byte *src,
 	return true;
 }
 
+namespace {
+
+template<typename DstColor>
+inline void crossBlitMapLogic(byte *dst, const byte *src, const uint w, const uint h,
+                              const uint dstPitch, const uint srcPitch, const uint32 *map) {
+	for (uint y = 0; y < h; ++y) {
+		DstColor *d = (DstColor *)dst;
+		const byte *s = src;
+		uint x = 0;
+
+		// The lookups of four pixels do not depend on each other, so the
+		// loads can overlap.
+		for (; x + 4 <= w; x += 4) {
+			const DstColor c0 = map[s[0]];
+			const DstColor c1 = map[s[1]];
+			const DstColor c2 = map[s[2]];
+			const DstColor c3 = map[s[3]];
+			d[0] = c0;
+			d[1] = c1;
+			d[2] = c2;
+			d[3] = c3;
+			s += 4;
+			d += 4;
+		}
+
+		for (; x < w; ++x)
+			*d++ = map[*s++];
+
+		dst += dstPitch;
+		src += srcPitch;
+	}
+}
+
+} // End of anonymous namespace
+
+void crossBlitMap(byte *dst, const byte *src,
+                  const uint dstPitch, const uint srcPitch,
+                  const uint w, const uint h,
+                  const uint bytesPerPixel, const uint32 *map) {
+	assert(bytesPerPixel == 2 || bytesPerPixel == 4);
+
+	if (bytesPerPixel == 2)
+		crossBlitMapLogic<uint16>(dst, src, w, h, dstPitch, srcPitch, map);
+	else
+		crossBlitMapLogic<uint32>(dst, src, w, h, dstPitch, srcPitch, map);
+}
+
 } // End of namespace Graphics
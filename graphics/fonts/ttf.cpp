@@ -133,7 +133,7 @@ private:
 	int _ascent, _descent;
 
 	struct Glyph {
-		Surface image;
+		Surface image;	///< Area of an atlas page
 		int xOffset, yOffset;
 		int advance;
 		FT_UInt slot;
@@ -145,6 +145,25 @@ private:
 	bool _allowLateCaching;
 	void assureCached(uint32 chr) const;
 
+	/**
+	 * Glyph images are packed into a few large pages, row by row, instead
+	 * of allocating a surface for every glyph. This keeps the glyphs of a
+	 * string close together in memory.
+	 */
+	enum {
+		kAtlasPageSize = 256
+	};
+
+	mutable Common::Array<Surface *> _atlasPages;
+	mutable Surface *_atlasPage;	///< The page new glyphs are added to
+	mutable int _atlasX, _atlasY, _atlasRowHeight;
+	void allocateGlyphImage(Surface &image, int w, int h) const;
+	void freeAtlas();
+
+	/** Kerning offsets of glyph pairs, keyed by the two glyph indices. */
+	typedef Common::HashMap<uint32, int> KerningCache;
+	mutable KerningCache _kerning;
+
 	Common::SeekableReadStream *readTTFTable(FT_ULong tag) const;
 
 	int computePointSize(int size, TTFSizeMode sizeMode) const;
@@ -159,7 +178,7 @@ private:
 TTFFont::TTFFont()
     : _initialized(false), _face(), _ttfFile(0), _size(0), _width(0), _height(0), _ascent(0),
       _descent(0), _glyphs(), _loadFlags(FT_LOAD_TARGET_NORMAL), _renderMode(FT_RENDER_MODE_NORMAL),
-      _hasKerning(false), _allowLateCaching(false) {
+      _hasKerning(false), _allowLateCaching(false), _atlasPage(nullptr), _atlasX(0), _atlasY(0), _atlasRowHeight(0) {
 }
 
 TTFFont::~TTFFont() {
@@ -169,11 +188,10 @@ TTFFont::~TTFFont() {
 		delete[] _ttfFile;
 		_ttfFile = 0;
 
-		for (GlyphCache::iterator i = _glyphs.begin(), end = _glyphs.end(); i != end; ++i)
-			i->_value.image.free();
-
 		_initialized = false;
 	}
+
+	freeAtlas();
 }
 
 bool TTFFont::load(Common::SeekableReadStream &stream, int size, TTFSizeMode sizeMode, uint dpi, TTFRenderMode renderMode, const uint32 *mapping) {
@@ -440,9 +458,22 @@ int TTFFont::getKerningOffset(uint32 left, uint32 right) const {
 	if (!leftGlyph || !rightGlyph)
 		return 0;
 
+	// Glyph indices are 16 bit in TrueType fonts
+	const bool cacheable = leftGlyph <= 0xFFFF && rightGlyph <= 0xFFFF;
+	const uint32 key = (leftGlyph << 16) | rightGlyph;
+	if (cacheable) {
+		KerningCache::const_iterator kerningEntry = _kerning.find(key);
+		if (kerningEntry != _kerning.end())
+			return kerningEntry->_value;
+	}
+
 	FT_Vector kerningVector;
 	FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
-	return (kerningVector.x / 64);
+	const int offset = kerningVector.x / 64;
+
+	if (cacheable)
+		_kerning[key] = offset;
+	return offset;
 }
 
 Common::Rect TTFFont::getBoundingBox(uint32 chr) const {
@@ -594,7 +625,12 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	glyph.advance = ftCeil26_6(_face->glyph->advance.x);
 
 	const FT_Bitmap &bitmap = _face->glyph->bitmap;
-	glyph.image.create(bitmap.width, bitmap.rows, PixelFormat::createFormatCLUT8());
+	if (bitmap.pixel_mode != FT_PIXEL_MODE_MONO && bitmap.pixel_mode != FT_PIXEL_MODE_GRAY) {
+		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap.pixel_mode);
+		return false;
+	}
+
+	allocateGlyphImage(glyph.image, bitmap.width, bitmap.rows);
 
 	const uint8 *src = bitmap.buffer;
 	int srcPitch = bitmap.pitch;
@@ -603,11 +639,10 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 		srcPitch = -srcPitch;
 	}
 
+	// Atlas pages are cleared when they are allocated
 	uint8 *dst = (uint8 *)glyph.image.getPixels();
-	memset(dst, 0, glyph.image.h * glyph.image.pitch);
 
-	switch (bitmap.pixel_mode) {
-	case FT_PIXEL_MODE_MONO:
+	if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO) {
 		for (int y = 0; y < (int)bitmap.rows; ++y) {
 			const uint8 *curSrc = src;
 			uint8 mask = 0;
@@ -617,33 +652,74 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 					mask = *curSrc++;
 
 				if (mask & 0x80)
-					*dst = 255;
+					dst[x] = 255;
 
 				mask <<= 1;
-				++dst;
 			}
 
+			dst += glyph.image.pitch;
 			src += srcPitch;
 		}
-		break;
-
-	case FT_PIXEL_MODE_GRAY:
+	} else {
 		for (int y = 0; y < (int)bitmap.rows; ++y) {
 			memcpy(dst, src, bitmap.width);
 			dst += glyph.image.pitch;
 			src += srcPitch;
 		}
-		break;
-
-	default:
-		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap.pixel_mode);
-		glyph.image.free();
-		return false;
 	}
 
 	return true;
 }
 
+void TTFFont::allocateGlyphImage(Surface &image, int w, int h) const {
+	const PixelFormat format = PixelFormat::createFormatCLUT8();
+
+	if (w == 0 || h == 0) {
+		image.init(w, h, 0, nullptr, format);
+		return;
+	}
+
+	// Glyphs too large for a page get one of their own
+	if (w > kAtlasPageSize || h > kAtlasPageSize) {
+		Surface *page = new Surface();
+		page->create(w, h, format);
+		memset(page->getPixels(), 0, page->pitch * page->h);
+		_atlasPages.push_back(page);
+		image.init(w, h, page->pitch, page->getPixels(), format);
+		return;
+	}
+
+	// Start a new row, or a new page, when the glyph does not fit
+	if (_atlasX + w > kAtlasPageSize) {
+		_atlasX = 0;
+		_atlasY += _atlasRowHeight;
+		_atlasRowHeight = 0;
+	}
+
+	if (!_atlasPage || _atlasY + h > kAtlasPageSize) {
+		_atlasPage = new Surface();
+		_atlasPage->create(kAtlasPageSize, kAtlasPageSize, format);
+		memset(_atlasPage->getPixels(), 0, _atlasPage->pitch * _atlasPage->h);
+		_atlasPages.push_back(_atlasPage);
+		_atlasX = _atlasY = _atlasRowHeight = 0;
+	}
+
+	image.init(w, h, _atlasPage->pitch, _atlasPage->getBasePtr(_atlasX, _atlasY), format);
+	_atlasX += w;
+	_atlasRowHeight = MAX(_atlasRowHeight, h);
+}
+
+void TTFFont::freeAtlas() {
+	for (uint i = 0; i < _atlasPages.size(); ++i) {
+		_atlasPages[i]->free();
+		delete _atlasPages[i];
+	}
+
+	_atlasPages.clear();
+	_atlasPage = nullptr;
+	_atlasX = _atlasY = _atlasRowHeight = 0;
+}
+
 void TTFFont::assureCached(uint32 chr) const {
 	if (!chr || !_allowLateCaching || _glyphs.contains(chr)) {
 		return;
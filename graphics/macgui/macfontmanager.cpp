@@ -196,6 +196,9 @@ void MacFontManager::loadFonts(const Common::String &fileName) {
 }
 
 void MacFontManager::loadFonts(Common::MacResManager *fontFile) {
+	// Lookups may find better fonts now
+	_fontCache.clear();
+
 	Common::MacResIDArray fonds = fontFile->getResIDArray(MKTAG('F','O','N','D'));
 	if (fonds.size() > 0) {
 		for (Common::Array<uint16>::iterator iterator = fonds.begin(); iterator != fonds.end(); ++iterator) {
@@ -251,6 +254,20 @@ void MacFontManager::loadFonts(Common::MacResManager *fontFile) {
 const Font *MacFontManager::getFont(MacFont macFont) {
 	const Font *font = 0;
 
+	// Fonts requested by name are not cached
+	const bool cached = macFont.getName().empty();
+	FontCacheKey key;
+	key.id = macFont.getId();
+	key.size = macFont.getSize();
+	key.slant = macFont.getSlant();
+	key.fallback = macFont.getFallback();
+
+	if (cached) {
+		Common::HashMap<FontCacheKey, const Font *, FontCacheKey_Hash>::const_iterator i = _fontCache.find(key);
+		if (i != _fontCache.end())
+			return i->_value;
+	}
+
 	if (!_builtInFonts) {
 		if (macFont.getName().empty())
 			macFont.setName(getFontName(macFont.getId(), macFont.getSize(), macFont.getSlant()));
@@ -276,6 +293,9 @@ const Font *MacFontManager::getFont(MacFont macFont) {
 	if (_builtInFonts || !font)
 		font = FontMan.getFontByUsage(macFont.getFallback());
 
+	if (cached)
+		_fontCache[key] = font;
+
 	return font;
 }
 
@@ -296,11 +316,13 @@ int MacFontManager::parseFontSlant(Common::String slant) {
 void MacFontManager::registerFontMapping(uint16 id, Common::String name) {
 	_extraFontNames[id] = name;
 	_extraFontIds[name] = id;
+	_fontCache.clear();
 }
 
 void MacFontManager::clearFontMapping() {
 	_extraFontNames.clear();
 	_extraFontIds.clear();
+	_fontCache.clear();
 }
 
 const char *MacFontManager::getFontName(int id, int size, int slant, bool tryGen) {
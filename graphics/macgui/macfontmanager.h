@@ -151,6 +151,28 @@ private:
 	Common::HashMap<Common::String, int> _extraFontIds;
 
 	int parseFontSlant(Common::String slant);
+
+	/**
+	 * Fonts already looked up by getFont(), including generated sizes
+	 * and fallbacks, so that redrawing text does not need to build the
+	 * font name or search for a substitute again.
+	 */
+	struct FontCacheKey {
+		int id, size, slant;
+		FontManager::FontUsage fallback;
+
+		bool operator==(const FontCacheKey &key) const {
+			return id == key.id && size == key.size && slant == key.slant && fallback == key.fallback;
+		}
+	};
+
+	struct FontCacheKey_Hash {
+		uint operator()(const FontCacheKey &key) const {
+			return ((key.id * 31 + key.size) * 31 + key.slant) * 31 + key.fallback;
+		}
+	};
+
+	Common::HashMap<FontCacheKey, const Font *, FontCacheKey_Hash> _fontCache;
 };
 
 } // End of namespace Graphics
@@ -383,11 +383,34 @@ bool MacMenu::draw(ManagedSurface *g, bool forceRedraw) {
 
 	g->transBlitFrom(_screen, kColorGreen);
 
-	g_system->copyRectToScreen(g->getPixels(), g->pitch, 0, 0, g->w, g->h);
+	// The rest of the screen is up to date, see MacWindowManager::draw()
+	Common::Rect area(_bbox);
+	if (_activeItem != -1)
+		area.extend(getSubmenuArea(_items[_activeItem]));
+	area.clip(Common::Rect(g->w, g->h));
+
+	g_system->copyRectToScreen(g->getBasePtr(area.left, area.top), g->pitch, area.left, area.top, area.width(), area.height());
 
 	return true;
 }
 
+void MacMenu::blit(ManagedSurface *g, const Common::Rect &area) {
+	Common::Rect r(area);
+	r.clip(Common::Rect(_screen.w, _screen.h));
+
+	if (!r.isEmpty())
+		g->transBlitFrom(_screen, r, Common::Point(r.left, r.top), kColorGreen);
+}
+
+Common::Rect MacMenu::getSubmenuArea(MacMenuItem *menu) {
+	// Includes the shadow
+	Common::Rect r(menu->subbbox);
+	r.right += 3;
+	r.bottom += 3;
+
+	return r;
+}
+
 void MacMenu::renderSubmenu(MacMenuItem *menu) {
 	Common::Rect *r = &menu->subbbox;
 
@@ -500,13 +523,8 @@ bool MacMenu::mouseClick(int x, int y) {
 			  if ((uint)_activeItem == i)
 					return false;
 
-				if (_activeItem != -1) { // Restore background
-					Common::Rect r(_items[_activeItem]->subbbox);
-					r.right += 3;
-					r.bottom += 3;
-
-					_wm->setFullRefresh(true);
-				}
+				if (_activeItem != -1) // Restore background
+					_wm->addDirtyRect(getSubmenuArea(_items[_activeItem]));
 
 				_activeItem = i;
 				_activeSubItem = -1;
@@ -552,10 +570,13 @@ bool MacMenu::mouseRelease(int x, int y) {
 			(*_ccallback)(_items[_activeItem]->subitems[_activeSubItem]->action,
 					_items[_activeItem]->subitems[_activeSubItem]->text, _cdata);
 
+		if (_activeItem != -1) // Restore background
+			_wm->addDirtyRect(getSubmenuArea(_items[_activeItem]));
+
 		_activeItem = -1;
 		_activeSubItem = -1;
 
-		_wm->setFullRefresh(true);
+		_contentIsDirty = true;
 
 		return true;
 	}
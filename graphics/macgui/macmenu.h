@@ -56,6 +56,7 @@ public:
 	void clearSubMenu(int id);
 
 	bool draw(ManagedSurface *g, bool forceRedraw = false);
+	void blit(ManagedSurface *g, const Common::Rect &area);
 	bool processEvent(Common::Event &event);
 
 	void enableCommand(int menunum, int action, bool state);
@@ -77,6 +78,7 @@ private:
 	int calculateMenuWidth(MacMenuItem *menu);
 	void calcMenuBounds(MacMenuItem *menu);
 	void renderSubmenu(MacMenuItem *menu);
+	Common::Rect getSubmenuArea(MacMenuItem *menu);
 
 	bool keyEvent(Common::Event &event);
 	bool mouseClick(int x, int y);
@@ -85,6 +85,8 @@ void MacWindow::resize(int w, int h) {
 	if (_surface.w == w && _surface.h == h)
 		return;
 
+	markDirtyArea();
+
 	_surface.free();
 	_surface.create(w, h, PixelFormat::createFormatCLUT8());
 
@@ -109,6 +111,7 @@ void MacWindow::move(int x, int y) {
 	if (_dims.left == x && _dims.top == y)
 		return;
 
+	markDirtyArea();
 	_dims.moveTo(x, y);
 	updateInnerDims();
 
@@ -116,6 +119,7 @@ void MacWindow::move(int x, int y) {
 }
 
 void MacWindow::setDimensions(const Common::Rect &r) {
+	markDirtyArea();
 	resize(r.width(), r.height());
 	_dims.moveTo(r.left, r.top);
 	updateInnerDims();
@@ -148,6 +152,18 @@ bool MacWindow::draw(ManagedSurface *g, bool forceRedraw) {
 	return true;
 }
 
+void MacWindow::blit(ManagedSurface *g, const Common::Rect &area) {
+	Common::Rect r(_composeSurface.getBounds());
+	r.translate(_dims.left - 2, _dims.top - 2);
+	r.clip(area);
+
+	if (r.isEmpty())
+		return;
+
+	g->transBlitFrom(_composeSurface, Common::Rect(r.left - _dims.left + 2, r.top - _dims.top + 2, r.right - _dims.left + 2, r.bottom - _dims.top + 2),
+			Common::Point(r.left, r.top), kColorGreen2);
+}
+
 
 #define ARROW_W 12
 #define ARROW_H 6
@@ -169,6 +185,14 @@ static void drawPixelInverted(int x, int y, int color, void *data) {
 	}
 }
 
+void MacWindow::markDirtyArea() {
+	// The window is drawn with its border overlap, see draw()
+	Common::Rect area(_dims);
+	area.translate(-2, -2);
+
+	_wm->addDirtyRect(area);
+}
+
 void MacWindow::updateInnerDims() {
 	if (_macBorder.hasBorder(_active) && _macBorder.hasOffsets()) {
 		_innerDims = Common::Rect(
@@ -442,13 +466,15 @@ bool MacWindow::processEvent(Common::Event &event) {
 	switch (event.type) {
 	case Common::EVENT_MOUSEMOVE:
 		if (_beingDragged) {
+			markDirtyArea();
 			_dims.translate(event.mouse.x - _draggedX, event.mouse.y - _draggedY);
 			updateInnerDims();
 
 			_draggedX = event.mouse.x;
 			_draggedY = event.mouse.y;
 
-			_wm->setFullRefresh(true);
+			// The window is copied to its new place as it was drawn last
+			markDirtyArea();
 		}
 
 		if (_beingResized) {
@@ -458,8 +484,6 @@ bool MacWindow::processEvent(Common::Event &event) {
 			_draggedX = event.mouse.x;
 			_draggedY = event.mouse.y;
 
-			_wm->setFullRefresh(true);
-
 			if (_callback)
 				(*_callback)(click, event, _dataPtr);
 		}
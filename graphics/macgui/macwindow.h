@@ -130,6 +130,14 @@ public:
 	 */
 	virtual bool draw(ManagedSurface *g, bool forceRedraw = false) = 0;
 
+	/**
+	 * Method called by the WM to copy the part of the window that lies
+	 * inside an area of the target surface again, as it was last drawn.
+	 * @param g Surface on which to draw the window.
+	 * @param area Area of the target surface to draw.
+	 */
+	virtual void blit(ManagedSurface *g, const Common::Rect &area) = 0;
+
 	/**
 	 * Method called by the WM when there is an event concerning the window.
 	 * Note that depending on the subclass of the window, it might not be called
@@ -229,6 +237,7 @@ public:
 	 * @param forceRedraw If true, the borders are guarranteed to redraw.
 	 */
 	virtual bool draw(ManagedSurface *g, bool forceRedraw = false);
+	virtual void blit(ManagedSurface *g, const Common::Rect &area);
 
 	/**
 	 * Mutator to change the active state of the window.
@@ -294,6 +303,7 @@ private:
 	void fillRect(ManagedSurface *g, int x, int y, int w, int h, int color);
 	const Font *getTitleFont();
 	void updateInnerDims();
+	void markDirtyArea();
 
 	bool isInCloseButton(int x, int y);
 	bool isInResizeButton(int x, int y);
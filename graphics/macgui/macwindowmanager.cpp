@@ -264,14 +264,44 @@ void macDrawPixel(int x, int y, int color, void *data) {
 	}
 }
 
-void MacWindowManager::drawDesktop() {
-	Common::Rect r(_screen->getBounds());
+void MacWindowManager::addDirtyRect(const Common::Rect &r) {
+	if (!_screen || _fullRefresh)
+		return;
+
+	Common::Rect area(r);
+	area.clip(_screen->getBounds());
+
+	if (area.isEmpty())
+		return;
+
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		if (_dirtyRects[i].intersects(area)) {
+			_dirtyRects[i].extend(area);
+			return;
+		}
+	}
+
+	if (_dirtyRects.size() >= kMaxDirtyRects) {
+		_dirtyRects.clear();
+		_fullRefresh = true;
+		return;
+	}
+
+	_dirtyRects.push_back(area);
+}
+
+void MacWindowManager::drawDesktop(const Common::Rect &r) {
+	if (_desktop.w != _screen->w || _desktop.h != _screen->h) {
+		_desktop.free();
+		_desktop.create(_screen->w, _screen->h, _screen->format);
 
-	MacPlotData pd(_screen, &_patterns, kPatternCheckers, 1);
+		Common::Rect bounds(_desktop.getBounds());
+		MacPlotData pd(&_desktop, &_patterns, kPatternCheckers, 1);
 
-	Graphics::drawRoundRect(r, kDesktopArc, kColorBlack, true, macDrawPixel, &pd);
+		Graphics::drawRoundRect(bounds, kDesktopArc, kColorBlack, true, macDrawPixel, &pd);
+	}
 
-	g_system->copyRectToScreen(_screen->getPixels(), _screen->pitch, 0, 0, _screen->w, _screen->h);
+	_screen->blitFrom(_desktop, r, Common::Point(r.left, r.top));
 }
 
 void MacWindowManager::draw() {
@@ -279,27 +309,54 @@ void MacWindowManager::draw() {
 
 	removeMarked();
 
-	if (_fullRefresh)
-		drawDesktop();
+	if (_fullRefresh) {
+		_dirtyRects.clear();
+		drawDesktop(_screen->getBounds());
+	} else {
+		for (uint i = 0; i < _dirtyRects.size(); i++)
+			drawDesktop(_dirtyRects[i]);
+	}
 
+	// Windows which draw themselves are marked dirty, so that the windows
+	// above them get copied over them again
 	for (Common::List<BaseMacWindow *>::const_iterator it = _windowStack.begin(); it != _windowStack.end(); it++) {
 		BaseMacWindow *w = *it;
+		Common::Rect area(w->getDimensions());
+		area.translate(-2, -2);
+
 		if (w->draw(_screen, _fullRefresh)) {
 			w->setDirty(false);
 
-			Common::Rect clip(w->getDimensions().left - 2, w->getDimensions().top - 2, w->getDimensions().right - 2, w->getDimensions().bottom - 2);
-			clip.clip(_screen->getBounds());
-			clip.clip(Common::Rect(0, 0, g_system->getWidth() - 1, g_system->getHeight() - 1));
+			addDirtyRect(area);
+		} else {
+			for (uint i = 0; i < _dirtyRects.size(); i++)
+				if (_dirtyRects[i].intersects(area))
+					w->blit(_screen, _dirtyRects[i]);
+		}
+	}
+
+	// Menu is drawn on top of everything and always
+	if (_menu && !_menu->draw(_screen, _fullRefresh)) {
+		for (uint i = 0; i < _dirtyRects.size(); i++)
+			_menu->blit(_screen, _dirtyRects[i]);
+	}
+
+	Common::Rect screen(0, 0, g_system->getWidth(), g_system->getHeight());
+
+	if (_fullRefresh) {
+		screen.clip(_screen->getBounds());
+		g_system->copyRectToScreen(_screen->getBasePtr(screen.left, screen.top), _screen->pitch, screen.left, screen.top, screen.width(), screen.height());
+	} else {
+		for (uint i = 0; i < _dirtyRects.size(); i++) {
+			Common::Rect clip(_dirtyRects[i]);
+			clip.clip(screen);
 
 			if (!clip.isEmpty())
 				g_system->copyRectToScreen(_screen->getBasePtr(clip.left, clip.top), _screen->pitch, clip.left, clip.top, clip.width(), clip.height());
 		}
 	}
 
-	// Menu is drawn on top of everything and always
-	if (_menu)
-		_menu->draw(_screen, _fullRefresh);
-
+	_dirtyRects.clear();
 	_fullRefresh = false;
 }
 
@@ -150,6 +150,14 @@ public:
 	 */
 	void setFullRefresh(bool redraw) { _fullRefresh = true; }
 
+	/**
+	 * Mark an area of the desktop for redraw, e.g. one that a window
+	 * was moved away from. Only the windows overlapping the marked
+	 * areas are composed again by the next draw().
+	 * @param r Area of the screen to be redrawn.
+	 */
+	void addDirtyRect(const Common::Rect &r);
+
 	/**
 	 * Method to draw the desktop into the screen,
 	 * It will take into accout the contents set as dirty.
@@ -191,7 +199,7 @@ public:
 	MacFontManager *_fontMan;
 
 private:
-	void drawDesktop();
+	void drawDesktop(const Common::Rect &r);
 
 	void removeMarked();
 	void removeFromStack(BaseMacWindow *target);
@@ -211,6 +219,12 @@ private:
 
 	bool _fullRefresh;
 
+	enum { kMaxDirtyRects = 16 };
+	Common::Array<Common::Rect> _dirtyRects;
+
+	// The desktop pattern is only drawn once, and copied from here
+	ManagedSurface _desktop;
+
 	MacPatterns _patterns;
 
 	MacMenu *_menu;
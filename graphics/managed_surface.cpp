@@ -21,6 +21,7 @@
  */
 
 #include "graphics/managed_surface.h"
+#include "graphics/rle_surface.h"
 #include "common/algorithm.h"
 #include "common/textconsole.h"
 
@@ -115,6 +116,13 @@ void ManagedSurface::create(ManagedSurface &surf, const Common::Rect &bounds) {
 	_disposeAfterUse = DisposeAfterUse::NO;
 }
 
+void ManagedSurface::wrapSurface(const Surface &surf) {
+	free();
+
+	_innerSurface = surf;
+	markAllDirty();
+}
+
 void ManagedSurface::free() {
 	if (_disposeAfterUse == DisposeAfterUse::YES)
 		_innerSurface.free();
@@ -321,6 +329,15 @@ void ManagedSurface::transBlitFrom(const Surface &src, const Common::Rect &srcRe
 
 #undef HANDLE_BLIT
 
+void ManagedSurface::transBlitFrom(const RLESurface &src, const Common::Point &destPos,
+		bool flipped, const byte *remap) {
+	const Common::Rect drawn = src.blitTo(_innerSurface, destPos, flipped, nullptr, remap);
+
+	// Mark the affected area
+	if (!drawn.isEmpty())
+		addDirtyRect(drawn);
+}
+
 void ManagedSurface::markAllDirty() {
 	addDirtyRect(Common::Rect(0, 0, this->w, this->h));
 }
@@ -31,6 +31,7 @@
 namespace Graphics {
 
 class Font;
+class RLESurface;
 
 /**
  * A derived graphics surface, which handles automatically managing the allocated
@@ -67,6 +68,12 @@ protected:
 	 */
 	bool clip(Common::Rect &srcBounds, Common::Rect &destBounds);
 
+	/**
+	 * Sets up the surface to use the pixels of a plain surface, including its
+	 * pitch. This surface will not own the pixels.
+	 */
+	void wrapSurface(const Surface &surf);
+
 	/**
 	 * Base method that descendent classes can override for recording affected
 	 * dirty areas of the surface
@@ -277,6 +284,19 @@ public:
 	void transBlitFrom(const Surface &src, const Common::Rect &srcRect, const Common::Rect &destRect,
 		uint transColor = 0, bool flipped = false, uint overrideColor = 0);
 
+	/**
+	 * Draws a run-length encoded sprite onto the surface. Only the opaque runs are
+	 * visited, so this is faster than drawing an uncompressed sprite with a
+	 * transparent color.
+	 * @param src			Source sprite, with the same bytes per pixel as this surface
+	 * @param destPos		Destination position to draw the sprite
+	 * @param flipped		Specifies whether to horizontally flip the image
+	 * @param remap			Optional table mapping the colors of 8-bit sprites to the
+	 *						ones to draw instead
+	 */
+	void transBlitFrom(const RLESurface &src, const Common::Point &destPos,
+		bool flipped = false, const byte *remap = nullptr);
+
 	/**
 	 * Clear the entire surface
 	 */
@@ -24,11 +24,14 @@ MODULE_OBJS := \
 	nine_patch.o \
 	pixelformat.o \
 	primitives.o \
+	rle_surface.o \
 	scaler.o \
 	scaler/thumbnail_intern.o \
 	screen.o \
 	sjis.o \
 	surface.o \
+	text_cache.o \
+	transform_cache.o \
 	transform_struct.o \
 	transform_tools.o \
 	transparent_surface.o \
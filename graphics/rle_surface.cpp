@@ -0,0 +1,207 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "graphics/rle_surface.h"
+#include "graphics/surface.h"
+#include "common/textconsole.h"
+
+namespace Graphics {
+
+namespace {
+
+struct RunHeader {
+	uint16 skip;
+	uint16 length;
+};
+
+template<typename PixelType>
+void compressRow(const PixelType *src, uint w, PixelType transColor, Common::Array<byte> &data) {
+	uint x = 0;
+	while (x < w) {
+		RunHeader run;
+		const uint start = x;
+		while (x < w && src[x] == transColor)
+			x++;
+		run.skip = x - start;
+		if (x == w)
+			break;
+
+		const uint opaque = x;
+		while (x < w && src[x] != transColor)
+			x++;
+		run.length = x - opaque;
+
+		const uint pos = data.size();
+		data.resize(pos + sizeof(RunHeader) + run.length * sizeof(PixelType));
+		memcpy(&data[pos], &run, sizeof(RunHeader));
+		memcpy(&data[pos + sizeof(RunHeader)], src + opaque, run.length * sizeof(PixelType));
+	}
+}
+
+template<typename PixelType>
+void blitRow(const byte *runs, const byte *runsEnd, PixelType *dst, int left, int right, bool flipped, const byte *remap) {
+	int x = 0;
+	while (runs < runsEnd && x < right) {
+		RunHeader run;
+		memcpy(&run, runs, sizeof(RunHeader));
+		const PixelType *pixels = (const PixelType *)(runs + sizeof(RunHeader));
+		runs += sizeof(RunHeader) + run.length * sizeof(PixelType);
+
+		x += run.skip;
+		const int start = MAX(x, left);
+		const int end = MIN(x + run.length, right);
+		if (start < end) {
+			const PixelType *src = pixels + (start - x);
+			const int count = end - start;
+
+			if (flipped) {
+				PixelType *d = dst - start;
+				for (int i = 0; i < count; i++)
+					d[-i] = remap ? remap[src[i]] : src[i];
+			} else if (remap) {
+				PixelType *d = dst + start;
+				for (int i = 0; i < count; i++)
+					d[i] = remap[src[i]];
+			} else {
+				memcpy(dst + start, src, count * sizeof(PixelType));
+			}
+		}
+		x += run.length;
+	}
+}
+
+} // End of anonymous namespace
+
+RLESurface::RLESurface() : w(0), h(0), _transColor(0) {
+}
+
+RLESurface::RLESurface(const Surface &src, uint32 transColor) : w(0), h(0), _transColor(0) {
+	create(src, transColor);
+}
+
+void RLESurface::create(const Surface &src, uint32 transColor) {
+	free();
+
+	w = src.w;
+	h = src.h;
+	format = src.format;
+	_transColor = transColor;
+	_rowOffsets.resize(h + 1);
+
+	for (uint y = 0; y < h; y++) {
+		_rowOffsets[y] = _data.size();
+		switch (format.bytesPerPixel) {
+		case 1:
+			compressRow<byte>((const byte *)src.getBasePtr(0, y), w, transColor, _data);
+			break;
+		case 2:
+			compressRow<uint16>((const uint16 *)src.getBasePtr(0, y), w, transColor, _data);
+			break;
+		case 4:
+			compressRow<uint32>((const uint32 *)src.getBasePtr(0, y), w, transColor, _data);
+			break;
+		default:
+			error("RLESurface::create: bytesPerPixel must be 1, 2, or 4");
+		}
+	}
+	_rowOffsets[h] = _data.size();
+}
+
+void RLESurface::free() {
+	w = h = 0;
+	_data.clear();
+	_rowOffsets.clear();
+}
+
+void RLESurface::decompress(Surface &dest) const {
+	assert(dest.w == w && dest.h == h && dest.format.bytesPerPixel == format.bytesPerPixel);
+
+	for (uint y = 0; y < h; y++) {
+		byte *row = (byte *)dest.getBasePtr(0, y);
+		for (uint x = 0; x < w; x++) {
+			switch (format.bytesPerPixel) {
+			case 1:
+				row[x] = _transColor;
+				break;
+			case 2:
+				((uint16 *)row)[x] = _transColor;
+				break;
+			default:
+				((uint32 *)row)[x] = _transColor;
+				break;
+			}
+		}
+	}
+
+	blitTo(dest, Common::Point(0, 0));
+}
+
+Common::Rect RLESurface::blitTo(Surface &dest, const Common::Point &destPos, bool flipped,
+		const Common::Rect *clipRect, const byte *remap) const {
+	assert(dest.format.bytesPerPixel == format.bytesPerPixel);
+	assert(!remap || format.bytesPerPixel == 1);
+
+	Common::Rect clip(dest.w, dest.h);
+	if (clipRect)
+		clip.clip(*clipRect);
+
+	Common::Rect drawn(destPos.x, destPos.y, destPos.x + w, destPos.y + h);
+	drawn.clip(clip);
+	if (drawn.isEmpty())
+		return Common::Rect();
+
+	// The visible part of the sprite's rows, in sprite coordinates
+	int left, right;
+	if (flipped) {
+		left = destPos.x + w - drawn.right;
+		right = destPos.x + w - drawn.left;
+	} else {
+		left = drawn.left - destPos.x;
+		right = drawn.right - destPos.x;
+	}
+
+	// Rows are passed the destination of sprite column 0, which lies
+	// on the right side for flipped sprites
+	const int column = flipped ? destPos.x + w - 1 : destPos.x;
+
+	for (int y = drawn.top; y < drawn.bottom; y++) {
+		const int row = y - destPos.y;
+		const byte *runs = _data.begin() + _rowOffsets[row];
+		const byte *runsEnd = _data.begin() + _rowOffsets[row + 1];
+
+		switch (format.bytesPerPixel) {
+		case 1:
+			blitRow<byte>(runs, runsEnd, (byte *)dest.getBasePtr(0, y) + column, left, right, flipped, remap);
+			break;
+		case 2:
+			blitRow<uint16>(runs, runsEnd, (uint16 *)dest.getBasePtr(0, y) + column, left, right, flipped, nullptr);
+			break;
+		default:
+			blitRow<uint32>(runs, runsEnd, (uint32 *)dest.getBasePtr(0, y) + column, left, right, flipped, nullptr);
+			break;
+		}
+	}
+
+	return drawn;
+}
+
+} // End of namespace Graphics
@@ -0,0 +1,102 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GRAPHICS_RLE_SURFACE_H
+#define GRAPHICS_RLE_SURFACE_H
+
+#include "common/array.h"
+#include "common/rect.h"
+#include "graphics/pixelformat.h"
+
+namespace Graphics {
+
+struct Surface;
+
+/**
+ * A sprite with a transparent color key, stored as runs of transparent and
+ * opaque pixels.
+ *
+ * Only the opaque pixels are stored, which saves memory for sprites with
+ * large transparent areas, e.g. animation frames. Blitting skips the
+ * transparent runs entirely and copies the opaque ones with memcpy, instead
+ * of comparing every pixel against the color key.
+ *
+ * Every row is stored as a sequence of runs, each made up of the number of
+ * transparent pixels to skip, the number of opaque pixels following them
+ * and those opaque pixels.
+ */
+class RLESurface {
+public:
+	RLESurface();
+	RLESurface(const Surface &src, uint32 transColor);
+
+	/**
+	 * Compress a surface. Surfaces with 1, 2 and 4 bytes per pixel are
+	 * supported.
+	 *
+	 * @param src			the surface to compress
+	 * @param transColor	the color of the transparent pixels
+	 */
+	void create(const Surface &src, uint32 transColor);
+
+	/** Release the compressed data. */
+	void free();
+
+	uint16 w;
+	uint16 h;
+	PixelFormat format;
+
+	uint32 getTransparentColor() const { return _transColor; }
+
+	/** Return the size of the compressed pixel data in bytes. */
+	uint32 getDataSize() const { return _data.size(); }
+
+	/**
+	 * Decompress into a surface of the same size and format, filling the
+	 * transparent pixels with the transparent color.
+	 */
+	void decompress(Surface &dest) const;
+
+	/**
+	 * Draw the opaque pixels onto a surface of the same bytes per pixel.
+	 *
+	 * @param dest		the surface to draw onto
+	 * @param destPos	position of the top left corner of the sprite
+	 * @param flipped	whether to mirror the sprite horizontally
+	 * @param clipRect	area of dest to limit drawing to, or nullptr to
+	 *					limit it to the whole surface
+	 * @param remap		for 1 byte per pixel sprites, an optional table
+	 *					mapping every color to the one to draw instead
+	 * @return the area of dest which was drawn onto, which may be empty
+	 */
+	Common::Rect blitTo(Surface &dest, const Common::Point &destPos, bool flipped = false,
+	                    const Common::Rect *clipRect = nullptr, const byte *remap = nullptr) const;
+
+private:
+	uint32 _transColor;
+	Common::Array<byte> _data;
+	Common::Array<uint32> _rowOffsets;	///< Start of every row in _data, plus the end of the data.
+};
+
+} // End of namespace Graphics
+
+#endif
@@ -22,6 +22,7 @@
 
 #include "graphics/scaler/intern.h"
 #include "graphics/scaler/scalebit.h"
+#include "common/jobs.h"
 #include "common/util.h"
 #include "common/system.h"
 #include "common/textconsole.h"
@@ -160,6 +161,63 @@ void DestroyScalers() {
 }
 
 
+namespace {
+
+/**
+ * A scaler call split into a number of horizontal bands of about the same
+ * height, which are scaled in parallel by the job system.
+ */
+struct ScalerBands {
+	ScalerProc *proc;
+	int factor;
+	const uint8 *srcPtr;
+	uint32 srcPitch;
+	uint8 *dstPtr;
+	uint32 dstPitch;
+	int width, height;
+	int count;
+};
+
+// Bands are kept large enough for the job overhead not to matter
+const int kScalerMinBandPixels = 16384;
+
+void scaleBands(void *param, uint begin, uint end) {
+	const ScalerBands &bands = *(const ScalerBands *)param;
+
+	for (uint i = begin; i < end; ++i) {
+		const int top = bands.height * i / bands.count;
+		const int bottom = bands.height * (i + 1) / bands.count;
+
+		bands.proc(bands.srcPtr + top * bands.srcPitch, bands.srcPitch,
+		           bands.dstPtr + top * bands.factor * bands.dstPitch, bands.dstPitch,
+		           bands.width, bottom - top);
+	}
+}
+
+} // End of anonymous namespace
+
+void scaleInBands(ScalerProc *proc, int factor, const uint8 *srcPtr, uint32 srcPitch,
+                  uint8 *dstPtr, uint32 dstPitch, int width, int height) {
+	const int count = MIN(width * height / kScalerMinBandPixels, height / 2);
+	if (count <= 1) {
+		proc(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
+		return;
+	}
+
+	ScalerBands bands;
+	bands.proc = proc;
+	bands.factor = factor;
+	bands.srcPtr = srcPtr;
+	bands.srcPitch = srcPitch;
+	bands.dstPtr = dstPtr;
+	bands.dstPitch = dstPitch;
+	bands.width = width;
+	bands.height = height;
+	bands.count = count;
+
+	Common::JobSystem::instance().parallelFor(0, count, 1, scaleBands, &bands);
+}
+
 /**
  * Trivial 'scaler' - in fact it doesn't do any scaling but just copies the
  * source to the destination.
@@ -303,20 +361,30 @@ void Normal1o5x(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstP
  * The Scale2x filter, also known as AdvMame2x.
  * See also http://scale2x.sourceforge.net
  */
-void AdvMame2x(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
+static void AdvMame2xBand(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
 							 int width, int height) {
 	scale(2, dstPtr, dstPitch, srcPtr - srcPitch, srcPitch, 2, width, height);
 }
 
+void AdvMame2x(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
+							 int width, int height) {
+	scaleInBands(AdvMame2xBand, 2, srcPtr, srcPitch, dstPtr, dstPitch, width, height);
+}
+
 /**
  * The Scale3x filter, also known as AdvMame3x.
  * See also http://scale2x.sourceforge.net
  */
-void AdvMame3x(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
+static void AdvMame3xBand(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
 							 int width, int height) {
 	scale(3, dstPtr, dstPitch, srcPtr - srcPitch, srcPitch, 2, width, height);
 }
 
+void AdvMame3x(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
+							 int width, int height) {
+	scaleInBands(AdvMame3xBand, 3, srcPtr, srcPitch, dstPtr, dstPitch, width, height);
+}
+
 template<typename ColorMask>
 void TV2xTemplate(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
 					int width, int height) {
@@ -97,7 +97,7 @@ void HQ3x(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
 #define PIXEL22_C   *(q+2+nextlineDst2) = w5;
 
 extern "C" uint32   *RGBtoYUV;
-#define YUV(x)	RGBtoYUV[w ## x]
+#define YUV(x)	yuv ## x
 
 /*
  * The HQ3x high quality 3x graphics filter.
@@ -107,6 +107,7 @@ extern "C" uint32   *RGBtoYUV;
 template<typename ColorMask>
 static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height) {
 	int  w1, w2, w3, w4, w5, w6, w7, w8, w9;
+	uint32 yuv1, yuv2, yuv3, yuv4, yuv5, yuv6, yuv7, yuv8, yuv9;
 
 	const uint32 nextlineSrc = srcPitch / sizeof(uint16);
 	const uint16 *p = (const uint16 *)srcPtr;
@@ -135,6 +136,14 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 		w5 = *(p);
 		w8 = *(p + nextlineSrc);
 
+		yuv1 = RGBtoYUV[w1];
+		yuv4 = RGBtoYUV[w4];
+		yuv7 = RGBtoYUV[w7];
+
+		yuv2 = RGBtoYUV[w2];
+		yuv5 = RGBtoYUV[w5];
+		yuv8 = RGBtoYUV[w8];
+
 		int tmpWidth = width;
 		while (tmpWidth--) {
 			p++;
@@ -143,16 +152,11 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			w6 = *(p);
 			w9 = *(p + nextlineSrc);
 
-			int pattern = 0;
-			const int yuv5 = YUV(5);
-			if (w5 != w1 && diffYUV(yuv5, YUV(1))) pattern |= 0x0001;
-			if (w5 != w2 && diffYUV(yuv5, YUV(2))) pattern |= 0x0002;
-			if (w5 != w3 && diffYUV(yuv5, YUV(3))) pattern |= 0x0004;
-			if (w5 != w4 && diffYUV(yuv5, YUV(4))) pattern |= 0x0008;
-			if (w5 != w6 && diffYUV(yuv5, YUV(6))) pattern |= 0x0010;
-			if (w5 != w7 && diffYUV(yuv5, YUV(7))) pattern |= 0x0020;
-			if (w5 != w8 && diffYUV(yuv5, YUV(8))) pattern |= 0x0040;
-			if (w5 != w9 && diffYUV(yuv5, YUV(9))) pattern |= 0x0080;
+			yuv3 = RGBtoYUV[w3];
+			yuv6 = RGBtoYUV[w6];
+			yuv9 = RGBtoYUV[w9];
+
+			const int pattern = diffYUVPattern(yuv5, yuv1, yuv2, yuv3, yuv4, yuv6, yuv7, yuv8, yuv9);
 
 			switch (pattern) {
 			case 0:
@@ -2927,6 +2931,14 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			w5 = w6;
 			w8 = w9;
 
+			yuv1 = yuv2;
+			yuv4 = yuv5;
+			yuv7 = yuv8;
+
+			yuv2 = yuv3;
+			yuv5 = yuv6;
+			yuv8 = yuv9;
+
 			q += 3;
 		}
 		p += nextlineSrc - width;
@@ -2937,9 +2949,9 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 void HQ3x(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height) {
 	extern int gBitFormat;
 	if (gBitFormat == 565)
-		HQ3x_implementation<Graphics::ColorMasks<565> >(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
+		scaleInBands(HQ3x_implementation<Graphics::ColorMasks<565> >, 3, srcPtr, srcPitch, dstPtr, dstPitch, width, height);
 	else
-		HQ3x_implementation<Graphics::ColorMasks<555> >(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
+		scaleInBands(HQ3x_implementation<Graphics::ColorMasks<555> >, 3, srcPtr, srcPitch, dstPtr, dstPitch, width, height);
 }
 
 #endif // Assembly version
@@ -25,6 +25,17 @@
 
 #include "common/scummsys.h"
 #include "graphics/colormasks.h"
+#include "graphics/scaler.h"
+
+// Where SSE2 or NEON are available, the hq scalers compare a pixel with all
+// eight of its neighbours at once. The results are identical to diffYUV.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCALER_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SCALER_USE_NEON
+#include <arm_neon.h>
+#endif
 
 
 /**
@@ -218,4 +229,68 @@ static inline bool diffYUV(int yuv1, int yuv2) {
 */
 }
 
+/**
+ * Compare a YUV value with those of its eight neighbours using diffYUV,
+ * and return the hq pattern: bit 0 to 7 are set if the neighbours 1 to 4
+ * and 6 to 9 resp. differ from the centre value 5.
+ */
+static inline int diffYUVPattern(uint32 yuv5, uint32 yuv1, uint32 yuv2, uint32 yuv3, uint32 yuv4,
+                                 uint32 yuv6, uint32 yuv7, uint32 yuv8, uint32 yuv9) {
+#if defined(SCALER_USE_SSE2)
+	// Y, U and V are compared as unsigned bytes: a channel differs if its
+	// absolute difference is still non-zero after subtracting the threshold
+	const __m128i centre = _mm_set1_epi32(yuv5);
+	const __m128i threshold = _mm_set1_epi32(0x00300706);
+	const __m128i zero = _mm_setzero_si128();
+
+	__m128i lo = _mm_set_epi32(yuv4, yuv3, yuv2, yuv1);
+	__m128i hi = _mm_set_epi32(yuv9, yuv8, yuv7, yuv6);
+	lo = _mm_or_si128(_mm_subs_epu8(lo, centre), _mm_subs_epu8(centre, lo));
+	hi = _mm_or_si128(_mm_subs_epu8(hi, centre), _mm_subs_epu8(centre, hi));
+	lo = _mm_cmpeq_epi32(_mm_subs_epu8(lo, threshold), zero);
+	hi = _mm_cmpeq_epi32(_mm_subs_epu8(hi, threshold), zero);
+
+	const __m128i same = _mm_packs_epi32(lo, hi);
+	return ~_mm_movemask_epi8(_mm_packs_epi16(same, same)) & 0xFF;
+#elif defined(SCALER_USE_NEON)
+	const uint32 neighbours[8] = { yuv1, yuv2, yuv3, yuv4, yuv6, yuv7, yuv8, yuv9 };
+	static const uint8 bits[8] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+	const uint8x16_t centre = vreinterpretq_u8_u32(vdupq_n_u32(yuv5));
+	const uint8x16_t threshold = vreinterpretq_u8_u32(vdupq_n_u32(0x00300706));
+
+	const uint8x16_t lo = vqsubq_u8(vabdq_u8(vreinterpretq_u8_u32(vld1q_u32(neighbours)), centre), threshold);
+	const uint8x16_t hi = vqsubq_u8(vabdq_u8(vreinterpretq_u8_u32(vld1q_u32(neighbours + 4)), centre), threshold);
+	const uint16x8_t differ = vcombine_u16(vmovn_u32(vtstq_u32(vreinterpretq_u32_u8(lo), vreinterpretq_u32_u8(lo))),
+	                                       vmovn_u32(vtstq_u32(vreinterpretq_u32_u8(hi), vreinterpretq_u32_u8(hi))));
+
+	uint8x8_t pattern = vand_u8(vmovn_u16(differ), vld1_u8(bits));
+	pattern = vpadd_u8(pattern, pattern);
+	pattern = vpadd_u8(pattern, pattern);
+	pattern = vpadd_u8(pattern, pattern);
+	return vget_lane_u8(pattern, 0);
+#else
+	int pattern = 0;
+	if (yuv5 != yuv1 && diffYUV(yuv5, yuv1)) pattern |= 0x0001;
+	if (yuv5 != yuv2 && diffYUV(yuv5, yuv2)) pattern |= 0x0002;
+	if (yuv5 != yuv3 && diffYUV(yuv5, yuv3)) pattern |= 0x0004;
+	if (yuv5 != yuv4 && diffYUV(yuv5, yuv4)) pattern |= 0x0008;
+	if (yuv5 != yuv6 && diffYUV(yuv5, yuv6)) pattern |= 0x0010;
+	if (yuv5 != yuv7 && diffYUV(yuv5, yuv7)) pattern |= 0x0020;
+	if (yuv5 != yuv8 && diffYUV(yuv5, yuv8)) pattern |= 0x0040;
+	if (yuv5 != yuv9 && diffYUV(yuv5, yuv9)) pattern |= 0x0080;
+	return pattern;
+#endif
+}
+
+/**
+ * Run a scaler on horizontal bands of the source area in parallel. Every
+ * band is at least two rows high; scalers may read one row above and below
+ * the area they scale, but only write to their own destination rows.
+ *
+ * @param proc   Scaler to run on each band.
+ * @param factor Number of destination rows per source row.
+ */
+void scaleInBands(ScalerProc *proc, int factor, const uint8 *srcPtr, uint32 srcPitch,
+                  uint8 *dstPtr, uint32 dstPitch, int width, int height);
+
 #endif
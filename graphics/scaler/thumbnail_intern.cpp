@@ -21,6 +21,7 @@
  */
 
 #include "common/endian.h"
+#include "common/jobs.h"
 #include "common/scummsys.h"
 #include "common/system.h"
 
@@ -160,6 +161,74 @@ static void scaleThumbnail(Graphics::Surface &in, Graphics::Surface &out) {
 }
 
 
+namespace {
+
+struct ConvertTo565Job {
+	const Graphics::Surface *src;
+	Graphics::PixelFormat srcFormat;
+	const uint16 *palette;	///< The palette in RGB565, for CLUT8 sources
+	Graphics::Surface *dst;
+};
+
+void convertRowsTo565(void *param, uint begin, uint end) {
+	const ConvertTo565Job &job = *(const ConvertTo565Job *)param;
+	const Graphics::PixelFormat &format = job.srcFormat;
+
+	for (uint y = begin; y < end; ++y) {
+		const byte *src = (const byte *)job.src->getBasePtr(0, y);
+		uint16 *dst = (uint16 *)job.dst->getBasePtr(0, y);
+
+		if (format.bytesPerPixel == 1) {
+			for (uint x = 0; x < job.src->w; ++x)
+				dst[x] = job.palette[src[x]];
+		} else if (format == job.dst->format) {
+			memcpy(dst, src, job.src->w * 2);
+		} else if (format.bytesPerPixel == 2) {
+			for (uint x = 0; x < job.src->w; ++x) {
+				byte r, g, b;
+				format.colorToRGB(READ_UINT16(src + x * 2), r, g, b);
+				dst[x] = Graphics::RGBToColor<Graphics::ColorMasks<565> >(r, g, b);
+			}
+		} else {
+			for (uint x = 0; x < job.src->w; ++x) {
+				byte r, g, b;
+				format.colorToRGB(READ_UINT32(src + x * 4), r, g, b);
+				dst[x] = Graphics::RGBToColor<Graphics::ColorMasks<565> >(r, g, b);
+			}
+		}
+	}
+}
+
+/**
+ * Converts a surface to a new surface in RGB565 format, on all workers of
+ * the job system. The rows of a screen can be converted independently, and
+ * the screen stays locked only as long as converting it takes.
+ *
+ * @param src       the surface to convert
+ * @param srcFormat the format of src; surfaces returned by lockScreen may not
+ *                  carry the actual screen format
+ * @param palette   the palette of CLUT8 surfaces, with 3 bytes per color
+ * @param dst       the surface to create
+ */
+void convertTo565(const Graphics::Surface &src, const Graphics::PixelFormat &srcFormat, const byte *palette, Graphics::Surface &dst) {
+	dst.create(src.w, src.h, Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
+
+	uint16 palette565[256];
+	if (srcFormat.bytesPerPixel == 1) {
+		for (int i = 0; i < 256; ++i)
+			palette565[i] = Graphics::RGBToColor<Graphics::ColorMasks<565> >(palette[i * 3], palette[i * 3 + 1], palette[i * 3 + 2]);
+	}
+
+	ConvertTo565Job job;
+	job.src = &src;
+	job.srcFormat = srcFormat;
+	job.palette = palette565;
+	job.dst = &dst;
+	JobMan.parallelFor(0, src.h, 32, convertRowsTo565, &job);
+}
+
+} // End of anonymous namespace
+
 /**
  * Copies the current screen contents to a new surface, using RGB565 format.
  * WARNING: surf->free() must be called by the user to avoid leaking.
@@ -177,37 +246,11 @@ static bool grabScreen565(Graphics::Surface *surf) {
 
 	Graphics::PixelFormat screenFormat = g_system->getScreenFormat();
 
-	surf->create(screen->w, screen->h, Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
-
-	byte *palette = 0;
-	if (screenFormat.bytesPerPixel == 1) {
-		palette = new byte[256 * 3];
-		assert(palette);
+	byte palette[256 * 3];
+	if (screenFormat.bytesPerPixel == 1)
 		g_system->getPaletteManager()->grabPalette(palette, 0, 256);
-	}
-
-	for (uint y = 0; y < screen->h; ++y) {
-		for (uint x = 0; x < screen->w; ++x) {
-			byte r = 0, g = 0, b = 0;
-
-			if (screenFormat.bytesPerPixel == 1) {
-				uint8 pixel = *(uint8 *)screen->getBasePtr(x, y);
-				r = palette[pixel * 3 + 0];
-				g = palette[pixel * 3 + 1];
-				b = palette[pixel * 3 + 2];
-			} else if (screenFormat.bytesPerPixel == 2) {
-				uint16 col = READ_UINT16(screen->getBasePtr(x, y));
-				screenFormat.colorToRGB(col, r, g, b);
-			} else if (screenFormat.bytesPerPixel == 4) {
-				uint32 col = READ_UINT32(screen->getBasePtr(x, y));
-				screenFormat.colorToRGB(col, r, g, b);
-			}
-
-			*((uint16 *)surf->getBasePtr(x, y)) = Graphics::RGBToColor<Graphics::ColorMasks<565> >(r, g, b);
-		}
-	}
 
-	delete[] palette;
+	convertTo565(*screen, screenFormat, palette, *surf);
 
 	g_system->unlockScreen();
 	return true;
@@ -241,19 +284,11 @@ bool createThumbnailFromScreen(Graphics::Surface *surf) {
 bool createThumbnail(Graphics::Surface *surf, const uint8 *pixels, int w, int h, const uint8 *palette) {
 	assert(surf);
 
-	Graphics::Surface screen;
-	screen.create(w, h, Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
-
-	for (uint y = 0; y < screen.h; ++y) {
-		for (uint x = 0; x < screen.w; ++x) {
-			byte r, g, b;
-			r = palette[pixels[y * w + x] * 3];
-			g = palette[pixels[y * w + x] * 3 + 1];
-			b = palette[pixels[y * w + x] * 3 + 2];
+	Graphics::Surface pixelSurface;
+	pixelSurface.init(w, h, w, const_cast<uint8 *>(pixels), Graphics::PixelFormat::createFormatCLUT8());
 
-			*((uint16 *)screen.getBasePtr(x, y)) = Graphics::RGBToColor<Graphics::ColorMasks<565> >(r, g, b);
-		}
-	}
+	Graphics::Surface screen;
+	convertTo565(pixelSurface, pixelSurface.format, palette, screen);
 
 	return createThumbnail(*surf, screen);
 }
@@ -27,34 +27,79 @@
 
 namespace Graphics {
 
-Screen::Screen(): ManagedSurface() {
+Screen::Screen(): ManagedSurface(), _usesScreenBuffer(false) {
 	create(g_system->getWidth(), g_system->getHeight(), g_system->getScreenFormat());
 }
 
-Screen::Screen(int width, int height): ManagedSurface() {
+Screen::Screen(int width, int height): ManagedSurface(), _usesScreenBuffer(false) {
 	create(width, height);
 }
 
-Screen::Screen(int width, int height, PixelFormat pixelFormat): ManagedSurface() {
+Screen::Screen(int width, int height, PixelFormat pixelFormat): ManagedSurface(), _usesScreenBuffer(false) {
 	create(width, height, pixelFormat);
 }
 
+Screen::~Screen() {
+	// The base class destructor only calls its own free()
+	free();
+}
+
+bool Screen::useScreenBuffer() {
+	if (_usesScreenBuffer)
+		return true;
+
+	Surface *buffer = g_system->getScreenBuffer(this);
+	if (!buffer)
+		return false;
+	if (buffer->w != w || buffer->h != h || buffer->format != format) {
+		g_system->releaseScreenBuffer(this);
+		return false;
+	}
+
+	// Keep what has been drawn so far
+	buffer->copyRectToSurface(getPixels(), pitch, 0, 0, w, h);
+	wrapSurface(*buffer);
+	_usesScreenBuffer = true;
+
+	return true;
+}
+
+void Screen::screenBufferReleased() {
+	// The buffer is still valid here, so copy it into pixels of our own
+	const Surface buffer = rawSurface();
+	_usesScreenBuffer = false;
+	create(buffer.w, buffer.h, buffer.format);
+	copyRectToSurface(buffer, 0, 0, Common::Rect(buffer.w, buffer.h));
+}
+
+void Screen::free() {
+	if (_usesScreenBuffer) {
+		g_system->releaseScreenBuffer(this);
+		_usesScreenBuffer = false;
+	}
+
+	ManagedSurface::free();
+}
+
 void Screen::update() {
-	// Merge the dirty rects
-	mergeDirtyRects();
-
-	// Loop through copying dirty areas to the physical screen
-	Common::List<Common::Rect>::iterator i;
-	for (i = _dirtyRects.begin(); i != _dirtyRects.end(); ++i) {
-		const Common::Rect &r = *i;
-		const byte *srcP = (const byte *)getBasePtr(r.left, r.top);
-		g_system->copyRectToScreen(srcP, pitch, r.left, r.top,
-			r.width(), r.height());
+	if (_usesScreenBuffer) {
+		// Everything was drawn on the game screen already
+		for (Common::Region::const_iterator i = _dirtyRegion.begin(); i != _dirtyRegion.end(); ++i)
+			g_system->markScreenDirty(*i);
+	} else {
+		// Loop through copying dirty areas to the physical screen. The region
+		// never covers a pixel twice, so nothing is copied more than once.
+		for (Common::Region::const_iterator i = _dirtyRegion.begin(); i != _dirtyRegion.end(); ++i) {
+			const Common::Rect &r = *i;
+			const byte *srcP = (const byte *)getBasePtr(r.left, r.top);
+			g_system->copyRectToScreen(srcP, pitch, r.left, r.top,
+				r.width(), r.height());
+		}
 	}
 
 	// Signal the physical screen to update
 	g_system->updateScreen();
-	_dirtyRects.clear();
+	_dirtyRegion.clear();
 }
 
 
@@ -64,42 +109,13 @@ void Screen::addDirtyRect(const Common::Rect &r) {
 	bounds.translate(getOffsetFromOwner().x, getOffsetFromOwner().y);
 
 	if (bounds.width() > 0 && bounds.height() > 0)
-		_dirtyRects.push_back(bounds);
+		_dirtyRegion.unite(bounds);
 }
 
 void Screen::makeAllDirty() {
 	addDirtyRect(Common::Rect(0, 0, this->w, this->h));
 }
 
-void Screen::mergeDirtyRects() {
-	Common::List<Common::Rect>::iterator rOuter, rInner;
-
-	// Process the dirty rect list to find any rects to merge
-	for (rOuter = _dirtyRects.begin(); rOuter != _dirtyRects.end(); ++rOuter) {
-		rInner = rOuter;
-		while (++rInner != _dirtyRects.end()) {
-
-			if ((*rOuter).intersects(*rInner)) {
-				// These two rectangles overlap, so merge them
-				unionRectangle(*rOuter, *rOuter, *rInner);
-
-				// remove the inner rect from the list
-				_dirtyRects.erase(rInner);
-
-				// move back to beginning of list
-				rInner = rOuter;
-			}
-		}
-	}
-}
-
-bool Screen::unionRectangle(Common::Rect &destRect, const Common::Rect &src1, const Common::Rect &src2) {
-	destRect = src1;
-	destRect.extend(src2);
-
-	return !destRect.isEmpty();
-}
-
 void Screen::getPalette(byte palette[PALETTE_SIZE]) {
 	assert(format.bytesPerPixel == 1);
 	g_system->getPaletteManager()->grabPalette(palette, 0, PALETTE_COUNT);
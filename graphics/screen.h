@@ -26,7 +26,9 @@
 #include "graphics/managed_surface.h"
 #include "graphics/pixelformat.h"
 #include "common/list.h"
+#include "common/system.h"
 #include "common/rect.h"
+#include "common/region.h"
 
 namespace Graphics {
 
@@ -39,22 +41,17 @@ namespace Graphics {
  * calls, and provides an update that method that blits the affected
  * areas to the physical screen
  */
-class Screen : public ManagedSurface {
+class Screen : public ManagedSurface, public ScreenBufferListener {
 private:
 	/**
-	 * List of affected areas of the screen
+	 * The affected areas of the screen
 	 */
-	Common::List<Common::Rect> _dirtyRects;
-private:
-	/**
-	* Merges together overlapping dirty areas of the screen
-	*/
-	void mergeDirtyRects();
+	Common::Region _dirtyRegion;
 
 	/**
-	* Returns the union of two dirty area rectangles
-	*/
-	bool unionRectangle(Common::Rect &destRect, const Common::Rect &src1, const Common::Rect &src2);
+	 * Whether the pixels are the screen buffer of the backend
+	 */
+	bool _usesScreenBuffer;
 protected:
 	/**
 	 * Adds a rectangle to the list of modified areas of the screen during the
@@ -65,11 +62,12 @@ public:
 	Screen();
 	Screen(int width, int height);
 	Screen(int width, int height, PixelFormat pixelFormat);
+	virtual ~Screen();
 
 	/**
 	 * Returns true if there are any pending screen updates (dirty areas)
 	 */
-	bool isDirty() const { return !_dirtyRects.empty(); }
+	bool isDirty() const { return !_dirtyRegion.isEmpty(); }
 
 	/**
 	 * Marks the whole screen as dirty. This forces the next call to update
@@ -80,7 +78,34 @@ public:
 	/**
 	 * Clear the current dirty rects list
 	 */
-	virtual void clearDirtyRects() { _dirtyRects.clear(); }
+	virtual void clearDirtyRects() { _dirtyRegion.clear(); }
+
+	/**
+	 * Draw straight into the screen buffer of the backend from now on,
+	 * instead of copying the affected areas to it on every update. The
+	 * screen must have the size and format of the game screen. Sub-surfaces
+	 * must not be created from it, as the pixels change whenever the
+	 * backend frees its buffer.
+	 *
+	 * Nothing else may then draw on the game screen through OSystem, as
+	 * that would change the pixels of this screen. Recreating the screen,
+	 * or the backend freeing its buffer, makes it go back to pixels of its
+	 * own, so this has to be called again after changing the screen size.
+	 *
+	 * @return false if the backend does not support this, in which case
+	 *         the screen keeps using its own pixels
+	 */
+	bool useScreenBuffer();
+
+	/**
+	 * Go back to pixels of its own, keeping the current contents
+	 */
+	virtual void screenBufferReleased() override;
+
+	/**
+	 * Frees the pixels, and stops using the screen buffer of the backend
+	 */
+	virtual void free() override;
 
 	/**
 	 * Updates the screen by copying any affected areas to the system
@@ -40,6 +40,13 @@ static void plotPoint(int x, int y, int color, void *data) {
 	}
 }
 
+// Convert all palette entries to the target format up front, rather than
+// converting the color of every pixel
+static void convertPalette(uint32 *map, const byte *palette, const PixelFormat &dstFormat) {
+	for (int i = 0; i < 256; i++)
+		map[i] = dstFormat.RGBToColor(palette[i * 3], palette[i * 3 + 1], palette[i * 3 + 2]);
+}
+
 void Surface::drawLine(int x0, int y0, int x1, int y1, uint32 color) {
 	if (format.bytesPerPixel == 1)
 		Graphics::drawLine(x0, y0, x1, y1, color, plotPoint<byte>, this);
@@ -382,24 +389,23 @@ void Surface::convertToInPlace(const PixelFormat &dstFormat, const byte *palette
 	if (format.bytesPerPixel == 1) {
 		assert(palette);
 
+		uint32 map[256];
+		convertPalette(map, palette, dstFormat);
+
 		for (int y = h; y > 0; --y) {
 			const byte *srcRow = (const byte *)pixels + y * pitch - 1;
 			byte *dstRow = (byte *)pixels + y * w * dstFormat.bytesPerPixel - dstFormat.bytesPerPixel;
 
-			for (int x = 0; x < w; x++) {
-				byte index = *srcRow--;
-				byte r = palette[index * 3];
-				byte g = palette[index * 3 + 1];
-				byte b = palette[index * 3 + 2];
-
-				uint32 color = dstFormat.RGBToColor(r, g, b);
-
-				if (dstFormat.bytesPerPixel == 2)
-					*((uint16 *)dstRow) = color;
-				else
-					*((uint32 *)dstRow) = color;
-
-				dstRow -= dstFormat.bytesPerPixel;
+			if (dstFormat.bytesPerPixel == 2) {
+				for (int x = 0; x < w; x++) {
+					*((uint16 *)dstRow) = map[*srcRow--];
+					dstRow -= 2;
+				}
+			} else {
+				for (int x = 0; x < w; x++) {
+					*((uint32 *)dstRow) = map[*srcRow--];
+					dstRow -= 4;
+				}
 			}
 		}
 	} else {
@@ -443,56 +449,13 @@ Graphics::Surface *Surface::convertTo(const PixelFormat &dstFormat, const byte *
 		// Converting from paletted to high color
 		assert(palette);
 
-		for (int y = 0; y < h; y++) {
-			const byte *srcRow = (const byte *)getBasePtr(0, y);
-			byte *dstRow = (byte *)surface->getBasePtr(0, y);
-
-			for (int x = 0; x < w; x++) {
-				byte index = *srcRow++;
-				byte r = palette[index * 3];
-				byte g = palette[index * 3 + 1];
-				byte b = palette[index * 3 + 2];
-
-				uint32 color = dstFormat.RGBToColor(r, g, b);
-
-				if (dstFormat.bytesPerPixel == 2)
-					*((uint16 *)dstRow) = color;
-				else
-					*((uint32 *)dstRow) = color;
+		uint32 map[256];
+		convertPalette(map, palette, dstFormat);
 
-				dstRow += dstFormat.bytesPerPixel;
-			}
-		}
+		crossBlitMap((byte *)surface->getPixels(), (const byte *)getPixels(), surface->pitch, pitch, w, h, dstFormat.bytesPerPixel, map);
 	} else {
 		// Converting from high color to high color
-		for (int y = 0; y < h; y++) {
-			const byte *srcRow = (const byte *)getBasePtr(0, y);
-			byte *dstRow = (byte *)surface->getBasePtr(0, y);
-
-			for (int x = 0; x < w; x++) {
-				uint32 srcColor;
-				if (format.bytesPerPixel == 2)
-					srcColor = READ_UINT16(srcRow);
-				else if (format.bytesPerPixel == 3)
-					srcColor = READ_UINT24(srcRow);
-				else
-					srcColor = READ_UINT32(srcRow);
-
-				srcRow += format.bytesPerPixel;
-
-				// Convert that color to the new format
-				byte r, g, b, a;
-				format.colorToARGB(srcColor, a, r, g, b);
-				uint32 color = dstFormat.ARGBToColor(a, r, g, b);
-
-				if (dstFormat.bytesPerPixel == 2)
-					*((uint16 *)dstRow) = color;
-				else
-					*((uint32 *)dstRow) = color;
-
-				dstRow += dstFormat.bytesPerPixel;
-			}
-		}
+		crossBlit((byte *)surface->getPixels(), (const byte *)getPixels(), surface->pitch, pitch, w, h, dstFormat, format);
 	}
 
 	return surface;
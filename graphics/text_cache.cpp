@@ -0,0 +1,212 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "graphics/text_cache.h"
+
+namespace Graphics {
+
+namespace {
+
+template<typename ColorType>
+void drawMask(byte *dstPos, int dstPitch, const byte *srcPos, int srcPitch, int w, int h, ColorType color, const PixelFormat &dstFormat) {
+	uint8 sR, sG, sB;
+	dstFormat.colorToRGB(color, sR, sG, sB);
+
+	for (int y = 0; y < h; ++y) {
+		ColorType *dst = (ColorType *)dstPos;
+
+		for (int x = 0; x < w; ++x) {
+			const uint8 a = srcPos[x];
+			if (a == 255) {
+				dst[x] = color;
+			} else if (a) {
+				uint8 dR, dG, dB;
+				dstFormat.colorToRGB(dst[x], dR, dG, dB);
+
+				dR = ((255 - a) * dR + a * sR) / 255;
+				dG = ((255 - a) * dG + a * sG) / 255;
+				dB = ((255 - a) * dB + a * sB) / 255;
+
+				dst[x] = dstFormat.RGBToColor(dR, dG, dB);
+			}
+		}
+
+		dstPos += dstPitch;
+		srcPos += srcPitch;
+	}
+}
+
+} // End of anonymous namespace
+
+uint TextCache::KeyHash::operator()(const Key &key) const {
+	uint hash = (uint)(size_t)key.font;
+	hash = hash * 31 + (uint)key.width;
+	hash = hash * 31 + (uint)key.align;
+	for (uint i = 0; i < key.str.size(); ++i)
+		hash = hash * 31 + key.str[i];
+	return hash;
+}
+
+TextCache::TextCache(uint32 maxSize) : _maxSize(maxSize), _size(0), _accessCounter(0) {
+}
+
+TextCache::~TextCache() {
+	clear();
+}
+
+const TextCache::Entry *TextCache::lookup(const Font &font, const Common::U32String &str, int w, TextAlign align) {
+	Key key;
+	key.font = &font;
+	key.str = str;
+	key.width = w;
+	key.align = align;
+
+	EntryMap::iterator it = _entries.find(key);
+	if (it != _entries.end()) {
+		it->_value.lastAccess = _accessCounter++;
+		return &it->_value;
+	}
+
+	const Common::Rect bbox = font.getBoundingBox(str, 0, 0, w, align);
+	if (bbox.isEmpty())
+		return nullptr;
+
+	// Draw the string in white onto black, which leaves the coverage of
+	// every pixel in its color channels
+	const PixelFormat format(4, 8, 8, 8, 0, 16, 8, 0, 0);
+	Surface rendered;
+	rendered.create(bbox.width(), bbox.height(), format);
+	memset(rendered.getPixels(), 0, rendered.pitch * rendered.h);
+	font.drawString(&rendered, str, -bbox.left, -bbox.top, w, format.RGBToColor(255, 255, 255), align);
+
+	const uint32 size = rendered.w * rendered.h;
+	if (size > _maxSize) {
+		rendered.free();
+		return nullptr;
+	}
+	shrink(_maxSize - size);
+
+	Entry &entry = _entries[key];
+	entry.mask.create(rendered.w, rendered.h, PixelFormat::createFormatCLUT8());
+	entry.offset = Common::Point(bbox.left, bbox.top);
+	entry.lastAccess = _accessCounter++;
+	_size += size;
+
+	for (int y = 0; y < rendered.h; ++y) {
+		const uint32 *src = (const uint32 *)rendered.getBasePtr(0, y);
+		byte *dst = (byte *)entry.mask.getBasePtr(0, y);
+		for (int x = 0; x < rendered.w; ++x) {
+			uint8 r, g, b;
+			format.colorToRGB(src[x], r, g, b);
+			dst[x] = r;
+		}
+	}
+
+	rendered.free();
+	return &entry;
+}
+
+void TextCache::drawString(Surface *dst, const Font &font, const Common::U32String &str, int x, int y, int w, uint32 color, TextAlign align) {
+	assert(dst != nullptr);
+
+	const Entry *entry = lookup(font, str, w, align);
+	if (!entry) {
+		// Strings which are too large to be cached are drawn directly
+		font.drawString(dst, str, x, y, w, color, align);
+		return;
+	}
+
+	Common::Rect area(entry->mask.w, entry->mask.h);
+	area.translate(x + entry->offset.x, y + entry->offset.y);
+	Common::Rect clipped = area;
+	clipped.clip(Common::Rect(dst->w, dst->h));
+	if (clipped.isEmpty())
+		return;
+
+	const byte *srcPos = (const byte *)entry->mask.getBasePtr(clipped.left - area.left, clipped.top - area.top);
+	byte *dstPos = (byte *)dst->getBasePtr(clipped.left, clipped.top);
+	const int clippedW = clipped.width(), clippedH = clipped.height();
+
+	if (dst->format.bytesPerPixel == 1) {
+		for (int cy = 0; cy < clippedH; ++cy) {
+			for (int cx = 0; cx < clippedW; ++cx) {
+				if (srcPos[cx] >= 0x80)
+					dstPos[cx] = color;
+			}
+
+			dstPos += dst->pitch;
+			srcPos += entry->mask.pitch;
+		}
+	} else if (dst->format.bytesPerPixel == 2) {
+		drawMask<uint16>(dstPos, dst->pitch, srcPos, entry->mask.pitch, clippedW, clippedH, color, dst->format);
+	} else if (dst->format.bytesPerPixel == 4) {
+		drawMask<uint32>(dstPos, dst->pitch, srcPos, entry->mask.pitch, clippedW, clippedH, color, dst->format);
+	}
+}
+
+void TextCache::drawString(Surface *dst, const Font &font, const Common::String &str, int x, int y, int w, uint32 color, TextAlign align) {
+	Common::U32String u32str;
+	for (uint i = 0; i < str.size(); ++i)
+		u32str += (byte)str[i];
+
+	drawString(dst, font, u32str, x, y, w, color, align);
+}
+
+void TextCache::remove(const Font *font) {
+	for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+		if (it->_key.font == font)
+			removeEntry(it);
+	}
+}
+
+void TextCache::clear() {
+	for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it)
+		it->_value.mask.free();
+
+	_entries.clear();
+	_size = 0;
+}
+
+void TextCache::setMaxSize(uint32 maxSize) {
+	_maxSize = maxSize;
+	shrink(maxSize);
+}
+
+void TextCache::removeEntry(EntryMap::iterator it) {
+	_size -= it->_value.mask.w * it->_value.mask.h;
+	it->_value.mask.free();
+	_entries.erase(it);
+}
+
+void TextCache::shrink(uint32 maxSize) {
+	// Drop the least recently used strings
+	while (_size > maxSize) {
+		EntryMap::iterator oldest = _entries.begin();
+		for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+			if (it->_value.lastAccess < oldest->_value.lastAccess)
+				oldest = it;
+		}
+		removeEntry(oldest);
+	}
+}
+
+} // End of namespace Graphics
@@ -0,0 +1,124 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GRAPHICS_TEXT_CACHE_H
+#define GRAPHICS_TEXT_CACHE_H
+
+#include "common/hashmap.h"
+#include "common/noncopyable.h"
+#include "common/rect.h"
+#include "common/ustr.h"
+#include "graphics/font.h"
+#include "graphics/surface.h"
+
+namespace Graphics {
+
+/**
+ * A cache of rendered strings, for text which is drawn again every frame,
+ * like GUI labels and subtitles.
+ *
+ * A string is rendered once with Font::drawString into an 8-bit coverage
+ * mask, which is stored under the font, the string, the width of the text
+ * area and the alignment. Drawing it again tints the mask with the text
+ * color in a single pass, instead of looking up, kerning and drawing every
+ * glyph separately. Since the color is applied when drawing, the same
+ * entry serves every color of a string.
+ *
+ * When the total size of the cached masks exceeds the limit, the least
+ * recently used ones are dropped. The cache does not notice when a font is
+ * destroyed, so its entries must be dropped with remove() before that.
+ */
+class TextCache : Common::NonCopyable {
+public:
+	/**
+	 * Create a new cache.
+	 *
+	 * @param maxSize	maximum total size of the cached masks in bytes
+	 */
+	explicit TextCache(uint32 maxSize = 1024 * 1024);
+	~TextCache();
+
+	/**
+	 * Draw a string, with the same results as Font::drawString.
+	 *
+	 * On surfaces with 1 byte per pixel, pixels covered for at least half
+	 * are drawn in the given color, like TTFFont does for single glyphs.
+	 * Strings are never shortened with an ellipsis.
+	 */
+	void drawString(Surface *dst, const Font &font, const Common::U32String &str, int x, int y, int w, uint32 color, TextAlign align = kTextAlignLeft);
+	void drawString(Surface *dst, const Font &font, const Common::String &str, int x, int y, int w, uint32 color, TextAlign align = kTextAlignLeft);
+
+	/** Drop all strings rendered with the given font. */
+	void remove(const Font *font);
+
+	/** Drop all strings from the cache. */
+	void clear();
+
+	/** Change the size limit, dropping strings as necessary. */
+	void setMaxSize(uint32 maxSize);
+
+	uint32 getMaxSize() const { return _maxSize; }
+
+	/** Return the total size of the cached masks in bytes. */
+	uint32 getSize() const { return _size; }
+
+	/** Return the number of cached strings. */
+	uint getCount() const { return _entries.size(); }
+
+private:
+	struct Key {
+		const Font *font;
+		Common::U32String str;
+		int width;
+		TextAlign align;
+
+		bool operator==(const Key &other) const {
+			return font == other.font && width == other.width &&
+			       align == other.align && str == other.str;
+		}
+	};
+
+	struct KeyHash {
+		uint operator()(const Key &key) const;
+	};
+
+	struct Entry {
+		Surface mask;			///< Coverage of every pixel, from 0 to 255
+		Common::Point offset;	///< Position of the mask relative to the drawing position
+		uint32 lastAccess;
+	};
+
+	typedef Common::HashMap<Key, Entry, KeyHash> EntryMap;
+
+	EntryMap _entries;
+	uint32 _maxSize;
+	uint32 _size;
+	uint32 _accessCounter;
+
+	const Entry *lookup(const Font &font, const Common::U32String &str, int w, TextAlign align);
+	void removeEntry(EntryMap::iterator it);
+	void shrink(uint32 maxSize);
+};
+
+} // End of namespace Graphics
+
+#endif
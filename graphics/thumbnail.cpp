@@ -178,19 +178,22 @@ bool loadThumbnail(Common::SeekableReadStream &in, Graphics::Surface *&thumbnail
 	thumbnail = new Graphics::Surface();
 	thumbnail->create(header.width, header.height, header.format);
 
+	// Read whole rows at once and swap their pixels in place afterwards
 	for (int y = 0; y < thumbnail->h; ++y) {
+		in.read(thumbnail->getBasePtr(0, y), thumbnail->w * header.format.bytesPerPixel);
+
 		switch (header.format.bytesPerPixel) {
 		case 2: {
 			uint16 *pixels = (uint16 *)thumbnail->getBasePtr(0, y);
 			for (uint x = 0; x < thumbnail->w; ++x) {
-				*pixels++ = in.readUint16BE();
+				pixels[x] = FROM_BE_16(pixels[x]);
 			}
 			} break;
 
 		case 4: {
 			uint32 *pixels = (uint32 *)thumbnail->getBasePtr(0, y);
 			for (uint x = 0; x < thumbnail->w; ++x) {
-				*pixels++ = in.readUint32BE();
+				pixels[x] = FROM_BE_32(pixels[x]);
 			}
 			} break;
 
@@ -245,27 +248,31 @@ bool saveThumbnail(Common::WriteStream &out, const Graphics::Surface &thumb) {
 	out.writeByte(thumb.format.bShift);
 	out.writeByte(thumb.format.aShift);
 
-	// Serialize the pixel data
+	// Serialize the pixel data, a row at a time
+	byte *row = new byte[thumb.w * thumb.format.bytesPerPixel];
 	for (uint y = 0; y < thumb.h; ++y) {
 		switch (thumb.format.bytesPerPixel) {
 		case 2: {
 			const uint16 *pixels = (const uint16 *)thumb.getBasePtr(0, y);
 			for (uint x = 0; x < thumb.w; ++x) {
-				out.writeUint16BE(*pixels++);
+				WRITE_BE_UINT16(row + x * 2, pixels[x]);
 			}
 			} break;
 
 		case 4: {
 			const uint32 *pixels = (const uint32 *)thumb.getBasePtr(0, y);
 			for (uint x = 0; x < thumb.w; ++x) {
-				out.writeUint32BE(*pixels++);
+				WRITE_BE_UINT32(row + x * 4, pixels[x]);
 			}
 			} break;
 
 		default:
 			assert(0);
 		}
+
+		out.write(row, thumb.w * thumb.format.bytesPerPixel);
 	}
+	delete[] row;
 
 	return true;
 }
@@ -0,0 +1,125 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "graphics/transform_cache.h"
+
+namespace Graphics {
+
+uint TransformCache::KeyHash::operator()(const Key &key) const {
+	uint hash = (uint)(size_t)key.source;
+	hash = hash * 31 + (uint)(key.srcRect.left ^ (key.srcRect.top << 16));
+	hash = hash * 31 + (uint)(key.width ^ (key.height << 16));
+	hash = hash * 31 + (uint)(key.zoom.x ^ (key.zoom.y << 16));
+	hash = hash * 31 + (uint)(key.hotspot.x ^ (key.hotspot.y << 16));
+	hash = hash * 31 + (uint)key.angle;
+	return hash;
+}
+
+TransformCache::TransformCache(uint32 maxSize) : _maxSize(maxSize), _size(0), _accessCounter(0) {
+}
+
+TransformCache::~TransformCache() {
+	clear();
+}
+
+TransformCache::Key TransformCache::makeKey(const void *source, const Common::Rect &srcRect, uint16 width, uint16 height,
+                                            const TransformStruct &transform, TFilteringMode filter) {
+	Key key;
+	key.source = source;
+	key.srcRect = srcRect;
+	key.width = width;
+	key.height = height;
+	key.zoom = transform._zoom;
+	key.hotspot = transform._hotspot;
+	key.angle = transform._angle;
+	key.filter = filter;
+	return key;
+}
+
+TransformCache::SurfacePtr TransformCache::find(const void *source, const Common::Rect &srcRect, uint16 width, uint16 height,
+                                                const TransformStruct &transform, TFilteringMode filter) {
+	EntryMap::iterator it = _entries.find(makeKey(source, srcRect, width, height, transform, filter));
+	if (it == _entries.end())
+		return SurfacePtr();
+
+	it->_value.lastAccess = _accessCounter++;
+	return it->_value.surface;
+}
+
+TransformCache::SurfacePtr TransformCache::insert(const void *source, const Common::Rect &srcRect, uint16 width, uint16 height,
+                                                  const TransformStruct &transform, TFilteringMode filter, Surface *surface) {
+	SurfacePtr ptr(surface, SurfaceDeleter());
+	const uint32 size = surface->pitch * surface->h;
+	if (size > _maxSize)
+		return ptr;
+
+	const Key key = makeKey(source, srcRect, width, height, transform, filter);
+	EntryMap::iterator it = _entries.find(key);
+	if (it != _entries.end())
+		removeEntry(it);
+
+	shrink(_maxSize - size);
+
+	Entry &entry = _entries[key];
+	entry.surface = ptr;
+	entry.size = size;
+	entry.lastAccess = _accessCounter++;
+	_size += size;
+	return ptr;
+}
+
+void TransformCache::remove(const void *source) {
+	for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+		if (it->_key.source == source)
+			removeEntry(it);
+	}
+}
+
+void TransformCache::clear() {
+	_entries.clear();
+	_size = 0;
+}
+
+void TransformCache::setMaxSize(uint32 maxSize) {
+	_maxSize = maxSize;
+	shrink(maxSize);
+}
+
+void TransformCache::removeEntry(EntryMap::iterator it) {
+	_size -= it->_value.size;
+	_entries.erase(it);
+}
+
+void TransformCache::shrink(uint32 maxSize) {
+	// Drop the least recently used surfaces. A linear search for the
+	// oldest one is cheap compared to transforming a single sprite.
+	while (_size > maxSize) {
+		EntryMap::iterator oldest = _entries.begin();
+		for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+			if (it->_value.lastAccess < oldest->_value.lastAccess)
+				oldest = it;
+		}
+		removeEntry(oldest);
+	}
+}
+
+} // End of namespace Graphics
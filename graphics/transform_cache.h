@@ -0,0 +1,151 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GRAPHICS_TRANSFORM_CACHE_H
+#define GRAPHICS_TRANSFORM_CACHE_H
+
+#include "common/hashmap.h"
+#include "common/noncopyable.h"
+#include "common/ptr.h"
+#include "common/rect.h"
+#include "graphics/transparent_surface.h"
+
+namespace Graphics {
+
+/**
+ * A cache of scaled and rotated sprites, for engines which draw the same
+ * zoomed or rotated sprite frame after frame.
+ *
+ * Transformed surfaces are stored under the identity of their source
+ * (an arbitrary pointer chosen by the caller, e.g. the object owning the
+ * source surface), the area of the source that was transformed, the
+ * target size, the zoom, rotation and hotspot of the transform and the
+ * filtering mode. Blend mode, color modulation, flipping and offsets do
+ * not take part, since TransparentSurface applies them when blitting.
+ *
+ * When the total size of the cached surfaces exceeds the limit, the least
+ * recently used ones are dropped. Surfaces handed out by the cache are
+ * shared and must not be modified; they stay alive until the last
+ * reference to them is gone, even if they are dropped from the cache.
+ *
+ * Whenever the pixels of a source change, or it is destroyed, all its
+ * entries must be dropped with remove().
+ */
+class TransformCache : Common::NonCopyable {
+public:
+	typedef Common::SharedPtr<Surface> SurfacePtr;
+
+	/**
+	 * Create a new cache.
+	 *
+	 * @param maxSize	maximum total size of the cached surfaces in bytes
+	 */
+	explicit TransformCache(uint32 maxSize = 16 * 1024 * 1024);
+	~TransformCache();
+
+	/**
+	 * Look up a transformed surface.
+	 *
+	 * @param source	identity of the source surface
+	 * @param srcRect	area of the source which is transformed
+	 * @param width		width of the transformed surface
+	 * @param height	height of the transformed surface
+	 * @param transform	the transform applied to the source area
+	 * @param filter	the filtering mode used
+	 * @return the transformed surface, or a null pointer if it is not cached
+	 */
+	SurfacePtr find(const void *source, const Common::Rect &srcRect, uint16 width, uint16 height,
+	                const TransformStruct &transform, TFilteringMode filter);
+
+	/**
+	 * Store a transformed surface in the cache.
+	 *
+	 * Surfaces which are larger than the whole cache are not stored, but
+	 * are still returned wrapped in a shared pointer.
+	 *
+	 * @param surface	the transformed surface; the cache takes ownership of it
+	 * @see find
+	 */
+	SurfacePtr insert(const void *source, const Common::Rect &srcRect, uint16 width, uint16 height,
+	                  const TransformStruct &transform, TFilteringMode filter, Surface *surface);
+
+	/** Drop all surfaces transformed from the given source. */
+	void remove(const void *source);
+
+	/** Drop all surfaces from the cache. */
+	void clear();
+
+	/** Change the size limit, dropping surfaces as necessary. */
+	void setMaxSize(uint32 maxSize);
+
+	uint32 getMaxSize() const { return _maxSize; }
+
+	/** Return the total size of the cached surfaces in bytes. */
+	uint32 getSize() const { return _size; }
+
+	/** Return the number of cached surfaces. */
+	uint getCount() const { return _entries.size(); }
+
+private:
+	struct Key {
+		const void *source;
+		Common::Rect srcRect;
+		uint16 width, height;
+		Common::Point zoom;
+		Common::Point hotspot;
+		int32 angle;
+		TFilteringMode filter;
+
+		bool operator==(const Key &other) const {
+			return source == other.source && srcRect == other.srcRect &&
+			       width == other.width && height == other.height &&
+			       zoom == other.zoom && hotspot == other.hotspot &&
+			       angle == other.angle && filter == other.filter;
+		}
+	};
+
+	struct KeyHash {
+		uint operator()(const Key &key) const;
+	};
+
+	struct Entry {
+		SurfacePtr surface;
+		uint32 size;
+		uint32 lastAccess;
+	};
+
+	typedef Common::HashMap<Key, Entry, KeyHash> EntryMap;
+
+	EntryMap _entries;
+	uint32 _maxSize;
+	uint32 _size;
+	uint32 _accessCounter;
+
+	static Key makeKey(const void *source, const Common::Rect &srcRect, uint16 width, uint16 height,
+	                   const TransformStruct &transform, TFilteringMode filter);
+	void removeEntry(EntryMap::iterator it);
+	void shrink(uint32 maxSize);
+};
+
+} // End of namespace Graphics
+
+#endif
@@ -57,6 +57,313 @@ static const int kGIndex = 1;
 static const int kRIndex = 0;
 #endif
 
+// The blit loops below hand as many pixels as possible to vector code,
+// four at a time with SSE2 or eight at a time with NEON. The vector code
+// does the same integer arithmetic as the scalar loops, so the results are
+// identical; the scalar loops only handle the remaining pixels of each row.
+// The vector code assumes the little endian channel order from above.
+#if defined(SCUMM_LITTLE_ENDIAN) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define TRANSPARENT_SURFACE_USE_SSE2
+#include <emmintrin.h>
+#elif defined(SCUMM_LITTLE_ENDIAN) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define TRANSPARENT_SURFACE_USE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+#if defined(TRANSPARENT_SURFACE_USE_SSE2)
+
+// Every operation takes four source and four destination pixels and returns
+// the four blended pixels.
+
+// Widen two pixels to 16 bits per channel
+inline __m128i unpackLo(__m128i v) { return _mm_unpacklo_epi8(v, _mm_setzero_si128()); }
+inline __m128i unpackHi(__m128i v) { return _mm_unpackhi_epi8(v, _mm_setzero_si128()); }
+
+// Spread the alpha of both widened pixels over all their channels
+inline __m128i spreadAlpha(__m128i v) { return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x00), 0x00); }
+
+inline __m128i alphaMask() { return _mm_set1_epi32(0xFF); }
+
+// Pick dst where the source alpha is zero, and res elsewhere
+inline __m128i keepTransparent(__m128i src, __m128i dst, __m128i res) {
+	const __m128i transparent = _mm_cmpeq_epi32(_mm_and_si128(src, alphaMask()), _mm_setzero_si128());
+	return _mm_or_si128(_mm_and_si128(transparent, dst), _mm_andnot_si128(transparent, res));
+}
+
+// Take the color channels from res and the alpha channel from dst
+inline __m128i keepAlpha(__m128i dst, __m128i res) {
+	return _mm_or_si128(_mm_andnot_si128(alphaMask(), res), _mm_and_si128(alphaMask(), dst));
+}
+
+struct OpaqueOp {
+	__m128i operator()(__m128i src, __m128i dst) const {
+		return _mm_or_si128(src, alphaMask());
+	}
+};
+
+struct BinaryOp {
+	__m128i operator()(__m128i src, __m128i dst) const {
+		return keepTransparent(src, dst, _mm_or_si128(src, alphaMask()));
+	}
+};
+
+struct AlphaBlendOp {
+	__m128i blend(__m128i src, __m128i dst) const {
+		const __m128i alpha = spreadAlpha(src);
+		const __m128i invAlpha = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+		return _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(src, alpha), _mm_mullo_epi16(dst, invAlpha)), 8);
+	}
+
+	__m128i operator()(__m128i src, __m128i dst) const {
+		const __m128i res = _mm_packus_epi16(blend(unpackLo(src), unpackLo(dst)), blend(unpackHi(src), unpackHi(dst)));
+		return keepTransparent(src, dst, _mm_or_si128(res, alphaMask()));
+	}
+};
+
+struct ColorAlphaBlendOp {
+	__m128i _ca, _cmod;
+
+	ColorAlphaBlendOp(uint32 color) {
+		const short cr = (color >> kRModShift) & 0xFF;
+		const short cg = (color >> kGModShift) & 0xFF;
+		const short cb = (color >> kBModShift) & 0xFF;
+		_ca = _mm_set1_epi16((color >> kAModShift) & 0xFF);
+		_cmod = _mm_set_epi16(cr, cg, cb, 0, cr, cg, cb, 0);
+	}
+
+	__m128i blend(__m128i src, __m128i dst) const {
+		const __m128i alpha = _mm_srli_epi16(_mm_mullo_epi16(spreadAlpha(src), _ca), 8);
+		const __m128i invAlpha = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+		dst = _mm_srli_epi16(_mm_mullo_epi16(dst, invAlpha), 8);
+		return _mm_add_epi16(dst, _mm_mulhi_epu16(_mm_mullo_epi16(src, alpha), _cmod));
+	}
+
+	__m128i operator()(__m128i src, __m128i dst) const {
+		const __m128i res = _mm_packus_epi16(blend(unpackLo(src), unpackLo(dst)), blend(unpackHi(src), unpackHi(dst)));
+		return _mm_or_si128(res, alphaMask());
+	}
+};
+
+struct AdditiveBlendOp {
+	__m128i scale(__m128i src) const {
+		return _mm_srli_epi16(_mm_mullo_epi16(src, spreadAlpha(src)), 8);
+	}
+
+	__m128i operator()(__m128i src, __m128i dst) const {
+		const __m128i scaled = _mm_packus_epi16(scale(unpackLo(src)), scale(unpackHi(src)));
+		return keepAlpha(dst, _mm_adds_epu8(scaled, dst));
+	}
+};
+
+struct SubtractiveBlendOp {
+	__m128i blend(__m128i src, __m128i dst) const {
+		return _mm_sub_epi16(dst, _mm_mulhi_epu16(_mm_mullo_epi16(src, dst), spreadAlpha(src)));
+	}
+
+	__m128i operator()(__m128i src, __m128i dst) const {
+		const __m128i res = _mm_packus_epi16(blend(unpackLo(src), unpackLo(dst)), blend(unpackHi(src), unpackHi(dst)));
+		return keepAlpha(dst, res);
+	}
+};
+
+struct MultiplyBlendOp {
+	__m128i blend(__m128i src, __m128i dst) const {
+		const __m128i scaled = _mm_srli_epi16(_mm_mullo_epi16(src, spreadAlpha(src)), 8);
+		return _mm_srli_epi16(_mm_mullo_epi16(scaled, dst), 8);
+	}
+
+	__m128i operator()(__m128i src, __m128i dst) const {
+		const __m128i res = _mm_packus_epi16(blend(unpackLo(src), unpackLo(dst)), blend(unpackHi(src), unpackHi(dst)));
+		return keepTransparent(src, dst, keepAlpha(dst, res));
+	}
+};
+
+/**
+ * Blend as many pixels of a row as possible with the given operation.
+ * @return the number of pixels blended
+ */
+template<class Op>
+uint32 blitRowSIMD(const byte *in, byte *out, uint32 width, int32 inStep, const Op &op) {
+	if (inStep != 4 && inStep != -4)
+		return 0;
+
+	uint32 j;
+	for (j = 0; j + 4 <= width; j += 4) {
+		__m128i src;
+		if (inStep > 0) {
+			src = _mm_loadu_si128((const __m128i *)(in + j * 4));
+		} else {
+			// Horizontally flipped, load the pixels and reverse them
+			src = _mm_loadu_si128((const __m128i *)(in - j * 4 - 12));
+			src = _mm_shuffle_epi32(src, _MM_SHUFFLE(0, 1, 2, 3));
+		}
+
+		const __m128i dst = _mm_loadu_si128((const __m128i *)(out + j * 4));
+		_mm_storeu_si128((__m128i *)(out + j * 4), op(src, dst));
+	}
+
+	return j;
+}
+
+#elif defined(TRANSPARENT_SURFACE_USE_NEON)
+
+// Every operation takes eight source and eight destination pixels, split
+// into one vector per channel, and returns the eight blended pixels. The
+// alpha channel is val[0], followed by blue, green and red.
+
+// (x * y) >> 16, for 16 bit values
+inline uint16x8_t mulHi(uint16x8_t x, uint16x8_t y) {
+	const uint32x4_t lo = vmull_u16(vget_low_u16(x), vget_low_u16(y));
+	const uint32x4_t hi = vmull_u16(vget_high_u16(x), vget_high_u16(y));
+	return vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16));
+}
+
+// Pick dst where the source alpha is zero, and res elsewhere
+inline uint8x8x4_t keepTransparent(const uint8x8x4_t &src, const uint8x8x4_t &dst, uint8x8x4_t res) {
+	const uint8x8_t transparent = vceq_u8(src.val[0], vdup_n_u8(0));
+	for (int c = 0; c < 4; ++c)
+		res.val[c] = vbsl_u8(transparent, dst.val[c], res.val[c]);
+	return res;
+}
+
+struct OpaqueOp {
+	uint8x8x4_t operator()(uint8x8x4_t src, const uint8x8x4_t &dst) const {
+		src.val[0] = vdup_n_u8(255);
+		return src;
+	}
+};
+
+struct BinaryOp {
+	uint8x8x4_t operator()(const uint8x8x4_t &src, const uint8x8x4_t &dst) const {
+		uint8x8x4_t res = src;
+		res.val[0] = vdup_n_u8(255);
+		return keepTransparent(src, dst, res);
+	}
+};
+
+struct AlphaBlendOp {
+	uint8x8x4_t operator()(const uint8x8x4_t &src, const uint8x8x4_t &dst) const {
+		const uint8x8_t alpha = src.val[0];
+		const uint8x8_t invAlpha = vmvn_u8(alpha);
+
+		uint8x8x4_t res;
+		res.val[0] = vdup_n_u8(255);
+		for (int c = 1; c < 4; ++c)
+			res.val[c] = vshrn_n_u16(vmlal_u8(vmull_u8(src.val[c], alpha), dst.val[c], invAlpha), 8);
+		return keepTransparent(src, dst, res);
+	}
+};
+
+struct ColorAlphaBlendOp {
+	uint8x8_t _ca;
+	uint16x8_t _cmod[4];
+
+	ColorAlphaBlendOp(uint32 color) {
+		_ca = vdup_n_u8((color >> kAModShift) & 0xFF);
+		_cmod[0] = vdupq_n_u16(0);
+		_cmod[1] = vdupq_n_u16((color >> kBModShift) & 0xFF);
+		_cmod[2] = vdupq_n_u16((color >> kGModShift) & 0xFF);
+		_cmod[3] = vdupq_n_u16((color >> kRModShift) & 0xFF);
+	}
+
+	uint8x8x4_t operator()(const uint8x8x4_t &src, const uint8x8x4_t &dst) const {
+		const uint8x8_t alpha = vshrn_n_u16(vmull_u8(src.val[0], _ca), 8);
+		const uint8x8_t invAlpha = vmvn_u8(alpha);
+
+		uint8x8x4_t res;
+		res.val[0] = vdup_n_u8(255);
+		for (int c = 1; c < 4; ++c) {
+			const uint8x8_t scaledDst = vshrn_n_u16(vmull_u8(dst.val[c], invAlpha), 8);
+			const uint8x8_t scaledSrc = vmovn_u16(mulHi(vmull_u8(src.val[c], alpha), _cmod[c]));
+			res.val[c] = vadd_u8(scaledDst, scaledSrc);
+		}
+		return res;
+	}
+};
+
+struct AdditiveBlendOp {
+	uint8x8x4_t operator()(const uint8x8x4_t &src, const uint8x8x4_t &dst) const {
+		uint8x8x4_t res;
+		res.val[0] = dst.val[0];
+		for (int c = 1; c < 4; ++c)
+			res.val[c] = vqadd_u8(vshrn_n_u16(vmull_u8(src.val[c], src.val[0]), 8), dst.val[c]);
+		return res;
+	}
+};
+
+struct SubtractiveBlendOp {
+	uint8x8x4_t operator()(const uint8x8x4_t &src, const uint8x8x4_t &dst) const {
+		const uint16x8_t alpha = vmovl_u8(src.val[0]);
+
+		uint8x8x4_t res;
+		res.val[0] = dst.val[0];
+		for (int c = 1; c < 4; ++c)
+			res.val[c] = vsub_u8(dst.val[c], vmovn_u16(mulHi(vmull_u8(src.val[c], dst.val[c]), alpha)));
+		return res;
+	}
+};
+
+struct MultiplyBlendOp {
+	uint8x8x4_t operator()(const uint8x8x4_t &src, const uint8x8x4_t &dst) const {
+		uint8x8x4_t res;
+		res.val[0] = dst.val[0];
+		for (int c = 1; c < 4; ++c) {
+			const uint8x8_t scaled = vshrn_n_u16(vmull_u8(src.val[c], src.val[0]), 8);
+			res.val[c] = vshrn_n_u16(vmull_u8(scaled, dst.val[c]), 8);
+		}
+		return keepTransparent(src, dst, res);
+	}
+};
+
+/**
+ * Blend as many pixels of a row as possible with the given operation.
+ * @return the number of pixels blended
+ */
+template<class Op>
+uint32 blitRowSIMD(const byte *in, byte *out, uint32 width, int32 inStep, const Op &op) {
+	if (inStep != 4 && inStep != -4)
+		return 0;
+
+	uint32 j;
+	for (j = 0; j + 8 <= width; j += 8) {
+		uint8x8x4_t src;
+		if (inStep > 0) {
+			src = vld4_u8(in + j * 4);
+		} else {
+			// Horizontally flipped, load the pixels and reverse them
+			src = vld4_u8(in - j * 4 - 28);
+			for (int c = 0; c < 4; ++c)
+				src.val[c] = vrev64_u8(src.val[c]);
+		}
+
+		vst4_u8(out + j * 4, op(src, vld4_u8(out + j * 4)));
+	}
+
+	return j;
+}
+
+#else
+
+// Without vector code, the scalar loops handle all pixels
+struct OpaqueOp {};
+struct BinaryOp {};
+struct AlphaBlendOp {};
+struct ColorAlphaBlendOp { ColorAlphaBlendOp(uint32 color) {} };
+struct AdditiveBlendOp {};
+struct SubtractiveBlendOp {};
+struct MultiplyBlendOp {};
+
+template<class Op>
+inline uint32 blitRowSIMD(const byte *in, byte *out, uint32 width, int32 inStep, const Op &op) {
+	return 0;
+}
+
+#endif
+
+} // End of anonymous namespace
+
 void doBlitOpaqueFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep);
 void doBlitBinaryFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep);
 void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color);
@@ -92,8 +399,9 @@ void doBlitOpaqueFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 	for (uint32 i = 0; i < height; i++) {
 		out = outo;
 		in = ino;
-		memcpy(out, in, width * 4);
-		for (uint32 j = 0; j < width; j++) {
+		uint32 j = blitRowSIMD(in, out, width, 4, OpaqueOp());
+		memcpy(out + j * 4, in + j * 4, (width - j) * 4);
+		for (out += j * 4; j < width; j++) {
 			out[kAIndex] = 0xFF;
 			out += 4;
 		}
@@ -113,7 +421,10 @@ void doBlitBinaryFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 	for (uint32 i = 0; i < height; i++) {
 		out = outo;
 		in = ino;
-		for (uint32 j = 0; j < width; j++) {
+		uint32 j = blitRowSIMD(in, out, width, inStep, BinaryOp());
+		in += (int32)j * inStep;
+		out += j * 4;
+		for (; j < width; j++) {
 			uint32 pix = *(uint32 *)in;
 			int a = in[kAIndex];
 
@@ -149,7 +460,10 @@ void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = blitRowSIMD(in, out, width, inStep, AlphaBlendOp());
+			in += (int32)j * inStep;
+			out += j * 4;
+			for (; j < width; j++) {
 
 				if (in[kAIndex] != 0) {
 					out[kAIndex] = 255;
@@ -170,11 +484,15 @@ void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 		byte cr = (color >> kRModShift) & 0xFF;
 		byte cg = (color >> kGModShift) & 0xFF;
 		byte cb = (color >> kBModShift) & 0xFF;
+		const ColorAlphaBlendOp colorOp(color);
 
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = blitRowSIMD(in, out, width, inStep, colorOp);
+			in += (int32)j * inStep;
+			out += j * 4;
+			for (; j < width; j++) {
 
 				uint32 ina = in[kAIndex] * ca >> 8;
 				out[kAIndex] = 255;
@@ -207,7 +525,10 @@ void doBlitAdditiveBlend(byte *ino, byte *outo, uint32 width, uint32 height, uin
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = blitRowSIMD(in, out, width, inStep, AdditiveBlendOp());
+			in += (int32)j * inStep;
+			out += j * 4;
+			for (; j < width; j++) {
 
 				if (in[kAIndex] != 0) {
 					out[kRIndex] = MIN((in[kRIndex] * in[kAIndex] >> 8) + out[kRIndex], 255);
@@ -274,7 +595,10 @@ void doBlitSubtractiveBlend(byte *ino, byte *outo, uint32 width, uint32 height,
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = blitRowSIMD(in, out, width, inStep, SubtractiveBlendOp());
+			in += (int32)j * inStep;
+			out += j * 4;
+			for (; j < width; j++) {
 
 				if (in[kAIndex] != 0) {
 					out[kRIndex] = MAX(out[kRIndex] - ((in[kRIndex] * out[kRIndex]) * in[kAIndex] >> 16), 0);
@@ -338,7 +662,10 @@ void doBlitMultiplyBlend(byte *ino, byte *outo, uint32 width, uint32 height, uin
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = blitRowSIMD(in, out, width, inStep, MultiplyBlendOp());
+			in += (int32)j * inStep;
+			out += j * 4;
+			for (; j < width; j++) {
 
 				if (in[kAIndex] != 0) {
 					out[kRIndex] = MIN((in[kRIndex] * in[kAIndex] >> 8) * out[kRIndex] >> 8, 255);
@@ -83,9 +83,21 @@
 // BASIS, AND BROWN UNIVERSITY HAS NO OBLIGATION TO PROVIDE MAINTENANCE,
 // SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 
+#include "common/jobs.h"
 #include "graphics/surface.h"
 #include "graphics/yuv_to_rgb.h"
 
+// Where SSE2 or NEON are available, whole rows are converted eight pixels
+// at a time with fixed-point arithmetic instead of the lookup tables. The
+// results are identical to the table based code.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define YUV_TO_RGB_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define YUV_TO_RGB_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace Common {
 DECLARE_SINGLETON(Graphics::YUVToRGBManager);
 }
@@ -197,7 +209,7 @@ const YUVToRGBLookup *YUVToRGBManager::getLookup(Graphics::PixelFormat format, Y
 	*((PixelInt *)(d)) = (L[cr_r] | L[crb_g] | L[cb_b])
 
 template<typename PixelInt>
-void convertYUV444ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+void convertYUV444ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
 	// Keep the tables in pointers here to avoid a dereference on each pixel
 	const int16 *Cr_r_tab = colorTab;
 	const int16 *Cr_g_tab = Cr_r_tab + 256;
@@ -227,23 +239,8 @@ void convertYUV444ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 	}
 }
 
-void YUVToRGBManager::convert444(Graphics::Surface *dst, YUVToRGBManager::LuminanceScale scale, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
-	// Sanity checks
-	assert(dst && dst->getPixels());
-	assert(dst->format.bytesPerPixel == 2 || dst->format.bytesPerPixel == 4);
-	assert(ySrc && uSrc && vSrc);
-
-	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
-
-	// Use a templated function to avoid an if check on every pixel
-	if (dst->format.bytesPerPixel == 2)
-		convertYUV444ToRGB<uint16>((byte *)dst->getPixels(), dst->pitch, lookup, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
-	else
-		convertYUV444ToRGB<uint32>((byte *)dst->getPixels(), dst->pitch, lookup, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
-}
-
 template<typename PixelInt>
-void convertYUV420ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+void convertYUV420ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
 	int halfHeight = yHeight >> 1;
 	int halfWidth = yWidth >> 1;
 
@@ -281,23 +278,6 @@ void convertYUV420ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 	}
 }
 
-void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::LuminanceScale scale, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
-	// Sanity checks
-	assert(dst && dst->getPixels());
-	assert(dst->format.bytesPerPixel == 2 || dst->format.bytesPerPixel == 4);
-	assert(ySrc && uSrc && vSrc);
-	assert((yWidth & 1) == 0);
-	assert((yHeight & 1) == 0);
-
-	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
-
-	// Use a templated function to avoid an if check on every pixel
-	if (dst->format.bytesPerPixel == 2)
-		convertYUV420ToRGB<uint16>((byte *)dst->getPixels(), dst->pitch, lookup, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
-	else
-		convertYUV420ToRGB<uint32>((byte *)dst->getPixels(), dst->pitch, lookup, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
-}
-
 #define READ_QUAD(ptr, prefix) \
 	byte prefix##A = ptr[index]; \
 	byte prefix##B = ptr[index + 1]; \
@@ -323,7 +303,7 @@ void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::Lumina
 	xDiff++
 
 template<typename PixelInt>
-void convertYUV410ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+void convertYUV410ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
 	// Keep the tables in pointers here to avoid a dereference on each pixel
 	const int16 *Cr_r_tab = colorTab;
 	const int16 *Cr_g_tab = Cr_r_tab + 256;
@@ -366,6 +346,310 @@ void convertYUV410ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 #undef DO_INTERPOLATION
 #undef DO_YUV410_PIXEL
 
+#if defined(YUV_TO_RGB_USE_SSE2) || defined(YUV_TO_RGB_USE_NEON)
+
+namespace {
+
+/**
+ * Converts rows of luma values and per pixel chroma offsets to RGB, eight
+ * pixels at a time. The chroma offsets are the values the color tables
+ * would add to the luma value, without the table offsets.
+ *
+ * Clamping and the ITU luminance scaling are done with integer arithmetic:
+ * for x in [0, 219], x * 255 / 219 == (x * 76310) >> 16 exactly.
+ */
+class YUVToRGBRow {
+public:
+	explicit YUVToRGBRow(const YUVToRGBLookup *lookup) : _rgbToPix(lookup->getRGBToPix()) {
+		const Graphics::PixelFormat format = lookup->getFormat();
+		_itu = lookup->getScale() == YUVToRGBManager::kScaleITU;
+		_alpha = (0xFF >> format.aLoss) << format.aShift;
+		_loss[0] = format.rLoss;
+		_loss[1] = format.gLoss;
+		_loss[2] = format.bLoss;
+		_shift[0] = format.rShift;
+		_shift[1] = format.gShift;
+		_shift[2] = format.bShift;
+	}
+
+	template<typename PixelInt>
+	void convert(PixelInt *dst, const byte *ySrc, const int16 *rOff, const int16 *gOff, const int16 *bOff, int width) const {
+		int x = 0;
+		for (; x + 8 <= width; x += 8)
+			convert8(dst + x, ySrc + x, rOff + x, gOff + x, bOff + x);
+
+		// Use the tables for the rest
+		for (; x < width; x++) {
+			const uint32 *L = &_rgbToPix[ySrc[x] + 256];
+			dst[x] = L[rOff[x]] | L[768 + gOff[x]] | L[2 * 768 + bOff[x]];
+		}
+	}
+
+private:
+	const uint32 *_rgbToPix;
+	bool _itu;
+	uint32 _alpha;
+	int _loss[3];
+	int _shift[3];
+
+#if defined(YUV_TO_RGB_USE_SSE2)
+	inline __m128i clampChannel(__m128i v) const {
+		if (_itu) {
+			v = _mm_sub_epi16(_mm_min_epi16(_mm_max_epi16(v, _mm_set1_epi16(16)), _mm_set1_epi16(235)), _mm_set1_epi16(16));
+			return _mm_add_epi16(v, _mm_mulhi_epu16(v, _mm_set1_epi16(76310 - 65536)));
+		}
+
+		return _mm_min_epi16(_mm_max_epi16(v, _mm_setzero_si128()), _mm_set1_epi16(255));
+	}
+
+	inline void convert8(uint16 *dst, const byte *ySrc, const int16 *rOff, const int16 *gOff, const int16 *bOff) const {
+		__m128i channels[3];
+		loadChannels(channels, ySrc, rOff, gOff, bOff);
+
+		__m128i pixels = _mm_set1_epi16(_alpha);
+		for (int i = 0; i < 3; i++)
+			pixels = _mm_or_si128(pixels, _mm_sll_epi16(_mm_srl_epi16(channels[i], _mm_cvtsi32_si128(_loss[i])), _mm_cvtsi32_si128(_shift[i])));
+		_mm_storeu_si128((__m128i *)dst, pixels);
+	}
+
+	inline void convert8(uint32 *dst, const byte *ySrc, const int16 *rOff, const int16 *gOff, const int16 *bOff) const {
+		__m128i channels[3];
+		loadChannels(channels, ySrc, rOff, gOff, bOff);
+
+		const __m128i zero = _mm_setzero_si128();
+		__m128i lo = _mm_set1_epi32(_alpha);
+		__m128i hi = lo;
+		for (int i = 0; i < 3; i++) {
+			const __m128i v = _mm_srl_epi16(channels[i], _mm_cvtsi32_si128(_loss[i]));
+			const __m128i shift = _mm_cvtsi32_si128(_shift[i]);
+			lo = _mm_or_si128(lo, _mm_sll_epi32(_mm_unpacklo_epi16(v, zero), shift));
+			hi = _mm_or_si128(hi, _mm_sll_epi32(_mm_unpackhi_epi16(v, zero), shift));
+		}
+		_mm_storeu_si128((__m128i *)dst, lo);
+		_mm_storeu_si128((__m128i *)(dst + 4), hi);
+	}
+
+	inline void loadChannels(__m128i *channels, const byte *ySrc, const int16 *rOff, const int16 *gOff, const int16 *bOff) const {
+		const __m128i luma = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)ySrc), _mm_setzero_si128());
+		channels[0] = clampChannel(_mm_add_epi16(luma, _mm_loadu_si128((const __m128i *)rOff)));
+		channels[1] = clampChannel(_mm_add_epi16(luma, _mm_loadu_si128((const __m128i *)gOff)));
+		channels[2] = clampChannel(_mm_add_epi16(luma, _mm_loadu_si128((const __m128i *)bOff)));
+	}
+#else
+	inline uint16x8_t clampChannel(int16x8_t v) const {
+		if (_itu) {
+			const uint16x8_t x = vreinterpretq_u16_s16(vsubq_s16(vminq_s16(vmaxq_s16(v, vdupq_n_s16(16)), vdupq_n_s16(235)), vdupq_n_s16(16)));
+			const uint16x4_t factor = vdup_n_u16(76310 - 65536);
+			const uint16x8_t mulHi = vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(x), factor), 16),
+			                                      vshrn_n_u32(vmull_u16(vget_high_u16(x), factor), 16));
+			return vaddq_u16(x, mulHi);
+		}
+
+		return vreinterpretq_u16_s16(vminq_s16(vmaxq_s16(v, vdupq_n_s16(0)), vdupq_n_s16(255)));
+	}
+
+	inline void convert8(uint16 *dst, const byte *ySrc, const int16 *rOff, const int16 *gOff, const int16 *bOff) const {
+		uint16x8_t channels[3];
+		loadChannels(channels, ySrc, rOff, gOff, bOff);
+
+		uint16x8_t pixels = vdupq_n_u16(_alpha);
+		for (int i = 0; i < 3; i++)
+			pixels = vorrq_u16(pixels, vshlq_u16(vshlq_u16(channels[i], vdupq_n_s16(-_loss[i])), vdupq_n_s16(_shift[i])));
+		vst1q_u16(dst, pixels);
+	}
+
+	inline void convert8(uint32 *dst, const byte *ySrc, const int16 *rOff, const int16 *gOff, const int16 *bOff) const {
+		uint16x8_t channels[3];
+		loadChannels(channels, ySrc, rOff, gOff, bOff);
+
+		uint32x4_t lo = vdupq_n_u32(_alpha);
+		uint32x4_t hi = lo;
+		for (int i = 0; i < 3; i++) {
+			const uint16x8_t v = vshlq_u16(channels[i], vdupq_n_s16(-_loss[i]));
+			const int32x4_t shift = vdupq_n_s32(_shift[i]);
+			lo = vorrq_u32(lo, vshlq_u32(vmovl_u16(vget_low_u16(v)), shift));
+			hi = vorrq_u32(hi, vshlq_u32(vmovl_u16(vget_high_u16(v)), shift));
+		}
+		vst1q_u32(dst, lo);
+		vst1q_u32(dst + 4, hi);
+	}
+
+	inline void loadChannels(uint16x8_t *channels, const byte *ySrc, const int16 *rOff, const int16 *gOff, const int16 *bOff) const {
+		const int16x8_t luma = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ySrc)));
+		channels[0] = clampChannel(vaddq_s16(luma, vld1q_s16(rOff)));
+		channels[1] = clampChannel(vaddq_s16(luma, vld1q_s16(gOff)));
+		channels[2] = clampChannel(vaddq_s16(luma, vld1q_s16(bOff)));
+	}
+#endif
+};
+
+/** Look up the chroma offsets of a pixel, see YUVToRGBRow. */
+inline void getChromaOffsets(const int16 *colorTab, byte u, byte v, int16 &rOff, int16 &gOff, int16 &bOff) {
+	rOff = colorTab[v] - 256;
+	gOff = colorTab[256 + v] + colorTab[2 * 256 + u] - 768 - 256;
+	bOff = colorTab[3 * 256 + u] - 2 * 768 - 256;
+}
+
+template<typename PixelInt>
+void convertYUV444ToRGBRows(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	const YUVToRGBRow row(lookup);
+	int16 *offsets = new int16[yWidth * 3];
+	int16 *rOff = offsets, *gOff = offsets + yWidth, *bOff = offsets + yWidth * 2;
+
+	for (int h = 0; h < yHeight; h++) {
+		for (int w = 0; w < yWidth; w++)
+			getChromaOffsets(colorTab, uSrc[w], vSrc[w], rOff[w], gOff[w], bOff[w]);
+
+		row.convert<PixelInt>((PixelInt *)dstPtr, ySrc, rOff, gOff, bOff, yWidth);
+
+		dstPtr += dstPitch;
+		ySrc += yPitch;
+		uSrc += uvPitch;
+		vSrc += uvPitch;
+	}
+
+	delete[] offsets;
+}
+
+template<typename PixelInt>
+void convertYUV420ToRGBRows(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	const YUVToRGBRow row(lookup);
+	int16 *offsets = new int16[yWidth * 3];
+	int16 *rOff = offsets, *gOff = offsets + yWidth, *bOff = offsets + yWidth * 2;
+
+	for (int h = 0; h < yHeight; h += 2) {
+		// Every chroma sample covers two pixels of two rows
+		for (int w = 0; w < yWidth; w += 2) {
+			getChromaOffsets(colorTab, uSrc[w >> 1], vSrc[w >> 1], rOff[w], gOff[w], bOff[w]);
+			rOff[w + 1] = rOff[w];
+			gOff[w + 1] = gOff[w];
+			bOff[w + 1] = bOff[w];
+		}
+
+		row.convert<PixelInt>((PixelInt *)dstPtr, ySrc, rOff, gOff, bOff, yWidth);
+		row.convert<PixelInt>((PixelInt *)(dstPtr + dstPitch), ySrc + yPitch, rOff, gOff, bOff, yWidth);
+
+		dstPtr += dstPitch * 2;
+		ySrc += yPitch * 2;
+		uSrc += uvPitch;
+		vSrc += uvPitch;
+	}
+
+	delete[] offsets;
+}
+
+template<typename PixelInt>
+void convertYUV410ToRGBRows(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	const YUVToRGBRow row(lookup);
+	int16 *offsets = new int16[yWidth * 3];
+	int16 *rOff = offsets, *gOff = offsets + yWidth, *bOff = offsets + yWidth * 2;
+
+	for (int y = 0; y < yHeight; y++) {
+		// Bilinear interpolation of the chroma values, like convertYUV410ToRGB
+		const int yDiff = y & 3;
+		const byte *uRow = uSrc + (y >> 2) * uvPitch;
+		const byte *vRow = vSrc + (y >> 2) * uvPitch;
+
+		for (int w = 0; w < yWidth; w++) {
+			const int x = w >> 2;
+			const int xDiff = w & 3;
+			const byte u = (uRow[x] * (4 - xDiff) * (4 - yDiff) + uRow[x + 1] * xDiff * (4 - yDiff) +
+			                uRow[x + uvPitch] * yDiff * (4 - xDiff) + uRow[x + uvPitch + 1] * xDiff * yDiff) >> 4;
+			const byte v = (vRow[x] * (4 - xDiff) * (4 - yDiff) + vRow[x + 1] * xDiff * (4 - yDiff) +
+			                vRow[x + uvPitch] * yDiff * (4 - xDiff) + vRow[x + uvPitch + 1] * xDiff * yDiff) >> 4;
+			getChromaOffsets(colorTab, u, v, rOff[w], gOff[w], bOff[w]);
+		}
+
+		row.convert<PixelInt>((PixelInt *)dstPtr, ySrc, rOff, gOff, bOff, yWidth);
+
+		dstPtr += dstPitch;
+		ySrc += yPitch;
+	}
+
+	delete[] offsets;
+}
+
+} // End of anonymous namespace
+
+#define YUV_CONVERT(name) name##Rows
+#else
+#define YUV_CONVERT(name) name
+#endif
+
+namespace {
+
+/**
+ * A conversion split into horizontal bands, which are converted in
+ * parallel by the job system. Every band is a whole number of units of
+ * rowsPerUnit luma rows, each of which uses one row of the chroma planes.
+ */
+struct YUVToRGBBands {
+	typedef void (*ConvertProc)(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch);
+
+	ConvertProc proc;
+	int rowsPerUnit;
+	byte *dstPtr;
+	int dstPitch;
+	const YUVToRGBLookup *lookup;
+	const int16 *colorTab;
+	const byte *ySrc, *uSrc, *vSrc;
+	int yWidth, yPitch, uvPitch;
+};
+
+// Bands are kept large enough for the job overhead not to matter
+const int kYUVToRGBMinBandPixels = 32768;
+
+void convertYUVToRGBBand(void *param, uint begin, uint end) {
+	const YUVToRGBBands &bands = *(const YUVToRGBBands *)param;
+	const int row = begin * bands.rowsPerUnit;
+
+	bands.proc(bands.dstPtr + row * bands.dstPitch, bands.dstPitch, bands.lookup, bands.colorTab,
+	           bands.ySrc + row * bands.yPitch, bands.uSrc + begin * bands.uvPitch, bands.vSrc + begin * bands.uvPitch,
+	           bands.yWidth, (end - begin) * bands.rowsPerUnit, bands.yPitch, bands.uvPitch);
+}
+
+void convertYUVToRGB(YUVToRGBBands &bands, int yHeight) {
+	const int units = yHeight / bands.rowsPerUnit;
+	const int unitPixels = MAX(bands.yWidth * bands.rowsPerUnit, 1);
+	const int grainSize = MAX(kYUVToRGBMinBandPixels / unitPixels, 1);
+
+	Common::JobSystem::instance().parallelFor(0, units, grainSize, convertYUVToRGBBand, &bands);
+}
+
+} // End of anonymous namespace
+
+void YUVToRGBManager::convert444(Graphics::Surface *dst, YUVToRGBManager::LuminanceScale scale, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	// Sanity checks
+	assert(dst && dst->getPixels());
+	assert(dst->format.bytesPerPixel == 2 || dst->format.bytesPerPixel == 4);
+	assert(ySrc && uSrc && vSrc);
+
+	YUVToRGBBands bands = {
+		// Use a templated function to avoid an if check on every pixel
+		dst->format.bytesPerPixel == 2 ? YUV_CONVERT(convertYUV444ToRGB)<uint16> : YUV_CONVERT(convertYUV444ToRGB)<uint32>,
+		1, (byte *)dst->getPixels(), dst->pitch, getLookup(dst->format, scale), _colorTab,
+		ySrc, uSrc, vSrc, yWidth, yPitch, uvPitch
+	};
+	convertYUVToRGB(bands, yHeight);
+}
+
+void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::LuminanceScale scale, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	// Sanity checks
+	assert(dst && dst->getPixels());
+	assert(dst->format.bytesPerPixel == 2 || dst->format.bytesPerPixel == 4);
+	assert(ySrc && uSrc && vSrc);
+	assert((yWidth & 1) == 0);
+	assert((yHeight & 1) == 0);
+
+	YUVToRGBBands bands = {
+		// Use a templated function to avoid an if check on every pixel
+		dst->format.bytesPerPixel == 2 ? YUV_CONVERT(convertYUV420ToRGB)<uint16> : YUV_CONVERT(convertYUV420ToRGB)<uint32>,
+		2, (byte *)dst->getPixels(), dst->pitch, getLookup(dst->format, scale), _colorTab,
+		ySrc, uSrc, vSrc, yWidth, yPitch, uvPitch
+	};
+	convertYUVToRGB(bands, yHeight);
+}
+
 void YUVToRGBManager::convert410(Graphics::Surface *dst, YUVToRGBManager::LuminanceScale scale, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
 	// Sanity checks
 	assert(dst && dst->getPixels());
@@ -374,13 +658,15 @@ void YUVToRGBManager::convert410(Graphics::Surface *dst, YUVToRGBManager::Lumina
 	assert((yWidth & 3) == 0);
 	assert((yHeight & 3) == 0);
 
-	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
-
-	// Use a templated function to avoid an if check on every pixel
-	if (dst->format.bytesPerPixel == 2)
-		convertYUV410ToRGB<uint16>((byte *)dst->getPixels(), dst->pitch, lookup, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
-	else
-		convertYUV410ToRGB<uint32>((byte *)dst->getPixels(), dst->pitch, lookup, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+	YUVToRGBBands bands = {
+		// Use a templated function to avoid an if check on every pixel
+		dst->format.bytesPerPixel == 2 ? YUV_CONVERT(convertYUV410ToRGB)<uint16> : YUV_CONVERT(convertYUV410ToRGB)<uint32>,
+		4, (byte *)dst->getPixels(), dst->pitch, getLookup(dst->format, scale), _colorTab,
+		ySrc, uSrc, vSrc, yWidth, yPitch, uvPitch
+	};
+	convertYUVToRGB(bands, yHeight);
 }
 
+#undef YUV_CONVERT
+
 } // End of namespace Graphics
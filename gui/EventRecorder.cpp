@@ -32,6 +32,7 @@ DECLARE_SINGLETON(GUI::EventRecorder);
 #include "common/debug-channels.h"
 #include "backends/timer/sdl/sdl-timer.h"
 #include "backends/mixer/sdl/sdl-mixer.h"
+#include "common/algorithm.h"
 #include "common/config-manager.h"
 #include "common/md5.h"
 #include "gui/gui-manager.h"
@@ -76,6 +77,8 @@ EventRecorder::EventRecorder() {
 	_initialized = false;
 	_needRedraw = false;
 	_fastPlayback = false;
+	_lastFrameMicros = 0;
+	_benchmark = false;
 
 	_fakeTimer = 0;
 	_savedState = false;
@@ -103,6 +106,7 @@ void EventRecorder::deinit() {
 		return;
 	}
 	setFileHeader();
+	reportBenchmark();
 	_needRedraw = false;
 	_initialized = false;
 	_recordMode = kPassthrough;
@@ -153,6 +157,8 @@ void EventRecorder::processMillis(uint32 &millis, bool skipRecord) {
 			_nextEvent = _playbackFile->getNextEvent();
 			_timerManager->handler();
 		} else {
+			//the record ended, which is where benchmarks end too
+			reportBenchmark();
 			if (_nextEvent.type == Common::EVENT_RTL) {
 				error("playback:action=stopplayback");
 			} else {
@@ -261,7 +267,7 @@ Common::String EventRecorder::generateRecordFileName(const Common::String &targe
 }
 
 
-void EventRecorder::init(Common::String recordFileName, RecordMode mode) {
+void EventRecorder::init(Common::String recordFileName, RecordMode mode, bool benchmark) {
 	_fakeMixerManager = new NullSdlMixerManager();
 	_fakeMixerManager->init();
 	_fakeMixerManager->suspendAudio();
@@ -271,6 +277,13 @@ void EventRecorder::init(Common::String recordFileName, RecordMode mode) {
 	_lastScreenshotTime = 0;
 	_recordMode = mode;
 	_needcontinueGame = false;
+	_benchmark = benchmark && (mode == kRecorderPlayback);
+	_fastPlayback = _benchmark;
+	_frameTimes.clear();
+	_lastFrameMicros = 0;
+	if (_benchmark) {
+		ConfMan.setBool("disable_display", true, Common::ConfigManager::kTransientDomain);
+	}
 	if (ConfMan.hasKey("disable_display")) {
 		DebugMan.enableDebugChannel("EventRec");
 		gDebugLevel = 1;
@@ -557,6 +570,10 @@ Common::SaveFileManager *EventRecorder::getSaveManager(Common::SaveFileManager *
 }
 
 void EventRecorder::preDrawOverlayGui() {
+	if (_benchmark) {
+		//there's no display to draw the control panel on
+		return;
+	}
 	if ((_initialized) || (_needRedraw)) {
 		RecordMode oldMode = _recordMode;
 		_recordMode = kPassthrough;
@@ -573,6 +590,12 @@ void EventRecorder::preDrawOverlayGui() {
 }
 
 void EventRecorder::postDrawOverlayGui() {
+	if (_benchmark) {
+		if (_initialized) {
+			addFrameTime();
+		}
+		return;
+	}
     if ((_initialized) || (_needRedraw)) {
 		RecordMode oldMode = _recordMode;
 		_recordMode = kPassthrough;
@@ -595,6 +618,38 @@ Common::StringArray EventRecorder::listSaveFiles(const Common::String &pattern)
 	}
 }
 
+void EventRecorder::addFrameTime() {
+	uint64 micros = g_system->getMicros();
+	if (_lastFrameMicros != 0) {
+		_frameTimes.push_back((uint32)MIN<uint64>(micros - _lastFrameMicros, 0xFFFFFFFF));
+	}
+	_lastFrameMicros = micros;
+}
+
+void EventRecorder::reportBenchmark() {
+	if (!_benchmark) {
+		return;
+	}
+	_benchmark = false;
+	if (_frameTimes.empty()) {
+		debugC(1, kDebugLevelEventRec, "playback:action=benchmark frames=0");
+		return;
+	}
+
+	uint64 total = 0;
+	for (uint i = 0; i < _frameTimes.size(); ++i) {
+		total += _frameTimes[i];
+	}
+	Common::sort(_frameTimes.begin(), _frameTimes.end());
+	const uint count = _frameTimes.size();
+	debugC(1, kDebugLevelEventRec, "playback:action=benchmark frames=%u time=%u realtime=%u fps=%.2f "
+		"frametime:min=%u avg=%u median=%u p95=%u p99=%u max=%u",
+		count, _fakeTimer, (uint32)(total / 1000), total ? count * 1000000.0 / total : 0.0,
+		_frameTimes[0], (uint32)(total / count), _frameTimes[count / 2],
+		_frameTimes[count * 95 / 100], _frameTimes[count * 99 / 100], _frameTimes[count - 1]);
+	_frameTimes.clear();
+}
+
 void EventRecorder::setFileHeader() {
 	if (_recordMode != kRecorderRecord) {
 		return;
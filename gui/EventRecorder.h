@@ -78,7 +78,14 @@ public:
 		kRecorderPlaybackPause = 3	/**< kRecordetPlaybackPause, interal state when user pauses the playback */
 	};
 
-	void init(Common::String recordFileName, RecordMode mode);
+	/**
+	 * Start recording or playing back.
+	 *
+	 * @param benchmark In playback mode, play the record back without display
+	 *                  and as fast as possible, and report how long the frames
+	 *                  took to be drawn at the end.
+	 */
+	void init(Common::String recordFileName, RecordMode mode, bool benchmark = false);
 	void deinit();
 	bool processDelayMillis();
 	uint32 getRandomSeed(const Common::String &name);
@@ -222,6 +229,14 @@ private:
 	uint32 _screenshotPeriod;
 	Common::PlaybackFile *_playbackFile;
 
+	/** Real time between the screen updates in benchmark mode, in microseconds */
+	Common::Array<uint32> _frameTimes;
+	uint64 _lastFrameMicros;
+	bool _benchmark;
+
+	void addFrameTime();
+	void reportBenchmark();
+
 	void saveScreenShot();
 	void checkRecordedMD5();
 	void deleteTemporarySave();
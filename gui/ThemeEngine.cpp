@@ -24,6 +24,7 @@
 #include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/memstream.h"
 #include "common/unzip.h"
 #include "common/tokenizer.h"
 #include "common/translation.h"
@@ -91,6 +92,12 @@ struct WidgetDrawData {
 
 	DrawLayer _layer;
 
+	/** Whether the widget can be drawn from the widget cache */
+	bool _cacheable;
+
+	/** Space around the widget area rendered into the widget cache */
+	uint16 _cacheMargin;
+
 
 	/**
 	 * Calculates the background threshold offset of a given DrawData item.
@@ -100,8 +107,84 @@ struct WidgetDrawData {
 	 * value will be added when restoring the background of the widget.
 	 */
 	void calcBackgroundOffset();
+
+	/**
+	 * Calculates whether the DrawData item can be cached, and how much space
+	 * around it its draw steps may touch. Must be called after
+	 * calcBackgroundOffset.
+	 */
+	void calcCacheMargin();
+};
+
+/**
+ * A DrawData item rendered into offscreen surfaces. Since draw steps blend
+ * onto whatever is below them, the item is rendered onto black and onto
+ * white. Every channel of a pixel then depends linearly on the pixel below,
+ * ranging from its value on black to its value on white. Partially covered
+ * pixels may differ from directly drawn ones by rounding.
+ */
+struct WidgetCacheEntry {
+	Graphics::Surface onBlack;
+	Graphics::Surface onWhite;
+	Graphics::Surface coverage; ///< kCoverageNone, kCoverageFull or kCoveragePartial for every pixel
+	Common::Point offset;       ///< Position of the surfaces relative to the widget area
+	uint32 lastAccess;
+
+	enum {
+		kCoverageNone = 0,
+		kCoveragePartial = 1,
+		kCoverageFull = 2
+	};
+
+	uint32 getSize() const { return 2 * onBlack.pitch * onBlack.h + coverage.pitch * coverage.h; }
+
+	void free() {
+		onBlack.free();
+		onWhite.free();
+		coverage.free();
+	}
 };
 
+namespace {
+
+template<typename PixelType>
+void blitWidgetCacheEntry(Graphics::Surface &dst, const WidgetCacheEntry &entry, const Common::Rect &srcRect, const Common::Point &dstPos) {
+	const Graphics::PixelFormat &format = dst.format;
+
+	for (int y = 0; y < srcRect.height(); ++y) {
+		const PixelType *black = (const PixelType *)entry.onBlack.getBasePtr(srcRect.left, srcRect.top + y);
+		const PixelType *white = (const PixelType *)entry.onWhite.getBasePtr(srcRect.left, srcRect.top + y);
+		const byte *coverage = (const byte *)entry.coverage.getBasePtr(srcRect.left, srcRect.top + y);
+		PixelType *out = (PixelType *)dst.getBasePtr(dstPos.x, dstPos.y + y);
+
+		int x = 0;
+		while (x < srcRect.width()) {
+			// Copy fully covered runs at once
+			int run = x;
+			while (run < srcRect.width() && coverage[run] == WidgetCacheEntry::kCoverageFull)
+				++run;
+			if (run > x) {
+				memcpy(out + x, black + x, (run - x) * sizeof(PixelType));
+				x = run;
+				continue;
+			}
+
+			if (coverage[x] == WidgetCacheEntry::kCoveragePartial) {
+				byte bR, bG, bB, wR, wG, wB, dR, dG, dB;
+				format.colorToRGB(black[x], bR, bG, bB);
+				format.colorToRGB(white[x], wR, wG, wB);
+				format.colorToRGB(out[x], dR, dG, dB);
+				out[x] = format.RGBToColor(bR + ((wR - bR) * dR + 127) / 255,
+				                           bG + ((wG - bG) * dG + 127) / 255,
+				                           bB + ((wB - bB) * dB + 127) / 255);
+			}
+			++x;
+		}
+	}
+}
+
+} // End of anonymous namespace
+
 /**********************************************************
  *  Data definitions for theme engine elements
  *********************************************************/
@@ -169,11 +252,11 @@ static const DrawDataInfo kDrawDataDefaults[] = {
 /**********************************************************
  * ThemeEngine class
  *********************************************************/
-ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
-	_system(0), _vectorRenderer(0),
+ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode, CompiledFileMap *compiledFiles) :
+	_system(0), _vectorRenderer(0), _compiledFiles(compiledFiles),
 	_layerToDraw(kDrawLayerBackground), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
-	_font(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
-	_cursor(0) {
+	_font(0), _widgetCacheSize(0), _widgetCacheMaxSize(0), _widgetCacheAccess(0),
+	_initOk(false), _themeOk(false), _enabled(false), _themeFiles(), _cursor(0) {
 
 	_system = g_system;
 	_parser = new ThemeParser(this);
@@ -443,6 +526,11 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 	_vectorRenderer = Graphics::createRenderer(mode);
 	_vectorRenderer->setSurface(&_screen);
 
+	// Widgets rendered for the previous overlay may have a different
+	// format, and the cache size depends on the overlay size
+	clearWidgetCache();
+	_widgetCacheMaxSize = 2 * _screen.pitch * _screen.h;
+
 	// Since we reinitialized our screen surfaces we know nothing has been
 	// drawn so far. Sometimes we still end up with dirty screen bits in the
 	// list. Clearing it avoids invalid overlay writes when the backend
@@ -465,6 +553,27 @@ void WidgetDrawData::calcBackgroundOffset() {
 	_shadowOffset = maxShadow;
 }
 
+void WidgetDrawData::calcCacheMargin() {
+	_cacheable = !_steps.empty();
+
+	uint maxShadow = 0, maxPadding = 0;
+	for (Common::List<Graphics::DrawStep>::const_iterator step = _steps.begin();
+	        step != _steps.end(); ++step) {
+		// Filling the surface does not depend on the widget area at all
+		if (step->drawingCall == &Graphics::VectorRenderer::drawCallback_FILLSURFACE)
+			_cacheable = false;
+
+		maxShadow = MAX<uint>(maxShadow, step->shadow);
+		maxPadding = MAX<uint>(maxPadding, ABS(step->padding.left));
+		maxPadding = MAX<uint>(maxPadding, ABS(step->padding.top));
+		maxPadding = MAX<uint>(maxPadding, ABS(step->padding.right));
+		maxPadding = MAX<uint>(maxPadding, ABS(step->padding.bottom));
+	}
+
+	// Leave some room for antialiased edges
+	_cacheMargin = ThemeEngine::kDirtyRectangleThreshold + _backgroundOffset + maxShadow + maxPadding + 2;
+}
+
 void ThemeEngine::restoreBackground(Common::Rect r) {
 	if (_vectorRenderer->getActiveSurface() == &_backBuffer) {
 		// Only restore the background when drawing to the screen surface
@@ -675,6 +784,8 @@ bool ThemeEngine::addDrawData(const Common::String &data, bool cached) {
 	_widgets[id] = new WidgetDrawData;
 	_widgets[id]->_layer = kDrawDataDefaults[id].layer;
 	_widgets[id]->_textDataId = kTextDataNone;
+	_widgets[id]->_cacheable = false;
+	_widgets[id]->_cacheMargin = 0;
 
 	return true;
 }
@@ -705,11 +816,14 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 			warning("Missing data asset: '%s'", kDrawDataDefaults[i].name);
 		} else {
 			_widgets[i]->calcBackgroundOffset();
+			_widgets[i]->calcCacheMargin();
 		}
 	}
 }
 
 void ThemeEngine::unloadTheme() {
+	clearWidgetCache();
+
 	if (!_themeOk)
 		return;
 
@@ -740,6 +854,15 @@ bool ThemeEngine::loadDefaultXML() {
 	// into the "default.inc" file, which is ready to be included in the code.
 #ifndef DISABLE_GUI_BUILTIN_THEME
 #include "themes/default.inc"
+	bool result;
+	if (parseCompiledFile("builtin", result)) {
+		_themeName = "ScummVM Classic Theme (Builtin Version)";
+		_themeId = "builtin";
+		_themeFile.clear();
+
+		return result;
+	}
+
 	int xmllen = 0;
 
 	for (int i = 0; i < ARRAYSIZE(defaultXML); i++)
@@ -761,7 +884,7 @@ bool ThemeEngine::loadDefaultXML() {
 	_themeId = "builtin";
 	_themeFile.clear();
 
-	bool result = _parser->parse();
+	result = parseFile("builtin");
 	_parser->close();
 
 	free(tmpXML);
@@ -773,6 +896,31 @@ bool ThemeEngine::loadDefaultXML() {
 #endif
 }
 
+bool ThemeEngine::parseCompiledFile(const Common::String &name, bool &result) {
+	if (!_compiledFiles)
+		return false;
+
+	CompiledFileMap::const_iterator compiled = _compiledFiles->find(name);
+	if (compiled == _compiledFiles->end())
+		return false;
+
+	Common::MemoryReadStream stream(compiled->_value.begin(), compiled->_value.size());
+	result = _parser->parseCompiled(stream);
+	return true;
+}
+
+bool ThemeEngine::parseFile(const Common::String &name) {
+	if (!_compiledFiles)
+		return _parser->parse();
+
+	Common::MemoryWriteStreamDynamic compiled(DisposeAfterUse::YES);
+	if (!_parser->parse(compiled))
+		return false;
+
+	(*_compiledFiles)[name] = Common::Array<byte>(compiled.getData(), compiled.size());
+	return true;
+}
+
 bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 	assert(_parser);
 	assert(_themeArchive);
@@ -808,13 +956,25 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 	for (Common::ArchiveMemberList::iterator i = members.begin(); i != members.end(); ++i) {
 		assert((*i)->getName().hasSuffix(".stx"));
 
+		const Common::String name = _themeFile + '/' + (*i)->getName();
+
+		bool result;
+		if (parseCompiledFile(name, result)) {
+			if (!result) {
+				warning("Failed to parse STX file '%s'", (*i)->getDisplayName().c_str());
+				return false;
+			}
+
+			continue;
+		}
+
 		if (_parser->loadStream((*i)->createReadStream()) == false) {
 			warning("Failed to load STX file '%s'", (*i)->getDisplayName().c_str());
 			_parser->close();
 			return false;
 		}
 
-		if (_parser->parse() == false) {
+		if (parseFile(name) == false) {
 			warning("Failed to parse STX file '%s'", (*i)->getDisplayName().c_str());
 			_parser->close();
 			return false;
@@ -859,15 +1019,151 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 		restoreBackground(extendedRect);
 
 	if (drawData->_layer == _layerToDraw) {
-		Common::List<Graphics::DrawStep>::const_iterator step;
-		for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
-			_vectorRenderer->drawStepClip(area, _clip, *step, dynamic);
+		// Widgets reaching outside of the screen are drawn differently
+		// than they would be offscreen, so only cache whole ones
+		if (area != r || !drawCachedDD(type, area, dynamic)) {
+			Common::List<Graphics::DrawStep>::const_iterator step;
+			for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
+				_vectorRenderer->drawStepClip(area, _clip, *step, dynamic);
+			}
 		}
 
 		addDirtyRect(extendedRect);
 	}
 }
 
+bool ThemeEngine::drawCachedDD(DrawData type, const Common::Rect &area, uint32 dynamic) {
+	const WidgetDrawData *drawData = _widgets[type];
+	if (!drawData->_cacheable || area.isEmpty())
+		return false;
+
+	WidgetCacheKey key;
+	key.type = type;
+	key.width = area.width();
+	key.height = area.height();
+	key.dynamic = dynamic;
+	key.oddX = (area.left & 1) != 0;
+
+	WidgetCacheEntry *entry;
+	WidgetCache::iterator i = _widgetCache.find(key);
+	if (i != _widgetCache.end()) {
+		entry = i->_value;
+	} else {
+		// Keep the parity of x positions, which dithered gradients depend on
+		const int marginX = (drawData->_cacheMargin & ~1) + 2 + key.oddX;
+		const int marginY = drawData->_cacheMargin;
+		const int width = area.width() + marginX + drawData->_cacheMargin;
+		const int height = area.height() + 2 * marginY;
+		const uint32 size = width * height * (2 * _overlayFormat.bytesPerPixel + 1);
+
+		// Huge widgets would push everything else out of the cache
+		if (size > _widgetCacheMaxSize / 2)
+			return false;
+
+		while (_widgetCacheSize + size > _widgetCacheMaxSize) {
+			WidgetCache::iterator oldest = _widgetCache.begin();
+			for (WidgetCache::iterator it = _widgetCache.begin(); it != _widgetCache.end(); ++it) {
+				if (it->_value->lastAccess < oldest->_value->lastAccess)
+					oldest = it;
+			}
+
+			_widgetCacheSize -= oldest->_value->getSize();
+			oldest->_value->free();
+			delete oldest->_value;
+			_widgetCache.erase(oldest);
+		}
+
+		const Common::Rect localArea(marginX, marginY, marginX + area.width(), marginY + area.height());
+		const Common::Rect localClip(width, height);
+		Graphics::TransparentSurface *activeSurface = _vectorRenderer->getActiveSurface();
+
+		const uint32 black = _overlayFormat.RGBToColor(0, 0, 0);
+		const uint32 white = _overlayFormat.RGBToColor(255, 255, 255);
+
+		Graphics::TransparentSurface onBlack, onWhite;
+		onBlack.create(width, height, _overlayFormat);
+		onWhite.create(width, height, _overlayFormat);
+		onBlack.fillRect(localClip, black);
+		onWhite.fillRect(localClip, white);
+
+		Common::List<Graphics::DrawStep>::const_iterator step;
+		_vectorRenderer->setSurface(&onBlack);
+		for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step)
+			_vectorRenderer->drawStepClip(localArea, localClip, *step, dynamic);
+
+		_vectorRenderer->setSurface(&onWhite);
+		for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step)
+			_vectorRenderer->drawStepClip(localArea, localClip, *step, dynamic);
+
+		_vectorRenderer->setSurface(activeSurface);
+
+		entry = new WidgetCacheEntry();
+		entry->offset = Common::Point(-marginX, -marginY);
+		entry->coverage.create(width, height, Graphics::PixelFormat::createFormatCLUT8());
+
+		for (int y = 0; y < height; ++y) {
+			byte *coverage = (byte *)entry->coverage.getBasePtr(0, y);
+			for (int x = 0; x < width; ++x) {
+				uint32 colorOnBlack, colorOnWhite;
+				if (_overlayFormat.bytesPerPixel == 2) {
+					colorOnBlack = *(const uint16 *)onBlack.getBasePtr(x, y);
+					colorOnWhite = *(const uint16 *)onWhite.getBasePtr(x, y);
+				} else {
+					colorOnBlack = *(const uint32 *)onBlack.getBasePtr(x, y);
+					colorOnWhite = *(const uint32 *)onWhite.getBasePtr(x, y);
+				}
+
+				if (colorOnBlack == colorOnWhite)
+					coverage[x] = WidgetCacheEntry::kCoverageFull;
+				else if (colorOnBlack == black && colorOnWhite == white)
+					coverage[x] = WidgetCacheEntry::kCoverageNone;
+				else
+					coverage[x] = WidgetCacheEntry::kCoveragePartial;
+			}
+		}
+
+		// The cache takes over the rendered surfaces
+		entry->onBlack = onBlack;
+		entry->onWhite = onWhite;
+
+		_widgetCache[key] = entry;
+		_widgetCacheSize += entry->getSize();
+	}
+
+	entry->lastAccess = _widgetCacheAccess++;
+
+	Graphics::TransparentSurface *dst = _vectorRenderer->getActiveSurface();
+	Common::Rect dstRect(entry->onBlack.w, entry->onBlack.h);
+	dstRect.translate(area.left + entry->offset.x, area.top + entry->offset.y);
+
+	Common::Rect clipped = dstRect;
+	clipped.clip(Common::Rect(dst->w, dst->h));
+	if (!_clip.isEmpty())
+		clipped.clip(_clip);
+	if (clipped.isEmpty())
+		return true;
+
+	Common::Rect srcRect = clipped;
+	srcRect.translate(-dstRect.left, -dstRect.top);
+
+	if (dst->format.bytesPerPixel == 2)
+		blitWidgetCacheEntry<uint16>(*dst, *entry, srcRect, Common::Point(clipped.left, clipped.top));
+	else
+		blitWidgetCacheEntry<uint32>(*dst, *entry, srcRect, Common::Point(clipped.left, clipped.top));
+
+	return true;
+}
+
+void ThemeEngine::clearWidgetCache() {
+	for (WidgetCache::iterator i = _widgetCache.begin(); i != _widgetCache.end(); ++i) {
+		i->_value->free();
+		delete i->_value;
+	}
+
+	_widgetCache.clear();
+	_widgetCacheSize = 0;
+}
+
 void ThemeEngine::drawDDText(TextData type, TextColor color, const Common::Rect &r, const Common::String &text,
                              bool restoreBg, bool ellipsis, Graphics::TextAlign alignH, TextAlignVertical alignV,
                              int deltax, const Common::Rect &drawableTextArea) {
@@ -24,6 +24,7 @@
 #define GUI_THEME_ENGINE_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 #include "common/fs.h"
 #include "common/hash-str.h"
 #include "common/hashmap.h"
@@ -37,7 +38,7 @@
 #include "graphics/pixelformat.h"
 
 
-#define SCUMMVM_THEME_VERSION_STR "SCUMMVM_STX0.8.23"
+#define SCUMMVM_THEME_VERSION_STR "SCUMMVM_STX0.8.25"
 
 class OSystem;
 
@@ -49,6 +50,7 @@ class VectorRenderer;
 namespace GUI {
 
 struct WidgetDrawData;
+struct WidgetCacheEntry;
 struct TextDrawData;
 struct TextColorData;
 class Dialog;
@@ -295,8 +297,15 @@ public:
 	static GraphicsMode findMode(const Common::String &cfg);
 	static const char *findModeConfigName(GraphicsMode mode);
 
+	/**
+	 * The compiled forms of parsed theme files by their names, see
+	 * Common::XMLParser::parseCompiled(). Loading a theme again, e.g. after
+	 * the screen resolution changed, parses these instead of the XML.
+	 */
+	typedef Common::HashMap<Common::String, Common::Array<byte> > CompiledFileMap;
+
 	/** Default constructor */
-	ThemeEngine(Common::String id, GraphicsMode mode);
+	ThemeEngine(Common::String id, GraphicsMode mode, CompiledFileMap *compiledFiles = 0);
 
 	/** Default destructor */
 	~ThemeEngine();
@@ -603,6 +612,20 @@ protected:
 	 */
 	bool loadDefaultXML();
 
+	/**
+	 * Parses the compiled form of a theme file, if it was parsed before.
+	 *
+	 * @param name   the name the file was parsed by
+	 * @param result set to whether parsing succeeded
+	 * @returns true if the compiled form was found
+	 */
+	bool parseCompiledFile(const Common::String &name, bool &result);
+
+	/**
+	 * Parses the file loaded into the parser, and keeps its compiled form.
+	 */
+	bool parseFile(const Common::String &name);
+
 	/**
 	 * Unloads the currently loaded theme so another one can
 	 * be loaded.
@@ -629,6 +652,13 @@ protected:
 	 * These functions are called from all the Widget drawing methods.
 	 */
 	void drawDD(DrawData type, const Common::Rect &r, uint32 dynamic = 0, bool forceRestore = false);
+
+	/**
+	 * Draws a DrawData set from the widget cache, rendering and caching it
+	 * first if necessary. Returns false if the set can not be cached.
+	 */
+	bool drawCachedDD(DrawData type, const Common::Rect &area, uint32 dynamic);
+	void clearWidgetCache();
 	void drawDDText(TextData type, TextColor color, const Common::Rect &r, const Common::String &text, bool restoreBg,
 	                bool elipsis, Graphics::TextAlign alignH = Graphics::kTextAlignLeft,
 	                TextAlignVertical alignV = kTextAlignVTop, int deltax = 0,
@@ -670,6 +700,9 @@ protected:
 	/** XML Parser, does the Theme parsing instead of the default parser */
 	GUI::ThemeParser *_parser;
 
+	/** Shared by all themes, may be 0 */
+	CompiledFileMap *_compiledFiles;
+
 	/** Theme getEvaluator (changed from GUI::Eval to add functionality) */
 	GUI::ThemeEval *_themeEval;
 
@@ -702,6 +735,36 @@ protected:
 	 */
 	WidgetDrawData *_widgets[kDrawDataMAX];
 
+	/**
+	 * Rendered DrawData sets, keyed by their id, size and dynamic value.
+	 * Widgets that are redrawn in the same state and size are blitted
+	 * from here instead of being rasterized again. The cache is dropped
+	 * when the theme or the overlay changes.
+	 */
+	struct WidgetCacheKey {
+		DrawData type;
+		int16 width, height;
+		uint32 dynamic;
+		bool oddX; ///< Dithered gradients depend on the parity of the x position
+
+		bool operator==(const WidgetCacheKey &other) const {
+			return type == other.type && width == other.width && height == other.height &&
+			       dynamic == other.dynamic && oddX == other.oddX;
+		}
+	};
+
+	struct WidgetCacheKeyHash {
+		uint operator()(const WidgetCacheKey &key) const {
+			return (uint)key.type ^ ((uint)key.width << 8) ^ ((uint)key.height << 20) ^ (key.dynamic * 31) ^ (uint)key.oddX;
+		}
+	};
+
+	typedef Common::HashMap<WidgetCacheKey, WidgetCacheEntry *, WidgetCacheKeyHash> WidgetCache;
+	WidgetCache _widgetCache;
+	uint32 _widgetCacheSize;
+	uint32 _widgetCacheMaxSize;
+	uint32 _widgetCacheAccess;
+
 	/** Array of all the text fonts that can be drawn. */
 	TextDrawData *_texts[kTextDataMAX];
 
@@ -23,19 +23,23 @@
 // NB: This is really only necessary if USE_READLINE is defined
 #define FORBIDDEN_SYMBOL_ALLOW_ALL
 
+#include "common/archive.h"
 #include "common/debug.h"
 #include "common/debug-channels.h"
+#include "common/file.h"
+#include "common/profiler.h"
 #include "common/system.h"
 
 #ifndef DISABLE_MD5
 #include "common/md5.h"
-#include "common/archive.h"
 #include "common/macresman.h"
 #include "common/stream.h"
 #endif
 
 #include "engines/engine.h"
 
+#include "audio/mixer.h"
+
 #include "gui/debugger.h"
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 	#include "gui/console.h"
@@ -78,6 +82,11 @@ Debugger::Debugger() {
 	registerCmd("debugflag_list",		WRAP_METHOD(Debugger, cmdDebugFlagsList));
 	registerCmd("debugflag_enable",	WRAP_METHOD(Debugger, cmdDebugFlagEnable));
 	registerCmd("debugflag_disable",	WRAP_METHOD(Debugger, cmdDebugFlagDisable));
+
+	registerCmd("searchcache",		WRAP_METHOD(Debugger, cmdSearchCache));
+	registerCmd("mixer_stats",		WRAP_METHOD(Debugger, cmdMixerStats));
+	registerCmd("profiler",			WRAP_METHOD(Debugger, cmdProfiler));
+	registerCmd("perf",			WRAP_METHOD(Debugger, cmdPerf));
 }
 
 Debugger::~Debugger() {
@@ -731,6 +740,176 @@ bool Debugger::cmdDebugLevel(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdSearchCache(int argc, const char **argv) {
+	if (argc == 2 && !strcmp(argv[1], "flush")) {
+		SearchMan.invalidateCache();
+		debugPrintf("Lookup cache flushed\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Usage: %s [flush]\n", argv[0]);
+		return true;
+	}
+
+	const Common::SearchSet::CacheStats &stats = SearchMan.getCacheStats();
+	debugPrintf("File lookups: %u cached (%u of them for missing files), %u uncached\n",
+	            stats.hits, stats.negativeHits, stats.misses);
+	debugPrintf("Cache flushes: %u\n", stats.invalidations);
+	return true;
+}
+
+static void printMixerStatsEntry(Debugger *debugger, const Audio::MixerStats::Entry &entry) {
+	if (!entry.mixes)
+		return;
+
+	debugger->debugPrintf("  %-40s %7u mixes, %5u underruns, %6u us/mix (%u us reading, %u us resampling)\n",
+	                      entry.name.c_str(), entry.mixes, entry.underruns, (uint)(entry.totalMicros / entry.mixes),
+	                      (uint)(entry.readMicros / entry.mixes), (uint)((entry.totalMicros - entry.readMicros) / entry.mixes));
+}
+
+bool Debugger::cmdMixerStats(int argc, const char **argv) {
+	Audio::Mixer *mixer = g_system->getMixer();
+
+	if (argc == 2 && !strcmp(argv[1], "on")) {
+		mixer->setStatsEnabled(true);
+		debugPrintf("Mixer profiling enabled\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "off")) {
+		mixer->setStatsEnabled(false);
+		debugPrintf("Mixer profiling disabled\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "reset")) {
+		if (mixer->isStatsEnabled())
+			mixer->setStatsEnabled(true);
+		debugPrintf("Mixer counters reset\n");
+		return true;
+	} else if (argc != 1 && !(argc == 3 && !strcmp(argv[1], "csv"))) {
+		debugPrintf("Usage: %s [on | off | reset | csv <file>]\n", argv[0]);
+		return true;
+	}
+
+	if (!mixer->isStatsEnabled()) {
+		debugPrintf("Mixer profiling is disabled, enable it with '%s on'\n", argv[0]);
+		return true;
+	}
+
+	Audio::MixerStats stats;
+	mixer->getStats(stats);
+
+	if (argc == 3) {
+		Common::DumpFile file;
+		if (!file.open(argv[2])) {
+			debugPrintf("Could not open '%s' for writing\n", argv[2]);
+			return true;
+		}
+
+		stats.writeCSV(file);
+		file.finalize();
+		debugPrintf("Mixer counters written to '%s'\n", argv[2]);
+		return true;
+	}
+
+	debugPrintf("Callbacks: %u, %u of them took longer than the audio they produced\n", stats.callbacks, stats.overruns);
+	if (stats.callbacks && stats.audioMicros) {
+		debugPrintf("Callback time: %u us on average, %u us at most, %u.%u%% of the audio duration\n",
+		            (uint)(stats.callbackMicros / stats.callbacks), (uint)stats.maxCallbackMicros,
+		            (uint)(stats.callbackMicros * 100 / stats.audioMicros), (uint)(stats.callbackMicros * 1000 / stats.audioMicros % 10));
+	}
+
+	debugPrintf("Sound types:\n");
+	for (int i = 0; i < ARRAYSIZE(stats.soundTypes); ++i)
+		printMixerStatsEntry(this, stats.soundTypes[i]);
+
+	debugPrintf("Streams:\n");
+	for (uint i = 0; i < stats.streams.size(); ++i)
+		printMixerStatsEntry(this, stats.streams[i]);
+
+	return true;
+}
+
+bool Debugger::cmdProfiler(int argc, const char **argv) {
+	if (argc == 2 && !strcmp(argv[1], "on")) {
+		ProfilerMan.setEnabled(true);
+		debugPrintf("Profiler enabled\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "off")) {
+		ProfilerMan.setEnabled(false);
+		debugPrintf("Profiler disabled\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "osd")) {
+		ProfilerMan.setOverlayEnabled(!ProfilerMan.isOverlayEnabled());
+		debugPrintf("Profiler OSD %s\n", ProfilerMan.isOverlayEnabled() ? "shown" : "hidden");
+		return true;
+	} else if (argc != 1 && !(argc == 3 && !strcmp(argv[1], "trace"))) {
+		debugPrintf("Usage: %s [on | off | osd | trace <file>]\n", argv[0]);
+		return true;
+	}
+
+	if (!Common::Profiler::isActive()) {
+		debugPrintf("The profiler is disabled, enable it with '%s on'\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 3) {
+		Common::DumpFile file;
+		if (!file.open(argv[2])) {
+			debugPrintf("Could not open '%s' for writing\n", argv[2]);
+			return true;
+		}
+
+		ProfilerMan.writeTrace(file);
+		file.finalize();
+		debugPrintf("Trace written to '%s'\n", argv[2]);
+		return true;
+	}
+
+	const uint32 frameTime = ProfilerMan.getAverageFrameTime();
+	debugPrintf("Last %u frames: %u us on average, %u us at most\n", ProfilerMan.getFrameCount(), frameTime, ProfilerMan.getMaxFrameTime());
+	for (uint i = 0; i < ProfilerMan.getZoneCount(); ++i) {
+		const uint32 zoneTime = ProfilerMan.getAverageZoneTime(i);
+		debugPrintf("  %-20s %6u us per frame, %3u%%\n", ProfilerMan.getZoneName(i), zoneTime, frameTime ? (uint)((uint64)zoneTime * 100 / frameTime) : 0);
+	}
+
+	return true;
+}
+
+bool Debugger::cmdPerf(int argc, const char **argv) {
+	// Counters are only updated while the profiler is enabled
+	if (argc == 2 && !strcmp(argv[1], "on")) {
+		ProfilerMan.setEnabled(true);
+		debugPrintf("Performance counters enabled\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "off")) {
+		ProfilerMan.setEnabled(false);
+		debugPrintf("Performance counters disabled\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "reset")) {
+		ProfilerMan.resetCounters();
+		debugPrintf("Performance counters reset\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Usage: %s [on | off | reset]\n", argv[0]);
+		return true;
+	}
+
+	if (!Common::Profiler::isActive()) {
+		debugPrintf("The performance counters are disabled, enable them with '%s on'\n", argv[0]);
+		return true;
+	}
+
+	if (!ProfilerMan.getCounterCount()) {
+		debugPrintf("Nothing has been counted yet\n");
+		return true;
+	}
+
+	debugPrintf("  %-24s %10s %12s %14s\n", "Counter", "per frame", "per second", "total");
+	for (uint i = 0; i < ProfilerMan.getCounterCount(); ++i) {
+		debugPrintf("  %-24s %10u %12u %14llu\n", ProfilerMan.getCounterName(i), ProfilerMan.getAverageCount(i),
+		            (uint)ProfilerMan.getCountRate(i), (unsigned long long)ProfilerMan.getCounterTotal(i));
+	}
+
+	return true;
+}
+
 bool Debugger::cmdDebugFlagsList(int argc, const char **argv) {
 	const Common::DebugManager::DebugChannelList &debugLevels = DebugMan.listDebugChannels();
 
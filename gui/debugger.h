@@ -232,6 +232,10 @@ protected:
 	bool cmdDebugFlagsList(int argc, const char **argv);
 	bool cmdDebugFlagEnable(int argc, const char **argv);
 	bool cmdDebugFlagDisable(int argc, const char **argv);
+	bool cmdSearchCache(int argc, const char **argv);
+	bool cmdMixerStats(int argc, const char **argv);
+	bool cmdProfiler(int argc, const char **argv);
+	bool cmdPerf(int argc, const char **argv);
 
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 private:
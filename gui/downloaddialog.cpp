@@ -256,6 +256,9 @@ Common::String DownloadDialog::getSpeedLabelText() {
 	Common::String speed, speedUnits;
 	speed = getHumanReadableBytes(CloudMan.getDownloadSpeed(), speedUnits);
 	speedUnits += "/s";
+	uint32 transfers = CloudMan.getDownloadTransfersNumber();
+	if (transfers > 1)
+		return Common::String::format(_("Download speed: %s %s (%u files at once)"), speed.c_str(), _(speedUnits.c_str()), transfers);
 	return Common::String::format(_("Download speed: %s %s"), speed.c_str(), _(speedUnits.c_str()));
 }
 
@@ -30,6 +30,8 @@
 #include "common/translation.h"
 #include "common/debug.h"
 
+#include "audio/softsynth/fluidsynth.h"
+
 namespace GUI {
 
 enum {
@@ -146,6 +148,9 @@ FluidSynthSettingsDialog::FluidSynthSettingsDialog()
 	_miscInterpolationPopUp->appendEntry(_("Fourth-order"), kInterpolation4thOrder);
 	_miscInterpolationPopUp->appendEntry(_("Seventh-order"), kInterpolation7thOrder);
 
+	_miscSoundFontUsageDesc = new StaticTextWidget(_tabWidget, "FluidSynthSettings_Misc.SoundFontUsageText", _("Loaded soundfonts:"), _("Memory taken by the soundfonts currently in use, shared by all FluidSynth instances"));
+	_miscSoundFontUsageLabel = new StaticTextWidget(_tabWidget, "FluidSynthSettings_Misc.SoundFontUsage", "");
+
 	_tabWidget->setActiveTab(0);
 
 	new ButtonWidget(this, "FluidSynthSettings.ResetSettings", _("Reset"), _("Reset all FluidSynth settings to their default values."), kResetSettingsCmd);
@@ -164,6 +169,18 @@ void FluidSynthSettingsDialog::open() {
 	setResult(0);
 
 	readSettings();
+	updateSoundFontUsage();
+}
+
+void FluidSynthSettingsDialog::updateSoundFontUsage() {
+	uint count;
+	uint32 size;
+	FluidSynth_getSoundFontUsage(count, size);
+
+	if (count == 0)
+		_miscSoundFontUsageLabel->setLabel(_("None"));
+	else
+		_miscSoundFontUsageLabel->setLabel(Common::String::format(_("%u (%u MB)"), count, (size + 1024 * 1024 - 1) / (1024 * 1024)));
 }
 
 void FluidSynthSettingsDialog::close() {
@@ -52,6 +52,8 @@ protected:
 
 	void resetSettings();
 
+	void updateSoundFontUsage();
+
 private:
 	Common::String _domain;
 
@@ -98,6 +100,9 @@ private:
 
 	StaticTextWidget *_miscInterpolationPopUpDesc;
 	PopUpWidget *_miscInterpolationPopUp;
+
+	StaticTextWidget *_miscSoundFontUsageDesc;
+	StaticTextWidget *_miscSoundFontUsageLabel;
 };
 
 } // End of namespace GUI
@@ -21,6 +21,7 @@
  */
 
 #include "common/events.h"
+#include "common/profiler.h"
 #include "common/system.h"
 #include "common/util.h"
 #include "common/config-manager.h"
@@ -158,7 +159,7 @@ bool GuiManager::loadNewTheme(Common::String id, ThemeEngine::GraphicsMode gfx,
 		gfx = ThemeEngine::_defaultRendererMode;
 
 	// Try to load the new theme
-	newTheme = new ThemeEngine(id, gfx);
+	newTheme = new ThemeEngine(id, gfx, &_compiledThemeFiles);
 	assert(newTheme);
 
 	if (!newTheme->init())
@@ -206,6 +207,7 @@ bool GuiManager::loadNewTheme(Common::String id, ThemeEngine::GraphicsMode gfx,
 }
 
 void GuiManager::redraw() {
+	PROFILE_ZONE("gui");
 	ThemeEngine::ShadingStyle shading;
 
 	if (_dialogStack.empty())
@@ -382,10 +384,11 @@ void GuiManager::runLoop() {
 
 		redraw();
 
-		// Delay until the allocated frame time is elapsed to match the target frame rate
+		// Delay until the allocated frame time is elapsed to match the target frame rate.
+		// Input ends the delay early, so that it is handled in the next frame right away.
 		uint32 actualFrameDuration = _system->getMillis(true) - frameStartTime;
 		if (actualFrameDuration < targetFrameDuration) {
-			_system->delayMillis(targetFrameDuration - actualFrameDuration);
+			_system->waitForEvents(targetFrameDuration - actualFrameDuration);
 		}
 		_system->updateScreen();
 	}
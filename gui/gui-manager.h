@@ -122,6 +122,7 @@ protected:
 	OSystem			*_system;
 
 	ThemeEngine		*_theme;
+	ThemeEngine::CompiledFileMap _compiledThemeFiles;
 
 //	bool		_needRedraw;
 	RedrawStatus _redrawStatus;
@@ -18,6 +18,7 @@ MODULE_OBJS := \
 	options.o \
 	predictivedialog.o \
 	saveload.o \
+	saveload-cache.o \
 	saveload-dialog.o \
 	themebrowser.o \
 	ThemeEngine.o \
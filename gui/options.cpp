@@ -43,6 +43,7 @@
 #include "audio/musicplugin.h"
 #include "audio/mixer.h"
 #include "audio/fmopl.h"
+#include "audio/rate.h"
 #include "widgets/scrollcontainer.h"
 #include "widgets/edittext.h"
 
@@ -124,6 +125,18 @@ static const int savePeriodValues[] = { 0, 5 * 60, 10 * 60, 15 * 60, 30 * 60, -1
 // "10" (value 3) is the default speed corresponding to the speed before introduction of this control
 static const char *kbdMouseSpeedLabels[] = { "3", "5", "8", "10", "13", "15", "18", "20", 0 };
 
+// Values of the "resampling_quality" config key, as understood by the mixer
+static const struct {
+	const char *name;
+	const char *description;
+	Audio::RateConverterQuality quality;
+} resamplingQualities[] = {
+	{ "fast", _s("Fast"), Audio::kRateConverterFast },
+	{ "linear", _s("Linear interpolation"), Audio::kRateConverterLinear },
+	{ "hq", _s("High quality"), Audio::kRateConverterHQ },
+	{ 0, 0, Audio::kRateConverterFast }
+};
+
 OptionsDialog::OptionsDialog(const Common::String &domain, int x, int y, int w, int h)
 	: Dialog(x, y, w, h), _domain(domain), _graphicsTabId(-1), _midiTabId(-1), _pathsTabId(-1), _tabWidget(0) {
 	init();
@@ -165,6 +178,8 @@ void OptionsDialog::init() {
 	_midiPopUpDesc = 0;
 	_oplPopUp = 0;
 	_oplPopUpDesc = 0;
+	_resamplingPopUp = 0;
+	_resamplingPopUpDesc = 0;
 	_enableMIDISettings = false;
 	_gmDevicePopUp = 0;
 	_gmDevicePopUpDesc = 0;
@@ -327,6 +342,16 @@ void OptionsDialog::build() {
 		_oplPopUp->setSelectedTag(id);
 	}
 
+	if (_resamplingPopUp) {
+		const Common::String quality = ConfMan.get("resampling_quality", _domain);
+		int tag = Audio::kRateConverterFast;
+		for (int i = 0; resamplingQualities[i].name; ++i) {
+			if (quality == resamplingQualities[i].name)
+				tag = resamplingQualities[i].quality;
+		}
+		_resamplingPopUp->setSelectedTag(tag);
+	}
+
 	if (_multiMidiCheckbox) {
 		if (!loadMusicDeviceSetting(_gmDevicePopUp, "gm_device"))
 			_gmDevicePopUp->setSelected(0);
@@ -624,6 +649,17 @@ void OptionsDialog::apply() {
 		}
 	}
 
+	if (_resamplingPopUp) {
+		if (_enableAudioSettings) {
+			for (int i = 0; resamplingQualities[i].name; ++i) {
+				if ((int)_resamplingPopUp->getSelectedTag() == resamplingQualities[i].quality)
+					ConfMan.set("resampling_quality", resamplingQualities[i].name, _domain);
+			}
+		} else {
+			ConfMan.removeKey("resampling_quality", _domain);
+		}
+	}
+
 	// MIDI options
 	if (_multiMidiCheckbox) {
 		if (_enableMIDISettings) {
@@ -834,6 +870,9 @@ void OptionsDialog::setAudioSettingsState(bool enabled) {
 		_oplPopUpDesc->setEnabled(enabled);
 		_oplPopUp->setEnabled(enabled);
 	}
+
+	_resamplingPopUpDesc->setEnabled(enabled);
+	_resamplingPopUp->setEnabled(enabled);
 }
 
 void OptionsDialog::setMIDISettingsState(bool enabled) {
@@ -1068,6 +1107,13 @@ void OptionsDialog::addAudioControls(GuiObject *boss, const Common::String &pref
 		++ed;
 	}
 
+	// The resampling quality popup & a label
+	_resamplingPopUpDesc = new StaticTextWidget(boss, prefix + "auResamplingPopupDesc", _("Resampling:"), _("Quality of the conversion of sounds to the output sample rate"));
+	_resamplingPopUp = new PopUpWidget(boss, prefix + "auResamplingPopup", _("Quality of the conversion of sounds to the output sample rate"));
+
+	for (int i = 0; resamplingQualities[i].name; ++i)
+		_resamplingPopUp->appendEntry(_(resamplingQualities[i].description), resamplingQualities[i].quality);
+
 	_enableAudioSettings = true;
 }
 
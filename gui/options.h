@@ -159,6 +159,8 @@ private:
 	PopUpWidget *_midiPopUp;
 	StaticTextWidget *_oplPopUpDesc;
 	PopUpWidget *_oplPopUp;
+	StaticTextWidget *_resamplingPopUpDesc;
+	PopUpWidget *_resamplingPopUp;
 
 	StaticTextWidget *_mt32DevicePopUpDesc;
 	PopUpWidget *_mt32DevicePopUp;
@@ -0,0 +1,103 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "gui/saveload-cache.h"
+
+#include "common/savefile.h"
+#include "common/system.h"
+
+#include "engines/metaengine.h"
+
+namespace Common {
+DECLARE_SINGLETON(GUI::SaveLoadCache);
+}
+
+namespace GUI {
+
+SaveLoadCache::SaveLoadCache() : _saveFileManager(nullptr), _changeCount(0), _hasSaveList(false) {
+}
+
+SaveStateList SaveLoadCache::listSaves(const MetaEngine &metaEngine, const Common::String &target) {
+	if (!validate(target))
+		return metaEngine.listSaves(target.c_str());
+
+	if (_hasSaveList)
+		return _saveList;
+
+	// Listing the savegames may well be what makes the savefile manager
+	// notice changed savefiles, so validate again afterwards.
+	const SaveStateList saveList = metaEngine.listSaves(target.c_str());
+	if (validate(target)) {
+		_saveList = saveList;
+		_hasSaveList = true;
+	}
+
+	return saveList;
+}
+
+SaveStateDescriptor SaveLoadCache::querySaveMetaInfos(const MetaEngine &metaEngine, const Common::String &target, int slot) {
+	if (!validate(target))
+		return metaEngine.querySaveMetaInfos(target.c_str(), slot);
+
+	MetaInfoMap::const_iterator i = _metaInfos.find(slot);
+	if (i != _metaInfos.end())
+		return i->_value;
+
+	const SaveStateDescriptor desc = metaEngine.querySaveMetaInfos(target.c_str(), slot);
+	if (validate(target)) {
+		if (_metaInfos.size() >= kMaxMetaInfos)
+			_metaInfos.clear();
+		_metaInfos[slot] = desc;
+	}
+
+	return desc;
+}
+
+void SaveLoadCache::clear() {
+	_target.clear();
+	_saveFileManager = nullptr;
+	_hasSaveList = false;
+	_saveList.clear();
+	_metaInfos.clear();
+}
+
+bool SaveLoadCache::validate(const Common::String &target) {
+	// The event recorder swaps in a savefile manager of its own
+	Common::SaveFileManager *saveFileManager = g_system->getSavefileManager();
+
+	uint32 changeCount;
+	if (!saveFileManager || !saveFileManager->getChangeCount(changeCount)) {
+		clear();
+		return false;
+	}
+
+	if (target != _target || saveFileManager != _saveFileManager || changeCount != _changeCount) {
+		clear();
+		_target = target;
+		_saveFileManager = saveFileManager;
+		_changeCount = changeCount;
+	}
+
+	return true;
+}
+
+} // End of namespace GUI
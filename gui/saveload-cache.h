@@ -0,0 +1,101 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GUI_SAVELOAD_CACHE_H
+#define GUI_SAVELOAD_CACHE_H
+
+#include "common/hashmap.h"
+#include "common/singleton.h"
+#include "common/str.h"
+
+#include "engines/savestate.h"
+
+class MetaEngine;
+
+namespace Common {
+class SaveFileManager;
+}
+
+namespace GUI {
+
+/**
+ * Keeps the list of savegames and the meta infos of the target last shown
+ * by a save/load chooser, so that listing and paging through them does not
+ * parse every savefile again.
+ *
+ * The cached data is dropped whenever the savefile manager reports that
+ * savefiles changed. Nothing is cached if it can not report that.
+ */
+class SaveLoadCache : public Common::Singleton<SaveLoadCache> {
+public:
+	/**
+	 * Return the list of savegames of the target, as returned by
+	 * MetaEngine::listSaves.
+	 */
+	SaveStateList listSaves(const MetaEngine &metaEngine, const Common::String &target);
+
+	/**
+	 * Return the meta infos of a savegame of the target, as returned by
+	 * MetaEngine::querySaveMetaInfos.
+	 */
+	SaveStateDescriptor querySaveMetaInfos(const MetaEngine &metaEngine, const Common::String &target, int slot);
+
+	/** Drop all cached data. */
+	void clear();
+
+private:
+	friend class Common::Singleton<SingletonBaseType>;
+	SaveLoadCache();
+
+	/**
+	 * Drop the cached data unless it belongs to the target and no savefiles
+	 * changed since it was cached.
+	 *
+	 * @return true if data for the target may be cached.
+	 */
+	bool validate(const Common::String &target);
+
+	enum {
+		/**
+		 * Meta infos usually include a thumbnail, so only this many of
+		 * them are kept.
+		 */
+		kMaxMetaInfos = 64
+	};
+
+	Common::String _target;
+	Common::SaveFileManager *_saveFileManager;
+	uint32 _changeCount;
+
+	bool _hasSaveList;
+	SaveStateList _saveList;
+
+	typedef Common::HashMap<int, SaveStateDescriptor> MetaInfoMap;
+	MetaInfoMap _metaInfos;
+};
+
+} // End of namespace GUI
+
+/** Shortcut for accessing the save/load cache. */
+#define SaveLoadCacheMan GUI::SaveLoadCache::instance()
+
+#endif
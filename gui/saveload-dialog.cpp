@@ -33,6 +33,7 @@
 
 #include "gui/message.h"
 #include "gui/gui-manager.h"
+#include "gui/saveload-cache.h"
 #include "gui/ThemeEval.h"
 #include "gui/widgets/edittext.h"
 
@@ -289,7 +290,7 @@ void SaveLoadChooserDialog::updateSaveList() {
 
 void SaveLoadChooserDialog::listSaves() {
 	if (!_metaEngine) return; //very strange
-	_saveList = _metaEngine->listSaves(_target.c_str());
+	_saveList = SaveLoadCacheMan.listSaves(*_metaEngine, _target);
 
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
 	//if there is Cloud support, add currently synced files as "locked" saves in the list
@@ -534,7 +535,7 @@ void SaveLoadChooserSimple::updateSelection(bool redraw) {
 	_playtime->setLabel(_("No playtime saved"));
 
 	if (selItem >= 0 && _metaInfoSupport) {
-		SaveStateDescriptor desc = (_saveList[selItem].getLocked() ? _saveList[selItem] : _metaEngine->querySaveMetaInfos(_target.c_str(), _saveList[selItem].getSaveSlot()));
+		SaveStateDescriptor desc = (_saveList[selItem].getLocked() ? _saveList[selItem] : SaveLoadCacheMan.querySaveMetaInfos(*_metaEngine, _target, _saveList[selItem].getSaveSlot()));
 
 		isDeletable = desc.getDeletableFlag() && _delSupport;
 		isWriteProtected = desc.getWriteProtectedFlag();
@@ -841,7 +842,7 @@ void SaveLoadChooserGrid::open() {
 			// In case there was a gap found use the slot.
 			if (lastSlot + 1 < curSlot) {
 				// Check that the save slot can be used for user saves.
-				SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), lastSlot + 1);
+				SaveStateDescriptor desc = SaveLoadCacheMan.querySaveMetaInfos(*_metaEngine, _target, lastSlot + 1);
 				if (!desc.getWriteProtectedFlag()) {
 					_nextFreeSaveSlot = lastSlot + 1;
 					break;
@@ -855,7 +856,7 @@ void SaveLoadChooserGrid::open() {
 		const int maxSlot = _metaEngine->getMaximumSaveSlot();
 		for (int i = lastSlot; _nextFreeSaveSlot == -1 && i < maxSlot; ++i) {
 			// Check that the save slot can be used for user saves.
-			SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), i + 1);
+			SaveStateDescriptor desc = SaveLoadCacheMan.querySaveMetaInfos(*_metaEngine, _target, i + 1);
 			if (!desc.getWriteProtectedFlag()) {
 				_nextFreeSaveSlot = i + 1;
 			}
@@ -1049,7 +1050,7 @@ void SaveLoadChooserGrid::updateSaves() {
 	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
 		const uint saveSlot = _saveList[i].getSaveSlot();
 
-		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot));
+		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : SaveLoadCacheMan.querySaveMetaInfos(*_metaEngine, _target, saveSlot));
 		SlotButton &curButton = _buttons[curNum];
 		curButton.setVisible(true);
 		const Graphics::Surface *thumbnail = desc.getThumbnail();
@@ -161,9 +161,16 @@ void ListWidget::setList(const StringArray &list, const ColorList *colors) {
 	_dataList = list;
 	_list = list;
 	_filter.clear();
+	_filterWords.clear();
 	_listIndex.clear();
 	_listColors.clear();
 
+	_lowercaseList.resize(_dataList.size());
+	for (uint i = 0; i < _dataList.size(); ++i) {
+		_lowercaseList[i] = _dataList[i];
+		_lowercaseList[i].toLowercase();
+	}
+
 	if (colors) {
 		_listColors = *colors;
 		assert(_listColors.size() == _dataList.size());
@@ -193,10 +200,18 @@ void ListWidget::append(const String &s, ThemeEngine::FontColor color) {
 		_listColors.push_back(color);
 	}
 
+	String lowercase = s;
+	lowercase.toLowercase();
+
 	_dataList.push_back(s);
-	_list.push_back(s);
+	_lowercaseList.push_back(lowercase);
 
-	setFilter(_filter, false);
+	if (_filter.empty()) {
+		_list.push_back(s);
+	} else if (matchesFilter(_dataList.size() - 1)) {
+		_list.push_back(s);
+		_listIndex.push_back(_dataList.size() - 1);
+	}
 
 	scrollBarRecalc();
 }
@@ -664,6 +679,15 @@ void ListWidget::reflowLayout() {
 	}
 }
 
+bool ListWidget::matchesFilter(int item) const {
+	for (StringArray::const_iterator i = _filterWords.begin(); i != _filterWords.end(); ++i) {
+		if (!_lowercaseList[item].contains(*i))
+			return false;
+	}
+
+	return true;
+}
+
 void ListWidget::setFilter(const String &filter, bool redraw) {
 	// FIXME: This method does not deal correctly with edit mode!
 	// Until we fix that, let's make sure it isn't called while editing takes place
@@ -675,7 +699,13 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 	if (_filter == filt) // Filter was not changed
 		return;
 
+	// When the filter was only extended, the entries which match it are a
+	// subset of the ones which matched the previous filter: every word of the
+	// new filter contains the corresponding word of the previous one.
+	const bool narrowed = !_filter.empty() && filt.hasPrefix(_filter);
+
 	_filter = filt;
+	_filterWords.clear();
 
 	if (_filter.empty()) {
 		// No filter -> display everything
@@ -684,28 +714,23 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 	} else {
 		// Restrict the list to everything which contains all words in _filter
 		// as substrings, ignoring case.
-
 		Common::StringTokenizer tok(_filter);
-		String tmp;
-		int n = 0;
+		while (!tok.empty())
+			_filterWords.push_back(tok.nextToken());
+
+		Common::Array<int> candidates;
+		if (narrowed)
+			candidates = _listIndex;
 
 		_list.clear();
 		_listIndex.clear();
 
-		for (StringArray::iterator i = _dataList.begin(); i != _dataList.end(); ++i, ++n) {
-			tmp = *i;
-			tmp.toLowercase();
-			bool matches = true;
-			tok.reset();
-			while (!tok.empty()) {
-				if (!tmp.contains(tok.nextToken())) {
-					matches = false;
-					break;
-				}
-			}
+		const uint count = narrowed ? candidates.size() : _dataList.size();
+		for (uint i = 0; i < count; ++i) {
+			const int n = narrowed ? candidates[i] : i;
 
-			if (matches) {
-				_list.push_back(*i);
+			if (matchesFilter(n)) {
+				_list.push_back(_dataList[n]);
 				_listIndex.push_back(n);
 			}
 		}
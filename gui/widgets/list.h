@@ -55,6 +55,7 @@ public:
 protected:
 	StringArray		_list;
 	StringArray		_dataList;
+	StringArray		_lowercaseList;	///< The entries of _dataList in lowercase, for filtering
 	ColorList		_listColors;
 	Common::Array<int>		_listIndex;
 	bool			_editable;
@@ -78,6 +79,7 @@ protected:
 	int				_scrollBarWidth;
 
 	String			_filter;
+	StringArray		_filterWords;
 	bool			_quickSelect;
 
 	uint32			_cmd;
@@ -140,6 +142,9 @@ protected:
 	int findItem(int x, int y) const;
 	void scrollBarRecalc();
 
+	/// Checks whether the item of _dataList contains all words of the filter.
+	bool matchesFilter(int item) const;
+
 	void abortEditMode();
 
 	Common::Rect getEditRect() const;
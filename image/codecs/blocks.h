@@ -0,0 +1,160 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef IMAGE_CODECS_BLOCKS_H
+#define IMAGE_CODECS_BLOCKS_H
+
+#include "common/scummsys.h"
+
+namespace Image {
+
+/**
+ * @file
+ * Drawing of the 4x4 pixel blocks which most vector quantizing codecs are
+ * made of.
+ *
+ * Each row of a block is written with a single store of a word holding all
+ * four pixels, instead of pixel by pixel. Two color rows are assembled from
+ * the splatted colors and a mask, without branching on every pixel.
+ *
+ * All pitches are given in pixels and may be negative for bottom-up images.
+ */
+
+// The masks selecting the pixels of a row for the set bits of a nibble. Bit
+// 0 selects the leftmost pixel, which is at the lowest address.
+#ifdef SCUMM_BIG_ENDIAN
+#define IMAGE_BLOCK_ROW_MASK(n, full, shift) \
+	(((n) & 1 ? (full) << (3 * (shift)) : 0) | ((n) & 2 ? (full) << (2 * (shift)) : 0) | \
+	 ((n) & 4 ? (full) << (shift) : 0) | ((n) & 8 ? (full) : 0))
+#else
+#define IMAGE_BLOCK_ROW_MASK(n, full, shift) \
+	(((n) & 1 ? (full) : 0) | ((n) & 2 ? (full) << (shift) : 0) | \
+	 ((n) & 4 ? (full) << (2 * (shift)) : 0) | ((n) & 8 ? (full) << (3 * (shift)) : 0))
+#endif
+
+#define IMAGE_BLOCK_ROW_MASKS(full, shift) { \
+	IMAGE_BLOCK_ROW_MASK(0, full, shift),  IMAGE_BLOCK_ROW_MASK(1, full, shift),  \
+	IMAGE_BLOCK_ROW_MASK(2, full, shift),  IMAGE_BLOCK_ROW_MASK(3, full, shift),  \
+	IMAGE_BLOCK_ROW_MASK(4, full, shift),  IMAGE_BLOCK_ROW_MASK(5, full, shift),  \
+	IMAGE_BLOCK_ROW_MASK(6, full, shift),  IMAGE_BLOCK_ROW_MASK(7, full, shift),  \
+	IMAGE_BLOCK_ROW_MASK(8, full, shift),  IMAGE_BLOCK_ROW_MASK(9, full, shift),  \
+	IMAGE_BLOCK_ROW_MASK(10, full, shift), IMAGE_BLOCK_ROW_MASK(11, full, shift), \
+	IMAGE_BLOCK_ROW_MASK(12, full, shift), IMAGE_BLOCK_ROW_MASK(13, full, shift), \
+	IMAGE_BLOCK_ROW_MASK(14, full, shift), IMAGE_BLOCK_ROW_MASK(15, full, shift)  \
+}
+
+/**
+ * A row of four pixels held in a single word.
+ */
+template<typename PixelInt>
+struct BlockRow;
+
+template<>
+struct BlockRow<byte> {
+	typedef uint32 Type;
+
+	static inline Type splat(byte color) { return color * 0x01010101U; }
+
+	static inline Type mask(uint bits) {
+		static const uint32 masks[16] = IMAGE_BLOCK_ROW_MASKS(0xFFU, 8);
+		return masks[bits & 15];
+	}
+};
+
+template<>
+struct BlockRow<uint16> {
+	typedef uint64 Type;
+
+	static inline Type splat(uint16 color) { return color * ((((uint64)0x00010001) << 32) | 0x00010001); }
+
+	static inline Type mask(uint bits) {
+		static const uint64 masks[16] = IMAGE_BLOCK_ROW_MASKS((uint64)0xFFFF, 16);
+		return masks[bits & 15];
+	}
+};
+
+#undef IMAGE_BLOCK_ROW_MASKS
+#undef IMAGE_BLOCK_ROW_MASK
+
+/**
+ * Write one row of four pixels.
+ */
+template<typename PixelInt>
+inline void writeBlockRow(PixelInt *dst, PixelInt p0, PixelInt p1, PixelInt p2, PixelInt p3) {
+	const PixelInt row[4] = { p0, p1, p2, p3 };
+	memcpy(dst, row, sizeof(row));
+}
+
+/**
+ * Fill a block with a single color. Some codecs double the rows of their
+ * blocks, so the height may be given.
+ */
+template<typename PixelInt>
+inline void fillBlock(PixelInt *dst, int pitch, PixelInt color, int height = 4) {
+	const PixelInt row[4] = { color, color, color, color };
+	for (int y = 0; y < height; y++) {
+		memcpy(dst, row, sizeof(row));
+		dst += pitch;
+	}
+}
+
+/**
+ * Copy a block from another location in the same image.
+ */
+template<typename PixelInt>
+inline void copyBlock(PixelInt *dst, const PixelInt *src, int pitch) {
+	for (int y = 0; y < 4; y++) {
+		memcpy(dst, src, 4 * sizeof(PixelInt));
+		dst += pitch;
+		src += pitch;
+	}
+}
+
+/**
+ * Write one row of a two color block. Bit n of bits selects color1 instead
+ * of color0 for pixel n.
+ */
+template<typename PixelInt>
+inline void drawTwoColorRow(PixelInt *dst, uint bits, PixelInt color0, PixelInt color1) {
+	typedef BlockRow<PixelInt> Row;
+
+	const typename Row::Type row0 = Row::splat(color0);
+	const typename Row::Type row = row0 ^ ((row0 ^ Row::splat(color1)) & Row::mask(bits));
+	memcpy(dst, &row, sizeof(row));
+}
+
+/**
+ * Draw a two color block. Each nibble of bits holds a row, starting with
+ * the lowest nibble for the top row, as in drawTwoColorRow.
+ */
+template<typename PixelInt>
+inline void drawTwoColorBlock(PixelInt *dst, int pitch, uint bits, PixelInt color0, PixelInt color1) {
+	for (int y = 0; y < 4; y++) {
+		drawTwoColorRow(dst, bits, color0, color1);
+		bits >>= 4;
+		dst += pitch;
+	}
+}
+
+} // End of namespace Image
+
+#endif
@@ -117,6 +117,33 @@ public:
 	static byte *createQuickTimeDitherTable(const byte *palette, uint colorCount);
 };
 
+/**
+ * A codec for video streams which are split into packets independently of
+ * their frames, like the elementary streams of MPEG program streams.
+ *
+ * Besides the software codecs, backends may provide these for decoding
+ * hardware, see OSystem::createHardwareVideoCodec().
+ *
+ * Used in video:
+ *  - MPEGPSDecoder
+ */
+class PacketCodec {
+public:
+	virtual ~PacketCodec() {}
+
+	/**
+	 * Decode the next packet of the stream.
+	 *
+	 * @param packet      the packet to decode
+	 * @param framePeriod set to the duration of the completed frame, in
+	 *                    ticks of 27 MHz
+	 * @param dst         the surface to decode the frame into, which has
+	 *                    the size and format the codec was created for
+	 * @return whether the packet completed a frame
+	 */
+	virtual bool decodePacket(Common::SeekableReadStream &packet, uint32 &framePeriod, Graphics::Surface *dst) = 0;
+};
+
 /**
  * Create a codec given a bitmap/AVI compression tag.
  */
@@ -77,6 +77,8 @@ Indeo3Decoder::~Indeo3Decoder() {
 	_surface->free();
 	delete _surface;
 
+	_tempSurface.free();
+
 	delete[] _iv_frame[0].the_buf;
 	delete[] _ModPred;
 	delete[] _corrector_type;
@@ -248,12 +250,11 @@ const Graphics::Surface *Indeo3Decoder::decodeFrame(Common::SeekableReadStream &
 
 	uint32 dataSize = stream.size() - hPos;
 
-	byte *inData = new byte[dataSize];
+	_inData.resize(dataSize);
+	byte *inData = _inData.begin();
 
-	if (stream.read(inData, dataSize) != dataSize) {
-		delete[] inData;
+	if (stream.read(inData, dataSize) != dataSize)
 		return 0;
-	}
 
 	byte *hdr_pos = inData;
 	byte *buf_pos;
@@ -279,16 +280,16 @@ const Graphics::Surface *Indeo3Decoder::decodeFrame(Common::SeekableReadStream &
 	decodeChunk(_cur_frame->Ubuf, _ref_frame->Ubuf, chromaWidth, chromaHeight,
 			buf_pos + offs * 2, flags2, hdr_pos, buf_pos, MIN<int>(chromaWidth, 40));
 
-	delete[] inData;
-
 	const byte *srcY = _cur_frame->Ybuf;
 	const byte *srcU = _cur_frame->Ubuf;
 	const byte *srcV = _cur_frame->Vbuf;
 
 	// Create buffers for U/V with an extra row/column copied from the second-to-last
 	// row/column.
-	byte *tempU = new byte[(chromaWidth + 1) * (chromaHeight + 1)];
-	byte *tempV = new byte[(chromaWidth + 1) * (chromaHeight + 1)];
+	_tempU.resize((chromaWidth + 1) * (chromaHeight + 1));
+	_tempV.resize((chromaWidth + 1) * (chromaHeight + 1));
+	byte *tempU = _tempU.begin();
+	byte *tempV = _tempV.begin();
 
 	for (uint i = 0; i < chromaHeight; i++) {
 		memcpy(tempU + (chromaWidth + 1) * i, srcU + chromaWidth * i, chromaWidth);
@@ -312,8 +313,12 @@ const Graphics::Surface *Indeo3Decoder::decodeFrame(Common::SeekableReadStream &
 				fWidth, fHeight, fWidth, chromaWidth + 1);
 	} else {
 		// Need to upscale, so decode to a temp surface first
-		Graphics::Surface tempSurface;
-		tempSurface.create(fWidth, fHeight, _surface->format);
+		if (_tempSurface.w != fWidth || _tempSurface.h != fHeight) {
+			_tempSurface.free();
+			_tempSurface.create(fWidth, fHeight, _surface->format);
+		}
+
+		Graphics::Surface &tempSurface = _tempSurface;
 
 		YUVToRGBMan.convert410(&tempSurface, Graphics::YUVToRGBManager::kScaleITU, srcY, tempU, tempV,
 				fWidth, fHeight, fWidth, chromaWidth + 1);
@@ -329,13 +334,8 @@ const Graphics::Surface *Indeo3Decoder::decodeFrame(Common::SeekableReadStream &
 					*((uint32 *)_surface->getBasePtr(x, y)) = *((uint32 *)tempSurface.getBasePtr(x / scaleWidth, y / scaleHeight));
  			}
 		}
-
-		tempSurface.free();
 	}
 
-	delete[] tempU;
-	delete[] tempV;
-
 	return _surface;
 }
 
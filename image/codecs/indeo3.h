@@ -32,6 +32,8 @@
 #ifndef IMAGE_CODECS_INDEO3_H
 #define IMAGE_CODECS_INDEO3_H
 
+#include "common/array.h"
+#include "graphics/surface.h"
 #include "image/codecs/codec.h"
 
 namespace Image {
@@ -82,6 +84,11 @@ private:
 	byte *_ModPred;
 	uint16 *_corrector_type;
 
+	// Work buffers, kept across frames
+	Common::Array<byte> _inData;
+	Common::Array<byte> _tempU, _tempV;
+	Graphics::Surface _tempSurface;
+
 	void buildModPred();
 	void allocFrames();
 
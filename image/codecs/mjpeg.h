@@ -23,6 +23,8 @@
 #ifndef IMAGE_CODECS_MJPEG_H
 #define IMAGE_CODECS_MJPEG_H
 
+#include "common/array.h"
+
 #include "image/codecs/codec.h"
 #include "graphics/pixelformat.h"
 
@@ -36,6 +38,8 @@ struct Surface;
 
 namespace Image {
 
+class JPEGDecoder;
+
 /**
  * Motion JPEG decoder.
  *
@@ -52,6 +56,10 @@ public:
 private:
 	Graphics::PixelFormat _pixelFormat;
 	Graphics::Surface *_surface;
+
+	// Kept across frames to avoid allocating them for each frame
+	JPEGDecoder *_jpeg;
+	Common::Array<byte> _data;
 };
 
 } // End of namespace Image
@@ -67,9 +67,9 @@ namespace Image {
 /**
  * MPEG 1/2 video decoder.
  *
- * Used by BMP/AVI.
+ * Used by BMP/AVI and MPEGPSDecoder.
  */
-class MPEGDecoder : public Codec {
+class MPEGDecoder : public Codec, public PacketCodec {
 public:
 	MPEGDecoder();
 	~MPEGDecoder();
@@ -78,7 +78,7 @@ public:
 	const Graphics::Surface *decodeFrame(Common::SeekableReadStream &stream);
 	Graphics::PixelFormat getPixelFormat() const { return _pixelFormat; }
 
-	// MPEGPSDecoder call
+	// PacketCodec interface
 	bool decodePacket(Common::SeekableReadStream &packet, uint32 &framePeriod, Graphics::Surface *dst = 0);
 
 private:
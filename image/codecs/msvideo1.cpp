@@ -23,6 +23,8 @@
  // Based off ffmpeg's msvideo.cpp
 
 #include "image/codecs/msvideo1.h"
+#include "image/codecs/blocks.h"
+
 #include "common/stream.h"
 #include "common/textconsole.h"
 
@@ -57,7 +59,6 @@ void MSVideo1Decoder::decode8(Common::SeekableReadStream &stream) {
     uint16 blocks_high = _surface->h / 4;
     uint32 totalBlocks = blocks_wide * blocks_high;
     uint32 blockInc = 4;
-    uint16 rowDec = stride + 4;
 
     for (uint16 block_y = blocks_high; block_y > 0; block_y--) {
         uint32 blockPtr = (block_y * 4 - 1) * stride;
@@ -91,11 +92,8 @@ void MSVideo1Decoder::decode8(Common::SeekableReadStream &stream) {
                 colors[0] = stream.readByte();
                 colors[1] = stream.readByte();
 
-                for (byte pixel_y = 0; pixel_y < 4; pixel_y++) {
-                    for (byte pixel_x = 0; pixel_x < 4; pixel_x++, flags >>= 1)
-                        pixels[pixelPtr++] = colors[(flags & 0x1) ^ 1];
-                    pixelPtr -= rowDec;
-                }
+                // The rows are stored bottom-up
+                drawTwoColorBlock<byte>(pixels + pixelPtr, -stride, flags, colors[1], colors[0]);
             } else if (byte_b >= 0x90) {
                 // 8-color encoding
                 uint16 flags = (byte_b << 8) | byte_a;
@@ -104,20 +102,19 @@ void MSVideo1Decoder::decode8(Common::SeekableReadStream &stream) {
 				for (byte i = 0; i < 8; i++)
 					colors[i] = stream.readByte();
 
-                for (byte pixel_y = 0; pixel_y < 4; pixel_y++) {
-                    for (byte pixel_x = 0; pixel_x < 4; pixel_x++, flags >>= 1)
-                        pixels[pixelPtr++] = colors[((pixel_y & 0x2) << 1) + (pixel_x & 0x2) + ((flags & 0x1) ^ 1)];
-                    pixelPtr -= rowDec;
+                // Each quadrant has a color pair of its own
+                for (byte pixel_y = 0; pixel_y < 4; pixel_y++, flags >>= 4) {
+                    const byte *pair = colors + ((pixel_y & 0x2) << 1);
+                    writeBlockRow<byte>(pixels + pixelPtr,
+                                        pair[(flags & 0x1) ^ 1], pair[((flags >> 1) & 0x1) ^ 1],
+                                        pair[2 + (((flags >> 2) & 0x1) ^ 1)], pair[2 + (((flags >> 3) & 0x1) ^ 1)]);
+                    pixelPtr -= stride;
                 }
             } else {
                 // 1-color encoding
                 colors[0] = byte_a;
 
-                for (byte pixel_y = 0; pixel_y < 4; pixel_y++) {
-                    for (byte pixel_x = 0; pixel_x < 4; pixel_x++)
-                        pixels[pixelPtr++] = colors[0];
-                    pixelPtr -= rowDec;
-                }
+                fillBlock<byte>(pixels + pixelPtr, -stride, colors[0]);
             }
 
             blockPtr += blockInc;
@@ -137,7 +134,6 @@ void MSVideo1Decoder::decode16(Common::SeekableReadStream &stream) {
     int32 blocks_high = _surface->h / 4;
     int32 total_blocks = blocks_wide * blocks_high;
     int32 block_inc = 4;
-    int32 row_dec = stride + 4;
 
     for (int32 block_y = blocks_high; block_y > 0; block_y--) {
         int32 block_ptr = ((block_y * 4) - 1) * stride;
@@ -181,30 +177,22 @@ void MSVideo1Decoder::decode16(Common::SeekableReadStream &stream) {
                     colors[6] = stream.readUint16LE();
                     colors[7] = stream.readUint16LE();
 
-                    for (int pixel_y = 0; pixel_y < 4; pixel_y++) {
-                        for (int pixel_x = 0; pixel_x < 4; pixel_x++, flags >>= 1)
-                            pixels[pixel_ptr++] =
-                                colors[((pixel_y & 0x2) << 1) +
-                                    (pixel_x & 0x2) + ((flags & 0x1) ^ 1)];
-                        pixel_ptr -= row_dec;
+                    for (int pixel_y = 0; pixel_y < 4; pixel_y++, flags >>= 4) {
+                        const uint16 *pair = colors + ((pixel_y & 0x2) << 1);
+                        writeBlockRow<uint16>(pixels + pixel_ptr,
+                                              pair[(flags & 0x1) ^ 1], pair[((flags >> 1) & 0x1) ^ 1],
+                                              pair[2 + (((flags >> 2) & 0x1) ^ 1)], pair[2 + (((flags >> 3) & 0x1) ^ 1)]);
+                        pixel_ptr -= stride;
                     }
                 } else {
-                    /* 2-color encoding */
-                    for (int pixel_y = 0; pixel_y < 4; pixel_y++) {
-                        for (int pixel_x = 0; pixel_x < 4; pixel_x++, flags >>= 1)
-                            pixels[pixel_ptr++] = colors[(flags & 0x1) ^ 1];
-                        pixel_ptr -= row_dec;
-                    }
+                    /* 2-color encoding, the rows are stored bottom-up */
+                    drawTwoColorBlock<uint16>(pixels + pixel_ptr, -stride, flags, colors[1], colors[0]);
                 }
             } else {
                 /* otherwise, it's a 1-color block */
                 colors[0] = (byte_b << 8) | byte_a;
 
-                for (int pixel_y = 0; pixel_y < 4; pixel_y++) {
-                    for (int pixel_x = 0; pixel_x < 4; pixel_x++)
-                        pixels[pixel_ptr++] = colors[0];
-                    pixel_ptr -= row_dec;
-                }
+                fillBlock<uint16>(pixels + pixel_ptr, -stride, colors[0]);
             }
 
             block_ptr += block_inc;
@@ -23,6 +23,7 @@
  // Based off ffmpeg's RPZA decoder
 
 #include "image/codecs/rpza.h"
+#include "image/codecs/blocks.h"
 
 #include "common/debug.h"
 #include "common/system.h"
@@ -65,69 +66,23 @@ RPZADecoder::~RPZADecoder() {
 
 struct BlockDecoderRaw {
 	static inline void drawFillBlock(uint16 *blockPtr, uint16 pitch, uint16 color, const byte *colorMap) {
-		blockPtr[0] = color;
-		blockPtr[1] = color;
-		blockPtr[2] = color;
-		blockPtr[3] = color;
-		blockPtr += pitch;
-		blockPtr[0] = color;
-		blockPtr[1] = color;
-		blockPtr[2] = color;
-		blockPtr[3] = color;
-		blockPtr += pitch;
-		blockPtr[0] = color;
-		blockPtr[1] = color;
-		blockPtr[2] = color;
-		blockPtr[3] = color;
-		blockPtr += pitch;
-		blockPtr[0] = color;
-		blockPtr[1] = color;
-		blockPtr[2] = color;
-		blockPtr[3] = color;
+		fillBlock<uint16>(blockPtr, pitch, color);
 	}
 
 	static inline void drawRawBlock(uint16 *blockPtr, uint16 pitch, const uint16 (&colors)[16], const byte *colorMap) {
-		blockPtr[0] = colors[0];
-		blockPtr[1] = colors[1];
-		blockPtr[2] = colors[2];
-		blockPtr[3] = colors[3];
-		blockPtr += pitch;
-		blockPtr[0] = colors[4];
-		blockPtr[1] = colors[5];
-		blockPtr[2] = colors[6];
-		blockPtr[3] = colors[7];
-		blockPtr += pitch;
-		blockPtr[0] = colors[8];
-		blockPtr[1] = colors[9];
-		blockPtr[2] = colors[10];
-		blockPtr[3] = colors[11];
-		blockPtr += pitch;
-		blockPtr[0] = colors[12];
-		blockPtr[1] = colors[13];
-		blockPtr[2] = colors[14];
-		blockPtr[3] = colors[15];
+		for (int i = 0; i < 16; i += 4) {
+			writeBlockRow<uint16>(blockPtr, colors[i], colors[i + 1], colors[i + 2], colors[i + 3]);
+			blockPtr += pitch;
+		}
 	}
 
 	static inline void drawBlendBlock(uint16 *blockPtr, uint16 pitch, const uint16 (&colors)[4], const byte (&indexes)[4], const byte *colorMap) {
-		blockPtr[0] = colors[(indexes[0] >> 6) & 0x03];
-		blockPtr[1] = colors[(indexes[0] >> 4) & 0x03];
-		blockPtr[2] = colors[(indexes[0] >> 2) & 0x03];
-		blockPtr[3] = colors[(indexes[0] >> 0) & 0x03];
-		blockPtr += pitch;
-		blockPtr[0] = colors[(indexes[1] >> 6) & 0x03];
-		blockPtr[1] = colors[(indexes[1] >> 4) & 0x03];
-		blockPtr[2] = colors[(indexes[1] >> 2) & 0x03];
-		blockPtr[3] = colors[(indexes[1] >> 0) & 0x03];
-		blockPtr += pitch;
-		blockPtr[0] = colors[(indexes[2] >> 6) & 0x03];
-		blockPtr[1] = colors[(indexes[2] >> 4) & 0x03];
-		blockPtr[2] = colors[(indexes[2] >> 2) & 0x03];
-		blockPtr[3] = colors[(indexes[2] >> 0) & 0x03];
-		blockPtr += pitch;
-		blockPtr[0] = colors[(indexes[3] >> 6) & 0x03];
-		blockPtr[1] = colors[(indexes[3] >> 4) & 0x03];
-		blockPtr[2] = colors[(indexes[3] >> 2) & 0x03];
-		blockPtr[3] = colors[(indexes[3] >> 0) & 0x03];
+		for (int i = 0; i < 4; i++) {
+			writeBlockRow<uint16>(blockPtr,
+			                      colors[(indexes[i] >> 6) & 0x03], colors[(indexes[i] >> 4) & 0x03],
+			                      colors[(indexes[i] >> 2) & 0x03], colors[(indexes[i] >> 0) & 0x03]);
+			blockPtr += pitch;
+		}
 	}
 };
 
@@ -139,25 +94,13 @@ struct BlockDecoderDither {
 		byte pixel3 = mapOffset[0x8000];
 		byte pixel4 = mapOffset[0xC000];
 
-		blockPtr[0] = pixel1;
-		blockPtr[1] = pixel2;
-		blockPtr[2] = pixel3;
-		blockPtr[3] = pixel4;
+		writeBlockRow<byte>(blockPtr, pixel1, pixel2, pixel3, pixel4);
 		blockPtr += pitch;
-		blockPtr[0] = pixel4;
-		blockPtr[1] = pixel1;
-		blockPtr[2] = pixel2;
-		blockPtr[3] = pixel3;
+		writeBlockRow<byte>(blockPtr, pixel4, pixel1, pixel2, pixel3);
 		blockPtr += pitch;
-		blockPtr[0] = pixel2;
-		blockPtr[1] = pixel3;
-		blockPtr[2] = pixel4;
-		blockPtr[3] = pixel1;
+		writeBlockRow<byte>(blockPtr, pixel2, pixel3, pixel4, pixel1);
 		blockPtr += pitch;
-		blockPtr[0] = pixel3;
-		blockPtr[1] = pixel4;
-		blockPtr[2] = pixel1;
-		blockPtr[3] = pixel2;
+		writeBlockRow<byte>(blockPtr, pixel3, pixel4, pixel1, pixel2);
 	}
 
 	static inline void drawRawBlock(byte *blockPtr, uint16 pitch, const uint16 (&colors)[16], const byte *colorMap) {
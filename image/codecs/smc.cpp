@@ -23,11 +23,20 @@
 // Based off ffmpeg's SMC decoder
 
 #include "image/codecs/smc.h"
+#include "image/codecs/blocks.h"
+
 #include "common/stream.h"
 #include "common/textconsole.h"
 
 namespace Image {
 
+// Reverses the bits of a nibble, the two color flags start with the leftmost
+// pixel in the highest bit
+static const byte s_reverseNibble[16] = {
+	0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+	0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF
+};
+
 #define GET_BLOCK_COUNT() \
   (opcode & 0x10) ? (1 + stream.readByte()) : 1 + (opcode & 0x0F);
 
@@ -131,12 +140,7 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 			while (numBlocks--) {
 				blockPtr = rowPtr + pixelPtr;
 				prevBlockPtr = prevBlockPtr1;
-				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++)
-						pixels[blockPtr++] = pixels[prevBlockPtr++];
-					blockPtr += rowInc;
-					prevBlockPtr += rowInc;
-				}
+				copyBlock<byte>(pixels + blockPtr, pixels + prevBlockPtr, _surface->w);
 				ADVANCE_BLOCK();
 			}
 			break;
@@ -177,13 +181,7 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 
 				prevBlockFlag = !prevBlockFlag;
 
-				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++)
-						pixels[blockPtr++] = pixels[prevBlockPtr++];
-
-					blockPtr += rowInc;
-					prevBlockPtr += rowInc;
-				}
+				copyBlock<byte>(pixels + blockPtr, pixels + prevBlockPtr, _surface->w);
 				ADVANCE_BLOCK();
 			}
 			break;
@@ -196,12 +194,7 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 
 			while (numBlocks--) {
 				blockPtr = rowPtr + pixelPtr;
-				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++)
-						pixels[blockPtr++] = pixel;
-
-					blockPtr += rowInc;
-				}
+				fillBlock<byte>(pixels + blockPtr, _surface->w, pixel);
 				ADVANCE_BLOCK();
 			}
 			break;
@@ -233,20 +226,14 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 
 			while (numBlocks--) {
 				colorFlags = stream.readUint16BE();
-				uint16 flagMask = 0x8000;
 				blockPtr = rowPtr + pixelPtr;
-				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++) {
-						if (colorFlags & flagMask)
-							pixel = colorTableIndex + 1;
-						else
-							pixel = colorTableIndex;
-
-						flagMask >>= 1;
-						pixels[blockPtr++] = _colorPairs[pixel];
-					}
 
-					blockPtr += rowInc;
+				// The flags start with the top left pixel in the highest bit
+				for (byte y = 0; y < 4; y++) {
+					drawTwoColorRow<byte>(pixels + blockPtr, s_reverseNibble[(colorFlags >> 12) & 0x0F],
+					                      _colorPairs[colorTableIndex], _colorPairs[colorTableIndex + 1]);
+					colorFlags <<= 4;
+					blockPtr += _surface->w;
 				}
 				ADVANCE_BLOCK();
 			}
@@ -284,13 +271,13 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 				byte flagMask = 30;
 				blockPtr = rowPtr + pixelPtr;
 
+				const byte *quad = _colorQuads + colorTableIndex;
 				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++) {
-						pixel = colorTableIndex + ((colorFlags >> flagMask) & 0x03);
-						flagMask -= 2;
-						pixels[blockPtr++] = _colorQuads[pixel];
-					}
-					blockPtr += rowInc;
+					writeBlockRow<byte>(pixels + blockPtr,
+					                    quad[(colorFlags >> flagMask) & 0x03], quad[(colorFlags >> (flagMask - 2)) & 0x03],
+					                    quad[(colorFlags >> (flagMask - 4)) & 0x03], quad[(colorFlags >> (flagMask - 6)) & 0x03]);
+					flagMask -= 8;
+					blockPtr += _surface->w;
 				}
 				ADVANCE_BLOCK();
 			}
@@ -342,6 +329,7 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 				// flag mask actually acts as a bit shift count here
 				byte flagMask = 21;
 				blockPtr = rowPtr + pixelPtr;
+				const byte *octet = _colorOctets + colorTableIndex;
 				for (byte y = 0; y < 4; y++) {
 					// reload flags at third row (iteration y == 2)
 					if (y == 2) {
@@ -349,13 +337,11 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 						flagMask = 21;
 					}
 
-					for (byte x = 0; x < 4; x++) {
-						pixel = colorTableIndex + ((colorFlags >> flagMask) & 0x07);
-						flagMask -= 3;
-						pixels[blockPtr++] = _colorOctets[pixel];
-					}
-
-					blockPtr += rowInc;
+					writeBlockRow<byte>(pixels + blockPtr,
+					                    octet[(colorFlags >> flagMask) & 0x07], octet[(colorFlags >> (flagMask - 3)) & 0x07],
+					                    octet[(colorFlags >> (flagMask - 6)) & 0x07], octet[(colorFlags >> (flagMask - 9)) & 0x07]);
+					flagMask -= 12;
+					blockPtr += _surface->w;
 				}
 				ADVANCE_BLOCK();
 			}
@@ -368,10 +354,8 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 			while (numBlocks--) {
 				blockPtr = rowPtr + pixelPtr;
 				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++)
-						pixels[blockPtr++] = stream.readByte();
-
-					blockPtr += rowInc;
+					stream.read(pixels + blockPtr, 4);
+					blockPtr += _surface->w;
 				}
 				ADVANCE_BLOCK();
 			}
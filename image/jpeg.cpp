@@ -30,6 +30,7 @@
 #include "common/endian.h"
 #include "common/stream.h"
 #include "common/textconsole.h"
+#include "graphics/conversion.h"
 #include "graphics/pixelformat.h"
 
 #ifdef USE_JPEG
@@ -175,9 +176,21 @@ void outputMessage(j_common_ptr cinfo) {
 #endif
 
 bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
+	return decode(stream, _surface, 0, 1);
+}
+
+bool JPEGDecoder::loadStreamInto(Common::SeekableReadStream &stream, Graphics::Surface &surface, const Graphics::PixelFormat &format, uint scale) {
+	if (_colorSpace != kColorSpaceRGBA) {
+		warning("JPEGDecoder: Can only decode into a surface with the RGBA color space");
+		return false;
+	}
+
+	return decode(stream, surface, &format, scale);
+}
+
+bool JPEGDecoder::decode(Common::SeekableReadStream &stream, Graphics::Surface &surface, const Graphics::PixelFormat *outputFormat, uint scale) {
 #ifdef USE_JPEG
-	// Reset member variables from previous decodings
-	destroy();
+	assert(scale == 1 || scale == 2 || scale == 4 || scale == 8);
 
 	jpeg_decompress_struct cinfo;
 	jpeg_error_mgr jerr;
@@ -207,32 +220,54 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 		break;
 	}
 
+	// Let libjpeg scale the image down while decoding it
+	cinfo.scale_num = 1;
+	cinfo.scale_denom = scale;
+
 	// Actually start decompressing the image
 	jpeg_start_decompress(&cinfo);
 
 	// Allocate buffers for the output data
+	Graphics::PixelFormat format;
 	switch (_colorSpace) {
 	case kColorSpaceRGBA:
 		// We use RGBA8888 in this scenario
-		_surface.create(cinfo.output_width, cinfo.output_height, Graphics::PixelFormat(4, 8, 8, 8, 0, 24, 16, 8, 0));
+		format = Graphics::PixelFormat(4, 8, 8, 8, 0, 24, 16, 8, 0);
 		break;
 
 	case kColorSpaceYUV:
 		// We use YUV with 3 bytes per pixel otherwise.
 		// This is pretty ugly since our PixelFormat cannot express YUV...
-		_surface.create(cinfo.output_width, cinfo.output_height, Graphics::PixelFormat(3, 0, 0, 0, 0, 0, 0, 0, 0));
+		format = Graphics::PixelFormat(3, 0, 0, 0, 0, 0, 0, 0, 0);
 		break;
 	}
 
+	if (!outputFormat)
+		outputFormat = &format;
+
+	// Keep the surface of the previous decoding if it has the same size,
+	// which is common when decoding the frames of a video
+	if (surface.w != (int)cinfo.output_width || surface.h != (int)cinfo.output_height || surface.format != *outputFormat) {
+		surface.free();
+		surface.create(cinfo.output_width, cinfo.output_height, *outputFormat);
+	}
+
 	// Allocate buffer for one scanline
 	assert(cinfo.output_components == 3);
 	JDIMENSION pitch = cinfo.output_width * cinfo.output_components;
-	assert(_surface.pitch >= pitch);
 	JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE, pitch, 1);
 
+	// Scanlines for other formats are assembled in RGBA8888 first
+	JSAMPARRAY rowBuffer = 0;
+	if (surface.format != format)
+		rowBuffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE, cinfo.output_width * format.bytesPerPixel, 1);
+	else
+		assert(surface.pitch >= pitch);
+
 	// Go through the image data scanline by scanline
 	while (cinfo.output_scanline < cinfo.output_height) {
-		byte *dst = (byte *)_surface.getBasePtr(0, cinfo.output_scanline);
+		byte *row = (byte *)surface.getBasePtr(0, cinfo.output_scanline);
+		byte *dst = rowBuffer ? rowBuffer[0] : row;
 
 		jpeg_read_scanlines(&cinfo, buffer, 1);
 
@@ -262,6 +297,9 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			memcpy(dst, src, pitch);
 			break;
 		}
+
+		if (rowBuffer)
+			Graphics::crossBlit(row, rowBuffer[0], surface.pitch, cinfo.output_width * format.bytesPerPixel, cinfo.output_width, 1, surface.format, format);
 	}
 
 	// We are done with decompressing, thus free all the data
@@ -92,7 +92,31 @@ public:
 	 */
 	void setOutputColorSpace(ColorSpace outSpace) { _colorSpace = outSpace; }
 
+	/**
+	 * Decode an image straight into a surface provided by the caller.
+	 *
+	 * The scanlines are converted to the requested pixel format as they are
+	 * decoded, so that no copy of the image in RGBA8888 has to be kept
+	 * around. This requires the RGBA output color space.
+	 *
+	 * The image can be scaled down for thumbnails. libjpeg does this while
+	 * decoding, which is a lot faster than decoding the full image.
+	 *
+	 * The surface is created with the size of the scaled image, unless it
+	 * already has that size and the requested format.
+	 *
+	 * @param stream  the stream to read the image from
+	 * @param surface the surface to decode the image into
+	 * @param format  the pixel format of the surface, with 2 or 4 bytes
+	 *                per pixel
+	 * @param scale   the factor to scale the image down by: 1, 2, 4 or 8
+	 * @return whether the image could be decoded
+	 */
+	bool loadStreamInto(Common::SeekableReadStream &stream, Graphics::Surface &surface, const Graphics::PixelFormat &format, uint scale = 1);
+
 private:
+	bool decode(Common::SeekableReadStream &stream, Graphics::Surface &surface, const Graphics::PixelFormat *format, uint scale);
+
 	Graphics::Surface _surface;
 	ColorSpace _colorSpace;
 };
@@ -31,6 +31,7 @@
 
 #include "image/png.h"
 
+#include "graphics/conversion.h"
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
 
@@ -96,9 +97,22 @@ void pngFlushStream(png_structp pngPtr) {
  */
 
 bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
-#ifdef USE_PNG
 	destroy();
 
+	_outputSurface = new Graphics::Surface();
+	return decode(stream, *_outputSurface, 0, 1);
+}
+
+bool PNGDecoder::loadStreamInto(Common::SeekableReadStream &stream, Graphics::Surface &surface, const Graphics::PixelFormat &format, uint scale) {
+	destroy();
+
+	return decode(stream, surface, &format, scale);
+}
+
+bool PNGDecoder::decode(Common::SeekableReadStream &stream, Graphics::Surface &surface, const Graphics::PixelFormat *format, uint scale) {
+#ifdef USE_PNG
+	assert(scale > 0);
+
 	// First, check the PNG signature (if not set to skip it)
 	if (!_skipSignature) {
 		if (stream.readUint32BE() != MKTAG(0x89, 'P', 'N', 'G')) {
@@ -141,13 +155,22 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	width = w;
 	height = h;
 
-	// Allocate memory for the final image data.
-	// To keep memory framentation low this happens before allocating memory for temporary image data.
-	_outputSurface = new Graphics::Surface();
-
 	// Images of all color formats except PNG_COLOR_TYPE_PALETTE
-	// will be transformed into ARGB images
-	if (colorType == PNG_COLOR_TYPE_PALETTE && !png_get_valid(pngPtr, infoPtr, PNG_INFO_tRNS)) {
+	// will be transformed into ARGB images. Images with a palette are
+	// too, unless another format than CLUT8 is requested.
+	bool keepPalette = colorType == PNG_COLOR_TYPE_PALETTE && !png_get_valid(pngPtr, infoPtr, PNG_INFO_tRNS);
+	if (format && (format->bytesPerPixel == 1) != keepPalette) {
+		if (keepPalette) {
+			keepPalette = false;
+		} else {
+			warning("PNGDecoder: Cannot decode an image without a palette to CLUT8");
+			png_destroy_read_struct(&pngPtr, &infoPtr, NULL);
+			return false;
+		}
+	}
+
+	Graphics::PixelFormat decodeFormat;
+	if (keepPalette) {
 		int numPalette = 0;
 		png_colorp palette = NULL;
 		uint32 success = png_get_PLTE(pngPtr, infoPtr, &palette, &numPalette);
@@ -163,7 +186,7 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			_palette[(i * 3) + 2] = palette[i].blue;
 
 		}
-		_outputSurface->create(width, height, Graphics::PixelFormat::createFormatCLUT8());
+		decodeFormat = Graphics::PixelFormat::createFormatCLUT8();
 		png_set_packing(pngPtr);
 	} else {
 		bool isAlpha = (colorType & PNG_COLOR_MASK_ALPHA);
@@ -171,14 +194,10 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			isAlpha = true;
 			png_set_expand(pngPtr);
 		}
-		_outputSurface->create(width, height, Graphics::PixelFormat(4,
-		                       8, 8, 8, isAlpha ? 8 : 0, 24, 16, 8, 0));
-		if (!_outputSurface->getPixels()) {
-			error("Could not allocate memory for output image.");
-		}
+		decodeFormat = Graphics::PixelFormat(4, 8, 8, 8, isAlpha ? 8 : 0, 24, 16, 8, 0);
 		if (bitDepth == 16)
 			png_set_strip_16(pngPtr);
-		if (bitDepth < 8)
+		if (bitDepth < 8 || colorType == PNG_COLOR_TYPE_PALETTE)
 			png_set_expand(pngPtr);
 		if (colorType == PNG_COLOR_TYPE_GRAY ||
 			colorType == PNG_COLOR_TYPE_GRAY_ALPHA)
@@ -204,12 +223,28 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	width = w;
 	height = h;
 
-	if (interlaceType == PNG_INTERLACE_NONE) {
+	// Allocate memory for the final image data.
+	// To keep memory framentation low this happens before allocating memory for temporary image data.
+	const Graphics::PixelFormat &outputFormat = format ? *format : decodeFormat;
+	const int outputWidth = (width + scale - 1) / scale;
+	const int outputHeight = (height + scale - 1) / scale;
+	if (surface.w != outputWidth || surface.h != outputHeight || surface.format != outputFormat || !surface.getPixels()) {
+		surface.free();
+		surface.create(outputWidth, outputHeight, outputFormat);
+	}
+	if (!surface.getPixels()) {
+		error("Could not allocate memory for output image.");
+	}
+
+	// Rows in the decoded format can go straight to the surface
+	const bool direct = scale == 1 && outputFormat == decodeFormat;
+
+	if (direct && interlaceType == PNG_INTERLACE_NONE) {
 		// PNGs without interlacing can simply be read row by row.
 		for (int i = 0; i < height; i++) {
-			png_read_row(pngPtr, (png_bytep)_outputSurface->getBasePtr(0, i), NULL);
+			png_read_row(pngPtr, (png_bytep)surface.getBasePtr(0, i), NULL);
 		}
-	} else {
+	} else if (direct) {
 		// PNGs with interlacing require us to allocate an auxillary
 		// buffer with pointers to all row starts.
 
@@ -221,13 +256,55 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 
 		// Initialize row pointers
 		for (int i = 0; i < height; i++)
-			rowPtr[i] = (png_bytep)_outputSurface->getBasePtr(0, i);
+			rowPtr[i] = (png_bytep)surface.getBasePtr(0, i);
 
 		// Read image data
 		png_read_image(pngPtr, rowPtr);
 
 		// Free row pointer buffer
 		delete[] rowPtr;
+	} else {
+		// Otherwise the rows are decoded into a buffer first. Interlaced
+		// images are only complete after the last pass, so they need the
+		// whole image.
+		const int rowSize = width * decodeFormat.bytesPerPixel;
+		const int bufferRows = (interlaceType == PNG_INTERLACE_NONE) ? 1 : height;
+		Common::Array<byte> buffer(rowSize * bufferRows);
+
+		if (interlaceType != PNG_INTERLACE_NONE) {
+			Common::Array<png_bytep> rowPtr(height);
+			for (int i = 0; i < height; i++)
+				rowPtr[i] = &buffer[i * rowSize];
+
+			png_read_image(pngPtr, &rowPtr.front());
+		}
+
+		for (int i = 0; i < height; i++) {
+			byte *row = &buffer[(bufferRows == 1) ? 0 : i * rowSize];
+			if (bufferRows == 1)
+				png_read_row(pngPtr, row, NULL);
+
+			if (i % scale)
+				continue;
+
+			// Keep every scale-th pixel, the buffer can be reused for that
+			if (scale > 1) {
+				if (decodeFormat.bytesPerPixel == 1) {
+					for (int x = 1; x < outputWidth; x++)
+						row[x] = row[x * scale];
+				} else {
+					uint32 *pixels = (uint32 *)row;
+					for (int x = 1; x < outputWidth; x++)
+						pixels[x] = pixels[x * scale];
+				}
+			}
+
+			byte *dst = (byte *)surface.getBasePtr(0, i / scale);
+			if (outputFormat == decodeFormat)
+				memcpy(dst, row, outputWidth * decodeFormat.bytesPerPixel);
+			else
+				Graphics::crossBlit(dst, row, surface.pitch, rowSize, outputWidth, 1, outputFormat, decodeFormat);
+		}
 	}
 
 	// Read additional data at the end.
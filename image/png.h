@@ -41,6 +41,7 @@ class WriteStream;
 }
 
 namespace Graphics {
+struct PixelFormat;
 struct Surface;
 }
 
@@ -57,7 +58,33 @@ public:
 	const byte *getPalette() const { return _palette; }
 	uint16 getPaletteColorCount() const { return _paletteColorCount; }
 	void setSkipSignature(bool skip) { _skipSignature = skip; }
+
+	/**
+	 * Decode an image straight into a surface provided by the caller.
+	 *
+	 * The rows are converted to the requested pixel format as they are
+	 * decoded, so that no copy of the image in the format of the file has
+	 * to be kept around. Only interlaced images still need one.
+	 *
+	 * The image can be scaled down for thumbnails, in which case only
+	 * every scale-th pixel of every scale-th row is kept.
+	 *
+	 * The surface is created with the size of the scaled image, unless it
+	 * already has that size and the requested format.
+	 *
+	 * @param stream  the stream to read the image from
+	 * @param surface the surface to decode the image into
+	 * @param format  the pixel format of the surface; it either has 2 or 4
+	 *                bytes per pixel, or is CLUT8 for images with a palette
+	 *                and without transparency
+	 * @param scale   the factor to scale the image down by
+	 * @return whether the image could be decoded
+	 */
+	bool loadStreamInto(Common::SeekableReadStream &stream, Graphics::Surface &surface, const Graphics::PixelFormat &format, uint scale = 1);
+
 private:
+	bool decode(Common::SeekableReadStream &stream, Graphics::Surface &surface, const Graphics::PixelFormat *format, uint scale);
+
 	byte *_palette;
 	uint16 _paletteColorCount;
 
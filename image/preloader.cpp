@@ -0,0 +1,199 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "image/preloader.h"
+
+#include "common/stream.h"
+#include "common/textconsole.h"
+
+#include "graphics/surface.h"
+
+#include "image/bmp.h"
+#include "image/jpeg.h"
+#include "image/png.h"
+#include "image/tga.h"
+
+namespace Image {
+
+ImagePreloader::ImagePreloader(uint32 memoryBudget) : _memoryBudget(memoryBudget), _memoryUsage(0) {
+}
+
+ImagePreloader::~ImagePreloader() {
+	clear();
+}
+
+ImageDecoder *ImagePreloader::createDecoder(const Common::String &name) {
+	Common::String lowerName = name;
+	lowerName.toLowercase();
+
+	if (lowerName.hasSuffix(".bmp"))
+		return new BitmapDecoder();
+	if (lowerName.hasSuffix(".jpg") || lowerName.hasSuffix(".jpeg"))
+		return new JPEGDecoder();
+	if (lowerName.hasSuffix(".png"))
+		return new PNGDecoder();
+	if (lowerName.hasSuffix(".tga"))
+		return new TGADecoder();
+
+	return 0;
+}
+
+bool ImagePreloader::prefetch(const Common::String &name, Common::SeekableReadStream &stream) {
+	if (_entries.contains(name))
+		return false;
+
+	const uint32 size = stream.size() - stream.pos();
+	if (size > _memoryBudget)
+		return false;
+
+	ImageDecoder *decoder = createDecoder(name);
+	if (!decoder)
+		return false;
+
+	evict(size);
+
+	Entry *entry = new Entry();
+	entry->owner = this;
+	entry->name = name;
+	entry->decoder = decoder;
+	entry->stream = stream.readStream(size);
+	entry->size = size;
+	entry->done = false;
+	entry->failed = false;
+
+	{
+		Common::StackLock lock(_mutex);
+		_memoryUsage += size;
+	}
+
+	_entries[name] = entry;
+	_order.push_back(entry);
+
+	JobMan.submit(decodeProc, entry, entry->counter);
+	return true;
+}
+
+void ImagePreloader::decodeProc(void *param) {
+	Entry *entry = (Entry *)param;
+
+	const bool success = entry->decoder->loadStream(*entry->stream) && entry->decoder->getSurface();
+	delete entry->stream;
+	entry->stream = 0;
+
+	uint32 size = 0;
+	if (success) {
+		const Graphics::Surface *surface = entry->decoder->getSurface();
+		size = surface->pitch * surface->h;
+	} else {
+		warning("ImagePreloader: Could not decode '%s'", entry->name.c_str());
+	}
+
+	Common::StackLock lock(entry->owner->_mutex);
+	entry->owner->_memoryUsage += size - entry->size;
+	entry->size = size;
+	entry->failed = !success;
+	entry->done = true;
+}
+
+ImageDecoder *ImagePreloader::take(const Common::String &name) {
+	EntryMap::iterator i = _entries.find(name);
+	if (i == _entries.end())
+		return 0;
+
+	Entry *entry = i->_value;
+	JobMan.wait(entry->counter);
+
+	// The caller takes over the memory of the image
+	ImageDecoder *decoder = 0;
+	if (!entry->failed) {
+		decoder = entry->decoder;
+		entry->decoder = 0;
+	}
+
+	remove(entry);
+	return decoder;
+}
+
+bool ImagePreloader::isPrefetched(const Common::String &name) const {
+	EntryMap::const_iterator i = _entries.find(name);
+	if (i == _entries.end())
+		return false;
+
+	Common::StackLock lock(_mutex);
+	return !i->_value->failed;
+}
+
+void ImagePreloader::clear() {
+	while (!_order.empty()) {
+		Entry *entry = _order.front();
+		JobMan.wait(entry->counter);
+		remove(entry);
+	}
+}
+
+uint32 ImagePreloader::getMemoryUsage() const {
+	Common::StackLock lock(_mutex);
+	return _memoryUsage;
+}
+
+void ImagePreloader::evict(uint32 size) {
+	// Images still being decoded are only waited for once all finished ones
+	// have been dropped, as they may be needed soon.
+	for (Common::List<Entry *>::iterator i = _order.begin(); i != _order.end() && getMemoryUsage() + size > _memoryBudget; ) {
+		Entry *entry = *i++;
+
+		bool done;
+		{
+			Common::StackLock lock(_mutex);
+			done = entry->done;
+		}
+
+		if (done) {
+			// The job may still be about to release the counter
+			JobMan.wait(entry->counter);
+			remove(entry);
+		}
+	}
+
+	while (!_order.empty() && getMemoryUsage() + size > _memoryBudget) {
+		Entry *entry = _order.front();
+		JobMan.wait(entry->counter);
+		remove(entry);
+	}
+}
+
+void ImagePreloader::remove(Entry *entry) {
+	// Must only be called once the counter of the entry has been waited for
+	{
+		Common::StackLock lock(_mutex);
+		_memoryUsage -= entry->size;
+	}
+
+	_entries.erase(entry->name);
+	_order.remove(entry);
+
+	delete entry->decoder;
+	delete entry->stream;
+	delete entry;
+}
+
+} // End of namespace Image
@@ -0,0 +1,141 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef IMAGE_PRELOADER_H
+#define IMAGE_PRELOADER_H
+
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/jobs.h"
+#include "common/list.h"
+#include "common/mutex.h"
+#include "common/noncopyable.h"
+#include "common/str.h"
+
+namespace Common {
+class SeekableReadStream;
+}
+
+namespace Image {
+
+class ImageDecoder;
+
+/**
+ * Decodes images in the background before they are needed.
+ *
+ * Engines which load their images lazily on first use can pass hints about
+ * images which are going to be needed soon, e.g. when a scene is set up.
+ * These are decoded on the worker threads of the job system, and the
+ * decoders holding the finished images are handed over when the images are
+ * actually needed.
+ *
+ * The data of the images is read into memory on the calling thread, since
+ * archives often share one file handle among their members. Only decoding
+ * is done on the workers.
+ *
+ * The memory used by the images, and by the data of those still waiting to
+ * be decoded, is kept within a budget. Once it is reached, the images
+ * which have been prefetched first are dropped to make room. Images which
+ * are not taken thus only cost the time of the workers.
+ *
+ * If the backend does not support threads, the images are decoded right
+ * away by prefetch().
+ */
+class ImagePreloader : Common::NonCopyable {
+public:
+	/**
+	 * @param memoryBudget the number of bytes the prefetched images may use
+	 */
+	explicit ImagePreloader(uint32 memoryBudget);
+	~ImagePreloader();
+
+	/**
+	 * Start decoding an image which is going to be needed soon.
+	 *
+	 * The decoder is chosen by the extension of the name: .bmp, .jpg,
+	 * .png and .tga are supported.
+	 *
+	 * @param name   the name to take the image by
+	 * @param stream the stream holding the image, which is read up to its
+	 *               end before this returns
+	 * @return whether decoding has been started; false if the image is
+	 *         already prefetched, has an unknown type, or does not fit
+	 *         into the budget
+	 */
+	bool prefetch(const Common::String &name, Common::SeekableReadStream &stream);
+
+	/**
+	 * Take a prefetched image. If it is still being decoded, wait for it.
+	 *
+	 * @param name the name passed to prefetch()
+	 * @return the decoder holding the image, which the caller has to
+	 *         delete; 0 if the image was not prefetched, has been dropped,
+	 *         or could not be decoded
+	 */
+	ImageDecoder *take(const Common::String &name);
+
+	/**
+	 * Check whether an image is prefetched and can be taken.
+	 */
+	bool isPrefetched(const Common::String &name) const;
+
+	/**
+	 * Drop all prefetched images, e.g. when leaving a scene.
+	 */
+	void clear();
+
+	/**
+	 * Return the number of bytes currently used by the prefetched images.
+	 */
+	uint32 getMemoryUsage() const;
+
+private:
+	struct Entry {
+		ImagePreloader *owner;
+		Common::String name;
+		ImageDecoder *decoder;
+		Common::SeekableReadStream *stream;
+		uint32 size;	///< Size of the stream, then of the decoded image
+		bool done;
+		bool failed;
+		Common::JobSystem::Counter counter;
+	};
+
+	typedef Common::HashMap<Common::String, Entry *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> EntryMap;
+
+	static ImageDecoder *createDecoder(const Common::String &name);
+	static void decodeProc(void *param);
+
+	void evict(uint32 size);
+	void remove(Entry *entry);
+
+	uint32 _memoryBudget;
+	uint32 _memoryUsage;	///< Guarded by _mutex, as decoding updates it
+
+	EntryMap _entries;
+	Common::List<Entry *> _order;	///< In the order the images were prefetched
+	Common::Mutex _mutex;
+};
+
+} // End of namespace Image
+
+#endif
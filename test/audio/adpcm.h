@@ -0,0 +1,144 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/decoders/adpcm.h"
+#include "audio/decoders/adpcm_intern.h"
+#include "common/memstream.h"
+#include "common/util.h"
+
+#include "test/random.h"
+
+class ADPCMTestSuite : public CxxTest::TestSuite
+{
+private:
+	// The per-sample IMA decoder the block decoder replaces
+	static int16 decodeReference(Audio::IMAChannelStatus &status, byte code, Audio::IMAVariant variant) {
+		const int32 step = Audio::Ima_ADPCMStream::_imaTable[status.stepIndex];
+		int32 diff;
+
+		if (variant == Audio::kIMAShiftAdd) {
+			diff = step >> 3;
+			if (code & 4)
+				diff += step;
+			if (code & 2)
+				diff += step >> 1;
+			if (code & 1)
+				diff += step >> 2;
+		} else {
+			diff = (2 * (code & 0x7) + 1) * step / 8;
+		}
+
+		status.last = CLIP<int32>((code & 0x08) ? status.last - diff : status.last + diff, -32768, 32767);
+		status.stepIndex = CLIP<int32>(status.stepIndex + Audio::ADPCMStream::_stepAdjustTable[code], 0, 88);
+		return status.last;
+	}
+
+	void decodeBufferTestTemplate(Audio::IMAVariant variant, bool highNibbleFirst) {
+		const uint32 size = 4096;
+		byte *data = new byte[size];
+		Test::fillRandom(data, size, 0x12345678);
+
+		int16 *expected = new int16[size * 2];
+		Audio::IMAChannelStatus status = { 0, 0 };
+		for (uint32 i = 0; i < size; i++) {
+			expected[i * 2] = decodeReference(status, highNibbleFirst ? data[i] >> 4 : data[i] & 0x0F, variant);
+			expected[i * 2 + 1] = decodeReference(status, highNibbleFirst ? data[i] & 0x0F : data[i] >> 4, variant);
+		}
+
+		// Decode in uneven pieces into every other sample of the buffer
+		int16 *buffer = new int16[size * 4];
+		Audio::IMAChannelStatus blockStatus = { 0, 0 };
+		for (uint32 pos = 0, piece = 1; pos < size; pos += piece, piece = piece * 2 + 1) {
+			piece = MIN(piece, size - pos);
+			Audio::decodeIMABuffer(blockStatus, data + pos, piece, buffer + pos * 4, 2, highNibbleFirst, variant);
+		}
+
+		bool equal = true;
+		for (uint32 i = 0; i < size * 2; i++)
+			equal = equal && (buffer[i * 2] == expected[i]);
+		TS_ASSERT(equal);
+		TS_ASSERT_EQUALS(blockStatus.last, status.last);
+		TS_ASSERT_EQUALS(blockStatus.stepIndex, status.stepIndex);
+
+		delete[] data;
+		delete[] expected;
+		delete[] buffer;
+	}
+
+	static Audio::SeekableAudioStream *makeStream(const byte *data, uint32 size, Audio::ADPCMType type, int channels, uint32 blockAlign) {
+		Common::MemoryReadStream *stream = new Common::MemoryReadStream(data, size);
+		return Audio::makeADPCMStream(stream, DisposeAfterUse::YES, size, type, 22050, channels, blockAlign);
+	}
+
+	// Reading a stream in small pieces gives the same samples as reading it at once
+	void readBufferTestTemplate(Audio::ADPCMType type, int channels, uint32 blockAlign) {
+		const uint32 unit = blockAlign ? blockAlign : 100;
+		const uint32 size = unit * 7 + unit / 2;
+		byte *data = new byte[size];
+		Test::fillRandom(data, size, 0x12345678);
+
+		const int maxSamples = size * 2 + 64;
+		int16 *expected = new int16[maxSamples];
+		Audio::SeekableAudioStream *s = makeStream(data, size, type, channels, blockAlign);
+		const int total = s->readBuffer(expected, maxSamples);
+		TS_ASSERT(total > 0);
+		TS_ASSERT(s->endOfData());
+		delete s;
+
+		int16 *buffer = new int16[maxSamples];
+		s = makeStream(data, size, type, channels, blockAlign);
+		int samples = 0;
+		for (int piece = channels; samples < maxSamples && !s->endOfData(); piece += channels) {
+			const int read = s->readBuffer(buffer + samples, MIN(piece, maxSamples - samples));
+			if (read <= 0)
+				break;
+			samples += read;
+		}
+
+		TS_ASSERT_EQUALS(samples, total);
+		TS_ASSERT_EQUALS(memcmp(expected, buffer, total * sizeof(int16)), 0);
+
+		// Rewinding starts decoding over
+		TS_ASSERT(s->rewind());
+		TS_ASSERT_EQUALS(s->readBuffer(buffer, maxSamples), total);
+		TS_ASSERT_EQUALS(memcmp(expected, buffer, total * sizeof(int16)), 0);
+
+		delete s;
+		delete[] data;
+		delete[] expected;
+		delete[] buffer;
+	}
+
+public:
+	void test_decode_ima_buffer() {
+		decodeBufferTestTemplate(Audio::kIMAStandard, false);
+		decodeBufferTestTemplate(Audio::kIMAStandard, true);
+	}
+
+	void test_decode_ima_buffer_shift_add() {
+		decodeBufferTestTemplate(Audio::kIMAShiftAdd, false);
+	}
+
+	void test_read_buffer_oki() {
+		readBufferTestTemplate(Audio::kADPCMOki, 1, 0);
+	}
+
+	void test_read_buffer_dvi() {
+		readBufferTestTemplate(Audio::kADPCMDVI, 1, 0);
+		readBufferTestTemplate(Audio::kADPCMDVI, 2, 0);
+	}
+
+	void test_read_buffer_ms_ima() {
+		readBufferTestTemplate(Audio::kADPCMMSIma, 1, 256);
+		readBufferTestTemplate(Audio::kADPCMMSIma, 2, 512);
+	}
+
+	void test_read_buffer_ms() {
+		readBufferTestTemplate(Audio::kADPCMMS, 1, 256);
+		readBufferTestTemplate(Audio::kADPCMMS, 2, 512);
+	}
+
+	void test_read_buffer_apple() {
+		readBufferTestTemplate(Audio::kADPCMApple, 1, 34);
+		readBufferTestTemplate(Audio::kADPCMApple, 2, 34);
+	}
+};
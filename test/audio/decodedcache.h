@@ -0,0 +1,104 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/audiostream.h"
+#include "audio/decodedcache.h"
+#include "audio/timestamp.h"
+
+#include "helper.h"
+
+class DecodedAudioCacheTestSuite : public CxxTest::TestSuite
+{
+public:
+	void test_insert_find() {
+		Audio::DecodedAudioCache cache(1024 * 1024);
+		TS_ASSERT(!cache.find("sine"));
+
+		int16 *sine;
+		Audio::SeekableAudioStream *s = cache.insert("sine", createSineStream<int16>(11025, 1, &sine, false, true));
+		TS_ASSERT(s);
+		TS_ASSERT_EQUALS(cache.getCount(), 1u);
+		TS_ASSERT_EQUALS(cache.getSize(), 11025u * 2 * sizeof(int16));
+
+		Audio::SeekableAudioStream *s2 = cache.find("sine");
+		TS_ASSERT(s2);
+		TS_ASSERT(s2->isStereo());
+		TS_ASSERT_EQUALS(s2->getRate(), 11025);
+		TS_ASSERT_EQUALS(s2->getLength().totalNumberOfFrames(), 11025);
+
+		// Both streams play the same samples, independently of each other
+		int16 *buffer = new int16[11025 * 2];
+		TS_ASSERT_EQUALS(s->readBuffer(buffer, 1000), 1000);
+		TS_ASSERT_EQUALS(memcmp(buffer, sine, 1000 * sizeof(int16)), 0);
+		TS_ASSERT_EQUALS(s2->readBuffer(buffer, 11025 * 2), 11025 * 2);
+		TS_ASSERT_EQUALS(memcmp(buffer, sine, 11025 * 2 * sizeof(int16)), 0);
+		TS_ASSERT(s2->endOfData());
+
+		// Seeking is sample exact
+		TS_ASSERT(s->seek(Audio::Timestamp(0, 5000, 11025)));
+		TS_ASSERT_EQUALS(s->readBuffer(buffer, 10), 10);
+		TS_ASSERT_EQUALS(memcmp(buffer, sine + 10000, 10 * sizeof(int16)), 0);
+
+		delete[] buffer;
+		delete[] sine;
+		delete s;
+		delete s2;
+	}
+
+	void test_streams_outlive_cache() {
+		int16 *sine;
+		Audio::SeekableAudioStream *s;
+		{
+			Audio::DecodedAudioCache cache(1024 * 1024);
+			s = cache.insert("sine", createSineStream<int16>(8000, 1, &sine, false, false));
+		}
+
+		int16 *buffer = new int16[8000];
+		TS_ASSERT_EQUALS(s->readBuffer(buffer, 8000), 8000);
+		TS_ASSERT_EQUALS(memcmp(buffer, sine, 8000 * sizeof(int16)), 0);
+
+		delete[] buffer;
+		delete[] sine;
+		delete s;
+	}
+
+	void test_lru_eviction() {
+		// Room for two sounds of one second
+		Audio::DecodedAudioCache cache(2 * 8000 * sizeof(int16));
+
+		delete cache.insert("a", createSineStream<int16>(8000, 1, 0, false, false));
+		delete cache.insert("b", createSineStream<int16>(8000, 1, 0, false, false));
+		delete cache.find("a");
+		delete cache.insert("c", createSineStream<int16>(8000, 1, 0, false, false));
+
+		TS_ASSERT_EQUALS(cache.getCount(), 2u);
+		Audio::SeekableAudioStream *s;
+		TS_ASSERT(s = cache.find("a"));
+		delete s;
+		TS_ASSERT(!cache.find("b"));
+		TS_ASSERT(s = cache.find("c"));
+		delete s;
+
+		cache.setMaxSize(8000 * sizeof(int16));
+		TS_ASSERT_EQUALS(cache.getCount(), 1u);
+		TS_ASSERT(s = cache.find("c"));
+		delete s;
+	}
+
+	void test_too_large() {
+		Audio::DecodedAudioCache cache(1000);
+
+		int16 *sine;
+		Audio::SeekableAudioStream *s = cache.insert("sine", createSineStream<int16>(8000, 1, &sine, false, false));
+		TS_ASSERT(s);
+		TS_ASSERT_EQUALS(cache.getCount(), 0u);
+
+		// The source is returned from its beginning
+		int16 *buffer = new int16[8000];
+		TS_ASSERT_EQUALS(s->readBuffer(buffer, 8000), 8000);
+		TS_ASSERT_EQUALS(memcmp(buffer, sine, 8000 * sizeof(int16)), 0);
+
+		delete[] buffer;
+		delete[] sine;
+		delete s;
+	}
+};
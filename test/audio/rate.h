@@ -0,0 +1,106 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/audiostream.h"
+#include "audio/mixer.h"
+#include "audio/rate.h"
+
+#include "helper.h"
+
+class RateConverterTestSuite : public CxxTest::TestSuite
+{
+private:
+	void accumulateTestTemplate(const int inRate, const int outRate, const bool isStereo, const Audio::RateConverterQuality quality = Audio::kRateConverterFast) {
+		const int outSamples = 4000;
+
+		Audio::SeekableAudioStream *s1 = createSineStream<int16>(inRate, 1, 0, false, isStereo);
+		Audio::SeekableAudioStream *s2 = createSineStream<int16>(inRate, 1, 0, false, isStereo);
+		Audio::RateConverter *conv1 = Audio::makeRateConverter(inRate, outRate, isStereo, false, quality);
+		Audio::RateConverter *conv2 = Audio::makeRateConverter(inRate, outRate, isStereo, false, quality);
+
+		int16 *clipped = new int16[outSamples * 2];
+		Audio::st_accum_t *accum = new Audio::st_accum_t[outSamples * 2];
+		memset(clipped, 0, outSamples * 2 * sizeof(int16));
+		memset(accum, 0, outSamples * 2 * sizeof(Audio::st_accum_t));
+
+		const int vol = Audio::Mixer::kMaxMixerVolume / 2;
+		TS_ASSERT_EQUALS(conv1->flow(*s1, clipped, outSamples, vol, vol), outSamples);
+		TS_ASSERT_EQUALS(conv2->flowAccumulate(*s2, accum, outSamples, vol, vol), outSamples);
+
+		// Below full scale both paths must produce the same samples.
+		bool equal = true;
+		for (int i = 0; i < outSamples * 2; ++i)
+			equal &= (clipped[i] == accum[i]);
+		TS_ASSERT(equal);
+
+		// Mixing the stream in again at full volume exceeds the 16-bit
+		// range, which the accumulator has to preserve.
+		s2->rewind();
+		delete conv2;
+		conv2 = Audio::makeRateConverter(inRate, outRate, isStereo, false, quality);
+		conv2->flowAccumulate(*s2, accum, outSamples, Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume);
+
+		Audio::st_accum_t maxValue = 0;
+		for (int i = 0; i < outSamples * 2; ++i)
+			maxValue = MAX(maxValue, accum[i]);
+		TS_ASSERT_LESS_THAN((Audio::st_accum_t)Audio::ST_SAMPLE_MAX, maxValue);
+
+		delete[] clipped;
+		delete[] accum;
+		delete conv1;
+		delete conv2;
+		delete s1;
+		delete s2;
+	}
+
+public:
+	void test_accumulate_copy_mono() {
+		accumulateTestTemplate(22050, 22050, false);
+	}
+
+	void test_accumulate_copy_stereo() {
+		accumulateTestTemplate(22050, 22050, true);
+	}
+
+	void test_accumulate_simple() {
+		accumulateTestTemplate(44100, 22050, true);
+	}
+
+	void test_accumulate_linear() {
+		accumulateTestTemplate(11025, 22050, false);
+	}
+
+	void test_accumulate_sinc() {
+		accumulateTestTemplate(11025, 48000, true, Audio::kRateConverterHQ);
+		accumulateTestTemplate(48000, 22050, false, Audio::kRateConverterHQ);
+	}
+
+	void test_sinc_constant() {
+		// A constant signal has to stay constant, once the filter has
+		// been filled with input samples.
+		const int inSamples = 2000;
+		const int outSamples = 4000;
+		const int16 value = 10000;
+
+		byte *data = (byte *)malloc(inSamples * 2);
+		for (int i = 0; i < inSamples; ++i)
+			WRITE_BE_UINT16(data + i * 2, value);
+
+		Audio::SeekableAudioStream *s = Audio::makeRawStream(data, inSamples * 2, 22050, Audio::FLAG_16BITS);
+		Audio::RateConverter *conv = Audio::makeRateConverter(22050, 48000, false, false, Audio::kRateConverterHQ);
+
+		Audio::st_accum_t *accum = new Audio::st_accum_t[outSamples * 2];
+		memset(accum, 0, outSamples * 2 * sizeof(Audio::st_accum_t));
+
+		const int res = conv->flowAccumulate(*s, accum, outSamples, Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume);
+		TS_ASSERT_LESS_THAN(outSamples / 2, res);
+
+		int maxError = 0;
+		for (int i = 100; i < res * 2; ++i)
+			maxError = MAX<int>(maxError, ABS(accum[i] - value));
+		TS_ASSERT_LESS_THAN(maxError, 4);
+
+		delete[] accum;
+		delete conv;
+		delete s;
+	}
+};
@@ -3,8 +3,20 @@
 #include "audio/decoders/raw.h"
 #include "audio/audiostream.h"
 
+#include "common/memstream.h"
+#include "common/substream.h"
+
 #include "helper.h"
 
+// A memory stream which does not expose its memory, so the raw stream has
+// to read its samples through a buffer
+class UnmappedMemoryReadStream : public Common::MemoryReadStream {
+public:
+	UnmappedMemoryReadStream(const byte *dataPtr, uint32 dataSize) : Common::MemoryReadStream(dataPtr, dataSize) {}
+
+	const byte *getContiguousView(uint32 offset, uint32 size) const { return nullptr; }
+};
+
 class RawStreamTestSuite : public CxxTest::TestSuite
 {
 private:
@@ -288,4 +300,52 @@ public:
 	void test_seek_stereo() {
 		seekTest(11025, 2, true);
 	}
+
+private:
+	void readStreamTest(bool mapped) {
+		const int sampleRate = 11025;
+		const int total = sampleRate * 2;
+
+		// Play the second half of the data through a sub stream
+		int16 *data = new int16[total];
+		for (int i = 0; i < total; ++i)
+			WRITE_BE_UINT16(&data[i], i * 3);
+
+		Common::SeekableReadStream *parent;
+		if (mapped)
+			parent = new Common::MemoryReadStream((const byte *)data, total * sizeof(int16));
+		else
+			parent = new UnmappedMemoryReadStream((const byte *)data, total * sizeof(int16));
+
+		Common::SeekableReadStream *sub = new Common::SeekableSubReadStream(parent, sampleRate * sizeof(int16), total * sizeof(int16), DisposeAfterUse::YES);
+		Audio::SeekableAudioStream *s = Audio::makeRawStream(sub, sampleRate, Audio::FLAG_16BITS);
+		TS_ASSERT_EQUALS(s->getLength().totalNumberOfFrames(), sampleRate);
+
+		int16 *buffer = new int16[sampleRate];
+		TS_ASSERT_EQUALS(s->readBuffer(buffer, 1000), 1000);
+		TS_ASSERT_EQUALS(s->readBuffer(buffer + 1000, sampleRate), sampleRate - 1000);
+		TS_ASSERT_EQUALS(s->endOfData(), true);
+
+		bool equal = true;
+		for (int i = 0; i < sampleRate; ++i)
+			equal = equal && (buffer[i] == (int16)((sampleRate + i) * 3));
+		TS_ASSERT(equal);
+
+		TS_ASSERT_EQUALS(s->seek(Audio::Timestamp(0, sampleRate - 10, sampleRate)), true);
+		TS_ASSERT_EQUALS(s->readBuffer(buffer, sampleRate), 10);
+		TS_ASSERT_EQUALS(buffer[0], (int16)((sampleRate * 2 - 10) * 3));
+
+		delete s;
+		delete[] buffer;
+		delete[] data;
+	}
+
+public:
+	void test_read_memory_view() {
+		readStreamTest(true);
+	}
+
+	void test_read_unmapped_stream() {
+		readStreamTest(false);
+	}
 };
@@ -0,0 +1,90 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/audiostream.h"
+#include "audio/mixer.h"
+#include "audio/rate.h"
+
+class AudioBenchmarkSuite : public CxxTest::TestSuite
+{
+	enum {
+		kOutSamples = 44100
+	};
+
+	// Endless sawtooth, so the converters never run out of input
+	class SawStream : public Audio::AudioStream {
+		const int _rate;
+		const bool _stereo;
+		int16 _value;
+
+	public:
+		SawStream(int rate, bool stereo) : _rate(rate), _stereo(stereo), _value(0) {}
+
+		int readBuffer(int16 *buffer, const int numSamples) {
+			for (int i = 0; i < numSamples; ++i) {
+				buffer[i] = _value;
+				_value += 97;
+			}
+			return numSamples;
+		}
+
+		bool isStereo() const { return _stereo; }
+		int getRate() const { return _rate; }
+		bool endOfData() const { return false; }
+	};
+
+	struct RateConvert : public Benchmark::Case {
+		SawStream input;
+		Audio::RateConverter *converter;
+		Audio::st_sample_t *output;
+		Audio::st_accum_t *accum;
+
+		RateConvert(int inRate, int outRate, bool stereo, Audio::RateConverterQuality quality, bool accumulate) : input(inRate, stereo) {
+			converter = Audio::makeRateConverter(inRate, outRate, stereo, false, quality);
+			output = accumulate ? 0 : new Audio::st_sample_t[kOutSamples * 2];
+			accum = accumulate ? new Audio::st_accum_t[kOutSamples * 2] : 0;
+		}
+
+		~RateConvert() {
+			delete converter;
+			delete[] output;
+			delete[] accum;
+		}
+
+		unsigned long run() {
+			const int vol = Audio::Mixer::kMaxMixerVolume / 2;
+			if (accum) {
+				memset(accum, 0, kOutSamples * 2 * sizeof(Audio::st_accum_t));
+				converter->flowAccumulate(input, accum, kOutSamples, vol, vol);
+			} else {
+				memset(output, 0, kOutSamples * 2 * sizeof(Audio::st_sample_t));
+				converter->flow(input, output, kOutSamples, vol, vol);
+			}
+			return kOutSamples;
+		}
+	};
+
+	static void measureRate(const char *name, int inRate, bool stereo, Audio::RateConverterQuality quality, bool accumulate = false) {
+		RateConvert convert(inRate, 44100, stereo, quality, accumulate);
+		Benchmark::measure(name, convert, "sample");
+	}
+
+public:
+	void test_rate_copy() {
+		measureRate("audio.rate.copy_stereo", 44100, true, Audio::kRateConverterFast);
+		measureRate("audio.rate.copy_stereo_accumulate", 44100, true, Audio::kRateConverterFast, true);
+	}
+
+	void test_rate_fast() {
+		measureRate("audio.rate.fast_22050_mono", 22050, false, Audio::kRateConverterFast);
+		measureRate("audio.rate.fast_22050_stereo", 22050, true, Audio::kRateConverterFast);
+	}
+
+	void test_rate_linear() {
+		measureRate("audio.rate.linear_22050_stereo", 22050, true, Audio::kRateConverterLinear);
+		measureRate("audio.rate.linear_22050_stereo_accumulate", 22050, true, Audio::kRateConverterLinear, true);
+	}
+
+	void test_rate_hq() {
+		measureRate("audio.rate.hq_22050_stereo", 22050, true, Audio::kRateConverterHQ);
+	}
+};
@@ -0,0 +1,83 @@
+#ifndef TEST_BENCHMARK_H
+#define TEST_BENCHMARK_H
+
+// This file is included ahead of everything else in the benchmark runner,
+// before common/forbidden.h gets a chance to forbid the C library functions
+// used here. It must thus not include any ScummVM headers.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+namespace Benchmark {
+
+/**
+ * A single timed case. run() is called repeatedly until the case has been
+ * running for long enough to get a stable measurement.
+ */
+class Case {
+public:
+	virtual ~Case() {}
+
+	/**
+	 * Do one round of the work to measure.
+	 *
+	 * @return the number of items handled, e.g. bytes or pixels, to report
+	 *         the time per item in
+	 */
+	virtual unsigned long run() = 0;
+};
+
+/** Minimum time each case is run for, in microseconds */
+static const unsigned long long kMinTime = 250000;
+
+inline unsigned long long getMicros() {
+	struct timeval tv;
+	gettimeofday(&tv, 0);
+	return (unsigned long long)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+/**
+ * The results are written as one JSON object per line to the file named by
+ * the SCUMMVM_BENCHMARK_OUTPUT environment variable, or to benchmark.json.
+ */
+inline FILE *getOutput() {
+	static FILE *output = 0;
+	if (!output) {
+		const char *name = getenv("SCUMMVM_BENCHMARK_OUTPUT");
+		output = fopen(name && *name ? name : "benchmark.json", "w");
+		if (!output)
+			output = stdout;
+	}
+	return output;
+}
+
+/**
+ * Time a case and write the result.
+ *
+ * @param name the name of the case, e.g. "common.hashmap.insert"
+ * @param c    the case to run
+ * @param unit what the items returned by Case::run() are, e.g. "byte"
+ */
+inline void measure(const char *name, Case &c, const char *unit) {
+	// One untimed round to warm up the caches and allocators
+	c.run();
+
+	unsigned long long items = 0, runs = 0;
+	const unsigned long long start = getMicros();
+	unsigned long long time;
+	do {
+		items += c.run();
+		++runs;
+		time = getMicros() - start;
+	} while (time < kMinTime);
+
+	const double nsPerItem = items ? time * 1000.0 / items : 0.0;
+	fprintf(getOutput(), "{\"name\": \"%s\", \"runs\": %llu, \"micros\": %llu, \"items\": %llu, \"unit\": \"%s\", \"ns_per_item\": %.3f}\n",
+	        name, runs, time, items, unit, nsPerItem);
+	fflush(getOutput());
+}
+
+} // End of namespace Benchmark
+
+#endif
@@ -0,0 +1,260 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/dct.h"
+#include "common/fft.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/memorypool.h"
+#include "common/memstream.h"
+#include "common/rdft.h"
+#include "common/str.h"
+#include "common/zlib.h"
+
+#include "test/random.h"
+
+class CommonBenchmarkSuite : public CxxTest::TestSuite
+{
+	enum {
+		kItems = 10000,
+		kStreamSize = 1024 * 1024,
+		kTransformBits = 10,
+		kTransformSize = 1 << kTransformBits,
+		kTransforms = 256
+	};
+
+	/**
+	 * Fill a buffer with pseudo-random floats between -1 and 1. The
+	 * transforms work in place, so the cases below start every round from a
+	 * copy of this, instead of letting the values grow with each round.
+	 */
+	static void fillRandomFloats(float *data, uint32 count, uint32 seed) {
+		for (uint32 i = 0; i < count; ++i)
+			data[i] = (int)((Test::nextRandom(seed) >> 16) & 0xFFFF) / 32768.0f - 1.0f;
+	}
+
+	struct FFTCalc : public Benchmark::Case {
+		Common::FFT fft;
+		Common::Complex input[kTransformSize];
+		Common::Complex data[kTransformSize];
+
+		FFTCalc() : fft(kTransformBits, 0) {
+			fillRandomFloats(&input[0].re, 2 * kTransformSize, 12345);
+		}
+
+		unsigned long run() {
+			for (uint32 i = 0; i < kTransforms; ++i) {
+				memcpy(data, input, sizeof(data));
+				fft.permute(data);
+				fft.calc(data);
+			}
+			return kTransforms * kTransformSize;
+		}
+	};
+
+	struct RDFTCalc : public Benchmark::Case {
+		Common::RDFT rdft;
+		float input[kTransformSize];
+		float data[kTransformSize];
+
+		RDFTCalc() : rdft(kTransformBits, Common::RDFT::DFT_R2C) {
+			fillRandomFloats(input, kTransformSize, 23456);
+		}
+
+		unsigned long run() {
+			for (uint32 i = 0; i < kTransforms; ++i) {
+				memcpy(data, input, sizeof(data));
+				rdft.calc(data);
+			}
+			return kTransforms * kTransformSize;
+		}
+	};
+
+	struct DCTCalc : public Benchmark::Case {
+		Common::DCT dct;
+		float input[kTransformSize];
+		float data[kTransformSize];
+
+		DCTCalc() : dct(kTransformBits, Common::DCT::DCT_II) {
+			fillRandomFloats(input, kTransformSize, 34567);
+		}
+
+		unsigned long run() {
+			for (uint32 i = 0; i < kTransforms; ++i) {
+				memcpy(data, input, sizeof(data));
+				dct.calc(data);
+			}
+			return kTransforms * kTransformSize;
+		}
+	};
+
+	struct HashMapInsert : public Benchmark::Case {
+		unsigned long run() {
+			Common::HashMap<uint32, uint32> map;
+			for (uint32 i = 0; i < kItems; ++i)
+				map[i * 2654435761U] = i;
+			return kItems;
+		}
+	};
+
+	struct HashMapLookup : public Benchmark::Case {
+		Common::HashMap<Common::String, uint32, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> map;
+		Common::String keys[kItems];
+
+		HashMapLookup() {
+			for (uint32 i = 0; i < kItems; ++i) {
+				keys[i] = Common::String::format("Resource%u.DAT", i);
+				map[keys[i]] = i;
+			}
+		}
+
+		unsigned long run() {
+			uint32 sum = 0;
+			for (uint32 i = 0; i < kItems; ++i)
+				sum += map.getVal(keys[i]);
+			TS_ASSERT_EQUALS(sum, (uint32)(kItems * (kItems - 1) / 2));
+			return kItems;
+		}
+	};
+
+	struct StringConcat : public Benchmark::Case {
+		unsigned long run() {
+			Common::String str;
+			for (uint32 i = 0; i < kItems; ++i)
+				str += "abc";
+			TS_ASSERT_EQUALS(str.size(), (uint)(3 * kItems));
+			return kItems;
+		}
+	};
+
+	struct StringFormat : public Benchmark::Case {
+		unsigned long run() {
+			for (uint32 i = 0; i < kItems; ++i)
+				Common::String::format("%s/%d.%03d", "savegame", i, i % 1000);
+			return kItems;
+		}
+	};
+
+	struct MemoryPoolAlloc : public Benchmark::Case {
+		void *chunks[kItems];
+
+		unsigned long run() {
+			Common::MemoryPool pool(48);
+			for (uint32 i = 0; i < kItems; ++i)
+				chunks[i] = pool.allocChunk();
+			for (uint32 i = 0; i < kItems; ++i)
+				pool.freeChunk(chunks[i]);
+			return kItems;
+		}
+	};
+
+	struct StreamRead : public Benchmark::Case {
+		byte *data;
+		uint32 checksum;
+
+		StreamRead() {
+			data = (byte *)malloc(kStreamSize);
+			for (uint32 i = 0; i < kStreamSize; ++i)
+				data[i] = i * 7;
+		}
+
+		~StreamRead() {
+			free(data);
+		}
+
+		unsigned long run() {
+			Common::MemoryReadStream stream(data, kStreamSize);
+			checksum = 0;
+			while (stream.pos() < kStreamSize)
+				checksum += stream.readUint32LE();
+			return kStreamSize;
+		}
+	};
+
+#if defined(USE_ZLIB)
+	struct ZlibInflate : public Benchmark::Case {
+		byte *data;
+		byte *compressed;
+		uint32 compressedSize;
+
+		ZlibInflate() {
+			// Compressible, but not trivially so
+			data = (byte *)malloc(kStreamSize);
+			uint32 seed = 12345;
+			for (uint32 i = 0; i < kStreamSize; ++i) {
+				data[i] = 'a' + ((Test::nextRandom(seed) >> 16) % 16);
+			}
+
+			Common::MemoryWriteStreamDynamic *mem = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO);
+			Common::WriteStream *gzip = Common::wrapCompressedWriteStream(mem);
+			gzip->write(data, kStreamSize);
+			gzip->finalize();
+			compressed = mem->getData();
+			compressedSize = mem->size();
+			delete gzip;
+		}
+
+		~ZlibInflate() {
+			free(data);
+			free(compressed);
+		}
+
+		unsigned long run() {
+			Common::SeekableReadStream *stream = Common::wrapCompressedReadStream(new Common::MemoryReadStream(compressed, compressedSize));
+			byte buffer[4096];
+			uint32 total = 0, read;
+			while ((read = stream->read(buffer, sizeof(buffer))) != 0)
+				total += read;
+			delete stream;
+			TS_ASSERT_EQUALS(total, (uint32)kStreamSize);
+			return total;
+		}
+	};
+#endif
+
+public:
+	void test_hashmap() {
+		HashMapInsert insert;
+		Benchmark::measure("common.hashmap.insert", insert, "item");
+		HashMapLookup lookup;
+		Benchmark::measure("common.hashmap.lookup_string", lookup, "item");
+	}
+
+	void test_string() {
+		StringConcat concat;
+		Benchmark::measure("common.string.concat", concat, "item");
+		StringFormat format;
+		Benchmark::measure("common.string.format", format, "item");
+	}
+
+	void test_memorypool() {
+		MemoryPoolAlloc alloc;
+		Benchmark::measure("common.memorypool.alloc_free", alloc, "item");
+	}
+
+	void test_stream() {
+		StreamRead read;
+		Benchmark::measure("common.memoryreadstream.read_uint32", read, "byte");
+	}
+
+	void test_fft() {
+		FFTCalc calc;
+		Benchmark::measure("common.fft.calc", calc, "sample");
+	}
+
+	void test_rdft() {
+		RDFTCalc calc;
+		Benchmark::measure("common.rdft.dft_r2c", calc, "sample");
+	}
+
+	void test_dct() {
+		DCTCalc calc;
+		Benchmark::measure("common.dct.dct_ii", calc, "sample");
+	}
+
+	void test_zlib() {
+#if defined(USE_ZLIB)
+		ZlibInflate inflate;
+		Benchmark::measure("common.zlib.inflate", inflate, "byte");
+#endif
+	}
+};
@@ -0,0 +1,172 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/conversion.h"
+#include "graphics/scaler.h"
+#include "graphics/surface.h"
+#include "graphics/transparent_surface.h"
+#include "graphics/yuv_to_rgb.h"
+
+#include "test/random.h"
+
+class GraphicsBenchmarkSuite : public CxxTest::TestSuite
+{
+	enum {
+		kWidth = 320,
+		kHeight = 200
+	};
+
+#ifdef USE_SCALERS
+	struct Scale : public Benchmark::Case {
+		ScalerProc *proc;
+		int factor;
+		uint16 *src;
+		uint16 *dst;
+
+		Scale(ScalerProc *p, int f) : proc(p), factor(f) {
+			// The scalers read one pixel around the source rectangle
+			src = new uint16[(kWidth + 2) * (kHeight + 2)];
+			dst = new uint16[kWidth * factor * kHeight * factor];
+			Test::fillRandom((byte *)src, (kWidth + 2) * (kHeight + 2) * 2, factor);
+		}
+
+		~Scale() {
+			delete[] src;
+			delete[] dst;
+		}
+
+		unsigned long run() {
+			const int pitch = kWidth + 2;
+			proc((const uint8 *)(src + pitch + 1), pitch * 2, (uint8 *)dst, kWidth * factor * 2, kWidth, kHeight);
+			return kWidth * kHeight;
+		}
+	};
+#endif
+
+	struct CrossBlit : public Benchmark::Case {
+		Graphics::PixelFormat dstFormat, srcFormat;
+		byte *src;
+		byte *dst;
+
+		CrossBlit(const Graphics::PixelFormat &dstFmt, const Graphics::PixelFormat &srcFmt) : dstFormat(dstFmt), srcFormat(srcFmt) {
+			src = new byte[kWidth * kHeight * srcFormat.bytesPerPixel];
+			dst = new byte[kWidth * kHeight * dstFormat.bytesPerPixel];
+			Test::fillRandom(src, kWidth * kHeight * srcFormat.bytesPerPixel, 1);
+		}
+
+		~CrossBlit() {
+			delete[] src;
+			delete[] dst;
+		}
+
+		unsigned long run() {
+			Graphics::crossBlit(dst, src, kWidth * dstFormat.bytesPerPixel, kWidth * srcFormat.bytesPerPixel,
+			                    kWidth, kHeight, dstFormat, srcFormat);
+			return kWidth * kHeight;
+		}
+	};
+
+	struct TransparentBlit : public Benchmark::Case {
+		Graphics::TransparentSurface sprite;
+		Graphics::Surface target;
+		uint color;
+		Graphics::TSpriteBlendMode mode;
+
+		TransparentBlit(Graphics::AlphaType alphaMode, uint c, Graphics::TSpriteBlendMode m) : color(c), mode(m) {
+			sprite.create(kWidth, kHeight, Graphics::TransparentSurface::getSupportedPixelFormat());
+			Test::fillRandom((byte *)sprite.getPixels(), sprite.pitch * sprite.h, 2);
+			sprite.setAlphaMode(alphaMode);
+			target.create(kWidth, kHeight, Graphics::TransparentSurface::getSupportedPixelFormat());
+			Test::fillRandom((byte *)target.getPixels(), target.pitch * target.h, 3);
+		}
+
+		~TransparentBlit() {
+			sprite.free();
+			target.free();
+		}
+
+		unsigned long run() {
+			sprite.blit(target, 0, 0, Graphics::FLIP_NONE, nullptr, color, -1, -1, mode);
+			return kWidth * kHeight;
+		}
+	};
+
+	struct YUVConvert : public Benchmark::Case {
+		Graphics::Surface surface;
+		byte *y, *u, *v;
+
+		YUVConvert(const Graphics::PixelFormat &format) {
+			surface.create(kWidth, kHeight, format);
+			y = new byte[kWidth * kHeight];
+			u = new byte[kWidth * kHeight / 4];
+			v = new byte[kWidth * kHeight / 4];
+			Test::fillRandom(y, kWidth * kHeight, 4);
+			Test::fillRandom(u, kWidth * kHeight / 4, 5);
+			Test::fillRandom(v, kWidth * kHeight / 4, 6);
+		}
+
+		~YUVConvert() {
+			surface.free();
+			delete[] y;
+			delete[] u;
+			delete[] v;
+		}
+
+		unsigned long run() {
+			YUVToRGBMan.convert420(&surface, Graphics::YUVToRGBManager::kScaleITU, y, u, v, kWidth, kHeight, kWidth, kWidth / 2);
+			return kWidth * kHeight;
+		}
+	};
+
+	static Graphics::PixelFormat format565() {
+		return Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0);
+	}
+
+	static Graphics::PixelFormat format8888() {
+		return Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0);
+	}
+
+public:
+	void test_scalers() {
+#ifdef USE_SCALERS
+		InitScalers(565);
+
+		Scale normal2x(Normal2x, 2);
+		Benchmark::measure("graphics.scaler.normal2x", normal2x, "pixel");
+		Scale advMame2x(AdvMame2x, 2);
+		Benchmark::measure("graphics.scaler.advmame2x", advMame2x, "pixel");
+		Scale superEagle(SuperEagle, 2);
+		Benchmark::measure("graphics.scaler.supereagle", superEagle, "pixel");
+#ifdef USE_HQ_SCALERS
+		Scale hq2x(HQ2x, 2);
+		Benchmark::measure("graphics.scaler.hq2x", hq2x, "pixel");
+		Scale hq3x(HQ3x, 3);
+		Benchmark::measure("graphics.scaler.hq3x", hq3x, "pixel");
+#endif
+#endif
+	}
+
+	void test_crossblit() {
+		CrossBlit to565(format565(), format8888());
+		Benchmark::measure("graphics.crossblit.8888_to_565", to565, "pixel");
+		CrossBlit to8888(format8888(), format565());
+		Benchmark::measure("graphics.crossblit.565_to_8888", to8888, "pixel");
+	}
+
+	void test_transparent_surface() {
+		TransparentBlit opaque(Graphics::ALPHA_OPAQUE, TS_ARGB(255, 255, 255, 255), Graphics::BLEND_NORMAL);
+		Benchmark::measure("graphics.transparentsurface.blit_opaque", opaque, "pixel");
+		TransparentBlit alpha(Graphics::ALPHA_FULL, TS_ARGB(255, 255, 255, 255), Graphics::BLEND_NORMAL);
+		Benchmark::measure("graphics.transparentsurface.blit_alpha", alpha, "pixel");
+		TransparentBlit tinted(Graphics::ALPHA_FULL, TS_ARGB(128, 255, 128, 64), Graphics::BLEND_NORMAL);
+		Benchmark::measure("graphics.transparentsurface.blit_tinted", tinted, "pixel");
+		TransparentBlit additive(Graphics::ALPHA_FULL, TS_ARGB(255, 255, 255, 255), Graphics::BLEND_ADDITIVE);
+		Benchmark::measure("graphics.transparentsurface.blit_additive", additive, "pixel");
+	}
+
+	void test_yuv_to_rgb() {
+		YUVConvert to565(format565());
+		Benchmark::measure("graphics.yuv.convert420_565", to565, "pixel");
+		YUVConvert to8888(format8888());
+		Benchmark::measure("graphics.yuv.convert420_8888", to8888, "pixel");
+	}
+};
@@ -0,0 +1,78 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/arena.h"
+
+class ArenaTestSuite : public CxxTest::TestSuite
+{
+	public:
+	void test_allocate_free() {
+		Common::Arena arena("test", 1024);
+
+		void *a = arena.allocate(10);
+		void *b = arena.allocate(10);
+		TS_ASSERT(a != b);
+		TS_ASSERT_EQUALS((size_t)a % 8, 0U);
+		TS_ASSERT_EQUALS((size_t)b % 8, 0U);
+		TS_ASSERT_EQUALS(arena.getStats().bytesInUse, 32U);
+
+		// Freed chunks are reused for requests of the same size class
+		arena.free(a, 10);
+		void *c = arena.allocate(16);
+		TS_ASSERT_EQUALS(a, c);
+
+		arena.free(b, 10);
+		arena.free(c, 16);
+		TS_ASSERT_EQUALS(arena.getStats().bytesInUse, 0U);
+		TS_ASSERT_EQUALS(arena.getStats().peakBytesInUse, 32U);
+		TS_ASSERT_EQUALS(arena.getStats().allocations, 3U);
+		TS_ASSERT_EQUALS(arena.getStats().frees, 3U);
+	}
+
+	void test_large_allocations() {
+		Common::Arena arena("test", 1024);
+
+		byte *a = (byte *)arena.allocate(4000);
+		memset(a, 0xAA, 4000);
+		byte *b = (byte *)arena.allocate(600);
+		memset(b, 0x55, 600);
+		TS_ASSERT_EQUALS(a[3999], 0xAA);
+		TS_ASSERT_EQUALS(arena.getStats().blockAllocations, 2U);
+	}
+
+	void test_reset() {
+		Common::Arena arena("test", 1024);
+
+		void *first = arena.allocate(100);
+		for (int i = 0; i < 100; ++i)
+			arena.allocate(100);
+		const uint32 blocks = arena.getStats().blockAllocations;
+		TS_ASSERT(blocks > 1);
+
+		// After a reset the same blocks are handed out again
+		arena.reset();
+		TS_ASSERT_EQUALS(arena.getStats().bytesInUse, 0U);
+		TS_ASSERT_EQUALS(arena.allocate(100), first);
+		for (int i = 0; i < 100; ++i)
+			arena.allocate(100);
+		TS_ASSERT_EQUALS(arena.getStats().blockAllocations, blocks);
+
+		arena.reset(true);
+		TS_ASSERT_EQUALS(arena.getStats().bytesReserved, 1024U);
+		TS_ASSERT_EQUALS(arena.getStats().resets, 2U);
+	}
+
+	struct Point {
+		int x, y;
+		Point(int x_, int y_) : x(x_), y(y_) {}
+	};
+
+	void test_objects() {
+		Common::Arena arena("test");
+
+		Point *p = new (arena) Point(3, 4);
+		TS_ASSERT_EQUALS(p->x, 3);
+		TS_ASSERT_EQUALS(p->y, 4);
+		arena.destroy(p);
+		TS_ASSERT_EQUALS(arena.getStats().bytesInUse, 0U);
+	}
+};
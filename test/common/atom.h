@@ -0,0 +1,60 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/atom.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
+
+class AtomTestSuite : public CxxTest::TestSuite
+{
+	public:
+	void test_interning() {
+		Common::Atom a("resource.map");
+		Common::Atom b(Common::String("resource.") + "map");
+		Common::Atom c("RESOURCE.MAP");
+
+		TS_ASSERT(a == b);
+		TS_ASSERT(a != c);
+		TS_ASSERT_EQUALS(a.c_str(), b.c_str());
+		TS_ASSERT(a.equalsIgnoreCase(c));
+		TS_ASSERT(!a.equalsIgnoreCase(Common::Atom("resource.000")));
+		TS_ASSERT_EQUALS(a.str(), "resource.map");
+	}
+
+	void test_empty() {
+		Common::Atom a;
+		Common::Atom b("");
+		TS_ASSERT(a.empty());
+		TS_ASSERT(a == b);
+		TS_ASSERT_EQUALS(a.size(), 0U);
+	}
+
+	void test_hashes() {
+		Common::Atom a("Some/Path/File.DAT");
+		TS_ASSERT_EQUALS(a.hash(), Common::hashit("Some/Path/File.DAT"));
+		TS_ASSERT_EQUALS(a.hashLower(), Common::hashit_lower("some/path/file.dat"));
+		TS_ASSERT_EQUALS(a.hashLower(), Common::Atom("SOME/PATH/FILE.DAT").hashLower());
+	}
+
+	void test_hashmap_key() {
+		Common::HashMap<Common::Atom, int> map;
+		map[Common::Atom("one")] = 1;
+		map[Common::Atom("two")] = 2;
+		TS_ASSERT_EQUALS(map[Common::Atom("one")], 1);
+		TS_ASSERT_EQUALS(map[Common::Atom("two")], 2);
+		TS_ASSERT(!map.contains(Common::Atom("ONE")));
+
+		Common::HashMap<Common::Atom, int, Common::Atom_IgnoreCase_Hash, Common::Atom_IgnoreCase_EqualTo> map2;
+		map2[Common::Atom("one")] = 1;
+		TS_ASSERT(map2.contains(Common::Atom("ONE")));
+	}
+
+	void test_find_with_hash() {
+		Common::StringMap map;
+		map["Data.Pak"] = "x";
+		Common::Atom a("DATA.PAK");
+		TS_ASSERT(map.containsWithHash(a, a.hashLower()));
+		TS_ASSERT(map.findWithHash(a, a.hashLower()) != map.end());
+		Common::Atom b("other.pak");
+		TS_ASSERT(!map.containsWithHash(b, b.hashLower()));
+	}
+};
@@ -211,4 +211,48 @@ public:
 		tmpl_peek_bits_lsb<Common::MemoryReadStream, Common::BitStream8LSB>();
 		tmpl_peek_bits_lsb<Common::BitStreamMemoryStream, Common::BitStreamMemory8LSB>();
 	}
+
+	void test_get_bits_wide() {
+		byte contents[] = { 0x78, 0x56, 0x34, 0x12, 0xF0, 0xDE, 0xBC, 0x9A, 0x01, 0x00, 0x00, 0x80 };
+
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		Common::BitStream32LELSB lsb(ms);
+		TS_ASSERT_EQUALS(lsb.getBits(4), 0x8u);
+		TS_ASSERT_EQUALS(lsb.getBits(32), 0x01234567u);
+		TS_ASSERT_EQUALS(lsb.peekBits(32), 0x19ABCDEFu);
+		TS_ASSERT_EQUALS(lsb.getBits(28), 0x9ABCDEFu);
+		TS_ASSERT_EQUALS(lsb.getBits(32), 0x80000001u);
+		TS_ASSERT(lsb.eos());
+		TS_ASSERT_EQUALS(lsb.peekBits(8), 0u);
+
+		ms.seek(0);
+		Common::BitStream32LEMSB msb(ms);
+		TS_ASSERT_EQUALS(msb.getBits(4), 0x1u);
+		TS_ASSERT_EQUALS(msb.getBits(32), 0x23456789u);
+		msb.skip(20);
+		TS_ASSERT_EQUALS(msb.pos(), 56u);
+		TS_ASSERT_EQUALS(msb.peekBits(16), 0xF080u);
+		msb.align();
+		TS_ASSERT_EQUALS(msb.pos(), 64u);
+		TS_ASSERT_EQUALS(msb.getBits(32), 0x80000001u);
+		TS_ASSERT(msb.eos());
+	}
+
+	void test_start_in_stream() {
+		// The bit stream covers the whole values after the header only
+		byte contents[] = { 0x00, 0x02, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC };
+
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+		TS_ASSERT_EQUALS(ms.readUint16BE(), 2u);
+
+		Common::BitStream32BEMSB bs(ms);
+		TS_ASSERT_EQUALS(bs.size(), 32u);
+		TS_ASSERT_EQUALS(bs.getBits(16), 0x1234u);
+		TS_ASSERT_EQUALS(bs.getBits(16), 0x5678u);
+		TS_ASSERT(bs.eos());
+
+		bs.rewind();
+		TS_ASSERT_EQUALS(bs.getBits(8), 0x12u);
+	}
 };
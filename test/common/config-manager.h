@@ -0,0 +1,45 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/config-manager.h"
+
+class ConfigManagerTestSuite : public CxxTest::TestSuite {
+public:
+	void test_setting_follows_changes() {
+		ConfMan.registerDefault("test_setting_int", 5);
+		ConfMan.registerDefault("test_setting_bool", true);
+
+		Common::ConfigSetting<int> intSetting("test_setting_int");
+		Common::ConfigSetting<bool> boolSetting("test_setting_bool");
+		TS_ASSERT_EQUALS(intSetting.get(), 5);
+		TS_ASSERT_EQUALS(boolSetting.get(), true);
+
+		ConfMan.setInt("test_setting_int", 42);
+		ConfMan.setBool("test_setting_bool", false);
+		TS_ASSERT_EQUALS(intSetting.getCached(), 42);
+		TS_ASSERT_EQUALS(boolSetting.getCached(), false);
+
+		// Changes made directly on a domain are picked up by get()
+		Common::ConfigManager::Domain *domain = ConfMan.getDomain(Common::ConfigManager::kApplicationDomain);
+		TS_ASSERT(domain);
+		(*domain)["test_setting_int"] = "0x10";
+		TS_ASSERT_EQUALS(intSetting.get(), 16);
+
+		ConfMan.removeKey("test_setting_int", Common::ConfigManager::kApplicationDomain);
+		ConfMan.removeKey("test_setting_bool", Common::ConfigManager::kApplicationDomain);
+		TS_ASSERT_EQUALS(intSetting.getCached(), 5);
+		TS_ASSERT_EQUALS(boolSetting.getCached(), true);
+	}
+
+	void test_setting_invalid_values() {
+		Common::ConfigSetting<int> intSetting("test_setting_missing");
+		Common::ConfigSetting<bool> boolSetting("test_setting_missing");
+		TS_ASSERT_EQUALS(intSetting.get(), 0);
+		TS_ASSERT_EQUALS(boolSetting.get(), false);
+
+		ConfMan.set("test_setting_missing", "bogus");
+		TS_ASSERT_EQUALS(intSetting.get(), 0);
+		TS_ASSERT_EQUALS(boolSetting.get(), false);
+
+		ConfMan.removeKey("test_setting_missing", Common::ConfigManager::kApplicationDomain);
+	}
+};
@@ -0,0 +1,68 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/coroutines.h"
+
+namespace {
+
+/** Increments the counter passed as parameter on each of two ticks. */
+void countingProcess(CORO_PARAM, const void *param) {
+	int *counter = *(int * const *)param;
+
+	CORO_BEGIN_CONTEXT;
+	CORO_END_CONTEXT(_ctx);
+
+	CORO_BEGIN_CODE(_ctx);
+
+	(*counter)++;
+	CORO_SLEEP(1);
+	(*counter)++;
+
+	CORO_END_CODE;
+}
+
+} // End of anonymous namespace
+
+class CoroutinesTestSuite : public CxxTest::TestSuite {
+public:
+	void test_many_processes() {
+		CoroScheduler.reset();
+
+		// More processes than fit into a single block of the process table
+		const int count = CORO_NUM_PROCESS * 3 + 7;
+		int counter = 0;
+		int *param = &counter;
+		for (int i = 0; i < count; ++i)
+			CoroScheduler.createProcess(1000 + i, countingProcess, &param, sizeof(int *));
+
+		CoroScheduler.schedule();
+		TS_ASSERT_EQUALS(counter, count);
+
+		CoroScheduler.schedule();
+		TS_ASSERT_EQUALS(counter, count * 2);
+
+		// All processes have finished now
+		CoroScheduler.schedule();
+		TS_ASSERT_EQUALS(counter, count * 2);
+		TS_ASSERT_EQUALS(CoroScheduler.killMatchingProcess(1000), 0);
+	}
+
+	void test_kill_matching() {
+		CoroScheduler.reset();
+
+		int counter = 0;
+		int *param = &counter;
+		for (int i = 0; i < 10; ++i)
+			CoroScheduler.createProcess(0x100 | (i & 1), countingProcess, &param, sizeof(int *));
+
+		TS_ASSERT_EQUALS(CoroScheduler.killMatchingProcess(0x101), 5);
+		TS_ASSERT_EQUALS(CoroScheduler.killMatchingProcess(0x101), 0);
+		TS_ASSERT_EQUALS(CoroScheduler.killMatchingProcess(0x200), 0);
+
+		CoroScheduler.schedule();
+		TS_ASSERT_EQUALS(counter, 5);
+
+		TS_ASSERT_EQUALS(CoroScheduler.killMatchingProcess(0x100, 0xF00), 5);
+		CoroScheduler.schedule();
+		TS_ASSERT_EQUALS(counter, 5);
+	}
+};
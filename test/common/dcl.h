@@ -0,0 +1,74 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/dcl.h"
+#include "common/memstream.h"
+
+class DCLTestSuite : public CxxTest::TestSuite
+{
+	void checkUnpack(const byte *packed, uint32 packedSize, const byte *expected, uint32 expectedSize) {
+		Common::MemoryReadStream src(packed, packedSize);
+		byte *dest = new byte[expectedSize];
+		TS_ASSERT(Common::decompressDCL(&src, dest, packedSize, expectedSize));
+		TS_ASSERT_EQUALS(memcmp(dest, expected, expectedSize), 0);
+		delete[] dest;
+
+		// Without a known unpacked size, the end of stream marker is used
+		Common::MemoryReadStream src2(packed, packedSize);
+		Common::SeekableReadStream *unpacked = Common::decompressDCL(&src2);
+		TS_ASSERT(unpacked);
+		TS_ASSERT_EQUALS((uint32)unpacked->size(), expectedSize);
+		byte *data = new byte[expectedSize];
+		unpacked->read(data, expectedSize);
+		TS_ASSERT_EQUALS(memcmp(data, expected, expectedSize), 0);
+		delete[] data;
+		delete unpacked;
+	}
+
+public:
+	void test_ascii_mode() {
+		// Literals from the ASCII Huffman tree and short copies, 1K dictionary
+		static const byte packed[] = {
+		0x01, 0x04, 0x2C, 0x8A, 0xED, 0x79, 0x36, 0x04, 0x5B, 0xA3, 0xE8, 0x3A,
+		0x1D, 0xDF, 0x2B, 0xE1, 0xD9, 0x41, 0x49, 0x44, 0x1C, 0xA4, 0xAA, 0x1D,
+		0x26, 0x23, 0x7E, 0xF1, 0x4E, 0x50, 0x1A, 0x02, 0xFE, 0x01,
+		};
+
+		Common::String expected;
+		for (int i = 0; i < 3; i++)
+			expected += "The Neverhood, the Neverhood, the Neverhood!\r\n";
+		expected += "abcabcabcabcabcabc ";
+		for (int i = 0; i < 91; i++)
+			expected += 'a';
+
+		checkUnpack(packed, sizeof(packed), (const byte *)expected.c_str(), expected.size());
+	}
+
+	void test_binary_mode() {
+		// Plain literals, a long run, a far copy and a two byte copy, 4K dictionary
+		static const byte packed[] = {
+		0x00, 0x06, 0x00, 0x94, 0x50, 0xF2, 0x86, 0x52, 0x2E, 0x6F, 0x03, 0x50,
+		0x34, 0x91, 0x73, 0x89, 0x57, 0x38, 0x03, 0x2B, 0xA0, 0xD4, 0xD1, 0xF4,
+		0x8B, 0x5C, 0x02, 0x17, 0x53, 0xF0, 0x74, 0x12, 0x76, 0x8E, 0x41, 0x0C,
+		0x2B, 0x7B, 0x40, 0x15, 0x53, 0xF7, 0x80, 0x46, 0x16, 0x3F, 0xA3, 0xF0,
+		0x02, 0x46, 0x06, 0x42, 0x20, 0x4E, 0x02, 0x08, 0x48, 0xD8, 0x0D, 0xF8,
+		0x07,
+		};
+
+		byte expected[385];
+		for (int i = 0; i < 40; i++)
+			expected[i] = expected[340 + i] = (byte)(i * 37);
+		memset(expected + 40, 'x', 300);
+		const byte tail[] = { 1, 2, 9, 1, 2 };
+		memcpy(expected + 380, tail, sizeof(tail));
+
+		checkUnpack(packed, sizeof(packed), expected, sizeof(expected));
+	}
+
+	void test_corrupt() {
+		// The copy reaches back before the start of the data
+		static const byte packed[] = { 0x00, 0x04, 0x01, 0x00, 0x00, 0x00 };
+		Common::MemoryReadStream src(packed, sizeof(packed));
+		byte dest[16];
+		TS_ASSERT(!Common::decompressDCL(&src, dest, sizeof(packed), sizeof(dest)));
+	}
+};
@@ -0,0 +1,92 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/events.h"
+#include "common/queue.h"
+
+class EventDispatcherTestSuite : public CxxTest::TestSuite
+{
+	class QueueSource : public Common::EventSource {
+	public:
+		Common::Queue<Common::Event> _events;
+
+		bool pollEvent(Common::Event &event) {
+			if (_events.empty())
+				return false;
+			event = _events.pop();
+			return true;
+		}
+
+		void push(Common::EventType type, int x) {
+			Common::Event event;
+			event.type = type;
+			event.mouse = Common::Point(x, 0);
+			_events.push(event);
+		}
+	};
+
+	class RecordingObserver : public Common::EventObserver {
+	public:
+		Common::Array<Common::Event> _events;
+
+		bool notifyEvent(const Common::Event &event) {
+			_events.push_back(event);
+			return true;
+		}
+	};
+
+	void fill(QueueSource &source) {
+		source.push(Common::EVENT_MOUSEMOVE, 1);
+		source.push(Common::EVENT_MOUSEMOVE, 2);
+		source.push(Common::EVENT_MOUSEMOVE, 3);
+		source.push(Common::EVENT_LBUTTONDOWN, 3);
+		source.push(Common::EVENT_MOUSEMOVE, 4);
+		source.push(Common::EVENT_LBUTTONUP, 4);
+		source.push(Common::EVENT_MOUSEMOVE, 5);
+		source.push(Common::EVENT_MOUSEMOVE, 6);
+	}
+
+	public:
+	void test_no_coalescing() {
+		QueueSource source;
+		RecordingObserver observer;
+		Common::EventDispatcher dispatcher;
+		dispatcher.registerMapper(new Common::DefaultEventMapper());
+		dispatcher.registerSource(&source, false);
+		dispatcher.registerObserver(&observer, 1, false);
+
+		fill(source);
+		dispatcher.dispatch();
+		TS_ASSERT_EQUALS(observer._events.size(), 8U);
+	}
+
+	void test_coalescing() {
+		QueueSource source;
+		RecordingObserver observer;
+		Common::EventDispatcher dispatcher;
+		dispatcher.registerMapper(new Common::DefaultEventMapper());
+		dispatcher.registerSource(&source, false);
+		dispatcher.registerObserver(&observer, 1, false);
+		dispatcher.setCoalesceMouseMotion(true);
+
+		fill(source);
+		dispatcher.dispatch();
+
+		const Common::EventType types[] = {
+			Common::EVENT_MOUSEMOVE, Common::EVENT_LBUTTONDOWN, Common::EVENT_MOUSEMOVE,
+			Common::EVENT_LBUTTONUP, Common::EVENT_MOUSEMOVE
+		};
+		const int positions[] = { 3, 3, 4, 4, 6 };
+
+		TS_ASSERT_EQUALS(observer._events.size(), 5U);
+		for (uint i = 0; i < observer._events.size() && i < 5; ++i) {
+			TS_ASSERT_EQUALS(observer._events[i].type, types[i]);
+			TS_ASSERT_EQUALS(observer._events[i].mouse.x, positions[i]);
+		}
+
+		// Mouse moves are not held back across dispatches
+		source.push(Common::EVENT_MOUSEMOVE, 7);
+		dispatcher.dispatch();
+		TS_ASSERT_EQUALS(observer._events.size(), 6U);
+		TS_ASSERT_EQUALS(observer._events[5].mouse.x, 7);
+	}
+};
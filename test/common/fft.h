@@ -0,0 +1,70 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/fft.h"
+#include "common/rdft.h"
+
+#include <math.h>
+
+class FFTTestSuite : public CxxTest::TestSuite {
+private:
+	/** Compare an FFT of 2^bits points against a direct evaluation of the DFT. */
+	void checkFFT(int bits, int inverse) {
+		const int n = 1 << bits;
+		Common::Complex *input = new Common::Complex[n];
+		Common::Complex *output = new Common::Complex[n];
+
+		for (int i = 0; i < n; i++) {
+			input[i].re = output[i].re = (float)sin(i * 0.37) + (i % 7) * 0.1f;
+			input[i].im = output[i].im = (float)cos(i * 1.23) - (i % 3) * 0.2f;
+		}
+
+		Common::FFT fft(bits, inverse);
+		fft.permute(output);
+		fft.calc(output);
+
+		const double sign = inverse ? 1.0 : -1.0;
+		double maxError = 0.0;
+		for (int k = 0; k < n; k++) {
+			double re = 0.0, im = 0.0;
+			for (int j = 0; j < n; j++) {
+				const double angle = sign * 2.0 * M_PI * (double)((j * k) % n) / n;
+				re += input[j].re * cos(angle) - input[j].im * sin(angle);
+				im += input[j].re * sin(angle) + input[j].im * cos(angle);
+			}
+
+			maxError = MAX(maxError, fabs(re - output[k].re));
+			maxError = MAX(maxError, fabs(im - output[k].im));
+		}
+
+		// The error of a float FFT grows with log(n) and the magnitude of the values
+		TS_ASSERT_LESS_THAN(maxError, 1e-5 * n);
+
+		delete[] output;
+		delete[] input;
+	}
+
+public:
+	void test_fft() {
+		for (int bits = 2; bits <= 10; bits++) {
+			checkFFT(bits, 0);
+			checkFFT(bits, 1);
+		}
+	}
+
+	void test_rdft_round_trip() {
+		const int bits = 9;
+		const int n = 1 << bits;
+		float data[n], original[n];
+
+		for (int i = 0; i < n; i++)
+			data[i] = original[i] = (float)sin(i * 0.11) * 3.0f + (i % 5);
+
+		Common::RDFT forward(bits, Common::RDFT::DFT_R2C);
+		Common::RDFT backward(bits, Common::RDFT::IDFT_C2R);
+		forward.calc(data);
+		backward.calc(data);
+
+		for (int i = 0; i < n; i++)
+			TS_ASSERT_DELTA(data[i] * 2.0f / n, original[i], 1e-4);
+	}
+};
@@ -141,4 +141,43 @@ class HuffmanTestSuite : public CxxTest::TestSuite {
 		TS_ASSERT_EQUALS(h.getSymbol(bs), expected[5]);
 		TS_ASSERT_EQUALS(h.getSymbol(bs), expected[6]);
 	}
+
+	void test_long_codes() {
+
+		/*
+		 * Codes longer than the lookup tables, in both bit orders.
+		 * The code for symbol n consists of n - 1 ones followed by a zero:
+		 * 0, 10, 110, ..., 111111111110.
+		 */
+
+		const uint32 codeCount = 12;
+		uint8 lengths[codeCount];
+		uint32 msbCodes[codeCount], lsbCodes[codeCount], symbols[codeCount];
+		for (uint32 i = 0; i < codeCount; i++) {
+			lengths[i] = i + 1;
+			msbCodes[i] = (1 << (i + 1)) - 2;
+			lsbCodes[i] = (1 << i) - 1;
+			symbols[i] = i + 1;
+		}
+
+		Common::Huffman msbHuffman(0, codeCount, msbCodes, lengths, symbols);
+		Common::Huffman lsbHuffman(0, codeCount, lsbCodes, lengths, symbols);
+
+		// 12, 1, 11, 2, 3: 111111111110 0 11111111110 10 110 and padding
+		const uint32 expected[] = {12, 1, 11, 2, 3};
+		byte msbInput[] = {0xFF, 0xE7, 0xFE, 0xB0};
+		byte lsbInput[] = {0xFF, 0xE7, 0x7F, 0x0D};
+
+		Common::MemoryReadStream msbStream(msbInput, sizeof(msbInput));
+		Common::BitStream8MSB msbBits(msbStream);
+		Common::MemoryReadStream lsbStream(lsbInput, sizeof(lsbInput));
+		Common::BitStream8LSB lsbBits(lsbStream);
+
+		for (uint32 i = 0; i < ARRAYSIZE(expected); i++) {
+			TS_ASSERT_EQUALS(msbHuffman.getSymbol(msbBits), expected[i]);
+			TS_ASSERT_EQUALS(lsbHuffman.getSymbol(lsbBits), expected[i]);
+		}
+		TS_ASSERT_EQUALS(msbBits.pos(), 29u);
+		TS_ASSERT_EQUALS(lsbBits.pos(), 29u);
+	}
 };
@@ -0,0 +1,50 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/jobs.h"
+
+static void incrementJob(void *param) {
+	(*(int *)param)++;
+}
+
+static void fillRange(void *param, uint begin, uint end) {
+	byte *data = (byte *)param;
+	for (uint i = begin; i < end; ++i)
+		data[i]++;
+}
+
+class JobSystemTestSuite : public CxxTest::TestSuite
+{
+	public:
+	void test_submit_and_wait() {
+		int value = 0;
+		Common::JobSystem::Counter counter;
+		for (int i = 0; i < 10; ++i)
+			JobMan.submit(incrementJob, &value, counter);
+		JobMan.wait(counter);
+		TS_ASSERT_EQUALS(value, 10);
+	}
+
+	void test_parallel_for() {
+		byte data[1000];
+		memset(data, 0, sizeof(data));
+
+		JobMan.parallelFor(10, 990, 7, fillRange, data);
+
+		for (uint i = 0; i < ARRAYSIZE(data); ++i)
+			TS_ASSERT_EQUALS(data[i], (i >= 10 && i < 990) ? 1 : 0);
+	}
+
+	void test_parallel_for_empty() {
+		byte data[4] = { 0, 0, 0, 0 };
+		JobMan.parallelFor(3, 3, 1, fillRange, data);
+		JobMan.parallelFor(3, 1, 1, fillRange, data);
+		TS_ASSERT_EQUALS(data[1], 0);
+		TS_ASSERT_EQUALS(data[3], 0);
+	}
+
+	void test_inline_fallback() {
+		// Without a backend there are no threads, so all jobs run inline.
+		if (!g_system)
+			TS_ASSERT_EQUALS(JobMan.getWorkerCount(), 0U);
+	}
+};
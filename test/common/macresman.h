@@ -0,0 +1,112 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/macresman.h"
+#include "common/memstream.h"
+
+class MacResManagerTestSuite : public CxxTest::TestSuite
+{
+	// A MacBinary file without data fork, whose resource fork holds
+	// 'TEST' 128 "abc", 'TEST' 129 "Second" "de" and 'STR ' 128 "Second" "f".
+	void writeMacBinary(Common::WriteStream &stream) {
+		byte header[128];
+		memset(header, 0, sizeof(header));
+		header[1] = 4;
+		memcpy(header + 2, "test", 4);
+		WRITE_BE_UINT32(header + 87, 123);
+		stream.write(header, sizeof(header));
+
+		// Fork header
+		stream.writeUint32BE(16);
+		stream.writeUint32BE(34);
+		stream.writeUint32BE(18);
+		stream.writeUint32BE(89);
+
+		// Resource data
+		stream.writeUint32BE(3);
+		stream.write("abc", 3);
+		stream.writeUint32BE(2);
+		stream.write("de", 2);
+		stream.writeUint32BE(1);
+		stream.write("f", 1);
+
+		// Map header, with the type list at 28 and the names at 82
+		for (int i = 0; i < 22; ++i)
+			stream.writeByte(0);
+		stream.writeUint16BE(0);
+		stream.writeUint16BE(28);
+		stream.writeUint16BE(82);
+		stream.writeUint16BE(1);
+
+		// Types, with their reference lists at 18 and 42
+		stream.writeUint32BE(MKTAG('T', 'E', 'S', 'T'));
+		stream.writeUint16BE(1);
+		stream.writeUint16BE(18);
+		stream.writeUint32BE(MKTAG('S', 'T', 'R', ' '));
+		stream.writeUint16BE(0);
+		stream.writeUint16BE(42);
+
+		// References
+		writeReference(stream, 128, -1, 0);
+		writeReference(stream, 129, 0, 7);
+		writeReference(stream, 128, 0, 13);
+
+		// Names
+		stream.writeByte(6);
+		stream.write("Second", 6);
+
+		// Padding
+		for (int i = 0; i < 5; ++i)
+			stream.writeByte(0);
+	}
+
+	void writeReference(Common::WriteStream &stream, uint16 id, int16 nameOffset, uint32 dataOffset) {
+		stream.writeUint16BE(id);
+		stream.writeSint16BE(nameOffset);
+		stream.writeUint32BE(dataOffset);
+		stream.writeUint32BE(0);
+	}
+
+	Common::String readResource(Common::SeekableReadStream *stream) {
+		Common::String result;
+		if (!stream)
+			return "<none>";
+		while (!stream->eos()) {
+			char c = stream->readByte();
+			if (!stream->eos())
+				result += c;
+		}
+		delete stream;
+		return result;
+	}
+
+public:
+	void test_get_resource() {
+		Common::MemoryWriteStreamDynamic file(DisposeAfterUse::YES);
+		writeMacBinary(file);
+		TS_ASSERT_EQUALS(file.size(), 256U);
+
+		// The resource manager takes over the stream
+		Common::MemoryReadStream *stream = new Common::MemoryReadStream(file.getData(), file.size());
+		Common::MacResManager resMan;
+		TS_ASSERT(resMan.loadFromMacBinary(*stream));
+
+		TS_ASSERT_EQUALS(readResource(resMan.getResource(MKTAG('T', 'E', 'S', 'T'), 128)), "abc");
+		TS_ASSERT_EQUALS(readResource(resMan.getResource(MKTAG('T', 'E', 'S', 'T'), 129)), "de");
+		TS_ASSERT_EQUALS(readResource(resMan.getResource(MKTAG('S', 'T', 'R', ' '), 128)), "f");
+		TS_ASSERT_EQUALS(readResource(resMan.getResource(MKTAG('S', 'T', 'R', ' '), 129)), "<none>");
+		TS_ASSERT_EQUALS(readResource(resMan.getResource(MKTAG('N', 'O', 'N', 'E'), 128)), "<none>");
+
+		// Names match regardless of case, the first type wins for untyped lookups
+		TS_ASSERT_EQUALS(readResource(resMan.getResource("second")), "de");
+		TS_ASSERT_EQUALS(readResource(resMan.getResource(MKTAG('S', 'T', 'R', ' '), "SECOND")), "f");
+		TS_ASSERT_EQUALS(readResource(resMan.getResource("third")), "<none>");
+
+		TS_ASSERT_EQUALS(resMan.getResName(MKTAG('T', 'E', 'S', 'T'), 129), "Second");
+
+		Common::MacResIDArray ids = resMan.getResIDArray(MKTAG('T', 'E', 'S', 'T'));
+		TS_ASSERT_EQUALS(ids.size(), 2U);
+		TS_ASSERT_EQUALS(ids[0], 128);
+		TS_ASSERT_EQUALS(ids[1], 129);
+		TS_ASSERT(resMan.getResIDArray(MKTAG('N', 'O', 'N', 'E')).empty());
+	}
+};
@@ -104,4 +104,56 @@ class MemoryReadStreamTestSuite : public CxxTest::TestSuite {
 		ms.seek(0, SEEK_SET);
 		TS_ASSERT(!ms.eos());
 	}
+
+	void test_contiguous_view() {
+		byte contents[] = { 1, 2, 3, 4, 5, 6, 7 };
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		TS_ASSERT_EQUALS(ms.getContiguousView(0, 7), contents);
+		TS_ASSERT_EQUALS(ms.getContiguousView(3, 2), contents + 3);
+		TS_ASSERT_EQUALS(ms.getContiguousView(7, 0), contents + 7);
+		TS_ASSERT(!ms.getContiguousView(3, 5));
+		TS_ASSERT(!ms.getContiguousView(8, 0));
+		TS_ASSERT(!ms.getContiguousView(1, 0xFFFFFFFF));
+
+		// Querying the view must not move the stream
+		TS_ASSERT_EQUALS(ms.pos(), 0);
+	}
+
+	void test_read_arrays() {
+		byte contents[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		uint16 words[4];
+		TS_ASSERT_EQUALS(ms.readUint16ArrayLE(words, 2), 2U);
+		TS_ASSERT_EQUALS(words[0], 0x0201);
+		TS_ASSERT_EQUALS(words[1], 0x0403);
+		TS_ASSERT_EQUALS(ms.readUint16ArrayBE(words, 2), 2U);
+		TS_ASSERT_EQUALS(words[0], 0x0506);
+		TS_ASSERT_EQUALS(words[1], 0x0708);
+
+		ms.seek(0, SEEK_SET);
+		uint32 dwords[3];
+		TS_ASSERT_EQUALS(ms.readUint32ArrayLE(dwords, 1), 1U);
+		TS_ASSERT_EQUALS(dwords[0], 0x04030201U);
+		TS_ASSERT_EQUALS(ms.readUint32ArrayBE(dwords, 1), 1U);
+		TS_ASSERT_EQUALS(dwords[0], 0x05060708U);
+
+		// Only complete values are counted
+		ms.seek(2, SEEK_SET);
+		TS_ASSERT_EQUALS(ms.readUint32ArrayLE(dwords, 3), 1U);
+		TS_ASSERT(ms.eos());
+	}
+
+	void test_read_float_arrays() {
+		// 1.0f and -2.5f
+		byte contents[] = { 0x00, 0x00, 0x80, 0x3F, 0xC0, 0x20, 0x00, 0x00 };
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		float values[2];
+		TS_ASSERT_EQUALS(ms.readFloatArrayLE(values, 1), 1U);
+		TS_ASSERT_EQUALS(values[0], 1.0f);
+		TS_ASSERT_EQUALS(ms.readFloatArrayBE(values + 1, 1), 1U);
+		TS_ASSERT_EQUALS(values[1], -2.5f);
+	}
 };
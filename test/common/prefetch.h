@@ -0,0 +1,58 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "common/prefetch.h"
+
+class PrefetchTestSuite : public CxxTest::TestSuite
+{
+	Common::String saveManifest() {
+		Common::MemoryWriteStreamDynamic stream(DisposeAfterUse::YES);
+		FilePrefetchMan.saveManifest(stream);
+		return Common::String((const char *)stream.getData(), stream.size());
+	}
+
+	public:
+	void tearDown() {
+		FilePrefetchMan.stopRecording();
+	}
+
+	void test_record_ranges() {
+		FilePrefetchMan.startRecording();
+		TS_ASSERT(Common::FilePrefetcher::isRecording());
+
+		const int data = FilePrefetchMan.recordOpen("DATA.BIN");
+		const int music = FilePrefetchMan.recordOpen("music.dat");
+		TS_ASSERT_EQUALS(FilePrefetchMan.recordOpen("data.bin"), data);
+
+		// Reads are rounded to whole blocks, and adjacent blocks merged
+		FilePrefetchMan.recordRead(data, 10, 100);
+		FilePrefetchMan.recordRead(data, 70000, 10);
+		FilePrefetchMan.recordRead(data, 300000, 10);
+		FilePrefetchMan.recordRead(data, 200000, 20000);
+		FilePrefetchMan.recordRead(music, 0, 0);
+
+		TS_ASSERT_EQUALS(saveManifest(),
+			"# ScummVM file prefetch manifest\n"
+			"DATA.BIN\t0-131072 196608-327680\n");
+	}
+
+	void test_restart_recording() {
+		FilePrefetchMan.startRecording();
+		const int file = FilePrefetchMan.recordOpen("a");
+		FilePrefetchMan.recordRead(file, 0, 1);
+
+		// Files opened before a new recording do not add to it, even to
+		// files recorded in the same place
+		FilePrefetchMan.startRecording();
+		FilePrefetchMan.recordRead(file, 0, 1);
+		TS_ASSERT_EQUALS(saveManifest(), "# ScummVM file prefetch manifest\n");
+
+		const int other = FilePrefetchMan.recordOpen("b");
+		TS_ASSERT_DIFFERS(other, file);
+		FilePrefetchMan.recordRead(file, 0, 1);
+		TS_ASSERT_EQUALS(saveManifest(), "# ScummVM file prefetch manifest\n");
+
+		FilePrefetchMan.stopRecording();
+		TS_ASSERT(!Common::FilePrefetcher::isRecording());
+	}
+};
@@ -0,0 +1,102 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "common/profiler.h"
+
+class ProfilerTestSuite : public CxxTest::TestSuite
+{
+	public:
+	void tearDown() {
+		ProfilerMan.setEnabled(false);
+	}
+
+	void test_frame_history() {
+		ProfilerMan.setEnabled(true);
+		const int update = ProfilerMan.getZone("update", Common::Profiler::kTrackMain);
+		const int mixer = ProfilerMan.getZone("mixer", Common::Profiler::kTrackAudio);
+		TS_ASSERT_EQUALS(ProfilerMan.getZone("update", Common::Profiler::kTrackMain), update);
+
+		// The first frame end only starts the history
+		ProfilerMan.endFrame(1000);
+		for (int i = 0; i < 4; ++i) {
+			const uint64 start = 1000 + i * 20000;
+			ProfilerMan.addSample(update, start, 5000);
+			ProfilerMan.addSample(update, start + 6000, 1000);
+			if (i % 2)
+				ProfilerMan.addSample(mixer, start + 100, 2000);
+			ProfilerMan.endFrame(start + (i == 3 ? 26000 : 20000));
+		}
+
+		TS_ASSERT_EQUALS(ProfilerMan.getFrameCount(), 4U);
+		TS_ASSERT_EQUALS(ProfilerMan.getAverageFrameTime(), 21500U);
+		TS_ASSERT_EQUALS(ProfilerMan.getMaxFrameTime(), 26000U);
+		TS_ASSERT_EQUALS(ProfilerMan.getAverageZoneTime(update), 6000U);
+		TS_ASSERT_EQUALS(ProfilerMan.getAverageZoneTime(mixer), 1000U);
+		TS_ASSERT_EQUALS(ProfilerMan.getSummary(), "Frame 21.5 ms, max 26.0, update 6.0, mixer 1.0");
+	}
+
+	void test_frame_history_wraps() {
+		ProfilerMan.setEnabled(true);
+		const int update = ProfilerMan.getZone("update", Common::Profiler::kTrackMain);
+
+		ProfilerMan.endFrame(1);
+		for (uint i = 1; i <= Common::Profiler::kFrameHistory + 10; ++i) {
+			ProfilerMan.addSample(update, i * 1000, i <= 10 ? 900 : 100);
+			ProfilerMan.endFrame(1 + i * 1000);
+		}
+
+		TS_ASSERT_EQUALS(ProfilerMan.getFrameCount(), (uint)Common::Profiler::kFrameHistory);
+		TS_ASSERT_EQUALS(ProfilerMan.getAverageZoneTime(update), 100U);
+	}
+
+	void test_counters() {
+		ProfilerMan.setEnabled(true);
+
+		// Counts before the first frame end belong to no frame of the history
+		ProfilerMan.addCount("misses", 7);
+		ProfilerMan.endFrame(1000);
+		for (int i = 0; i < 4; ++i) {
+			ProfilerMan.addCount("misses", 2);
+			ProfilerMan.addCount("sprites", 10 * i);
+			ProfilerMan.endFrame(1000 + (i + 1) * 20000);
+		}
+
+		TS_ASSERT_EQUALS(ProfilerMan.getCounterCount(), 2U);
+		TS_ASSERT_EQUALS(Common::String(ProfilerMan.getCounterName(0)), "misses");
+		TS_ASSERT_EQUALS(ProfilerMan.getCounterTotal(0), 15U);
+		TS_ASSERT_EQUALS(ProfilerMan.getAverageCount(0), 2U);
+		TS_ASSERT_EQUALS(ProfilerMan.getCountRate(0), 100U);
+		TS_ASSERT_EQUALS(ProfilerMan.getCounterTotal(1), 60U);
+		TS_ASSERT_EQUALS(ProfilerMan.getAverageCount(1), 15U);
+		TS_ASSERT_EQUALS(ProfilerMan.getCountRate(1), 750U);
+
+		// Resetting only counts the frames that follow
+		ProfilerMan.resetCounters();
+		TS_ASSERT_EQUALS(ProfilerMan.getCounterTotal(0), 0U);
+		TS_ASSERT_EQUALS(ProfilerMan.getAverageCount(0), 0U);
+		ProfilerMan.addCount("sprites", 5);
+		ProfilerMan.endFrame(101000);
+		TS_ASSERT_EQUALS(ProfilerMan.getCounterCount(), 2U);
+		TS_ASSERT_EQUALS(ProfilerMan.getAverageCount(1), 5U);
+		TS_ASSERT_EQUALS(ProfilerMan.getCountRate(1), 250U);
+	}
+
+	void test_trace() {
+		ProfilerMan.setEnabled(true);
+		const int update = ProfilerMan.getZone("update", Common::Profiler::kTrackMain);
+		const int mixer = ProfilerMan.getZone("mixer", Common::Profiler::kTrackAudio);
+
+		// Nested zones are recorded when they end, so the outer one comes last
+		ProfilerMan.addSample(mixer, 5500, 300);
+		ProfilerMan.addSample(update, 5000, 2000);
+
+		Common::MemoryWriteStreamDynamic stream(DisposeAfterUse::YES);
+		ProfilerMan.writeTrace(stream);
+		const Common::String trace((const char *)stream.getData(), stream.size());
+
+		TS_ASSERT(trace.hasPrefix("{\"traceEvents\":["));
+		TS_ASSERT(trace.contains("{\"name\":\"mixer\",\"ph\":\"X\",\"ts\":500,\"dur\":300,\"pid\":1,\"tid\":1}"));
+		TS_ASSERT(trace.contains("{\"name\":\"update\",\"ph\":\"X\",\"ts\":0,\"dur\":2000,\"pid\":1,\"tid\":0}"));
+		TS_ASSERT(trace.hasSuffix("]}\n"));
+	}
+};
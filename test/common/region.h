@@ -0,0 +1,154 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/region.h"
+
+#include "test/random.h"
+
+class RegionTestSuite : public CxxTest::TestSuite
+{
+private:
+	enum { kSize = 32 };
+
+	struct Grid {
+		bool pixels[kSize][kSize];
+
+		Grid() { memset(pixels, 0, sizeof(pixels)); }
+	};
+
+	static Common::Rect randomRect(uint32 &seed) {
+		int16 c[4];
+		for (int i = 0; i < 4; i++) {
+			c[i] = (Test::nextRandom(seed) >> 16) % (kSize + 1);
+		}
+		return Common::Rect(MIN(c[0], c[1]), MIN(c[2], c[3]), MAX(c[0], c[1]), MAX(c[2], c[3]));
+	}
+
+	static void fill(Grid &grid, const Common::Rect &r, bool value) {
+		for (int y = r.top; y < r.bottom; y++)
+			for (int x = r.left; x < r.right; x++)
+				grid.pixels[y][x] = value;
+	}
+
+	// The rects must be disjoint, in y-x banded order and cover exactly the grid
+	static bool matches(const Common::Region &region, const Grid &grid) {
+		Grid covered;
+		const Common::Rect *prev = nullptr;
+
+		for (Common::Region::const_iterator i = region.begin(); i != region.end(); ++i) {
+			if (i->isEmpty())
+				return false;
+
+			if (prev) {
+				const bool sameBand = prev->top == i->top;
+				if (sameBand && (prev->bottom != i->bottom || prev->right >= i->left))
+					return false;
+				if (!sameBand && prev->bottom > i->top)
+					return false;
+			}
+			prev = &*i;
+
+			for (int y = i->top; y < i->bottom; y++) {
+				for (int x = i->left; x < i->right; x++) {
+					if (covered.pixels[y][x])
+						return false;
+					covered.pixels[y][x] = true;
+				}
+			}
+		}
+
+		return memcmp(covered.pixels, grid.pixels, sizeof(grid.pixels)) == 0;
+	}
+
+public:
+	void test_empty() {
+		Common::Region region;
+		TS_ASSERT(region.isEmpty());
+		TS_ASSERT(Common::Region(Common::Rect(3, 3, 3, 8)).isEmpty());
+		TS_ASSERT_EQUALS(region.getBounds(), Common::Rect());
+
+		region.unite(Common::Rect(2, 2, 4, 4));
+		region.subtract(Common::Rect(0, 0, 10, 10));
+		TS_ASSERT(region.isEmpty());
+	}
+
+	void test_union_merges() {
+		// Two touching rects of the same height become one
+		Common::Region region(Common::Rect(0, 0, 10, 10));
+		region.unite(Common::Rect(10, 0, 20, 10));
+		TS_ASSERT_EQUALS(region.size(), 1u);
+		TS_ASSERT_EQUALS(region.getRects()[0], Common::Rect(0, 0, 20, 10));
+
+		// Overlapping rects are not covered twice
+		region.unite(Common::Rect(5, 5, 25, 15));
+		TS_ASSERT_EQUALS(region.getArea(), 20u * 10u + 20u * 10u - 15u * 5u);
+		TS_ASSERT_EQUALS(region.getBounds(), Common::Rect(0, 0, 25, 15));
+		TS_ASSERT(region.contains(24, 14));
+		TS_ASSERT(!region.contains(24, 4));
+		TS_ASSERT(region.intersects(Common::Rect(20, 0, 30, 6)));
+		TS_ASSERT(!region.intersects(Common::Rect(20, 0, 30, 5)));
+
+		// The same area always has the same rects
+		Common::Region other(Common::Rect(5, 5, 25, 15));
+		other.unite(Common::Rect(0, 0, 20, 10));
+		TS_ASSERT(region == other);
+	}
+
+	void test_append_below() {
+		Common::Region region;
+		for (int16 y = 0; y < 40; y += 4)
+			region.unite(Common::Rect(2, y, 30, y + 4));
+		TS_ASSERT_EQUALS(region.size(), 1u);
+		TS_ASSERT_EQUALS(region.getRects()[0], Common::Rect(2, 0, 30, 40));
+	}
+
+	void test_random_operations() {
+		uint32 seed = 1;
+		for (int iteration = 0; iteration < 200; iteration++) {
+			Common::Region region;
+			Grid grid;
+
+			for (int step = 0; step < 12; step++) {
+				const Common::Rect r = randomRect(seed);
+				const int op = (seed >> 8) % 4;
+
+				if (op == 0) {
+					region.intersect(r);
+					Grid mask;
+					fill(mask, r, true);
+					for (int y = 0; y < kSize; y++)
+						for (int x = 0; x < kSize; x++)
+							grid.pixels[y][x] = grid.pixels[y][x] && mask.pixels[y][x];
+				} else if (op == 1) {
+					region.subtract(r);
+					fill(grid, r, false);
+				} else {
+					region.unite(r);
+					fill(grid, r, true);
+				}
+
+				if (!matches(region, grid)) {
+					TS_FAIL("Region does not match the expected area");
+					return;
+				}
+			}
+
+			// Regions combined with regions
+			Common::Region other(randomRect(seed));
+			other.unite(randomRect(seed));
+			Common::Region united = region, subtracted = region;
+			united.unite(other);
+			subtracted.subtract(other);
+			subtracted.unite(other);
+			TS_ASSERT(united == subtracted);
+		}
+	}
+
+	void test_translate() {
+		Common::Region region(Common::Rect(0, 0, 4, 4));
+		region.unite(Common::Rect(2, 2, 6, 6));
+		region.translate(10, 20);
+		TS_ASSERT_EQUALS(region.getBounds(), Common::Rect(10, 20, 16, 26));
+		TS_ASSERT(region.contains(15, 25));
+		TS_ASSERT(!region.contains(10, 25));
+	}
+};
@@ -0,0 +1,68 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/ringbuffer.h"
+
+class RingBufferTestSuite : public CxxTest::TestSuite {
+public:
+	void test_capacity() {
+		Common::SPSCRingBuffer<int> a(5);
+		TS_ASSERT_EQUALS(a.capacity(), 8u);
+
+		Common::SPSCRingBuffer<int> b(16);
+		TS_ASSERT_EQUALS(b.capacity(), 16u);
+	}
+
+	void test_push_pop() {
+		Common::SPSCRingBuffer<int> buffer(4);
+		int value = 0;
+
+		TS_ASSERT(buffer.empty());
+		TS_ASSERT(!buffer.pop(value));
+		TS_ASSERT(buffer.front() == nullptr);
+
+		TS_ASSERT(buffer.push(1));
+		TS_ASSERT(buffer.push(2));
+		TS_ASSERT_EQUALS(buffer.size(), 2u);
+		TS_ASSERT_EQUALS(*buffer.front(), 1);
+
+		TS_ASSERT(buffer.pop(value));
+		TS_ASSERT_EQUALS(value, 1);
+		TS_ASSERT(buffer.pop(value));
+		TS_ASSERT_EQUALS(value, 2);
+		TS_ASSERT(buffer.empty());
+	}
+
+	void test_full() {
+		Common::SPSCRingBuffer<int> buffer(4);
+		for (int i = 0; i < 4; ++i)
+			TS_ASSERT(buffer.push(i));
+		TS_ASSERT(!buffer.push(4));
+		TS_ASSERT_EQUALS(buffer.size(), 4u);
+
+		int value;
+		TS_ASSERT(buffer.pop(value));
+		TS_ASSERT_EQUALS(value, 0);
+		TS_ASSERT(buffer.push(4));
+		TS_ASSERT(!buffer.push(5));
+	}
+
+	void test_wrap_around() {
+		Common::SPSCRingBuffer<int> buffer(4);
+		int value;
+
+		// Cycle through the slots many times, keeping a few elements queued.
+		int next = 0, expected = 0;
+		for (int i = 0; i < 1000; ++i) {
+			while (buffer.push(next))
+				++next;
+			for (int j = 0; j < 3; ++j) {
+				TS_ASSERT(buffer.pop(value));
+				TS_ASSERT_EQUALS(value, expected++);
+			}
+		}
+
+		while (buffer.pop(value))
+			TS_ASSERT_EQUALS(value, expected++);
+		TS_ASSERT_EQUALS(expected, next);
+	}
+};
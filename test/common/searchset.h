@@ -0,0 +1,101 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/archive.h"
+#include "common/memstream.h"
+
+class CountingArchive : public Common::Archive {
+public:
+	Common::String _file;
+	mutable int _queries;
+
+	CountingArchive(const char *file) : _file(file), _queries(0) {}
+
+	virtual bool hasFile(const Common::String &name) const {
+		_queries++;
+		return name.equalsIgnoreCase(_file);
+	}
+
+	virtual int listMembers(Common::ArchiveMemberList &list) const {
+		return 0;
+	}
+
+	virtual const Common::ArchiveMemberPtr getMember(const Common::String &name) const {
+		return Common::ArchiveMemberPtr();
+	}
+
+	virtual Common::SeekableReadStream *createReadStreamForMember(const Common::String &name) const {
+		if (!hasFile(name))
+			return nullptr;
+		return new Common::MemoryReadStream((const byte *)_file.c_str(), _file.size());
+	}
+};
+
+class SearchSetTestSuite : public CxxTest::TestSuite
+{
+	public:
+	void test_cached_lookups() {
+		Common::SearchSet set;
+		CountingArchive *a = new CountingArchive("a.dat");
+		CountingArchive *b = new CountingArchive("b.dat");
+		set.add("a", a, 1);
+		set.add("b", b, 0);
+
+		TS_ASSERT(set.hasFile("b.dat"));
+		TS_ASSERT(set.hasFile("B.DAT"));
+		TS_ASSERT_EQUALS(a->_queries, 1);
+		TS_ASSERT_EQUALS(b->_queries, 1);
+
+		Common::SeekableReadStream *stream = set.createReadStreamForMember("b.dat");
+		TS_ASSERT(stream);
+		TS_ASSERT_EQUALS(stream->size(), 5);
+		delete stream;
+		TS_ASSERT_EQUALS(a->_queries, 1);
+		TS_ASSERT_EQUALS(b->_queries, 2);
+
+		// Misses are remembered as well.
+		TS_ASSERT(!set.hasFile("c.dat"));
+		TS_ASSERT(!set.hasFile("c.dat"));
+		TS_ASSERT(!set.createReadStreamForMember("c.dat"));
+		TS_ASSERT_EQUALS(a->_queries, 2);
+		TS_ASSERT_EQUALS(b->_queries, 3);
+
+		const Common::SearchSet::CacheStats &stats = set.getCacheStats();
+		TS_ASSERT_EQUALS(stats.misses, 2U);
+		TS_ASSERT_EQUALS(stats.hits, 4U);
+		TS_ASSERT_EQUALS(stats.negativeHits, 2U);
+	}
+
+	void test_invalidation() {
+		Common::SearchSet set;
+		set.add("a", new CountingArchive("a.dat"));
+		TS_ASSERT(!set.hasFile("c.dat"));
+
+		set.add("c", new CountingArchive("c.dat"));
+		TS_ASSERT(set.hasFile("c.dat"));
+
+		set.remove("c");
+		TS_ASSERT(!set.hasFile("c.dat"));
+
+		// A higher priority archive must win once it is added.
+		CountingArchive *a = new CountingArchive("a.dat");
+		set.add("a2", a, 10);
+		Common::SeekableReadStream *stream = set.createReadStreamForMember("a.dat");
+		delete stream;
+		TS_ASSERT_EQUALS(a->_queries, 1);
+		TS_ASSERT_EQUALS(set.getCacheStats().invalidations, 3U);
+	}
+
+	void test_nested_invalidation() {
+		Common::SearchSet set;
+		Common::SearchSet *nested = new Common::SearchSet();
+		set.add("nested", nested);
+		TS_ASSERT(!set.hasFile("c.dat"));
+
+		// Changes of the nested set must reach the parent's cache.
+		nested->add("c", new CountingArchive("c.dat"));
+		TS_ASSERT(set.hasFile("c.dat"));
+
+		nested->remove("c");
+		TS_ASSERT(!set.hasFile("c.dat"));
+	}
+};
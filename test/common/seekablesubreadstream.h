@@ -70,4 +70,19 @@ class SeekableSubReadStreamTestSuite : public CxxTest::TestSuite {
 		b = ssrs.readByte();
 		TS_ASSERT_EQUALS(b, 1);
 	}
+
+	void test_contiguous_view() {
+		byte contents[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		Common::MemoryReadStream ms(contents, 10);
+
+		Common::SeekableSubReadStream ssrs(&ms, 2, 8);
+		TS_ASSERT_EQUALS(ssrs.getContiguousView(0, 6), contents + 2);
+		TS_ASSERT_EQUALS(ssrs.getContiguousView(4, 2), contents + 6);
+		TS_ASSERT(!ssrs.getContiguousView(4, 3));
+		TS_ASSERT(!ssrs.getContiguousView(7, 0));
+
+		// Nested sub streams resolve down to the memory block
+		Common::SeekableSubReadStream nested(&ssrs, 1, 4);
+		TS_ASSERT_EQUALS(nested.getContiguousView(1, 2), contents + 4);
+	}
 };
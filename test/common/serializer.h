@@ -1,5 +1,6 @@
 #include <cxxtest/TestSuite.h>
 
+#include "common/memstream.h"
 #include "common/serializer.h"
 #include "common/stream.h"
 
@@ -108,4 +109,45 @@ public:
 	void test_read_v2_as_v2() {
 		readVersioned_v2(_inStreamV2, 2);
 	}
+
+	void test_sync_array() {
+		// More entries than fit in one chunk, in both the stored width and a wider one
+		uint16 words[300];
+		int ints[300];
+		for (int i = 0; i < 300; ++i) {
+			words[i] = i * 251;
+			ints[i] = -i;
+		}
+
+		Common::MemoryWriteStreamDynamic out(DisposeAfterUse::YES);
+		Common::Serializer saver(0, &out);
+		saver.syncArrayAsUint16BE(words, 300);
+		saver.syncArrayAsSint16LE(ints, 300);
+		saver.syncArrayAsUint32LE(words, 2);
+		TS_ASSERT_EQUALS(saver.bytesSynced(), 1200U + 8U);
+		TS_ASSERT_EQUALS(out.size(), 1208U);
+
+		// The stored data matches syncing every entry by itself
+		const byte *data = out.getData();
+		TS_ASSERT_EQUALS(READ_BE_UINT16(data + 2 * 7), (uint16)(7 * 251));
+		TS_ASSERT_EQUALS((int16)READ_LE_UINT16(data + 600 + 2 * 299), -299);
+		TS_ASSERT_EQUALS(READ_LE_UINT32(data + 1204), (uint32)251);
+
+		uint16 wordsIn[300];
+		int intsIn[300];
+		Common::MemoryReadStream in(data, out.size());
+		Common::Serializer loader(&in, 0);
+		loader.syncArrayAsUint16BE(wordsIn, 300);
+		loader.syncArrayAsSint16LE(intsIn, 300);
+		for (int i = 0; i < 300; ++i) {
+			TS_ASSERT_EQUALS(wordsIn[i], words[i]);
+			TS_ASSERT_EQUALS(intsIn[i], ints[i]);
+		}
+
+		// Arrays outside the version range are left alone
+		intsIn[0] = 42;
+		loader.syncArrayAsSint32BE(intsIn, 2, Common::Serializer::Version(2));
+		TS_ASSERT_EQUALS(intsIn[0], 42);
+		TS_ASSERT_EQUALS(loader.bytesSynced(), 1200U);
+	}
 };
@@ -0,0 +1,97 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "common/xmlparser.h"
+
+/**
+ * Records the keys it sees, and ignores the children of keys with
+ * skip="yes".
+ */
+class RecordingXMLParser : public Common::XMLParser {
+public:
+	Common::String _log;
+
+protected:
+	CUSTOM_XML_PARSER(RecordingXMLParser) {
+		XML_KEY(list)
+			XML_PROP(name, false)
+			XML_KEY(item)
+				XML_PROP(value, true)
+				XML_PROP(skip, false)
+				XML_KEY_RECURSIVE(item)
+			KEY_END()
+		KEY_END()
+	} PARSER_END()
+
+	bool parserCallback_list(ParserNode *node) {
+		_log += "list(" + node->values.getVal("name", "") + ")";
+		return true;
+	}
+
+	bool parserCallback_item(ParserNode *node) {
+		_log += "item(" + node->values["value"] + ")";
+		if (node->values.getVal("skip", "") == "yes")
+			node->ignore = true;
+		return true;
+	}
+
+	bool closedKeyCallback(ParserNode *node) {
+		// The XML header is not part of the compiled form
+		if (!node->header)
+			_log += "/" + node->name;
+		return true;
+	}
+
+	void cleanup() {
+		_log.clear();
+	}
+};
+
+class XMLParserTestSuite : public CxxTest::TestSuite
+{
+	bool parse(RecordingXMLParser &parser, const char *xml, Common::WriteStream *compiled = 0) {
+		parser.loadBuffer((const byte *)xml, strlen(xml));
+		bool result = compiled ? parser.parse(*compiled) : parser.parse();
+		parser.close();
+		return result;
+	}
+
+public:
+	void test_parse() {
+		RecordingXMLParser parser;
+		TS_ASSERT(parse(parser,
+			"<?xml version = '1.0'?>"
+			"<list name = 'a'>"
+				"<item value = '1'/>"
+				"<item value = \"2\"><item value = '3'/></item>"
+				"<item value = '4' skip = 'yes'><item value = '5'/></item>"
+			"</list>"));
+		TS_ASSERT_EQUALS(parser._log, "list(a)item(1)/itemitem(2)item(3)/item/itemitem(4)/list");
+	}
+
+	void test_parse_compiled() {
+		const char *xml =
+			"<?xml version = '1.0'?>"
+			"<!-- A comment -->"
+			"<list name = 'a'>"
+				"<item value = '1'/>"
+				"<item value = '2'><item value = '3'/><item value = '4'></item></item>"
+				"<item value = '5' skip = 'yes'><item value = '6'/></item>"
+			"</list>"
+			"<list/>";
+
+		RecordingXMLParser parser;
+		Common::MemoryWriteStreamDynamic compiled(DisposeAfterUse::YES);
+		TS_ASSERT(parse(parser, xml, &compiled));
+		const Common::String expected = parser._log;
+
+		// Replaying the compiled form does not need the XML
+		Common::MemoryReadStream stream(compiled.getData(), compiled.size());
+		TS_ASSERT(parser.parseCompiled(stream));
+		TS_ASSERT_EQUALS(parser._log, expected);
+
+		// The parser can be reused for the XML afterwards
+		TS_ASSERT(parse(parser, xml));
+		TS_ASSERT_EQUALS(parser._log, expected);
+	}
+};
@@ -0,0 +1,89 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "common/zlib.h"
+
+#include "test/random.h"
+
+#if defined(USE_ZLIB)
+
+class ZlibTestSuite : public CxxTest::TestSuite
+{
+	enum {
+		kDataSize = 3 * 1024 * 1024 + 123
+	};
+
+	byte *_data;
+	byte *_compressed;
+	uint32 _compressedSize;
+
+	public:
+	void setUp() {
+		// Compressible, but not trivially so, to get plenty of deflate blocks.
+		_data = (byte *)malloc(kDataSize);
+		uint32 seed = 12345;
+		for (uint32 i = 0; i < kDataSize; ++i) {
+			_data[i] = 'a' + ((Test::nextRandom(seed) >> 16) % 16);
+		}
+
+		Common::MemoryWriteStreamDynamic *mem = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO);
+		Common::WriteStream *gzip = Common::wrapCompressedWriteStream(mem);
+		gzip->write(_data, kDataSize);
+		gzip->finalize();
+		_compressed = mem->getData();
+		_compressedSize = mem->size();
+		delete gzip;
+	}
+
+	void tearDown() {
+		free(_data);
+		free(_compressed);
+	}
+
+	void checkRead(Common::SeekableReadStream *stream, uint32 offset, uint32 length) {
+		byte buffer[256];
+		TS_ASSERT(stream->seek(offset));
+		TS_ASSERT_EQUALS((uint32)stream->pos(), offset);
+		TS_ASSERT_EQUALS(stream->read(buffer, length), length);
+		TS_ASSERT(memcmp(buffer, _data + offset, length) == 0);
+	}
+
+	void checkSeeks(Common::SeekableReadStream *stream) {
+		TS_ASSERT_EQUALS(stream->size(), kDataSize);
+
+		// Read everything once, so checkpoints exist all over the stream.
+		byte *all = (byte *)malloc(kDataSize);
+		TS_ASSERT_EQUALS(stream->read(all, kDataSize), (uint32)kDataSize);
+		TS_ASSERT(memcmp(all, _data, kDataSize) == 0);
+		free(all);
+
+		checkRead(stream, 2 * 1024 * 1024 + 17, 200);
+		checkRead(stream, 10, 100);
+		checkRead(stream, kDataSize - 50, 50);
+		checkRead(stream, 1024 * 1024 - 3, 256);
+		checkRead(stream, 3 * 1024 * 1024 - 300, 256);
+
+		byte buffer[16];
+		TS_ASSERT(stream->seek(-10, SEEK_END));
+		TS_ASSERT_EQUALS(stream->read(buffer, sizeof(buffer)), 10U);
+		TS_ASSERT(stream->eos());
+		TS_ASSERT(!stream->err());
+	}
+
+	void test_gzip_seek() {
+		Common::SeekableReadStream *stream = Common::wrapCompressedReadStream(
+			new Common::MemoryReadStream(_compressed, _compressedSize));
+		checkSeeks(stream);
+		delete stream;
+	}
+
+	void test_raw_deflate_seek() {
+		// Strip the 10 byte gzip header and the 8 byte trailer.
+		Common::SeekableReadStream *stream = Common::wrapDeflateReadStream(
+			new Common::MemoryReadStream(_compressed + 10, _compressedSize - 18), kDataSize);
+		checkSeeks(stream);
+		delete stream;
+	}
+};
+
+#endif
@@ -0,0 +1,166 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/conversion.h"
+#include "graphics/pixelformat.h"
+#include "graphics/surface.h"
+
+#include "test/random.h"
+
+class ConversionTestSuite : public CxxTest::TestSuite
+{
+private:
+	static uint32 readColor(const byte *p, uint bpp) {
+		if (bpp == 2)
+			return *(const uint16 *)p;
+		else if (bpp == 3)
+			return READ_UINT24(p);
+		else
+			return *(const uint32 *)p;
+	}
+
+	// Compare against converting every pixel through colorToARGB and ARGBToColor
+	void crossBlitTest(const Graphics::PixelFormat &srcFmt, const Graphics::PixelFormat &dstFmt, uint w, uint h, bool inPlace) {
+		const uint srcPitch = w * srcFmt.bytesPerPixel + (inPlace ? 0 : 6);
+		const uint dstPitch = w * dstFmt.bytesPerPixel + (inPlace ? 0 : 10);
+		const uint size = MAX(srcPitch, dstPitch) * h;
+
+		byte *src = new byte[size];
+		Test::fillRandom(src, size, 1);
+
+		byte *expected = new byte[size];
+		memset(expected, 0, size);
+		for (uint y = 0; y < h; y++) {
+			for (uint x = 0; x < w; x++) {
+				byte a, r, g, b;
+				srcFmt.colorToARGB(readColor(src + y * srcPitch + x * srcFmt.bytesPerPixel, srcFmt.bytesPerPixel), a, r, g, b);
+				const uint32 color = dstFmt.ARGBToColor(a, r, g, b);
+				byte *p = expected + y * dstPitch + x * dstFmt.bytesPerPixel;
+				if (dstFmt.bytesPerPixel == 2)
+					*(uint16 *)p = color;
+				else
+					*(uint32 *)p = color;
+			}
+		}
+
+		byte *dst = src;
+		if (!inPlace) {
+			dst = new byte[size];
+			memset(dst, 0, size);
+		}
+
+		TS_ASSERT(Graphics::crossBlit(dst, src, dstPitch, srcPitch, w, h, dstFmt, srcFmt));
+
+		bool equal = true;
+		for (uint y = 0; y < h; y++)
+			equal = equal && !memcmp(dst + y * dstPitch, expected + y * dstPitch, w * dstFmt.bytesPerPixel);
+		TS_ASSERT(equal);
+
+		if (!inPlace)
+			delete[] dst;
+		delete[] src;
+		delete[] expected;
+	}
+
+	void crossBlitTestAllSizes(const Graphics::PixelFormat &srcFmt, const Graphics::PixelFormat &dstFmt) {
+		// Small blits are converted pixel by pixel, large ones with tables
+		crossBlitTest(srcFmt, dstFmt, 13, 5, false);
+		crossBlitTest(srcFmt, dstFmt, 101, 67, false);
+		if (dstFmt.bytesPerPixel >= srcFmt.bytesPerPixel) {
+			crossBlitTest(srcFmt, dstFmt, 13, 5, true);
+			crossBlitTest(srcFmt, dstFmt, 101, 67, true);
+		}
+	}
+
+public:
+	void test_crossblit_16_to_32() {
+		const Graphics::PixelFormat rgb565(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		const Graphics::PixelFormat argb4444(2, 4, 4, 4, 4, 8, 4, 0, 12);
+		crossBlitTestAllSizes(rgb565, Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0));
+		crossBlitTestAllSizes(rgb565, Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0));
+		crossBlitTestAllSizes(argb4444, Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24));
+		crossBlitTestAllSizes(Graphics::PixelFormat(2, 5, 5, 5, 1, 10, 5, 0, 15), Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24));
+		// A destination with channels narrower than 8 bits
+		crossBlitTestAllSizes(rgb565, Graphics::PixelFormat(4, 6, 6, 6, 0, 12, 6, 0, 0));
+	}
+
+	void test_crossblit_32_to_16() {
+		crossBlitTestAllSizes(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
+		crossBlitTestAllSizes(Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24), Graphics::PixelFormat(2, 4, 4, 4, 4, 8, 4, 0, 12));
+	}
+
+	void test_crossblit_other() {
+		crossBlitTestAllSizes(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24));
+		crossBlitTestAllSizes(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0), Graphics::PixelFormat(2, 5, 5, 5, 0, 10, 5, 0, 0));
+		crossBlitTestAllSizes(Graphics::PixelFormat(3, 8, 8, 8, 0, 16, 8, 0, 0), Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0));
+		crossBlitTestAllSizes(Graphics::PixelFormat(3, 8, 8, 8, 0, 0, 8, 16, 0), Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
+	}
+
+	void test_convert_palette() {
+		byte palette[256 * 3];
+		Test::fillRandom(palette, sizeof(palette), 2);
+
+		Graphics::Surface surface;
+		surface.create(37, 11, Graphics::PixelFormat::createFormatCLUT8());
+		Test::fillRandom((byte *)surface.getPixels(), surface.pitch * surface.h, 3);
+
+		const Graphics::PixelFormat formats[2] = {
+			Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0),
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0)
+		};
+
+		for (int i = 0; i < 2; i++) {
+			const Graphics::PixelFormat &format = formats[i];
+			Graphics::Surface *converted = surface.convertTo(format, palette);
+			Graphics::Surface inPlace;
+			inPlace.copyFrom(surface);
+			inPlace.convertToInPlace(format, palette);
+
+			bool equal = true;
+			for (int y = 0; y < surface.h; y++) {
+				for (int x = 0; x < surface.w; x++) {
+					const byte index = *(const byte *)surface.getBasePtr(x, y);
+					const uint32 color = format.RGBToColor(palette[index * 3], palette[index * 3 + 1], palette[index * 3 + 2]);
+					equal = equal && readColor((const byte *)converted->getBasePtr(x, y), format.bytesPerPixel) == color;
+					equal = equal && readColor((const byte *)inPlace.getBasePtr(x, y), format.bytesPerPixel) == color;
+				}
+			}
+			TS_ASSERT(equal);
+
+			converted->free();
+			delete converted;
+			inPlace.free();
+		}
+
+		surface.free();
+	}
+
+	void test_crossblit_map() {
+		uint32 map[256];
+		Test::fillRandom((byte *)map, sizeof(map), 4);
+
+		const uint w = 23, h = 5, srcPitch = w + 3;
+		byte src[srcPitch * h];
+		Test::fillRandom(src, sizeof(src), 5);
+		for (uint i = 0; i < sizeof(src); i++)
+			src[i] ^= i;
+
+		for (uint bpp = 2; bpp <= 4; bpp += 2) {
+			const uint dstPitch = w * bpp + 8;
+			byte dst[(w * 4 + 8) * h];
+			memset(dst, 0, sizeof(dst));
+
+			// Every width, so that the tail of the unrolled loop is covered
+			bool equal = true;
+			for (uint width = 0; width <= w; width++) {
+				Graphics::crossBlitMap(dst, src, dstPitch, srcPitch, width, h, bpp, map);
+				for (uint y = 0; y < h; y++) {
+					for (uint x = 0; x < width; x++) {
+						const uint32 color = (bpp == 2) ? (uint16)map[src[y * srcPitch + x]] : map[src[y * srcPitch + x]];
+						equal = equal && readColor(dst + y * dstPitch + x * bpp, bpp) == color;
+					}
+				}
+			}
+			TS_ASSERT(equal);
+		}
+	}
+};
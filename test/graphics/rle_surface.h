@@ -0,0 +1,156 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/rle_surface.h"
+#include "graphics/surface.h"
+#include "common/util.h"
+
+#include "test/random.h"
+
+class RLESurfaceTestSuite : public CxxTest::TestSuite
+{
+private:
+	static uint32 getPixel(const Graphics::Surface &s, int x, int y) {
+		const byte *p = (const byte *)s.getBasePtr(x, y);
+		switch (s.format.bytesPerPixel) {
+		case 1:
+			return *p;
+		case 2:
+			return *(const uint16 *)p;
+		default:
+			return *(const uint32 *)p;
+		}
+	}
+
+	static void setPixel(Graphics::Surface &s, int x, int y, uint32 color) {
+		byte *p = (byte *)s.getBasePtr(x, y);
+		switch (s.format.bytesPerPixel) {
+		case 1:
+			*p = color;
+			break;
+		case 2:
+			*(uint16 *)p = color;
+			break;
+		default:
+			*(uint32 *)p = color;
+			break;
+		}
+	}
+
+	// Random pixels, with runs of the transparent color of varying length
+	static void fillSprite(Graphics::Surface &s, uint32 transColor) {
+		uint32 seed = 1;
+		for (int y = 0; y < s.h; y++) {
+			for (int x = 0; x < s.w; x++) {
+				const uint32 color = (Test::nextRandom(seed) >> 8) | 1;
+				const bool transparent = ((x / (1 + y % 5)) + y) % 3 == 0 || y == 0;
+				setPixel(s, x, y, transparent ? transColor : color);
+			}
+		}
+	}
+
+	static void fillBackground(Graphics::Surface &s) {
+		for (int y = 0; y < s.h; y++)
+			for (int x = 0; x < s.w; x++)
+				setPixel(s, x, y, x * 3 + y * 5 + 2);
+	}
+
+	void blitTest(int bytesPerPixel, bool useRemap) {
+		const Graphics::PixelFormat format(bytesPerPixel, 0, 0, 0, 0, 0, 0, 0, 0);
+		const uint32 transColor = 0;
+
+		Graphics::Surface sprite;
+		sprite.create(23, 11, format);
+		fillSprite(sprite, transColor);
+
+		Graphics::RLESurface rle(sprite, transColor);
+		TS_ASSERT_EQUALS(rle.w, sprite.w);
+		TS_ASSERT_EQUALS(rle.h, sprite.h);
+
+		byte remap[256];
+		for (int i = 0; i < 256; i++)
+			remap[i] = 255 - i;
+
+		Graphics::Surface target, expected;
+		target.create(40, 20, format);
+		expected.create(40, 20, format);
+
+		const Common::Rect clip(4, 3, 30, 17);
+		const Common::Point positions[] = {
+			Common::Point(5, 4), Common::Point(-7, -3), Common::Point(25, 14), Common::Point(-30, 2), Common::Point(1, 12)
+		};
+
+		for (uint i = 0; i < ARRAYSIZE(positions); i++) {
+			for (int mode = 0; mode < 4; mode++) {
+				const bool flipped = mode & 1;
+				const Common::Rect *clipRect = (mode & 2) ? &clip : nullptr;
+				const Common::Point &pos = positions[i];
+
+				fillBackground(target);
+				fillBackground(expected);
+
+				rle.blitTo(target, pos, flipped, clipRect, useRemap ? remap : nullptr);
+
+				for (int y = 0; y < sprite.h; y++) {
+					for (int x = 0; x < sprite.w; x++) {
+						const int destX = pos.x + (flipped ? sprite.w - 1 - x : x);
+						const int destY = pos.y + y;
+						if (destX < 0 || destY < 0 || destX >= expected.w || destY >= expected.h)
+							continue;
+						if (clipRect && !clipRect->contains(destX, destY))
+							continue;
+
+						const uint32 color = getPixel(sprite, x, y);
+						if (color != transColor)
+							setPixel(expected, destX, destY, useRemap ? remap[color] : color);
+					}
+				}
+
+				TS_ASSERT_EQUALS(memcmp(target.getPixels(), expected.getPixels(), target.pitch * target.h), 0);
+			}
+		}
+
+		// Decompressing restores the original sprite
+		target.free();
+		target.create(sprite.w, sprite.h, format);
+		rle.decompress(target);
+		TS_ASSERT_EQUALS(memcmp(target.getPixels(), sprite.getPixels(), sprite.pitch * sprite.h), 0);
+
+		sprite.free();
+		target.free();
+		expected.free();
+	}
+
+public:
+	void test_blit_8bpp() {
+		blitTest(1, false);
+		blitTest(1, true);
+	}
+
+	void test_blit_16bpp() {
+		blitTest(2, false);
+	}
+
+	void test_blit_32bpp() {
+		blitTest(4, false);
+	}
+
+	void test_data_size() {
+		Graphics::Surface sprite;
+		sprite.create(64, 64, Graphics::PixelFormat::createFormatCLUT8());
+		memset(sprite.getPixels(), 0, sprite.pitch * sprite.h);
+		for (int y = 16; y < 32; y++)
+			memset(sprite.getBasePtr(20, y), 7, 8);
+
+		// Only the opaque pixels are stored
+		Graphics::RLESurface rle(sprite, 0);
+		TS_ASSERT(rle.getDataSize() < 16 * 8 * 2);
+
+		Graphics::Surface out;
+		out.create(64, 64, sprite.format);
+		rle.decompress(out);
+		TS_ASSERT_EQUALS(memcmp(out.getPixels(), sprite.getPixels(), sprite.pitch * sprite.h), 0);
+
+		sprite.free();
+		out.free();
+	}
+};
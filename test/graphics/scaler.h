@@ -0,0 +1,98 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/scaler.h"
+#include "graphics/scaler/intern.h"
+
+#include "test/random.h"
+
+class ScalerTestSuite : public CxxTest::TestSuite
+{
+private:
+	static void fillImage(uint16 *pixels, int size, uint32 seed) {
+		for (int i = 0; i < size; i++) {
+			// Use few colors, so that neighbouring pixels are often equal
+			pixels[i] = ((Test::nextRandom(seed) >> 16) & 3) * 0x1863;
+		}
+	}
+
+#ifdef USE_SCALERS
+	// Scaling a whole image gives the same result as scaling it in strips
+	// too small to be split up
+	void scalerTestTemplate(ScalerProc *proc, int factor) {
+		const int width = 256, height = 203, pitch = width + 2;
+		const int stripHeight = 4;
+
+		uint16 *src = new uint16[pitch * (height + 2)];
+		fillImage(src, pitch * (height + 2), factor);
+		const uint8 *srcPtr = (const uint8 *)(src + pitch + 1);
+
+		const int dstWidth = width * factor, dstHeight = height * factor;
+		uint16 *expected = new uint16[dstWidth * dstHeight];
+		uint16 *dst = new uint16[dstWidth * dstHeight];
+
+		for (int y = 0; y < height; y += stripHeight) {
+			const int h = MIN(stripHeight, height - y);
+			proc(srcPtr + y * pitch * 2, pitch * 2, (uint8 *)(expected + y * factor * dstWidth), dstWidth * 2, width, h);
+		}
+
+		proc(srcPtr, pitch * 2, (uint8 *)dst, dstWidth * 2, width, height);
+		TS_ASSERT_EQUALS(memcmp(expected, dst, dstWidth * dstHeight * 2), 0);
+
+		delete[] src;
+		delete[] expected;
+		delete[] dst;
+	}
+#endif
+
+public:
+	void setUp() {
+		InitScalers(565);
+	}
+
+	void tearDown() {
+		DestroyScalers();
+	}
+
+	void test_diff_yuv_pattern() {
+		uint32 seed = 1;
+		bool equal = true;
+		for (int i = 0; i < 20000; i++) {
+			uint32 yuv[9];
+			for (int j = 0; j < 9; j++) {
+				Test::nextRandom(seed);
+				// Keep the channels close to each other, so that both sides
+				// of every threshold are hit
+				const uint32 y = 0x60 + ((seed >> 8) & 0x3F);
+				const uint32 u = 0x80 + ((seed >> 16) & 0x0F);
+				const uint32 v = 0x80 + ((seed >> 24) & 0x0F);
+				yuv[j] = (y << 16) | (u << 8) | v;
+			}
+
+			int expected = 0;
+			for (int j = 0, bit = 0; j < 9; j++) {
+				if (j == 4)
+					continue;
+				if (diffYUV(yuv[4], yuv[j]))
+					expected |= 1 << bit;
+				bit++;
+			}
+
+			equal = equal && (diffYUVPattern(yuv[4], yuv[0], yuv[1], yuv[2], yuv[3], yuv[5], yuv[6], yuv[7], yuv[8]) == expected);
+		}
+		TS_ASSERT(equal);
+	}
+
+#ifdef USE_SCALERS
+	void test_advmame_bands() {
+		scalerTestTemplate(AdvMame2x, 2);
+		scalerTestTemplate(AdvMame3x, 3);
+	}
+
+#ifdef USE_HQ_SCALERS
+	void test_hq_bands() {
+		scalerTestTemplate(HQ2x, 2);
+		scalerTestTemplate(HQ3x, 3);
+	}
+#endif
+#endif
+};
@@ -0,0 +1,153 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/text_cache.h"
+#include "common/util.h"
+
+// A font with antialiased box shaped glyphs, drawn like TTFFont does
+class TextCacheTestFont : public Graphics::Font {
+public:
+	int getFontHeight() const { return 10; }
+	int getMaxCharWidth() const { return 9; }
+	int getCharWidth(uint32 chr) const { return 3 + chr % 7; }
+	int getKerningOffset(uint32 left, uint32 right) const { return (left == 'A' && right == 'V') ? -1 : 0; }
+
+	Common::Rect getBoundingBox(uint32 chr) const {
+		// Glyphs reach above the line, but never into their neighbors
+		return Common::Rect(1, -2, getCharWidth(chr) - 1, 8 + chr % 3);
+	}
+
+	static byte coverage(uint32 chr, int x, int y) {
+		static const byte levels[4] = { 0, 255, 128, 40 };
+		return levels[(chr + x * 3 + y) % 4];
+	}
+
+	void drawChar(Graphics::Surface *dst, uint32 chr, int x, int y, uint32 color) const {
+		const Common::Rect box = getBoundingBox(chr);
+		uint8 sR, sG, sB;
+		dst->format.colorToRGB(color, sR, sG, sB);
+
+		for (int gy = box.top; gy < box.bottom; ++gy) {
+			for (int gx = box.left; gx < box.right; ++gx) {
+				const int px = x + gx, py = y + gy;
+				if (px < 0 || py < 0 || px >= dst->w || py >= dst->h)
+					continue;
+
+				const byte a = coverage(chr, gx, gy);
+				byte *p = (byte *)dst->getBasePtr(px, py);
+				if (dst->format.bytesPerPixel == 1) {
+					if (a >= 0x80)
+						*p = color;
+					continue;
+				}
+
+				uint32 c = dst->format.bytesPerPixel == 2 ? *(uint16 *)p : *(uint32 *)p;
+				if (a == 255) {
+					c = color;
+				} else if (a) {
+					uint8 dR, dG, dB;
+					dst->format.colorToRGB(c, dR, dG, dB);
+					dR = ((255 - a) * dR + a * sR) / 255;
+					dG = ((255 - a) * dG + a * sG) / 255;
+					dB = ((255 - a) * dB + a * sB) / 255;
+					c = dst->format.RGBToColor(dR, dG, dB);
+				}
+
+				if (dst->format.bytesPerPixel == 2)
+					*(uint16 *)p = c;
+				else
+					*(uint32 *)p = c;
+			}
+		}
+	}
+};
+
+class TextCacheTestSuite : public CxxTest::TestSuite
+{
+private:
+	static void fillBackground(Graphics::Surface &s) {
+		byte *p = (byte *)s.getPixels();
+		for (int i = 0; i < s.pitch * s.h; i++)
+			p[i] = (i * 7) & 0xFF;
+	}
+
+	void drawTest(const Graphics::PixelFormat &format, uint32 color) {
+		TextCacheTestFont font;
+		Graphics::TextCache cache;
+		const Common::String str("AVAWAY, text cache!");
+
+		Graphics::Surface target, expected;
+		target.create(100, 20, format);
+		expected.create(100, 20, format);
+
+		const Common::Point positions[] = {
+			Common::Point(3, 4), Common::Point(-10, -3), Common::Point(70, 15)
+		};
+		const Graphics::TextAlign aligns[] = {
+			Graphics::kTextAlignLeft, Graphics::kTextAlignCenter, Graphics::kTextAlignRight
+		};
+
+		for (uint i = 0; i < ARRAYSIZE(positions); i++) {
+			for (uint j = 0; j < ARRAYSIZE(aligns); j++) {
+				// Draw twice, the second time from the cache
+				for (int pass = 0; pass < 2; pass++) {
+					fillBackground(target);
+					fillBackground(expected);
+
+					cache.drawString(&target, font, str, positions[i].x, positions[i].y, 120, color, aligns[j]);
+					font.drawString(&expected, str, positions[i].x, positions[i].y, 120, color, aligns[j]);
+
+					TS_ASSERT_EQUALS(memcmp(target.getPixels(), expected.getPixels(), target.pitch * target.h), 0);
+				}
+			}
+		}
+
+		TS_ASSERT_EQUALS(cache.getCount(), ARRAYSIZE(aligns));
+
+		target.free();
+		expected.free();
+	}
+
+public:
+	void test_draw_8bpp() {
+		drawTest(Graphics::PixelFormat::createFormatCLUT8(), 7);
+	}
+
+	void test_draw_16bpp() {
+		drawTest(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0), 0xF81F);
+	}
+
+	void test_draw_32bpp() {
+		drawTest(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), 0x80C040FF);
+	}
+
+	void test_eviction() {
+		TextCacheTestFont font;
+		TextCacheTestFont otherFont;
+		Graphics::TextCache cache;
+
+		Graphics::Surface target;
+		target.create(100, 20, Graphics::PixelFormat::createFormatCLUT8());
+
+		cache.drawString(&target, font, Common::String("one"), 0, 0, 100, 1);
+		cache.drawString(&target, font, Common::String("two"), 0, 0, 100, 1);
+		cache.drawString(&target, otherFont, Common::String("one"), 0, 0, 100, 1);
+		TS_ASSERT_EQUALS(cache.getCount(), 3U);
+
+		cache.remove(&font);
+		TS_ASSERT_EQUALS(cache.getCount(), 1U);
+
+		// Shrinking the cache drops the least recently used strings
+		cache.drawString(&target, font, Common::String("three"), 0, 0, 100, 1);
+		cache.drawString(&target, otherFont, Common::String("one"), 0, 0, 100, 1);
+		const uint32 size = cache.getSize();
+		cache.setMaxSize(size - 1);
+		TS_ASSERT_EQUALS(cache.getCount(), 1U);
+		TS_ASSERT(cache.getSize() < size);
+
+		cache.clear();
+		TS_ASSERT_EQUALS(cache.getCount(), 0U);
+		TS_ASSERT_EQUALS(cache.getSize(), 0U);
+
+		target.free();
+	}
+};
@@ -0,0 +1,84 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "graphics/colormasks.h"
+#include "graphics/scaler.h"
+#include "graphics/surface.h"
+#include "graphics/thumbnail.h"
+
+class ThumbnailTestSuite : public CxxTest::TestSuite
+{
+private:
+	void roundTrip(const Graphics::PixelFormat &format) {
+		Graphics::Surface thumb;
+		thumb.create(13, 7, format);
+		byte *pixels = (byte *)thumb.getPixels();
+		for (int i = 0; i < thumb.pitch * thumb.h; ++i)
+			pixels[i] = (byte)(i * 37 + 11);
+
+		Common::MemoryWriteStreamDynamic out(DisposeAfterUse::YES);
+		TS_ASSERT(Graphics::saveThumbnail(out, thumb));
+
+		// The pixels are stored in big endian order
+		const uint headerSize = out.size() - thumb.w * thumb.h * format.bytesPerPixel;
+		if (format.bytesPerPixel == 2) {
+			TS_ASSERT_EQUALS(READ_BE_UINT16(out.getData() + headerSize), READ_UINT16(thumb.getPixels()));
+		} else {
+			TS_ASSERT_EQUALS(READ_BE_UINT32(out.getData() + headerSize), READ_UINT32(thumb.getPixels()));
+		}
+
+		Common::MemoryReadStream in(out.getData(), out.size());
+		Graphics::Surface *loaded = 0;
+		TS_ASSERT(Graphics::loadThumbnail(in, loaded));
+		TS_ASSERT(loaded);
+		TS_ASSERT_EQUALS((uint32)in.pos(), out.size());
+		TS_ASSERT_EQUALS(loaded->w, thumb.w);
+		TS_ASSERT_EQUALS(loaded->h, thumb.h);
+		TS_ASSERT(loaded->format == format);
+
+		for (int y = 0; y < thumb.h; ++y)
+			TS_ASSERT_EQUALS(memcmp(loaded->getBasePtr(0, y), thumb.getBasePtr(0, y), thumb.w * format.bytesPerPixel), 0);
+
+		loaded->free();
+		delete loaded;
+		thumb.free();
+	}
+
+public:
+	void test_round_trip_565() {
+		roundTrip(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
+	}
+
+	void test_round_trip_8888() {
+		roundTrip(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0));
+	}
+
+	void test_create_from_palette() {
+		// The left half uses one color, the right half another
+		byte pixels[320 * 200];
+		for (int y = 0; y < 200; ++y) {
+			memset(pixels + y * 320, 1, 160);
+			memset(pixels + y * 320 + 160, 2, 160);
+		}
+
+		byte palette[256 * 3];
+		memset(palette, 0, sizeof(palette));
+		palette[3] = 0xFF;
+		palette[7] = 0x80;
+		palette[8] = 0x40;
+
+		Graphics::Surface thumb;
+		TS_ASSERT(createThumbnail(&thumb, pixels, 320, 200, palette));
+		TS_ASSERT_EQUALS(thumb.w, (int)kThumbnailWidth);
+		TS_ASSERT_EQUALS(thumb.h, (int)kThumbnailHeight1);
+
+		const uint16 left = Graphics::RGBToColor<Graphics::ColorMasks<565> >(0xFF, 0, 0);
+		const uint16 right = Graphics::RGBToColor<Graphics::ColorMasks<565> >(0, 0x80, 0x40);
+		for (int y = 0; y < thumb.h; ++y) {
+			for (int x = 0; x < thumb.w; ++x)
+				TS_ASSERT_EQUALS(READ_UINT16(thumb.getBasePtr(x, y)), x < thumb.w / 2 ? left : right);
+		}
+
+		thumb.free();
+	}
+};
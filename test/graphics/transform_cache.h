@@ -0,0 +1,91 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/transform_cache.h"
+
+class TransformCacheTestSuite : public CxxTest::TestSuite
+{
+private:
+	// A 4 bytes per pixel surface of the given size
+	static Graphics::Surface *makeSurface(uint16 w, uint16 h) {
+		Graphics::Surface *surface = new Graphics::Surface();
+		surface->create(w, h, Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0));
+		return surface;
+	}
+
+public:
+	void test_find_insert() {
+		Graphics::TransformCache cache;
+		const int source = 0;
+		const Common::Rect srcRect(10, 10, 20, 20);
+		const Graphics::TransformStruct transform(200, 200, 30, 5, 5);
+
+		TS_ASSERT(!cache.find(&source, srcRect, 40, 40, transform, Graphics::FILTER_NEAREST));
+
+		Graphics::Surface *surface = makeSurface(40, 40);
+		Graphics::TransformCache::SurfacePtr ptr = cache.insert(&source, srcRect, 40, 40, transform, Graphics::FILTER_NEAREST, surface);
+		TS_ASSERT_EQUALS(ptr.get(), surface);
+		TS_ASSERT_EQUALS(cache.getSize(), 40u * 40u * 4u);
+		TS_ASSERT_EQUALS(cache.find(&source, srcRect, 40, 40, transform, Graphics::FILTER_NEAREST).get(), surface);
+
+		// Any part of the key makes a difference
+		TS_ASSERT(!cache.find(&source, srcRect, 40, 40, transform, Graphics::FILTER_BILINEAR));
+		TS_ASSERT(!cache.find(&source, Common::Rect(10, 10, 20, 21), 40, 40, transform, Graphics::FILTER_NEAREST));
+		TS_ASSERT(!cache.find(&source, srcRect, 40, 40, Graphics::TransformStruct(200, 200, 31, 5, 5), Graphics::FILTER_NEAREST));
+		TS_ASSERT(!cache.find(&cache, srcRect, 40, 40, transform, Graphics::FILTER_NEAREST));
+
+		// Blending parameters do not
+		Graphics::TransformStruct tinted = transform;
+		tinted._rgbaMod = 0x80FFFFFF;
+		tinted._flip = Graphics::FLIP_H;
+		TS_ASSERT_EQUALS(cache.find(&source, srcRect, 40, 40, tinted, Graphics::FILTER_NEAREST).get(), surface);
+	}
+
+	void test_eviction() {
+		const uint32 surfaceSize = 10 * 10 * 4;
+		Graphics::TransformCache cache(surfaceSize * 3);
+		const int source = 0;
+		const Graphics::TransformStruct transform(150, 150, Graphics::BLEND_NORMAL, 0xFFFFFFFF);
+
+		Graphics::TransformCache::SurfacePtr first;
+		for (int16 i = 0; i < 3; i++) {
+			Graphics::TransformCache::SurfacePtr ptr = cache.insert(&source, Common::Rect(i, 0, i + 6, 6), 10, 10, transform, Graphics::FILTER_NEAREST, makeSurface(10, 10));
+			if (i == 0)
+				first = ptr;
+		}
+		TS_ASSERT_EQUALS(cache.getCount(), 3u);
+
+		// Touch the first surface, so the second one is the oldest
+		TS_ASSERT(cache.find(&source, Common::Rect(0, 0, 6, 6), 10, 10, transform, Graphics::FILTER_NEAREST));
+		cache.insert(&source, Common::Rect(3, 0, 9, 6), 10, 10, transform, Graphics::FILTER_NEAREST, makeSurface(10, 10));
+		TS_ASSERT_EQUALS(cache.getCount(), 3u);
+		TS_ASSERT_EQUALS(cache.getSize(), surfaceSize * 3);
+		TS_ASSERT(cache.find(&source, Common::Rect(0, 0, 6, 6), 10, 10, transform, Graphics::FILTER_NEAREST));
+		TS_ASSERT(!cache.find(&source, Common::Rect(1, 0, 7, 6), 10, 10, transform, Graphics::FILTER_NEAREST));
+
+		// Surfaces larger than the cache are handed back without storing them
+		Graphics::TransformCache::SurfacePtr large = cache.insert(&source, Common::Rect(0, 0, 6, 6), 20, 20, transform, Graphics::FILTER_NEAREST, makeSurface(20, 20));
+		TS_ASSERT(large);
+		TS_ASSERT_EQUALS(cache.getCount(), 3u);
+
+		// Dropped surfaces stay valid while they are referenced
+		cache.clear();
+		TS_ASSERT_EQUALS(cache.getSize(), 0u);
+		TS_ASSERT_EQUALS(first->w, 10);
+	}
+
+	void test_remove() {
+		Graphics::TransformCache cache;
+		const int a = 0, b = 0;
+		const Graphics::TransformStruct transform(150, 150, Graphics::BLEND_NORMAL, 0xFFFFFFFF);
+
+		cache.insert(&a, Common::Rect(0, 0, 4, 4), 6, 6, transform, Graphics::FILTER_NEAREST, makeSurface(6, 6));
+		cache.insert(&a, Common::Rect(4, 0, 8, 4), 6, 6, transform, Graphics::FILTER_NEAREST, makeSurface(6, 6));
+		cache.insert(&b, Common::Rect(0, 0, 4, 4), 6, 6, transform, Graphics::FILTER_NEAREST, makeSurface(6, 6));
+
+		cache.remove(&a);
+		TS_ASSERT_EQUALS(cache.getCount(), 1u);
+		TS_ASSERT_EQUALS(cache.getSize(), 6u * 6u * 4u);
+		TS_ASSERT(!cache.find(&a, Common::Rect(0, 0, 4, 4), 6, 6, transform, Graphics::FILTER_NEAREST));
+		TS_ASSERT(cache.find(&b, Common::Rect(0, 0, 4, 4), 6, 6, transform, Graphics::FILTER_NEAREST));
+	}
+};
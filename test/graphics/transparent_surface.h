@@ -0,0 +1,171 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/transparent_surface.h"
+#include "common/util.h"
+
+#include "test/random.h"
+
+class TransparentSurfaceTestSuite : public CxxTest::TestSuite
+{
+private:
+#ifdef SCUMM_LITTLE_ENDIAN
+	enum { kA = 0, kB = 1, kG = 2, kR = 3 };
+#else
+	enum { kA = 3, kB = 2, kG = 1, kR = 0 };
+#endif
+
+	static void fillRandom(Graphics::Surface &surface, uint32 seed) {
+		Test::fillRandom((byte *)surface.getPixels(), surface.pitch * surface.h, seed);
+
+		// Make sure fully transparent and fully opaque pixels show up
+		for (int y = 0; y < surface.h; y++) {
+			((byte *)surface.getBasePtr(y % surface.w, y))[kA] = 0;
+			((byte *)surface.getBasePtr((y * 7) % surface.w, y))[kA] = 255;
+		}
+	}
+
+	// Blend a single pixel the way the blitter does it
+	static void blendPixel(const byte *in, byte *out, Graphics::TSpriteBlendMode mode, Graphics::AlphaType alphaMode, uint32 color) {
+		const int a = in[kA];
+		const int ca = (color >> 24) & 0xFF, cr = (color >> 16) & 0xFF, cg = (color >> 8) & 0xFF, cb = color & 0xFF;
+		const int channels[3] = { kR, kG, kB };
+		const int mods[3] = { cr, cg, cb };
+
+		if (color == 0xFFFFFFFF && mode == Graphics::BLEND_NORMAL && alphaMode == Graphics::ALPHA_OPAQUE) {
+			memcpy(out, in, 4);
+			out[kA] = 255;
+		} else if (color == 0xFFFFFFFF && mode == Graphics::BLEND_NORMAL && alphaMode == Graphics::ALPHA_BINARY) {
+			if (a != 0) {
+				memcpy(out, in, 4);
+				out[kA] = 255;
+			}
+		} else if (color == 0xFFFFFFFF) {
+			if (a == 0)
+				return;
+
+			if (mode == Graphics::BLEND_NORMAL)
+				out[kA] = 255;
+
+			for (int i = 0; i < 3; i++) {
+				const int c = channels[i];
+				if (mode == Graphics::BLEND_NORMAL)
+					out[c] = (in[c] * a + out[c] * (255 - a)) >> 8;
+				else if (mode == Graphics::BLEND_ADDITIVE)
+					out[c] = MIN((in[c] * a >> 8) + out[c], 255);
+				else if (mode == Graphics::BLEND_SUBTRACTIVE)
+					out[c] = MAX(out[c] - (in[c] * out[c] * a >> 16), 0);
+				else
+					out[c] = MIN((in[c] * a >> 8) * out[c] >> 8, 255);
+			}
+		} else if (mode == Graphics::BLEND_NORMAL) {
+			const int ina = a * ca >> 8;
+			out[kA] = 255;
+			for (int i = 0; i < 3; i++) {
+				const int c = channels[i];
+				out[c] = (byte)((out[c] * (255 - ina) >> 8) + (in[c] * ina * mods[i] >> 16));
+			}
+		} else if (mode == Graphics::BLEND_ADDITIVE) {
+			const int ina = a * ca >> 8;
+			for (int i = 0; i < 3; i++) {
+				const int c = channels[i];
+				if (mods[i] != 255)
+					out[c] = MIN(out[c] + (in[c] * mods[i] * ina >> 16), 255);
+				else
+					out[c] = MIN(out[c] + (in[c] * ina >> 8), 255);
+			}
+		} else if (mode == Graphics::BLEND_SUBTRACTIVE) {
+			out[kA] = 255;
+			for (int i = 0; i < 3; i++) {
+				const int c = channels[i];
+				if (mods[i] != 255)
+					out[c] = MAX(out[c] - (in[c] * mods[i] * out[c] * a >> 24), 0);
+				else
+					out[c] = MAX(out[c] - (in[c] * out[c] * a >> 16), 0);
+			}
+		} else {
+			const int ina = a * ca >> 8;
+			for (int i = 0; i < 3; i++) {
+				const int c = channels[i];
+				if (mods[i] != 255)
+					out[c] = MIN(out[c] * (in[c] * mods[i] * ina >> 16) >> 8, 255);
+				else
+					out[c] = MIN(out[c] * (in[c] * ina >> 8) >> 8, 255);
+			}
+		}
+	}
+
+	void blitTest(Graphics::TSpriteBlendMode mode, Graphics::AlphaType alphaMode, uint32 color) {
+		const Graphics::PixelFormat format(4, 8, 8, 8, 8, 24, 16, 8, 0);
+		const int posX = 3, posY = 2;
+
+		Graphics::TransparentSurface sprite;
+		sprite.create(37, 9, format);
+		sprite.setAlphaMode(alphaMode);
+		fillRandom(sprite, 1);
+
+		Graphics::Surface background;
+		background.create(64, 16, format);
+		fillRandom(background, 2);
+
+		Graphics::Surface target, expected;
+		target.create(64, 16, format);
+		expected.create(64, 16, format);
+
+		const bool opaque = (color == 0xFFFFFFFF && mode == Graphics::BLEND_NORMAL && alphaMode == Graphics::ALPHA_OPAQUE);
+
+		for (int flipping = 0; flipping < 4; flipping++) {
+			// The opaque blitter copies whole rows and does not support horizontal flipping
+			if (opaque && (flipping & Graphics::FLIP_H))
+				continue;
+
+			target.copyFrom(background);
+			expected.copyFrom(background);
+
+			sprite.blit(target, posX, posY, flipping, nullptr, color, -1, -1, mode);
+
+			for (int y = 0; y < sprite.h; y++) {
+				for (int x = 0; x < sprite.w; x++) {
+					const int srcX = (flipping & Graphics::FLIP_H) ? sprite.w - 1 - x : x;
+					const int srcY = (flipping & Graphics::FLIP_V) ? sprite.h - 1 - y : y;
+					blendPixel((const byte *)sprite.getBasePtr(srcX, srcY), (byte *)expected.getBasePtr(posX + x, posY + y), mode, alphaMode, color);
+				}
+			}
+
+			TS_ASSERT_EQUALS(memcmp(target.getPixels(), expected.getPixels(), target.pitch * target.h), 0);
+		}
+
+		sprite.free();
+		background.free();
+		target.free();
+		expected.free();
+	}
+
+public:
+	void test_blit_opaque() {
+		blitTest(Graphics::BLEND_NORMAL, Graphics::ALPHA_OPAQUE, 0xFFFFFFFF);
+	}
+
+	void test_blit_binary() {
+		blitTest(Graphics::BLEND_NORMAL, Graphics::ALPHA_BINARY, 0xFFFFFFFF);
+	}
+
+	void test_blit_alpha() {
+		blitTest(Graphics::BLEND_NORMAL, Graphics::ALPHA_FULL, 0xFFFFFFFF);
+		blitTest(Graphics::BLEND_NORMAL, Graphics::ALPHA_FULL, 0x80FF40C0);
+	}
+
+	void test_blit_additive() {
+		blitTest(Graphics::BLEND_ADDITIVE, Graphics::ALPHA_FULL, 0xFFFFFFFF);
+		blitTest(Graphics::BLEND_ADDITIVE, Graphics::ALPHA_FULL, 0x80FF40C0);
+	}
+
+	void test_blit_subtractive() {
+		blitTest(Graphics::BLEND_SUBTRACTIVE, Graphics::ALPHA_FULL, 0xFFFFFFFF);
+		blitTest(Graphics::BLEND_SUBTRACTIVE, Graphics::ALPHA_FULL, 0x80FF40C0);
+	}
+
+	void test_blit_multiply() {
+		blitTest(Graphics::BLEND_MULTIPLY, Graphics::ALPHA_FULL, 0xFFFFFFFF);
+		blitTest(Graphics::BLEND_MULTIPLY, Graphics::ALPHA_FULL, 0x80FF40C0);
+	}
+};
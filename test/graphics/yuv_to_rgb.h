@@ -0,0 +1,119 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/util.h"
+#include "graphics/yuv_to_rgb.h"
+
+#include "test/random.h"
+
+class YUVToRGBTestSuite : public CxxTest::TestSuite
+{
+private:
+	// Convert a single pixel following the color tables of YUVToRGBManager
+	static uint32 convertPixel(const Graphics::PixelFormat &format, Graphics::YUVToRGBManager::LuminanceScale scale, byte y, byte u, byte v) {
+		const int16 cr = v - 128, cb = u - 128;
+		int c[3];
+		c[0] = y + (int16)((0.419 / 0.299) * cr);
+		c[1] = y + (int16)(-(0.299 / 0.419) * cr) + (int16)(-(0.114 / 0.331) * cb);
+		c[2] = y + (int16)((0.587 / 0.331) * cb);
+
+		for (int i = 0; i < 3; i++) {
+			if (scale == Graphics::YUVToRGBManager::kScaleITU)
+				c[i] = (CLIP(c[i], 16, 235) - 16) * 255 / 219;
+			else
+				c[i] = CLIP(c[i], 0, 255);
+		}
+
+		return format.RGBToColor(c[0], c[1], c[2]);
+	}
+
+	static uint32 readPixel(const Graphics::Surface &surface, int x, int y) {
+		if (surface.format.bytesPerPixel == 2)
+			return *(const uint16 *)surface.getBasePtr(x, y);
+		return *(const uint32 *)surface.getBasePtr(x, y);
+	}
+
+	// Compare a conversion with the per pixel reference, chromaShift
+	// being log2 of the chroma subsampling in both directions
+	void convertTest(int chromaShift, const Graphics::PixelFormat &format, Graphics::YUVToRGBManager::LuminanceScale scale, int width, int height) {
+		const int yPitch = width + 3;
+		const int uvPitch = (width >> chromaShift) + 2;
+		const int uvHeight = (height >> chromaShift) + 1;
+
+		byte *yPlane = new byte[yPitch * height];
+		byte *uPlane = new byte[uvPitch * uvHeight];
+		byte *vPlane = new byte[uvPitch * uvHeight];
+		Test::fillRandom(yPlane, yPitch * height, 1);
+		Test::fillRandom(uPlane, uvPitch * uvHeight, 2);
+		Test::fillRandom(vPlane, uvPitch * uvHeight, 3);
+
+		Graphics::Surface surface;
+		surface.create(width, height, format);
+
+		if (chromaShift == 0)
+			YUVToRGBMan.convert444(&surface, scale, yPlane, uPlane, vPlane, width, height, yPitch, uvPitch);
+		else if (chromaShift == 1)
+			YUVToRGBMan.convert420(&surface, scale, yPlane, uPlane, vPlane, width, height, yPitch, uvPitch);
+		else
+			YUVToRGBMan.convert410(&surface, scale, yPlane, uPlane, vPlane, width, height, yPitch, uvPitch);
+
+		bool equal = true;
+		for (int y = 0; y < height; y++) {
+			for (int x = 0; x < width; x++) {
+				int u, v;
+				const int cx = x >> chromaShift, cy = y >> chromaShift;
+				const byte *uSrc = uPlane + cy * uvPitch + cx;
+				const byte *vSrc = vPlane + cy * uvPitch + cx;
+
+				if (chromaShift == 2) {
+					// Bilinear interpolation of the chroma planes
+					const int xDiff = x & 3, yDiff = y & 3;
+					u = (uSrc[0] * (4 - xDiff) * (4 - yDiff) + uSrc[1] * xDiff * (4 - yDiff) +
+					     uSrc[uvPitch] * yDiff * (4 - xDiff) + uSrc[uvPitch + 1] * xDiff * yDiff) >> 4;
+					v = (vSrc[0] * (4 - xDiff) * (4 - yDiff) + vSrc[1] * xDiff * (4 - yDiff) +
+					     vSrc[uvPitch] * yDiff * (4 - xDiff) + vSrc[uvPitch + 1] * xDiff * yDiff) >> 4;
+				} else {
+					u = *uSrc;
+					v = *vSrc;
+				}
+
+				const uint32 expected = convertPixel(format, scale, yPlane[y * yPitch + x], u, v);
+				equal = equal && readPixel(surface, x, y) == expected;
+			}
+		}
+		TS_ASSERT(equal);
+
+		surface.free();
+		delete[] yPlane;
+		delete[] uPlane;
+		delete[] vPlane;
+	}
+
+	void convertTestAllFormats(int chromaShift) {
+		const Graphics::PixelFormat formats[3] = {
+			Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0),
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0),
+			Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0)
+		};
+
+		for (int i = 0; i < 3; i++) {
+			convertTest(chromaShift, formats[i], Graphics::YUVToRGBManager::kScaleFull, 44, 12);
+			convertTest(chromaShift, formats[i], Graphics::YUVToRGBManager::kScaleITU, 44, 12);
+		}
+
+		// Large enough to be split into bands
+		convertTest(chromaShift, formats[1], Graphics::YUVToRGBManager::kScaleITU, 320, 240);
+	}
+
+public:
+	void test_convert444() {
+		convertTestAllFormats(0);
+	}
+
+	void test_convert420() {
+		convertTestAllFormats(1);
+	}
+
+	void test_convert410() {
+		convertTestAllFormats(2);
+	}
+};
@@ -0,0 +1,29 @@
+#ifndef TEST_RANDOM_H
+#define TEST_RANDOM_H
+
+#include "common/scummsys.h"
+
+namespace Test {
+
+/**
+ * Advance a linear congruential generator. Tests use it rather than
+ * Common::RandomSource, so that their data does not depend on the
+ * implementation of the latter. The upper bits of the state are the most
+ * random ones.
+ *
+ * @return the new state
+ */
+inline uint32 nextRandom(uint32 &seed) {
+	seed = seed * 1103515245 + 12345;
+	return seed;
+}
+
+/** Fill a buffer with pseudo-random bytes determined by seed. */
+inline void fillRandom(byte *data, uint32 size, uint32 seed) {
+	for (uint32 i = 0; i < size; i++)
+		data[i] = (nextRandom(seed) >> 16) & 0xFF;
+}
+
+} // End of namespace Test
+
+#endif
@@ -646,58 +646,38 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 		frame = videoTrack->getFrameAtTime(time);
 	}
 
-	// Reset any palette, if necessary
-	videoTrack->useInitialPalette();
-
-	int lastKeyFrame = -1;
-	int frameIndex = -1;
-	uint curFrame = 0;
-
-	// Go through and figure out where we should be
-	// If there's a palette, we need to find the palette too
-	for (uint32 i = 0; i < _indexEntries.size(); i++) {
-		const OldIndex &index = _indexEntries[i];
-
-		// We don't care about RECs
-		if (index.id == ID_REC)
-			continue;
+	const IndexEntries::StreamEntries *videoEntries = _indexEntries.getStreamEntries(videoIndex);
+	if (!videoEntries || frame >= videoEntries->frames.size()) // This shouldn't happen.
+		return false;
 
-		// We're only looking at entries for this track
-		if (getStreamIndex(index.id) != videoIndex)
-			continue;
+	uint32 frameIndex = videoEntries->frames[frame];
 
-		uint16 streamType = getStreamType(index.id);
+	// Decode from the last key frame, unless we are moving forward within
+	// the frames following it and can continue from the current frame
+	uint firstFrame = videoEntries->findKeyFrame(frame);
+	int decodedFrame = videoTrack->getCurFrame();
+	if (!videoTrack->isReversed() && decodedFrame < (int)frame && decodedFrame >= (int)firstFrame)
+		firstFrame = decodedFrame + 1;
 
-		if (streamType == kStreamTypePaletteChange) {
-			// We need to handle any palette change we see since there's no
-			// flag to tell if this is a "key" palette.
-			// Decode the palette
-			_fileStream->seek(_indexEntries[i].offset + 8);
-			Common::SeekableReadStream *chunk = 0;
+	// Reset any palette, if necessary
+	videoTrack->useInitialPalette();
 
-			if (_indexEntries[i].size != 0)
-				chunk = _fileStream->readStream(_indexEntries[i].size);
+	// We need to handle any palette change up to the frame since there's no
+	// flag to tell if this is a "key" palette.
+	for (uint32 i = 0; i < videoEntries->paletteChanges.size(); i++) {
+		if (videoEntries->paletteChanges[i] > frameIndex)
+			break;
 
-			videoTrack->loadPaletteFromChunk(chunk);
-		} else {
-			// Check to see if this is a keyframe
-			// The first frame has to be a keyframe
-			if ((_indexEntries[i].flags & AVIIF_INDEX) || curFrame == 0)
-				lastKeyFrame = i;
+		const OldIndex &index = _indexEntries[videoEntries->paletteChanges[i]];
+		_fileStream->seek(index.offset + 8);
+		Common::SeekableReadStream *chunk = 0;
 
-			// Did we find the target frame?
-			if (frame == curFrame) {
-				frameIndex = i;
-				break;
-			}
+		if (index.size != 0)
+			chunk = _fileStream->readStream(index.size);
 
-			curFrame++;
-		}
+		videoTrack->loadPaletteFromChunk(chunk);
 	}
 
-	if (frameIndex < 0) // This shouldn't happen.
-		return false;
-
 	// Update all the audio tracks
 	for (uint32 i = 0; i < _audioTracks.size(); i++) {
 		AVIAudioTrack *audioTrack = (AVIAudioTrack *)_audioTracks[i].track;
@@ -708,51 +688,31 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 		// Set the chunk index for the track
 		audioTrack->setCurChunk(frame);
 
-		uint32 chunksFound = 0;
-		for (uint32 j = 0; j < _indexEntries.size(); j++) {
+		const IndexEntries::StreamEntries *audioEntries = _indexEntries.getStreamEntries(_audioTracks[i].index);
+		if (audioEntries && frame < audioEntries->chunks.size()) {
+			uint32 j = audioEntries->chunks[frame];
 			const OldIndex &index = _indexEntries[j];
 
-			// Continue ignoring RECs
-			if (index.id == ID_REC)
-				continue;
-
-			if (getStreamIndex(index.id) == _audioTracks[i].index) {
-				if (chunksFound == frame) {
-					_fileStream->seek(index.offset + 8);
-					Common::SeekableReadStream *audioChunk = _fileStream->readStream(index.size);
-					audioTrack->queueSound(audioChunk);
-					_audioTracks[i].chunkSearchOffset = (j == _indexEntries.size() - 1) ? _movieListEnd : _indexEntries[j + 1].offset;
-					break;
-				}
-
-				chunksFound++;
-			}
+			_fileStream->seek(index.offset + 8);
+			Common::SeekableReadStream *audioChunk = _fileStream->readStream(index.size);
+			audioTrack->queueSound(audioChunk);
+			_audioTracks[i].chunkSearchOffset = (j == _indexEntries.size() - 1) ? _movieListEnd : _indexEntries[j + 1].offset;
 		}
 
 		// Skip any audio to bring us to the right time
 		audioTrack->skipAudio(time, videoTrack->getFrameTime(frame));
 	}
 
-	// Decode from keyFrame to curFrame - 1
-	for (int i = lastKeyFrame; i < frameIndex; i++) {
-		if (_indexEntries[i].id == ID_REC)
-			continue;
-
-		if (getStreamIndex(_indexEntries[i].id) != videoIndex)
-			continue;
-
-		uint16 streamType = getStreamType(_indexEntries[i].id);
-
-		// Ignore palettes, they were already handled
-		if (streamType == kStreamTypePaletteChange)
-			continue;
+	// Decode up to the frame before the one we seek to
+	for (uint32 i = firstFrame; i < frame; i++) {
+		const OldIndex &index = _indexEntries[videoEntries->frames[i]];
 
 		// Frame, hopefully
-		_fileStream->seek(_indexEntries[i].offset + 8);
+		_fileStream->seek(index.offset + 8);
 		Common::SeekableReadStream *chunk = 0;
 
-		if (_indexEntries[i].size != 0)
-			chunk = _fileStream->readStream(_indexEntries[i].size);
+		if (index.size != 0)
+			chunk = _fileStream->readStream(index.size);
 
 		videoTrack->decodeFrame(chunk);
 	}
@@ -855,6 +815,8 @@ void AVIDecoder::readOldIndex(uint32 size) {
 		_indexEntries.push_back(indexEntry);
 		debug(7, "Index %d: Tag '%s', Offset = %d, Size = %d (Flags = %d)", i, tag2str(indexEntry.id), indexEntry.offset, indexEntry.size, indexEntry.flags);
 	}
+
+	_indexEntries.buildStreamEntries();
 }
 
 void AVIDecoder::checkTruemotion1() {
@@ -1136,16 +1098,67 @@ void AVIDecoder::AVIAudioTrack::createAudioStream() {
 AVIDecoder::TrackStatus::TrackStatus() : track(0), chunkSearchOffset(0) {
 }
 
-AVIDecoder::OldIndex *AVIDecoder::IndexEntries::find(uint index, uint frameNumber) {
-	for (uint idx = 0, frameCtr = 0; idx < size(); ++idx) {
-		if ((*this)[idx].id != ID_REC &&
-				AVIDecoder::getStreamIndex((*this)[idx].id) == index) {
-			if (frameCtr++ == frameNumber)
-				return &(*this)[idx];
+void AVIDecoder::IndexEntries::buildStreamEntries() {
+	_streams.clear();
+
+	for (uint32 idx = 0; idx < size(); ++idx) {
+		const OldIndex &entry = (*this)[idx];
+
+		// We don't care about RECs
+		if (entry.id == ID_REC)
+			continue;
+
+		uint index = AVIDecoder::getStreamIndex(entry.id);
+		if (index >= _streams.size())
+			_streams.resize(index + 1);
+
+		StreamEntries &stream = _streams[index];
+		stream.chunks.push_back(idx);
+
+		if (AVIDecoder::getStreamType(entry.id) == kStreamTypePaletteChange) {
+			stream.paletteChanges.push_back(idx);
+		} else {
+			// The first frame has to be a keyframe
+			if ((entry.flags & AVIIF_INDEX) || stream.frames.empty())
+				stream.keyFrames.push_back(stream.frames.size());
+
+			stream.frames.push_back(idx);
 		}
 	}
+}
+
+void AVIDecoder::IndexEntries::clear() {
+	Common::Array<OldIndex>::clear();
+	_streams.clear();
+}
+
+AVIDecoder::OldIndex *AVIDecoder::IndexEntries::find(uint index, uint frameNumber) {
+	const StreamEntries *stream = getStreamEntries(index);
+	if (!stream || frameNumber >= stream->chunks.size())
+		return nullptr;
+
+	return &(*this)[stream->chunks[frameNumber]];
+}
+
+const AVIDecoder::IndexEntries::StreamEntries *AVIDecoder::IndexEntries::getStreamEntries(uint index) const {
+	if (index >= _streams.size() || _streams[index].chunks.empty())
+		return nullptr;
+
+	return &_streams[index];
+}
+
+uint AVIDecoder::IndexEntries::StreamEntries::findKeyFrame(uint frame) const {
+	// Binary search for the last key frame not after the frame
+	uint low = 0, high = keyFrames.size();
+	while (low < high) {
+		uint mid = (low + high) / 2;
+		if (keyFrames[mid] <= frame)
+			low = mid + 1;
+		else
+			high = mid;
+	}
 
-	return nullptr;
+	return (low == 0) ? 0 : keyFrames[low - 1];
 }
 
 } // End of namespace Video
@@ -322,7 +322,34 @@ protected:
 
 	class IndexEntries : public Common::Array<OldIndex> {
 	public:
+		/**
+		 * The entries of a single stream, as positions in the index.
+		 */
+		struct StreamEntries {
+			Common::Array<uint32> chunks;         ///< All entries of the stream
+			Common::Array<uint32> frames;         ///< Entries that are not palette changes
+			Common::Array<uint32> keyFrames;      ///< Numbers of the key frames in frames
+			Common::Array<uint32> paletteChanges; ///< Entries that are palette changes
+
+			/**
+			 * Get the number of the last key frame at or before the given frame.
+			 */
+			uint findKeyFrame(uint frame) const;
+		};
+
+		/**
+		 * Sort the entries into per-stream lookup tables. Has to be called
+		 * once all entries were added.
+		 */
+		void buildStreamEntries();
+
+		void clear();
+
 		OldIndex *find(uint index, uint frameNumber);
+		const StreamEntries *getStreamEntries(uint index) const;
+
+	private:
+		Common::Array<StreamEntries> _streams;
 	};
 
 	AVIHeader _header;
@@ -347,7 +374,7 @@ protected:
 	void handleList(uint32 listSize);
 	void handleStreamHeader(uint32 size);
 	void readStreamName(uint32 size);
-	uint16 getStreamType(uint32 tag) const { return tag & 0xFFFF; }
+	static uint16 getStreamType(uint32 tag) { return tag & 0xFFFF; }
 	static byte getStreamIndex(uint32 tag);
 	void checkTruemotion1();
 	uint getVideoTrackOffset(uint trackIndex, uint frameNumber = 0);
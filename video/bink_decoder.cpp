@@ -46,6 +46,16 @@
 #include "video/binkdata.h"
 #include "video/bink_decoder.h"
 
+// Where SSE2 or NEON are available, the IDCT transforms all eight rows or
+// columns of a block at once. The results are identical to the scalar code.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BINK_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define BINK_USE_NEON
+#include <arm_neon.h>
+#endif
+
 static const uint32 kBIKfID = MKTAG('B', 'I', 'K', 'f');
 static const uint32 kBIKgID = MKTAG('B', 'I', 'K', 'g');
 static const uint32 kBIKhID = MKTAG('B', 'I', 'K', 'h');
@@ -816,11 +826,7 @@ void BinkDecoder::BinkVideoTrack::blockResidue(DecodeContext &ctx) {
 
 	readResidue(*ctx.video, block, v);
 
-	byte  *dst = ctx.dest;
-	int16 *src = block;
-	for (int i = 0; i < 8; i++, dst += ctx.pitch, src += 8)
-		for (int j = 0; j < 8; j++)
-			dst[j] += src[j];
+	addBlock(ctx, block);
 }
 
 void BinkDecoder::BinkVideoTrack::blockIntra(DecodeContext &ctx) {
@@ -1323,6 +1329,248 @@ static inline void IDCTCol(int16 *dest, const int16 *src) {
 	}
 }
 
+#if defined(BINK_USE_SSE2) || defined(BINK_USE_NEON)
+
+// The vector IDCT works on four 32 bit lanes, so that each pass is done in
+// two halves of four columns or rows. Between the passes, and after them,
+// the block is transposed. Like in the scalar code, the intermediate and
+// the final values are truncated to 16 bits.
+
+#if defined(BINK_USE_SSE2)
+
+typedef __m128i IDCTVector;
+typedef __m128i IDCTRow;
+
+static inline __m128i idctAdd(__m128i a, __m128i b) { return _mm_add_epi32(a, b); }
+static inline __m128i idctSub(__m128i a, __m128i b) { return _mm_sub_epi32(a, b); }
+
+static inline __m128i idctMulShift(__m128i a, int c) {
+	// SSE2 lacks a 32 bit multiplication, but the low halves of the
+	// unsigned 64 bit products are just as good
+	const __m128i cv = _mm_set1_epi32(c);
+	const __m128i even = _mm_mul_epu32(a, cv);
+	const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), cv);
+	const __m128i product = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+	                                           _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+	return _mm_srai_epi32(product, 11);
+}
+
+static inline __m128i idctRound(__m128i a) {
+	return _mm_srai_epi32(_mm_add_epi32(a, _mm_set1_epi32(0x7F)), 8);
+}
+
+static inline void idctWiden(__m128i row, __m128i &lo, __m128i &hi) {
+	lo = _mm_srai_epi32(_mm_unpacklo_epi16(row, row), 16);
+	hi = _mm_srai_epi32(_mm_unpackhi_epi16(row, row), 16);
+}
+
+static inline __m128i idctNarrow(__m128i lo, __m128i hi) {
+	// Truncate, so that packing doesn't saturate
+	lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+	hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+	return _mm_packs_epi32(lo, hi);
+}
+
+static inline __m128i idctLoad(const int16 *src) {
+	return _mm_loadu_si128((const __m128i *)src);
+}
+
+static inline void idctStore(int16 *dest, __m128i row) {
+	_mm_storeu_si128((__m128i *)dest, row);
+}
+
+static inline void idctTranspose(__m128i *r) {
+	const __m128i a0 = _mm_unpacklo_epi16(r[0], r[1]);
+	const __m128i a1 = _mm_unpackhi_epi16(r[0], r[1]);
+	const __m128i a2 = _mm_unpacklo_epi16(r[2], r[3]);
+	const __m128i a3 = _mm_unpackhi_epi16(r[2], r[3]);
+	const __m128i a4 = _mm_unpacklo_epi16(r[4], r[5]);
+	const __m128i a5 = _mm_unpackhi_epi16(r[4], r[5]);
+	const __m128i a6 = _mm_unpacklo_epi16(r[6], r[7]);
+	const __m128i a7 = _mm_unpackhi_epi16(r[6], r[7]);
+
+	const __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+	const __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+	const __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+	const __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+	const __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+	const __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+	const __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+	const __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+
+	r[0] = _mm_unpacklo_epi64(b0, b4);
+	r[1] = _mm_unpackhi_epi64(b0, b4);
+	r[2] = _mm_unpacklo_epi64(b1, b5);
+	r[3] = _mm_unpackhi_epi64(b1, b5);
+	r[4] = _mm_unpacklo_epi64(b2, b6);
+	r[5] = _mm_unpackhi_epi64(b2, b6);
+	r[6] = _mm_unpacklo_epi64(b3, b7);
+	r[7] = _mm_unpackhi_epi64(b3, b7);
+}
+
+static inline void idctPutRow(byte *dest, __m128i row) {
+	row = _mm_and_si128(row, _mm_set1_epi16(0xFF));
+	_mm_storel_epi64((__m128i *)dest, _mm_packus_epi16(row, row));
+}
+
+static inline void idctAddRow(byte *dest, __m128i row) {
+	const __m128i pixels = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)dest), _mm_setzero_si128());
+	idctPutRow(dest, _mm_add_epi16(pixels, row));
+}
+
+#else
+
+typedef int32x4_t IDCTVector;
+typedef int16x8_t IDCTRow;
+
+static inline int32x4_t idctAdd(int32x4_t a, int32x4_t b) { return vaddq_s32(a, b); }
+static inline int32x4_t idctSub(int32x4_t a, int32x4_t b) { return vsubq_s32(a, b); }
+
+static inline int32x4_t idctMulShift(int32x4_t a, int c) {
+	return vshrq_n_s32(vmulq_n_s32(a, c), 11);
+}
+
+static inline int32x4_t idctRound(int32x4_t a) {
+	return vshrq_n_s32(vaddq_s32(a, vdupq_n_s32(0x7F)), 8);
+}
+
+static inline void idctWiden(int16x8_t row, int32x4_t &lo, int32x4_t &hi) {
+	lo = vmovl_s16(vget_low_s16(row));
+	hi = vmovl_s16(vget_high_s16(row));
+}
+
+static inline int16x8_t idctNarrow(int32x4_t lo, int32x4_t hi) {
+	return vcombine_s16(vmovn_s32(lo), vmovn_s32(hi));
+}
+
+static inline int16x8_t idctLoad(const int16 *src) {
+	return vld1q_s16(src);
+}
+
+static inline void idctStore(int16 *dest, int16x8_t row) {
+	vst1q_s16(dest, row);
+}
+
+static inline void idctTranspose(int16x8_t *r) {
+	const int16x8x2_t t01 = vtrnq_s16(r[0], r[1]);
+	const int16x8x2_t t23 = vtrnq_s16(r[2], r[3]);
+	const int16x8x2_t t45 = vtrnq_s16(r[4], r[5]);
+	const int16x8x2_t t67 = vtrnq_s16(r[6], r[7]);
+
+	const int32x4x2_t u02 = vtrnq_s32(vreinterpretq_s32_s16(t01.val[0]), vreinterpretq_s32_s16(t23.val[0]));
+	const int32x4x2_t u13 = vtrnq_s32(vreinterpretq_s32_s16(t01.val[1]), vreinterpretq_s32_s16(t23.val[1]));
+	const int32x4x2_t u46 = vtrnq_s32(vreinterpretq_s32_s16(t45.val[0]), vreinterpretq_s32_s16(t67.val[0]));
+	const int32x4x2_t u57 = vtrnq_s32(vreinterpretq_s32_s16(t45.val[1]), vreinterpretq_s32_s16(t67.val[1]));
+
+	r[0] = vreinterpretq_s16_s32(vcombine_s32(vget_low_s32(u02.val[0]), vget_low_s32(u46.val[0])));
+	r[1] = vreinterpretq_s16_s32(vcombine_s32(vget_low_s32(u13.val[0]), vget_low_s32(u57.val[0])));
+	r[2] = vreinterpretq_s16_s32(vcombine_s32(vget_low_s32(u02.val[1]), vget_low_s32(u46.val[1])));
+	r[3] = vreinterpretq_s16_s32(vcombine_s32(vget_low_s32(u13.val[1]), vget_low_s32(u57.val[1])));
+	r[4] = vreinterpretq_s16_s32(vcombine_s32(vget_high_s32(u02.val[0]), vget_high_s32(u46.val[0])));
+	r[5] = vreinterpretq_s16_s32(vcombine_s32(vget_high_s32(u13.val[0]), vget_high_s32(u57.val[0])));
+	r[6] = vreinterpretq_s16_s32(vcombine_s32(vget_high_s32(u02.val[1]), vget_high_s32(u46.val[1])));
+	r[7] = vreinterpretq_s16_s32(vcombine_s32(vget_high_s32(u13.val[1]), vget_high_s32(u57.val[1])));
+}
+
+static inline void idctPutRow(byte *dest, int16x8_t row) {
+	vst1_u8(dest, vmovn_u16(vreinterpretq_u16_s16(row)));
+}
+
+static inline void idctAddRow(byte *dest, int16x8_t row) {
+	const int16x8_t pixels = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(dest)));
+	idctPutRow(dest, vaddq_s16(pixels, row));
+}
+
+#endif
+
+// The same transform as IDCT_TRANSFORM, on four columns or rows at once
+static inline void idctTransformVector(IDCTVector *v, bool round) {
+	const IDCTVector a0 = idctAdd(v[0], v[4]);
+	const IDCTVector a1 = idctSub(v[0], v[4]);
+	const IDCTVector a2 = idctAdd(v[2], v[6]);
+	const IDCTVector a3 = idctMulShift(idctSub(v[2], v[6]), A1);
+	const IDCTVector a4 = idctAdd(v[5], v[3]);
+	const IDCTVector a5 = idctSub(v[5], v[3]);
+	const IDCTVector a6 = idctAdd(v[1], v[7]);
+	const IDCTVector a7 = idctSub(v[1], v[7]);
+	const IDCTVector b0 = idctAdd(a4, a6);
+	const IDCTVector b1 = idctMulShift(idctAdd(a5, a7), A3);
+	const IDCTVector b2 = idctAdd(idctSub(idctMulShift(a5, A4), b0), b1);
+	const IDCTVector b3 = idctSub(idctMulShift(idctSub(a6, a4), A1), b2);
+	const IDCTVector b4 = idctSub(idctAdd(idctMulShift(a7, A2), b3), b1);
+
+	v[0] = idctAdd(idctAdd(a0, a2), b0);
+	v[1] = idctAdd(idctSub(idctAdd(a1, a3), a2), b2);
+	v[2] = idctAdd(idctAdd(idctSub(a1, a3), a2), b3);
+	v[3] = idctSub(idctSub(a0, a2), b4);
+	v[4] = idctAdd(idctSub(a0, a2), b4);
+	v[5] = idctSub(idctAdd(idctSub(a1, a3), a2), b3);
+	v[6] = idctSub(idctSub(idctAdd(a1, a3), a2), b2);
+	v[7] = idctSub(idctAdd(a0, a2), b0);
+
+	if (round)
+		for (int i = 0; i < 8; i++)
+			v[i] = idctRound(v[i]);
+}
+
+static inline void idctTransformRows(IDCTRow *rows, bool round) {
+	IDCTVector lo[8], hi[8];
+
+	for (int i = 0; i < 8; i++)
+		idctWiden(rows[i], lo[i], hi[i]);
+
+	idctTransformVector(lo, round);
+	idctTransformVector(hi, round);
+
+	for (int i = 0; i < 8; i++)
+		rows[i] = idctNarrow(lo[i], hi[i]);
+}
+
+static void idctVector(const int16 *block, IDCTRow *rows) {
+	for (int i = 0; i < 8; i++)
+		rows[i] = idctLoad(block + 8 * i);
+
+	// Columns first, then rows
+	idctTransformRows(rows, false);
+	idctTranspose(rows);
+	idctTransformRows(rows, true);
+	idctTranspose(rows);
+}
+
+void BinkDecoder::BinkVideoTrack::IDCT(int16 *block) {
+	IDCTRow rows[8];
+	idctVector(block, rows);
+
+	for (int i = 0; i < 8; i++)
+		idctStore(block + 8 * i, rows[i]);
+}
+
+void BinkDecoder::BinkVideoTrack::IDCTAdd(DecodeContext &ctx, int16 *block) {
+	IDCTRow rows[8];
+	idctVector(block, rows);
+
+	byte *dest = ctx.dest;
+	for (int i = 0; i < 8; i++, dest += ctx.pitch)
+		idctAddRow(dest, rows[i]);
+}
+
+void BinkDecoder::BinkVideoTrack::IDCTPut(DecodeContext &ctx, int16 *block) {
+	IDCTRow rows[8];
+	idctVector(block, rows);
+
+	byte *dest = ctx.dest;
+	for (int i = 0; i < 8; i++, dest += ctx.pitch)
+		idctPutRow(dest, rows[i]);
+}
+
+void BinkDecoder::BinkVideoTrack::addBlock(DecodeContext &ctx, const int16 *block) {
+	byte *dest = ctx.dest;
+	for (int i = 0; i < 8; i++, dest += ctx.pitch, block += 8)
+		idctAddRow(dest, idctLoad(block));
+}
+
+#else
+
 void BinkDecoder::BinkVideoTrack::IDCT(int16 *block) {
 	int i;
 	int16 temp[64];
@@ -1354,6 +1602,15 @@ void BinkDecoder::BinkVideoTrack::IDCTPut(DecodeContext &ctx, int16 *block) {
 	}
 }
 
+void BinkDecoder::BinkVideoTrack::addBlock(DecodeContext &ctx, const int16 *block) {
+	byte *dest = ctx.dest;
+	for (int i = 0; i < 8; i++, dest += ctx.pitch, block += 8)
+		for (int j = 0; j < 8; j++)
+			dest[j] += block[j];
+}
+
+#endif
+
 BinkDecoder::BinkAudioTrack::BinkAudioTrack(BinkDecoder::AudioInfo &audio, Audio::Mixer::SoundType soundType) :
 		AudioTrack(soundType),
 		_audioInfo(&audio) {
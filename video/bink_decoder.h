@@ -321,6 +321,7 @@ private:
 		void IDCT(int16 *block);
 		void IDCTPut(DecodeContext &ctx, int16 *block);
 		void IDCTAdd(DecodeContext &ctx, int16 *block);
+		void addBlock(DecodeContext &ctx, const int16 *block);
 	};
 
 	class BinkAudioTrack : public AudioTrack {
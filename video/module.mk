@@ -9,7 +9,8 @@ MODULE_OBJS := \
 	psx_decoder.o \
 	qt_decoder.o \
 	smk_decoder.o \
-	video_decoder.o
+	video_decoder.o \
+	video_player.o
 
 ifdef USE_BINK
 MODULE_OBJS += \
@@ -29,6 +29,7 @@
 #include "common/textconsole.h"
 
 #include "video/mpegps_decoder.h"
+#include "image/codecs/codec.h"
 #include "image/codecs/mpeg.h"
 
 // The demuxing code is based on libav's demuxing code
@@ -432,15 +433,17 @@ MPEGPSDecoder::MPEGVideoTrack::MPEGVideoTrack(Common::SeekableReadStream *firstP
 
 	findDimensions(firstPacket, format);
 
+	// Prefer the decoding hardware, if the backend offers it
+	_codec = g_system->createHardwareVideoCodec(MKTAG('M','P','G','2'), _surface->w, _surface->h, format);
+
 #ifdef USE_MPEG2
-	_mpegDecoder = new Image::MPEGDecoder();
+	if (!_codec)
+		_codec = new Image::MPEGDecoder();
 #endif
 }
 
 MPEGPSDecoder::MPEGVideoTrack::~MPEGVideoTrack() {
-#ifdef USE_MPEG2
-	delete _mpegDecoder;
-#endif
+	delete _codec;
 
 	if (_surface) {
 		_surface->free();
@@ -468,23 +471,21 @@ const Graphics::Surface *MPEGPSDecoder::MPEGVideoTrack::decodeNextFrame() {
 }
 
 bool MPEGPSDecoder::MPEGVideoTrack::sendPacket(Common::SeekableReadStream *packet, uint32 pts, uint32 dts) {
-#ifdef USE_MPEG2
+	if (!_codec) {
+		delete packet;
+		return true;
+	}
+
 	uint32 framePeriod;
-	bool foundFrame = _mpegDecoder->decodePacket(*packet, framePeriod, _surface);
+	bool foundFrame = _codec->decodePacket(*packet, framePeriod, _surface);
 
 	if (foundFrame) {
 		_curFrame++;
 		_nextFrameStartTime = _nextFrameStartTime.addFrames(framePeriod);
 	}
-#endif
 
 	delete packet;
-
-#ifdef USE_MPEG2
 	return foundFrame;
-#else
-	return true;
-#endif
 }
 
 void MPEGPSDecoder::MPEGVideoTrack::findDimensions(Common::SeekableReadStream *firstPacket, const Graphics::PixelFormat &format) {
@@ -40,7 +40,7 @@ struct PixelFormat;
 }
 
 namespace Image {
-class MPEGDecoder;
+class PacketCodec;
 }
 
 namespace Video {
@@ -104,9 +104,7 @@ private:
 
 		void findDimensions(Common::SeekableReadStream *firstPacket, const Graphics::PixelFormat &format);
 
-#ifdef USE_MPEG2
-		Image::MPEGDecoder *_mpegDecoder;
-#endif
+		Image::PacketCodec *_codec;
 	};
 
 #ifdef USE_MAD
@@ -633,9 +633,19 @@ uint32 QuickTimeDecoder::VideoTrackHandler::getFrameDuration() {
 }
 
 uint32 QuickTimeDecoder::VideoTrackHandler::findKeyFrame(uint32 frame) const {
-	for (int i = _parent->keyframeCount - 1; i >= 0; i--)
-		if (_parent->keyframes[i] <= frame)
-			return _parent->keyframes[i];
+	// The key frames are sorted, so binary search for the last one not
+	// after the frame
+	uint32 low = 0, high = _parent->keyframeCount;
+	while (low < high) {
+		uint32 mid = (low + high) / 2;
+		if (_parent->keyframes[mid] <= frame)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	if (low > 0)
+		return _parent->keyframes[low - 1];
 
 	// If none found, we'll assume the requested frame is a key frame
 	return frame;
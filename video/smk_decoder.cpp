@@ -37,6 +37,8 @@
 #include "audio/mixer.h"
 #include "audio/decoders/raw.h"
 
+#include "image/codecs/blocks.h"
+
 namespace Video {
 
 enum SmkBlockTypes {
@@ -593,10 +595,7 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB
 				lo = clr & 0xff;
 				for (i = 0; i < 4; i++) {
 					for (j = 0; j < doubleY; j++) {
-						out[0] = (map & 1) ? hi : lo;
-						out[1] = (map & 2) ? hi : lo;
-						out[2] = (map & 4) ? hi : lo;
-						out[3] = (map & 8) ? hi : lo;
+						Image::drawTwoColorRow<byte>(out, map, lo, hi);
 						out += stride;
 					}
 					map >>= 4;
@@ -628,28 +627,21 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB
 							p1 = _FullTree->getCode(bs);
 							p2 = _FullTree->getCode(bs);
 							for (j = 0; j < doubleY; ++j) {
-								out[2] = p1 & 0xff;
-								out[3] = p1 >> 8;
-								out[0] = p2 & 0xff;
-								out[1] = p2 >> 8;
+								Image::writeBlockRow<byte>(out, p2 & 0xff, p2 >> 8, p1 & 0xff, p1 >> 8);
 								out += stride;
 							}
 						}
 						break;
 					case 1:
 						p1 = _FullTree->getCode(bs);
-						out[0] = out[1] = p1 & 0xFF;
-						out[2] = out[3] = p1 >> 8;
+						Image::writeBlockRow<byte>(out, p1 & 0xFF, p1 & 0xFF, p1 >> 8, p1 >> 8);
 						out += stride;
-						out[0] = out[1] = p1 & 0xFF;
-						out[2] = out[3] = p1 >> 8;
+						Image::writeBlockRow<byte>(out, p1 & 0xFF, p1 & 0xFF, p1 >> 8, p1 >> 8);
 						out += stride;
 						p2 = _FullTree->getCode(bs);
-						out[0] = out[1] = p2 & 0xFF;
-						out[2] = out[3] = p2 >> 8;
+						Image::writeBlockRow<byte>(out, p2 & 0xFF, p2 & 0xFF, p2 >> 8, p2 >> 8);
 						out += stride;
-						out[0] = out[1] = p2 & 0xFF;
-						out[2] = out[3] = p2 >> 8;
+						Image::writeBlockRow<byte>(out, p2 & 0xFF, p2 & 0xFF, p2 >> 8, p2 >> 8);
 						out += stride;
 						break;
 					case 2:
@@ -659,18 +651,8 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB
 							// http://article.gmane.org/gmane.comp.video.ffmpeg.devel/78768
 							p2 = _FullTree->getCode(bs);
 							p1 = _FullTree->getCode(bs);
-							for (j = 0; j < doubleY; ++j) {
-								out[0] = p1 & 0xff;
-								out[1] = p1 >> 8;
-								out[2] = p2 & 0xff;
-								out[3] = p2 >> 8;
-								out += stride;
-							}
-							for (j = 0; j < doubleY; ++j) {
-								out[0] = p1 & 0xff;
-								out[1] = p1 >> 8;
-								out[2] = p2 & 0xff;
-								out[3] = p2 >> 8;
+							for (j = 0; j < 2 * doubleY; ++j) {
+								Image::writeBlockRow<byte>(out, p1 & 0xff, p1 >> 8, p2 & 0xff, p2 >> 8);
 								out += stride;
 							}
 						}
@@ -684,15 +666,10 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB
 				block++;
 			break;
 		case SMK_BLOCK_FILL:
-			uint32 col;
 			mode = type >> 8;
 			while (run-- && block < blocks) {
 				out = (byte *)_surface->getPixels() + (block / bw) * (stride * 4 * doubleY) + (block % bw) * 4;
-				col = mode * 0x01010101;
-				for (i = 0; i < 4 * doubleY; ++i) {
-					out[0] = out[1] = out[2] = out[3] = col;
-					out += stride;
-				}
+				Image::fillBlock<byte>(out, stride, mode, 4 * doubleY);
 				++block;
 			}
 			break;
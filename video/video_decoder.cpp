@@ -49,6 +49,14 @@ VideoDecoder::VideoDecoder() {
 	_nextVideoTrack = 0;
 	_mainAudioTrack = 0;
 	_canSetDither = true;
+	_prefetchFrameCount = 0;
+	_prefetchUnavailable = false;
+	_prefetchTrack = 0;
+	_prefetchHead = _prefetchQueued = 0;
+	_prefetchPresenting = _prefetchDone = _prefetchQuit = false;
+	_prefetchMutex = 0;
+	_prefetchFreeSem = _prefetchReadySem = 0;
+	_prefetchThread = 0;
 
 	// Find the best format for output
 	_defaultHighColorFormat = g_system->getScreenFormat();
@@ -58,6 +66,15 @@ VideoDecoder::VideoDecoder() {
 }
 
 void VideoDecoder::close() {
+	stopPrefetch();
+
+	for (uint i = 0; i < _prefetchFrames.size(); i++)
+		_prefetchFrames[i].surface.free();
+
+	_prefetchFrames.clear();
+	_prefetchFrameCount = 0;
+	_prefetchUnavailable = false;
+
 	if (isPlaying())
 		stop();
 
@@ -185,6 +202,9 @@ const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	_needsUpdate = false;
 	_canSetDither = false;
 
+	if (_prefetchFrameCount && (_prefetchThread || startPrefetch()))
+		return decodePrefetchedFrame();
+
 	readNextPacket();
 
 	// If we have no next video track at this point, there shouldn't be
@@ -210,6 +230,10 @@ bool VideoDecoder::setReverse(bool reverse) {
 	if (reverse && hasAudio())
 		return false;
 
+	// Prefetched frames are only decoded forwards
+	if (reverse && _prefetchFrameCount)
+		return false;
+
 	// Attempt to make sure all the tracks are in the requested direction
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		if ((*it)->getTrackType() == Track::kTrackTypeVideo && ((VideoTrack *)*it)->isReversed() != reverse) {
@@ -234,7 +258,7 @@ int VideoDecoder::getCurFrame() const {
 
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		if ((*it)->getTrackType() == Track::kTrackTypeVideo)
-			frame += ((VideoTrack *)*it)->getCurFrame() + 1;
+			frame += getPresentedCurFrame((const VideoTrack *)*it) + 1;
 
 	return frame;
 }
@@ -275,7 +299,7 @@ uint32 VideoDecoder::getTimeToNextFrame() const {
 		return 0;
 
 	uint32 currentTime = getTime();
-	uint32 nextFrameStartTime = _nextVideoTrack->getNextFrameStartTime();
+	uint32 nextFrameStartTime = getPresentedNextFrameStartTime(_nextVideoTrack);
 
 	if (_nextVideoTrack->isReversed()) {
 		// For reversed videos, we need to handle the time difference the opposite way.
@@ -296,8 +320,8 @@ bool VideoDecoder::endOfVideo() const {
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		const Track *track = *it;
 
-		bool videoEndTimeReached = _endTimeSet && track->getTrackType() == Track::kTrackTypeVideo && ((const VideoTrack *)track)->getNextFrameStartTime() >= (uint)_endTime.msecs();
-		bool endReached = track->endOfTrack() || (isPlaying() && videoEndTimeReached);
+		bool videoEndTimeReached = _endTimeSet && track->getTrackType() == Track::kTrackTypeVideo && getPresentedNextFrameStartTime((const VideoTrack *)track) >= (uint)_endTime.msecs();
+		bool endReached = isPresentedEndOfTrack(track) || (isPlaying() && videoEndTimeReached);
 		if (!endReached)
 			return false;
 	}
@@ -320,6 +344,9 @@ bool VideoDecoder::rewind() {
 	if (!isRewindable())
 		return false;
 
+	// The prefetched frames are of no use anymore
+	stopPrefetch();
+
 	// Stop all tracks so they can be rewound
 	if (isPlaying())
 		stopAudio();
@@ -354,6 +381,9 @@ bool VideoDecoder::seek(const Audio::Timestamp &time) {
 	if (!isSeekable())
 		return false;
 
+	// The prefetched frames are of no use anymore
+	stopPrefetch();
+
 	// Stop all tracks so they can be seeked
 	if (isPlaying())
 		stopAudio();
@@ -523,6 +553,218 @@ bool VideoDecoder::setDitheringPalette(const byte *palette) {
 	return result;
 }
 
+bool VideoDecoder::setPrefetchFrames(uint count) {
+	// If a frame was already decoded, we can't set it now.
+	if (!_canSetDither)
+		return false;
+
+	_prefetchFrameCount = count;
+	return true;
+}
+
+bool VideoDecoder::startPrefetch() {
+	if (_prefetchUnavailable)
+		return false;
+
+	// Only a single video track played forwards can be prefetched
+	VideoTrack *track = 0;
+
+	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++) {
+		if ((*it)->getTrackType() == Track::kTrackTypeVideo) {
+			if (track) {
+				track = 0;
+				break;
+			}
+
+			track = (VideoTrack *)*it;
+		}
+	}
+
+	if (track && !track->isReversed()) {
+		_prefetchTrack = track;
+		_prefetchState.curFrame = track->getCurFrame();
+		_prefetchState.nextFrameStartTime = track->getNextFrameStartTime();
+		_prefetchState.endOfTrack = track->endOfTrack();
+		_prefetchHead = _prefetchQueued = 0;
+		_prefetchPresenting = _prefetchDone = _prefetchQuit = false;
+
+		// One frame more than requested, for the frame handed out last
+		if (_prefetchFrames.size() != _prefetchFrameCount + 1) {
+			for (uint i = 0; i < _prefetchFrames.size(); i++)
+				_prefetchFrames[i].surface.free();
+
+			_prefetchFrames.clear();
+			_prefetchFrames.resize(_prefetchFrameCount + 1);
+		}
+
+		_prefetchMutex = g_system->createMutex();
+		_prefetchFreeSem = g_system->createSemaphore(_prefetchFrames.size());
+		_prefetchReadySem = g_system->createSemaphore(0);
+
+		if (_prefetchMutex && _prefetchFreeSem && _prefetchReadySem)
+			_prefetchThread = g_system->createThread(prefetchProc, this);
+	}
+
+	if (!_prefetchThread) {
+		// Decode the frames on demand instead
+		g_system->deleteSemaphore(_prefetchReadySem);
+		g_system->deleteSemaphore(_prefetchFreeSem);
+		g_system->deleteMutex(_prefetchMutex);
+		_prefetchMutex = 0;
+		_prefetchFreeSem = _prefetchReadySem = 0;
+		_prefetchUnavailable = true;
+		return false;
+	}
+
+	return true;
+}
+
+void VideoDecoder::stopPrefetch() {
+	if (!_prefetchThread)
+		return;
+
+	g_system->lockMutex(_prefetchMutex);
+	_prefetchQuit = true;
+	g_system->unlockMutex(_prefetchMutex);
+
+	// Wake up the thread in case it waits for a free frame
+	g_system->postSemaphore(_prefetchFreeSem);
+	g_system->joinThread(_prefetchThread);
+	_prefetchThread = 0;
+
+	g_system->deleteSemaphore(_prefetchReadySem);
+	g_system->deleteSemaphore(_prefetchFreeSem);
+	g_system->deleteMutex(_prefetchMutex);
+	_prefetchMutex = 0;
+	_prefetchFreeSem = _prefetchReadySem = 0;
+}
+
+const Graphics::Surface *VideoDecoder::decodePrefetchedFrame() {
+	// The frame handed out last may be overwritten from now on
+	if (_prefetchPresenting) {
+		_prefetchPresenting = false;
+		g_system->postSemaphore(_prefetchFreeSem);
+	}
+
+	bool available, done;
+
+	while (true) {
+		g_system->lockMutex(_prefetchMutex);
+		available = _prefetchQueued != 0;
+		done = _prefetchDone;
+		g_system->unlockMutex(_prefetchMutex);
+
+		if (available || done)
+			break;
+
+		g_system->waitSemaphore(_prefetchReadySem);
+	}
+
+	if (!available) {
+		// The thread is done with the tracks, so there is no need to
+		// synchronize with it anymore
+		readNextPacket();
+		return 0;
+	}
+
+	const PrefetchedFrame &frame = _prefetchFrames[_prefetchHead];
+
+	g_system->lockMutex(_prefetchMutex);
+	_prefetchHead = (_prefetchHead + 1) % _prefetchFrames.size();
+	_prefetchQueued--;
+	g_system->unlockMutex(_prefetchMutex);
+
+	_prefetchPresenting = true;
+	_prefetchState = frame.state;
+
+	if (frame.dirtyPalette) {
+		memcpy(_prefetchPalette, frame.palette, sizeof(_prefetchPalette));
+		_palette = _prefetchPalette;
+		_dirtyPalette = true;
+	}
+
+	return frame.hasSurface ? &frame.surface : 0;
+}
+
+void VideoDecoder::prefetchFrame(PrefetchedFrame &frame) {
+	readNextPacket();
+
+	const Graphics::Surface *surface = _prefetchTrack->decodeNextFrame();
+	frame.hasSurface = surface != 0;
+
+	if (surface) {
+		// Keep the memory of the frame unless the frame size changed
+		if (frame.surface.w != surface->w || frame.surface.h != surface->h || frame.surface.format != surface->format) {
+			frame.surface.free();
+			frame.surface.create(surface->w, surface->h, surface->format);
+		}
+
+		frame.surface.copyRectToSurface(surface->getPixels(), surface->pitch, 0, 0, surface->w, surface->h);
+	}
+
+	frame.dirtyPalette = _prefetchTrack->hasDirtyPalette();
+
+	if (frame.dirtyPalette)
+		memcpy(frame.palette, _prefetchTrack->getPalette(), sizeof(frame.palette));
+
+	frame.state.curFrame = _prefetchTrack->getCurFrame();
+	frame.state.nextFrameStartTime = _prefetchTrack->getNextFrameStartTime();
+	frame.state.endOfTrack = _prefetchTrack->endOfTrack();
+}
+
+void VideoDecoder::prefetchProc(void *param) {
+	VideoDecoder *decoder = (VideoDecoder *)param;
+	bool endOfTrack = decoder->_prefetchTrack->endOfTrack();
+
+	while (!endOfTrack) {
+		g_system->waitSemaphore(decoder->_prefetchFreeSem);
+
+		g_system->lockMutex(decoder->_prefetchMutex);
+		const bool quit = decoder->_prefetchQuit;
+		const uint index = (decoder->_prefetchHead + decoder->_prefetchQueued) % decoder->_prefetchFrames.size();
+		g_system->unlockMutex(decoder->_prefetchMutex);
+
+		if (quit)
+			break;
+
+		PrefetchedFrame &frame = decoder->_prefetchFrames[index];
+		decoder->prefetchFrame(frame);
+		endOfTrack = frame.state.endOfTrack;
+
+		g_system->lockMutex(decoder->_prefetchMutex);
+		decoder->_prefetchQueued++;
+		g_system->unlockMutex(decoder->_prefetchMutex);
+		g_system->postSemaphore(decoder->_prefetchReadySem);
+	}
+
+	g_system->lockMutex(decoder->_prefetchMutex);
+	decoder->_prefetchDone = true;
+	g_system->unlockMutex(decoder->_prefetchMutex);
+	g_system->postSemaphore(decoder->_prefetchReadySem);
+}
+
+int VideoDecoder::getPresentedCurFrame(const VideoTrack *track) const {
+	// While prefetching, the track is ahead of the frames handed out
+	if (_prefetchThread && track == _prefetchTrack)
+		return _prefetchState.curFrame;
+
+	return track->getCurFrame();
+}
+
+uint32 VideoDecoder::getPresentedNextFrameStartTime(const VideoTrack *track) const {
+	if (_prefetchThread && track == _prefetchTrack)
+		return _prefetchState.nextFrameStartTime;
+
+	return track->getNextFrameStartTime();
+}
+
+bool VideoDecoder::isPresentedEndOfTrack(const Track *track) const {
+	if (_prefetchThread && track == _prefetchTrack)
+		return _prefetchState.endOfTrack;
+
+	return track->endOfTrack();
+}
+
 VideoDecoder::Track::Track() {
 	_paused = false;
 }
@@ -921,8 +1163,8 @@ bool VideoDecoder::hasFramesLeft() const {
 
 		const VideoTrack *track = (const VideoTrack *)*it;
 
-		bool videoEndTimeReached = _endTimeSet && track->getNextFrameStartTime() >= (uint)_endTime.msecs();
-		bool endReached = track->endOfTrack() || (isPlaying() && videoEndTimeReached);
+		bool videoEndTimeReached = _endTimeSet && getPresentedNextFrameStartTime(track) >= (uint)_endTime.msecs();
+		bool endReached = isPresentedEndOfTrack(track) || (isPlaying() && videoEndTimeReached);
 		if (!endReached)
 			return true;
 	}
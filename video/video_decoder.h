@@ -28,7 +28,9 @@
 #include "common/array.h"
 #include "common/rational.h"
 #include "common/str.h"
+#include "common/system.h"
 #include "graphics/pixelformat.h"
+#include "graphics/surface.h"
 
 namespace Audio {
 class AudioStream;
@@ -40,10 +42,6 @@ namespace Common {
 class SeekableReadStream;
 }
 
-namespace Graphics {
-struct Surface;
-}
-
 namespace Video {
 
 /**
@@ -396,6 +394,27 @@ public:
 	 */
 	bool setDitheringPalette(const byte *palette);
 
+	/**
+	 * Decode frames ahead of time in a background thread.
+	 *
+	 * The given number of frames is decoded while the previous frames are
+	 * displayed, which evens out the time spent in decodeNextFrame() for
+	 * codecs with expensive frames. Frames are only prefetched for videos
+	 * with a single video track played forwards, and only on backends with
+	 * thread support; otherwise frames are decoded on demand as usual.
+	 * Reversed playback is refused while prefetching is requested.
+	 *
+	 * While frames are prefetched, the tracks must only be accessed through
+	 * the VideoDecoder. Seeking and rewinding discard the prefetched frames.
+	 *
+	 * This should be called after loadStream(), but before a decodeNextFrame()
+	 * call. This is enforced. The setting remains until close() is called.
+	 *
+	 * @param count The number of frames to decode ahead, 0 to disable
+	 * @return true on success, false otherwise
+	 */
+	bool setPrefetchFrames(uint count);
+
 	/////////////////////////////////////////
 	// Audio Control
 	/////////////////////////////////////////
@@ -946,6 +965,46 @@ private:
 	// Enforcement of not being able to set dither
 	bool _canSetDither;
 
+	// State of a video track after decoding a frame
+	struct FrameState {
+		int curFrame;
+		uint32 nextFrameStartTime;
+		bool endOfTrack;
+	};
+
+	// A frame decoded by the prefetch thread
+	struct PrefetchedFrame {
+		Graphics::Surface surface;
+		bool hasSurface;
+		bool dirtyPalette;
+		byte palette[256 * 3];
+		FrameState state;
+	};
+
+	// Frame prefetching
+	uint _prefetchFrameCount;
+	bool _prefetchUnavailable;
+	VideoTrack *_prefetchTrack;
+	Common::Array<PrefetchedFrame> _prefetchFrames;
+	uint _prefetchHead, _prefetchQueued;
+	bool _prefetchPresenting, _prefetchDone, _prefetchQuit;
+	FrameState _prefetchState; // State after the frame handed out last
+	byte _prefetchPalette[256 * 3];
+	OSystem::MutexRef _prefetchMutex;
+	OSystem::SemaphoreRef _prefetchFreeSem, _prefetchReadySem;
+	OSystem::ThreadRef _prefetchThread;
+
+	bool startPrefetch();
+	void stopPrefetch();
+	const Graphics::Surface *decodePrefetchedFrame();
+	void prefetchFrame(PrefetchedFrame &frame);
+	static void prefetchProc(void *param);
+
+	// Track state as seen by the user, which lags behind while prefetching
+	int getPresentedCurFrame(const VideoTrack *track) const;
+	uint32 getPresentedNextFrameStartTime(const VideoTrack *track) const;
+	bool isPresentedEndOfTrack(const Track *track) const;
+
 	// Default PixelFormat settings
 	Graphics::PixelFormat _defaultHighColorFormat;
 
@@ -0,0 +1,113 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "video/video_player.h"
+
+#include "common/system.h"
+#include "common/textconsole.h"
+#include "common/util.h"
+
+#include "graphics/conversion.h"
+#include "graphics/palette.h"
+#include "graphics/surface.h"
+
+#include "video/video_decoder.h"
+
+namespace Video {
+
+VideoPlayer::VideoPlayer(VideoDecoder *decoder) : _decoder(decoder), _x(0), _y(0), _hasPalette(false) {
+}
+
+void VideoPlayer::setPosition(int x, int y) {
+	_x = x;
+	_y = y;
+}
+
+bool VideoPlayer::update() {
+	if (!_decoder->needsUpdate())
+		return false;
+
+	const Graphics::Surface *frame = _decoder->decodeNextFrame();
+
+	if (_decoder->hasDirtyPalette())
+		setPalette(_decoder->getPalette());
+
+	if (!frame)
+		return false;
+
+	drawFrame(*frame);
+	return true;
+}
+
+void VideoPlayer::drawFrame(const Graphics::Surface &frame) {
+	const Graphics::PixelFormat screenFormat = g_system->getScreenFormat();
+
+	const int srcX = MAX(-_x, 0);
+	const int srcY = MAX(-_y, 0);
+	const int dstX = MAX(_x, 0);
+	const int dstY = MAX(_y, 0);
+	const int w = MIN<int>(frame.w - srcX, g_system->getWidth() - dstX);
+	const int h = MIN<int>(frame.h - srcY, g_system->getHeight() - dstY);
+
+	if (w <= 0 || h <= 0)
+		return;
+
+	const byte *src = (const byte *)frame.getBasePtr(srcX, srcY);
+
+	if (frame.format == screenFormat) {
+		g_system->copyRectToScreen(src, frame.pitch, dstX, dstY, w, h);
+		return;
+	}
+
+	// Paletted frames can only be mapped once the palette is known
+	if (frame.format.bytesPerPixel == 1 && !_hasPalette)
+		return;
+
+	Graphics::Surface *screen = g_system->lockScreen();
+	if (!screen)
+		return;
+
+	byte *dst = (byte *)screen->getBasePtr(dstX, dstY);
+
+	if (frame.format.bytesPerPixel == 1)
+		Graphics::crossBlitMap(dst, src, screen->pitch, frame.pitch, w, h, screen->format.bytesPerPixel, _paletteMap);
+	else if (!Graphics::crossBlit(dst, src, screen->pitch, frame.pitch, w, h, screen->format, frame.format))
+		warning("VideoPlayer: Cannot convert frames from %s to %s", frame.format.toString().c_str(), screen->format.toString().c_str());
+
+	g_system->unlockScreen();
+}
+
+void VideoPlayer::setPalette(const byte *palette) {
+	const Graphics::PixelFormat screenFormat = g_system->getScreenFormat();
+
+	if (screenFormat.bytesPerPixel == 1) {
+		g_system->getPaletteManager()->setPalette(palette, 0, 256);
+		return;
+	}
+
+	for (int i = 0; i < 256; i++, palette += 3)
+		_paletteMap[i] = screenFormat.RGBToColor(palette[0], palette[1], palette[2]);
+
+	_hasPalette = true;
+}
+
+} // End of namespace Video
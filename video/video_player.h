@@ -0,0 +1,85 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef VIDEO_VIDEO_PLAYER_H
+#define VIDEO_VIDEO_PLAYER_H
+
+#include "common/scummsys.h"
+
+namespace Graphics {
+struct Surface;
+}
+
+namespace Video {
+
+class VideoDecoder;
+
+/**
+ * Helper for showing the frames of a video on the screen.
+ *
+ * Frames in the screen format are copied to the screen. Frames in other
+ * formats are converted straight into the locked screen, instead of being
+ * converted into a temporary surface first, which is then copied to the
+ * screen. Paletted frames are shown with the palette of the video, either
+ * by setting the palette of an 8bpp screen or by mapping the colors.
+ *
+ * The caller still has to call OSystem::updateScreen().
+ */
+class VideoPlayer {
+public:
+	/**
+	 * Create a player for the given decoder. The decoder is not owned by
+	 * the player.
+	 */
+	VideoPlayer(VideoDecoder *decoder);
+
+	/**
+	 * Set the position of the top left corner of the video on the screen.
+	 */
+	void setPosition(int x, int y);
+
+	/**
+	 * Decode the next frame and draw it on the screen, if it is due.
+	 *
+	 * @return true if the screen was changed, false otherwise
+	 */
+	bool update();
+
+	/**
+	 * Draw a frame on the screen, converting it to the screen format.
+	 * Parts of the frame outside of the screen are clipped.
+	 */
+	void drawFrame(const Graphics::Surface &frame);
+
+private:
+	void setPalette(const byte *palette);
+
+	VideoDecoder *_decoder;
+	int _x, _y;
+
+	bool _hasPalette;
+	uint32 _paletteMap[256];
+};
+
+} // End of namespace Video
+
+#endif